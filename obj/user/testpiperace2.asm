@@ -0,0 +1,8241 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b5 02 00 00       	call   8002d8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 9a 3b 80 00 00 	movabs $0x803b9a,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 98 00 00 00    	js     800101 <umain+0xdc>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 ae 00 00 00    	js     80012e <umain+0x109>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 d1 00 00 00    	je     80015b <umain+0x136>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80008d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800092:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800099:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000a0:	00 00 00 
+  8000a3:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000a6:	49 bc a6 3d 80 00 00 	movabs $0x803da6,%r12
+  8000ad:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000b0:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8000b6:	83 f8 02             	cmp    $0x2,%eax
+  8000b9:	0f 85 43 01 00 00    	jne    800202 <umain+0x1dd>
+        if (pipeisclosed(p[0]) != 0) {
+  8000bf:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000c2:	41 ff d4             	call   *%r12
+  8000c5:	85 c0                	test   %eax,%eax
+  8000c7:	74 e7                	je     8000b0 <umain+0x8b>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000c9:	48 bf 7d 50 80 00 00 	movabs $0x80507d,%rdi
+  8000d0:	00 00 00 
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  8000df:	00 00 00 
+  8000e2:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000e4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000e7:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+            exit();
+  8000f3:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+  8000ff:	eb af                	jmp    8000b0 <umain+0x8b>
+        panic("pipe: %i", r);
+  800101:	89 c1                	mov    %eax,%ecx
+  800103:	48 ba 52 50 80 00 00 	movabs $0x805052,%rdx
+  80010a:	00 00 00 
+  80010d:	be 0c 00 00 00       	mov    $0xc,%esi
+  800112:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800119:	00 00 00 
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800121:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  800128:	00 00 00 
+  80012b:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  800137:	00 00 00 
+  80013a:	be 0e 00 00 00       	mov    $0xe,%esi
+  80013f:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800146:	00 00 00 
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+        close(p[1]);
+  80015b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80015e:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  80016a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  80016d:	49 bf 79 50 80 00 00 	movabs $0x805079,%r15
+  800174:	00 00 00 
+  800177:	49 be f4 04 80 00 00 	movabs $0x8004f4,%r14
+  80017e:	00 00 00 
+            dup(p[0], 10);
+  800181:	49 bd 3e 23 80 00 00 	movabs $0x80233e,%r13
+  800188:	00 00 00 
+            sys_yield();
+  80018b:	49 bc 3d 15 80 00 00 	movabs $0x80153d,%r12
+  800192:	00 00 00 
+  800195:	eb 2d                	jmp    8001c4 <umain+0x19f>
+            dup(p[0], 10);
+  800197:	be 0a 00 00 00       	mov    $0xa,%esi
+  80019c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80019f:	41 ff d5             	call   *%r13
+            sys_yield();
+  8001a2:	41 ff d4             	call   *%r12
+            close(10);
+  8001a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001aa:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+            sys_yield();
+  8001b6:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001b9:	83 c3 01             	add    $0x1,%ebx
+  8001bc:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001c2:	74 2d                	je     8001f1 <umain+0x1cc>
+            if (i % 10 == 0)
+  8001c4:	48 63 c3             	movslq %ebx,%rax
+  8001c7:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001ce:	48 c1 f8 22          	sar    $0x22,%rax
+  8001d2:	89 da                	mov    %ebx,%edx
+  8001d4:	c1 fa 1f             	sar    $0x1f,%edx
+  8001d7:	29 d0                	sub    %edx,%eax
+  8001d9:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001dc:	01 c0                	add    %eax,%eax
+  8001de:	39 c3                	cmp    %eax,%ebx
+  8001e0:	75 b5                	jne    800197 <umain+0x172>
+                cprintf("%d.", i);
+  8001e2:	89 de                	mov    %ebx,%esi
+  8001e4:	4c 89 ff             	mov    %r15,%rdi
+  8001e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ec:	41 ff d6             	call   *%r14
+  8001ef:	eb a6                	jmp    800197 <umain+0x172>
+        exit();
+  8001f1:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+  8001fd:	e9 88 fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  800202:	48 bf 99 50 80 00 00 	movabs $0x805099,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  800218:	00 00 00 
+  80021b:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80021d:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800220:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+  80022c:	85 c0                	test   %eax,%eax
+  80022e:	75 51                	jne    800281 <umain+0x25c>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800230:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800234:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800237:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+  800243:	85 c0                	test   %eax,%eax
+  800245:	78 64                	js     8002ab <umain+0x286>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  800247:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80024b:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  800252:	00 00 00 
+  800255:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  800257:	48 bf c7 50 80 00 00 	movabs $0x8050c7,%rdi
+  80025e:	00 00 00 
+  800261:	b8 00 00 00 00       	mov    $0x0,%eax
+  800266:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  80026d:	00 00 00 
+  800270:	ff d2                	call   *%rdx
+}
+  800272:	48 83 c4 28          	add    $0x28,%rsp
+  800276:	5b                   	pop    %rbx
+  800277:	41 5c                	pop    %r12
+  800279:	41 5d                	pop    %r13
+  80027b:	41 5e                	pop    %r14
+  80027d:	41 5f                	pop    %r15
+  80027f:	5d                   	pop    %rbp
+  800280:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  800281:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800288:	00 00 00 
+  80028b:	be 40 00 00 00       	mov    $0x40,%esi
+  800290:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800297:	00 00 00 
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  8002a6:	00 00 00 
+  8002a9:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002ab:	89 c1                	mov    %eax,%ecx
+  8002ad:	48 ba af 50 80 00 00 	movabs $0x8050af,%rdx
+  8002b4:	00 00 00 
+  8002b7:	be 42 00 00 00       	mov    $0x42,%esi
+  8002bc:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  8002c3:	00 00 00 
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  8002d2:	00 00 00 
+  8002d5:	41 ff d0             	call   *%r8
+
+00000000008002d8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002d8:	55                   	push   %rbp
+  8002d9:	48 89 e5             	mov    %rsp,%rbp
+  8002dc:	41 56                	push   %r14
+  8002de:	41 55                	push   %r13
+  8002e0:	41 54                	push   %r12
+  8002e2:	53                   	push   %rbx
+  8002e3:	41 89 fd             	mov    %edi,%r13d
+  8002e6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002e9:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8002f0:	00 00 00 
+  8002f3:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8002fa:	00 00 00 
+  8002fd:	48 39 c2             	cmp    %rax,%rdx
+  800300:	73 17                	jae    800319 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800302:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800305:	49 89 c4             	mov    %rax,%r12
+  800308:	48 83 c3 08          	add    $0x8,%rbx
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	ff 53 f8             	call   *-0x8(%rbx)
+  800314:	4c 39 e3             	cmp    %r12,%rbx
+  800317:	72 ef                	jb     800308 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800319:	48 b8 0c 15 80 00 00 	movabs $0x80150c,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+  800325:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80032a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800331:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800338:	00 00 00 
+  80033b:	48 01 d0             	add    %rdx,%rax
+  80033e:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800345:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800348:	45 85 ed             	test   %r13d,%r13d
+  80034b:	7e 0d                	jle    80035a <libmain+0x82>
+  80034d:	49 8b 06             	mov    (%r14),%rax
+  800350:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800357:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80035a:	4c 89 f6             	mov    %r14,%rsi
+  80035d:	44 89 ef             	mov    %r13d,%edi
+  800360:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80036c:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  800373:	00 00 00 
+  800376:	ff d0                	call   *%rax
+#endif
+}
+  800378:	5b                   	pop    %rbx
+  800379:	41 5c                	pop    %r12
+  80037b:	41 5d                	pop    %r13
+  80037d:	41 5e                	pop    %r14
+  80037f:	5d                   	pop    %rbp
+  800380:	c3                   	ret
+
+0000000000800381 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800381:	55                   	push   %rbp
+  800382:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800385:	48 b8 16 23 80 00 00 	movabs $0x802316,%rax
+  80038c:	00 00 00 
+  80038f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800391:	bf 00 00 00 00       	mov    $0x0,%edi
+  800396:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  80039d:	00 00 00 
+  8003a0:	ff d0                	call   *%rax
+}
+  8003a2:	5d                   	pop    %rbp
+  8003a3:	c3                   	ret
+
+00000000008003a4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003a4:	55                   	push   %rbp
+  8003a5:	48 89 e5             	mov    %rsp,%rbp
+  8003a8:	41 56                	push   %r14
+  8003aa:	41 55                	push   %r13
+  8003ac:	41 54                	push   %r12
+  8003ae:	53                   	push   %rbx
+  8003af:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b3:	49 89 fc             	mov    %rdi,%r12
+  8003b6:	41 89 f5             	mov    %esi,%r13d
+  8003b9:	48 89 d3             	mov    %rdx,%rbx
+  8003bc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003c0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003c4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003c8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003d7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003db:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003df:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003e6:	00 00 00 
+  8003e9:	4c 8b 30             	mov    (%rax),%r14
+  8003ec:	48 b8 0c 15 80 00 00 	movabs $0x80150c,%rax
+  8003f3:	00 00 00 
+  8003f6:	ff d0                	call   *%rax
+  8003f8:	89 c6                	mov    %eax,%esi
+  8003fa:	45 89 e8             	mov    %r13d,%r8d
+  8003fd:	4c 89 e1             	mov    %r12,%rcx
+  800400:	4c 89 f2             	mov    %r14,%rdx
+  800403:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  80040a:	00 00 00 
+  80040d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800412:	49 bc f4 04 80 00 00 	movabs $0x8004f4,%r12
+  800419:	00 00 00 
+  80041c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80041f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800423:	48 89 df             	mov    %rbx,%rdi
+  800426:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+    cprintf("\n");
+  800432:	48 bf 97 50 80 00 00 	movabs $0x805097,%rdi
+  800439:	00 00 00 
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800444:	cc                   	int3
+  800445:	eb fd                	jmp    800444 <_panic+0xa0>
+
+0000000000800447 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	53                   	push   %rbx
+  80044c:	48 83 ec 08          	sub    $0x8,%rsp
+  800450:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800453:	8b 06                	mov    (%rsi),%eax
+  800455:	8d 50 01             	lea    0x1(%rax),%edx
+  800458:	89 16                	mov    %edx,(%rsi)
+  80045a:	48 98                	cltq
+  80045c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800461:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800467:	74 0a                	je     800473 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800469:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80046d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800471:	c9                   	leave
+  800472:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800473:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800477:	be ff 00 00 00       	mov    $0xff,%esi
+  80047c:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  800483:	00 00 00 
+  800486:	ff d0                	call   *%rax
+        state->offset = 0;
+  800488:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80048e:	eb d9                	jmp    800469 <putch+0x22>
+
+0000000000800490 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800490:	55                   	push   %rbp
+  800491:	48 89 e5             	mov    %rsp,%rbp
+  800494:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80049b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80049e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004a5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004b2:	48 89 f1             	mov    %rsi,%rcx
+  8004b5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004bc:	48 bf 47 04 80 00 00 	movabs $0x800447,%rdi
+  8004c3:	00 00 00 
+  8004c6:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  8004cd:	00 00 00 
+  8004d0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004d2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004d9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004e0:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004ec:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004f2:	c9                   	leave
+  8004f3:	c3                   	ret
+
+00000000008004f4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004f4:	55                   	push   %rbp
+  8004f5:	48 89 e5             	mov    %rsp,%rbp
+  8004f8:	48 83 ec 50          	sub    $0x50,%rsp
+  8004fc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800500:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800504:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800508:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80050c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800510:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800517:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80051b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800523:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800527:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80052b:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800537:	c9                   	leave
+  800538:	c3                   	ret
+
+0000000000800539 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800539:	55                   	push   %rbp
+  80053a:	48 89 e5             	mov    %rsp,%rbp
+  80053d:	41 57                	push   %r15
+  80053f:	41 56                	push   %r14
+  800541:	41 55                	push   %r13
+  800543:	41 54                	push   %r12
+  800545:	53                   	push   %rbx
+  800546:	48 83 ec 18          	sub    $0x18,%rsp
+  80054a:	49 89 fc             	mov    %rdi,%r12
+  80054d:	49 89 f5             	mov    %rsi,%r13
+  800550:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800554:	8b 45 10             	mov    0x10(%rbp),%eax
+  800557:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80055a:	41 89 cf             	mov    %ecx,%r15d
+  80055d:	4c 39 fa             	cmp    %r15,%rdx
+  800560:	73 5b                	jae    8005bd <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800562:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800566:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80056a:	85 db                	test   %ebx,%ebx
+  80056c:	7e 0e                	jle    80057c <print_num+0x43>
+            putch(padc, put_arg);
+  80056e:	4c 89 ee             	mov    %r13,%rsi
+  800571:	44 89 f7             	mov    %r14d,%edi
+  800574:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800577:	83 eb 01             	sub    $0x1,%ebx
+  80057a:	75 f2                	jne    80056e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80057c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800580:	48 b9 1c 51 80 00 00 	movabs $0x80511c,%rcx
+  800587:	00 00 00 
+  80058a:	48 b8 0b 51 80 00 00 	movabs $0x80510b,%rax
+  800591:	00 00 00 
+  800594:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800598:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80059c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a1:	49 f7 f7             	div    %r15
+  8005a4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	41 ff d4             	call   *%r12
+}
+  8005ae:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005b2:	5b                   	pop    %rbx
+  8005b3:	41 5c                	pop    %r12
+  8005b5:	41 5d                	pop    %r13
+  8005b7:	41 5e                	pop    %r14
+  8005b9:	41 5f                	pop    %r15
+  8005bb:	5d                   	pop    %rbp
+  8005bc:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c6:	49 f7 f7             	div    %r15
+  8005c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005d1:	52                   	push   %rdx
+  8005d2:	45 0f be c9          	movsbl %r9b,%r9d
+  8005d6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005da:	48 89 c2             	mov    %rax,%rdx
+  8005dd:	48 b8 39 05 80 00 00 	movabs $0x800539,%rax
+  8005e4:	00 00 00 
+  8005e7:	ff d0                	call   *%rax
+  8005e9:	48 83 c4 10          	add    $0x10,%rsp
+  8005ed:	eb 8d                	jmp    80057c <print_num+0x43>
+
+00000000008005ef <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005ef:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005f3:	48 8b 06             	mov    (%rsi),%rax
+  8005f6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005fa:	73 0a                	jae    800606 <sprintputch+0x17>
+        *state->start++ = ch;
+  8005fc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800600:	48 89 16             	mov    %rdx,(%rsi)
+  800603:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800606:	c3                   	ret
+
+0000000000800607 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800607:	55                   	push   %rbp
+  800608:	48 89 e5             	mov    %rsp,%rbp
+  80060b:	48 83 ec 50          	sub    $0x50,%rsp
+  80060f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800613:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800617:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80061b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800622:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800626:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80062e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800632:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800636:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  80063d:	00 00 00 
+  800640:	ff d0                	call   *%rax
+}
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+0000000000800644 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800644:	55                   	push   %rbp
+  800645:	48 89 e5             	mov    %rsp,%rbp
+  800648:	41 57                	push   %r15
+  80064a:	41 56                	push   %r14
+  80064c:	41 55                	push   %r13
+  80064e:	41 54                	push   %r12
+  800650:	53                   	push   %rbx
+  800651:	48 83 ec 38          	sub    $0x38,%rsp
+  800655:	49 89 fe             	mov    %rdi,%r14
+  800658:	49 89 f5             	mov    %rsi,%r13
+  80065b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80065e:	48 8b 01             	mov    (%rcx),%rax
+  800661:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800665:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800669:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800671:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800675:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800679:	0f b6 3b             	movzbl (%rbx),%edi
+  80067c:	40 80 ff 25          	cmp    $0x25,%dil
+  800680:	74 18                	je     80069a <vprintfmt+0x56>
+            if (!ch) return;
+  800682:	40 84 ff             	test   %dil,%dil
+  800685:	0f 84 04 07 00 00    	je     800d8f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80068b:	40 0f b6 ff          	movzbl %dil,%edi
+  80068f:	4c 89 ee             	mov    %r13,%rsi
+  800692:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800695:	4c 89 e3             	mov    %r12,%rbx
+  800698:	eb db                	jmp    800675 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80069a:	be 00 00 00 00       	mov    $0x0,%esi
+  80069f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006a3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006a8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006ae:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006b5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006b9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006be:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006c3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006c6:	83 e8 23             	sub    $0x23,%eax
+  8006c9:	3c 57                	cmp    $0x57,%al
+  8006cb:	0f 87 a4 06 00 00    	ja     800d75 <vprintfmt+0x731>
+  8006d1:	0f b6 c0             	movzbl %al,%eax
+  8006d4:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  8006db:	00 00 00 
+  8006de:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006e1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006e4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006e8:	eb cf                	jmp    8006b9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006ea:	49 89 dc             	mov    %rbx,%r12
+  8006ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8006f2:	eb c5                	jmp    8006b9 <vprintfmt+0x75>
+            padc = ch;
+  8006f4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006f8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006fb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006fe:	eb b9                	jmp    8006b9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800700:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800703:	83 f8 2f             	cmp    $0x2f,%eax
+  800706:	77 24                	ja     80072c <vprintfmt+0xe8>
+  800708:	89 c1                	mov    %eax,%ecx
+  80070a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80070e:	83 c0 08             	add    $0x8,%eax
+  800711:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800714:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800717:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80071a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80071e:	79 99                	jns    8006b9 <vprintfmt+0x75>
+                width = precision;
+  800720:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800724:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072a:	eb 8d                	jmp    8006b9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80072c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800730:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800734:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800738:	eb da                	jmp    800714 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80073a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80073f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800743:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800749:	3c 39                	cmp    $0x39,%al
+  80074b:	77 1c                	ja     800769 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80074d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800751:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800755:	0f b6 c0             	movzbl %al,%eax
+  800758:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075d:	0f b6 03             	movzbl (%rbx),%eax
+  800760:	3c 39                	cmp    $0x39,%al
+  800762:	76 e9                	jbe    80074d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800764:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800767:	eb b1                	jmp    80071a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800769:	49 89 dc             	mov    %rbx,%r12
+  80076c:	eb ac                	jmp    80071a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80076e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	b8 00 00 00 00       	mov    $0x0,%eax
+  800778:	0f 49 c1             	cmovns %ecx,%eax
+  80077b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80077e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800781:	e9 33 ff ff ff       	jmp    8006b9 <vprintfmt+0x75>
+            lflag++;
+  800786:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800789:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80078c:	e9 28 ff ff ff       	jmp    8006b9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	77 19                	ja     8007b2 <vprintfmt+0x16e>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079f:	83 c0 08             	add    $0x8,%eax
+  8007a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a5:	8b 3a                	mov    (%rdx),%edi
+  8007a7:	4c 89 ee             	mov    %r13,%rsi
+  8007aa:	41 ff d6             	call   *%r14
+            break;
+  8007ad:	e9 c3 fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007be:	eb e5                	jmp    8007a5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 5a                	ja     800822 <vprintfmt+0x1de>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007d4:	8b 02                	mov    (%rdx),%eax
+  8007d6:	89 c1                	mov    %eax,%ecx
+  8007d8:	f7 d9                	neg    %ecx
+  8007da:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007dd:	83 f9 13             	cmp    $0x13,%ecx
+  8007e0:	7f 4e                	jg     800830 <vprintfmt+0x1ec>
+  8007e2:	48 63 c1             	movslq %ecx,%rax
+  8007e5:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8007ec:	00 00 00 
+  8007ef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007f3:	48 85 c0             	test   %rax,%rax
+  8007f6:	74 38                	je     800830 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007f8:	48 89 c1             	mov    %rax,%rcx
+  8007fb:	48 ba b9 57 80 00 00 	movabs $0x8057b9,%rdx
+  800802:	00 00 00 
+  800805:	4c 89 ee             	mov    %r13,%rsi
+  800808:	4c 89 f7             	mov    %r14,%rdi
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	49 b8 07 06 80 00 00 	movabs $0x800607,%r8
+  800817:	00 00 00 
+  80081a:	41 ff d0             	call   *%r8
+  80081d:	e9 53 fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800826:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082e:	eb a4                	jmp    8007d4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800830:	48 ba 34 51 80 00 00 	movabs $0x805134,%rdx
+  800837:	00 00 00 
+  80083a:	4c 89 ee             	mov    %r13,%rsi
+  80083d:	4c 89 f7             	mov    %r14,%rdi
+  800840:	b8 00 00 00 00       	mov    $0x0,%eax
+  800845:	49 b8 07 06 80 00 00 	movabs $0x800607,%r8
+  80084c:	00 00 00 
+  80084f:	41 ff d0             	call   *%r8
+  800852:	e9 1e fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 36                	ja     800895 <vprintfmt+0x251>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80086e:	48 85 f6             	test   %rsi,%rsi
+  800871:	48 b8 2d 51 80 00 00 	movabs $0x80512d,%rax
+  800878:	00 00 00 
+  80087b:	48 0f 45 c6          	cmovne %rsi,%rax
+  80087f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800883:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800887:	7e 06                	jle    80088f <vprintfmt+0x24b>
+  800889:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80088d:	75 14                	jne    8008a3 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80088f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800893:	eb 5b                	jmp    8008f0 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	eb c8                	jmp    80086b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008a3:	49 63 f7             	movslq %r15d,%rsi
+  8008a6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008aa:	48 b8 49 0e 80 00 00 	movabs $0x800e49,%rax
+  8008b1:	00 00 00 
+  8008b4:	ff d0                	call   *%rax
+  8008b6:	48 89 c2             	mov    %rax,%rdx
+  8008b9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008be:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008c1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008c4:	85 c0                	test   %eax,%eax
+  8008c6:	7e c7                	jle    80088f <vprintfmt+0x24b>
+  8008c8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008cd:	4c 89 ee             	mov    %r13,%rsi
+  8008d0:	44 89 e7             	mov    %r12d,%edi
+  8008d3:	41 ff d6             	call   *%r14
+  8008d6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008da:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008dd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008e0:	75 eb                	jne    8008cd <vprintfmt+0x289>
+  8008e2:	eb ab                	jmp    80088f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008e4:	0f b6 f8             	movzbl %al,%edi
+  8008e7:	4c 89 ee             	mov    %r13,%rsi
+  8008ea:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8008ed:	4c 89 e2             	mov    %r12,%rdx
+  8008f0:	45 85 ff             	test   %r15d,%r15d
+  8008f3:	78 06                	js     8008fb <vprintfmt+0x2b7>
+  8008f5:	41 83 ef 01          	sub    $0x1,%r15d
+  8008f9:	78 23                	js     80091e <vprintfmt+0x2da>
+  8008fb:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8008ff:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800905:	84 c0                	test   %al,%al
+  800907:	74 15                	je     80091e <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800909:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80090d:	74 d5                	je     8008e4 <vprintfmt+0x2a0>
+  80090f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800912:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800917:	80 fa 5e             	cmp    $0x5e,%dl
+  80091a:	77 cb                	ja     8008e7 <vprintfmt+0x2a3>
+  80091c:	eb c6                	jmp    8008e4 <vprintfmt+0x2a0>
+  80091e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800921:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800924:	01 f0                	add    %esi,%eax
+  800926:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800928:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80092c:	85 c0                	test   %eax,%eax
+  80092e:	0f 8e 41 fd ff ff    	jle    800675 <vprintfmt+0x31>
+  800934:	4c 89 ee             	mov    %r13,%rsi
+  800937:	bf 20 00 00 00       	mov    $0x20,%edi
+  80093c:	41 ff d6             	call   *%r14
+  80093f:	41 83 ec 01          	sub    $0x1,%r12d
+  800943:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800947:	75 eb                	jne    800934 <vprintfmt+0x2f0>
+  800949:	e9 27 fd ff ff       	jmp    800675 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80094e:	40 84 f6             	test   %sil,%sil
+  800951:	75 26                	jne    800979 <vprintfmt+0x335>
+    switch (lflag) {
+  800953:	85 d2                	test   %edx,%edx
+  800955:	74 59                	je     8009b0 <vprintfmt+0x36c>
+  800957:	83 fa 01             	cmp    $0x1,%edx
+  80095a:	74 7b                	je     8009d7 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80095c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095f:	83 f8 2f             	cmp    $0x2f,%eax
+  800962:	0f 87 96 00 00 00    	ja     8009fe <vprintfmt+0x3ba>
+  800968:	89 c2                	mov    %eax,%edx
+  80096a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096e:	83 c0 08             	add    $0x8,%eax
+  800971:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800974:	4c 8b 22             	mov    (%rdx),%r12
+  800977:	eb 17                	jmp    800990 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 21                	ja     8009a2 <vprintfmt+0x35e>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800990:	4d 85 e4             	test   %r12,%r12
+  800993:	78 7a                	js     800a0f <vprintfmt+0x3cb>
+            num = i;
+  800995:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800998:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80099d:	e9 b5 02 00 00       	jmp    800c57 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ae:	eb dd                	jmp    80098d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8009b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b6:	77 11                	ja     8009c9 <vprintfmt+0x385>
+  8009b8:	89 c2                	mov    %eax,%edx
+  8009ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009be:	83 c0 08             	add    $0x8,%eax
+  8009c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c4:	4c 63 22             	movslq (%rdx),%r12
+  8009c7:	eb c7                	jmp    800990 <vprintfmt+0x34c>
+  8009c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d5:	eb ed                	jmp    8009c4 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8009d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	77 11                	ja     8009f0 <vprintfmt+0x3ac>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	4c 8b 22             	mov    (%rdx),%r12
+  8009ee:	eb a0                	jmp    800990 <vprintfmt+0x34c>
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb ed                	jmp    8009eb <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8009fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0a:	e9 65 ff ff ff       	jmp    800974 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800a0f:	4c 89 ee             	mov    %r13,%rsi
+  800a12:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a17:	41 ff d6             	call   *%r14
+                i = -i;
+  800a1a:	49 f7 dc             	neg    %r12
+  800a1d:	e9 73 ff ff ff       	jmp    800995 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800a22:	40 84 f6             	test   %sil,%sil
+  800a25:	75 32                	jne    800a59 <vprintfmt+0x415>
+    switch (lflag) {
+  800a27:	85 d2                	test   %edx,%edx
+  800a29:	74 5d                	je     800a88 <vprintfmt+0x444>
+  800a2b:	83 fa 01             	cmp    $0x1,%edx
+  800a2e:	0f 84 82 00 00 00    	je     800ab6 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a37:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3a:	0f 87 a5 00 00 00    	ja     800ae5 <vprintfmt+0x4a1>
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a46:	83 c0 08             	add    $0x8,%eax
+  800a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a54:	e9 fe 01 00 00       	jmp    800c57 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 19                	ja     800a7a <vprintfmt+0x436>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a75:	e9 dd 01 00 00       	jmp    800c57 <vprintfmt+0x613>
+  800a7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a86:	eb e5                	jmp    800a6d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	77 18                	ja     800aa8 <vprintfmt+0x464>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a9e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aa3:	e9 af 01 00 00       	jmp    800c57 <vprintfmt+0x613>
+  800aa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab4:	eb e6                	jmp    800a9c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800ab6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab9:	83 f8 2f             	cmp    $0x2f,%eax
+  800abc:	77 19                	ja     800ad7 <vprintfmt+0x493>
+  800abe:	89 c2                	mov    %eax,%edx
+  800ac0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac4:	83 c0 08             	add    $0x8,%eax
+  800ac7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aca:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800acd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ad2:	e9 80 01 00 00       	jmp    800c57 <vprintfmt+0x613>
+  800ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae3:	eb e5                	jmp    800aca <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800ae5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af1:	e9 56 ff ff ff       	jmp    800a4c <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	40 84 f6             	test   %sil,%sil
+  800af9:	75 2e                	jne    800b29 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800afb:	85 d2                	test   %edx,%edx
+  800afd:	0f 84 b3 00 00 00    	je     800bb6 <vprintfmt+0x572>
+  800b03:	83 fa 01             	cmp    $0x1,%edx
+  800b06:	0f 84 d3 00 00 00    	je     800bdf <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	0f 87 f1 00 00 00    	ja     800c09 <vprintfmt+0x5c5>
+  800b18:	89 c2                	mov    %eax,%edx
+  800b1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1e:	83 c0 08             	add    $0x8,%eax
+  800b21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b24:	48 8b 02             	mov    (%rdx),%rax
+  800b27:	eb 17                	jmp    800b40 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 77                	ja     800ba8 <vprintfmt+0x564>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800b40:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b42:	83 f8 07             	cmp    $0x7,%eax
+  800b45:	0f 8e cf 00 00 00    	jle    800c1a <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800b4b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b51:	44 89 e7             	mov    %r12d,%edi
+  800b54:	41 c1 e4 03          	shl    $0x3,%r12d
+  800b58:	89 d1                	mov    %edx,%ecx
+  800b5a:	8d 72 07             	lea    0x7(%rdx),%esi
+  800b5d:	85 d2                	test   %edx,%edx
+  800b5f:	0f 48 d6             	cmovs  %esi,%edx
+  800b62:	c1 fa 03             	sar    $0x3,%edx
+  800b65:	83 f9 3f             	cmp    $0x3f,%ecx
+  800b68:	7f e7                	jg     800b51 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800b6a:	85 ff                	test   %edi,%edi
+  800b6c:	0f 84 03 fb ff ff    	je     800675 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800b72:	49 63 f4             	movslq %r12d,%rsi
+  800b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7a:	48 f7 f6             	div    %rsi
+  800b7d:	49 89 d7             	mov    %rdx,%r15
+  800b80:	83 c0 30             	add    $0x30,%eax
+  800b83:	0f be f8             	movsbl %al,%edi
+  800b86:	4c 89 ee             	mov    %r13,%rsi
+  800b89:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800b8c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800b8f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800b94:	45 85 e4             	test   %r12d,%r12d
+  800b97:	41 0f 49 d4          	cmovns %r12d,%edx
+  800b9b:	c1 fa 03             	sar    $0x3,%edx
+  800b9e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800ba1:	75 cf                	jne    800b72 <vprintfmt+0x52e>
+  800ba3:	e9 cd fa ff ff       	jmp    800675 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb4:	eb 87                	jmp    800b3d <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800bb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbc:	77 13                	ja     800bd1 <vprintfmt+0x58d>
+  800bbe:	89 c2                	mov    %eax,%edx
+  800bc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc4:	83 c0 08             	add    $0x8,%eax
+  800bc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bca:	8b 02                	mov    (%rdx),%eax
+  800bcc:	e9 6f ff ff ff       	jmp    800b40 <vprintfmt+0x4fc>
+  800bd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdd:	eb eb                	jmp    800bca <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800bdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be2:	83 f8 2f             	cmp    $0x2f,%eax
+  800be5:	77 14                	ja     800bfb <vprintfmt+0x5b7>
+  800be7:	89 c2                	mov    %eax,%edx
+  800be9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bed:	83 c0 08             	add    $0x8,%eax
+  800bf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf3:	48 8b 02             	mov    (%rdx),%rax
+  800bf6:	e9 45 ff ff ff       	jmp    800b40 <vprintfmt+0x4fc>
+  800bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	eb ea                	jmp    800bf3 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c15:	e9 0a ff ff ff       	jmp    800b24 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800c1a:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800c20:	e9 4d ff ff ff       	jmp    800b72 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800c25:	4c 89 ee             	mov    %r13,%rsi
+  800c28:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c2d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c30:	4c 89 ee             	mov    %r13,%rsi
+  800c33:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c38:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c41:	77 47                	ja     800c8a <vprintfmt+0x646>
+  800c43:	89 c2                	mov    %eax,%edx
+  800c45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c49:	83 c0 08             	add    $0x8,%eax
+  800c4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c52:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c57:	48 83 ec 08          	sub    $0x8,%rsp
+  800c5b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c5f:	0f 94 c0             	sete   %al
+  800c62:	0f b6 c0             	movzbl %al,%eax
+  800c65:	50                   	push   %rax
+  800c66:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c6b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c6f:	4c 89 ee             	mov    %r13,%rsi
+  800c72:	4c 89 f7             	mov    %r14,%rdi
+  800c75:	48 b8 39 05 80 00 00 	movabs $0x800539,%rax
+  800c7c:	00 00 00 
+  800c7f:	ff d0                	call   *%rax
+            break;
+  800c81:	48 83 c4 10          	add    $0x10,%rsp
+  800c85:	e9 eb f9 ff ff       	jmp    800675 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	eb b7                	jmp    800c4f <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800c98:	40 84 f6             	test   %sil,%sil
+  800c9b:	75 2b                	jne    800cc8 <vprintfmt+0x684>
+    switch (lflag) {
+  800c9d:	85 d2                	test   %edx,%edx
+  800c9f:	74 56                	je     800cf7 <vprintfmt+0x6b3>
+  800ca1:	83 fa 01             	cmp    $0x1,%edx
+  800ca4:	74 7f                	je     800d25 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800ca6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cac:	0f 87 a2 00 00 00    	ja     800d54 <vprintfmt+0x710>
+  800cb2:	89 c2                	mov    %eax,%edx
+  800cb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb8:	83 c0 08             	add    $0x8,%eax
+  800cbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cc6:	eb 8f                	jmp    800c57 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cce:	77 19                	ja     800ce9 <vprintfmt+0x6a5>
+  800cd0:	89 c2                	mov    %eax,%edx
+  800cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd6:	83 c0 08             	add    $0x8,%eax
+  800cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cdc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cdf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ce4:	e9 6e ff ff ff       	jmp    800c57 <vprintfmt+0x613>
+  800ce9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ced:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf5:	eb e5                	jmp    800cdc <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800cf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfd:	77 18                	ja     800d17 <vprintfmt+0x6d3>
+  800cff:	89 c2                	mov    %eax,%edx
+  800d01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d05:	83 c0 08             	add    $0x8,%eax
+  800d08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d12:	e9 40 ff ff ff       	jmp    800c57 <vprintfmt+0x613>
+  800d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d23:	eb e6                	jmp    800d0b <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800d25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d28:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2b:	77 19                	ja     800d46 <vprintfmt+0x702>
+  800d2d:	89 c2                	mov    %eax,%edx
+  800d2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d33:	83 c0 08             	add    $0x8,%eax
+  800d36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d41:	e9 11 ff ff ff       	jmp    800c57 <vprintfmt+0x613>
+  800d46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d52:	eb e5                	jmp    800d39 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800d54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d60:	e9 59 ff ff ff       	jmp    800cbe <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800d65:	4c 89 ee             	mov    %r13,%rsi
+  800d68:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d6d:	41 ff d6             	call   *%r14
+            break;
+  800d70:	e9 00 f9 ff ff       	jmp    800675 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d75:	4c 89 ee             	mov    %r13,%rsi
+  800d78:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d7d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d80:	48 83 eb 01          	sub    $0x1,%rbx
+  800d84:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d88:	75 f6                	jne    800d80 <vprintfmt+0x73c>
+  800d8a:	e9 e6 f8 ff ff       	jmp    800675 <vprintfmt+0x31>
+}
+  800d8f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d93:	5b                   	pop    %rbx
+  800d94:	41 5c                	pop    %r12
+  800d96:	41 5d                	pop    %r13
+  800d98:	41 5e                	pop    %r14
+  800d9a:	41 5f                	pop    %r15
+  800d9c:	5d                   	pop    %rbp
+  800d9d:	c3                   	ret
+
+0000000000800d9e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d9e:	55                   	push   %rbp
+  800d9f:	48 89 e5             	mov    %rsp,%rbp
+  800da2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800da6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800daa:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800daf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800db3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dba:	48 85 ff             	test   %rdi,%rdi
+  800dbd:	74 2b                	je     800dea <vsnprintf+0x4c>
+  800dbf:	48 85 f6             	test   %rsi,%rsi
+  800dc2:	74 26                	je     800dea <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dc4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dc8:	48 bf ef 05 80 00 00 	movabs $0x8005ef,%rdi
+  800dcf:	00 00 00 
+  800dd2:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  800dd9:	00 00 00 
+  800ddc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800de2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800de5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800de8:	c9                   	leave
+  800de9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800def:	eb f7                	jmp    800de8 <vsnprintf+0x4a>
+
+0000000000800df1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800df1:	55                   	push   %rbp
+  800df2:	48 89 e5             	mov    %rsp,%rbp
+  800df5:	48 83 ec 50          	sub    $0x50,%rsp
+  800df9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dfd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e01:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e05:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e0c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e14:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e1c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e20:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  800e27:	00 00 00 
+  800e2a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e2c:	c9                   	leave
+  800e2d:	c3                   	ret
+
+0000000000800e2e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e2e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e31:	74 10                	je     800e43 <strlen+0x15>
+    size_t n = 0;
+  800e33:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e38:	48 83 c0 01          	add    $0x1,%rax
+  800e3c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e40:	75 f6                	jne    800e38 <strlen+0xa>
+  800e42:	c3                   	ret
+    size_t n = 0;
+  800e43:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e48:	c3                   	ret
+
+0000000000800e49 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e49:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e51:	48 85 f6             	test   %rsi,%rsi
+  800e54:	74 11                	je     800e67 <strnlen+0x1e>
+  800e56:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e5a:	74 0c                	je     800e68 <strnlen+0x1f>
+  800e5c:	48 83 c2 01          	add    $0x1,%rdx
+  800e60:	48 39 d0             	cmp    %rdx,%rax
+  800e63:	75 f1                	jne    800e56 <strnlen+0xd>
+  800e65:	eb 04                	jmp    800e6b <strnlen+0x22>
+  800e67:	c3                   	ret
+  800e68:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e6b:	c3                   	ret
+
+0000000000800e6c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e6c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e74:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e78:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e7b:	48 83 c2 01          	add    $0x1,%rdx
+  800e7f:	84 c9                	test   %cl,%cl
+  800e81:	75 f1                	jne    800e74 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e83:	c3                   	ret
+
+0000000000800e84 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+  800e88:	41 54                	push   %r12
+  800e8a:	53                   	push   %rbx
+  800e8b:	48 89 fb             	mov    %rdi,%rbx
+  800e8e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e91:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  800e98:	00 00 00 
+  800e9b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e9d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ea1:	4c 89 e6             	mov    %r12,%rsi
+  800ea4:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  800eab:	00 00 00 
+  800eae:	ff d0                	call   *%rax
+    return dst;
+}
+  800eb0:	48 89 d8             	mov    %rbx,%rax
+  800eb3:	5b                   	pop    %rbx
+  800eb4:	41 5c                	pop    %r12
+  800eb6:	5d                   	pop    %rbp
+  800eb7:	c3                   	ret
+
+0000000000800eb8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eb8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ebb:	48 85 d2             	test   %rdx,%rdx
+  800ebe:	74 1f                	je     800edf <strncpy+0x27>
+  800ec0:	48 01 fa             	add    %rdi,%rdx
+  800ec3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ec6:	48 83 c1 01          	add    $0x1,%rcx
+  800eca:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ece:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ed2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ed6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800eda:	48 39 ca             	cmp    %rcx,%rdx
+  800edd:	75 e7                	jne    800ec6 <strncpy+0xe>
+    }
+    return ret;
+}
+  800edf:	c3                   	ret
+
+0000000000800ee0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ee0:	48 89 f8             	mov    %rdi,%rax
+  800ee3:	48 85 d2             	test   %rdx,%rdx
+  800ee6:	74 24                	je     800f0c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ee8:	48 83 ea 01          	sub    $0x1,%rdx
+  800eec:	74 1b                	je     800f09 <strlcpy+0x29>
+  800eee:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ef2:	0f b6 16             	movzbl (%rsi),%edx
+  800ef5:	84 d2                	test   %dl,%dl
+  800ef7:	74 10                	je     800f09 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ef9:	48 83 c6 01          	add    $0x1,%rsi
+  800efd:	48 83 c0 01          	add    $0x1,%rax
+  800f01:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f04:	48 39 c8             	cmp    %rcx,%rax
+  800f07:	75 e9                	jne    800ef2 <strlcpy+0x12>
+        *dst = '\0';
+  800f09:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f0c:	48 29 f8             	sub    %rdi,%rax
+}
+  800f0f:	c3                   	ret
+
+0000000000800f10 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f10:	0f b6 07             	movzbl (%rdi),%eax
+  800f13:	84 c0                	test   %al,%al
+  800f15:	74 13                	je     800f2a <strcmp+0x1a>
+  800f17:	38 06                	cmp    %al,(%rsi)
+  800f19:	75 0f                	jne    800f2a <strcmp+0x1a>
+  800f1b:	48 83 c7 01          	add    $0x1,%rdi
+  800f1f:	48 83 c6 01          	add    $0x1,%rsi
+  800f23:	0f b6 07             	movzbl (%rdi),%eax
+  800f26:	84 c0                	test   %al,%al
+  800f28:	75 ed                	jne    800f17 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f2a:	0f b6 c0             	movzbl %al,%eax
+  800f2d:	0f b6 16             	movzbl (%rsi),%edx
+  800f30:	29 d0                	sub    %edx,%eax
+}
+  800f32:	c3                   	ret
+
+0000000000800f33 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f33:	48 85 d2             	test   %rdx,%rdx
+  800f36:	74 1f                	je     800f57 <strncmp+0x24>
+  800f38:	0f b6 07             	movzbl (%rdi),%eax
+  800f3b:	84 c0                	test   %al,%al
+  800f3d:	74 1e                	je     800f5d <strncmp+0x2a>
+  800f3f:	3a 06                	cmp    (%rsi),%al
+  800f41:	75 1a                	jne    800f5d <strncmp+0x2a>
+  800f43:	48 83 c7 01          	add    $0x1,%rdi
+  800f47:	48 83 c6 01          	add    $0x1,%rsi
+  800f4b:	48 83 ea 01          	sub    $0x1,%rdx
+  800f4f:	75 e7                	jne    800f38 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f56:	c3                   	ret
+  800f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5c:	c3                   	ret
+  800f5d:	48 85 d2             	test   %rdx,%rdx
+  800f60:	74 09                	je     800f6b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f62:	0f b6 07             	movzbl (%rdi),%eax
+  800f65:	0f b6 16             	movzbl (%rsi),%edx
+  800f68:	29 d0                	sub    %edx,%eax
+  800f6a:	c3                   	ret
+    if (!n) return 0;
+  800f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f70:	c3                   	ret
+
+0000000000800f71 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f71:	0f b6 17             	movzbl (%rdi),%edx
+  800f74:	84 d2                	test   %dl,%dl
+  800f76:	74 18                	je     800f90 <strchr+0x1f>
+        if (*str == c) {
+  800f78:	0f be d2             	movsbl %dl,%edx
+  800f7b:	39 f2                	cmp    %esi,%edx
+  800f7d:	74 17                	je     800f96 <strchr+0x25>
+    for (; *str; str++) {
+  800f7f:	48 83 c7 01          	add    $0x1,%rdi
+  800f83:	0f b6 17             	movzbl (%rdi),%edx
+  800f86:	84 d2                	test   %dl,%dl
+  800f88:	75 ee                	jne    800f78 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8f:	c3                   	ret
+  800f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f95:	c3                   	ret
+  800f96:	48 89 f8             	mov    %rdi,%rax
+}
+  800f99:	c3                   	ret
+
+0000000000800f9a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f9a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f9d:	0f b6 17             	movzbl (%rdi),%edx
+  800fa0:	84 d2                	test   %dl,%dl
+  800fa2:	74 13                	je     800fb7 <strfind+0x1d>
+  800fa4:	0f be d2             	movsbl %dl,%edx
+  800fa7:	39 f2                	cmp    %esi,%edx
+  800fa9:	74 0b                	je     800fb6 <strfind+0x1c>
+  800fab:	48 83 c0 01          	add    $0x1,%rax
+  800faf:	0f b6 10             	movzbl (%rax),%edx
+  800fb2:	84 d2                	test   %dl,%dl
+  800fb4:	75 ee                	jne    800fa4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fb6:	c3                   	ret
+  800fb7:	c3                   	ret
+
+0000000000800fb8 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800fb8:	55                   	push   %rbp
+  800fb9:	48 89 e5             	mov    %rsp,%rbp
+  800fbc:	41 57                	push   %r15
+  800fbe:	41 56                	push   %r14
+  800fc0:	41 55                	push   %r13
+  800fc2:	41 54                	push   %r12
+  800fc4:	53                   	push   %rbx
+  800fc5:	48 83 ec 08          	sub    $0x8,%rsp
+  800fc9:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800fcc:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800fd0:	45 84 ed             	test   %r13b,%r13b
+  800fd3:	75 12                	jne    800fe7 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800fd5:	4c 89 f8             	mov    %r15,%rax
+  800fd8:	48 83 c4 08          	add    $0x8,%rsp
+  800fdc:	5b                   	pop    %rbx
+  800fdd:	41 5c                	pop    %r12
+  800fdf:	41 5d                	pop    %r13
+  800fe1:	41 5e                	pop    %r14
+  800fe3:	41 5f                	pop    %r15
+  800fe5:	5d                   	pop    %rbp
+  800fe6:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800fe7:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800feb:	4c 89 e7             	mov    %r12,%rdi
+  800fee:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+  800ffa:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800ffd:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801001:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801005:	49 bf 33 0f 80 00 00 	movabs $0x800f33,%r15
+  80100c:	00 00 00 
+				if ((sc = *s++) == 0)
+  80100f:	84 c0                	test   %al,%al
+  801011:	75 14                	jne    801027 <strstr+0x6f>
+					return NULL;
+  801013:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801019:	eb ba                	jmp    800fd5 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  80101b:	48 83 c3 01          	add    $0x1,%rbx
+  80101f:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801023:	84 c0                	test   %al,%al
+  801025:	74 1b                	je     801042 <strstr+0x8a>
+			} while (sc != c);
+  801027:	41 38 c5             	cmp    %al,%r13b
+  80102a:	75 ef                	jne    80101b <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  80102c:	4c 89 f2             	mov    %r14,%rdx
+  80102f:	4c 89 e6             	mov    %r12,%rsi
+  801032:	48 89 df             	mov    %rbx,%rdi
+  801035:	41 ff d7             	call   *%r15
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	75 df                	jne    80101b <strstr+0x63>
+  80103c:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801040:	eb 93                	jmp    800fd5 <strstr+0x1d>
+					return NULL;
+  801042:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801048:	eb 8b                	jmp    800fd5 <strstr+0x1d>
+
+000000000080104a <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  80104a:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  80104c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  80104f:	8d 57 20             	lea    0x20(%rdi),%edx
+  801052:	83 f9 1a             	cmp    $0x1a,%ecx
+  801055:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801058:	c3                   	ret
+
+0000000000801059 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801059:	55                   	push   %rbp
+  80105a:	48 89 e5             	mov    %rsp,%rbp
+  80105d:	41 57                	push   %r15
+  80105f:	41 56                	push   %r14
+  801061:	41 55                	push   %r13
+  801063:	41 54                	push   %r12
+  801065:	53                   	push   %rbx
+  801066:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  80106a:	48 39 f7             	cmp    %rsi,%rdi
+  80106d:	74 49                	je     8010b8 <strcasecmp+0x5f>
+  80106f:	49 89 fd             	mov    %rdi,%r13
+  801072:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801075:	49 bf 4a 10 80 00 00 	movabs $0x80104a,%r15
+  80107c:	00 00 00 
+  80107f:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801084:	41 0f b6 fe          	movzbl %r14b,%edi
+  801088:	41 ff d7             	call   *%r15
+  80108b:	89 c3                	mov    %eax,%ebx
+  80108d:	49 83 c4 01          	add    $0x1,%r12
+  801091:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801097:	41 ff d7             	call   *%r15
+  80109a:	29 c3                	sub    %eax,%ebx
+  80109c:	75 09                	jne    8010a7 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80109e:	49 83 c5 01          	add    $0x1,%r13
+  8010a2:	45 84 f6             	test   %r14b,%r14b
+  8010a5:	75 d8                	jne    80107f <strcasecmp+0x26>
+}
+  8010a7:	89 d8                	mov    %ebx,%eax
+  8010a9:	48 83 c4 08          	add    $0x8,%rsp
+  8010ad:	5b                   	pop    %rbx
+  8010ae:	41 5c                	pop    %r12
+  8010b0:	41 5d                	pop    %r13
+  8010b2:	41 5e                	pop    %r14
+  8010b4:	41 5f                	pop    %r15
+  8010b6:	5d                   	pop    %rbp
+  8010b7:	c3                   	ret
+        return 0;
+  8010b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bd:	eb e8                	jmp    8010a7 <strcasecmp+0x4e>
+
+00000000008010bf <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8010bf:	55                   	push   %rbp
+  8010c0:	48 89 e5             	mov    %rsp,%rbp
+  8010c3:	41 57                	push   %r15
+  8010c5:	41 56                	push   %r14
+  8010c7:	41 55                	push   %r13
+  8010c9:	41 54                	push   %r12
+  8010cb:	53                   	push   %rbx
+  8010cc:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8010d0:	48 85 d2             	test   %rdx,%rdx
+  8010d3:	74 4f                	je     801124 <strncasecmp+0x65>
+  8010d5:	49 89 fc             	mov    %rdi,%r12
+  8010d8:	49 89 f5             	mov    %rsi,%r13
+  8010db:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8010df:	49 be 4a 10 80 00 00 	movabs $0x80104a,%r14
+  8010e6:	00 00 00 
+  8010e9:	49 83 c4 01          	add    $0x1,%r12
+  8010ed:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8010f3:	41 ff d6             	call   *%r14
+  8010f6:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8010f8:	49 83 c5 01          	add    $0x1,%r13
+  8010fc:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801101:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801104:	29 c3                	sub    %eax,%ebx
+  801106:	85 c0                	test   %eax,%eax
+  801108:	74 09                	je     801113 <strncasecmp+0x54>
+  80110a:	85 db                	test   %ebx,%ebx
+  80110c:	75 05                	jne    801113 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  80110e:	4d 39 fc             	cmp    %r15,%r12
+  801111:	75 d6                	jne    8010e9 <strncasecmp+0x2a>
+}
+  801113:	89 d8                	mov    %ebx,%eax
+  801115:	48 83 c4 08          	add    $0x8,%rsp
+  801119:	5b                   	pop    %rbx
+  80111a:	41 5c                	pop    %r12
+  80111c:	41 5d                	pop    %r13
+  80111e:	41 5e                	pop    %r14
+  801120:	41 5f                	pop    %r15
+  801122:	5d                   	pop    %rbp
+  801123:	c3                   	ret
+    int d = 0;
+  801124:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801129:	eb e8                	jmp    801113 <strncasecmp+0x54>
+
+000000000080112b <toupper>:
+
+int toupper(int c) {
+  80112b:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  80112d:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801130:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801133:	83 f9 1a             	cmp    $0x1a,%ecx
+  801136:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801139:	c3                   	ret
+
+000000000080113a <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80113a:	83 ff 20             	cmp    $0x20,%edi
+  80113d:	0f 94 c0             	sete   %al
+  801140:	0f b6 c0             	movzbl %al,%eax
+}
+  801143:	c3                   	ret
+
+0000000000801144 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801144:	89 f8                	mov    %edi,%eax
+  801146:	f7 d8                	neg    %eax
+  801148:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80114b:	c3                   	ret
+
+000000000080114c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80114c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80114f:	48 89 f8             	mov    %rdi,%rax
+  801152:	48 f7 d8             	neg    %rax
+  801155:	83 e0 07             	and    $0x7,%eax
+  801158:	49 89 d1             	mov    %rdx,%r9
+  80115b:	49 29 c1             	sub    %rax,%r9
+  80115e:	78 36                	js     801196 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801160:	40 0f b6 c6          	movzbl %sil,%eax
+  801164:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80116b:	01 01 01 
+  80116e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801172:	40 f6 c7 07          	test   $0x7,%dil
+  801176:	75 38                	jne    8011b0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801178:	4c 89 c9             	mov    %r9,%rcx
+  80117b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80117f:	74 0c                	je     80118d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801181:	fc                   	cld
+  801182:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801185:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801189:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80118d:	4d 85 c9             	test   %r9,%r9
+  801190:	75 45                	jne    8011d7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801192:	4c 89 c0             	mov    %r8,%rax
+  801195:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801196:	48 85 d2             	test   %rdx,%rdx
+  801199:	74 f7                	je     801192 <memset+0x46>
+  80119b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80119e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8011a1:	48 83 c0 01          	add    $0x1,%rax
+  8011a5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8011a9:	48 39 c2             	cmp    %rax,%rdx
+  8011ac:	75 f3                	jne    8011a1 <memset+0x55>
+  8011ae:	eb e2                	jmp    801192 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8011b0:	40 f6 c7 01          	test   $0x1,%dil
+  8011b4:	74 06                	je     8011bc <memset+0x70>
+  8011b6:	88 07                	mov    %al,(%rdi)
+  8011b8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011bc:	40 f6 c7 02          	test   $0x2,%dil
+  8011c0:	74 07                	je     8011c9 <memset+0x7d>
+  8011c2:	66 89 07             	mov    %ax,(%rdi)
+  8011c5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011c9:	40 f6 c7 04          	test   $0x4,%dil
+  8011cd:	74 a9                	je     801178 <memset+0x2c>
+  8011cf:	89 07                	mov    %eax,(%rdi)
+  8011d1:	48 83 c7 04          	add    $0x4,%rdi
+  8011d5:	eb a1                	jmp    801178 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011d7:	41 f6 c1 04          	test   $0x4,%r9b
+  8011db:	74 06                	je     8011e3 <memset+0x97>
+  8011dd:	89 07                	mov    %eax,(%rdi)
+  8011df:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011e3:	41 f6 c1 02          	test   $0x2,%r9b
+  8011e7:	74 07                	je     8011f0 <memset+0xa4>
+  8011e9:	66 89 07             	mov    %ax,(%rdi)
+  8011ec:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011f0:	41 f6 c1 01          	test   $0x1,%r9b
+  8011f4:	74 9c                	je     801192 <memset+0x46>
+  8011f6:	88 07                	mov    %al,(%rdi)
+  8011f8:	eb 98                	jmp    801192 <memset+0x46>
+
+00000000008011fa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011fa:	48 89 f8             	mov    %rdi,%rax
+  8011fd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801200:	48 39 fe             	cmp    %rdi,%rsi
+  801203:	73 3b                	jae    801240 <memmove+0x46>
+  801205:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801209:	48 39 d7             	cmp    %rdx,%rdi
+  80120c:	73 32                	jae    801240 <memmove+0x46>
+        s += n;
+        d += n;
+  80120e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801212:	48 89 d6             	mov    %rdx,%rsi
+  801215:	48 09 fe             	or     %rdi,%rsi
+  801218:	48 09 ce             	or     %rcx,%rsi
+  80121b:	40 f6 c6 07          	test   $0x7,%sil
+  80121f:	75 12                	jne    801233 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801221:	48 83 ef 08          	sub    $0x8,%rdi
+  801225:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801229:	48 c1 e9 03          	shr    $0x3,%rcx
+  80122d:	fd                   	std
+  80122e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801231:	fc                   	cld
+  801232:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801233:	48 83 ef 01          	sub    $0x1,%rdi
+  801237:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80123b:	fd                   	std
+  80123c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80123e:	eb f1                	jmp    801231 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801240:	48 89 f2             	mov    %rsi,%rdx
+  801243:	48 09 c2             	or     %rax,%rdx
+  801246:	48 09 ca             	or     %rcx,%rdx
+  801249:	f6 c2 07             	test   $0x7,%dl
+  80124c:	75 0c                	jne    80125a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80124e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801252:	48 89 c7             	mov    %rax,%rdi
+  801255:	fc                   	cld
+  801256:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801259:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80125a:	48 89 c7             	mov    %rax,%rdi
+  80125d:	fc                   	cld
+  80125e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801260:	c3                   	ret
+
+0000000000801261 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801265:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  80126c:	00 00 00 
+  80126f:	ff d0                	call   *%rax
+}
+  801271:	5d                   	pop    %rbp
+  801272:	c3                   	ret
+
+0000000000801273 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801273:	55                   	push   %rbp
+  801274:	48 89 e5             	mov    %rsp,%rbp
+  801277:	41 57                	push   %r15
+  801279:	41 56                	push   %r14
+  80127b:	41 55                	push   %r13
+  80127d:	41 54                	push   %r12
+  80127f:	53                   	push   %rbx
+  801280:	48 83 ec 08          	sub    $0x8,%rsp
+  801284:	49 89 fe             	mov    %rdi,%r14
+  801287:	49 89 f7             	mov    %rsi,%r15
+  80128a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80128d:	48 89 f7             	mov    %rsi,%rdi
+  801290:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  801297:	00 00 00 
+  80129a:	ff d0                	call   *%rax
+  80129c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80129f:	48 89 de             	mov    %rbx,%rsi
+  8012a2:	4c 89 f7             	mov    %r14,%rdi
+  8012a5:	48 b8 49 0e 80 00 00 	movabs $0x800e49,%rax
+  8012ac:	00 00 00 
+  8012af:	ff d0                	call   *%rax
+  8012b1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012b4:	48 39 c3             	cmp    %rax,%rbx
+  8012b7:	74 36                	je     8012ef <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012b9:	48 89 d8             	mov    %rbx,%rax
+  8012bc:	4c 29 e8             	sub    %r13,%rax
+  8012bf:	49 39 c4             	cmp    %rax,%r12
+  8012c2:	73 31                	jae    8012f5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012c4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012c9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012cd:	4c 89 fe             	mov    %r15,%rsi
+  8012d0:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  8012d7:	00 00 00 
+  8012da:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012dc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012e0:	48 83 c4 08          	add    $0x8,%rsp
+  8012e4:	5b                   	pop    %rbx
+  8012e5:	41 5c                	pop    %r12
+  8012e7:	41 5d                	pop    %r13
+  8012e9:	41 5e                	pop    %r14
+  8012eb:	41 5f                	pop    %r15
+  8012ed:	5d                   	pop    %rbp
+  8012ee:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012ef:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012f3:	eb eb                	jmp    8012e0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012f5:	48 83 eb 01          	sub    $0x1,%rbx
+  8012f9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012fd:	48 89 da             	mov    %rbx,%rdx
+  801300:	4c 89 fe             	mov    %r15,%rsi
+  801303:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  80130a:	00 00 00 
+  80130d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80130f:	49 01 de             	add    %rbx,%r14
+  801312:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801317:	eb c3                	jmp    8012dc <strlcat+0x69>
+
+0000000000801319 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801319:	48 85 d2             	test   %rdx,%rdx
+  80131c:	74 2d                	je     80134b <memcmp+0x32>
+  80131e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801323:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801327:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80132c:	44 38 c1             	cmp    %r8b,%cl
+  80132f:	75 0f                	jne    801340 <memcmp+0x27>
+    while (n-- > 0) {
+  801331:	48 83 c0 01          	add    $0x1,%rax
+  801335:	48 39 c2             	cmp    %rax,%rdx
+  801338:	75 e9                	jne    801323 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80133a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801340:	0f b6 c1             	movzbl %cl,%eax
+  801343:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801347:	44 29 c0             	sub    %r8d,%eax
+  80134a:	c3                   	ret
+    return 0;
+  80134b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801350:	c3                   	ret
+
+0000000000801351 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801351:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801355:	48 39 c7             	cmp    %rax,%rdi
+  801358:	73 0f                	jae    801369 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80135a:	40 38 37             	cmp    %sil,(%rdi)
+  80135d:	74 0e                	je     80136d <memfind+0x1c>
+    for (; src < end; src++) {
+  80135f:	48 83 c7 01          	add    $0x1,%rdi
+  801363:	48 39 f8             	cmp    %rdi,%rax
+  801366:	75 f2                	jne    80135a <memfind+0x9>
+  801368:	c3                   	ret
+  801369:	48 89 f8             	mov    %rdi,%rax
+  80136c:	c3                   	ret
+  80136d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801370:	c3                   	ret
+
+0000000000801371 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801371:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801374:	0f b6 37             	movzbl (%rdi),%esi
+  801377:	40 80 fe 20          	cmp    $0x20,%sil
+  80137b:	74 06                	je     801383 <strtol+0x12>
+  80137d:	40 80 fe 09          	cmp    $0x9,%sil
+  801381:	75 13                	jne    801396 <strtol+0x25>
+  801383:	48 83 c7 01          	add    $0x1,%rdi
+  801387:	0f b6 37             	movzbl (%rdi),%esi
+  80138a:	40 80 fe 20          	cmp    $0x20,%sil
+  80138e:	74 f3                	je     801383 <strtol+0x12>
+  801390:	40 80 fe 09          	cmp    $0x9,%sil
+  801394:	74 ed                	je     801383 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801396:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801399:	83 e0 fd             	and    $0xfffffffd,%eax
+  80139c:	3c 01                	cmp    $0x1,%al
+  80139e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013a2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8013a8:	75 0f                	jne    8013b9 <strtol+0x48>
+  8013aa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8013ad:	74 14                	je     8013c3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8013af:	85 d2                	test   %edx,%edx
+  8013b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013b6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013be:	4c 63 ca             	movslq %edx,%r9
+  8013c1:	eb 36                	jmp    8013f9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013c3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013c7:	74 0f                	je     8013d8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013c9:	85 d2                	test   %edx,%edx
+  8013cb:	75 ec                	jne    8013b9 <strtol+0x48>
+        s++;
+  8013cd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013d1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013d6:	eb e1                	jmp    8013b9 <strtol+0x48>
+        s += 2;
+  8013d8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013dc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013e1:	eb d6                	jmp    8013b9 <strtol+0x48>
+            dig -= '0';
+  8013e3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013e6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013ea:	41 39 d0             	cmp    %edx,%r8d
+  8013ed:	7d 21                	jge    801410 <strtol+0x9f>
+        val = val * base + dig;
+  8013ef:	49 0f af c1          	imul   %r9,%rax
+  8013f3:	0f b6 c9             	movzbl %cl,%ecx
+  8013f6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013f9:	48 83 c7 01          	add    $0x1,%rdi
+  8013fd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801401:	80 f9 39             	cmp    $0x39,%cl
+  801404:	76 dd                	jbe    8013e3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801406:	80 f9 7b             	cmp    $0x7b,%cl
+  801409:	77 05                	ja     801410 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80140b:	83 e9 57             	sub    $0x57,%ecx
+  80140e:	eb d6                	jmp    8013e6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801410:	4d 85 d2             	test   %r10,%r10
+  801413:	74 03                	je     801418 <strtol+0xa7>
+  801415:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801418:	48 89 c2             	mov    %rax,%rdx
+  80141b:	48 f7 da             	neg    %rdx
+  80141e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801422:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801426:	c3                   	ret
+
+0000000000801427 <atoi>:
+int atoi(const char *str) {
+  801427:	55                   	push   %rbp
+  801428:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80142b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	48 b8 71 13 80 00 00 	movabs $0x801371,%rax
+  80143c:	00 00 00 
+  80143f:	ff d0                	call   *%rax
+}
+  801441:	5d                   	pop    %rbp
+  801442:	c3                   	ret
+
+0000000000801443 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801443:	55                   	push   %rbp
+  801444:	48 89 e5             	mov    %rsp,%rbp
+  801447:	53                   	push   %rbx
+  801448:	48 89 fa             	mov    %rdi,%rdx
+  80144b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80144e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801453:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801458:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145d:	be 00 00 00 00       	mov    $0x0,%esi
+  801462:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801468:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80146a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146e:	c9                   	leave
+  80146f:	c3                   	ret
+
+0000000000801470 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801470:	55                   	push   %rbp
+  801471:	48 89 e5             	mov    %rsp,%rbp
+  801474:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801475:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801489:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801499:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149f:	c9                   	leave
+  8014a0:	c3                   	ret
+
+00000000008014a1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014a1:	55                   	push   %rbp
+  8014a2:	48 89 e5             	mov    %rsp,%rbp
+  8014a5:	53                   	push   %rbx
+  8014a6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ad:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ce:	48 85 c0             	test   %rax,%rax
+  8014d1:	7f 06                	jg     8014d9 <sys_env_destroy+0x38>
+}
+  8014d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d7:	c9                   	leave
+  8014d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d9:	49 89 c0             	mov    %rax,%r8
+  8014dc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014e1:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8014e8:	00 00 00 
+  8014eb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014f0:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8014f7:	00 00 00 
+  8014fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ff:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801506:	00 00 00 
+  801509:	41 ff d1             	call   *%r9
+
+000000000080150c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80150c:	55                   	push   %rbp
+  80150d:	48 89 e5             	mov    %rsp,%rbp
+  801510:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801511:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801520:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801525:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152a:	be 00 00 00 00       	mov    $0x0,%esi
+  80152f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801535:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153b:	c9                   	leave
+  80153c:	c3                   	ret
+
+000000000080153d <sys_yield>:
+
+void
+sys_yield(void) {
+  80153d:	55                   	push   %rbp
+  80153e:	48 89 e5             	mov    %rsp,%rbp
+  801541:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801551:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801556:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155b:	be 00 00 00 00       	mov    $0x0,%esi
+  801560:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801566:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801568:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+
+000000000080156e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80156e:	55                   	push   %rbp
+  80156f:	48 89 e5             	mov    %rsp,%rbp
+  801572:	53                   	push   %rbx
+  801573:	48 89 fa             	mov    %rdi,%rdx
+  801576:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801579:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801585:	00 00 00 
+  801588:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158d:	be 00 00 00 00       	mov    $0x0,%esi
+  801592:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801598:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80159a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159e:	c9                   	leave
+  80159f:	c3                   	ret
+
+00000000008015a0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015a0:	55                   	push   %rbp
+  8015a1:	48 89 e5             	mov    %rsp,%rbp
+  8015a4:	53                   	push   %rbx
+  8015a5:	49 89 f8             	mov    %rdi,%r8
+  8015a8:	48 89 d3             	mov    %rdx,%rbx
+  8015ab:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b3:	4c 89 c2             	mov    %r8,%rdx
+  8015b6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+
+00000000008015cc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	53                   	push   %rbx
+  8015d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d5:	89 f8                	mov    %edi,%eax
+  8015d7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015da:	48 63 f9             	movslq %ecx,%rdi
+  8015dd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f5:	48 85 c0             	test   %rax,%rax
+  8015f8:	7f 06                	jg     801600 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fe:	c9                   	leave
+  8015ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801600:	49 89 c0             	mov    %rax,%r8
+  801603:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801608:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  80160f:	00 00 00 
+  801612:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801617:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  80161e:	00 00 00 
+  801621:	b8 00 00 00 00       	mov    $0x0,%eax
+  801626:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  80162d:	00 00 00 
+  801630:	41 ff d1             	call   *%r9
+
+0000000000801633 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801633:	55                   	push   %rbp
+  801634:	48 89 e5             	mov    %rsp,%rbp
+  801637:	53                   	push   %rbx
+  801638:	48 83 ec 08          	sub    $0x8,%rsp
+  80163c:	89 f8                	mov    %edi,%eax
+  80163e:	49 89 f2             	mov    %rsi,%r10
+  801641:	48 89 cf             	mov    %rcx,%rdi
+  801644:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801647:	48 63 da             	movslq %edx,%rbx
+  80164a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801652:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801655:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801658:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165a:	48 85 c0             	test   %rax,%rax
+  80165d:	7f 06                	jg     801665 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80165f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801663:	c9                   	leave
+  801664:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801665:	49 89 c0             	mov    %rax,%r8
+  801668:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80166d:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801674:	00 00 00 
+  801677:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80167c:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801683:	00 00 00 
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168b:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801692:	00 00 00 
+  801695:	41 ff d1             	call   *%r9
+
+0000000000801698 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+  80169c:	53                   	push   %rbx
+  80169d:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a1:	49 89 f9             	mov    %rdi,%r9
+  8016a4:	89 f0                	mov    %esi,%eax
+  8016a6:	48 89 d3             	mov    %rdx,%rbx
+  8016a9:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8016ac:	49 63 f0             	movslq %r8d,%rsi
+  8016af:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b7:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c2:	48 85 c0             	test   %rax,%rax
+  8016c5:	7f 06                	jg     8016cd <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cd:	49 89 c0             	mov    %rax,%r8
+  8016d0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016d5:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8016dc:	00 00 00 
+  8016df:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016e4:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8016eb:	00 00 00 
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f3:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8016fa:	00 00 00 
+  8016fd:	41 ff d1             	call   *%r9
+
+0000000000801700 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	53                   	push   %rbx
+  801705:	89 f8                	mov    %edi,%eax
+  801707:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80170a:	48 63 f9             	movslq %ecx,%rdi
+  80170d:	48 63 da             	movslq %edx,%rbx
+  801710:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801713:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801718:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171b:	be 00 00 00 00       	mov    $0x0,%esi
+  801720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801726:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801728:	89 c2                	mov    %eax,%edx
+  80172a:	48 85 c0             	test   %rax,%rax
+  80172d:	78 0d                	js     80173c <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  80172f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801734:	4d 85 c9             	test   %r9,%r9
+  801737:	74 03                	je     80173c <sys_alloc_dma_region+0x3c>
+  801739:	49 89 01             	mov    %rax,(%r9)
+}
+  80173c:	89 d0                	mov    %edx,%eax
+  80173e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801742:	c9                   	leave
+  801743:	c3                   	ret
+
+0000000000801744 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801744:	55                   	push   %rbp
+  801745:	48 89 e5             	mov    %rsp,%rbp
+  801748:	53                   	push   %rbx
+  801749:	48 83 ec 08          	sub    $0x8,%rsp
+  80174d:	48 89 f1             	mov    %rsi,%rcx
+  801750:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801753:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801756:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176d:	48 85 c0             	test   %rax,%rax
+  801770:	7f 06                	jg     801778 <sys_set_cache_region+0x34>
+}
+  801772:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801776:	c9                   	leave
+  801777:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801778:	49 89 c0             	mov    %rax,%r8
+  80177b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801780:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801787:	00 00 00 
+  80178a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80178f:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801796:	00 00 00 
+  801799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179e:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8017a5:	00 00 00 
+  8017a8:	41 ff d1             	call   *%r9
+
+00000000008017ab <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017ab:	55                   	push   %rbp
+  8017ac:	48 89 e5             	mov    %rsp,%rbp
+  8017af:	53                   	push   %rbx
+  8017b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b4:	48 89 f1             	mov    %rsi,%rcx
+  8017b7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bd:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d4:	48 85 c0             	test   %rax,%rax
+  8017d7:	7f 06                	jg     8017df <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017dd:	c9                   	leave
+  8017de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017df:	49 89 c0             	mov    %rax,%r8
+  8017e2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017e7:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8017ee:	00 00 00 
+  8017f1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017f6:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8017fd:	00 00 00 
+  801800:	b8 00 00 00 00       	mov    $0x0,%eax
+  801805:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  80180c:	00 00 00 
+  80180f:	41 ff d1             	call   *%r9
+
+0000000000801812 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801812:	55                   	push   %rbp
+  801813:	48 89 e5             	mov    %rsp,%rbp
+  801816:	53                   	push   %rbx
+  801817:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80181b:	48 63 ce             	movslq %esi,%rcx
+  80181e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801821:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801826:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801830:	be 00 00 00 00       	mov    $0x0,%esi
+  801835:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80183d:	48 85 c0             	test   %rax,%rax
+  801840:	7f 06                	jg     801848 <sys_env_set_status+0x36>
+}
+  801842:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801846:	c9                   	leave
+  801847:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801848:	49 89 c0             	mov    %rax,%r8
+  80184b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801850:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801857:	00 00 00 
+  80185a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80185f:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801866:	00 00 00 
+  801869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186e:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801875:	00 00 00 
+  801878:	41 ff d1             	call   *%r9
+
+000000000080187b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80187b:	55                   	push   %rbp
+  80187c:	48 89 e5             	mov    %rsp,%rbp
+  80187f:	53                   	push   %rbx
+  801880:	48 83 ec 08          	sub    $0x8,%rsp
+  801884:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801887:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80188a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80188f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801894:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801899:	be 00 00 00 00       	mov    $0x0,%esi
+  80189e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018a6:	48 85 c0             	test   %rax,%rax
+  8018a9:	7f 06                	jg     8018b1 <sys_env_set_trapframe+0x36>
+}
+  8018ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018af:	c9                   	leave
+  8018b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b1:	49 89 c0             	mov    %rax,%r8
+  8018b4:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8018b9:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8018c0:	00 00 00 
+  8018c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018c8:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8018cf:	00 00 00 
+  8018d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d7:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8018de:	00 00 00 
+  8018e1:	41 ff d1             	call   *%r9
+
+00000000008018e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018e4:	55                   	push   %rbp
+  8018e5:	48 89 e5             	mov    %rsp,%rbp
+  8018e8:	53                   	push   %rbx
+  8018e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ed:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801902:	be 00 00 00 00       	mov    $0x0,%esi
+  801907:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80190d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80190f:	48 85 c0             	test   %rax,%rax
+  801912:	7f 06                	jg     80191a <sys_env_set_pgfault_upcall+0x36>
+}
+  801914:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801918:	c9                   	leave
+  801919:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80191a:	49 89 c0             	mov    %rax,%r8
+  80191d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801922:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801929:	00 00 00 
+  80192c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801931:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801938:	00 00 00 
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801940:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801947:	00 00 00 
+  80194a:	41 ff d1             	call   *%r9
+
+000000000080194d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80194d:	55                   	push   %rbp
+  80194e:	48 89 e5             	mov    %rsp,%rbp
+  801951:	53                   	push   %rbx
+  801952:	89 f8                	mov    %edi,%eax
+  801954:	49 89 f1             	mov    %rsi,%r9
+  801957:	48 89 d3             	mov    %rdx,%rbx
+  80195a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80195d:	49 63 f0             	movslq %r8d,%rsi
+  801960:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801963:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801968:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80196b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801971:	cd 30                	int    $0x30
+}
+  801973:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801977:	c9                   	leave
+  801978:	c3                   	ret
+
+0000000000801979 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	53                   	push   %rbx
+  80197e:	48 83 ec 08          	sub    $0x8,%rsp
+  801982:	48 89 fa             	mov    %rdi,%rdx
+  801985:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801988:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80198d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801992:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801997:	be 00 00 00 00       	mov    $0x0,%esi
+  80199c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019a4:	48 85 c0             	test   %rax,%rax
+  8019a7:	7f 06                	jg     8019af <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019af:	49 89 c0             	mov    %rax,%r8
+  8019b2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8019b7:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8019be:	00 00 00 
+  8019c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019c6:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8019cd:	00 00 00 
+  8019d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d5:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8019dc:	00 00 00 
+  8019df:	41 ff d1             	call   *%r9
+
+00000000008019e2 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	53                   	push   %rbx
+  8019e7:	48 89 fa             	mov    %rdi,%rdx
+  8019ea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ed:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801a01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a07:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a0d:	c9                   	leave
+  801a0e:	c3                   	ret
+
+0000000000801a0f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a0f:	55                   	push   %rbp
+  801a10:	48 89 e5             	mov    %rsp,%rbp
+  801a13:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a14:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a38:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a3e:	c9                   	leave
+  801a3f:	c3                   	ret
+
+0000000000801a40 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a40:	48 85 ff             	test   %rdi,%rdi
+  801a43:	0f 84 b6 01 00 00    	je     801bff <malloc+0x1bf>
+malloc(size_t size) {
+  801a49:	55                   	push   %rbp
+  801a4a:	48 89 e5             	mov    %rsp,%rbp
+  801a4d:	41 56                	push   %r14
+  801a4f:	41 55                	push   %r13
+  801a51:	41 54                	push   %r12
+  801a53:	53                   	push   %rbx
+  801a54:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a57:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a5e:	00 00 00 
+  801a61:	4c 8b 20             	mov    (%rax),%r12
+  801a64:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801a6b:	0f 87 94 01 00 00    	ja     801c05 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801a71:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a78:	00 00 00 
+  801a7b:	48 85 c0             	test   %rax,%rax
+  801a7e:	74 6b                	je     801aeb <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801a80:	4d 85 e4             	test   %r12,%r12
+  801a83:	74 66                	je     801aeb <malloc+0xab>
+  801a85:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801a8c:	00 00 00 
+  801a8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a94:	eb 0d                	jmp    801aa3 <malloc+0x63>
+  801a96:	48 83 c1 01          	add    $0x1,%rcx
+  801a9a:	48 83 c2 18          	add    $0x18,%rdx
+  801a9e:	49 39 cc             	cmp    %rcx,%r12
+  801aa1:	74 48                	je     801aeb <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801aa3:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801aa8:	74 ec                	je     801a96 <malloc+0x56>
+  801aaa:	48 39 1a             	cmp    %rbx,(%rdx)
+  801aad:	72 e7                	jb     801a96 <malloc+0x56>
+                real_freep_size--;
+  801aaf:	48 83 e8 01          	sub    $0x1,%rax
+  801ab3:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801aba:	00 00 00 
+                freep[i].is_free = false;
+  801abd:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801ac4:	00 00 00 
+  801ac7:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801acb:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801acf:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801ad3:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801ada:	00 
+                freep[i].size = size;
+  801adb:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801adf:	48 01 c8             	add    %rcx,%rax
+  801ae2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ae6:	e9 0b 01 00 00       	jmp    801bf6 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801aeb:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801af2:	00 00 00 
+  801af5:	48 01 d8             	add    %rbx,%rax
+  801af8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801afe:	76 7c                	jbe    801b7c <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b00:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b07:	00 00 00 
+  801b0a:	4c 8b 30             	mov    (%rax),%r14
+  801b0d:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801b14:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801b17:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801b1e:	00 00 00 
+  801b21:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801b28:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801b2f:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801b35:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801b39:	48 b8 0c 15 80 00 00 	movabs $0x80150c,%rax
+  801b40:	00 00 00 
+  801b43:	ff d0                	call   *%rax
+  801b45:	89 c7                	mov    %eax,%edi
+  801b47:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801b4e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801b55:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801b5c:	00 00 00 
+  801b5f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801b63:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801b68:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  801b6f:	00 00 00 
+  801b72:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	0f 88 90 00 00 00    	js     801c0c <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801b7c:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801b83:	00 00 00 
+  801b86:	48 8b 31             	mov    (%rcx),%rsi
+  801b89:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801b90:	00 00 00 
+  801b93:	4c 8b 07             	mov    (%rdi),%r8
+  801b96:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801b9a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801ba1:	00 00 00 
+  801ba4:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801ba8:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801bac:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801bb3:	00 00 00 
+  801bb6:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801bba:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801bbd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801bc1:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801bc8:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801bc9:	48 89 d8             	mov    %rbx,%rax
+  801bcc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bd1:	4c 01 c0             	add    %r8,%rax
+  801bd4:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801bd7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801bde:	48 01 f3             	add    %rsi,%rbx
+  801be1:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801be4:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801be9:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801bf0:	00 00 00 
+  801bf3:	48 89 d0             	mov    %rdx,%rax
+}
+  801bf6:	5b                   	pop    %rbx
+  801bf7:	41 5c                	pop    %r12
+  801bf9:	41 5d                	pop    %r13
+  801bfb:	41 5e                	pop    %r14
+  801bfd:	5d                   	pop    %rbp
+  801bfe:	c3                   	ret
+        return NULL;
+  801bff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c04:	c3                   	ret
+        return NULL;
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0a:	eb ea                	jmp    801bf6 <malloc+0x1b6>
+            return NULL;
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	eb e3                	jmp    801bf6 <malloc+0x1b6>
+
+0000000000801c13 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801c13:	55                   	push   %rbp
+  801c14:	48 89 e5             	mov    %rsp,%rbp
+  801c17:	53                   	push   %rbx
+  801c18:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801c1c:	48 89 fb             	mov    %rdi,%rbx
+  801c1f:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801c23:	48 89 df             	mov    %rbx,%rdi
+  801c26:	48 b8 40 1a 80 00 00 	movabs $0x801a40,%rax
+  801c2d:	00 00 00 
+  801c30:	ff d0                	call   *%rax
+  801c32:	48 89 c7             	mov    %rax,%rdi
+  801c35:	48 89 da             	mov    %rbx,%rdx
+  801c38:	be 00 00 00 00       	mov    $0x0,%esi
+  801c3d:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+}
+  801c49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+0000000000801c4f <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801c4f:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801c56:	00 00 00 
+  801c59:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801c60:	00 00 00 
+  801c63:	48 3b 02             	cmp    (%rdx),%rax
+  801c66:	74 4d                	je     801cb5 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801c68:	48 85 c0             	test   %rax,%rax
+  801c6b:	74 4d                	je     801cba <get_allocsize+0x6b>
+  801c6d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c74:	00 00 00 
+  801c77:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801c7c:	48 3b 39             	cmp    (%rcx),%rdi
+  801c7f:	74 13                	je     801c94 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801c81:	48 83 c2 01          	add    $0x1,%rdx
+  801c85:	48 83 c1 18          	add    $0x18,%rcx
+  801c89:	48 39 d0             	cmp    %rdx,%rax
+  801c8c:	75 ee                	jne    801c7c <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801c94:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ca4:	00 00 00 
+  801ca7:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801cad:	75 0b                	jne    801cba <get_allocsize+0x6b>
+  801caf:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801cb4:	c3                   	ret
+        return 0;
+  801cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cba:	c3                   	ret
+
+0000000000801cbb <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801cbb:	48 85 ff             	test   %rdi,%rdi
+  801cbe:	0f 84 01 01 00 00    	je     801dc5 <free+0x10a>
+free(void *ptr) {
+  801cc4:	55                   	push   %rbp
+  801cc5:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801cc8:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801ccf:	00 00 00 
+  801cd2:	48 8b 30             	mov    (%rax),%rsi
+  801cd5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801cdc:	00 00 00 
+  801cdf:	48 39 c6             	cmp    %rax,%rsi
+  801ce2:	74 50                	je     801d34 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801ce4:	48 85 f6             	test   %rsi,%rsi
+  801ce7:	74 21                	je     801d0a <free+0x4f>
+  801ce9:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801cf0:	00 00 00 
+  801cf3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801cf8:	48 3b 39             	cmp    (%rcx),%rdi
+  801cfb:	74 61                	je     801d5e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801cfd:	48 83 c2 01          	add    $0x1,%rdx
+  801d01:	48 83 c1 18          	add    $0x18,%rcx
+  801d05:	48 39 d6             	cmp    %rdx,%rsi
+  801d08:	75 ee                	jne    801cf8 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d0a:	48 ba 90 56 80 00 00 	movabs $0x805690,%rdx
+  801d11:	00 00 00 
+  801d14:	be 12 01 00 00       	mov    $0x112,%esi
+  801d19:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801d20:	00 00 00 
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d28:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  801d2f:	00 00 00 
+  801d32:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801d34:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  801d3b:	00 00 00 
+  801d3e:	be 06 01 00 00       	mov    $0x106,%esi
+  801d43:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801d4a:	00 00 00 
+  801d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d52:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  801d59:	00 00 00 
+  801d5c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801d5e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d62:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d69:	00 00 00 
+  801d6c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d72:	75 27                	jne    801d9b <free+0xe0>
+            freep[i].is_free = true;
+  801d74:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d78:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801d7f:	00 00 00 
+  801d82:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801d89:	00 00 
+            real_freep_size++;
+  801d8b:	48 83 c0 01          	add    $0x1,%rax
+  801d8f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801d96:	00 00 00 
+}
+  801d99:	5d                   	pop    %rbp
+  801d9a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801d9b:	48 ba 68 56 80 00 00 	movabs $0x805668,%rdx
+  801da2:	00 00 00 
+  801da5:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801daa:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801db1:	00 00 00 
+  801db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db9:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  801dc0:	00 00 00 
+  801dc3:	ff d1                	call   *%rcx
+  801dc5:	c3                   	ret
+
+0000000000801dc6 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	41 55                	push   %r13
+  801dcc:	41 54                	push   %r12
+  801dce:	53                   	push   %rbx
+  801dcf:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd3:	48 89 fb             	mov    %rdi,%rbx
+  801dd6:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801dd9:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801de5:	49 39 c5             	cmp    %rax,%r13
+  801de8:	73 0e                	jae    801df8 <realloc+0x32>
+}
+  801dea:	48 89 d8             	mov    %rbx,%rax
+  801ded:	48 83 c4 08          	add    $0x8,%rsp
+  801df1:	5b                   	pop    %rbx
+  801df2:	41 5c                	pop    %r12
+  801df4:	41 5d                	pop    %r13
+  801df6:	5d                   	pop    %rbp
+  801df7:	c3                   	ret
+  801df8:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801dfb:	4c 89 ef             	mov    %r13,%rdi
+  801dfe:	48 b8 40 1a 80 00 00 	movabs $0x801a40,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+  801e0a:	48 89 c7             	mov    %rax,%rdi
+  801e0d:	4c 89 e2             	mov    %r12,%rdx
+  801e10:	48 89 de             	mov    %rbx,%rsi
+  801e13:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+  801e1f:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801e22:	48 89 df             	mov    %rbx,%rdi
+  801e25:	48 b8 bb 1c 80 00 00 	movabs $0x801cbb,%rax
+  801e2c:	00 00 00 
+  801e2f:	ff d0                	call   *%rax
+    return newptr;
+  801e31:	4c 89 e3             	mov    %r12,%rbx
+  801e34:	eb b4                	jmp    801dea <realloc+0x24>
+
+0000000000801e36 <strdup>:
+
+char*
+strdup (const char *src) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  801e3a:	41 54                	push   %r12
+  801e3c:	53                   	push   %rbx
+  801e3d:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801e40:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801e50:	4c 89 e7             	mov    %r12,%rdi
+  801e53:	48 b8 40 1a 80 00 00 	movabs $0x801a40,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+  801e5f:	48 89 c7             	mov    %rax,%rdi
+  801e62:	4c 89 e2             	mov    %r12,%rdx
+  801e65:	48 89 de             	mov    %rbx,%rsi
+  801e68:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  801e6f:	00 00 00 
+  801e72:	ff d0                	call   *%rax
+}
+  801e74:	5b                   	pop    %rbx
+  801e75:	41 5c                	pop    %r12
+  801e77:	5d                   	pop    %rbp
+  801e78:	c3                   	ret
+
+0000000000801e79 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801e79:	55                   	push   %rbp
+  801e7a:	48 89 e5             	mov    %rsp,%rbp
+  801e7d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e7e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e88:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e92:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e97:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ea2:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ea4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+
+0000000000801eaa <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801eae:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801eb5:	00 00 00 
+  801eb8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ebc:	74 26                	je     801ee4 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ebe:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ec0:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ec4:	89 c0                	mov    %eax,%eax
+  801ec6:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801ec9:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ed0:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ed7:	00 00 00 
+  801eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edf:	48 f7 31             	divq   (%rcx)
+}
+  801ee2:	5d                   	pop    %rbp
+  801ee3:	c3                   	ret
+        freq = get_cpufreq();
+  801ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee9:	48 ba 79 1e 80 00 00 	movabs $0x801e79,%rdx
+  801ef0:	00 00 00 
+  801ef3:	ff d2                	call   *%rdx
+  801ef5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801efc:	00 00 00 
+  801eff:	eb bd                	jmp    801ebe <get_ticks+0x14>
+
+0000000000801f01 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	53                   	push   %rbx
+  801f06:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0a:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801f0d:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f14:	00 00 00 
+  801f17:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f1b:	74 50                	je     801f6d <sleep+0x6c>
+    asm volatile("rdtsc"
+  801f1d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f1f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f23:	89 c0                	mov    %eax,%eax
+  801f25:	48 89 d6             	mov    %rdx,%rsi
+  801f28:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801f2b:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f32:	00 00 00 
+  801f35:	48 0f af 18          	imul   (%rax),%rbx
+  801f39:	48 c1 eb 03          	shr    $0x3,%rbx
+  801f3d:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801f44:	9b c4 20 
+  801f47:	48 89 d8             	mov    %rbx,%rax
+  801f4a:	48 f7 e2             	mul    %rdx
+  801f4d:	48 89 d1             	mov    %rdx,%rcx
+  801f50:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801f54:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f56:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f5a:	89 c0                	mov    %eax,%eax
+  801f5c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801f5f:	48 29 f2             	sub    %rsi,%rdx
+  801f62:	48 39 ca             	cmp    %rcx,%rdx
+  801f65:	72 ed                	jb     801f54 <sleep+0x53>
+}
+  801f67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f6b:	c9                   	leave
+  801f6c:	c3                   	ret
+        freq = get_cpufreq();
+  801f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f72:	48 ba 79 1e 80 00 00 	movabs $0x801e79,%rdx
+  801f79:	00 00 00 
+  801f7c:	ff d2                	call   *%rdx
+  801f7e:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f85:	00 00 00 
+  801f88:	eb 93                	jmp    801f1d <sleep+0x1c>
+
+0000000000801f8a <poll_kbd>:
+
+int poll_kbd() {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f8f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f99:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fa3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  801fad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fb3:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801fb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+
+0000000000801fbb <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801fbb:	55                   	push   %rbp
+  801fbc:	48 89 e5             	mov    %rsp,%rbp
+  801fbf:	53                   	push   %rbx
+  801fc0:	49 89 fa             	mov    %rdi,%r10
+  801fc3:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801fc5:	44 89 c6             	mov    %r8d,%esi
+  801fc8:	89 cf                	mov    %ecx,%edi
+  801fca:	89 d3                	mov    %edx,%ebx
+  801fcc:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801fce:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fd3:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fd6:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801fda:	cd 30                	int    $0x30
+  801fdc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fe0:	c9                   	leave
+  801fe1:	c3                   	ret
+
+0000000000801fe2 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801fe2:	55                   	push   %rbp
+  801fe3:	48 89 e5             	mov    %rsp,%rbp
+  801fe6:	41 54                	push   %r12
+  801fe8:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801fe9:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801ff5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ffa:	cd 30                	int    $0x30
+  801ffc:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	78 76                	js     802079 <fork+0x97>
+        return envid;
+    if (!envid) {
+  802003:	74 7c                	je     802081 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  802005:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80200b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802012:	00 00 00 
+  802015:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80201a:	89 c2                	mov    %eax,%edx
+  80201c:	be 00 00 00 00       	mov    $0x0,%esi
+  802021:	bf 00 00 00 00       	mov    $0x0,%edi
+  802026:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  80202d:	00 00 00 
+  802030:	ff d0                	call   *%rax
+  802032:	85 c0                	test   %eax,%eax
+  802034:	75 7c                	jne    8020b2 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802036:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80203d:	00 00 00 
+  802040:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802047:	44 89 e7             	mov    %r12d,%edi
+  80204a:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	85 c0                	test   %eax,%eax
+  802058:	75 60                	jne    8020ba <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  80205a:	be 02 00 00 00       	mov    $0x2,%esi
+  80205f:	44 89 e7             	mov    %r12d,%edi
+  802062:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+        return -1;
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802075:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  802079:	44 89 e0             	mov    %r12d,%eax
+  80207c:	5b                   	pop    %rbx
+  80207d:	41 5c                	pop    %r12
+  80207f:	5d                   	pop    %rbp
+  802080:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802081:	48 b8 0c 15 80 00 00 	movabs $0x80150c,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802092:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802099:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8020a0:	00 00 00 
+  8020a3:	48 01 d0             	add    %rdx,%rax
+  8020a6:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8020ad:	00 00 00 
+        return 0;
+  8020b0:	eb c7                	jmp    802079 <fork+0x97>
+        return -1;
+  8020b2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8020b8:	eb bf                	jmp    802079 <fork+0x97>
+  8020ba:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8020c0:	eb b7                	jmp    802079 <fork+0x97>
+
+00000000008020c2 <sfork>:
+
+envid_t
+sfork() {
+  8020c2:	55                   	push   %rbp
+  8020c3:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8020c6:	48 ba c6 56 80 00 00 	movabs $0x8056c6,%rdx
+  8020cd:	00 00 00 
+  8020d0:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8020d5:	48 bf e1 56 80 00 00 	movabs $0x8056e1,%rdi
+  8020dc:	00 00 00 
+  8020df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e4:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  8020eb:	00 00 00 
+  8020ee:	ff d1                	call   *%rcx
+
+00000000008020f0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020f0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020f7:	ff ff ff 
+  8020fa:	48 01 f8             	add    %rdi,%rax
+  8020fd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802101:	c3                   	ret
+
+0000000000802102 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802102:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802109:	ff ff ff 
+  80210c:	48 01 f8             	add    %rdi,%rax
+  80210f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802113:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802119:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80211d:	c3                   	ret
+
+000000000080211e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80211e:	55                   	push   %rbp
+  80211f:	48 89 e5             	mov    %rsp,%rbp
+  802122:	41 57                	push   %r15
+  802124:	41 56                	push   %r14
+  802126:	41 55                	push   %r13
+  802128:	41 54                	push   %r12
+  80212a:	53                   	push   %rbx
+  80212b:	48 83 ec 08          	sub    $0x8,%rsp
+  80212f:	49 89 ff             	mov    %rdi,%r15
+  802132:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802137:	49 bd d2 3f 80 00 00 	movabs $0x803fd2,%r13
+  80213e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802141:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802147:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80214a:	48 89 df             	mov    %rbx,%rdi
+  80214d:	41 ff d5             	call   *%r13
+  802150:	83 e0 04             	and    $0x4,%eax
+  802153:	74 17                	je     80216c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802155:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80215c:	4c 39 f3             	cmp    %r14,%rbx
+  80215f:	75 e6                	jne    802147 <fd_alloc+0x29>
+  802161:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802167:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80216c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80216f:	48 83 c4 08          	add    $0x8,%rsp
+  802173:	5b                   	pop    %rbx
+  802174:	41 5c                	pop    %r12
+  802176:	41 5d                	pop    %r13
+  802178:	41 5e                	pop    %r14
+  80217a:	41 5f                	pop    %r15
+  80217c:	5d                   	pop    %rbp
+  80217d:	c3                   	ret
+
+000000000080217e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80217e:	83 ff 1f             	cmp    $0x1f,%edi
+  802181:	77 39                	ja     8021bc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802183:	55                   	push   %rbp
+  802184:	48 89 e5             	mov    %rsp,%rbp
+  802187:	41 54                	push   %r12
+  802189:	53                   	push   %rbx
+  80218a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80218d:	48 63 df             	movslq %edi,%rbx
+  802190:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802197:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80219b:	48 89 df             	mov    %rbx,%rdi
+  80219e:	48 b8 d2 3f 80 00 00 	movabs $0x803fd2,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+  8021aa:	a8 04                	test   $0x4,%al
+  8021ac:	74 14                	je     8021c2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021ae:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b7:	5b                   	pop    %rbx
+  8021b8:	41 5c                	pop    %r12
+  8021ba:	5d                   	pop    %rbp
+  8021bb:	c3                   	ret
+        return -E_INVAL;
+  8021bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021c1:	c3                   	ret
+        return -E_INVAL;
+  8021c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c7:	eb ee                	jmp    8021b7 <fd_lookup+0x39>
+
+00000000008021c9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8021c9:	55                   	push   %rbp
+  8021ca:	48 89 e5             	mov    %rsp,%rbp
+  8021cd:	41 54                	push   %r12
+  8021cf:	53                   	push   %rbx
+  8021d0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021d3:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  8021da:	00 00 00 
+  8021dd:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021e4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8021e7:	39 3b                	cmp    %edi,(%rbx)
+  8021e9:	74 47                	je     802232 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8021eb:	48 83 c0 08          	add    $0x8,%rax
+  8021ef:	48 8b 18             	mov    (%rax),%rbx
+  8021f2:	48 85 db             	test   %rbx,%rbx
+  8021f5:	75 f0                	jne    8021e7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021f7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021fe:	00 00 00 
+  802201:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802207:	89 fa                	mov    %edi,%edx
+  802209:	48 bf f0 56 80 00 00 	movabs $0x8056f0,%rdi
+  802210:	00 00 00 
+  802213:	b8 00 00 00 00       	mov    $0x0,%eax
+  802218:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  80221f:	00 00 00 
+  802222:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802224:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802229:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80222d:	5b                   	pop    %rbx
+  80222e:	41 5c                	pop    %r12
+  802230:	5d                   	pop    %rbp
+  802231:	c3                   	ret
+            return 0;
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+  802237:	eb f0                	jmp    802229 <dev_lookup+0x60>
+
+0000000000802239 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802239:	55                   	push   %rbp
+  80223a:	48 89 e5             	mov    %rsp,%rbp
+  80223d:	41 55                	push   %r13
+  80223f:	41 54                	push   %r12
+  802241:	53                   	push   %rbx
+  802242:	48 83 ec 18          	sub    $0x18,%rsp
+  802246:	48 89 fb             	mov    %rdi,%rbx
+  802249:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80224c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802253:	ff ff ff 
+  802256:	48 01 df             	add    %rbx,%rdi
+  802259:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80225d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802261:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+  80226d:	41 89 c5             	mov    %eax,%r13d
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 06                	js     80227a <fd_close+0x41>
+  802274:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802278:	74 1a                	je     802294 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80227a:	45 84 e4             	test   %r12b,%r12b
+  80227d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802282:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802286:	44 89 e8             	mov    %r13d,%eax
+  802289:	48 83 c4 18          	add    $0x18,%rsp
+  80228d:	5b                   	pop    %rbx
+  80228e:	41 5c                	pop    %r12
+  802290:	41 5d                	pop    %r13
+  802292:	5d                   	pop    %rbp
+  802293:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802294:	8b 3b                	mov    (%rbx),%edi
+  802296:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80229a:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	41 89 c5             	mov    %eax,%r13d
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 1b                	js     8022c8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022b1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022b5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022bb:	48 85 c0             	test   %rax,%rax
+  8022be:	74 08                	je     8022c8 <fd_close+0x8f>
+  8022c0:	48 89 df             	mov    %rbx,%rdi
+  8022c3:	ff d0                	call   *%rax
+  8022c5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022cd:	48 89 de             	mov    %rbx,%rsi
+  8022d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d5:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+    return res;
+  8022e1:	eb a3                	jmp    802286 <fd_close+0x4d>
+
+00000000008022e3 <close>:
+
+int
+close(int fdnum) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022ef:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8022f6:	00 00 00 
+  8022f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 15                	js     802314 <close+0x31>
+
+    return fd_close(fd, 1);
+  8022ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802304:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802308:	48 b8 39 22 80 00 00 	movabs $0x802239,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+}
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+
+0000000000802316 <close_all>:
+
+void
+close_all(void) {
+  802316:	55                   	push   %rbp
+  802317:	48 89 e5             	mov    %rsp,%rbp
+  80231a:	41 54                	push   %r12
+  80231c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80231d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802322:	49 bc e3 22 80 00 00 	movabs $0x8022e3,%r12
+  802329:	00 00 00 
+  80232c:	89 df                	mov    %ebx,%edi
+  80232e:	41 ff d4             	call   *%r12
+  802331:	83 c3 01             	add    $0x1,%ebx
+  802334:	83 fb 20             	cmp    $0x20,%ebx
+  802337:	75 f3                	jne    80232c <close_all+0x16>
+}
+  802339:	5b                   	pop    %rbx
+  80233a:	41 5c                	pop    %r12
+  80233c:	5d                   	pop    %rbp
+  80233d:	c3                   	ret
+
+000000000080233e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80233e:	55                   	push   %rbp
+  80233f:	48 89 e5             	mov    %rsp,%rbp
+  802342:	41 57                	push   %r15
+  802344:	41 56                	push   %r14
+  802346:	41 55                	push   %r13
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	48 83 ec 18          	sub    $0x18,%rsp
+  80234f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802352:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802356:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+  802362:	89 c3                	mov    %eax,%ebx
+  802364:	85 c0                	test   %eax,%eax
+  802366:	0f 88 b8 00 00 00    	js     802424 <dup+0xe6>
+    close(newfdnum);
+  80236c:	44 89 e7             	mov    %r12d,%edi
+  80236f:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80237b:	4d 63 ec             	movslq %r12d,%r13
+  80237e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802385:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802389:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80238d:	4c 89 ff             	mov    %r15,%rdi
+  802390:	49 be 02 21 80 00 00 	movabs $0x802102,%r14
+  802397:	00 00 00 
+  80239a:	41 ff d6             	call   *%r14
+  80239d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8023a0:	4c 89 ef             	mov    %r13,%rdi
+  8023a3:	41 ff d6             	call   *%r14
+  8023a6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8023a9:	48 89 df             	mov    %rbx,%rdi
+  8023ac:	48 b8 d2 3f 80 00 00 	movabs $0x803fd2,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8023b8:	a8 04                	test   $0x4,%al
+  8023ba:	74 2b                	je     8023e7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8023bc:	41 89 c1             	mov    %eax,%r9d
+  8023bf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023c5:	4c 89 f1             	mov    %r14,%rcx
+  8023c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cd:	48 89 de             	mov    %rbx,%rsi
+  8023d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d5:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  8023dc:	00 00 00 
+  8023df:	ff d0                	call   *%rax
+  8023e1:	89 c3                	mov    %eax,%ebx
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	78 4e                	js     802435 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8023e7:	4c 89 ff             	mov    %r15,%rdi
+  8023ea:	48 b8 d2 3f 80 00 00 	movabs $0x803fd2,%rax
+  8023f1:	00 00 00 
+  8023f4:	ff d0                	call   *%rax
+  8023f6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8023f9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023ff:	4c 89 e9             	mov    %r13,%rcx
+  802402:	ba 00 00 00 00       	mov    $0x0,%edx
+  802407:	4c 89 fe             	mov    %r15,%rsi
+  80240a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240f:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+  80241b:	89 c3                	mov    %eax,%ebx
+  80241d:	85 c0                	test   %eax,%eax
+  80241f:	78 14                	js     802435 <dup+0xf7>
+
+    return newfdnum;
+  802421:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802424:	89 d8                	mov    %ebx,%eax
+  802426:	48 83 c4 18          	add    $0x18,%rsp
+  80242a:	5b                   	pop    %rbx
+  80242b:	41 5c                	pop    %r12
+  80242d:	41 5d                	pop    %r13
+  80242f:	41 5e                	pop    %r14
+  802431:	41 5f                	pop    %r15
+  802433:	5d                   	pop    %rbp
+  802434:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802435:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243a:	4c 89 ee             	mov    %r13,%rsi
+  80243d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802442:	49 bc ab 17 80 00 00 	movabs $0x8017ab,%r12
+  802449:	00 00 00 
+  80244c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80244f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802454:	4c 89 f6             	mov    %r14,%rsi
+  802457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245c:	41 ff d4             	call   *%r12
+    return res;
+  80245f:	eb c3                	jmp    802424 <dup+0xe6>
+
+0000000000802461 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802461:	55                   	push   %rbp
+  802462:	48 89 e5             	mov    %rsp,%rbp
+  802465:	41 56                	push   %r14
+  802467:	41 55                	push   %r13
+  802469:	41 54                	push   %r12
+  80246b:	53                   	push   %rbx
+  80246c:	48 83 ec 10          	sub    $0x10,%rsp
+  802470:	89 fb                	mov    %edi,%ebx
+  802472:	49 89 f4             	mov    %rsi,%r12
+  802475:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802478:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80247c:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	78 4c                	js     8024d8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80248c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802490:	41 8b 3e             	mov    (%r14),%edi
+  802493:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802497:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	78 35                	js     8024dc <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024a7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024ab:	83 e0 03             	and    $0x3,%eax
+  8024ae:	83 f8 01             	cmp    $0x1,%eax
+  8024b1:	74 2d                	je     8024e0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024b7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024bb:	48 85 c0             	test   %rax,%rax
+  8024be:	74 56                	je     802516 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024c0:	4c 89 ea             	mov    %r13,%rdx
+  8024c3:	4c 89 e6             	mov    %r12,%rsi
+  8024c6:	4c 89 f7             	mov    %r14,%rdi
+  8024c9:	ff d0                	call   *%rax
+}
+  8024cb:	48 83 c4 10          	add    $0x10,%rsp
+  8024cf:	5b                   	pop    %rbx
+  8024d0:	41 5c                	pop    %r12
+  8024d2:	41 5d                	pop    %r13
+  8024d4:	41 5e                	pop    %r14
+  8024d6:	5d                   	pop    %rbp
+  8024d7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024d8:	48 98                	cltq
+  8024da:	eb ef                	jmp    8024cb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024dc:	48 98                	cltq
+  8024de:	eb eb                	jmp    8024cb <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024e0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024e7:	00 00 00 
+  8024ea:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8024f0:	89 da                	mov    %ebx,%edx
+  8024f2:	48 bf 31 57 80 00 00 	movabs $0x805731,%rdi
+  8024f9:	00 00 00 
+  8024fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802501:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  802508:	00 00 00 
+  80250b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80250d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802514:	eb b5                	jmp    8024cb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802516:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80251d:	eb ac                	jmp    8024cb <read+0x6a>
+
+000000000080251f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	41 57                	push   %r15
+  802525:	41 56                	push   %r14
+  802527:	41 55                	push   %r13
+  802529:	41 54                	push   %r12
+  80252b:	53                   	push   %rbx
+  80252c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802530:	48 85 d2             	test   %rdx,%rdx
+  802533:	74 54                	je     802589 <readn+0x6a>
+  802535:	41 89 fd             	mov    %edi,%r13d
+  802538:	49 89 f6             	mov    %rsi,%r14
+  80253b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80253e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802543:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802548:	49 bf 61 24 80 00 00 	movabs $0x802461,%r15
+  80254f:	00 00 00 
+  802552:	4c 89 e2             	mov    %r12,%rdx
+  802555:	48 29 f2             	sub    %rsi,%rdx
+  802558:	4c 01 f6             	add    %r14,%rsi
+  80255b:	44 89 ef             	mov    %r13d,%edi
+  80255e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802561:	85 c0                	test   %eax,%eax
+  802563:	78 20                	js     802585 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802565:	01 c3                	add    %eax,%ebx
+  802567:	85 c0                	test   %eax,%eax
+  802569:	74 08                	je     802573 <readn+0x54>
+  80256b:	48 63 f3             	movslq %ebx,%rsi
+  80256e:	4c 39 e6             	cmp    %r12,%rsi
+  802571:	72 df                	jb     802552 <readn+0x33>
+    }
+    return res;
+  802573:	48 63 c3             	movslq %ebx,%rax
+}
+  802576:	48 83 c4 08          	add    $0x8,%rsp
+  80257a:	5b                   	pop    %rbx
+  80257b:	41 5c                	pop    %r12
+  80257d:	41 5d                	pop    %r13
+  80257f:	41 5e                	pop    %r14
+  802581:	41 5f                	pop    %r15
+  802583:	5d                   	pop    %rbp
+  802584:	c3                   	ret
+        if (inc < 0) return inc;
+  802585:	48 98                	cltq
+  802587:	eb ed                	jmp    802576 <readn+0x57>
+    int inc = 1, res = 0;
+  802589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258e:	eb e3                	jmp    802573 <readn+0x54>
+
+0000000000802590 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802590:	55                   	push   %rbp
+  802591:	48 89 e5             	mov    %rsp,%rbp
+  802594:	41 56                	push   %r14
+  802596:	41 55                	push   %r13
+  802598:	41 54                	push   %r12
+  80259a:	53                   	push   %rbx
+  80259b:	48 83 ec 10          	sub    $0x10,%rsp
+  80259f:	89 fb                	mov    %edi,%ebx
+  8025a1:	49 89 f4             	mov    %rsi,%r12
+  8025a4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025a7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025ab:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 47                	js     802602 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025bb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025bf:	41 8b 3e             	mov    (%r14),%edi
+  8025c2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025c6:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	78 30                	js     802606 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025d6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8025db:	74 2d                	je     80260a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025e1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8025e5:	48 85 c0             	test   %rax,%rax
+  8025e8:	74 56                	je     802640 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8025ea:	4c 89 ea             	mov    %r13,%rdx
+  8025ed:	4c 89 e6             	mov    %r12,%rsi
+  8025f0:	4c 89 f7             	mov    %r14,%rdi
+  8025f3:	ff d0                	call   *%rax
+}
+  8025f5:	48 83 c4 10          	add    $0x10,%rsp
+  8025f9:	5b                   	pop    %rbx
+  8025fa:	41 5c                	pop    %r12
+  8025fc:	41 5d                	pop    %r13
+  8025fe:	41 5e                	pop    %r14
+  802600:	5d                   	pop    %rbp
+  802601:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802602:	48 98                	cltq
+  802604:	eb ef                	jmp    8025f5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802606:	48 98                	cltq
+  802608:	eb eb                	jmp    8025f5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80260a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802611:	00 00 00 
+  802614:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80261a:	89 da                	mov    %ebx,%edx
+  80261c:	48 bf 4d 57 80 00 00 	movabs $0x80574d,%rdi
+  802623:	00 00 00 
+  802626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262b:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  802632:	00 00 00 
+  802635:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802637:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80263e:	eb b5                	jmp    8025f5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802640:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802647:	eb ac                	jmp    8025f5 <write+0x65>
+
+0000000000802649 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802649:	55                   	push   %rbp
+  80264a:	48 89 e5             	mov    %rsp,%rbp
+  80264d:	53                   	push   %rbx
+  80264e:	48 83 ec 18          	sub    $0x18,%rsp
+  802652:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802654:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802658:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 0c                	js     802674 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802668:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80266c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80266f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802674:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802678:	c9                   	leave
+  802679:	c3                   	ret
+
+000000000080267a <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80267a:	55                   	push   %rbp
+  80267b:	48 89 e5             	mov    %rsp,%rbp
+  80267e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802682:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802686:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+  802692:	85 c0                	test   %eax,%eax
+  802694:	78 07                	js     80269d <tell+0x23>
+    return fdes->fd_offset;
+  802696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80269d:	c9                   	leave
+  80269e:	c3                   	ret
+
+000000000080269f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80269f:	55                   	push   %rbp
+  8026a0:	48 89 e5             	mov    %rsp,%rbp
+  8026a3:	41 55                	push   %r13
+  8026a5:	41 54                	push   %r12
+  8026a7:	53                   	push   %rbx
+  8026a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ac:	89 fb                	mov    %edi,%ebx
+  8026ae:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026b1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026b5:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8026bc:	00 00 00 
+  8026bf:	ff d0                	call   *%rax
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	78 38                	js     8026fd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026c5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026c9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026cd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026d1:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  8026d8:	00 00 00 
+  8026db:	ff d0                	call   *%rax
+  8026dd:	85 c0                	test   %eax,%eax
+  8026df:	78 1c                	js     8026fd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026e1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8026e6:	74 20                	je     802708 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026ec:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8026f0:	48 85 c0             	test   %rax,%rax
+  8026f3:	74 47                	je     80273c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8026f5:	44 89 e6             	mov    %r12d,%esi
+  8026f8:	4c 89 ef             	mov    %r13,%rdi
+  8026fb:	ff d0                	call   *%rax
+}
+  8026fd:	48 83 c4 18          	add    $0x18,%rsp
+  802701:	5b                   	pop    %rbx
+  802702:	41 5c                	pop    %r12
+  802704:	41 5d                	pop    %r13
+  802706:	5d                   	pop    %rbp
+  802707:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802708:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80270f:	00 00 00 
+  802712:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802718:	89 da                	mov    %ebx,%edx
+  80271a:	48 bf 10 57 80 00 00 	movabs $0x805710,%rdi
+  802721:	00 00 00 
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+  802729:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  802730:	00 00 00 
+  802733:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80273a:	eb c1                	jmp    8026fd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80273c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802741:	eb ba                	jmp    8026fd <ftruncate+0x5e>
+
+0000000000802743 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	41 54                	push   %r12
+  802749:	53                   	push   %rbx
+  80274a:	48 83 ec 10          	sub    $0x10,%rsp
+  80274e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802751:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802755:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	85 c0                	test   %eax,%eax
+  802763:	78 4e                	js     8027b3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802765:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802769:	41 8b 3c 24          	mov    (%r12),%edi
+  80276d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802771:	48 b8 c9 21 80 00 00 	movabs $0x8021c9,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	78 32                	js     8027b3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802781:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802785:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80278a:	74 30                	je     8027bc <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80278c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80278f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802796:	00 00 00 
+    stat->st_isdir = 0;
+  802799:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027a0:	00 00 00 
+    stat->st_dev = dev;
+  8027a3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8027aa:	48 89 de             	mov    %rbx,%rsi
+  8027ad:	4c 89 e7             	mov    %r12,%rdi
+  8027b0:	ff 50 28             	call   *0x28(%rax)
+}
+  8027b3:	48 83 c4 10          	add    $0x10,%rsp
+  8027b7:	5b                   	pop    %rbx
+  8027b8:	41 5c                	pop    %r12
+  8027ba:	5d                   	pop    %rbp
+  8027bb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027bc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027c1:	eb f0                	jmp    8027b3 <fstat+0x70>
+
+00000000008027c3 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8027c3:	55                   	push   %rbp
+  8027c4:	48 89 e5             	mov    %rsp,%rbp
+  8027c7:	41 54                	push   %r12
+  8027c9:	53                   	push   %rbx
+  8027ca:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8027d1:	41 89 fc             	mov    %edi,%r12d
+  8027d4:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027da:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	78 31                	js     80281b <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8027ea:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8027f1:	44 89 e7             	mov    %r12d,%edi
+  8027f4:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	85 c0                	test   %eax,%eax
+  802802:	78 17                	js     80281b <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802804:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802808:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80280b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80280e:	39 d3                	cmp    %edx,%ebx
+  802810:	0f 4f da             	cmovg  %edx,%ebx
+  802813:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802816:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80281b:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802822:	5b                   	pop    %rbx
+  802823:	41 5c                	pop    %r12
+  802825:	5d                   	pop    %rbp
+  802826:	c3                   	ret
+
+0000000000802827 <seektoend>:
+{
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	53                   	push   %rbx
+  80282c:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802833:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802835:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802839:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	85 c0                	test   %eax,%eax
+  802847:	78 28                	js     802871 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802849:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802850:	89 df                	mov    %ebx,%edi
+  802852:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+  80285e:	85 c0                	test   %eax,%eax
+  802860:	78 0f                	js     802871 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802862:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802869:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80286c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802871:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802875:	c9                   	leave
+  802876:	c3                   	ret
+
+0000000000802877 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802877:	55                   	push   %rbp
+  802878:	48 89 e5             	mov    %rsp,%rbp
+  80287b:	41 54                	push   %r12
+  80287d:	53                   	push   %rbx
+  80287e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802881:	be 00 00 00 00       	mov    $0x0,%esi
+  802886:	48 b8 6a 34 80 00 00 	movabs $0x80346a,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+  802892:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802894:	85 c0                	test   %eax,%eax
+  802896:	78 25                	js     8028bd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802898:	4c 89 e6             	mov    %r12,%rsi
+  80289b:	89 c7                	mov    %eax,%edi
+  80289d:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028ac:	89 df                	mov    %ebx,%edi
+  8028ae:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+
+    return res;
+  8028ba:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028bd:	89 d8                	mov    %ebx,%eax
+  8028bf:	5b                   	pop    %rbx
+  8028c0:	41 5c                	pop    %r12
+  8028c2:	5d                   	pop    %rbp
+  8028c3:	c3                   	ret
+
+00000000008028c4 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	53                   	push   %rbx
+  8028c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cd:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028d0:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+  8028dc:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8028e0:	0f 87 ea 00 00 00    	ja     8029d0 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8028e6:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8028ed:	00 00 00 
+  8028f0:	80 38 00             	cmpb   $0x0,(%rax)
+  8028f3:	75 35                	jne    80292a <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8028f5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028fa:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8028ff:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802904:	bf 00 00 00 00       	mov    $0x0,%edi
+  802909:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+  802915:	85 c0                	test   %eax,%eax
+  802917:	0f 88 ba 00 00 00    	js     8029d7 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80291d:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802924:	00 00 00 
+  802927:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80292a:	48 89 df             	mov    %rbx,%rdi
+  80292d:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802934:	00 00 00 
+  802937:	ff d0                	call   *%rax
+  802939:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80293d:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802944:	00 00 00 
+  802947:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80294b:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80294e:	39 39                	cmp    %edi,(%rcx)
+  802950:	74 46                	je     802998 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802952:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802956:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80295d:	00 
+  80295e:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802965:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80296c:	00 
+  80296d:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802974:	00 
+  802975:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80297c:	00 
+  80297d:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802984:	00 
+  802985:	89 39                	mov    %edi,(%rcx)
+  802987:	48 01 c6             	add    %rax,%rsi
+  80298a:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80298f:	48 89 c8             	mov    %rcx,%rax
+  802992:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802996:	c9                   	leave
+  802997:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802998:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80299c:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8029a3:	00 00 00 
+  8029a6:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029a9:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8029ad:	74 e0                	je     80298f <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8029af:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8029b6:	00 
+  8029b7:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8029bb:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8029c2:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8029c4:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029c7:	48 01 c2             	add    %rax,%rdx
+  8029ca:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8029ce:	eb bf                	jmp    80298f <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d5:	eb b8                	jmp    80298f <fbuf_get+0xcb>
+            return NULL;
+  8029d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029dc:	eb b1                	jmp    80298f <fbuf_get+0xcb>
+
+00000000008029de <fsipc_bulk>:
+fsipc_bulk(void) {
+  8029de:	55                   	push   %rbp
+  8029df:	48 89 e5             	mov    %rsp,%rbp
+  8029e2:	53                   	push   %rbx
+  8029e3:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8029e7:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8029ee:	00 00 00 
+  8029f1:	48 8b 18             	mov    (%rax),%rbx
+  8029f4:	48 85 db             	test   %rbx,%rbx
+  8029f7:	74 16                	je     802a0f <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8029f9:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a00:	00 00 00 
+  802a03:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a06:	48 89 d8             	mov    %rbx,%rax
+  802a09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a0f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a14:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a19:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a23:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  802a2a:	00 00 00 
+  802a2d:	ff d0                	call   *%rax
+  802a2f:	85 c0                	test   %eax,%eax
+  802a31:	78 d3                	js     802a06 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a33:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a38:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a3f:	00 00 00 
+  802a42:	eb b5                	jmp    8029f9 <fsipc_bulk+0x1b>
+
+0000000000802a44 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802a44:	55                   	push   %rbp
+  802a45:	48 89 e5             	mov    %rsp,%rbp
+  802a48:	41 57                	push   %r15
+  802a4a:	41 56                	push   %r14
+  802a4c:	41 55                	push   %r13
+  802a4e:	41 54                	push   %r12
+  802a50:	53                   	push   %rbx
+  802a51:	48 83 ec 08          	sub    $0x8,%rsp
+  802a55:	41 89 fd             	mov    %edi,%r13d
+  802a58:	49 89 f6             	mov    %rsi,%r14
+  802a5b:	49 89 d7             	mov    %rdx,%r15
+  802a5e:	48 89 cb             	mov    %rcx,%rbx
+  802a61:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a64:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a6b:	00 00 00 
+  802a6e:	83 38 00             	cmpl   $0x0,(%rax)
+  802a71:	74 52                	je     802ac5 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802a73:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a79:	4c 89 f9             	mov    %r15,%rcx
+  802a7c:	4c 89 f2             	mov    %r14,%rdx
+  802a7f:	44 89 ee             	mov    %r13d,%esi
+  802a82:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a89:	00 00 00 
+  802a8c:	8b 38                	mov    (%rax),%edi
+  802a8e:	48 b8 29 45 80 00 00 	movabs $0x804529,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802a9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a9f:	4c 89 e2             	mov    %r12,%rdx
+  802aa2:	48 89 de             	mov    %rbx,%rsi
+  802aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aaa:	48 b8 79 43 80 00 00 	movabs $0x804379,%rax
+  802ab1:	00 00 00 
+  802ab4:	ff d0                	call   *%rax
+}
+  802ab6:	48 83 c4 08          	add    $0x8,%rsp
+  802aba:	5b                   	pop    %rbx
+  802abb:	41 5c                	pop    %r12
+  802abd:	41 5d                	pop    %r13
+  802abf:	41 5e                	pop    %r14
+  802ac1:	41 5f                	pop    %r15
+  802ac3:	5d                   	pop    %rbp
+  802ac4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ac5:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aca:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  802ad1:	00 00 00 
+  802ad4:	ff d0                	call   *%rax
+  802ad6:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802add:	00 00 
+  802adf:	eb 92                	jmp    802a73 <fsipc_region+0x2f>
+
+0000000000802ae1 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+  802ae5:	41 57                	push   %r15
+  802ae7:	41 56                	push   %r14
+  802ae9:	41 55                	push   %r13
+  802aeb:	41 54                	push   %r12
+  802aed:	53                   	push   %rbx
+  802aee:	48 83 ec 28          	sub    $0x28,%rsp
+  802af2:	49 89 ff             	mov    %rdi,%r15
+  802af5:	49 89 f6             	mov    %rsi,%r14
+  802af8:	48 89 d3             	mov    %rdx,%rbx
+  802afb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802aff:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b02:	48 b8 de 29 80 00 00 	movabs $0x8029de,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b0e:	48 85 c0             	test   %rax,%rax
+  802b11:	0f 84 cc 00 00 00    	je     802be3 <devfile_write_direct+0x102>
+  802b17:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b1a:	48 85 db             	test   %rbx,%rbx
+  802b1d:	0f 84 ba 00 00 00    	je     802bdd <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b23:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b29:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b30:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b34:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b38:	4c 29 e3             	sub    %r12,%rbx
+  802b3b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b40:	48 39 c3             	cmp    %rax,%rbx
+  802b43:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b47:	48 89 da             	mov    %rbx,%rdx
+  802b4a:	4c 89 f6             	mov    %r14,%rsi
+  802b4d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b51:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  802b58:	00 00 00 
+  802b5b:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802b5d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b61:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802b65:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802b68:	44 01 e0             	add    %r12d,%eax
+  802b6b:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802b6f:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802b73:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802b7a:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b81:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802b88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b93:	4c 89 ee             	mov    %r13,%rsi
+  802b96:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b9b:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+        if (res < 0)
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	78 29                	js     802bd4 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802bab:	74 2b                	je     802bd8 <devfile_write_direct+0xf7>
+        i += res;
+  802bad:	48 98                	cltq
+  802baf:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802bb2:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802bb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bb9:	49 39 c4             	cmp    %rax,%r12
+  802bbc:	0f 82 72 ff ff ff    	jb     802b34 <devfile_write_direct+0x53>
+    return i;
+  802bc2:	4c 89 e0             	mov    %r12,%rax
+}
+  802bc5:	48 83 c4 28          	add    $0x28,%rsp
+  802bc9:	5b                   	pop    %rbx
+  802bca:	41 5c                	pop    %r12
+  802bcc:	41 5d                	pop    %r13
+  802bce:	41 5e                	pop    %r14
+  802bd0:	41 5f                	pop    %r15
+  802bd2:	5d                   	pop    %rbp
+  802bd3:	c3                   	ret
+            return res;
+  802bd4:	48 98                	cltq
+  802bd6:	eb ed                	jmp    802bc5 <devfile_write_direct+0xe4>
+            return i;
+  802bd8:	4c 89 e0             	mov    %r12,%rax
+  802bdb:	eb e8                	jmp    802bc5 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802bdd:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802be1:	eb df                	jmp    802bc2 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802be3:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802bea:	eb d9                	jmp    802bc5 <devfile_write_direct+0xe4>
+
+0000000000802bec <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802bec:	55                   	push   %rbp
+  802bed:	48 89 e5             	mov    %rsp,%rbp
+  802bf0:	41 56                	push   %r14
+  802bf2:	41 55                	push   %r13
+  802bf4:	41 54                	push   %r12
+  802bf6:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802bf7:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802bfb:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c04:	4d 39 ee             	cmp    %r13,%r14
+  802c07:	0f 84 99 00 00 00    	je     802ca6 <fbuf_flush+0xba>
+  802c0d:	49 89 fc             	mov    %rdi,%r12
+  802c10:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c13:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c16:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c1a:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+  802c26:	48 89 c2             	mov    %rax,%rdx
+  802c29:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c2d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c31:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c35:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c3a:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c3d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c41:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802c48:	00 
+  802c49:	44 89 f1             	mov    %r14d,%ecx
+  802c4c:	4c 89 ea             	mov    %r13,%rdx
+  802c4f:	4c 89 e7             	mov    %r12,%rdi
+  802c52:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c5e:	48 85 c0             	test   %rax,%rax
+  802c61:	78 43                	js     802ca6 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c63:	4c 39 e8             	cmp    %r13,%rax
+  802c66:	72 47                	jb     802caf <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802c68:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802c6d:	83 c0 01             	add    $0x1,%eax
+  802c70:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c75:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802c78:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c7c:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802c80:	72 0f                	jb     802c91 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802c82:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802c86:	48 39 c2             	cmp    %rax,%rdx
+  802c89:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802c8d:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802c91:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802c98:	00 
+  802c99:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802ca0:	00 
+    return 0;
+  802ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca6:	5b                   	pop    %rbx
+  802ca7:	41 5c                	pop    %r12
+  802ca9:	41 5d                	pop    %r13
+  802cab:	41 5e                	pop    %r14
+  802cad:	5d                   	pop    %rbp
+  802cae:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802caf:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802cb4:	eb f0                	jmp    802ca6 <fbuf_flush+0xba>
+
+0000000000802cb6 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	53                   	push   %rbx
+  802cbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802cbf:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802cc2:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+  802cce:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd6:	48 85 f6             	test   %rsi,%rsi
+  802cd9:	74 0f                	je     802cea <devfile_sync+0x34>
+  802cdb:	48 89 df             	mov    %rbx,%rdi
+  802cde:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+}
+  802cea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cee:	c9                   	leave
+  802cef:	c3                   	ret
+
+0000000000802cf0 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802cf0:	55                   	push   %rbp
+  802cf1:	48 89 e5             	mov    %rsp,%rbp
+  802cf4:	48 83 ec 10          	sub    $0x10,%rsp
+  802cf8:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802cfb:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d02:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d03:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d0c:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d13:	00 00 00 
+  802d16:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+}
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+
+0000000000802d24 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	41 54                	push   %r12
+  802d2a:	53                   	push   %rbx
+  802d2b:	48 89 fb             	mov    %rdi,%rbx
+  802d2e:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d31:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  802d38:	00 00 00 
+  802d3b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	78 63                	js     802da4 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d41:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d44:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d4b:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802d4d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d52:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d57:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  802d5e:	00 00 00 
+  802d61:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d63:	85 c0                	test   %eax,%eax
+  802d65:	78 3d                	js     802da4 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d67:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802d6e:	00 00 00 
+  802d71:	48 89 de             	mov    %rbx,%rsi
+  802d74:	4c 89 e7             	mov    %r12,%rdi
+  802d77:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  802d7e:	00 00 00 
+  802d81:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d83:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802d89:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802d90:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d91:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802d97:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802d9e:	00 
+
+    return 0;
+  802d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da4:	5b                   	pop    %rbx
+  802da5:	41 5c                	pop    %r12
+  802da7:	5d                   	pop    %rbp
+  802da8:	c3                   	ret
+
+0000000000802da9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802da9:	55                   	push   %rbp
+  802daa:	48 89 e5             	mov    %rsp,%rbp
+  802dad:	41 54                	push   %r12
+  802daf:	53                   	push   %rbx
+  802db0:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802db3:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+  802dbf:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802dc2:	48 89 df             	mov    %rbx,%rdi
+  802dc5:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802dcc:	00 00 00 
+  802dcf:	ff d0                	call   *%rax
+  802dd1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802dd5:	76 2e                	jbe    802e05 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802dd7:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dda:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802de1:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802de3:	be 00 00 00 00       	mov    $0x0,%esi
+  802de8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ded:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802df9:	45 85 e4             	test   %r12d,%r12d
+  802dfc:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e00:	5b                   	pop    %rbx
+  802e01:	41 5c                	pop    %r12
+  802e03:	5d                   	pop    %rbp
+  802e04:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e05:	48 89 df             	mov    %rbx,%rdi
+  802e08:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802e0f:	00 00 00 
+  802e12:	ff d0                	call   *%rax
+  802e14:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e18:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e1f:	00 00 00 
+  802e22:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e29:	48 89 df             	mov    %rbx,%rdi
+  802e2c:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  802e33:	00 00 00 
+  802e36:	ff d0                	call   *%rax
+  802e38:	48 89 c6             	mov    %rax,%rsi
+  802e3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e45:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  802e4c:	00 00 00 
+  802e4f:	ff d0                	call   *%rax
+  802e51:	eb 84                	jmp    802dd7 <devfile_flush+0x2e>
+
+0000000000802e53 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e53:	55                   	push   %rbp
+  802e54:	48 89 e5             	mov    %rsp,%rbp
+  802e57:	41 55                	push   %r13
+  802e59:	41 54                	push   %r12
+  802e5b:	53                   	push   %rbx
+  802e5c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e60:	48 89 fb             	mov    %rdi,%rbx
+  802e63:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802e66:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e72:	48 85 c0             	test   %rax,%rax
+  802e75:	74 51                	je     802ec8 <devfile_trunc+0x75>
+  802e77:	49 89 c4             	mov    %rax,%r12
+  802e7a:	48 89 c6             	mov    %rax,%rsi
+  802e7d:	48 89 df             	mov    %rbx,%rdi
+  802e80:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  802e87:	00 00 00 
+  802e8a:	ff d0                	call   *%rax
+  802e8c:	85 c0                	test   %eax,%eax
+  802e8e:	78 2d                	js     802ebd <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e90:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802e97:	00 00 00 
+  802e9a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e9d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e9f:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ea3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea8:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ead:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	79 3e                	jns    802efb <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802ebd:	48 83 c4 08          	add    $0x8,%rsp
+  802ec1:	5b                   	pop    %rbx
+  802ec2:	41 5c                	pop    %r12
+  802ec4:	41 5d                	pop    %r13
+  802ec6:	5d                   	pop    %rbp
+  802ec7:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ec8:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ecf:	00 00 00 
+  802ed2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ed5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ed7:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802edb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee0:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ee5:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  802eec:	00 00 00 
+  802eef:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ef1:	85 c0                	test   %eax,%eax
+  802ef3:	78 c8                	js     802ebd <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ef5:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ef9:	eb c2                	jmp    802ebd <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802efb:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802efe:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f01:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f04:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f09:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f10:	00 00 
+  802f12:	eb a9                	jmp    802ebd <devfile_trunc+0x6a>
+
+0000000000802f14 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f14:	55                   	push   %rbp
+  802f15:	48 89 e5             	mov    %rsp,%rbp
+  802f18:	41 57                	push   %r15
+  802f1a:	41 56                	push   %r14
+  802f1c:	41 55                	push   %r13
+  802f1e:	41 54                	push   %r12
+  802f20:	53                   	push   %rbx
+  802f21:	48 83 ec 28          	sub    $0x28,%rsp
+  802f25:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f29:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f2d:	49 89 d7             	mov    %rdx,%r15
+  802f30:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f34:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+  802f40:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802f43:	48 85 c0             	test   %rax,%rax
+  802f46:	74 31                	je     802f79 <devfile_write+0x65>
+  802f48:	4c 89 f8             	mov    %r15,%rax
+  802f4b:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802f52:	77 25                	ja     802f79 <devfile_write+0x65>
+    size_t i = 0;
+  802f54:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802f5a:	48 85 c0             	test   %rax,%rax
+  802f5d:	0f 85 64 01 00 00    	jne    8030c7 <devfile_write+0x1b3>
+    size_t i = 0;
+  802f63:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802f67:	4c 89 f8             	mov    %r15,%rax
+}
+  802f6a:	48 83 c4 28          	add    $0x28,%rsp
+  802f6e:	5b                   	pop    %rbx
+  802f6f:	41 5c                	pop    %r12
+  802f71:	41 5d                	pop    %r13
+  802f73:	41 5e                	pop    %r14
+  802f75:	41 5f                	pop    %r15
+  802f77:	5d                   	pop    %rbp
+  802f78:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f79:	48 85 db             	test   %rbx,%rbx
+  802f7c:	74 5b                	je     802fd9 <devfile_write+0xc5>
+  802f7e:	48 89 de             	mov    %rbx,%rsi
+  802f81:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f85:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 40                	js     802fd5 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802f95:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f99:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802f9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fa0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fa4:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802fb0:	48 85 c0             	test   %rax,%rax
+  802fb3:	7e b5                	jle    802f6a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802fb5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802fb9:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802fbc:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802fbf:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802fc2:	8d 51 01             	lea    0x1(%rcx),%edx
+  802fc5:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fc8:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802fcb:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802fd2:	00 
+  802fd3:	eb 95                	jmp    802f6a <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fd5:	48 98                	cltq
+  802fd7:	eb 91                	jmp    802f6a <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802fd9:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802fdd:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802fe0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fe4:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fe8:	48 89 df             	mov    %rbx,%rdi
+  802feb:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  802ff2:	00 00 00 
+  802ff5:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ff7:	48 85 c0             	test   %rax,%rax
+  802ffa:	0f 8e 6a ff ff ff    	jle    802f6a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803000:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803003:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803007:	e9 5e ff ff ff       	jmp    802f6a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80300c:	48 98                	cltq
+  80300e:	4d 85 ff             	test   %r15,%r15
+  803011:	49 0f 45 c7          	cmovne %r15,%rax
+  803015:	e9 50 ff ff ff       	jmp    802f6a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80301a:	48 89 de             	mov    %rbx,%rsi
+  80301d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803021:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  803028:	00 00 00 
+  80302b:	ff d0                	call   *%rax
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	0f 88 2b 01 00 00    	js     803160 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803035:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803039:	4c 01 f8             	add    %r15,%rax
+  80303c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803040:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803044:	48 b9 f0 20 80 00 00 	movabs $0x8020f0,%rcx
+  80304b:	00 00 00 
+  80304e:	ff d1                	call   *%rcx
+  803050:	48 89 c2             	mov    %rax,%rdx
+  803053:	48 c1 e2 04          	shl    $0x4,%rdx
+  803057:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80305b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80305f:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803064:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803067:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80306e:	00 
+  80306f:	4c 89 ea             	mov    %r13,%rdx
+  803072:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803076:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803082:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803086:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80308a:	48 39 c2             	cmp    %rax,%rdx
+  80308d:	0f 84 db 00 00 00    	je     80316e <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803093:	4c 39 e2             	cmp    %r12,%rdx
+  803096:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80309a:	4d 01 ec             	add    %r13,%r12
+  80309d:	49 39 c4             	cmp    %rax,%r12
+  8030a0:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8030a4:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8030a8:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8030ac:	45 01 ee             	add    %r13d,%r14d
+  8030af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030b3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8030b7:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8030ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030be:	49 39 c7             	cmp    %rax,%r15
+  8030c1:	0f 83 a0 fe ff ff    	jae    802f67 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8030c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030cb:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8030cf:	8b 43 08             	mov    0x8(%rbx),%eax
+  8030d2:	44 39 f0             	cmp    %r14d,%eax
+  8030d5:	7f 10                	jg     8030e7 <devfile_write+0x1d3>
+  8030d7:	48 98                	cltq
+  8030d9:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8030df:	49 63 d6             	movslq %r14d,%rdx
+  8030e2:	48 39 d0             	cmp    %rdx,%rax
+  8030e5:	7d 2d                	jge    803114 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030e7:	48 89 de             	mov    %rbx,%rsi
+  8030ea:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030ee:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  8030f5:	00 00 00 
+  8030f8:	ff d0                	call   *%rax
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	0f 88 0a ff ff ff    	js     80300c <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803102:	44 89 f0             	mov    %r14d,%eax
+  803105:	66 b8 00 00          	mov    $0x0,%ax
+  803109:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80310c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803113:	00 
+        size_t off = pos - fb->fb_base;
+  803114:	45 89 f4             	mov    %r14d,%r12d
+  803117:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80311b:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80311e:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803122:	4d 29 fd             	sub    %r15,%r13
+  803125:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80312a:	4c 29 e0             	sub    %r12,%rax
+  80312d:	49 39 c5             	cmp    %rax,%r13
+  803130:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803134:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803138:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80313c:	48 39 c2             	cmp    %rax,%rdx
+  80313f:	0f 84 f0 fe ff ff    	je     803035 <devfile_write+0x121>
+  803145:	4c 39 e0             	cmp    %r12,%rax
+  803148:	0f 82 cc fe ff ff    	jb     80301a <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80314e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803152:	48 39 d0             	cmp    %rdx,%rax
+  803155:	0f 83 da fe ff ff    	jae    803035 <devfile_write+0x121>
+  80315b:	e9 ba fe ff ff       	jmp    80301a <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803160:	48 98                	cltq
+  803162:	4d 85 ff             	test   %r15,%r15
+  803165:	49 0f 45 c7          	cmovne %r15,%rax
+  803169:	e9 fc fd ff ff       	jmp    802f6a <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80316e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803172:	4c 89 e2             	mov    %r12,%rdx
+  803175:	e9 2a ff ff ff       	jmp    8030a4 <devfile_write+0x190>
+
+000000000080317a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80317a:	55                   	push   %rbp
+  80317b:	48 89 e5             	mov    %rsp,%rbp
+  80317e:	41 57                	push   %r15
+  803180:	41 56                	push   %r14
+  803182:	41 55                	push   %r13
+  803184:	41 54                	push   %r12
+  803186:	53                   	push   %rbx
+  803187:	48 83 ec 28          	sub    $0x28,%rsp
+  80318b:	49 89 ff             	mov    %rdi,%r15
+  80318e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803192:	48 89 d3             	mov    %rdx,%rbx
+  803195:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803199:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+  8031a5:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8031a8:	48 85 c0             	test   %rax,%rax
+  8031ab:	74 0d                	je     8031ba <devfile_read+0x40>
+  8031ad:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8031b4:	0f 86 1a 01 00 00    	jbe    8032d4 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031ba:	4d 85 e4             	test   %r12,%r12
+  8031bd:	74 1a                	je     8031d9 <devfile_read+0x5f>
+  8031bf:	4c 89 e6             	mov    %r12,%rsi
+  8031c2:	4c 89 ff             	mov    %r15,%rdi
+  8031c5:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	0f 88 e8 00 00 00    	js     8032c1 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8031d9:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8031dd:	48 b8 de 29 80 00 00 	movabs $0x8029de,%rax
+  8031e4:	00 00 00 
+  8031e7:	ff d0                	call   *%rax
+  8031e9:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8031ec:	48 85 c0             	test   %rax,%rax
+  8031ef:	0f 84 69 02 00 00    	je     80345e <devfile_read+0x2e4>
+    while (i < n) {
+  8031f5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031fa:	0f 84 ce 00 00 00    	je     8032ce <devfile_read+0x154>
+    size_t i = 0;
+  803200:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803205:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80320c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803210:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803214:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803218:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80321c:	48 29 da             	sub    %rbx,%rdx
+  80321f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803224:	48 39 c2             	cmp    %rax,%rdx
+  803227:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80322b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80322f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803233:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803236:	01 d8                	add    %ebx,%eax
+  803238:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80323c:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803240:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803247:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80324e:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803255:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80325b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803260:	4c 89 ee             	mov    %r13,%rsi
+  803263:	bf 03 00 00 00       	mov    $0x3,%edi
+  803268:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  80326f:	00 00 00 
+  803272:	ff d0                	call   *%rax
+        if (res < 0)
+  803274:	85 c0                	test   %eax,%eax
+  803276:	78 4d                	js     8032c5 <devfile_read+0x14b>
+        if (res == 0)
+  803278:	74 4f                	je     8032c9 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80327a:	4c 63 e0             	movslq %eax,%r12
+  80327d:	4c 89 e2             	mov    %r12,%rdx
+  803280:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803284:	4c 89 f7             	mov    %r14,%rdi
+  803287:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  80328e:	00 00 00 
+  803291:	ff d0                	call   *%rax
+        i += res;
+  803293:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803296:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803299:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80329d:	48 39 c3             	cmp    %rax,%rbx
+  8032a0:	0f 82 72 ff ff ff    	jb     803218 <devfile_read+0x9e>
+    return i;
+  8032a6:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032a9:	48 85 c0             	test   %rax,%rax
+  8032ac:	7e 04                	jle    8032b2 <devfile_read+0x138>
+  8032ae:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8032b2:	48 83 c4 28          	add    $0x28,%rsp
+  8032b6:	5b                   	pop    %rbx
+  8032b7:	41 5c                	pop    %r12
+  8032b9:	41 5d                	pop    %r13
+  8032bb:	41 5e                	pop    %r14
+  8032bd:	41 5f                	pop    %r15
+  8032bf:	5d                   	pop    %rbp
+  8032c0:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032c1:	48 98                	cltq
+  8032c3:	eb ed                	jmp    8032b2 <devfile_read+0x138>
+            return res;
+  8032c5:	48 98                	cltq
+  8032c7:	eb e9                	jmp    8032b2 <devfile_read+0x138>
+            return i;
+  8032c9:	48 89 d8             	mov    %rbx,%rax
+  8032cc:	eb db                	jmp    8032a9 <devfile_read+0x12f>
+    size_t i = 0;
+  8032ce:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8032d2:	eb d2                	jmp    8032a6 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8032d4:	48 89 c6             	mov    %rax,%rsi
+  8032d7:	4c 89 ff             	mov    %r15,%rdi
+  8032da:	48 b8 ec 2b 80 00 00 	movabs $0x802bec,%rax
+  8032e1:	00 00 00 
+  8032e4:	ff d0                	call   *%rax
+  8032e6:	85 c0                	test   %eax,%eax
+  8032e8:	78 40                	js     80332a <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8032ea:	4c 89 ff             	mov    %r15,%rdi
+  8032ed:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  8032f4:	00 00 00 
+  8032f7:	ff d0                	call   *%rax
+  8032f9:	48 89 c2             	mov    %rax,%rdx
+  8032fc:	48 c1 e2 04          	shl    $0x4,%rdx
+  803300:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803304:	48 c1 e0 0c          	shl    $0xc,%rax
+  803308:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80330d:	48 01 d0             	add    %rdx,%rax
+  803310:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803314:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803319:	0f 84 33 01 00 00    	je     803452 <devfile_read+0x2d8>
+    size_t i = 0;
+  80331f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803325:	e9 f5 00 00 00       	jmp    80341f <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80332a:	48 98                	cltq
+  80332c:	eb 84                	jmp    8032b2 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80332e:	44 89 e8             	mov    %r13d,%eax
+  803331:	66 b8 00 00          	mov    $0x0,%ax
+  803335:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80333a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803341:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803343:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803347:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80334b:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80334d:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803352:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803355:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80335c:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80335d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803363:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803368:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80336d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803372:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	0f 88 be 00 00 00    	js     803444 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803386:	48 63 d0             	movslq %eax,%rdx
+  803389:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80338e:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803393:	44 39 e8             	cmp    %r13d,%eax
+  803396:	0f 8e ba 00 00 00    	jle    803456 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80339c:	49 63 c5             	movslq %r13d,%rax
+  80339f:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8033a4:	48 29 c3             	sub    %rax,%rbx
+  8033a7:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8033ac:	48 01 c3             	add    %rax,%rbx
+  8033af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033b3:	4c 29 f0             	sub    %r14,%rax
+  8033b6:	48 39 c3             	cmp    %rax,%rbx
+  8033b9:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033bd:	4c 89 ff             	mov    %r15,%rdi
+  8033c0:	48 b9 f0 20 80 00 00 	movabs $0x8020f0,%rcx
+  8033c7:	00 00 00 
+  8033ca:	ff d1                	call   *%rcx
+  8033cc:	48 89 c2             	mov    %rax,%rdx
+  8033cf:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033d3:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033d7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033db:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8033e0:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8033e3:	44 89 ea             	mov    %r13d,%edx
+  8033e6:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8033eb:	48 63 d2             	movslq %edx,%rdx
+  8033ee:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8033f5:	00 
+  8033f6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8033fa:	4c 01 f7             	add    %r14,%rdi
+  8033fd:	48 89 da             	mov    %rbx,%rdx
+  803400:	48 b9 61 12 80 00 00 	movabs $0x801261,%rcx
+  803407:	00 00 00 
+  80340a:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80340c:	41 01 dd             	add    %ebx,%r13d
+  80340f:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803413:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803416:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80341a:	49 39 c6             	cmp    %rax,%r14
+  80341d:	73 37                	jae    803456 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80341f:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803423:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803428:	44 39 e8             	cmp    %r13d,%eax
+  80342b:	0f 8f fd fe ff ff    	jg     80332e <devfile_read+0x1b4>
+  803431:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803436:	44 39 e8             	cmp    %r13d,%eax
+  803439:	0f 8f 5d ff ff ff    	jg     80339c <devfile_read+0x222>
+  80343f:	e9 ea fe ff ff       	jmp    80332e <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803444:	48 98                	cltq
+  803446:	4d 85 f6             	test   %r14,%r14
+  803449:	49 0f 45 c6          	cmovne %r14,%rax
+  80344d:	e9 60 fe ff ff       	jmp    8032b2 <devfile_read+0x138>
+    size_t i = 0;
+  803452:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803456:	4c 89 f0             	mov    %r14,%rax
+  803459:	e9 54 fe ff ff       	jmp    8032b2 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80345e:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803465:	e9 48 fe ff ff       	jmp    8032b2 <devfile_read+0x138>
+
+000000000080346a <open>:
+open(const char *path, int mode) {
+  80346a:	55                   	push   %rbp
+  80346b:	48 89 e5             	mov    %rsp,%rbp
+  80346e:	41 55                	push   %r13
+  803470:	41 54                	push   %r12
+  803472:	53                   	push   %rbx
+  803473:	48 83 ec 18          	sub    $0x18,%rsp
+  803477:	49 89 fc             	mov    %rdi,%r12
+  80347a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80347d:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  803484:	00 00 00 
+  803487:	ff d0                	call   *%rax
+  803489:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80348f:	0f 87 8a 00 00 00    	ja     80351f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803495:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803499:	48 b8 1e 21 80 00 00 	movabs $0x80211e,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+  8034a5:	89 c3                	mov    %eax,%ebx
+  8034a7:	85 c0                	test   %eax,%eax
+  8034a9:	78 50                	js     8034fb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8034ab:	4c 89 e6             	mov    %r12,%rsi
+  8034ae:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8034b5:	00 00 00 
+  8034b8:	48 89 df             	mov    %rbx,%rdi
+  8034bb:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  8034c2:	00 00 00 
+  8034c5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8034c7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8034ce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034d7:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	89 c3                	mov    %eax,%ebx
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	78 1f                	js     803508 <open+0x9e>
+    return fd2num(fd);
+  8034e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034ed:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+  8034f9:	89 c3                	mov    %eax,%ebx
+}
+  8034fb:	89 d8                	mov    %ebx,%eax
+  8034fd:	48 83 c4 18          	add    $0x18,%rsp
+  803501:	5b                   	pop    %rbx
+  803502:	41 5c                	pop    %r12
+  803504:	41 5d                	pop    %r13
+  803506:	5d                   	pop    %rbp
+  803507:	c3                   	ret
+        fd_close(fd, 0);
+  803508:	be 00 00 00 00       	mov    $0x0,%esi
+  80350d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803511:	48 b8 39 22 80 00 00 	movabs $0x802239,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+        return res;
+  80351d:	eb dc                	jmp    8034fb <open+0x91>
+        return -E_BAD_PATH;
+  80351f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803524:	eb d5                	jmp    8034fb <open+0x91>
+
+0000000000803526 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803526:	55                   	push   %rbp
+  803527:	48 89 e5             	mov    %rsp,%rbp
+  80352a:	41 57                	push   %r15
+  80352c:	41 56                	push   %r14
+  80352e:	41 55                	push   %r13
+  803530:	41 54                	push   %r12
+  803532:	53                   	push   %rbx
+  803533:	48 83 ec 18          	sub    $0x18,%rsp
+  803537:	41 89 f6             	mov    %esi,%r14d
+  80353a:	49 89 d7             	mov    %rdx,%r15
+  80353d:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803540:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803544:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803550:	85 c0                	test   %eax,%eax
+  803552:	0f 88 db 00 00 00    	js     803633 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803558:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80355c:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803563:	00 00 00 
+  803566:	8b 00                	mov    (%rax),%eax
+  803568:	39 07                	cmp    %eax,(%rdi)
+  80356a:	0f 85 db 00 00 00    	jne    80364b <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803570:	45 85 f6             	test   %r14d,%r14d
+  803573:	0f 88 db 00 00 00    	js     803654 <fmap+0x12e>
+  803579:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803580:	0f 85 d7 00 00 00    	jne    80365d <fmap+0x137>
+  803586:	4c 89 fb             	mov    %r15,%rbx
+  803589:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80358f:	0f 85 d1 00 00 00    	jne    803666 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803595:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  80359c:	00 00 00 
+  80359f:	ff d0                	call   *%rax
+  8035a1:	85 c0                	test   %eax,%eax
+  8035a3:	0f 88 8e 00 00 00    	js     803637 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035a9:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8035b0:	00 00 00 
+    while (i < n) {
+  8035b3:	4d 85 ed             	test   %r13,%r13
+  8035b6:	0f 84 8a 00 00 00    	je     803646 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8035bc:	4c 89 ea             	mov    %r13,%rdx
+  8035bf:	48 29 da             	sub    %rbx,%rdx
+  8035c2:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8035c9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8035cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035da:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8035de:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8035e2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8035e7:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8035ec:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8035f0:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8035f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035f9:	4c 89 e6             	mov    %r12,%rsi
+  8035fc:	bf 09 00 00 00       	mov    $0x9,%edi
+  803601:	48 b8 44 2a 80 00 00 	movabs $0x802a44,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80360d:	85 c0                	test   %eax,%eax
+  80360f:	78 2a                	js     80363b <fmap+0x115>
+        i += res;
+  803611:	48 98                	cltq
+  803613:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803616:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80361a:	72 05                	jb     803621 <fmap+0xfb>
+    while (i < n) {
+  80361c:	4c 39 eb             	cmp    %r13,%rbx
+  80361f:	72 9b                	jb     8035bc <fmap+0x96>
+    }
+    return i;
+  803621:	48 89 d8             	mov    %rbx,%rax
+}
+  803624:	48 83 c4 18          	add    $0x18,%rsp
+  803628:	5b                   	pop    %rbx
+  803629:	41 5c                	pop    %r12
+  80362b:	41 5d                	pop    %r13
+  80362d:	41 5e                	pop    %r14
+  80362f:	41 5f                	pop    %r15
+  803631:	5d                   	pop    %rbp
+  803632:	c3                   	ret
+    if (res < 0) return res;
+  803633:	48 98                	cltq
+  803635:	eb ed                	jmp    803624 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803637:	48 98                	cltq
+  803639:	eb e9                	jmp    803624 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80363b:	48 98                	cltq
+  80363d:	48 85 db             	test   %rbx,%rbx
+  803640:	48 0f 45 c3          	cmovne %rbx,%rax
+  803644:	eb de                	jmp    803624 <fmap+0xfe>
+    size_t i = 0;
+  803646:	4c 89 eb             	mov    %r13,%rbx
+  803649:	eb d6                	jmp    803621 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80364b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803652:	eb d0                	jmp    803624 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803654:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80365b:	eb c7                	jmp    803624 <fmap+0xfe>
+  80365d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803664:	eb be                	jmp    803624 <fmap+0xfe>
+  803666:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80366d:	eb b5                	jmp    803624 <fmap+0xfe>
+
+000000000080366f <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80366f:	55                   	push   %rbp
+  803670:	48 89 e5             	mov    %rsp,%rbp
+  803673:	41 56                	push   %r14
+  803675:	41 55                	push   %r13
+  803677:	41 54                	push   %r12
+  803679:	53                   	push   %rbx
+  80367a:	48 83 ec 10          	sub    $0x10,%rsp
+  80367e:	89 fb                	mov    %edi,%ebx
+  803680:	41 89 f4             	mov    %esi,%r12d
+  803683:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803686:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80368a:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  803691:	00 00 00 
+  803694:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803696:	85 c0                	test   %eax,%eax
+  803698:	78 63                	js     8036fd <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80369a:	45 85 e4             	test   %r12d,%r12d
+  80369d:	0f 88 80 00 00 00    	js     803723 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8036a3:	45 89 e6             	mov    %r12d,%r14d
+  8036a6:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8036ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036b1:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  8036b8:	00 00 00 
+  8036bb:	ff d0                	call   *%rax
+  8036bd:	48 89 c2             	mov    %rax,%rdx
+  8036c0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036c5:	44 89 f6             	mov    %r14d,%esi
+  8036c8:	89 df                	mov    %ebx,%edi
+  8036ca:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  8036d1:	00 00 00 
+  8036d4:	ff d0                	call   *%rax
+  8036d6:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8036d9:	45 29 f4             	sub    %r14d,%r12d
+  8036dc:	4d 63 f4             	movslq %r12d,%r14
+  8036df:	49 39 c6             	cmp    %rax,%r14
+  8036e2:	7c 1d                	jl     803701 <read_map+0x92>
+  8036e4:	48 85 c0             	test   %rax,%rax
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ec:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8036f0:	48 83 c4 10          	add    $0x10,%rsp
+  8036f4:	5b                   	pop    %rbx
+  8036f5:	41 5c                	pop    %r12
+  8036f7:	41 5d                	pop    %r13
+  8036f9:	41 5e                	pop    %r14
+  8036fb:	5d                   	pop    %rbp
+  8036fc:	c3                   	ret
+    if (res < 0) return res;
+  8036fd:	48 98                	cltq
+  8036ff:	eb ef                	jmp    8036f0 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803701:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803705:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+  803711:	4d 63 e4             	movslq %r12d,%r12
+  803714:	4c 01 e0             	add    %r12,%rax
+  803717:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80371b:	48 89 d8             	mov    %rbx,%rax
+  80371e:	4c 29 f0             	sub    %r14,%rax
+  803721:	eb cd                	jmp    8036f0 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803723:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80372a:	eb c4                	jmp    8036f0 <read_map+0x81>
+
+000000000080372c <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80372c:	55                   	push   %rbp
+  80372d:	48 89 e5             	mov    %rsp,%rbp
+  803730:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803734:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803738:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803744:	85 c0                	test   %eax,%eax
+  803746:	78 4a                	js     803792 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803748:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80374c:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803753:	00 00 00 
+  803756:	8b 00                	mov    (%rax),%eax
+  803758:	39 07                	cmp    %eax,(%rdi)
+  80375a:	75 38                	jne    803794 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80375c:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  803763:	00 00 00 
+  803766:	ff d0                	call   *%rax
+  803768:	85 c0                	test   %eax,%eax
+  80376a:	78 26                	js     803792 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80376c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803770:	8b 40 0c             	mov    0xc(%rax),%eax
+  803773:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80377a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80377c:	be 00 00 00 00       	mov    $0x0,%esi
+  803781:	bf 06 00 00 00       	mov    $0x6,%edi
+  803786:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+}
+  803792:	c9                   	leave
+  803793:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803794:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803799:	eb f7                	jmp    803792 <fsync+0x66>
+
+000000000080379b <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80379b:	55                   	push   %rbp
+  80379c:	48 89 e5             	mov    %rsp,%rbp
+  80379f:	41 57                	push   %r15
+  8037a1:	41 56                	push   %r14
+  8037a3:	41 55                	push   %r13
+  8037a5:	41 54                	push   %r12
+  8037a7:	53                   	push   %rbx
+  8037a8:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8037ac:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8037b3:	00 00 00 
+  8037b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8037bb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037c1:	49 bd 7e 21 80 00 00 	movabs $0x80217e,%r13
+  8037c8:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037cb:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8037d2:	00 00 00 
+  8037d5:	eb 0c                	jmp    8037e3 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8037d7:	83 c3 01             	add    $0x1,%ebx
+  8037da:	49 83 c4 28          	add    $0x28,%r12
+  8037de:	83 fb 20             	cmp    $0x20,%ebx
+  8037e1:	74 33                	je     803816 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037e3:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8037e8:	74 ed                	je     8037d7 <flushall+0x3c>
+  8037ea:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037ee:	89 df                	mov    %ebx,%edi
+  8037f0:	41 ff d5             	call   *%r13
+  8037f3:	85 c0                	test   %eax,%eax
+  8037f5:	78 e0                	js     8037d7 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037f7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037fb:	41 8b 06             	mov    (%r14),%eax
+  8037fe:	39 07                	cmp    %eax,(%rdi)
+  803800:	75 d5                	jne    8037d7 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803802:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  803809:	00 00 00 
+  80380c:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80380e:	85 c0                	test   %eax,%eax
+  803810:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803814:	eb c1                	jmp    8037d7 <flushall+0x3c>
+    }
+    return res;
+}
+  803816:	44 89 f8             	mov    %r15d,%eax
+  803819:	48 83 c4 18          	add    $0x18,%rsp
+  80381d:	5b                   	pop    %rbx
+  80381e:	41 5c                	pop    %r12
+  803820:	41 5d                	pop    %r13
+  803822:	41 5e                	pop    %r14
+  803824:	41 5f                	pop    %r15
+  803826:	5d                   	pop    %rbp
+  803827:	c3                   	ret
+
+0000000000803828 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803828:	55                   	push   %rbp
+  803829:	48 89 e5             	mov    %rsp,%rbp
+  80382c:	53                   	push   %rbx
+  80382d:	48 83 ec 08          	sub    $0x8,%rsp
+  803831:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803834:	40 0f b6 c6          	movzbl %sil,%eax
+  803838:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80383f:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803841:	be 00 00 00 00       	mov    $0x0,%esi
+  803846:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80384b:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803857:	85 c0                	test   %eax,%eax
+  803859:	78 23                	js     80387e <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80385b:	ba 58 06 00 00       	mov    $0x658,%edx
+  803860:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803867:	00 00 00 
+  80386a:	48 89 df             	mov    %rbx,%rdi
+  80386d:	48 b8 61 12 80 00 00 	movabs $0x801261,%rax
+  803874:	00 00 00 
+  803877:	ff d0                	call   *%rax
+    return 0;
+  803879:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80387e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803882:	c9                   	leave
+  803883:	c3                   	ret
+
+0000000000803884 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803884:	55                   	push   %rbp
+  803885:	48 89 e5             	mov    %rsp,%rbp
+  803888:	53                   	push   %rbx
+  803889:	48 83 ec 08          	sub    $0x8,%rsp
+  80388d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803890:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8038a2:	77 35                	ja     8038d9 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8038a4:	48 89 de             	mov    %rbx,%rsi
+  8038a7:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8038ae:	00 00 00 
+  8038b1:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8038bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8038c2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8038c7:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  8038ce:	00 00 00 
+  8038d1:	ff d0                	call   *%rax
+}
+  8038d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038d7:	c9                   	leave
+  8038d8:	c3                   	ret
+        return -E_BAD_PATH;
+  8038d9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8038de:	eb f3                	jmp    8038d3 <remove+0x4f>
+
+00000000008038e0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8038e0:	55                   	push   %rbp
+  8038e1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8038e4:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8038f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8038fa:	48 b8 f0 2c 80 00 00 	movabs $0x802cf0,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+}
+  803906:	5d                   	pop    %rbp
+  803907:	c3                   	ret
+
+0000000000803908 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803908:	55                   	push   %rbp
+  803909:	48 89 e5             	mov    %rsp,%rbp
+  80390c:	41 54                	push   %r12
+  80390e:	53                   	push   %rbx
+  80390f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803912:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+  80391e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803921:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  803928:	00 00 00 
+  80392b:	48 89 df             	mov    %rbx,%rdi
+  80392e:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  803935:	00 00 00 
+  803938:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80393a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80393f:	41 2b 04 24          	sub    (%r12),%eax
+  803943:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803949:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803950:	00 00 00 
+    stat->st_dev = &devpipe;
+  803953:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80395a:	00 00 00 
+  80395d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803964:	b8 00 00 00 00       	mov    $0x0,%eax
+  803969:	5b                   	pop    %rbx
+  80396a:	41 5c                	pop    %r12
+  80396c:	5d                   	pop    %rbp
+  80396d:	c3                   	ret
+
+000000000080396e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80396e:	55                   	push   %rbp
+  80396f:	48 89 e5             	mov    %rsp,%rbp
+  803972:	41 54                	push   %r12
+  803974:	53                   	push   %rbx
+  803975:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803978:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80397d:	48 89 fe             	mov    %rdi,%rsi
+  803980:	bf 00 00 00 00       	mov    $0x0,%edi
+  803985:	49 bc ab 17 80 00 00 	movabs $0x8017ab,%r12
+  80398c:	00 00 00 
+  80398f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803992:	48 89 df             	mov    %rbx,%rdi
+  803995:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  80399c:	00 00 00 
+  80399f:	ff d0                	call   *%rax
+  8039a1:	48 89 c6             	mov    %rax,%rsi
+  8039a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ae:	41 ff d4             	call   *%r12
+}
+  8039b1:	5b                   	pop    %rbx
+  8039b2:	41 5c                	pop    %r12
+  8039b4:	5d                   	pop    %rbp
+  8039b5:	c3                   	ret
+
+00000000008039b6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	41 57                	push   %r15
+  8039bc:	41 56                	push   %r14
+  8039be:	41 55                	push   %r13
+  8039c0:	41 54                	push   %r12
+  8039c2:	53                   	push   %rbx
+  8039c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c7:	49 89 fc             	mov    %rdi,%r12
+  8039ca:	49 89 f5             	mov    %rsi,%r13
+  8039cd:	49 89 d7             	mov    %rdx,%r15
+  8039d0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039d4:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8039e0:	4d 85 ff             	test   %r15,%r15
+  8039e3:	0f 84 af 00 00 00    	je     803a98 <devpipe_write+0xe2>
+  8039e9:	48 89 c3             	mov    %rax,%rbx
+  8039ec:	4c 89 f8             	mov    %r15,%rax
+  8039ef:	4d 89 ef             	mov    %r13,%r15
+  8039f2:	4c 01 e8             	add    %r13,%rax
+  8039f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039f9:	49 bd a0 15 80 00 00 	movabs $0x8015a0,%r13
+  803a00:	00 00 00 
+            sys_yield();
+  803a03:	49 be 3d 15 80 00 00 	movabs $0x80153d,%r14
+  803a0a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a0d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a10:	48 63 ce             	movslq %esi,%rcx
+  803a13:	48 63 03             	movslq (%rbx),%rax
+  803a16:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a1c:	48 39 c1             	cmp    %rax,%rcx
+  803a1f:	72 2e                	jb     803a4f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a21:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a26:	48 89 da             	mov    %rbx,%rdx
+  803a29:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a2e:	4c 89 e7             	mov    %r12,%rdi
+  803a31:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a34:	85 c0                	test   %eax,%eax
+  803a36:	74 66                	je     803a9e <devpipe_write+0xe8>
+            sys_yield();
+  803a38:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a3b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a3e:	48 63 ce             	movslq %esi,%rcx
+  803a41:	48 63 03             	movslq (%rbx),%rax
+  803a44:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a4a:	48 39 c1             	cmp    %rax,%rcx
+  803a4d:	73 d2                	jae    803a21 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a4f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a53:	48 89 ca             	mov    %rcx,%rdx
+  803a56:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a5a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a61:	08 10 20 
+  803a64:	48 f7 e2             	mul    %rdx
+  803a67:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a6b:	48 89 d0             	mov    %rdx,%rax
+  803a6e:	48 c1 e0 09          	shl    $0x9,%rax
+  803a72:	48 29 d0             	sub    %rdx,%rax
+  803a75:	48 c1 e0 03          	shl    $0x3,%rax
+  803a79:	48 29 c1             	sub    %rax,%rcx
+  803a7c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a81:	83 c6 01             	add    $0x1,%esi
+  803a84:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a87:	49 83 c7 01          	add    $0x1,%r15
+  803a8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a8f:	49 39 c7             	cmp    %rax,%r15
+  803a92:	0f 85 75 ff ff ff    	jne    803a0d <devpipe_write+0x57>
+    return n;
+  803a98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a9c:	eb 05                	jmp    803aa3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa3:	48 83 c4 18          	add    $0x18,%rsp
+  803aa7:	5b                   	pop    %rbx
+  803aa8:	41 5c                	pop    %r12
+  803aaa:	41 5d                	pop    %r13
+  803aac:	41 5e                	pop    %r14
+  803aae:	41 5f                	pop    %r15
+  803ab0:	5d                   	pop    %rbp
+  803ab1:	c3                   	ret
+
+0000000000803ab2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ab2:	55                   	push   %rbp
+  803ab3:	48 89 e5             	mov    %rsp,%rbp
+  803ab6:	41 57                	push   %r15
+  803ab8:	41 56                	push   %r14
+  803aba:	41 55                	push   %r13
+  803abc:	41 54                	push   %r12
+  803abe:	53                   	push   %rbx
+  803abf:	48 83 ec 18          	sub    $0x18,%rsp
+  803ac3:	49 89 fc             	mov    %rdi,%r12
+  803ac6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803aca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ace:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  803ad5:	00 00 00 
+  803ad8:	ff d0                	call   *%rax
+  803ada:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803add:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ae3:	49 bd a0 15 80 00 00 	movabs $0x8015a0,%r13
+  803aea:	00 00 00 
+            sys_yield();
+  803aed:	49 be 3d 15 80 00 00 	movabs $0x80153d,%r14
+  803af4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803af7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803afc:	74 7d                	je     803b7b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803afe:	8b 03                	mov    (%rbx),%eax
+  803b00:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b03:	75 26                	jne    803b2b <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b05:	4d 85 ff             	test   %r15,%r15
+  803b08:	75 77                	jne    803b81 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b0f:	48 89 da             	mov    %rbx,%rdx
+  803b12:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b17:	4c 89 e7             	mov    %r12,%rdi
+  803b1a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b1d:	85 c0                	test   %eax,%eax
+  803b1f:	74 72                	je     803b93 <devpipe_read+0xe1>
+            sys_yield();
+  803b21:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b24:	8b 03                	mov    (%rbx),%eax
+  803b26:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b29:	74 df                	je     803b0a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b2b:	48 63 c8             	movslq %eax,%rcx
+  803b2e:	48 89 ca             	mov    %rcx,%rdx
+  803b31:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b35:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b3c:	08 10 20 
+  803b3f:	48 89 d0             	mov    %rdx,%rax
+  803b42:	48 f7 e6             	mul    %rsi
+  803b45:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b49:	48 89 d0             	mov    %rdx,%rax
+  803b4c:	48 c1 e0 09          	shl    $0x9,%rax
+  803b50:	48 29 d0             	sub    %rdx,%rax
+  803b53:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b5a:	00 
+  803b5b:	48 89 c8             	mov    %rcx,%rax
+  803b5e:	48 29 d0             	sub    %rdx,%rax
+  803b61:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b66:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b6a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b6e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b71:	49 83 c7 01          	add    $0x1,%r15
+  803b75:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b79:	75 83                	jne    803afe <devpipe_read+0x4c>
+    return n;
+  803b7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b7f:	eb 03                	jmp    803b84 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b81:	4c 89 f8             	mov    %r15,%rax
+}
+  803b84:	48 83 c4 18          	add    $0x18,%rsp
+  803b88:	5b                   	pop    %rbx
+  803b89:	41 5c                	pop    %r12
+  803b8b:	41 5d                	pop    %r13
+  803b8d:	41 5e                	pop    %r14
+  803b8f:	41 5f                	pop    %r15
+  803b91:	5d                   	pop    %rbp
+  803b92:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b98:	eb ea                	jmp    803b84 <devpipe_read+0xd2>
+
+0000000000803b9a <pipe>:
+pipe(int pfd[2]) {
+  803b9a:	55                   	push   %rbp
+  803b9b:	48 89 e5             	mov    %rsp,%rbp
+  803b9e:	41 55                	push   %r13
+  803ba0:	41 54                	push   %r12
+  803ba2:	53                   	push   %rbx
+  803ba3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ba7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803baa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bae:	48 b8 1e 21 80 00 00 	movabs $0x80211e,%rax
+  803bb5:	00 00 00 
+  803bb8:	ff d0                	call   *%rax
+  803bba:	89 c3                	mov    %eax,%ebx
+  803bbc:	85 c0                	test   %eax,%eax
+  803bbe:	0f 88 a0 01 00 00    	js     803d64 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803bc4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bc9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bce:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd7:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  803bde:	00 00 00 
+  803be1:	ff d0                	call   *%rax
+  803be3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	0f 88 77 01 00 00    	js     803d64 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bed:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803bf1:	48 b8 1e 21 80 00 00 	movabs $0x80211e,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	89 c3                	mov    %eax,%ebx
+  803bff:	85 c0                	test   %eax,%eax
+  803c01:	0f 88 43 01 00 00    	js     803d4a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c07:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c0c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c11:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c15:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1a:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  803c21:	00 00 00 
+  803c24:	ff d0                	call   *%rax
+  803c26:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c28:	85 c0                	test   %eax,%eax
+  803c2a:	0f 88 1a 01 00 00    	js     803d4a <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c30:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c34:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+  803c40:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c43:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c4d:	48 89 c6             	mov    %rax,%rsi
+  803c50:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c55:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  803c5c:	00 00 00 
+  803c5f:	ff d0                	call   *%rax
+  803c61:	89 c3                	mov    %eax,%ebx
+  803c63:	85 c0                	test   %eax,%eax
+  803c65:	0f 88 c5 00 00 00    	js     803d30 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c6b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c6f:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	48 89 c1             	mov    %rax,%rcx
+  803c7e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c84:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8f:	4c 89 ee             	mov    %r13,%rsi
+  803c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c97:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  803c9e:	00 00 00 
+  803ca1:	ff d0                	call   *%rax
+  803ca3:	89 c3                	mov    %eax,%ebx
+  803ca5:	85 c0                	test   %eax,%eax
+  803ca7:	78 6e                	js     803d17 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ca9:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cae:	4c 89 ef             	mov    %r13,%rdi
+  803cb1:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  803cb8:	00 00 00 
+  803cbb:	ff d0                	call   *%rax
+  803cbd:	83 f8 02             	cmp    $0x2,%eax
+  803cc0:	0f 85 ab 00 00 00    	jne    803d71 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803cc6:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ccd:	00 00 
+  803ccf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cd3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cd5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cd9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ce0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ce4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ce6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803cf1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cf5:	48 bb f0 20 80 00 00 	movabs $0x8020f0,%rbx
+  803cfc:	00 00 00 
+  803cff:	ff d3                	call   *%rbx
+  803d01:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d05:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d09:	ff d3                	call   *%rbx
+  803d0b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d15:	eb 4d                	jmp    803d64 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d1c:	4c 89 ee             	mov    %r13,%rsi
+  803d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d24:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  803d2b:	00 00 00 
+  803d2e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d35:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3e:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d4f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d58:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  803d5f:	00 00 00 
+  803d62:	ff d0                	call   *%rax
+}
+  803d64:	89 d8                	mov    %ebx,%eax
+  803d66:	48 83 c4 18          	add    $0x18,%rsp
+  803d6a:	5b                   	pop    %rbx
+  803d6b:	41 5c                	pop    %r12
+  803d6d:	41 5d                	pop    %r13
+  803d6f:	5d                   	pop    %rbp
+  803d70:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d71:	48 b9 d0 57 80 00 00 	movabs $0x8057d0,%rcx
+  803d78:	00 00 00 
+  803d7b:	48 ba a7 57 80 00 00 	movabs $0x8057a7,%rdx
+  803d82:	00 00 00 
+  803d85:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803d8a:	48 bf bc 57 80 00 00 	movabs $0x8057bc,%rdi
+  803d91:	00 00 00 
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d99:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  803da0:	00 00 00 
+  803da3:	41 ff d0             	call   *%r8
+
+0000000000803da6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803da6:	55                   	push   %rbp
+  803da7:	48 89 e5             	mov    %rsp,%rbp
+  803daa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803db2:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  803db9:	00 00 00 
+  803dbc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	78 35                	js     803df7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803dc2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dc6:	48 b8 02 21 80 00 00 	movabs $0x802102,%rax
+  803dcd:	00 00 00 
+  803dd0:	ff d0                	call   *%rax
+  803dd2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dd5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803dda:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ddf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803de3:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  803dea:	00 00 00 
+  803ded:	ff d0                	call   *%rax
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	0f 94 c0             	sete   %al
+  803df4:	0f b6 c0             	movzbl %al,%eax
+}
+  803df7:	c9                   	leave
+  803df8:	c3                   	ret
+
+0000000000803df9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803df9:	48 89 f8             	mov    %rdi,%rax
+  803dfc:	48 c1 e8 27          	shr    $0x27,%rax
+  803e00:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e07:	7f 00 00 
+  803e0a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e0e:	f6 c2 01             	test   $0x1,%dl
+  803e11:	74 6d                	je     803e80 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e13:	48 89 f8             	mov    %rdi,%rax
+  803e16:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e1a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e21:	7f 00 00 
+  803e24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e28:	f6 c2 01             	test   $0x1,%dl
+  803e2b:	74 62                	je     803e8f <get_uvpt_entry+0x96>
+  803e2d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e34:	7f 00 00 
+  803e37:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e3b:	f6 c2 80             	test   $0x80,%dl
+  803e3e:	75 4f                	jne    803e8f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e40:	48 89 f8             	mov    %rdi,%rax
+  803e43:	48 c1 e8 15          	shr    $0x15,%rax
+  803e47:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e4e:	7f 00 00 
+  803e51:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e55:	f6 c2 01             	test   $0x1,%dl
+  803e58:	74 44                	je     803e9e <get_uvpt_entry+0xa5>
+  803e5a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e61:	7f 00 00 
+  803e64:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e68:	f6 c2 80             	test   $0x80,%dl
+  803e6b:	75 31                	jne    803e9e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e6d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e71:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e78:	7f 00 00 
+  803e7b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e7f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e80:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e87:	7f 00 00 
+  803e8a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e8e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e8f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e96:	7f 00 00 
+  803e99:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e9d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e9e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ea5:	7f 00 00 
+  803ea8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eac:	c3                   	ret
+
+0000000000803ead <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803ead:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803eb0:	48 89 f9             	mov    %rdi,%rcx
+  803eb3:	48 c1 e9 27          	shr    $0x27,%rcx
+  803eb7:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ebe:	7f 00 00 
+  803ec1:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803ec5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ecc:	f6 c1 01             	test   $0x1,%cl
+  803ecf:	0f 84 b2 00 00 00    	je     803f87 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ed5:	48 89 f9             	mov    %rdi,%rcx
+  803ed8:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803edc:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ee3:	7f 00 00 
+  803ee6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803eea:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ef1:	40 f6 c6 01          	test   $0x1,%sil
+  803ef5:	0f 84 8c 00 00 00    	je     803f87 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803efb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f02:	7f 00 00 
+  803f05:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f09:	a8 80                	test   $0x80,%al
+  803f0b:	75 7b                	jne    803f88 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f0d:	48 89 f9             	mov    %rdi,%rcx
+  803f10:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f14:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f1b:	7f 00 00 
+  803f1e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f22:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f29:	40 f6 c6 01          	test   $0x1,%sil
+  803f2d:	74 58                	je     803f87 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f2f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f36:	7f 00 00 
+  803f39:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f3d:	a8 80                	test   $0x80,%al
+  803f3f:	75 6c                	jne    803fad <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f41:	48 89 f9             	mov    %rdi,%rcx
+  803f44:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f48:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f4f:	7f 00 00 
+  803f52:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f56:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f5d:	40 f6 c6 01          	test   $0x1,%sil
+  803f61:	74 24                	je     803f87 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f63:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f6a:	7f 00 00 
+  803f6d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f71:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f78:	ff ff 7f 
+  803f7b:	48 21 c8             	and    %rcx,%rax
+  803f7e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f84:	48 09 d0             	or     %rdx,%rax
+}
+  803f87:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f88:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f8f:	7f 00 00 
+  803f92:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f96:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f9d:	ff ff 7f 
+  803fa0:	48 21 c8             	and    %rcx,%rax
+  803fa3:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803fa9:	48 01 d0             	add    %rdx,%rax
+  803fac:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fad:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fb4:	7f 00 00 
+  803fb7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fbb:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fc2:	ff ff 7f 
+  803fc5:	48 21 c8             	and    %rcx,%rax
+  803fc8:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fce:	48 01 d0             	add    %rdx,%rax
+  803fd1:	c3                   	ret
+
+0000000000803fd2 <get_prot>:
+
+int
+get_prot(void *va) {
+  803fd2:	55                   	push   %rbp
+  803fd3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fd6:	48 b8 f9 3d 80 00 00 	movabs $0x803df9,%rax
+  803fdd:	00 00 00 
+  803fe0:	ff d0                	call   *%rax
+  803fe2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803fe5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803fea:	89 c1                	mov    %eax,%ecx
+  803fec:	83 c9 04             	or     $0x4,%ecx
+  803fef:	f6 c2 01             	test   $0x1,%dl
+  803ff2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ff5:	89 c1                	mov    %eax,%ecx
+  803ff7:	83 c9 02             	or     $0x2,%ecx
+  803ffa:	f6 c2 02             	test   $0x2,%dl
+  803ffd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804000:	89 c1                	mov    %eax,%ecx
+  804002:	83 c9 01             	or     $0x1,%ecx
+  804005:	48 85 d2             	test   %rdx,%rdx
+  804008:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80400b:	89 c1                	mov    %eax,%ecx
+  80400d:	83 c9 40             	or     $0x40,%ecx
+  804010:	f6 c6 04             	test   $0x4,%dh
+  804013:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804016:	5d                   	pop    %rbp
+  804017:	c3                   	ret
+
+0000000000804018 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804018:	55                   	push   %rbp
+  804019:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80401c:	48 b8 f9 3d 80 00 00 	movabs $0x803df9,%rax
+  804023:	00 00 00 
+  804026:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804028:	48 c1 e8 06          	shr    $0x6,%rax
+  80402c:	83 e0 01             	and    $0x1,%eax
+}
+  80402f:	5d                   	pop    %rbp
+  804030:	c3                   	ret
+
+0000000000804031 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804031:	55                   	push   %rbp
+  804032:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804035:	48 b8 f9 3d 80 00 00 	movabs $0x803df9,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+  804041:	83 e0 01             	and    $0x1,%eax
+}
+  804044:	5d                   	pop    %rbp
+  804045:	c3                   	ret
+
+0000000000804046 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804046:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80404d:	7f 00 00 
+  804050:	a8 01                	test   $0x1,%al
+  804052:	75 06                	jne    80405a <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804054:	b8 00 00 00 00       	mov    $0x0,%eax
+  804059:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	41 57                	push   %r15
+  804060:	41 56                	push   %r14
+  804062:	41 55                	push   %r13
+  804064:	41 54                	push   %r12
+  804066:	53                   	push   %rbx
+  804067:	48 83 ec 18          	sub    $0x18,%rsp
+  80406b:	49 89 fe             	mov    %rdi,%r14
+  80406e:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804071:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804078:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804079:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804080:	7f 00 00 
+  804083:	e9 81 00 00 00       	jmp    804109 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804088:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80408f:	49 39 dd             	cmp    %rbx,%r13
+  804092:	74 2b                	je     8040bf <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804094:	48 89 d8             	mov    %rbx,%rax
+  804097:	48 c1 e8 0c          	shr    $0xc,%rax
+  80409b:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80409f:	f6 c2 01             	test   $0x1,%dl
+  8040a2:	74 e4                	je     804088 <foreach_shared_region+0x42>
+  8040a4:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8040a8:	f6 c4 04             	test   $0x4,%ah
+  8040ab:	74 db                	je     804088 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040ad:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040b4:	4c 89 fa             	mov    %r15,%rdx
+  8040b7:	48 89 df             	mov    %rbx,%rdi
+  8040ba:	41 ff d6             	call   *%r14
+  8040bd:	eb c9                	jmp    804088 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040bf:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8040c6:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8040ca:	74 22                	je     8040ee <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8040cc:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8040d3:	48 89 d8             	mov    %rbx,%rax
+  8040d6:	48 c1 e8 15          	shr    $0x15,%rax
+  8040da:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8040e1:	7f 00 00 
+  8040e4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040e8:	a8 01                	test   $0x1,%al
+  8040ea:	74 d3                	je     8040bf <foreach_shared_region+0x79>
+  8040ec:	eb a6                	jmp    804094 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8040ee:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8040f5:	40 
+  8040f6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8040fa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804101:	00 00 00 
+  804104:	48 39 c1             	cmp    %rax,%rcx
+  804107:	74 31                	je     80413a <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804109:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80410d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804111:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804118:	7f 00 00 
+  80411b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80411f:	a8 01                	test   $0x1,%al
+  804121:	74 cb                	je     8040ee <foreach_shared_region+0xa8>
+  804123:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804127:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80412e:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804134:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804138:	eb 92                	jmp    8040cc <foreach_shared_region+0x86>
+}
+  80413a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413f:	48 83 c4 18          	add    $0x18,%rsp
+  804143:	5b                   	pop    %rbx
+  804144:	41 5c                	pop    %r12
+  804146:	41 5d                	pop    %r13
+  804148:	41 5e                	pop    %r14
+  80414a:	41 5f                	pop    %r15
+  80414c:	5d                   	pop    %rbp
+  80414d:	c3                   	ret
+
+000000000080414e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80414e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804153:	c3                   	ret
+
+0000000000804154 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804154:	55                   	push   %rbp
+  804155:	48 89 e5             	mov    %rsp,%rbp
+  804158:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80415b:	48 be f4 57 80 00 00 	movabs $0x8057f4,%rsi
+  804162:	00 00 00 
+  804165:	48 b8 6c 0e 80 00 00 	movabs $0x800e6c,%rax
+  80416c:	00 00 00 
+  80416f:	ff d0                	call   *%rax
+    return 0;
+}
+  804171:	b8 00 00 00 00       	mov    $0x0,%eax
+  804176:	5d                   	pop    %rbp
+  804177:	c3                   	ret
+
+0000000000804178 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804178:	55                   	push   %rbp
+  804179:	48 89 e5             	mov    %rsp,%rbp
+  80417c:	41 57                	push   %r15
+  80417e:	41 56                	push   %r14
+  804180:	41 55                	push   %r13
+  804182:	41 54                	push   %r12
+  804184:	53                   	push   %rbx
+  804185:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80418c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804193:	48 85 d2             	test   %rdx,%rdx
+  804196:	74 7a                	je     804212 <devcons_write+0x9a>
+  804198:	49 89 d6             	mov    %rdx,%r14
+  80419b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041a1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041a6:	49 bf fa 11 80 00 00 	movabs $0x8011fa,%r15
+  8041ad:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041b0:	4c 89 f3             	mov    %r14,%rbx
+  8041b3:	48 29 f3             	sub    %rsi,%rbx
+  8041b6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041bb:	48 39 c3             	cmp    %rax,%rbx
+  8041be:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041c2:	4c 63 eb             	movslq %ebx,%r13
+  8041c5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041cc:	48 01 c6             	add    %rax,%rsi
+  8041cf:	4c 89 ea             	mov    %r13,%rdx
+  8041d2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041d9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041dc:	4c 89 ee             	mov    %r13,%rsi
+  8041df:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041e6:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  8041ed:	00 00 00 
+  8041f0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041f2:	41 01 dc             	add    %ebx,%r12d
+  8041f5:	49 63 f4             	movslq %r12d,%rsi
+  8041f8:	4c 39 f6             	cmp    %r14,%rsi
+  8041fb:	72 b3                	jb     8041b0 <devcons_write+0x38>
+    return res;
+  8041fd:	49 63 c4             	movslq %r12d,%rax
+}
+  804200:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804207:	5b                   	pop    %rbx
+  804208:	41 5c                	pop    %r12
+  80420a:	41 5d                	pop    %r13
+  80420c:	41 5e                	pop    %r14
+  80420e:	41 5f                	pop    %r15
+  804210:	5d                   	pop    %rbp
+  804211:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804212:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804218:	eb e3                	jmp    8041fd <devcons_write+0x85>
+
+000000000080421a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80421a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80421d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804222:	48 85 c0             	test   %rax,%rax
+  804225:	74 55                	je     80427c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804227:	55                   	push   %rbp
+  804228:	48 89 e5             	mov    %rsp,%rbp
+  80422b:	41 55                	push   %r13
+  80422d:	41 54                	push   %r12
+  80422f:	53                   	push   %rbx
+  804230:	48 83 ec 08          	sub    $0x8,%rsp
+  804234:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804237:	48 bb 70 14 80 00 00 	movabs $0x801470,%rbx
+  80423e:	00 00 00 
+  804241:	49 bc 3d 15 80 00 00 	movabs $0x80153d,%r12
+  804248:	00 00 00 
+  80424b:	eb 03                	jmp    804250 <devcons_read+0x36>
+  80424d:	41 ff d4             	call   *%r12
+  804250:	ff d3                	call   *%rbx
+  804252:	85 c0                	test   %eax,%eax
+  804254:	74 f7                	je     80424d <devcons_read+0x33>
+    if (c < 0) return c;
+  804256:	48 63 d0             	movslq %eax,%rdx
+  804259:	78 13                	js     80426e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80425b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804260:	83 f8 04             	cmp    $0x4,%eax
+  804263:	74 09                	je     80426e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804265:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804269:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80426e:	48 89 d0             	mov    %rdx,%rax
+  804271:	48 83 c4 08          	add    $0x8,%rsp
+  804275:	5b                   	pop    %rbx
+  804276:	41 5c                	pop    %r12
+  804278:	41 5d                	pop    %r13
+  80427a:	5d                   	pop    %rbp
+  80427b:	c3                   	ret
+  80427c:	48 89 d0             	mov    %rdx,%rax
+  80427f:	c3                   	ret
+
+0000000000804280 <cputchar>:
+cputchar(int ch) {
+  804280:	55                   	push   %rbp
+  804281:	48 89 e5             	mov    %rsp,%rbp
+  804284:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804288:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80428c:	be 01 00 00 00       	mov    $0x1,%esi
+  804291:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804295:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+}
+  8042a1:	c9                   	leave
+  8042a2:	c3                   	ret
+
+00000000008042a3 <getchar>:
+getchar(void) {
+  8042a3:	55                   	push   %rbp
+  8042a4:	48 89 e5             	mov    %rsp,%rbp
+  8042a7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042ab:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042b0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b9:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  8042c0:	00 00 00 
+  8042c3:	ff d0                	call   *%rax
+  8042c5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042c7:	85 c0                	test   %eax,%eax
+  8042c9:	78 06                	js     8042d1 <getchar+0x2e>
+  8042cb:	74 08                	je     8042d5 <getchar+0x32>
+  8042cd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042d1:	89 d0                	mov    %edx,%eax
+  8042d3:	c9                   	leave
+  8042d4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042d5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042da:	eb f5                	jmp    8042d1 <getchar+0x2e>
+
+00000000008042dc <iscons>:
+iscons(int fdnum) {
+  8042dc:	55                   	push   %rbp
+  8042dd:	48 89 e5             	mov    %rsp,%rbp
+  8042e0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042e8:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	78 18                	js     804310 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042fc:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804303:	00 00 00 
+  804306:	8b 00                	mov    (%rax),%eax
+  804308:	39 02                	cmp    %eax,(%rdx)
+  80430a:	0f 94 c0             	sete   %al
+  80430d:	0f b6 c0             	movzbl %al,%eax
+}
+  804310:	c9                   	leave
+  804311:	c3                   	ret
+
+0000000000804312 <opencons>:
+opencons(void) {
+  804312:	55                   	push   %rbp
+  804313:	48 89 e5             	mov    %rsp,%rbp
+  804316:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80431a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80431e:	48 b8 1e 21 80 00 00 	movabs $0x80211e,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+  80432a:	85 c0                	test   %eax,%eax
+  80432c:	78 49                	js     804377 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80432e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804333:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804338:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80433c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804341:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  804348:	00 00 00 
+  80434b:	ff d0                	call   *%rax
+  80434d:	85 c0                	test   %eax,%eax
+  80434f:	78 26                	js     804377 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804351:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804355:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80435c:	00 00 
+  80435e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804360:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804364:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80436b:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  804372:	00 00 00 
+  804375:	ff d0                	call   *%rax
+}
+  804377:	c9                   	leave
+  804378:	c3                   	ret
+
+0000000000804379 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804379:	55                   	push   %rbp
+  80437a:	48 89 e5             	mov    %rsp,%rbp
+  80437d:	41 55                	push   %r13
+  80437f:	41 54                	push   %r12
+  804381:	53                   	push   %rbx
+  804382:	48 83 ec 08          	sub    $0x8,%rsp
+  804386:	49 89 fc             	mov    %rdi,%r12
+  804389:	48 89 f7             	mov    %rsi,%rdi
+  80438c:	48 89 d3             	mov    %rdx,%rbx
+  80438f:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804392:	48 85 f6             	test   %rsi,%rsi
+  804395:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80439c:	00 00 00 
+  80439f:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8043a3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043a8:	48 85 d2             	test   %rdx,%rdx
+  8043ab:	74 03                	je     8043b0 <ipc_recv+0x37>
+  8043ad:	48 8b 32             	mov    (%rdx),%rsi
+  8043b0:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+    if (errno) {
+  8043bc:	85 c0                	test   %eax,%eax
+  8043be:	74 1c                	je     8043dc <ipc_recv+0x63>
+        if (from_env_store)
+  8043c0:	4d 85 e4             	test   %r12,%r12
+  8043c3:	74 08                	je     8043cd <ipc_recv+0x54>
+            *from_env_store = 0;
+  8043c5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8043cc:	00 
+
+        if (perm_store)
+  8043cd:	4d 85 ed             	test   %r13,%r13
+  8043d0:	74 74                	je     804446 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8043d2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8043d9:	00 
+  8043da:	eb 6a                	jmp    804446 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8043dc:	4d 85 e4             	test   %r12,%r12
+  8043df:	74 14                	je     8043f5 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8043e1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043e8:	00 00 00 
+  8043eb:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8043f1:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8043f5:	48 85 db             	test   %rbx,%rbx
+  8043f8:	74 23                	je     80441d <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8043fa:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804401:	00 00 00 
+  804404:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80440a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440f:	85 c9                	test   %ecx,%ecx
+  804411:	74 07                	je     80441a <ipc_recv+0xa1>
+  804413:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80441a:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80441d:	4d 85 ed             	test   %r13,%r13
+  804420:	74 14                	je     804436 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804422:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804429:	00 00 00 
+  80442c:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804432:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804436:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80443d:	00 00 00 
+  804440:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804446:	48 83 c4 08          	add    $0x8,%rsp
+  80444a:	5b                   	pop    %rbx
+  80444b:	41 5c                	pop    %r12
+  80444d:	41 5d                	pop    %r13
+  80444f:	5d                   	pop    %rbp
+  804450:	c3                   	ret
+
+0000000000804451 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804451:	55                   	push   %rbp
+  804452:	48 89 e5             	mov    %rsp,%rbp
+  804455:	41 55                	push   %r13
+  804457:	41 54                	push   %r12
+  804459:	53                   	push   %rbx
+  80445a:	48 83 ec 08          	sub    $0x8,%rsp
+  80445e:	49 89 fc             	mov    %rdi,%r12
+  804461:	48 89 f7             	mov    %rsi,%rdi
+  804464:	48 89 d3             	mov    %rdx,%rbx
+  804467:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80446a:	48 85 f6             	test   %rsi,%rsi
+  80446d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804474:	00 00 00 
+  804477:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80447b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804480:	48 85 d2             	test   %rdx,%rdx
+  804483:	74 03                	je     804488 <ipc_try_recv+0x37>
+  804485:	48 8b 32             	mov    (%rdx),%rsi
+  804488:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  80448f:	00 00 00 
+  804492:	ff d0                	call   *%rax
+    if (errno) {
+  804494:	85 c0                	test   %eax,%eax
+  804496:	75 75                	jne    80450d <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804498:	4d 85 e4             	test   %r12,%r12
+  80449b:	74 14                	je     8044b1 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80449d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044a4:	00 00 00 
+  8044a7:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044ad:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8044b1:	48 85 db             	test   %rbx,%rbx
+  8044b4:	74 23                	je     8044d9 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044b6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044bd:	00 00 00 
+  8044c0:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044cb:	85 c9                	test   %ecx,%ecx
+  8044cd:	74 07                	je     8044d6 <ipc_try_recv+0x85>
+  8044cf:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044d6:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8044d9:	4d 85 ed             	test   %r13,%r13
+  8044dc:	74 14                	je     8044f2 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8044de:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044e5:	00 00 00 
+  8044e8:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044ee:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8044f2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044f9:	00 00 00 
+  8044fc:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804502:	48 83 c4 08          	add    $0x8,%rsp
+  804506:	5b                   	pop    %rbx
+  804507:	41 5c                	pop    %r12
+  804509:	41 5d                	pop    %r13
+  80450b:	5d                   	pop    %rbp
+  80450c:	c3                   	ret
+        if (from_env_store)
+  80450d:	4d 85 e4             	test   %r12,%r12
+  804510:	74 08                	je     80451a <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804512:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804519:	00 
+        if (perm_store)
+  80451a:	4d 85 ed             	test   %r13,%r13
+  80451d:	74 e3                	je     804502 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80451f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804526:	00 
+  804527:	eb d9                	jmp    804502 <ipc_try_recv+0xb1>
+
+0000000000804529 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804529:	55                   	push   %rbp
+  80452a:	48 89 e5             	mov    %rsp,%rbp
+  80452d:	41 57                	push   %r15
+  80452f:	41 56                	push   %r14
+  804531:	41 55                	push   %r13
+  804533:	41 54                	push   %r12
+  804535:	53                   	push   %rbx
+  804536:	48 83 ec 18          	sub    $0x18,%rsp
+  80453a:	41 89 fd             	mov    %edi,%r13d
+  80453d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804540:	48 89 d3             	mov    %rdx,%rbx
+  804543:	49 89 cc             	mov    %rcx,%r12
+  804546:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80454a:	48 85 d2             	test   %rdx,%rdx
+  80454d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804554:	00 00 00 
+  804557:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80455b:	49 be 4d 19 80 00 00 	movabs $0x80194d,%r14
+  804562:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804565:	49 bf 3d 15 80 00 00 	movabs $0x80153d,%r15
+  80456c:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80456f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804572:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804576:	4c 89 e1             	mov    %r12,%rcx
+  804579:	48 89 da             	mov    %rbx,%rdx
+  80457c:	44 89 ef             	mov    %r13d,%edi
+  80457f:	41 ff d6             	call   *%r14
+  804582:	85 c0                	test   %eax,%eax
+  804584:	74 37                	je     8045bd <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804586:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804589:	75 05                	jne    804590 <ipc_send+0x67>
+        sys_yield();
+  80458b:	41 ff d7             	call   *%r15
+  80458e:	eb df                	jmp    80456f <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804590:	89 c1                	mov    %eax,%ecx
+  804592:	48 ba 00 58 80 00 00 	movabs $0x805800,%rdx
+  804599:	00 00 00 
+  80459c:	be 65 00 00 00       	mov    $0x65,%esi
+  8045a1:	48 bf 1b 58 80 00 00 	movabs $0x80581b,%rdi
+  8045a8:	00 00 00 
+  8045ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b0:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  8045b7:	00 00 00 
+  8045ba:	41 ff d0             	call   *%r8
+    }
+}
+  8045bd:	48 83 c4 18          	add    $0x18,%rsp
+  8045c1:	5b                   	pop    %rbx
+  8045c2:	41 5c                	pop    %r12
+  8045c4:	41 5d                	pop    %r13
+  8045c6:	41 5e                	pop    %r14
+  8045c8:	41 5f                	pop    %r15
+  8045ca:	5d                   	pop    %rbp
+  8045cb:	c3                   	ret
+
+00000000008045cc <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8045cc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8045d1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8045d8:	00 00 00 
+  8045db:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8045e2:	48 01 ca             	add    %rcx,%rdx
+  8045e5:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8045eb:	39 fa                	cmp    %edi,%edx
+  8045ed:	74 12                	je     804601 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8045ef:	48 83 c0 01          	add    $0x1,%rax
+  8045f3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8045f9:	75 e0                	jne    8045db <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8045fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804600:	c3                   	ret
+            return envs[i].env_id;
+  804601:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804608:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80460f:	00 00 00 
+  804612:	48 01 d0             	add    %rdx,%rax
+  804615:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80461b:	c3                   	ret
+
+000000000080461c <__text_end>:
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8467 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 1f 46 80 00 00 	movabs $0x80461f,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be 06 50 80 00 00 	movabs $0x805006,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf 3c 50 80 00 00 	movabs $0x80503c,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba 57 50 80 00 00 	movabs $0x805057,%rdx
+  800117:	00 00 00 
+  80011a:	48 be 5c 50 80 00 00 	movabs $0x80505c,%rsi
+  800121:	00 00 00 
+  800124:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 24 40 80 00 00 	movabs $0x804024,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 1f 46 80 00 00 	movabs $0x80461f,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be 06 50 80 00 00 	movabs $0x805006,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf 73 50 80 00 00 	movabs $0x805073,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba 0c 50 80 00 00 	movabs $0x80500c,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba 33 50 80 00 00 	movabs $0x805033,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba 69 50 80 00 00 	movabs $0x805069,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	41 89 fd             	mov    %edi,%r13d
+  800285:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800288:	48 ba f8 60 80 00 00 	movabs $0x8060f8,%rdx
+  80028f:	00 00 00 
+  800292:	48 b8 f8 60 80 00 00 	movabs $0x8060f8,%rax
+  800299:	00 00 00 
+  80029c:	48 39 c2             	cmp    %rax,%rdx
+  80029f:	73 17                	jae    8002b8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a4:	49 89 c4             	mov    %rax,%r12
+  8002a7:	48 83 c3 08          	add    $0x8,%rbx
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b3:	4c 39 e3             	cmp    %r12,%rbx
+  8002b6:	72 ef                	jb     8002a7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8002b8:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c9:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8002d0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002d7:	00 00 00 
+  8002da:	48 01 d0             	add    %rdx,%rax
+  8002dd:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8002e4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002e7:	45 85 ed             	test   %r13d,%r13d
+  8002ea:	7e 0d                	jle    8002f9 <libmain+0x82>
+  8002ec:	49 8b 06             	mov    (%r14),%rax
+  8002ef:	48 a3 10 60 80 00 00 	movabs %rax,0x806010
+  8002f6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002f9:	4c 89 f6             	mov    %r14,%rsi
+  8002fc:	44 89 ef             	mov    %r13d,%edi
+  8002ff:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80030b:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800312:	00 00 00 
+  800315:	ff d0                	call   *%rax
+#endif
+}
+  800317:	5b                   	pop    %rbx
+  800318:	41 5c                	pop    %r12
+  80031a:	41 5d                	pop    %r13
+  80031c:	41 5e                	pop    %r14
+  80031e:	5d                   	pop    %rbp
+  80031f:	c3                   	ret
+
+0000000000800320 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800320:	55                   	push   %rbp
+  800321:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800324:	48 b8 b5 22 80 00 00 	movabs $0x8022b5,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800330:	bf 00 00 00 00       	mov    $0x0,%edi
+  800335:	48 b8 40 14 80 00 00 	movabs $0x801440,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+}
+  800341:	5d                   	pop    %rbp
+  800342:	c3                   	ret
+
+0000000000800343 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	41 56                	push   %r14
+  800349:	41 55                	push   %r13
+  80034b:	41 54                	push   %r12
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 50          	sub    $0x50,%rsp
+  800352:	49 89 fc             	mov    %rdi,%r12
+  800355:	41 89 f5             	mov    %esi,%r13d
+  800358:	48 89 d3             	mov    %rdx,%rbx
+  80035b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80035f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800363:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800367:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80036e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800372:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800376:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80037a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037e:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  800385:	00 00 00 
+  800388:	4c 8b 30             	mov    (%rax),%r14
+  80038b:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  800392:	00 00 00 
+  800395:	ff d0                	call   *%rax
+  800397:	89 c6                	mov    %eax,%esi
+  800399:	45 89 e8             	mov    %r13d,%r8d
+  80039c:	4c 89 e1             	mov    %r12,%rcx
+  80039f:	4c 89 f2             	mov    %r14,%rdx
+  8003a2:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8003a9:	00 00 00 
+  8003ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b1:	49 bc 93 04 80 00 00 	movabs $0x800493,%r12
+  8003b8:	00 00 00 
+  8003bb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003be:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c2:	48 89 df             	mov    %rbx,%rdi
+  8003c5:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  8003cc:	00 00 00 
+  8003cf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003d1:	48 bf 9d 50 80 00 00 	movabs $0x80509d,%rdi
+  8003d8:	00 00 00 
+  8003db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e3:	cc                   	int3
+  8003e4:	eb fd                	jmp    8003e3 <_panic+0xa0>
+
+00000000008003e6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003e6:	55                   	push   %rbp
+  8003e7:	48 89 e5             	mov    %rsp,%rbp
+  8003ea:	53                   	push   %rbx
+  8003eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ef:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f2:	8b 06                	mov    (%rsi),%eax
+  8003f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8003f7:	89 16                	mov    %edx,(%rsi)
+  8003f9:	48 98                	cltq
+  8003fb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800400:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800406:	74 0a                	je     800412 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800408:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80040c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800410:	c9                   	leave
+  800411:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800412:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800416:	be ff 00 00 00       	mov    $0xff,%esi
+  80041b:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  800422:	00 00 00 
+  800425:	ff d0                	call   *%rax
+        state->offset = 0;
+  800427:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80042d:	eb d9                	jmp    800408 <putch+0x22>
+
+000000000080042f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80043a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80043d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800444:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800451:	48 89 f1             	mov    %rsi,%rcx
+  800454:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80045b:	48 bf e6 03 80 00 00 	movabs $0x8003e6,%rdi
+  800462:	00 00 00 
+  800465:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800471:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800478:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80047f:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  800486:	00 00 00 
+  800489:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80048b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800491:	c9                   	leave
+  800492:	c3                   	ret
+
+0000000000800493 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800493:	55                   	push   %rbp
+  800494:	48 89 e5             	mov    %rsp,%rbp
+  800497:	48 83 ec 50          	sub    $0x50,%rsp
+  80049b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80049f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004af:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004c6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004ca:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  8004d1:	00 00 00 
+  8004d4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+
+00000000008004d8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004d8:	55                   	push   %rbp
+  8004d9:	48 89 e5             	mov    %rsp,%rbp
+  8004dc:	41 57                	push   %r15
+  8004de:	41 56                	push   %r14
+  8004e0:	41 55                	push   %r13
+  8004e2:	41 54                	push   %r12
+  8004e4:	53                   	push   %rbx
+  8004e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8004e9:	49 89 fc             	mov    %rdi,%r12
+  8004ec:	49 89 f5             	mov    %rsi,%r13
+  8004ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004f6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004f9:	41 89 cf             	mov    %ecx,%r15d
+  8004fc:	4c 39 fa             	cmp    %r15,%rdx
+  8004ff:	73 5b                	jae    80055c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800501:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800505:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800509:	85 db                	test   %ebx,%ebx
+  80050b:	7e 0e                	jle    80051b <print_num+0x43>
+            putch(padc, put_arg);
+  80050d:	4c 89 ee             	mov    %r13,%rsi
+  800510:	44 89 f7             	mov    %r14d,%edi
+  800513:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800516:	83 eb 01             	sub    $0x1,%ebx
+  800519:	75 f2                	jne    80050d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80051b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80051f:	48 b9 ec 50 80 00 00 	movabs $0x8050ec,%rcx
+  800526:	00 00 00 
+  800529:	48 b8 db 50 80 00 00 	movabs $0x8050db,%rax
+  800530:	00 00 00 
+  800533:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800537:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80053b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800540:	49 f7 f7             	div    %r15
+  800543:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800547:	4c 89 ee             	mov    %r13,%rsi
+  80054a:	41 ff d4             	call   *%r12
+}
+  80054d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800551:	5b                   	pop    %rbx
+  800552:	41 5c                	pop    %r12
+  800554:	41 5d                	pop    %r13
+  800556:	41 5e                	pop    %r14
+  800558:	41 5f                	pop    %r15
+  80055a:	5d                   	pop    %rbp
+  80055b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80055c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800560:	ba 00 00 00 00       	mov    $0x0,%edx
+  800565:	49 f7 f7             	div    %r15
+  800568:	48 83 ec 08          	sub    $0x8,%rsp
+  80056c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800570:	52                   	push   %rdx
+  800571:	45 0f be c9          	movsbl %r9b,%r9d
+  800575:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800579:	48 89 c2             	mov    %rax,%rdx
+  80057c:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800583:	00 00 00 
+  800586:	ff d0                	call   *%rax
+  800588:	48 83 c4 10          	add    $0x10,%rsp
+  80058c:	eb 8d                	jmp    80051b <print_num+0x43>
+
+000000000080058e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80058e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800592:	48 8b 06             	mov    (%rsi),%rax
+  800595:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800599:	73 0a                	jae    8005a5 <sprintputch+0x17>
+        *state->start++ = ch;
+  80059b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80059f:	48 89 16             	mov    %rdx,(%rsi)
+  8005a2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005a5:	c3                   	ret
+
+00000000008005a6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8005ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005ba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005d1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d5:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  8005dc:	00 00 00 
+  8005df:	ff d0                	call   *%rax
+}
+  8005e1:	c9                   	leave
+  8005e2:	c3                   	ret
+
+00000000008005e3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e3:	55                   	push   %rbp
+  8005e4:	48 89 e5             	mov    %rsp,%rbp
+  8005e7:	41 57                	push   %r15
+  8005e9:	41 56                	push   %r14
+  8005eb:	41 55                	push   %r13
+  8005ed:	41 54                	push   %r12
+  8005ef:	53                   	push   %rbx
+  8005f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f4:	49 89 fe             	mov    %rdi,%r14
+  8005f7:	49 89 f5             	mov    %rsi,%r13
+  8005fa:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005fd:	48 8b 01             	mov    (%rcx),%rax
+  800600:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800604:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800608:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800610:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800614:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800618:	0f b6 3b             	movzbl (%rbx),%edi
+  80061b:	40 80 ff 25          	cmp    $0x25,%dil
+  80061f:	74 18                	je     800639 <vprintfmt+0x56>
+            if (!ch) return;
+  800621:	40 84 ff             	test   %dil,%dil
+  800624:	0f 84 04 07 00 00    	je     800d2e <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80062a:	40 0f b6 ff          	movzbl %dil,%edi
+  80062e:	4c 89 ee             	mov    %r13,%rsi
+  800631:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800634:	4c 89 e3             	mov    %r12,%rbx
+  800637:	eb db                	jmp    800614 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800639:	be 00 00 00 00       	mov    $0x0,%esi
+  80063e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800642:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800647:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800654:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800658:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80065d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800662:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800665:	83 e8 23             	sub    $0x23,%eax
+  800668:	3c 57                	cmp    $0x57,%al
+  80066a:	0f 87 a4 06 00 00    	ja     800d14 <vprintfmt+0x731>
+  800670:	0f b6 c0             	movzbl %al,%eax
+  800673:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  80067a:	00 00 00 
+  80067d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800680:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800683:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800687:	eb cf                	jmp    800658 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800689:	49 89 dc             	mov    %rbx,%r12
+  80068c:	be 01 00 00 00       	mov    $0x1,%esi
+  800691:	eb c5                	jmp    800658 <vprintfmt+0x75>
+            padc = ch;
+  800693:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800697:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80069a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069d:	eb b9                	jmp    800658 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80069f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a5:	77 24                	ja     8006cb <vprintfmt+0xe8>
+  8006a7:	89 c1                	mov    %eax,%ecx
+  8006a9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006ad:	83 c0 08             	add    $0x8,%eax
+  8006b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006b6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006b9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bd:	79 99                	jns    800658 <vprintfmt+0x75>
+                width = precision;
+  8006bf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c9:	eb 8d                	jmp    800658 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006cf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d7:	eb da                	jmp    8006b3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006d9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006de:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006e8:	3c 39                	cmp    $0x39,%al
+  8006ea:	77 1c                	ja     800708 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006ec:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006f0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f4:	0f b6 c0             	movzbl %al,%eax
+  8006f7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006fc:	0f b6 03             	movzbl (%rbx),%eax
+  8006ff:	3c 39                	cmp    $0x39,%al
+  800701:	76 e9                	jbe    8006ec <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800703:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800706:	eb b1                	jmp    8006b9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800708:	49 89 dc             	mov    %rbx,%r12
+  80070b:	eb ac                	jmp    8006b9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80070d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800710:	85 c9                	test   %ecx,%ecx
+  800712:	b8 00 00 00 00       	mov    $0x0,%eax
+  800717:	0f 49 c1             	cmovns %ecx,%eax
+  80071a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80071d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800720:	e9 33 ff ff ff       	jmp    800658 <vprintfmt+0x75>
+            lflag++;
+  800725:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800728:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80072b:	e9 28 ff ff ff       	jmp    800658 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 19                	ja     800751 <vprintfmt+0x16e>
+  800738:	89 c2                	mov    %eax,%edx
+  80073a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073e:	83 c0 08             	add    $0x8,%eax
+  800741:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800744:	8b 3a                	mov    (%rdx),%edi
+  800746:	4c 89 ee             	mov    %r13,%rsi
+  800749:	41 ff d6             	call   *%r14
+            break;
+  80074c:	e9 c3 fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800751:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800755:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800759:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075d:	eb e5                	jmp    800744 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80075f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	77 5a                	ja     8007c1 <vprintfmt+0x1de>
+  800767:	89 c2                	mov    %eax,%edx
+  800769:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076d:	83 c0 08             	add    $0x8,%eax
+  800770:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800773:	8b 02                	mov    (%rdx),%eax
+  800775:	89 c1                	mov    %eax,%ecx
+  800777:	f7 d9                	neg    %ecx
+  800779:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80077c:	83 f9 13             	cmp    $0x13,%ecx
+  80077f:	7f 4e                	jg     8007cf <vprintfmt+0x1ec>
+  800781:	48 63 c1             	movslq %ecx,%rax
+  800784:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80078b:	00 00 00 
+  80078e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800792:	48 85 c0             	test   %rax,%rax
+  800795:	74 38                	je     8007cf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800797:	48 89 c1             	mov    %rax,%rcx
+  80079a:	48 ba 0c 58 80 00 00 	movabs $0x80580c,%rdx
+  8007a1:	00 00 00 
+  8007a4:	4c 89 ee             	mov    %r13,%rsi
+  8007a7:	4c 89 f7             	mov    %r14,%rdi
+  8007aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007af:	49 b8 a6 05 80 00 00 	movabs $0x8005a6,%r8
+  8007b6:	00 00 00 
+  8007b9:	41 ff d0             	call   *%r8
+  8007bc:	e9 53 fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cd:	eb a4                	jmp    800773 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007cf:	48 ba 04 51 80 00 00 	movabs $0x805104,%rdx
+  8007d6:	00 00 00 
+  8007d9:	4c 89 ee             	mov    %r13,%rsi
+  8007dc:	4c 89 f7             	mov    %r14,%rdi
+  8007df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e4:	49 b8 a6 05 80 00 00 	movabs $0x8005a6,%r8
+  8007eb:	00 00 00 
+  8007ee:	41 ff d0             	call   *%r8
+  8007f1:	e9 1e fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fc:	77 36                	ja     800834 <vprintfmt+0x251>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80080d:	48 85 f6             	test   %rsi,%rsi
+  800810:	48 b8 fd 50 80 00 00 	movabs $0x8050fd,%rax
+  800817:	00 00 00 
+  80081a:	48 0f 45 c6          	cmovne %rsi,%rax
+  80081e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800822:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800826:	7e 06                	jle    80082e <vprintfmt+0x24b>
+  800828:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80082c:	75 14                	jne    800842 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80082e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800832:	eb 5b                	jmp    80088f <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800834:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800838:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800840:	eb c8                	jmp    80080a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800842:	49 63 f7             	movslq %r15d,%rsi
+  800845:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800849:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800850:	00 00 00 
+  800853:	ff d0                	call   *%rax
+  800855:	48 89 c2             	mov    %rax,%rdx
+  800858:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80085b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80085d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800860:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800863:	85 c0                	test   %eax,%eax
+  800865:	7e c7                	jle    80082e <vprintfmt+0x24b>
+  800867:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80086c:	4c 89 ee             	mov    %r13,%rsi
+  80086f:	44 89 e7             	mov    %r12d,%edi
+  800872:	41 ff d6             	call   *%r14
+  800875:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800879:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80087f:	75 eb                	jne    80086c <vprintfmt+0x289>
+  800881:	eb ab                	jmp    80082e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800883:	0f b6 f8             	movzbl %al,%edi
+  800886:	4c 89 ee             	mov    %r13,%rsi
+  800889:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80088c:	4c 89 e2             	mov    %r12,%rdx
+  80088f:	45 85 ff             	test   %r15d,%r15d
+  800892:	78 06                	js     80089a <vprintfmt+0x2b7>
+  800894:	41 83 ef 01          	sub    $0x1,%r15d
+  800898:	78 23                	js     8008bd <vprintfmt+0x2da>
+  80089a:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80089e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008a4:	84 c0                	test   %al,%al
+  8008a6:	74 15                	je     8008bd <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008a8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008ac:	74 d5                	je     800883 <vprintfmt+0x2a0>
+  8008ae:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008b1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008b6:	80 fa 5e             	cmp    $0x5e,%dl
+  8008b9:	77 cb                	ja     800886 <vprintfmt+0x2a3>
+  8008bb:	eb c6                	jmp    800883 <vprintfmt+0x2a0>
+  8008bd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008c0:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8008c3:	01 f0                	add    %esi,%eax
+  8008c5:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8008c7:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008cb:	85 c0                	test   %eax,%eax
+  8008cd:	0f 8e 41 fd ff ff    	jle    800614 <vprintfmt+0x31>
+  8008d3:	4c 89 ee             	mov    %r13,%rsi
+  8008d6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008db:	41 ff d6             	call   *%r14
+  8008de:	41 83 ec 01          	sub    $0x1,%r12d
+  8008e2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008e6:	75 eb                	jne    8008d3 <vprintfmt+0x2f0>
+  8008e8:	e9 27 fd ff ff       	jmp    800614 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ed:	40 84 f6             	test   %sil,%sil
+  8008f0:	75 26                	jne    800918 <vprintfmt+0x335>
+    switch (lflag) {
+  8008f2:	85 d2                	test   %edx,%edx
+  8008f4:	74 59                	je     80094f <vprintfmt+0x36c>
+  8008f6:	83 fa 01             	cmp    $0x1,%edx
+  8008f9:	74 7b                	je     800976 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	0f 87 96 00 00 00    	ja     80099d <vprintfmt+0x3ba>
+  800907:	89 c2                	mov    %eax,%edx
+  800909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090d:	83 c0 08             	add    $0x8,%eax
+  800910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800913:	4c 8b 22             	mov    (%rdx),%r12
+  800916:	eb 17                	jmp    80092f <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 21                	ja     800941 <vprintfmt+0x35e>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80092f:	4d 85 e4             	test   %r12,%r12
+  800932:	78 7a                	js     8009ae <vprintfmt+0x3cb>
+            num = i;
+  800934:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800937:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80093c:	e9 b5 02 00 00       	jmp    800bf6 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800941:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800945:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800949:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094d:	eb dd                	jmp    80092c <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80094f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800952:	83 f8 2f             	cmp    $0x2f,%eax
+  800955:	77 11                	ja     800968 <vprintfmt+0x385>
+  800957:	89 c2                	mov    %eax,%edx
+  800959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095d:	83 c0 08             	add    $0x8,%eax
+  800960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800963:	4c 63 22             	movslq (%rdx),%r12
+  800966:	eb c7                	jmp    80092f <vprintfmt+0x34c>
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb ed                	jmp    800963 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	77 11                	ja     80098f <vprintfmt+0x3ac>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	4c 8b 22             	mov    (%rdx),%r12
+  80098d:	eb a0                	jmp    80092f <vprintfmt+0x34c>
+  80098f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099b:	eb ed                	jmp    80098a <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80099d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a9:	e9 65 ff ff ff       	jmp    800913 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8009ae:	4c 89 ee             	mov    %r13,%rsi
+  8009b1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009b6:	41 ff d6             	call   *%r14
+                i = -i;
+  8009b9:	49 f7 dc             	neg    %r12
+  8009bc:	e9 73 ff ff ff       	jmp    800934 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c1:	40 84 f6             	test   %sil,%sil
+  8009c4:	75 32                	jne    8009f8 <vprintfmt+0x415>
+    switch (lflag) {
+  8009c6:	85 d2                	test   %edx,%edx
+  8009c8:	74 5d                	je     800a27 <vprintfmt+0x444>
+  8009ca:	83 fa 01             	cmp    $0x1,%edx
+  8009cd:	0f 84 82 00 00 00    	je     800a55 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	0f 87 a5 00 00 00    	ja     800a84 <vprintfmt+0x4a1>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f3:	e9 fe 01 00 00       	jmp    800bf6 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 19                	ja     800a19 <vprintfmt+0x436>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a14:	e9 dd 01 00 00       	jmp    800bf6 <vprintfmt+0x613>
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	eb e5                	jmp    800a0c <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 18                	ja     800a47 <vprintfmt+0x464>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a3d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a42:	e9 af 01 00 00       	jmp    800bf6 <vprintfmt+0x613>
+  800a47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a53:	eb e6                	jmp    800a3b <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a58:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5b:	77 19                	ja     800a76 <vprintfmt+0x493>
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a63:	83 c0 08             	add    $0x8,%eax
+  800a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a69:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a6c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a71:	e9 80 01 00 00       	jmp    800bf6 <vprintfmt+0x613>
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb e5                	jmp    800a69 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a90:	e9 56 ff ff ff       	jmp    8009eb <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800a95:	40 84 f6             	test   %sil,%sil
+  800a98:	75 2e                	jne    800ac8 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800a9a:	85 d2                	test   %edx,%edx
+  800a9c:	0f 84 b3 00 00 00    	je     800b55 <vprintfmt+0x572>
+  800aa2:	83 fa 01             	cmp    $0x1,%edx
+  800aa5:	0f 84 d3 00 00 00    	je     800b7e <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800aab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aae:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab1:	0f 87 f1 00 00 00    	ja     800ba8 <vprintfmt+0x5c5>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	48 8b 02             	mov    (%rdx),%rax
+  800ac6:	eb 17                	jmp    800adf <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ace:	77 77                	ja     800b47 <vprintfmt+0x564>
+  800ad0:	89 c2                	mov    %eax,%edx
+  800ad2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad6:	83 c0 08             	add    $0x8,%eax
+  800ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adc:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800adf:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800ae1:	83 f8 07             	cmp    $0x7,%eax
+  800ae4:	0f 8e cf 00 00 00    	jle    800bb9 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800aea:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800af0:	44 89 e7             	mov    %r12d,%edi
+  800af3:	41 c1 e4 03          	shl    $0x3,%r12d
+  800af7:	89 d1                	mov    %edx,%ecx
+  800af9:	8d 72 07             	lea    0x7(%rdx),%esi
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	0f 48 d6             	cmovs  %esi,%edx
+  800b01:	c1 fa 03             	sar    $0x3,%edx
+  800b04:	83 f9 3f             	cmp    $0x3f,%ecx
+  800b07:	7f e7                	jg     800af0 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800b09:	85 ff                	test   %edi,%edi
+  800b0b:	0f 84 03 fb ff ff    	je     800614 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800b11:	49 63 f4             	movslq %r12d,%rsi
+  800b14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b19:	48 f7 f6             	div    %rsi
+  800b1c:	49 89 d7             	mov    %rdx,%r15
+  800b1f:	83 c0 30             	add    $0x30,%eax
+  800b22:	0f be f8             	movsbl %al,%edi
+  800b25:	4c 89 ee             	mov    %r13,%rsi
+  800b28:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800b2b:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800b2e:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800b33:	45 85 e4             	test   %r12d,%r12d
+  800b36:	41 0f 49 d4          	cmovns %r12d,%edx
+  800b3a:	c1 fa 03             	sar    $0x3,%edx
+  800b3d:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800b40:	75 cf                	jne    800b11 <vprintfmt+0x52e>
+  800b42:	e9 cd fa ff ff       	jmp    800614 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	eb 87                	jmp    800adc <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 13                	ja     800b70 <vprintfmt+0x58d>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	8b 02                	mov    (%rdx),%eax
+  800b6b:	e9 6f ff ff ff       	jmp    800adf <vprintfmt+0x4fc>
+  800b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7c:	eb eb                	jmp    800b69 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800b7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b81:	83 f8 2f             	cmp    $0x2f,%eax
+  800b84:	77 14                	ja     800b9a <vprintfmt+0x5b7>
+  800b86:	89 c2                	mov    %eax,%edx
+  800b88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8c:	83 c0 08             	add    $0x8,%eax
+  800b8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b92:	48 8b 02             	mov    (%rdx),%rax
+  800b95:	e9 45 ff ff ff       	jmp    800adf <vprintfmt+0x4fc>
+  800b9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba6:	eb ea                	jmp    800b92 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800ba8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb4:	e9 0a ff ff ff       	jmp    800ac3 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800bb9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800bbf:	e9 4d ff ff ff       	jmp    800b11 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800bc4:	4c 89 ee             	mov    %r13,%rsi
+  800bc7:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bcc:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bcf:	4c 89 ee             	mov    %r13,%rsi
+  800bd2:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bd7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdd:	83 f8 2f             	cmp    $0x2f,%eax
+  800be0:	77 47                	ja     800c29 <vprintfmt+0x646>
+  800be2:	89 c2                	mov    %eax,%edx
+  800be4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be8:	83 c0 08             	add    $0x8,%eax
+  800beb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800bf6:	48 83 ec 08          	sub    $0x8,%rsp
+  800bfa:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bfe:	0f 94 c0             	sete   %al
+  800c01:	0f b6 c0             	movzbl %al,%eax
+  800c04:	50                   	push   %rax
+  800c05:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c0a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c0e:	4c 89 ee             	mov    %r13,%rsi
+  800c11:	4c 89 f7             	mov    %r14,%rdi
+  800c14:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800c1b:	00 00 00 
+  800c1e:	ff d0                	call   *%rax
+            break;
+  800c20:	48 83 c4 10          	add    $0x10,%rsp
+  800c24:	e9 eb f9 ff ff       	jmp    800614 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c35:	eb b7                	jmp    800bee <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800c37:	40 84 f6             	test   %sil,%sil
+  800c3a:	75 2b                	jne    800c67 <vprintfmt+0x684>
+    switch (lflag) {
+  800c3c:	85 d2                	test   %edx,%edx
+  800c3e:	74 56                	je     800c96 <vprintfmt+0x6b3>
+  800c40:	83 fa 01             	cmp    $0x1,%edx
+  800c43:	74 7f                	je     800cc4 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800c45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c48:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4b:	0f 87 a2 00 00 00    	ja     800cf3 <vprintfmt+0x710>
+  800c51:	89 c2                	mov    %eax,%edx
+  800c53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c57:	83 c0 08             	add    $0x8,%eax
+  800c5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c60:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c65:	eb 8f                	jmp    800bf6 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800c67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6d:	77 19                	ja     800c88 <vprintfmt+0x6a5>
+  800c6f:	89 c2                	mov    %eax,%edx
+  800c71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c75:	83 c0 08             	add    $0x8,%eax
+  800c78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c7e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c83:	e9 6e ff ff ff       	jmp    800bf6 <vprintfmt+0x613>
+  800c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c94:	eb e5                	jmp    800c7b <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800c96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c99:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9c:	77 18                	ja     800cb6 <vprintfmt+0x6d3>
+  800c9e:	89 c2                	mov    %eax,%edx
+  800ca0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca4:	83 c0 08             	add    $0x8,%eax
+  800ca7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800caa:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cac:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cb1:	e9 40 ff ff ff       	jmp    800bf6 <vprintfmt+0x613>
+  800cb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc2:	eb e6                	jmp    800caa <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800cc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cca:	77 19                	ja     800ce5 <vprintfmt+0x702>
+  800ccc:	89 c2                	mov    %eax,%edx
+  800cce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd2:	83 c0 08             	add    $0x8,%eax
+  800cd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cdb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ce0:	e9 11 ff ff ff       	jmp    800bf6 <vprintfmt+0x613>
+  800ce5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ced:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf1:	eb e5                	jmp    800cd8 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800cf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cff:	e9 59 ff ff ff       	jmp    800c5d <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800d04:	4c 89 ee             	mov    %r13,%rsi
+  800d07:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d0c:	41 ff d6             	call   *%r14
+            break;
+  800d0f:	e9 00 f9 ff ff       	jmp    800614 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d14:	4c 89 ee             	mov    %r13,%rsi
+  800d17:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d1c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d1f:	48 83 eb 01          	sub    $0x1,%rbx
+  800d23:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d27:	75 f6                	jne    800d1f <vprintfmt+0x73c>
+  800d29:	e9 e6 f8 ff ff       	jmp    800614 <vprintfmt+0x31>
+}
+  800d2e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d32:	5b                   	pop    %rbx
+  800d33:	41 5c                	pop    %r12
+  800d35:	41 5d                	pop    %r13
+  800d37:	41 5e                	pop    %r14
+  800d39:	41 5f                	pop    %r15
+  800d3b:	5d                   	pop    %rbp
+  800d3c:	c3                   	ret
+
+0000000000800d3d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d3d:	55                   	push   %rbp
+  800d3e:	48 89 e5             	mov    %rsp,%rbp
+  800d41:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d49:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d4e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d52:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d59:	48 85 ff             	test   %rdi,%rdi
+  800d5c:	74 2b                	je     800d89 <vsnprintf+0x4c>
+  800d5e:	48 85 f6             	test   %rsi,%rsi
+  800d61:	74 26                	je     800d89 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d63:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d67:	48 bf 8e 05 80 00 00 	movabs $0x80058e,%rdi
+  800d6e:	00 00 00 
+  800d71:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  800d78:	00 00 00 
+  800d7b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d81:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d84:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d87:	c9                   	leave
+  800d88:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8e:	eb f7                	jmp    800d87 <vsnprintf+0x4a>
+
+0000000000800d90 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d90:	55                   	push   %rbp
+  800d91:	48 89 e5             	mov    %rsp,%rbp
+  800d94:	48 83 ec 50          	sub    $0x50,%rsp
+  800d98:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d9c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800da0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800da4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800db7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dbb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dbf:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  800dc6:	00 00 00 
+  800dc9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dcb:	c9                   	leave
+  800dcc:	c3                   	ret
+
+0000000000800dcd <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dcd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dd0:	74 10                	je     800de2 <strlen+0x15>
+    size_t n = 0;
+  800dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dd7:	48 83 c0 01          	add    $0x1,%rax
+  800ddb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ddf:	75 f6                	jne    800dd7 <strlen+0xa>
+  800de1:	c3                   	ret
+    size_t n = 0;
+  800de2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800de7:	c3                   	ret
+
+0000000000800de8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800de8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800deb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800df0:	48 85 f6             	test   %rsi,%rsi
+  800df3:	74 11                	je     800e06 <strnlen+0x1e>
+  800df5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800df9:	74 0c                	je     800e07 <strnlen+0x1f>
+  800dfb:	48 83 c2 01          	add    $0x1,%rdx
+  800dff:	48 39 d0             	cmp    %rdx,%rax
+  800e02:	75 f1                	jne    800df5 <strnlen+0xd>
+  800e04:	eb 04                	jmp    800e0a <strnlen+0x22>
+  800e06:	c3                   	ret
+  800e07:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e0a:	c3                   	ret
+
+0000000000800e0b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e0b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e13:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e17:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e1a:	48 83 c2 01          	add    $0x1,%rdx
+  800e1e:	84 c9                	test   %cl,%cl
+  800e20:	75 f1                	jne    800e13 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e22:	c3                   	ret
+
+0000000000800e23 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e23:	55                   	push   %rbp
+  800e24:	48 89 e5             	mov    %rsp,%rbp
+  800e27:	41 54                	push   %r12
+  800e29:	53                   	push   %rbx
+  800e2a:	48 89 fb             	mov    %rdi,%rbx
+  800e2d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e30:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  800e37:	00 00 00 
+  800e3a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e3c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e40:	4c 89 e6             	mov    %r12,%rsi
+  800e43:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  800e4a:	00 00 00 
+  800e4d:	ff d0                	call   *%rax
+    return dst;
+}
+  800e4f:	48 89 d8             	mov    %rbx,%rax
+  800e52:	5b                   	pop    %rbx
+  800e53:	41 5c                	pop    %r12
+  800e55:	5d                   	pop    %rbp
+  800e56:	c3                   	ret
+
+0000000000800e57 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e57:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e5a:	48 85 d2             	test   %rdx,%rdx
+  800e5d:	74 1f                	je     800e7e <strncpy+0x27>
+  800e5f:	48 01 fa             	add    %rdi,%rdx
+  800e62:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e65:	48 83 c1 01          	add    $0x1,%rcx
+  800e69:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e6d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e71:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e75:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e79:	48 39 ca             	cmp    %rcx,%rdx
+  800e7c:	75 e7                	jne    800e65 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e7e:	c3                   	ret
+
+0000000000800e7f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e7f:	48 89 f8             	mov    %rdi,%rax
+  800e82:	48 85 d2             	test   %rdx,%rdx
+  800e85:	74 24                	je     800eab <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e87:	48 83 ea 01          	sub    $0x1,%rdx
+  800e8b:	74 1b                	je     800ea8 <strlcpy+0x29>
+  800e8d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e91:	0f b6 16             	movzbl (%rsi),%edx
+  800e94:	84 d2                	test   %dl,%dl
+  800e96:	74 10                	je     800ea8 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e98:	48 83 c6 01          	add    $0x1,%rsi
+  800e9c:	48 83 c0 01          	add    $0x1,%rax
+  800ea0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ea3:	48 39 c8             	cmp    %rcx,%rax
+  800ea6:	75 e9                	jne    800e91 <strlcpy+0x12>
+        *dst = '\0';
+  800ea8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800eab:	48 29 f8             	sub    %rdi,%rax
+}
+  800eae:	c3                   	ret
+
+0000000000800eaf <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800eaf:	0f b6 07             	movzbl (%rdi),%eax
+  800eb2:	84 c0                	test   %al,%al
+  800eb4:	74 13                	je     800ec9 <strcmp+0x1a>
+  800eb6:	38 06                	cmp    %al,(%rsi)
+  800eb8:	75 0f                	jne    800ec9 <strcmp+0x1a>
+  800eba:	48 83 c7 01          	add    $0x1,%rdi
+  800ebe:	48 83 c6 01          	add    $0x1,%rsi
+  800ec2:	0f b6 07             	movzbl (%rdi),%eax
+  800ec5:	84 c0                	test   %al,%al
+  800ec7:	75 ed                	jne    800eb6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ec9:	0f b6 c0             	movzbl %al,%eax
+  800ecc:	0f b6 16             	movzbl (%rsi),%edx
+  800ecf:	29 d0                	sub    %edx,%eax
+}
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ed2:	48 85 d2             	test   %rdx,%rdx
+  800ed5:	74 1f                	je     800ef6 <strncmp+0x24>
+  800ed7:	0f b6 07             	movzbl (%rdi),%eax
+  800eda:	84 c0                	test   %al,%al
+  800edc:	74 1e                	je     800efc <strncmp+0x2a>
+  800ede:	3a 06                	cmp    (%rsi),%al
+  800ee0:	75 1a                	jne    800efc <strncmp+0x2a>
+  800ee2:	48 83 c7 01          	add    $0x1,%rdi
+  800ee6:	48 83 c6 01          	add    $0x1,%rsi
+  800eea:	48 83 ea 01          	sub    $0x1,%rdx
+  800eee:	75 e7                	jne    800ed7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef5:	c3                   	ret
+  800ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800efb:	c3                   	ret
+  800efc:	48 85 d2             	test   %rdx,%rdx
+  800eff:	74 09                	je     800f0a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f01:	0f b6 07             	movzbl (%rdi),%eax
+  800f04:	0f b6 16             	movzbl (%rsi),%edx
+  800f07:	29 d0                	sub    %edx,%eax
+  800f09:	c3                   	ret
+    if (!n) return 0;
+  800f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f0f:	c3                   	ret
+
+0000000000800f10 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f10:	0f b6 17             	movzbl (%rdi),%edx
+  800f13:	84 d2                	test   %dl,%dl
+  800f15:	74 18                	je     800f2f <strchr+0x1f>
+        if (*str == c) {
+  800f17:	0f be d2             	movsbl %dl,%edx
+  800f1a:	39 f2                	cmp    %esi,%edx
+  800f1c:	74 17                	je     800f35 <strchr+0x25>
+    for (; *str; str++) {
+  800f1e:	48 83 c7 01          	add    $0x1,%rdi
+  800f22:	0f b6 17             	movzbl (%rdi),%edx
+  800f25:	84 d2                	test   %dl,%dl
+  800f27:	75 ee                	jne    800f17 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2e:	c3                   	ret
+  800f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f34:	c3                   	ret
+  800f35:	48 89 f8             	mov    %rdi,%rax
+}
+  800f38:	c3                   	ret
+
+0000000000800f39 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f39:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f3c:	0f b6 17             	movzbl (%rdi),%edx
+  800f3f:	84 d2                	test   %dl,%dl
+  800f41:	74 13                	je     800f56 <strfind+0x1d>
+  800f43:	0f be d2             	movsbl %dl,%edx
+  800f46:	39 f2                	cmp    %esi,%edx
+  800f48:	74 0b                	je     800f55 <strfind+0x1c>
+  800f4a:	48 83 c0 01          	add    $0x1,%rax
+  800f4e:	0f b6 10             	movzbl (%rax),%edx
+  800f51:	84 d2                	test   %dl,%dl
+  800f53:	75 ee                	jne    800f43 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f55:	c3                   	ret
+  800f56:	c3                   	ret
+
+0000000000800f57 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800f57:	55                   	push   %rbp
+  800f58:	48 89 e5             	mov    %rsp,%rbp
+  800f5b:	41 57                	push   %r15
+  800f5d:	41 56                	push   %r14
+  800f5f:	41 55                	push   %r13
+  800f61:	41 54                	push   %r12
+  800f63:	53                   	push   %rbx
+  800f64:	48 83 ec 08          	sub    $0x8,%rsp
+  800f68:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800f6b:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800f6f:	45 84 ed             	test   %r13b,%r13b
+  800f72:	75 12                	jne    800f86 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800f74:	4c 89 f8             	mov    %r15,%rax
+  800f77:	48 83 c4 08          	add    $0x8,%rsp
+  800f7b:	5b                   	pop    %rbx
+  800f7c:	41 5c                	pop    %r12
+  800f7e:	41 5d                	pop    %r13
+  800f80:	41 5e                	pop    %r14
+  800f82:	41 5f                	pop    %r15
+  800f84:	5d                   	pop    %rbp
+  800f85:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800f86:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800f8a:	4c 89 e7             	mov    %r12,%rdi
+  800f8d:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  800f94:	00 00 00 
+  800f97:	ff d0                	call   *%rax
+  800f99:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800f9c:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800fa0:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800fa4:	49 bf d2 0e 80 00 00 	movabs $0x800ed2,%r15
+  800fab:	00 00 00 
+				if ((sc = *s++) == 0)
+  800fae:	84 c0                	test   %al,%al
+  800fb0:	75 14                	jne    800fc6 <strstr+0x6f>
+					return NULL;
+  800fb2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800fb8:	eb ba                	jmp    800f74 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800fba:	48 83 c3 01          	add    $0x1,%rbx
+  800fbe:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800fc2:	84 c0                	test   %al,%al
+  800fc4:	74 1b                	je     800fe1 <strstr+0x8a>
+			} while (sc != c);
+  800fc6:	41 38 c5             	cmp    %al,%r13b
+  800fc9:	75 ef                	jne    800fba <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800fcb:	4c 89 f2             	mov    %r14,%rdx
+  800fce:	4c 89 e6             	mov    %r12,%rsi
+  800fd1:	48 89 df             	mov    %rbx,%rdi
+  800fd4:	41 ff d7             	call   *%r15
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	75 df                	jne    800fba <strstr+0x63>
+  800fdb:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800fdf:	eb 93                	jmp    800f74 <strstr+0x1d>
+					return NULL;
+  800fe1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800fe7:	eb 8b                	jmp    800f74 <strstr+0x1d>
+
+0000000000800fe9 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800fe9:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800feb:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800fee:	8d 57 20             	lea    0x20(%rdi),%edx
+  800ff1:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ff4:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ff7:	c3                   	ret
+
+0000000000800ff8 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800ff8:	55                   	push   %rbp
+  800ff9:	48 89 e5             	mov    %rsp,%rbp
+  800ffc:	41 57                	push   %r15
+  800ffe:	41 56                	push   %r14
+  801000:	41 55                	push   %r13
+  801002:	41 54                	push   %r12
+  801004:	53                   	push   %rbx
+  801005:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801009:	48 39 f7             	cmp    %rsi,%rdi
+  80100c:	74 49                	je     801057 <strcasecmp+0x5f>
+  80100e:	49 89 fd             	mov    %rdi,%r13
+  801011:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801014:	49 bf e9 0f 80 00 00 	movabs $0x800fe9,%r15
+  80101b:	00 00 00 
+  80101e:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801023:	41 0f b6 fe          	movzbl %r14b,%edi
+  801027:	41 ff d7             	call   *%r15
+  80102a:	89 c3                	mov    %eax,%ebx
+  80102c:	49 83 c4 01          	add    $0x1,%r12
+  801030:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801036:	41 ff d7             	call   *%r15
+  801039:	29 c3                	sub    %eax,%ebx
+  80103b:	75 09                	jne    801046 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80103d:	49 83 c5 01          	add    $0x1,%r13
+  801041:	45 84 f6             	test   %r14b,%r14b
+  801044:	75 d8                	jne    80101e <strcasecmp+0x26>
+}
+  801046:	89 d8                	mov    %ebx,%eax
+  801048:	48 83 c4 08          	add    $0x8,%rsp
+  80104c:	5b                   	pop    %rbx
+  80104d:	41 5c                	pop    %r12
+  80104f:	41 5d                	pop    %r13
+  801051:	41 5e                	pop    %r14
+  801053:	41 5f                	pop    %r15
+  801055:	5d                   	pop    %rbp
+  801056:	c3                   	ret
+        return 0;
+  801057:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105c:	eb e8                	jmp    801046 <strcasecmp+0x4e>
+
+000000000080105e <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80105e:	55                   	push   %rbp
+  80105f:	48 89 e5             	mov    %rsp,%rbp
+  801062:	41 57                	push   %r15
+  801064:	41 56                	push   %r14
+  801066:	41 55                	push   %r13
+  801068:	41 54                	push   %r12
+  80106a:	53                   	push   %rbx
+  80106b:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  80106f:	48 85 d2             	test   %rdx,%rdx
+  801072:	74 4f                	je     8010c3 <strncasecmp+0x65>
+  801074:	49 89 fc             	mov    %rdi,%r12
+  801077:	49 89 f5             	mov    %rsi,%r13
+  80107a:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  80107e:	49 be e9 0f 80 00 00 	movabs $0x800fe9,%r14
+  801085:	00 00 00 
+  801088:	49 83 c4 01          	add    $0x1,%r12
+  80108c:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801092:	41 ff d6             	call   *%r14
+  801095:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801097:	49 83 c5 01          	add    $0x1,%r13
+  80109b:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8010a0:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8010a3:	29 c3                	sub    %eax,%ebx
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	74 09                	je     8010b2 <strncasecmp+0x54>
+  8010a9:	85 db                	test   %ebx,%ebx
+  8010ab:	75 05                	jne    8010b2 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8010ad:	4d 39 fc             	cmp    %r15,%r12
+  8010b0:	75 d6                	jne    801088 <strncasecmp+0x2a>
+}
+  8010b2:	89 d8                	mov    %ebx,%eax
+  8010b4:	48 83 c4 08          	add    $0x8,%rsp
+  8010b8:	5b                   	pop    %rbx
+  8010b9:	41 5c                	pop    %r12
+  8010bb:	41 5d                	pop    %r13
+  8010bd:	41 5e                	pop    %r14
+  8010bf:	41 5f                	pop    %r15
+  8010c1:	5d                   	pop    %rbp
+  8010c2:	c3                   	ret
+    int d = 0;
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8010c8:	eb e8                	jmp    8010b2 <strncasecmp+0x54>
+
+00000000008010ca <toupper>:
+
+int toupper(int c) {
+  8010ca:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8010cc:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8010cf:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8010d2:	83 f9 1a             	cmp    $0x1a,%ecx
+  8010d5:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8010d8:	c3                   	ret
+
+00000000008010d9 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8010d9:	83 ff 20             	cmp    $0x20,%edi
+  8010dc:	0f 94 c0             	sete   %al
+  8010df:	0f b6 c0             	movzbl %al,%eax
+}
+  8010e2:	c3                   	ret
+
+00000000008010e3 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8010e3:	89 f8                	mov    %edi,%eax
+  8010e5:	f7 d8                	neg    %eax
+  8010e7:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8010ea:	c3                   	ret
+
+00000000008010eb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010eb:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010ee:	48 89 f8             	mov    %rdi,%rax
+  8010f1:	48 f7 d8             	neg    %rax
+  8010f4:	83 e0 07             	and    $0x7,%eax
+  8010f7:	49 89 d1             	mov    %rdx,%r9
+  8010fa:	49 29 c1             	sub    %rax,%r9
+  8010fd:	78 36                	js     801135 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010ff:	40 0f b6 c6          	movzbl %sil,%eax
+  801103:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80110a:	01 01 01 
+  80110d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801111:	40 f6 c7 07          	test   $0x7,%dil
+  801115:	75 38                	jne    80114f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801117:	4c 89 c9             	mov    %r9,%rcx
+  80111a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80111e:	74 0c                	je     80112c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801120:	fc                   	cld
+  801121:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801124:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801128:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80112c:	4d 85 c9             	test   %r9,%r9
+  80112f:	75 45                	jne    801176 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801131:	4c 89 c0             	mov    %r8,%rax
+  801134:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801135:	48 85 d2             	test   %rdx,%rdx
+  801138:	74 f7                	je     801131 <memset+0x46>
+  80113a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80113d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801140:	48 83 c0 01          	add    $0x1,%rax
+  801144:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801148:	48 39 c2             	cmp    %rax,%rdx
+  80114b:	75 f3                	jne    801140 <memset+0x55>
+  80114d:	eb e2                	jmp    801131 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80114f:	40 f6 c7 01          	test   $0x1,%dil
+  801153:	74 06                	je     80115b <memset+0x70>
+  801155:	88 07                	mov    %al,(%rdi)
+  801157:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80115b:	40 f6 c7 02          	test   $0x2,%dil
+  80115f:	74 07                	je     801168 <memset+0x7d>
+  801161:	66 89 07             	mov    %ax,(%rdi)
+  801164:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801168:	40 f6 c7 04          	test   $0x4,%dil
+  80116c:	74 a9                	je     801117 <memset+0x2c>
+  80116e:	89 07                	mov    %eax,(%rdi)
+  801170:	48 83 c7 04          	add    $0x4,%rdi
+  801174:	eb a1                	jmp    801117 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801176:	41 f6 c1 04          	test   $0x4,%r9b
+  80117a:	74 06                	je     801182 <memset+0x97>
+  80117c:	89 07                	mov    %eax,(%rdi)
+  80117e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801182:	41 f6 c1 02          	test   $0x2,%r9b
+  801186:	74 07                	je     80118f <memset+0xa4>
+  801188:	66 89 07             	mov    %ax,(%rdi)
+  80118b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80118f:	41 f6 c1 01          	test   $0x1,%r9b
+  801193:	74 9c                	je     801131 <memset+0x46>
+  801195:	88 07                	mov    %al,(%rdi)
+  801197:	eb 98                	jmp    801131 <memset+0x46>
+
+0000000000801199 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801199:	48 89 f8             	mov    %rdi,%rax
+  80119c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80119f:	48 39 fe             	cmp    %rdi,%rsi
+  8011a2:	73 3b                	jae    8011df <memmove+0x46>
+  8011a4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011a8:	48 39 d7             	cmp    %rdx,%rdi
+  8011ab:	73 32                	jae    8011df <memmove+0x46>
+        s += n;
+        d += n;
+  8011ad:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011b1:	48 89 d6             	mov    %rdx,%rsi
+  8011b4:	48 09 fe             	or     %rdi,%rsi
+  8011b7:	48 09 ce             	or     %rcx,%rsi
+  8011ba:	40 f6 c6 07          	test   $0x7,%sil
+  8011be:	75 12                	jne    8011d2 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011c0:	48 83 ef 08          	sub    $0x8,%rdi
+  8011c4:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011c8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011cc:	fd                   	std
+  8011cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011d0:	fc                   	cld
+  8011d1:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011d2:	48 83 ef 01          	sub    $0x1,%rdi
+  8011d6:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011da:	fd                   	std
+  8011db:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011dd:	eb f1                	jmp    8011d0 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011df:	48 89 f2             	mov    %rsi,%rdx
+  8011e2:	48 09 c2             	or     %rax,%rdx
+  8011e5:	48 09 ca             	or     %rcx,%rdx
+  8011e8:	f6 c2 07             	test   $0x7,%dl
+  8011eb:	75 0c                	jne    8011f9 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011ed:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011f1:	48 89 c7             	mov    %rax,%rdi
+  8011f4:	fc                   	cld
+  8011f5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011f8:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011f9:	48 89 c7             	mov    %rax,%rdi
+  8011fc:	fc                   	cld
+  8011fd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011ff:	c3                   	ret
+
+0000000000801200 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801204:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+}
+  801210:	5d                   	pop    %rbp
+  801211:	c3                   	ret
+
+0000000000801212 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801212:	55                   	push   %rbp
+  801213:	48 89 e5             	mov    %rsp,%rbp
+  801216:	41 57                	push   %r15
+  801218:	41 56                	push   %r14
+  80121a:	41 55                	push   %r13
+  80121c:	41 54                	push   %r12
+  80121e:	53                   	push   %rbx
+  80121f:	48 83 ec 08          	sub    $0x8,%rsp
+  801223:	49 89 fe             	mov    %rdi,%r14
+  801226:	49 89 f7             	mov    %rsi,%r15
+  801229:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80122c:	48 89 f7             	mov    %rsi,%rdi
+  80122f:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+  80123b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80123e:	48 89 de             	mov    %rbx,%rsi
+  801241:	4c 89 f7             	mov    %r14,%rdi
+  801244:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  80124b:	00 00 00 
+  80124e:	ff d0                	call   *%rax
+  801250:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801253:	48 39 c3             	cmp    %rax,%rbx
+  801256:	74 36                	je     80128e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801258:	48 89 d8             	mov    %rbx,%rax
+  80125b:	4c 29 e8             	sub    %r13,%rax
+  80125e:	49 39 c4             	cmp    %rax,%r12
+  801261:	73 31                	jae    801294 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801263:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801268:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80126c:	4c 89 fe             	mov    %r15,%rsi
+  80126f:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801276:	00 00 00 
+  801279:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80127b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80127f:	48 83 c4 08          	add    $0x8,%rsp
+  801283:	5b                   	pop    %rbx
+  801284:	41 5c                	pop    %r12
+  801286:	41 5d                	pop    %r13
+  801288:	41 5e                	pop    %r14
+  80128a:	41 5f                	pop    %r15
+  80128c:	5d                   	pop    %rbp
+  80128d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80128e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801292:	eb eb                	jmp    80127f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801294:	48 83 eb 01          	sub    $0x1,%rbx
+  801298:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80129c:	48 89 da             	mov    %rbx,%rdx
+  80129f:	4c 89 fe             	mov    %r15,%rsi
+  8012a2:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  8012a9:	00 00 00 
+  8012ac:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012ae:	49 01 de             	add    %rbx,%r14
+  8012b1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012b6:	eb c3                	jmp    80127b <strlcat+0x69>
+
+00000000008012b8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012b8:	48 85 d2             	test   %rdx,%rdx
+  8012bb:	74 2d                	je     8012ea <memcmp+0x32>
+  8012bd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012c2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012c6:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012cb:	44 38 c1             	cmp    %r8b,%cl
+  8012ce:	75 0f                	jne    8012df <memcmp+0x27>
+    while (n-- > 0) {
+  8012d0:	48 83 c0 01          	add    $0x1,%rax
+  8012d4:	48 39 c2             	cmp    %rax,%rdx
+  8012d7:	75 e9                	jne    8012c2 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012df:	0f b6 c1             	movzbl %cl,%eax
+  8012e2:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012e6:	44 29 c0             	sub    %r8d,%eax
+  8012e9:	c3                   	ret
+    return 0;
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ef:	c3                   	ret
+
+00000000008012f0 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012f0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012f4:	48 39 c7             	cmp    %rax,%rdi
+  8012f7:	73 0f                	jae    801308 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012f9:	40 38 37             	cmp    %sil,(%rdi)
+  8012fc:	74 0e                	je     80130c <memfind+0x1c>
+    for (; src < end; src++) {
+  8012fe:	48 83 c7 01          	add    $0x1,%rdi
+  801302:	48 39 f8             	cmp    %rdi,%rax
+  801305:	75 f2                	jne    8012f9 <memfind+0x9>
+  801307:	c3                   	ret
+  801308:	48 89 f8             	mov    %rdi,%rax
+  80130b:	c3                   	ret
+  80130c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80130f:	c3                   	ret
+
+0000000000801310 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801310:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801313:	0f b6 37             	movzbl (%rdi),%esi
+  801316:	40 80 fe 20          	cmp    $0x20,%sil
+  80131a:	74 06                	je     801322 <strtol+0x12>
+  80131c:	40 80 fe 09          	cmp    $0x9,%sil
+  801320:	75 13                	jne    801335 <strtol+0x25>
+  801322:	48 83 c7 01          	add    $0x1,%rdi
+  801326:	0f b6 37             	movzbl (%rdi),%esi
+  801329:	40 80 fe 20          	cmp    $0x20,%sil
+  80132d:	74 f3                	je     801322 <strtol+0x12>
+  80132f:	40 80 fe 09          	cmp    $0x9,%sil
+  801333:	74 ed                	je     801322 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801335:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801338:	83 e0 fd             	and    $0xfffffffd,%eax
+  80133b:	3c 01                	cmp    $0x1,%al
+  80133d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801341:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801347:	75 0f                	jne    801358 <strtol+0x48>
+  801349:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80134c:	74 14                	je     801362 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80134e:	85 d2                	test   %edx,%edx
+  801350:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801355:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801358:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80135d:	4c 63 ca             	movslq %edx,%r9
+  801360:	eb 36                	jmp    801398 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801362:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801366:	74 0f                	je     801377 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801368:	85 d2                	test   %edx,%edx
+  80136a:	75 ec                	jne    801358 <strtol+0x48>
+        s++;
+  80136c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801370:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801375:	eb e1                	jmp    801358 <strtol+0x48>
+        s += 2;
+  801377:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80137b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801380:	eb d6                	jmp    801358 <strtol+0x48>
+            dig -= '0';
+  801382:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801385:	44 0f b6 c1          	movzbl %cl,%r8d
+  801389:	41 39 d0             	cmp    %edx,%r8d
+  80138c:	7d 21                	jge    8013af <strtol+0x9f>
+        val = val * base + dig;
+  80138e:	49 0f af c1          	imul   %r9,%rax
+  801392:	0f b6 c9             	movzbl %cl,%ecx
+  801395:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801398:	48 83 c7 01          	add    $0x1,%rdi
+  80139c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013a0:	80 f9 39             	cmp    $0x39,%cl
+  8013a3:	76 dd                	jbe    801382 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013a5:	80 f9 7b             	cmp    $0x7b,%cl
+  8013a8:	77 05                	ja     8013af <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013aa:	83 e9 57             	sub    $0x57,%ecx
+  8013ad:	eb d6                	jmp    801385 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013af:	4d 85 d2             	test   %r10,%r10
+  8013b2:	74 03                	je     8013b7 <strtol+0xa7>
+  8013b4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013b7:	48 89 c2             	mov    %rax,%rdx
+  8013ba:	48 f7 da             	neg    %rdx
+  8013bd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013c1:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013c5:	c3                   	ret
+
+00000000008013c6 <atoi>:
+int atoi(const char *str) {
+  8013c6:	55                   	push   %rbp
+  8013c7:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8013ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d4:	48 b8 10 13 80 00 00 	movabs $0x801310,%rax
+  8013db:	00 00 00 
+  8013de:	ff d0                	call   *%rax
+}
+  8013e0:	5d                   	pop    %rbp
+  8013e1:	c3                   	ret
+
+00000000008013e2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+  8013e6:	53                   	push   %rbx
+  8013e7:	48 89 fa             	mov    %rdi,%rdx
+  8013ea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ed:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801401:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801407:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801409:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140d:	c9                   	leave
+  80140e:	c3                   	ret
+
+000000000080140f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+  801413:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801414:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801419:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801423:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801428:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142d:	be 00 00 00 00       	mov    $0x0,%esi
+  801432:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801438:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80143a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+
+0000000000801440 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801440:	55                   	push   %rbp
+  801441:	48 89 e5             	mov    %rsp,%rbp
+  801444:	53                   	push   %rbx
+  801445:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801449:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801451:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801460:	be 00 00 00 00       	mov    $0x0,%esi
+  801465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146d:	48 85 c0             	test   %rax,%rax
+  801470:	7f 06                	jg     801478 <sys_env_destroy+0x38>
+}
+  801472:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801476:	c9                   	leave
+  801477:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801478:	49 89 c0             	mov    %rax,%r8
+  80147b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801480:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801487:	00 00 00 
+  80148a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80148f:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801496:	00 00 00 
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8014a5:	00 00 00 
+  8014a8:	41 ff d1             	call   *%r9
+
+00000000008014ab <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014ab:	55                   	push   %rbp
+  8014ac:	48 89 e5             	mov    %rsp,%rbp
+  8014af:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <sys_yield>:
+
+void
+sys_yield(void) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801505:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801507:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150b:	c9                   	leave
+  80150c:	c3                   	ret
+
+000000000080150d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	53                   	push   %rbx
+  801512:	48 89 fa             	mov    %rdi,%rdx
+  801515:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801518:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801524:	00 00 00 
+  801527:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152c:	be 00 00 00 00       	mov    $0x0,%esi
+  801531:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801537:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+
+000000000080153f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80153f:	55                   	push   %rbp
+  801540:	48 89 e5             	mov    %rsp,%rbp
+  801543:	53                   	push   %rbx
+  801544:	49 89 f8             	mov    %rdi,%r8
+  801547:	48 89 d3             	mov    %rdx,%rbx
+  80154a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80154d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801552:	4c 89 c2             	mov    %r8,%rdx
+  801555:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801558:	be 00 00 00 00       	mov    $0x0,%esi
+  80155d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801563:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+
+000000000080156b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+  801570:	48 83 ec 08          	sub    $0x8,%rsp
+  801574:	89 f8                	mov    %edi,%eax
+  801576:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801579:	48 63 f9             	movslq %ecx,%rdi
+  80157c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801584:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801587:	be 00 00 00 00       	mov    $0x0,%esi
+  80158c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801594:	48 85 c0             	test   %rax,%rax
+  801597:	7f 06                	jg     80159f <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159d:	c9                   	leave
+  80159e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159f:	49 89 c0             	mov    %rax,%r8
+  8015a2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015a7:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8015ae:	00 00 00 
+  8015b1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015b6:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8015bd:	00 00 00 
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8015cc:	00 00 00 
+  8015cf:	41 ff d1             	call   *%r9
+
+00000000008015d2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015db:	89 f8                	mov    %edi,%eax
+  8015dd:	49 89 f2             	mov    %rsi,%r10
+  8015e0:	48 89 cf             	mov    %rcx,%rdi
+  8015e3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015e6:	48 63 da             	movslq %edx,%rbx
+  8015e9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ec:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f4:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f9:	48 85 c0             	test   %rax,%rax
+  8015fc:	7f 06                	jg     801604 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801602:	c9                   	leave
+  801603:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801604:	49 89 c0             	mov    %rax,%r8
+  801607:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80160c:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801613:	00 00 00 
+  801616:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80161b:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801622:	00 00 00 
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801631:	00 00 00 
+  801634:	41 ff d1             	call   *%r9
+
+0000000000801637 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801637:	55                   	push   %rbp
+  801638:	48 89 e5             	mov    %rsp,%rbp
+  80163b:	53                   	push   %rbx
+  80163c:	48 83 ec 08          	sub    $0x8,%rsp
+  801640:	49 89 f9             	mov    %rdi,%r9
+  801643:	89 f0                	mov    %esi,%eax
+  801645:	48 89 d3             	mov    %rdx,%rbx
+  801648:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80164b:	49 63 f0             	movslq %r8d,%rsi
+  80164e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801651:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801656:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	7f 06                	jg     80166c <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166c:	49 89 c0             	mov    %rax,%r8
+  80166f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801674:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80167b:	00 00 00 
+  80167e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801683:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80168a:	00 00 00 
+  80168d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801692:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801699:	00 00 00 
+  80169c:	41 ff d1             	call   *%r9
+
+000000000080169f <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+  8016a4:	89 f8                	mov    %edi,%eax
+  8016a6:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8016a9:	48 63 f9             	movslq %ecx,%rdi
+  8016ac:	48 63 da             	movslq %edx,%rbx
+  8016af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c5:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8016c7:	89 c2                	mov    %eax,%edx
+  8016c9:	48 85 c0             	test   %rax,%rax
+  8016cc:	78 0d                	js     8016db <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8016ce:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8016d3:	4d 85 c9             	test   %r9,%r9
+  8016d6:	74 03                	je     8016db <sys_alloc_dma_region+0x3c>
+  8016d8:	49 89 01             	mov    %rax,(%r9)
+}
+  8016db:	89 d0                	mov    %edx,%eax
+  8016dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e1:	c9                   	leave
+  8016e2:	c3                   	ret
+
+00000000008016e3 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	53                   	push   %rbx
+  8016e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ec:	48 89 f1             	mov    %rsi,%rcx
+  8016ef:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f5:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80170c:	48 85 c0             	test   %rax,%rax
+  80170f:	7f 06                	jg     801717 <sys_set_cache_region+0x34>
+}
+  801711:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801717:	49 89 c0             	mov    %rax,%r8
+  80171a:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80171f:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801726:	00 00 00 
+  801729:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80172e:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801735:	00 00 00 
+  801738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173d:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801744:	00 00 00 
+  801747:	41 ff d1             	call   *%r9
+
+000000000080174a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80174a:	55                   	push   %rbp
+  80174b:	48 89 e5             	mov    %rsp,%rbp
+  80174e:	53                   	push   %rbx
+  80174f:	48 83 ec 08          	sub    $0x8,%rsp
+  801753:	48 89 f1             	mov    %rsi,%rcx
+  801756:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801759:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801761:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801766:	be 00 00 00 00       	mov    $0x0,%esi
+  80176b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801771:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801773:	48 85 c0             	test   %rax,%rax
+  801776:	7f 06                	jg     80177e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801778:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177e:	49 89 c0             	mov    %rax,%r8
+  801781:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801786:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80178d:	00 00 00 
+  801790:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801795:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80179c:	00 00 00 
+  80179f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a4:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8017ab:	00 00 00 
+  8017ae:	41 ff d1             	call   *%r9
+
+00000000008017b1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017b1:	55                   	push   %rbp
+  8017b2:	48 89 e5             	mov    %rsp,%rbp
+  8017b5:	53                   	push   %rbx
+  8017b6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017ba:	48 63 ce             	movslq %esi,%rcx
+  8017bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017dc:	48 85 c0             	test   %rax,%rax
+  8017df:	7f 06                	jg     8017e7 <sys_env_set_status+0x36>
+}
+  8017e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e7:	49 89 c0             	mov    %rax,%r8
+  8017ea:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017ef:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8017f6:	00 00 00 
+  8017f9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017fe:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801805:	00 00 00 
+  801808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180d:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801814:	00 00 00 
+  801817:	41 ff d1             	call   *%r9
+
+000000000080181a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80181a:	55                   	push   %rbp
+  80181b:	48 89 e5             	mov    %rsp,%rbp
+  80181e:	53                   	push   %rbx
+  80181f:	48 83 ec 08          	sub    $0x8,%rsp
+  801823:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801826:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801829:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801833:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801838:	be 00 00 00 00       	mov    $0x0,%esi
+  80183d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801843:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801845:	48 85 c0             	test   %rax,%rax
+  801848:	7f 06                	jg     801850 <sys_env_set_trapframe+0x36>
+}
+  80184a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801850:	49 89 c0             	mov    %rax,%r8
+  801853:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801858:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80185f:	00 00 00 
+  801862:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801867:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80186e:	00 00 00 
+  801871:	b8 00 00 00 00       	mov    $0x0,%eax
+  801876:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  80187d:	00 00 00 
+  801880:	41 ff d1             	call   *%r9
+
+0000000000801883 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	53                   	push   %rbx
+  801888:	48 83 ec 08          	sub    $0x8,%rsp
+  80188c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80188f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801892:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801897:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ae:	48 85 c0             	test   %rax,%rax
+  8018b1:	7f 06                	jg     8018b9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b9:	49 89 c0             	mov    %rax,%r8
+  8018bc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8018c1:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8018c8:	00 00 00 
+  8018cb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018d0:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8018d7:	00 00 00 
+  8018da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018df:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8018e6:	00 00 00 
+  8018e9:	41 ff d1             	call   *%r9
+
+00000000008018ec <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018ec:	55                   	push   %rbp
+  8018ed:	48 89 e5             	mov    %rsp,%rbp
+  8018f0:	53                   	push   %rbx
+  8018f1:	89 f8                	mov    %edi,%eax
+  8018f3:	49 89 f1             	mov    %rsi,%r9
+  8018f6:	48 89 d3             	mov    %rdx,%rbx
+  8018f9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018fc:	49 63 f0             	movslq %r8d,%rsi
+  8018ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801902:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801907:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80190a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801910:	cd 30                	int    $0x30
+}
+  801912:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801916:	c9                   	leave
+  801917:	c3                   	ret
+
+0000000000801918 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801918:	55                   	push   %rbp
+  801919:	48 89 e5             	mov    %rsp,%rbp
+  80191c:	53                   	push   %rbx
+  80191d:	48 83 ec 08          	sub    $0x8,%rsp
+  801921:	48 89 fa             	mov    %rdi,%rdx
+  801924:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801927:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801931:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801936:	be 00 00 00 00       	mov    $0x0,%esi
+  80193b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801941:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801943:	48 85 c0             	test   %rax,%rax
+  801946:	7f 06                	jg     80194e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194c:	c9                   	leave
+  80194d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80194e:	49 89 c0             	mov    %rax,%r8
+  801951:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801956:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80195d:	00 00 00 
+  801960:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801965:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80196c:	00 00 00 
+  80196f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801974:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  80197b:	00 00 00 
+  80197e:	41 ff d1             	call   *%r9
+
+0000000000801981 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	53                   	push   %rbx
+  801986:	48 89 fa             	mov    %rdi,%rdx
+  801989:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80198c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801991:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801996:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80199b:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a6:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+00000000008019ae <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019ae:	55                   	push   %rbp
+  8019af:	48 89 e5             	mov    %rsp,%rbp
+  8019b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019dd:	c9                   	leave
+  8019de:	c3                   	ret
+
+00000000008019df <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8019df:	48 85 ff             	test   %rdi,%rdi
+  8019e2:	0f 84 b6 01 00 00    	je     801b9e <malloc+0x1bf>
+malloc(size_t size) {
+  8019e8:	55                   	push   %rbp
+  8019e9:	48 89 e5             	mov    %rsp,%rbp
+  8019ec:	41 56                	push   %r14
+  8019ee:	41 55                	push   %r13
+  8019f0:	41 54                	push   %r12
+  8019f2:	53                   	push   %rbx
+  8019f3:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8019f6:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019fd:	00 00 00 
+  801a00:	4c 8b 20             	mov    (%rax),%r12
+  801a03:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801a0a:	0f 87 94 01 00 00    	ja     801ba4 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801a10:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a17:	00 00 00 
+  801a1a:	48 85 c0             	test   %rax,%rax
+  801a1d:	74 6b                	je     801a8a <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801a1f:	4d 85 e4             	test   %r12,%r12
+  801a22:	74 66                	je     801a8a <malloc+0xab>
+  801a24:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801a2b:	00 00 00 
+  801a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a33:	eb 0d                	jmp    801a42 <malloc+0x63>
+  801a35:	48 83 c1 01          	add    $0x1,%rcx
+  801a39:	48 83 c2 18          	add    $0x18,%rdx
+  801a3d:	49 39 cc             	cmp    %rcx,%r12
+  801a40:	74 48                	je     801a8a <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801a42:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801a47:	74 ec                	je     801a35 <malloc+0x56>
+  801a49:	48 39 1a             	cmp    %rbx,(%rdx)
+  801a4c:	72 e7                	jb     801a35 <malloc+0x56>
+                real_freep_size--;
+  801a4e:	48 83 e8 01          	sub    $0x1,%rax
+  801a52:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a59:	00 00 00 
+                freep[i].is_free = false;
+  801a5c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a63:	00 00 00 
+  801a66:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801a6a:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801a6e:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801a72:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801a79:	00 
+                freep[i].size = size;
+  801a7a:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801a7e:	48 01 c8             	add    %rcx,%rax
+  801a81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a85:	e9 0b 01 00 00       	jmp    801b95 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801a8a:	48 a1 18 60 80 00 00 	movabs 0x806018,%rax
+  801a91:	00 00 00 
+  801a94:	48 01 d8             	add    %rbx,%rax
+  801a97:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801a9d:	76 7c                	jbe    801b1b <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801a9f:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  801aa6:	00 00 00 
+  801aa9:	4c 8b 30             	mov    (%rax),%r14
+  801aac:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801ab3:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801ab6:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  801abd:	00 00 00 
+  801ac0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801ac7:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801ace:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ad4:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801ad8:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	89 c7                	mov    %eax,%edi
+  801ae6:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801aed:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801af4:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801afb:	00 00 00 
+  801afe:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801b02:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801b07:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  801b0e:	00 00 00 
+  801b11:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	0f 88 90 00 00 00    	js     801bab <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801b1b:	48 b9 20 60 80 00 00 	movabs $0x806020,%rcx
+  801b22:	00 00 00 
+  801b25:	48 8b 31             	mov    (%rcx),%rsi
+  801b28:	48 bf 18 60 80 00 00 	movabs $0x806018,%rdi
+  801b2f:	00 00 00 
+  801b32:	4c 8b 07             	mov    (%rdi),%r8
+  801b35:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801b39:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801b40:	00 00 00 
+  801b43:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801b47:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801b4b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b52:	00 00 00 
+  801b55:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801b59:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801b5c:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801b60:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801b67:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801b68:	48 89 d8             	mov    %rbx,%rax
+  801b6b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b70:	4c 01 c0             	add    %r8,%rax
+  801b73:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801b76:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801b7d:	48 01 f3             	add    %rsi,%rbx
+  801b80:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801b83:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801b88:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801b8f:	00 00 00 
+  801b92:	48 89 d0             	mov    %rdx,%rax
+}
+  801b95:	5b                   	pop    %rbx
+  801b96:	41 5c                	pop    %r12
+  801b98:	41 5d                	pop    %r13
+  801b9a:	41 5e                	pop    %r14
+  801b9c:	5d                   	pop    %rbp
+  801b9d:	c3                   	ret
+        return NULL;
+  801b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba3:	c3                   	ret
+        return NULL;
+  801ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba9:	eb ea                	jmp    801b95 <malloc+0x1b6>
+            return NULL;
+  801bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb0:	eb e3                	jmp    801b95 <malloc+0x1b6>
+
+0000000000801bb2 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801bb2:	55                   	push   %rbp
+  801bb3:	48 89 e5             	mov    %rsp,%rbp
+  801bb6:	53                   	push   %rbx
+  801bb7:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801bbb:	48 89 fb             	mov    %rdi,%rbx
+  801bbe:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801bc2:	48 89 df             	mov    %rbx,%rdi
+  801bc5:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+  801bd1:	48 89 c7             	mov    %rax,%rdi
+  801bd4:	48 89 da             	mov    %rbx,%rdx
+  801bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801bdc:	48 b8 eb 10 80 00 00 	movabs $0x8010eb,%rax
+  801be3:	00 00 00 
+  801be6:	ff d0                	call   *%rax
+}
+  801be8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bec:	c9                   	leave
+  801bed:	c3                   	ret
+
+0000000000801bee <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801bee:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801bf5:	00 00 00 
+  801bf8:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801bff:	00 00 00 
+  801c02:	48 3b 02             	cmp    (%rdx),%rax
+  801c05:	74 4d                	je     801c54 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801c07:	48 85 c0             	test   %rax,%rax
+  801c0a:	74 4d                	je     801c59 <get_allocsize+0x6b>
+  801c0c:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c13:	00 00 00 
+  801c16:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801c1b:	48 3b 39             	cmp    (%rcx),%rdi
+  801c1e:	74 13                	je     801c33 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801c20:	48 83 c2 01          	add    $0x1,%rdx
+  801c24:	48 83 c1 18          	add    $0x18,%rcx
+  801c28:	48 39 d0             	cmp    %rdx,%rax
+  801c2b:	75 ee                	jne    801c1b <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c32:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801c33:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c43:	00 00 00 
+  801c46:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c4c:	75 0b                	jne    801c59 <get_allocsize+0x6b>
+  801c4e:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801c53:	c3                   	ret
+        return 0;
+  801c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c59:	c3                   	ret
+
+0000000000801c5a <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801c5a:	48 85 ff             	test   %rdi,%rdi
+  801c5d:	0f 84 01 01 00 00    	je     801d64 <free+0x10a>
+free(void *ptr) {
+  801c63:	55                   	push   %rbp
+  801c64:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801c67:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801c6e:	00 00 00 
+  801c71:	48 8b 30             	mov    (%rax),%rsi
+  801c74:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801c7b:	00 00 00 
+  801c7e:	48 39 c6             	cmp    %rax,%rsi
+  801c81:	74 50                	je     801cd3 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801c83:	48 85 f6             	test   %rsi,%rsi
+  801c86:	74 21                	je     801ca9 <free+0x4f>
+  801c88:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c8f:	00 00 00 
+  801c92:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801c97:	48 3b 39             	cmp    (%rcx),%rdi
+  801c9a:	74 61                	je     801cfd <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801c9c:	48 83 c2 01          	add    $0x1,%rdx
+  801ca0:	48 83 c1 18          	add    $0x18,%rcx
+  801ca4:	48 39 d6             	cmp    %rdx,%rsi
+  801ca7:	75 ee                	jne    801c97 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801ca9:	48 ba 70 56 80 00 00 	movabs $0x805670,%rdx
+  801cb0:	00 00 00 
+  801cb3:	be 12 01 00 00       	mov    $0x112,%esi
+  801cb8:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801cbf:	00 00 00 
+  801cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc7:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  801cce:	00 00 00 
+  801cd1:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801cd3:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801cda:	00 00 00 
+  801cdd:	be 06 01 00 00       	mov    $0x106,%esi
+  801ce2:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801ce9:	00 00 00 
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf1:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  801cf8:	00 00 00 
+  801cfb:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801cfd:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d01:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d08:	00 00 00 
+  801d0b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d11:	75 27                	jne    801d3a <free+0xe0>
+            freep[i].is_free = true;
+  801d13:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d17:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801d1e:	00 00 00 
+  801d21:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801d28:	00 00 
+            real_freep_size++;
+  801d2a:	48 83 c0 01          	add    $0x1,%rax
+  801d2e:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801d35:	00 00 00 
+}
+  801d38:	5d                   	pop    %rbp
+  801d39:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801d3a:	48 ba 48 56 80 00 00 	movabs $0x805648,%rdx
+  801d41:	00 00 00 
+  801d44:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801d49:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801d50:	00 00 00 
+  801d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d58:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  801d5f:	00 00 00 
+  801d62:	ff d1                	call   *%rcx
+  801d64:	c3                   	ret
+
+0000000000801d65 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801d65:	55                   	push   %rbp
+  801d66:	48 89 e5             	mov    %rsp,%rbp
+  801d69:	41 55                	push   %r13
+  801d6b:	41 54                	push   %r12
+  801d6d:	53                   	push   %rbx
+  801d6e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d72:	48 89 fb             	mov    %rdi,%rbx
+  801d75:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801d78:	48 b8 ee 1b 80 00 00 	movabs $0x801bee,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801d84:	49 39 c5             	cmp    %rax,%r13
+  801d87:	73 0e                	jae    801d97 <realloc+0x32>
+}
+  801d89:	48 89 d8             	mov    %rbx,%rax
+  801d8c:	48 83 c4 08          	add    $0x8,%rsp
+  801d90:	5b                   	pop    %rbx
+  801d91:	41 5c                	pop    %r12
+  801d93:	41 5d                	pop    %r13
+  801d95:	5d                   	pop    %rbp
+  801d96:	c3                   	ret
+  801d97:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801d9a:	4c 89 ef             	mov    %r13,%rdi
+  801d9d:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+  801da9:	48 89 c7             	mov    %rax,%rdi
+  801dac:	4c 89 e2             	mov    %r12,%rdx
+  801daf:	48 89 de             	mov    %rbx,%rsi
+  801db2:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+  801dbe:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801dc1:	48 89 df             	mov    %rbx,%rdi
+  801dc4:	48 b8 5a 1c 80 00 00 	movabs $0x801c5a,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+    return newptr;
+  801dd0:	4c 89 e3             	mov    %r12,%rbx
+  801dd3:	eb b4                	jmp    801d89 <realloc+0x24>
+
+0000000000801dd5 <strdup>:
+
+char*
+strdup (const char *src) {
+  801dd5:	55                   	push   %rbp
+  801dd6:	48 89 e5             	mov    %rsp,%rbp
+  801dd9:	41 54                	push   %r12
+  801ddb:	53                   	push   %rbx
+  801ddc:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801ddf:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801def:	4c 89 e7             	mov    %r12,%rdi
+  801df2:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801df9:	00 00 00 
+  801dfc:	ff d0                	call   *%rax
+  801dfe:	48 89 c7             	mov    %rax,%rdi
+  801e01:	4c 89 e2             	mov    %r12,%rdx
+  801e04:	48 89 de             	mov    %rbx,%rsi
+  801e07:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  801e0e:	00 00 00 
+  801e11:	ff d0                	call   *%rax
+}
+  801e13:	5b                   	pop    %rbx
+  801e14:	41 5c                	pop    %r12
+  801e16:	5d                   	pop    %rbp
+  801e17:	c3                   	ret
+
+0000000000801e18 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801e18:	55                   	push   %rbp
+  801e19:	48 89 e5             	mov    %rsp,%rbp
+  801e1c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e1d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e27:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e36:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e41:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e47:	c9                   	leave
+  801e48:	c3                   	ret
+
+0000000000801e49 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801e4d:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e54:	00 00 00 
+  801e57:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e5b:	74 26                	je     801e83 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801e5d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e5f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e63:	89 c0                	mov    %eax,%eax
+  801e65:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801e68:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801e6f:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801e76:	00 00 00 
+  801e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7e:	48 f7 31             	divq   (%rcx)
+}
+  801e81:	5d                   	pop    %rbp
+  801e82:	c3                   	ret
+        freq = get_cpufreq();
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e88:	48 ba 18 1e 80 00 00 	movabs $0x801e18,%rdx
+  801e8f:	00 00 00 
+  801e92:	ff d2                	call   *%rdx
+  801e94:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e9b:	00 00 00 
+  801e9e:	eb bd                	jmp    801e5d <get_ticks+0x14>
+
+0000000000801ea0 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	53                   	push   %rbx
+  801ea5:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea9:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801eac:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801eb3:	00 00 00 
+  801eb6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801eba:	74 50                	je     801f0c <sleep+0x6c>
+    asm volatile("rdtsc"
+  801ebc:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ebe:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ec2:	89 c0                	mov    %eax,%eax
+  801ec4:	48 89 d6             	mov    %rdx,%rsi
+  801ec7:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801eca:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ed1:	00 00 00 
+  801ed4:	48 0f af 18          	imul   (%rax),%rbx
+  801ed8:	48 c1 eb 03          	shr    $0x3,%rbx
+  801edc:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801ee3:	9b c4 20 
+  801ee6:	48 89 d8             	mov    %rbx,%rax
+  801ee9:	48 f7 e2             	mul    %rdx
+  801eec:	48 89 d1             	mov    %rdx,%rcx
+  801eef:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801ef3:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ef5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ef9:	89 c0                	mov    %eax,%eax
+  801efb:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801efe:	48 29 f2             	sub    %rsi,%rdx
+  801f01:	48 39 ca             	cmp    %rcx,%rdx
+  801f04:	72 ed                	jb     801ef3 <sleep+0x53>
+}
+  801f06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f0a:	c9                   	leave
+  801f0b:	c3                   	ret
+        freq = get_cpufreq();
+  801f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f11:	48 ba 18 1e 80 00 00 	movabs $0x801e18,%rdx
+  801f18:	00 00 00 
+  801f1b:	ff d2                	call   *%rdx
+  801f1d:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f24:	00 00 00 
+  801f27:	eb 93                	jmp    801ebc <sleep+0x1c>
+
+0000000000801f29 <poll_kbd>:
+
+int poll_kbd() {
+  801f29:	55                   	push   %rbp
+  801f2a:	48 89 e5             	mov    %rsp,%rbp
+  801f2d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f2e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f38:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f47:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f52:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+
+0000000000801f5a <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801f5a:	55                   	push   %rbp
+  801f5b:	48 89 e5             	mov    %rsp,%rbp
+  801f5e:	53                   	push   %rbx
+  801f5f:	49 89 fa             	mov    %rdi,%r10
+  801f62:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801f64:	44 89 c6             	mov    %r8d,%esi
+  801f67:	89 cf                	mov    %ecx,%edi
+  801f69:	89 d3                	mov    %edx,%ebx
+  801f6b:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801f6d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f72:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f75:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801f79:	cd 30                	int    $0x30
+  801f7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f7f:	c9                   	leave
+  801f80:	c3                   	ret
+
+0000000000801f81 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801f81:	55                   	push   %rbp
+  801f82:	48 89 e5             	mov    %rsp,%rbp
+  801f85:	41 54                	push   %r12
+  801f87:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801f88:	48 b8 3a 37 80 00 00 	movabs $0x80373a,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801f94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f99:	cd 30                	int    $0x30
+  801f9b:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	78 76                	js     802018 <fork+0x97>
+        return envid;
+    if (!envid) {
+  801fa2:	74 7c                	je     802020 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801fa4:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801faa:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801fb1:	00 00 00 
+  801fb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb9:	89 c2                	mov    %eax,%edx
+  801fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc5:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  801fcc:	00 00 00 
+  801fcf:	ff d0                	call   *%rax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	75 7c                	jne    802051 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801fd5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801fdc:	00 00 00 
+  801fdf:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801fe6:	44 89 e7             	mov    %r12d,%edi
+  801fe9:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	75 60                	jne    802059 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801ff9:	be 02 00 00 00       	mov    $0x2,%esi
+  801ffe:	44 89 e7             	mov    %r12d,%edi
+  802001:	48 b8 b1 17 80 00 00 	movabs $0x8017b1,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+        return -1;
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802014:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  802018:	44 89 e0             	mov    %r12d,%eax
+  80201b:	5b                   	pop    %rbx
+  80201c:	41 5c                	pop    %r12
+  80201e:	5d                   	pop    %rbp
+  80201f:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802020:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  802027:	00 00 00 
+  80202a:	ff d0                	call   *%rax
+  80202c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802031:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802038:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80203f:	00 00 00 
+  802042:	48 01 d0             	add    %rdx,%rax
+  802045:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80204c:	00 00 00 
+        return 0;
+  80204f:	eb c7                	jmp    802018 <fork+0x97>
+        return -1;
+  802051:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802057:	eb bf                	jmp    802018 <fork+0x97>
+  802059:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80205f:	eb b7                	jmp    802018 <fork+0x97>
+
+0000000000802061 <sfork>:
+
+envid_t
+sfork() {
+  802061:	55                   	push   %rbp
+  802062:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802065:	48 ba a6 56 80 00 00 	movabs $0x8056a6,%rdx
+  80206c:	00 00 00 
+  80206f:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802074:	48 bf c1 56 80 00 00 	movabs $0x8056c1,%rdi
+  80207b:	00 00 00 
+  80207e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802083:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  80208a:	00 00 00 
+  80208d:	ff d1                	call   *%rcx
+
+000000000080208f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80208f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802096:	ff ff ff 
+  802099:	48 01 f8             	add    %rdi,%rax
+  80209c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8020a0:	c3                   	ret
+
+00000000008020a1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020a1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020a8:	ff ff ff 
+  8020ab:	48 01 f8             	add    %rdi,%rax
+  8020ae:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8020b2:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8020b8:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8020bc:	c3                   	ret
+
+00000000008020bd <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+  8020c1:	41 57                	push   %r15
+  8020c3:	41 56                	push   %r14
+  8020c5:	41 55                	push   %r13
+  8020c7:	41 54                	push   %r12
+  8020c9:	53                   	push   %rbx
+  8020ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ce:	49 89 ff             	mov    %rdi,%r15
+  8020d1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8020d6:	49 bd b1 48 80 00 00 	movabs $0x8048b1,%r13
+  8020dd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8020e0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8020e6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8020e9:	48 89 df             	mov    %rbx,%rdi
+  8020ec:	41 ff d5             	call   *%r13
+  8020ef:	83 e0 04             	and    $0x4,%eax
+  8020f2:	74 17                	je     80210b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8020f4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8020fb:	4c 39 f3             	cmp    %r14,%rbx
+  8020fe:	75 e6                	jne    8020e6 <fd_alloc+0x29>
+  802100:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802106:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80210b:	4d 89 27             	mov    %r12,(%r15)
+}
+  80210e:	48 83 c4 08          	add    $0x8,%rsp
+  802112:	5b                   	pop    %rbx
+  802113:	41 5c                	pop    %r12
+  802115:	41 5d                	pop    %r13
+  802117:	41 5e                	pop    %r14
+  802119:	41 5f                	pop    %r15
+  80211b:	5d                   	pop    %rbp
+  80211c:	c3                   	ret
+
+000000000080211d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80211d:	83 ff 1f             	cmp    $0x1f,%edi
+  802120:	77 39                	ja     80215b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802122:	55                   	push   %rbp
+  802123:	48 89 e5             	mov    %rsp,%rbp
+  802126:	41 54                	push   %r12
+  802128:	53                   	push   %rbx
+  802129:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80212c:	48 63 df             	movslq %edi,%rbx
+  80212f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802136:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80213a:	48 89 df             	mov    %rbx,%rdi
+  80213d:	48 b8 b1 48 80 00 00 	movabs $0x8048b1,%rax
+  802144:	00 00 00 
+  802147:	ff d0                	call   *%rax
+  802149:	a8 04                	test   $0x4,%al
+  80214b:	74 14                	je     802161 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80214d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802151:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802156:	5b                   	pop    %rbx
+  802157:	41 5c                	pop    %r12
+  802159:	5d                   	pop    %rbp
+  80215a:	c3                   	ret
+        return -E_INVAL;
+  80215b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802160:	c3                   	ret
+        return -E_INVAL;
+  802161:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802166:	eb ee                	jmp    802156 <fd_lookup+0x39>
+
+0000000000802168 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802168:	55                   	push   %rbp
+  802169:	48 89 e5             	mov    %rsp,%rbp
+  80216c:	41 54                	push   %r12
+  80216e:	53                   	push   %rbx
+  80216f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802172:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  802179:	00 00 00 
+  80217c:	48 bb 40 60 80 00 00 	movabs $0x806040,%rbx
+  802183:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802186:	39 3b                	cmp    %edi,(%rbx)
+  802188:	74 47                	je     8021d1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80218a:	48 83 c0 08          	add    $0x8,%rax
+  80218e:	48 8b 18             	mov    (%rax),%rbx
+  802191:	48 85 db             	test   %rbx,%rbx
+  802194:	75 f0                	jne    802186 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802196:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80219d:	00 00 00 
+  8021a0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021a6:	89 fa                	mov    %edi,%edx
+  8021a8:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  8021af:	00 00 00 
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b7:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  8021be:	00 00 00 
+  8021c1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8021c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8021c8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8021cc:	5b                   	pop    %rbx
+  8021cd:	41 5c                	pop    %r12
+  8021cf:	5d                   	pop    %rbp
+  8021d0:	c3                   	ret
+            return 0;
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	eb f0                	jmp    8021c8 <dev_lookup+0x60>
+
+00000000008021d8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+  8021dc:	41 55                	push   %r13
+  8021de:	41 54                	push   %r12
+  8021e0:	53                   	push   %rbx
+  8021e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e5:	48 89 fb             	mov    %rdi,%rbx
+  8021e8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021eb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8021f2:	ff ff ff 
+  8021f5:	48 01 df             	add    %rbx,%rdi
+  8021f8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8021fc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802200:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  802207:	00 00 00 
+  80220a:	ff d0                	call   *%rax
+  80220c:	41 89 c5             	mov    %eax,%r13d
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 06                	js     802219 <fd_close+0x41>
+  802213:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802217:	74 1a                	je     802233 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802219:	45 84 e4             	test   %r12b,%r12b
+  80221c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802221:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802225:	44 89 e8             	mov    %r13d,%eax
+  802228:	48 83 c4 18          	add    $0x18,%rsp
+  80222c:	5b                   	pop    %rbx
+  80222d:	41 5c                	pop    %r12
+  80222f:	41 5d                	pop    %r13
+  802231:	5d                   	pop    %rbp
+  802232:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802233:	8b 3b                	mov    (%rbx),%edi
+  802235:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802239:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  802240:	00 00 00 
+  802243:	ff d0                	call   *%rax
+  802245:	41 89 c5             	mov    %eax,%r13d
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 1b                	js     802267 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80224c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802250:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802254:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80225a:	48 85 c0             	test   %rax,%rax
+  80225d:	74 08                	je     802267 <fd_close+0x8f>
+  80225f:	48 89 df             	mov    %rbx,%rdi
+  802262:	ff d0                	call   *%rax
+  802264:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802267:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80226c:	48 89 de             	mov    %rbx,%rsi
+  80226f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802274:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  80227b:	00 00 00 
+  80227e:	ff d0                	call   *%rax
+    return res;
+  802280:	eb a3                	jmp    802225 <fd_close+0x4d>
+
+0000000000802282 <close>:
+
+int
+close(int fdnum) {
+  802282:	55                   	push   %rbp
+  802283:	48 89 e5             	mov    %rsp,%rbp
+  802286:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80228a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80228e:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 15                	js     8022b3 <close+0x31>
+
+    return fd_close(fd, 1);
+  80229e:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022a7:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+}
+  8022b3:	c9                   	leave
+  8022b4:	c3                   	ret
+
+00000000008022b5 <close_all>:
+
+void
+close_all(void) {
+  8022b5:	55                   	push   %rbp
+  8022b6:	48 89 e5             	mov    %rsp,%rbp
+  8022b9:	41 54                	push   %r12
+  8022bb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8022bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c1:	49 bc 82 22 80 00 00 	movabs $0x802282,%r12
+  8022c8:	00 00 00 
+  8022cb:	89 df                	mov    %ebx,%edi
+  8022cd:	41 ff d4             	call   *%r12
+  8022d0:	83 c3 01             	add    $0x1,%ebx
+  8022d3:	83 fb 20             	cmp    $0x20,%ebx
+  8022d6:	75 f3                	jne    8022cb <close_all+0x16>
+}
+  8022d8:	5b                   	pop    %rbx
+  8022d9:	41 5c                	pop    %r12
+  8022db:	5d                   	pop    %rbp
+  8022dc:	c3                   	ret
+
+00000000008022dd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8022dd:	55                   	push   %rbp
+  8022de:	48 89 e5             	mov    %rsp,%rbp
+  8022e1:	41 57                	push   %r15
+  8022e3:	41 56                	push   %r14
+  8022e5:	41 55                	push   %r13
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ee:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8022f1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8022f5:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8022fc:	00 00 00 
+  8022ff:	ff d0                	call   *%rax
+  802301:	89 c3                	mov    %eax,%ebx
+  802303:	85 c0                	test   %eax,%eax
+  802305:	0f 88 b8 00 00 00    	js     8023c3 <dup+0xe6>
+    close(newfdnum);
+  80230b:	44 89 e7             	mov    %r12d,%edi
+  80230e:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  802315:	00 00 00 
+  802318:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80231a:	4d 63 ec             	movslq %r12d,%r13
+  80231d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802324:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802328:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80232c:	4c 89 ff             	mov    %r15,%rdi
+  80232f:	49 be a1 20 80 00 00 	movabs $0x8020a1,%r14
+  802336:	00 00 00 
+  802339:	41 ff d6             	call   *%r14
+  80233c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80233f:	4c 89 ef             	mov    %r13,%rdi
+  802342:	41 ff d6             	call   *%r14
+  802345:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802348:	48 89 df             	mov    %rbx,%rdi
+  80234b:	48 b8 b1 48 80 00 00 	movabs $0x8048b1,%rax
+  802352:	00 00 00 
+  802355:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802357:	a8 04                	test   $0x4,%al
+  802359:	74 2b                	je     802386 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80235b:	41 89 c1             	mov    %eax,%r9d
+  80235e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802364:	4c 89 f1             	mov    %r14,%rcx
+  802367:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236c:	48 89 de             	mov    %rbx,%rsi
+  80236f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802374:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  80237b:	00 00 00 
+  80237e:	ff d0                	call   *%rax
+  802380:	89 c3                	mov    %eax,%ebx
+  802382:	85 c0                	test   %eax,%eax
+  802384:	78 4e                	js     8023d4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802386:	4c 89 ff             	mov    %r15,%rdi
+  802389:	48 b8 b1 48 80 00 00 	movabs $0x8048b1,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+  802395:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802398:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80239e:	4c 89 e9             	mov    %r13,%rcx
+  8023a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a6:	4c 89 fe             	mov    %r15,%rsi
+  8023a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ae:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	89 c3                	mov    %eax,%ebx
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 14                	js     8023d4 <dup+0xf7>
+
+    return newfdnum;
+  8023c0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8023c3:	89 d8                	mov    %ebx,%eax
+  8023c5:	48 83 c4 18          	add    $0x18,%rsp
+  8023c9:	5b                   	pop    %rbx
+  8023ca:	41 5c                	pop    %r12
+  8023cc:	41 5d                	pop    %r13
+  8023ce:	41 5e                	pop    %r14
+  8023d0:	41 5f                	pop    %r15
+  8023d2:	5d                   	pop    %rbp
+  8023d3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8023d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023d9:	4c 89 ee             	mov    %r13,%rsi
+  8023dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e1:	49 bc 4a 17 80 00 00 	movabs $0x80174a,%r12
+  8023e8:	00 00 00 
+  8023eb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8023ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023f3:	4c 89 f6             	mov    %r14,%rsi
+  8023f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023fb:	41 ff d4             	call   *%r12
+    return res;
+  8023fe:	eb c3                	jmp    8023c3 <dup+0xe6>
+
+0000000000802400 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802400:	55                   	push   %rbp
+  802401:	48 89 e5             	mov    %rsp,%rbp
+  802404:	41 56                	push   %r14
+  802406:	41 55                	push   %r13
+  802408:	41 54                	push   %r12
+  80240a:	53                   	push   %rbx
+  80240b:	48 83 ec 10          	sub    $0x10,%rsp
+  80240f:	89 fb                	mov    %edi,%ebx
+  802411:	49 89 f4             	mov    %rsi,%r12
+  802414:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802417:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80241b:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+  802427:	85 c0                	test   %eax,%eax
+  802429:	78 4c                	js     802477 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80242b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80242f:	41 8b 3e             	mov    (%r14),%edi
+  802432:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802436:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	85 c0                	test   %eax,%eax
+  802444:	78 35                	js     80247b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802446:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80244a:	83 e0 03             	and    $0x3,%eax
+  80244d:	83 f8 01             	cmp    $0x1,%eax
+  802450:	74 2d                	je     80247f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802452:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802456:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80245a:	48 85 c0             	test   %rax,%rax
+  80245d:	74 56                	je     8024b5 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80245f:	4c 89 ea             	mov    %r13,%rdx
+  802462:	4c 89 e6             	mov    %r12,%rsi
+  802465:	4c 89 f7             	mov    %r14,%rdi
+  802468:	ff d0                	call   *%rax
+}
+  80246a:	48 83 c4 10          	add    $0x10,%rsp
+  80246e:	5b                   	pop    %rbx
+  80246f:	41 5c                	pop    %r12
+  802471:	41 5d                	pop    %r13
+  802473:	41 5e                	pop    %r14
+  802475:	5d                   	pop    %rbp
+  802476:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802477:	48 98                	cltq
+  802479:	eb ef                	jmp    80246a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80247b:	48 98                	cltq
+  80247d:	eb eb                	jmp    80246a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80247f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802486:	00 00 00 
+  802489:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80248f:	89 da                	mov    %ebx,%edx
+  802491:	48 bf 11 57 80 00 00 	movabs $0x805711,%rdi
+  802498:	00 00 00 
+  80249b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a0:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  8024a7:	00 00 00 
+  8024aa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024ac:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024b3:	eb b5                	jmp    80246a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024b5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8024bc:	eb ac                	jmp    80246a <read+0x6a>
+
+00000000008024be <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8024be:	55                   	push   %rbp
+  8024bf:	48 89 e5             	mov    %rsp,%rbp
+  8024c2:	41 57                	push   %r15
+  8024c4:	41 56                	push   %r14
+  8024c6:	41 55                	push   %r13
+  8024c8:	41 54                	push   %r12
+  8024ca:	53                   	push   %rbx
+  8024cb:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8024cf:	48 85 d2             	test   %rdx,%rdx
+  8024d2:	74 54                	je     802528 <readn+0x6a>
+  8024d4:	41 89 fd             	mov    %edi,%r13d
+  8024d7:	49 89 f6             	mov    %rsi,%r14
+  8024da:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8024dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8024e2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8024e7:	49 bf 00 24 80 00 00 	movabs $0x802400,%r15
+  8024ee:	00 00 00 
+  8024f1:	4c 89 e2             	mov    %r12,%rdx
+  8024f4:	48 29 f2             	sub    %rsi,%rdx
+  8024f7:	4c 01 f6             	add    %r14,%rsi
+  8024fa:	44 89 ef             	mov    %r13d,%edi
+  8024fd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802500:	85 c0                	test   %eax,%eax
+  802502:	78 20                	js     802524 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802504:	01 c3                	add    %eax,%ebx
+  802506:	85 c0                	test   %eax,%eax
+  802508:	74 08                	je     802512 <readn+0x54>
+  80250a:	48 63 f3             	movslq %ebx,%rsi
+  80250d:	4c 39 e6             	cmp    %r12,%rsi
+  802510:	72 df                	jb     8024f1 <readn+0x33>
+    }
+    return res;
+  802512:	48 63 c3             	movslq %ebx,%rax
+}
+  802515:	48 83 c4 08          	add    $0x8,%rsp
+  802519:	5b                   	pop    %rbx
+  80251a:	41 5c                	pop    %r12
+  80251c:	41 5d                	pop    %r13
+  80251e:	41 5e                	pop    %r14
+  802520:	41 5f                	pop    %r15
+  802522:	5d                   	pop    %rbp
+  802523:	c3                   	ret
+        if (inc < 0) return inc;
+  802524:	48 98                	cltq
+  802526:	eb ed                	jmp    802515 <readn+0x57>
+    int inc = 1, res = 0;
+  802528:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80252d:	eb e3                	jmp    802512 <readn+0x54>
+
+000000000080252f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80252f:	55                   	push   %rbp
+  802530:	48 89 e5             	mov    %rsp,%rbp
+  802533:	41 56                	push   %r14
+  802535:	41 55                	push   %r13
+  802537:	41 54                	push   %r12
+  802539:	53                   	push   %rbx
+  80253a:	48 83 ec 10          	sub    $0x10,%rsp
+  80253e:	89 fb                	mov    %edi,%ebx
+  802540:	49 89 f4             	mov    %rsi,%r12
+  802543:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802546:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80254a:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 47                	js     8025a1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80255a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80255e:	41 8b 3e             	mov    (%r14),%edi
+  802561:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802565:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 30                	js     8025a5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802575:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80257a:	74 2d                	je     8025a9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80257c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802580:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802584:	48 85 c0             	test   %rax,%rax
+  802587:	74 56                	je     8025df <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802589:	4c 89 ea             	mov    %r13,%rdx
+  80258c:	4c 89 e6             	mov    %r12,%rsi
+  80258f:	4c 89 f7             	mov    %r14,%rdi
+  802592:	ff d0                	call   *%rax
+}
+  802594:	48 83 c4 10          	add    $0x10,%rsp
+  802598:	5b                   	pop    %rbx
+  802599:	41 5c                	pop    %r12
+  80259b:	41 5d                	pop    %r13
+  80259d:	41 5e                	pop    %r14
+  80259f:	5d                   	pop    %rbp
+  8025a0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025a1:	48 98                	cltq
+  8025a3:	eb ef                	jmp    802594 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025a5:	48 98                	cltq
+  8025a7:	eb eb                	jmp    802594 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025a9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8025b0:	00 00 00 
+  8025b3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025b9:	89 da                	mov    %ebx,%edx
+  8025bb:	48 bf 2d 57 80 00 00 	movabs $0x80572d,%rdi
+  8025c2:	00 00 00 
+  8025c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ca:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  8025d1:	00 00 00 
+  8025d4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025d6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025dd:	eb b5                	jmp    802594 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025df:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025e6:	eb ac                	jmp    802594 <write+0x65>
+
+00000000008025e8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8025e8:	55                   	push   %rbp
+  8025e9:	48 89 e5             	mov    %rsp,%rbp
+  8025ec:	53                   	push   %rbx
+  8025ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8025f1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025f7:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 0c                	js     802613 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80260e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802613:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802617:	c9                   	leave
+  802618:	c3                   	ret
+
+0000000000802619 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802621:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802625:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 07                	js     80263c <tell+0x23>
+    return fdes->fd_offset;
+  802635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802639:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80263c:	c9                   	leave
+  80263d:	c3                   	ret
+
+000000000080263e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80263e:	55                   	push   %rbp
+  80263f:	48 89 e5             	mov    %rsp,%rbp
+  802642:	41 55                	push   %r13
+  802644:	41 54                	push   %r12
+  802646:	53                   	push   %rbx
+  802647:	48 83 ec 18          	sub    $0x18,%rsp
+  80264b:	89 fb                	mov    %edi,%ebx
+  80264d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802650:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802654:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  80265b:	00 00 00 
+  80265e:	ff d0                	call   *%rax
+  802660:	85 c0                	test   %eax,%eax
+  802662:	78 38                	js     80269c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802664:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802668:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80266c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802670:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	78 1c                	js     80269c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802680:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802685:	74 20                	je     8026a7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802687:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80268b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80268f:	48 85 c0             	test   %rax,%rax
+  802692:	74 47                	je     8026db <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802694:	44 89 e6             	mov    %r12d,%esi
+  802697:	4c 89 ef             	mov    %r13,%rdi
+  80269a:	ff d0                	call   *%rax
+}
+  80269c:	48 83 c4 18          	add    $0x18,%rsp
+  8026a0:	5b                   	pop    %rbx
+  8026a1:	41 5c                	pop    %r12
+  8026a3:	41 5d                	pop    %r13
+  8026a5:	5d                   	pop    %rbp
+  8026a6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8026a7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8026ae:	00 00 00 
+  8026b1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026b7:	89 da                	mov    %ebx,%edx
+  8026b9:	48 bf f0 56 80 00 00 	movabs $0x8056f0,%rdi
+  8026c0:	00 00 00 
+  8026c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c8:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  8026cf:	00 00 00 
+  8026d2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026d9:	eb c1                	jmp    80269c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026db:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026e0:	eb ba                	jmp    80269c <ftruncate+0x5e>
+
+00000000008026e2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8026e2:	55                   	push   %rbp
+  8026e3:	48 89 e5             	mov    %rsp,%rbp
+  8026e6:	41 54                	push   %r12
+  8026e8:	53                   	push   %rbx
+  8026e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ed:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026f0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026f4:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+  802700:	85 c0                	test   %eax,%eax
+  802702:	78 4e                	js     802752 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802704:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802708:	41 8b 3c 24          	mov    (%r12),%edi
+  80270c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802710:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	78 32                	js     802752 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802720:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802724:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802729:	74 30                	je     80275b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80272b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80272e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802735:	00 00 00 
+    stat->st_isdir = 0;
+  802738:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80273f:	00 00 00 
+    stat->st_dev = dev;
+  802742:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802749:	48 89 de             	mov    %rbx,%rsi
+  80274c:	4c 89 e7             	mov    %r12,%rdi
+  80274f:	ff 50 28             	call   *0x28(%rax)
+}
+  802752:	48 83 c4 10          	add    $0x10,%rsp
+  802756:	5b                   	pop    %rbx
+  802757:	41 5c                	pop    %r12
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80275b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802760:	eb f0                	jmp    802752 <fstat+0x70>
+
+0000000000802762 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802762:	55                   	push   %rbp
+  802763:	48 89 e5             	mov    %rsp,%rbp
+  802766:	41 54                	push   %r12
+  802768:	53                   	push   %rbx
+  802769:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802770:	41 89 fc             	mov    %edi,%r12d
+  802773:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802775:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802779:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	85 c0                	test   %eax,%eax
+  802787:	78 31                	js     8027ba <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802789:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802790:	44 89 e7             	mov    %r12d,%edi
+  802793:	48 b8 e2 26 80 00 00 	movabs $0x8026e2,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	78 17                	js     8027ba <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8027a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a7:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8027aa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8027ad:	39 d3                	cmp    %edx,%ebx
+  8027af:	0f 4f da             	cmovg  %edx,%ebx
+  8027b2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ba:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8027c1:	5b                   	pop    %rbx
+  8027c2:	41 5c                	pop    %r12
+  8027c4:	5d                   	pop    %rbp
+  8027c5:	c3                   	ret
+
+00000000008027c6 <seektoend>:
+{
+  8027c6:	55                   	push   %rbp
+  8027c7:	48 89 e5             	mov    %rsp,%rbp
+  8027ca:	53                   	push   %rbx
+  8027cb:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8027d2:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8027d4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027d8:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8027df:	00 00 00 
+  8027e2:	ff d0                	call   *%rax
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	78 28                	js     802810 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8027e8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8027ef:	89 df                	mov    %ebx,%edi
+  8027f1:	48 b8 e2 26 80 00 00 	movabs $0x8026e2,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	78 0f                	js     802810 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802801:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802804:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802808:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80280b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802810:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802814:	c9                   	leave
+  802815:	c3                   	ret
+
+0000000000802816 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802816:	55                   	push   %rbp
+  802817:	48 89 e5             	mov    %rsp,%rbp
+  80281a:	41 54                	push   %r12
+  80281c:	53                   	push   %rbx
+  80281d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802820:	be 00 00 00 00       	mov    $0x0,%esi
+  802825:	48 b8 09 34 80 00 00 	movabs $0x803409,%rax
+  80282c:	00 00 00 
+  80282f:	ff d0                	call   *%rax
+  802831:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 25                	js     80285c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802837:	4c 89 e6             	mov    %r12,%rsi
+  80283a:	89 c7                	mov    %eax,%edi
+  80283c:	48 b8 e2 26 80 00 00 	movabs $0x8026e2,%rax
+  802843:	00 00 00 
+  802846:	ff d0                	call   *%rax
+  802848:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80284b:	89 df                	mov    %ebx,%edi
+  80284d:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+
+    return res;
+  802859:	44 89 e3             	mov    %r12d,%ebx
+}
+  80285c:	89 d8                	mov    %ebx,%eax
+  80285e:	5b                   	pop    %rbx
+  80285f:	41 5c                	pop    %r12
+  802861:	5d                   	pop    %rbp
+  802862:	c3                   	ret
+
+0000000000802863 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802863:	55                   	push   %rbp
+  802864:	48 89 e5             	mov    %rsp,%rbp
+  802867:	53                   	push   %rbx
+  802868:	48 83 ec 08          	sub    $0x8,%rsp
+  80286c:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80286f:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+  80287b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80287f:	0f 87 ea 00 00 00    	ja     80296f <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802885:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80288c:	00 00 00 
+  80288f:	80 38 00             	cmpb   $0x0,(%rax)
+  802892:	75 35                	jne    8028c9 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802894:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802899:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80289e:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8028a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028a8:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	0f 88 ba 00 00 00    	js     802976 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8028bc:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8028c3:	00 00 00 
+  8028c6:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8028c9:	48 89 df             	mov    %rbx,%rdi
+  8028cc:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  8028d3:	00 00 00 
+  8028d6:	ff d0                	call   *%rax
+  8028d8:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8028dc:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8028e3:	00 00 00 
+  8028e6:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8028ea:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8028ed:	39 39                	cmp    %edi,(%rcx)
+  8028ef:	74 46                	je     802937 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8028f1:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8028f5:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8028fc:	00 
+  8028fd:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802904:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80290b:	00 
+  80290c:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802913:	00 
+  802914:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80291b:	00 
+  80291c:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802923:	00 
+  802924:	89 39                	mov    %edi,(%rcx)
+  802926:	48 01 c6             	add    %rax,%rsi
+  802929:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80292e:	48 89 c8             	mov    %rcx,%rax
+  802931:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802935:	c9                   	leave
+  802936:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802937:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80293b:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802942:	00 00 00 
+  802945:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802948:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80294c:	74 e0                	je     80292e <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80294e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802955:	00 
+  802956:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80295a:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802961:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802963:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802966:	48 01 c2             	add    %rax,%rdx
+  802969:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80296d:	eb bf                	jmp    80292e <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80296f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802974:	eb b8                	jmp    80292e <fbuf_get+0xcb>
+            return NULL;
+  802976:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80297b:	eb b1                	jmp    80292e <fbuf_get+0xcb>
+
+000000000080297d <fsipc_bulk>:
+fsipc_bulk(void) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	53                   	push   %rbx
+  802982:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802986:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80298d:	00 00 00 
+  802990:	48 8b 18             	mov    (%rax),%rbx
+  802993:	48 85 db             	test   %rbx,%rbx
+  802996:	74 16                	je     8029ae <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802998:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80299f:	00 00 00 
+  8029a2:	48 8b 18             	mov    (%rax),%rbx
+}
+  8029a5:	48 89 d8             	mov    %rbx,%rax
+  8029a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8029ae:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029b3:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8029b8:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8029bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c2:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	78 d3                	js     8029a5 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8029d2:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8029d7:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8029de:	00 00 00 
+  8029e1:	eb b5                	jmp    802998 <fsipc_bulk+0x1b>
+
+00000000008029e3 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	41 57                	push   %r15
+  8029e9:	41 56                	push   %r14
+  8029eb:	41 55                	push   %r13
+  8029ed:	41 54                	push   %r12
+  8029ef:	53                   	push   %rbx
+  8029f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f4:	41 89 fd             	mov    %edi,%r13d
+  8029f7:	49 89 f6             	mov    %rsi,%r14
+  8029fa:	49 89 d7             	mov    %rdx,%r15
+  8029fd:	48 89 cb             	mov    %rcx,%rbx
+  802a00:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a03:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a0a:	00 00 00 
+  802a0d:	83 38 00             	cmpl   $0x0,(%rax)
+  802a10:	74 52                	je     802a64 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802a12:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a18:	4c 89 f9             	mov    %r15,%rcx
+  802a1b:	4c 89 f2             	mov    %r14,%rdx
+  802a1e:	44 89 ee             	mov    %r13d,%esi
+  802a21:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a28:	00 00 00 
+  802a2b:	8b 38                	mov    (%rax),%edi
+  802a2d:	48 b8 08 4e 80 00 00 	movabs $0x804e08,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3e:	4c 89 e2             	mov    %r12,%rdx
+  802a41:	48 89 de             	mov    %rbx,%rsi
+  802a44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a49:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+}
+  802a55:	48 83 c4 08          	add    $0x8,%rsp
+  802a59:	5b                   	pop    %rbx
+  802a5a:	41 5c                	pop    %r12
+  802a5c:	41 5d                	pop    %r13
+  802a5e:	41 5e                	pop    %r14
+  802a60:	41 5f                	pop    %r15
+  802a62:	5d                   	pop    %rbp
+  802a63:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a64:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a69:	48 b8 ab 4e 80 00 00 	movabs $0x804eab,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+  802a75:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802a7c:	00 00 
+  802a7e:	eb 92                	jmp    802a12 <fsipc_region+0x2f>
+
+0000000000802a80 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802a80:	55                   	push   %rbp
+  802a81:	48 89 e5             	mov    %rsp,%rbp
+  802a84:	41 57                	push   %r15
+  802a86:	41 56                	push   %r14
+  802a88:	41 55                	push   %r13
+  802a8a:	41 54                	push   %r12
+  802a8c:	53                   	push   %rbx
+  802a8d:	48 83 ec 28          	sub    $0x28,%rsp
+  802a91:	49 89 ff             	mov    %rdi,%r15
+  802a94:	49 89 f6             	mov    %rsi,%r14
+  802a97:	48 89 d3             	mov    %rdx,%rbx
+  802a9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802a9e:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802aa1:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802aad:	48 85 c0             	test   %rax,%rax
+  802ab0:	0f 84 cc 00 00 00    	je     802b82 <devfile_write_direct+0x102>
+  802ab6:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802ab9:	48 85 db             	test   %rbx,%rbx
+  802abc:	0f 84 ba 00 00 00    	je     802b7c <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802ac2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802ac8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802acf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802ad3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ad7:	4c 29 e3             	sub    %r12,%rbx
+  802ada:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802adf:	48 39 c3             	cmp    %rax,%rbx
+  802ae2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802ae6:	48 89 da             	mov    %rbx,%rdx
+  802ae9:	4c 89 f6             	mov    %r14,%rsi
+  802aec:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802af0:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802afc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b00:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802b04:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802b07:	44 01 e0             	add    %r12d,%eax
+  802b0a:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802b0e:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802b12:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802b19:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b20:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802b27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b32:	4c 89 ee             	mov    %r13,%rsi
+  802b35:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b3a:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  802b41:	00 00 00 
+  802b44:	ff d0                	call   *%rax
+        if (res < 0)
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 29                	js     802b73 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802b4a:	74 2b                	je     802b77 <devfile_write_direct+0xf7>
+        i += res;
+  802b4c:	48 98                	cltq
+  802b4e:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802b51:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802b54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b58:	49 39 c4             	cmp    %rax,%r12
+  802b5b:	0f 82 72 ff ff ff    	jb     802ad3 <devfile_write_direct+0x53>
+    return i;
+  802b61:	4c 89 e0             	mov    %r12,%rax
+}
+  802b64:	48 83 c4 28          	add    $0x28,%rsp
+  802b68:	5b                   	pop    %rbx
+  802b69:	41 5c                	pop    %r12
+  802b6b:	41 5d                	pop    %r13
+  802b6d:	41 5e                	pop    %r14
+  802b6f:	41 5f                	pop    %r15
+  802b71:	5d                   	pop    %rbp
+  802b72:	c3                   	ret
+            return res;
+  802b73:	48 98                	cltq
+  802b75:	eb ed                	jmp    802b64 <devfile_write_direct+0xe4>
+            return i;
+  802b77:	4c 89 e0             	mov    %r12,%rax
+  802b7a:	eb e8                	jmp    802b64 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802b7c:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802b80:	eb df                	jmp    802b61 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802b82:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802b89:	eb d9                	jmp    802b64 <devfile_write_direct+0xe4>
+
+0000000000802b8b <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802b8b:	55                   	push   %rbp
+  802b8c:	48 89 e5             	mov    %rsp,%rbp
+  802b8f:	41 56                	push   %r14
+  802b91:	41 55                	push   %r13
+  802b93:	41 54                	push   %r12
+  802b95:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802b96:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802b9a:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba3:	4d 39 ee             	cmp    %r13,%r14
+  802ba6:	0f 84 99 00 00 00    	je     802c45 <fbuf_flush+0xba>
+  802bac:	49 89 fc             	mov    %rdi,%r12
+  802baf:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802bb2:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802bb5:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802bb9:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  802bc0:	00 00 00 
+  802bc3:	ff d0                	call   *%rax
+  802bc5:	48 89 c2             	mov    %rax,%rdx
+  802bc8:	48 c1 e2 04          	shl    $0x4,%rdx
+  802bcc:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802bd0:	48 c1 e0 0c          	shl    $0xc,%rax
+  802bd4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802bd9:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802bdc:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802be0:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802be7:	00 
+  802be8:	44 89 f1             	mov    %r14d,%ecx
+  802beb:	4c 89 ea             	mov    %r13,%rdx
+  802bee:	4c 89 e7             	mov    %r12,%rdi
+  802bf1:	48 b8 80 2a 80 00 00 	movabs $0x802a80,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bfd:	48 85 c0             	test   %rax,%rax
+  802c00:	78 43                	js     802c45 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c02:	4c 39 e8             	cmp    %r13,%rax
+  802c05:	72 47                	jb     802c4e <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802c07:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802c0c:	83 c0 01             	add    $0x1,%eax
+  802c0f:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c14:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802c17:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c1b:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802c1f:	72 0f                	jb     802c30 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802c21:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802c25:	48 39 c2             	cmp    %rax,%rdx
+  802c28:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802c2c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802c30:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802c37:	00 
+  802c38:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802c3f:	00 
+    return 0;
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c45:	5b                   	pop    %rbx
+  802c46:	41 5c                	pop    %r12
+  802c48:	41 5d                	pop    %r13
+  802c4a:	41 5e                	pop    %r14
+  802c4c:	5d                   	pop    %rbp
+  802c4d:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c4e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802c53:	eb f0                	jmp    802c45 <fbuf_flush+0xba>
+
+0000000000802c55 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802c55:	55                   	push   %rbp
+  802c56:	48 89 e5             	mov    %rsp,%rbp
+  802c59:	53                   	push   %rbx
+  802c5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c5e:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802c61:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  802c68:	00 00 00 
+  802c6b:	ff d0                	call   *%rax
+  802c6d:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	48 85 f6             	test   %rsi,%rsi
+  802c78:	74 0f                	je     802c89 <devfile_sync+0x34>
+  802c7a:	48 89 df             	mov    %rbx,%rdi
+  802c7d:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  802c84:	00 00 00 
+  802c87:	ff d0                	call   *%rax
+}
+  802c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+
+0000000000802c8f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	48 83 ec 10          	sub    $0x10,%rsp
+  802c97:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802c9a:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802ca1:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802ca2:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802ca6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cab:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802cb2:	00 00 00 
+  802cb5:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  802cbc:	00 00 00 
+  802cbf:	ff d0                	call   *%rax
+}
+  802cc1:	c9                   	leave
+  802cc2:	c3                   	ret
+
+0000000000802cc3 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802cc3:	55                   	push   %rbp
+  802cc4:	48 89 e5             	mov    %rsp,%rbp
+  802cc7:	41 54                	push   %r12
+  802cc9:	53                   	push   %rbx
+  802cca:	48 89 fb             	mov    %rdi,%rbx
+  802ccd:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802cd0:	48 b8 55 2c 80 00 00 	movabs $0x802c55,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	78 63                	js     802d43 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ce0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ce3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802cea:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802cec:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf1:	bf 05 00 00 00       	mov    $0x5,%edi
+  802cf6:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  802cfd:	00 00 00 
+  802d00:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d02:	85 c0                	test   %eax,%eax
+  802d04:	78 3d                	js     802d43 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d06:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802d0d:	00 00 00 
+  802d10:	48 89 de             	mov    %rbx,%rsi
+  802d13:	4c 89 e7             	mov    %r12,%rdi
+  802d16:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d22:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802d28:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802d2f:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d30:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802d36:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802d3d:	00 
+
+    return 0;
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d43:	5b                   	pop    %rbx
+  802d44:	41 5c                	pop    %r12
+  802d46:	5d                   	pop    %rbp
+  802d47:	c3                   	ret
+
+0000000000802d48 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d48:	55                   	push   %rbp
+  802d49:	48 89 e5             	mov    %rsp,%rbp
+  802d4c:	41 54                	push   %r12
+  802d4e:	53                   	push   %rbx
+  802d4f:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802d52:	48 b8 55 2c 80 00 00 	movabs $0x802c55,%rax
+  802d59:	00 00 00 
+  802d5c:	ff d0                	call   *%rax
+  802d5e:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802d61:	48 89 df             	mov    %rbx,%rdi
+  802d64:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+  802d70:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802d74:	76 2e                	jbe    802da4 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802d76:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d79:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d80:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802d82:	be 00 00 00 00       	mov    $0x0,%esi
+  802d87:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d8c:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d98:	45 85 e4             	test   %r12d,%r12d
+  802d9b:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d9f:	5b                   	pop    %rbx
+  802da0:	41 5c                	pop    %r12
+  802da2:	5d                   	pop    %rbp
+  802da3:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802da4:	48 89 df             	mov    %rbx,%rdi
+  802da7:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  802dae:	00 00 00 
+  802db1:	ff d0                	call   *%rax
+  802db3:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802db7:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802dbe:	00 00 00 
+  802dc1:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802dc8:	48 89 df             	mov    %rbx,%rdi
+  802dcb:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  802dd2:	00 00 00 
+  802dd5:	ff d0                	call   *%rax
+  802dd7:	48 89 c6             	mov    %rax,%rsi
+  802dda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de4:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  802deb:	00 00 00 
+  802dee:	ff d0                	call   *%rax
+  802df0:	eb 84                	jmp    802d76 <devfile_flush+0x2e>
+
+0000000000802df2 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802df2:	55                   	push   %rbp
+  802df3:	48 89 e5             	mov    %rsp,%rbp
+  802df6:	41 55                	push   %r13
+  802df8:	41 54                	push   %r12
+  802dfa:	53                   	push   %rbx
+  802dfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dff:	48 89 fb             	mov    %rdi,%rbx
+  802e02:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802e05:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  802e0c:	00 00 00 
+  802e0f:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e11:	48 85 c0             	test   %rax,%rax
+  802e14:	74 51                	je     802e67 <devfile_trunc+0x75>
+  802e16:	49 89 c4             	mov    %rax,%r12
+  802e19:	48 89 c6             	mov    %rax,%rsi
+  802e1c:	48 89 df             	mov    %rbx,%rdi
+  802e1f:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+  802e2b:	85 c0                	test   %eax,%eax
+  802e2d:	78 2d                	js     802e5c <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e2f:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802e36:	00 00 00 
+  802e39:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e3c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e3e:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802e42:	be 00 00 00 00       	mov    $0x0,%esi
+  802e47:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e4c:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802e58:	85 c0                	test   %eax,%eax
+  802e5a:	79 3e                	jns    802e9a <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802e5c:	48 83 c4 08          	add    $0x8,%rsp
+  802e60:	5b                   	pop    %rbx
+  802e61:	41 5c                	pop    %r12
+  802e63:	41 5d                	pop    %r13
+  802e65:	5d                   	pop    %rbp
+  802e66:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e67:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802e6e:	00 00 00 
+  802e71:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e74:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e76:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e84:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  802e8b:	00 00 00 
+  802e8e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802e90:	85 c0                	test   %eax,%eax
+  802e92:	78 c8                	js     802e5c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802e94:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e98:	eb c2                	jmp    802e5c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802e9a:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802e9d:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ea0:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ea3:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802ea8:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802eaf:	00 00 
+  802eb1:	eb a9                	jmp    802e5c <devfile_trunc+0x6a>
+
+0000000000802eb3 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802eb3:	55                   	push   %rbp
+  802eb4:	48 89 e5             	mov    %rsp,%rbp
+  802eb7:	41 57                	push   %r15
+  802eb9:	41 56                	push   %r14
+  802ebb:	41 55                	push   %r13
+  802ebd:	41 54                	push   %r12
+  802ebf:	53                   	push   %rbx
+  802ec0:	48 83 ec 28          	sub    $0x28,%rsp
+  802ec4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802ec8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802ecc:	49 89 d7             	mov    %rdx,%r15
+  802ecf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802ed3:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  802eda:	00 00 00 
+  802edd:	ff d0                	call   *%rax
+  802edf:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802ee2:	48 85 c0             	test   %rax,%rax
+  802ee5:	74 31                	je     802f18 <devfile_write+0x65>
+  802ee7:	4c 89 f8             	mov    %r15,%rax
+  802eea:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802ef1:	77 25                	ja     802f18 <devfile_write+0x65>
+    size_t i = 0;
+  802ef3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802ef9:	48 85 c0             	test   %rax,%rax
+  802efc:	0f 85 64 01 00 00    	jne    803066 <devfile_write+0x1b3>
+    size_t i = 0;
+  802f02:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802f06:	4c 89 f8             	mov    %r15,%rax
+}
+  802f09:	48 83 c4 28          	add    $0x28,%rsp
+  802f0d:	5b                   	pop    %rbx
+  802f0e:	41 5c                	pop    %r12
+  802f10:	41 5d                	pop    %r13
+  802f12:	41 5e                	pop    %r14
+  802f14:	41 5f                	pop    %r15
+  802f16:	5d                   	pop    %rbp
+  802f17:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f18:	48 85 db             	test   %rbx,%rbx
+  802f1b:	74 5b                	je     802f78 <devfile_write+0xc5>
+  802f1d:	48 89 de             	mov    %rbx,%rsi
+  802f20:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f24:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  802f2b:	00 00 00 
+  802f2e:	ff d0                	call   *%rax
+  802f30:	85 c0                	test   %eax,%eax
+  802f32:	78 40                	js     802f74 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802f34:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f38:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802f3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f3f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802f43:	48 b8 80 2a 80 00 00 	movabs $0x802a80,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802f4f:	48 85 c0             	test   %rax,%rax
+  802f52:	7e b5                	jle    802f09 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802f54:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802f58:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802f5b:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802f5e:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802f61:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f64:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f67:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802f6a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f71:	00 
+  802f72:	eb 95                	jmp    802f09 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f74:	48 98                	cltq
+  802f76:	eb 91                	jmp    802f09 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802f78:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f7c:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802f7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f83:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802f87:	48 89 df             	mov    %rbx,%rdi
+  802f8a:	48 b8 80 2a 80 00 00 	movabs $0x802a80,%rax
+  802f91:	00 00 00 
+  802f94:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802f96:	48 85 c0             	test   %rax,%rax
+  802f99:	0f 8e 6a ff ff ff    	jle    802f09 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802f9f:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802fa2:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fa6:	e9 5e ff ff ff       	jmp    802f09 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fab:	48 98                	cltq
+  802fad:	4d 85 ff             	test   %r15,%r15
+  802fb0:	49 0f 45 c7          	cmovne %r15,%rax
+  802fb4:	e9 50 ff ff ff       	jmp    802f09 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fb9:	48 89 de             	mov    %rbx,%rsi
+  802fbc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fc0:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	85 c0                	test   %eax,%eax
+  802fce:	0f 88 2b 01 00 00    	js     8030ff <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802fd4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fd8:	4c 01 f8             	add    %r15,%rax
+  802fdb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802fdf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fe3:	48 b9 8f 20 80 00 00 	movabs $0x80208f,%rcx
+  802fea:	00 00 00 
+  802fed:	ff d1                	call   *%rcx
+  802fef:	48 89 c2             	mov    %rax,%rdx
+  802ff2:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ff6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ffa:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ffe:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803003:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803006:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80300d:	00 
+  80300e:	4c 89 ea             	mov    %r13,%rdx
+  803011:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803015:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803021:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803025:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803029:	48 39 c2             	cmp    %rax,%rdx
+  80302c:	0f 84 db 00 00 00    	je     80310d <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803032:	4c 39 e2             	cmp    %r12,%rdx
+  803035:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803039:	4d 01 ec             	add    %r13,%r12
+  80303c:	49 39 c4             	cmp    %rax,%r12
+  80303f:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803043:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803047:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80304b:	45 01 ee             	add    %r13d,%r14d
+  80304e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803052:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803056:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803059:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80305d:	49 39 c7             	cmp    %rax,%r15
+  803060:	0f 83 a0 fe ff ff    	jae    802f06 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80306a:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80306e:	8b 43 08             	mov    0x8(%rbx),%eax
+  803071:	44 39 f0             	cmp    %r14d,%eax
+  803074:	7f 10                	jg     803086 <devfile_write+0x1d3>
+  803076:	48 98                	cltq
+  803078:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80307e:	49 63 d6             	movslq %r14d,%rdx
+  803081:	48 39 d0             	cmp    %rdx,%rax
+  803084:	7d 2d                	jge    8030b3 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803086:	48 89 de             	mov    %rbx,%rsi
+  803089:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80308d:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+  803099:	85 c0                	test   %eax,%eax
+  80309b:	0f 88 0a ff ff ff    	js     802fab <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8030a1:	44 89 f0             	mov    %r14d,%eax
+  8030a4:	66 b8 00 00          	mov    $0x0,%ax
+  8030a8:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8030ab:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8030b2:	00 
+        size_t off = pos - fb->fb_base;
+  8030b3:	45 89 f4             	mov    %r14d,%r12d
+  8030b6:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8030ba:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8030bd:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8030c1:	4d 29 fd             	sub    %r15,%r13
+  8030c4:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8030c9:	4c 29 e0             	sub    %r12,%rax
+  8030cc:	49 39 c5             	cmp    %rax,%r13
+  8030cf:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8030d3:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8030d7:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8030db:	48 39 c2             	cmp    %rax,%rdx
+  8030de:	0f 84 f0 fe ff ff    	je     802fd4 <devfile_write+0x121>
+  8030e4:	4c 39 e0             	cmp    %r12,%rax
+  8030e7:	0f 82 cc fe ff ff    	jb     802fb9 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8030ed:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8030f1:	48 39 d0             	cmp    %rdx,%rax
+  8030f4:	0f 83 da fe ff ff    	jae    802fd4 <devfile_write+0x121>
+  8030fa:	e9 ba fe ff ff       	jmp    802fb9 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030ff:	48 98                	cltq
+  803101:	4d 85 ff             	test   %r15,%r15
+  803104:	49 0f 45 c7          	cmovne %r15,%rax
+  803108:	e9 fc fd ff ff       	jmp    802f09 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80310d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803111:	4c 89 e2             	mov    %r12,%rdx
+  803114:	e9 2a ff ff ff       	jmp    803043 <devfile_write+0x190>
+
+0000000000803119 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803119:	55                   	push   %rbp
+  80311a:	48 89 e5             	mov    %rsp,%rbp
+  80311d:	41 57                	push   %r15
+  80311f:	41 56                	push   %r14
+  803121:	41 55                	push   %r13
+  803123:	41 54                	push   %r12
+  803125:	53                   	push   %rbx
+  803126:	48 83 ec 28          	sub    $0x28,%rsp
+  80312a:	49 89 ff             	mov    %rdi,%r15
+  80312d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803131:	48 89 d3             	mov    %rdx,%rbx
+  803134:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803138:	48 b8 63 28 80 00 00 	movabs $0x802863,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+  803144:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803147:	48 85 c0             	test   %rax,%rax
+  80314a:	74 0d                	je     803159 <devfile_read+0x40>
+  80314c:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803153:	0f 86 1a 01 00 00    	jbe    803273 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803159:	4d 85 e4             	test   %r12,%r12
+  80315c:	74 1a                	je     803178 <devfile_read+0x5f>
+  80315e:	4c 89 e6             	mov    %r12,%rsi
+  803161:	4c 89 ff             	mov    %r15,%rdi
+  803164:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  80316b:	00 00 00 
+  80316e:	ff d0                	call   *%rax
+  803170:	85 c0                	test   %eax,%eax
+  803172:	0f 88 e8 00 00 00    	js     803260 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803178:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80317c:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+  803188:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80318b:	48 85 c0             	test   %rax,%rax
+  80318e:	0f 84 69 02 00 00    	je     8033fd <devfile_read+0x2e4>
+    while (i < n) {
+  803194:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803199:	0f 84 ce 00 00 00    	je     80326d <devfile_read+0x154>
+    size_t i = 0;
+  80319f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8031a4:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8031ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031af:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8031b3:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8031b7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031bb:	48 29 da             	sub    %rbx,%rdx
+  8031be:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8031c3:	48 39 c2             	cmp    %rax,%rdx
+  8031c6:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8031ca:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031ce:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8031d2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8031d5:	01 d8                	add    %ebx,%eax
+  8031d7:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8031db:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8031df:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8031e6:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8031ed:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8031f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031ff:	4c 89 ee             	mov    %r13,%rsi
+  803202:	bf 03 00 00 00       	mov    $0x3,%edi
+  803207:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  80320e:	00 00 00 
+  803211:	ff d0                	call   *%rax
+        if (res < 0)
+  803213:	85 c0                	test   %eax,%eax
+  803215:	78 4d                	js     803264 <devfile_read+0x14b>
+        if (res == 0)
+  803217:	74 4f                	je     803268 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803219:	4c 63 e0             	movslq %eax,%r12
+  80321c:	4c 89 e2             	mov    %r12,%rdx
+  80321f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803223:	4c 89 f7             	mov    %r14,%rdi
+  803226:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  80322d:	00 00 00 
+  803230:	ff d0                	call   *%rax
+        i += res;
+  803232:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803235:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803238:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80323c:	48 39 c3             	cmp    %rax,%rbx
+  80323f:	0f 82 72 ff ff ff    	jb     8031b7 <devfile_read+0x9e>
+    return i;
+  803245:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803248:	48 85 c0             	test   %rax,%rax
+  80324b:	7e 04                	jle    803251 <devfile_read+0x138>
+  80324d:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803251:	48 83 c4 28          	add    $0x28,%rsp
+  803255:	5b                   	pop    %rbx
+  803256:	41 5c                	pop    %r12
+  803258:	41 5d                	pop    %r13
+  80325a:	41 5e                	pop    %r14
+  80325c:	41 5f                	pop    %r15
+  80325e:	5d                   	pop    %rbp
+  80325f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803260:	48 98                	cltq
+  803262:	eb ed                	jmp    803251 <devfile_read+0x138>
+            return res;
+  803264:	48 98                	cltq
+  803266:	eb e9                	jmp    803251 <devfile_read+0x138>
+            return i;
+  803268:	48 89 d8             	mov    %rbx,%rax
+  80326b:	eb db                	jmp    803248 <devfile_read+0x12f>
+    size_t i = 0;
+  80326d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803271:	eb d2                	jmp    803245 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803273:	48 89 c6             	mov    %rax,%rsi
+  803276:	4c 89 ff             	mov    %r15,%rdi
+  803279:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+  803285:	85 c0                	test   %eax,%eax
+  803287:	78 40                	js     8032c9 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803289:	4c 89 ff             	mov    %r15,%rdi
+  80328c:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  803293:	00 00 00 
+  803296:	ff d0                	call   *%rax
+  803298:	48 89 c2             	mov    %rax,%rdx
+  80329b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80329f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8032a3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032a7:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8032ac:	48 01 d0             	add    %rdx,%rax
+  8032af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8032b3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032b8:	0f 84 33 01 00 00    	je     8033f1 <devfile_read+0x2d8>
+    size_t i = 0;
+  8032be:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8032c4:	e9 f5 00 00 00       	jmp    8033be <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8032c9:	48 98                	cltq
+  8032cb:	eb 84                	jmp    803251 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8032cd:	44 89 e8             	mov    %r13d,%eax
+  8032d0:	66 b8 00 00          	mov    $0x0,%ax
+  8032d4:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8032d9:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8032e0:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8032e2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032e6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032ea:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8032ec:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8032f1:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8032f4:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8032fb:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8032fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803302:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803307:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80330c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803311:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	0f 88 be 00 00 00    	js     8033e3 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803325:	48 63 d0             	movslq %eax,%rdx
+  803328:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80332d:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803332:	44 39 e8             	cmp    %r13d,%eax
+  803335:	0f 8e ba 00 00 00    	jle    8033f5 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80333b:	49 63 c5             	movslq %r13d,%rax
+  80333e:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803343:	48 29 c3             	sub    %rax,%rbx
+  803346:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80334b:	48 01 c3             	add    %rax,%rbx
+  80334e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803352:	4c 29 f0             	sub    %r14,%rax
+  803355:	48 39 c3             	cmp    %rax,%rbx
+  803358:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80335c:	4c 89 ff             	mov    %r15,%rdi
+  80335f:	48 b9 8f 20 80 00 00 	movabs $0x80208f,%rcx
+  803366:	00 00 00 
+  803369:	ff d1                	call   *%rcx
+  80336b:	48 89 c2             	mov    %rax,%rdx
+  80336e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803372:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803376:	48 c1 e0 0c          	shl    $0xc,%rax
+  80337a:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80337f:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803382:	44 89 ea             	mov    %r13d,%edx
+  803385:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80338a:	48 63 d2             	movslq %edx,%rdx
+  80338d:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803394:	00 
+  803395:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803399:	4c 01 f7             	add    %r14,%rdi
+  80339c:	48 89 da             	mov    %rbx,%rdx
+  80339f:	48 b9 00 12 80 00 00 	movabs $0x801200,%rcx
+  8033a6:	00 00 00 
+  8033a9:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8033ab:	41 01 dd             	add    %ebx,%r13d
+  8033ae:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8033b2:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8033b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033b9:	49 39 c6             	cmp    %rax,%r14
+  8033bc:	73 37                	jae    8033f5 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8033be:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8033c2:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8033c7:	44 39 e8             	cmp    %r13d,%eax
+  8033ca:	0f 8f fd fe ff ff    	jg     8032cd <devfile_read+0x1b4>
+  8033d0:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8033d5:	44 39 e8             	cmp    %r13d,%eax
+  8033d8:	0f 8f 5d ff ff ff    	jg     80333b <devfile_read+0x222>
+  8033de:	e9 ea fe ff ff       	jmp    8032cd <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8033e3:	48 98                	cltq
+  8033e5:	4d 85 f6             	test   %r14,%r14
+  8033e8:	49 0f 45 c6          	cmovne %r14,%rax
+  8033ec:	e9 60 fe ff ff       	jmp    803251 <devfile_read+0x138>
+    size_t i = 0;
+  8033f1:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8033f5:	4c 89 f0             	mov    %r14,%rax
+  8033f8:	e9 54 fe ff ff       	jmp    803251 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8033fd:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803404:	e9 48 fe ff ff       	jmp    803251 <devfile_read+0x138>
+
+0000000000803409 <open>:
+open(const char *path, int mode) {
+  803409:	55                   	push   %rbp
+  80340a:	48 89 e5             	mov    %rsp,%rbp
+  80340d:	41 55                	push   %r13
+  80340f:	41 54                	push   %r12
+  803411:	53                   	push   %rbx
+  803412:	48 83 ec 18          	sub    $0x18,%rsp
+  803416:	49 89 fc             	mov    %rdi,%r12
+  803419:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80341c:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  803423:	00 00 00 
+  803426:	ff d0                	call   *%rax
+  803428:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80342e:	0f 87 8a 00 00 00    	ja     8034be <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803434:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803438:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+  803444:	89 c3                	mov    %eax,%ebx
+  803446:	85 c0                	test   %eax,%eax
+  803448:	78 50                	js     80349a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80344a:	4c 89 e6             	mov    %r12,%rsi
+  80344d:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803454:	00 00 00 
+  803457:	48 89 df             	mov    %rbx,%rdi
+  80345a:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  803461:	00 00 00 
+  803464:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803466:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80346d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803471:	bf 01 00 00 00       	mov    $0x1,%edi
+  803476:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+  803482:	89 c3                	mov    %eax,%ebx
+  803484:	85 c0                	test   %eax,%eax
+  803486:	78 1f                	js     8034a7 <open+0x9e>
+    return fd2num(fd);
+  803488:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80348c:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  803493:	00 00 00 
+  803496:	ff d0                	call   *%rax
+  803498:	89 c3                	mov    %eax,%ebx
+}
+  80349a:	89 d8                	mov    %ebx,%eax
+  80349c:	48 83 c4 18          	add    $0x18,%rsp
+  8034a0:	5b                   	pop    %rbx
+  8034a1:	41 5c                	pop    %r12
+  8034a3:	41 5d                	pop    %r13
+  8034a5:	5d                   	pop    %rbp
+  8034a6:	c3                   	ret
+        fd_close(fd, 0);
+  8034a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8034ac:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034b0:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  8034b7:	00 00 00 
+  8034ba:	ff d0                	call   *%rax
+        return res;
+  8034bc:	eb dc                	jmp    80349a <open+0x91>
+        return -E_BAD_PATH;
+  8034be:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8034c3:	eb d5                	jmp    80349a <open+0x91>
+
+00000000008034c5 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8034c5:	55                   	push   %rbp
+  8034c6:	48 89 e5             	mov    %rsp,%rbp
+  8034c9:	41 57                	push   %r15
+  8034cb:	41 56                	push   %r14
+  8034cd:	41 55                	push   %r13
+  8034cf:	41 54                	push   %r12
+  8034d1:	53                   	push   %rbx
+  8034d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8034d6:	41 89 f6             	mov    %esi,%r14d
+  8034d9:	49 89 d7             	mov    %rdx,%r15
+  8034dc:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034df:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034e3:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8034ea:	00 00 00 
+  8034ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	0f 88 db 00 00 00    	js     8035d2 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034f7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8034fb:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  803502:	00 00 00 
+  803505:	8b 00                	mov    (%rax),%eax
+  803507:	39 07                	cmp    %eax,(%rdi)
+  803509:	0f 85 db 00 00 00    	jne    8035ea <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80350f:	45 85 f6             	test   %r14d,%r14d
+  803512:	0f 88 db 00 00 00    	js     8035f3 <fmap+0x12e>
+  803518:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80351f:	0f 85 d7 00 00 00    	jne    8035fc <fmap+0x137>
+  803525:	4c 89 fb             	mov    %r15,%rbx
+  803528:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80352e:	0f 85 d1 00 00 00    	jne    803605 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803534:	48 b8 55 2c 80 00 00 	movabs $0x802c55,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+  803540:	85 c0                	test   %eax,%eax
+  803542:	0f 88 8e 00 00 00    	js     8035d6 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803548:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80354f:	00 00 00 
+    while (i < n) {
+  803552:	4d 85 ed             	test   %r13,%r13
+  803555:	0f 84 8a 00 00 00    	je     8035e5 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80355b:	4c 89 ea             	mov    %r13,%rdx
+  80355e:	48 29 da             	sub    %rbx,%rdx
+  803561:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803568:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80356e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803572:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803576:	8b 40 0c             	mov    0xc(%rax),%eax
+  803579:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80357d:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803581:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803586:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80358b:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80358f:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803593:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803598:	4c 89 e6             	mov    %r12,%rsi
+  80359b:	bf 09 00 00 00       	mov    $0x9,%edi
+  8035a0:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8035a7:	00 00 00 
+  8035aa:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	78 2a                	js     8035da <fmap+0x115>
+        i += res;
+  8035b0:	48 98                	cltq
+  8035b2:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8035b5:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8035b9:	72 05                	jb     8035c0 <fmap+0xfb>
+    while (i < n) {
+  8035bb:	4c 39 eb             	cmp    %r13,%rbx
+  8035be:	72 9b                	jb     80355b <fmap+0x96>
+    }
+    return i;
+  8035c0:	48 89 d8             	mov    %rbx,%rax
+}
+  8035c3:	48 83 c4 18          	add    $0x18,%rsp
+  8035c7:	5b                   	pop    %rbx
+  8035c8:	41 5c                	pop    %r12
+  8035ca:	41 5d                	pop    %r13
+  8035cc:	41 5e                	pop    %r14
+  8035ce:	41 5f                	pop    %r15
+  8035d0:	5d                   	pop    %rbp
+  8035d1:	c3                   	ret
+    if (res < 0) return res;
+  8035d2:	48 98                	cltq
+  8035d4:	eb ed                	jmp    8035c3 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035d6:	48 98                	cltq
+  8035d8:	eb e9                	jmp    8035c3 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8035da:	48 98                	cltq
+  8035dc:	48 85 db             	test   %rbx,%rbx
+  8035df:	48 0f 45 c3          	cmovne %rbx,%rax
+  8035e3:	eb de                	jmp    8035c3 <fmap+0xfe>
+    size_t i = 0;
+  8035e5:	4c 89 eb             	mov    %r13,%rbx
+  8035e8:	eb d6                	jmp    8035c0 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035ea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8035f1:	eb d0                	jmp    8035c3 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8035f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8035fa:	eb c7                	jmp    8035c3 <fmap+0xfe>
+  8035fc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803603:	eb be                	jmp    8035c3 <fmap+0xfe>
+  803605:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80360c:	eb b5                	jmp    8035c3 <fmap+0xfe>
+
+000000000080360e <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80360e:	55                   	push   %rbp
+  80360f:	48 89 e5             	mov    %rsp,%rbp
+  803612:	41 56                	push   %r14
+  803614:	41 55                	push   %r13
+  803616:	41 54                	push   %r12
+  803618:	53                   	push   %rbx
+  803619:	48 83 ec 10          	sub    $0x10,%rsp
+  80361d:	89 fb                	mov    %edi,%ebx
+  80361f:	41 89 f4             	mov    %esi,%r12d
+  803622:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803625:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803629:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  803630:	00 00 00 
+  803633:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803635:	85 c0                	test   %eax,%eax
+  803637:	78 63                	js     80369c <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803639:	45 85 e4             	test   %r12d,%r12d
+  80363c:	0f 88 80 00 00 00    	js     8036c2 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803642:	45 89 e6             	mov    %r12d,%r14d
+  803645:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80364c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803650:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+  80365c:	48 89 c2             	mov    %rax,%rdx
+  80365f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803664:	44 89 f6             	mov    %r14d,%esi
+  803667:	89 df                	mov    %ebx,%edi
+  803669:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+  803675:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803678:	45 29 f4             	sub    %r14d,%r12d
+  80367b:	4d 63 f4             	movslq %r12d,%r14
+  80367e:	49 39 c6             	cmp    %rax,%r14
+  803681:	7c 1d                	jl     8036a0 <read_map+0x92>
+  803683:	48 85 c0             	test   %rax,%rax
+  803686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368b:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80368f:	48 83 c4 10          	add    $0x10,%rsp
+  803693:	5b                   	pop    %rbx
+  803694:	41 5c                	pop    %r12
+  803696:	41 5d                	pop    %r13
+  803698:	41 5e                	pop    %r14
+  80369a:	5d                   	pop    %rbp
+  80369b:	c3                   	ret
+    if (res < 0) return res;
+  80369c:	48 98                	cltq
+  80369e:	eb ef                	jmp    80368f <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8036a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036a4:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+  8036b0:	4d 63 e4             	movslq %r12d,%r12
+  8036b3:	4c 01 e0             	add    %r12,%rax
+  8036b6:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8036ba:	48 89 d8             	mov    %rbx,%rax
+  8036bd:	4c 29 f0             	sub    %r14,%rax
+  8036c0:	eb cd                	jmp    80368f <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8036c2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036c9:	eb c4                	jmp    80368f <read_map+0x81>
+
+00000000008036cb <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8036cb:	55                   	push   %rbp
+  8036cc:	48 89 e5             	mov    %rsp,%rbp
+  8036cf:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8036d3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036d7:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8036de:	00 00 00 
+  8036e1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036e3:	85 c0                	test   %eax,%eax
+  8036e5:	78 4a                	js     803731 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036eb:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  8036f2:	00 00 00 
+  8036f5:	8b 00                	mov    (%rax),%eax
+  8036f7:	39 07                	cmp    %eax,(%rdi)
+  8036f9:	75 38                	jne    803733 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8036fb:	48 b8 55 2c 80 00 00 	movabs $0x802c55,%rax
+  803702:	00 00 00 
+  803705:	ff d0                	call   *%rax
+  803707:	85 c0                	test   %eax,%eax
+  803709:	78 26                	js     803731 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80370b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80370f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803712:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803719:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80371b:	be 00 00 00 00       	mov    $0x0,%esi
+  803720:	bf 06 00 00 00       	mov    $0x6,%edi
+  803725:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  80372c:	00 00 00 
+  80372f:	ff d0                	call   *%rax
+}
+  803731:	c9                   	leave
+  803732:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803733:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803738:	eb f7                	jmp    803731 <fsync+0x66>
+
+000000000080373a <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80373a:	55                   	push   %rbp
+  80373b:	48 89 e5             	mov    %rsp,%rbp
+  80373e:	41 57                	push   %r15
+  803740:	41 56                	push   %r14
+  803742:	41 55                	push   %r13
+  803744:	41 54                	push   %r12
+  803746:	53                   	push   %rbx
+  803747:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80374b:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803752:	00 00 00 
+  803755:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80375a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803760:	49 bd 1d 21 80 00 00 	movabs $0x80211d,%r13
+  803767:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80376a:	49 be 40 60 80 00 00 	movabs $0x806040,%r14
+  803771:	00 00 00 
+  803774:	eb 0c                	jmp    803782 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803776:	83 c3 01             	add    $0x1,%ebx
+  803779:	49 83 c4 28          	add    $0x28,%r12
+  80377d:	83 fb 20             	cmp    $0x20,%ebx
+  803780:	74 33                	je     8037b5 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803782:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803787:	74 ed                	je     803776 <flushall+0x3c>
+  803789:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80378d:	89 df                	mov    %ebx,%edi
+  80378f:	41 ff d5             	call   *%r13
+  803792:	85 c0                	test   %eax,%eax
+  803794:	78 e0                	js     803776 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803796:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80379a:	41 8b 06             	mov    (%r14),%eax
+  80379d:	39 07                	cmp    %eax,(%rdi)
+  80379f:	75 d5                	jne    803776 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8037a1:	48 b8 55 2c 80 00 00 	movabs $0x802c55,%rax
+  8037a8:	00 00 00 
+  8037ab:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8037ad:	85 c0                	test   %eax,%eax
+  8037af:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8037b3:	eb c1                	jmp    803776 <flushall+0x3c>
+    }
+    return res;
+}
+  8037b5:	44 89 f8             	mov    %r15d,%eax
+  8037b8:	48 83 c4 18          	add    $0x18,%rsp
+  8037bc:	5b                   	pop    %rbx
+  8037bd:	41 5c                	pop    %r12
+  8037bf:	41 5d                	pop    %r13
+  8037c1:	41 5e                	pop    %r14
+  8037c3:	41 5f                	pop    %r15
+  8037c5:	5d                   	pop    %rbp
+  8037c6:	c3                   	ret
+
+00000000008037c7 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8037c7:	55                   	push   %rbp
+  8037c8:	48 89 e5             	mov    %rsp,%rbp
+  8037cb:	53                   	push   %rbx
+  8037cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d0:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8037d3:	40 0f b6 c6          	movzbl %sil,%eax
+  8037d7:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8037de:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8037e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8037e5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8037ea:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  8037f1:	00 00 00 
+  8037f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037f6:	85 c0                	test   %eax,%eax
+  8037f8:	78 23                	js     80381d <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8037fa:	ba 58 06 00 00       	mov    $0x658,%edx
+  8037ff:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803806:	00 00 00 
+  803809:	48 89 df             	mov    %rbx,%rdi
+  80380c:	48 b8 00 12 80 00 00 	movabs $0x801200,%rax
+  803813:	00 00 00 
+  803816:	ff d0                	call   *%rax
+    return 0;
+  803818:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80381d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803821:	c9                   	leave
+  803822:	c3                   	ret
+
+0000000000803823 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803823:	55                   	push   %rbp
+  803824:	48 89 e5             	mov    %rsp,%rbp
+  803827:	53                   	push   %rbx
+  803828:	48 83 ec 08          	sub    $0x8,%rsp
+  80382c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80382f:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  803836:	00 00 00 
+  803839:	ff d0                	call   *%rax
+  80383b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803841:	77 35                	ja     803878 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803843:	48 89 de             	mov    %rbx,%rsi
+  803846:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80384d:	00 00 00 
+  803850:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  803857:	00 00 00 
+  80385a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80385c:	be 00 00 00 00       	mov    $0x0,%esi
+  803861:	bf 07 00 00 00       	mov    $0x7,%edi
+  803866:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  80386d:	00 00 00 
+  803870:	ff d0                	call   *%rax
+}
+  803872:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803876:	c9                   	leave
+  803877:	c3                   	ret
+        return -E_BAD_PATH;
+  803878:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80387d:	eb f3                	jmp    803872 <remove+0x4f>
+
+000000000080387f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80387f:	55                   	push   %rbp
+  803880:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803883:	48 b8 3a 37 80 00 00 	movabs $0x80373a,%rax
+  80388a:	00 00 00 
+  80388d:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80388f:	be 00 00 00 00       	mov    $0x0,%esi
+  803894:	bf 08 00 00 00       	mov    $0x8,%edi
+  803899:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  8038a0:	00 00 00 
+  8038a3:	ff d0                	call   *%rax
+}
+  8038a5:	5d                   	pop    %rbp
+  8038a6:	c3                   	ret
+
+00000000008038a7 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8038a7:	55                   	push   %rbp
+  8038a8:	48 89 e5             	mov    %rsp,%rbp
+  8038ab:	41 55                	push   %r13
+  8038ad:	41 54                	push   %r12
+  8038af:	53                   	push   %rbx
+  8038b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8038b4:	48 89 fb             	mov    %rdi,%rbx
+  8038b7:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8038ba:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8038bd:	48 b8 b1 48 80 00 00 	movabs $0x8048b1,%rax
+  8038c4:	00 00 00 
+  8038c7:	ff d0                	call   *%rax
+  8038c9:	41 89 c1             	mov    %eax,%r9d
+  8038cc:	4d 89 e0             	mov    %r12,%r8
+  8038cf:	49 29 d8             	sub    %rbx,%r8
+  8038d2:	48 89 d9             	mov    %rbx,%rcx
+  8038d5:	44 89 ea             	mov    %r13d,%edx
+  8038d8:	48 89 de             	mov    %rbx,%rsi
+  8038db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e0:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8038e7:	00 00 00 
+  8038ea:	ff d0                	call   *%rax
+}
+  8038ec:	48 83 c4 08          	add    $0x8,%rsp
+  8038f0:	5b                   	pop    %rbx
+  8038f1:	41 5c                	pop    %r12
+  8038f3:	41 5d                	pop    %r13
+  8038f5:	5d                   	pop    %rbp
+  8038f6:	c3                   	ret
+
+00000000008038f7 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+  8038fb:	41 57                	push   %r15
+  8038fd:	41 56                	push   %r14
+  8038ff:	41 55                	push   %r13
+  803901:	41 54                	push   %r12
+  803903:	53                   	push   %rbx
+  803904:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  80390b:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  80390e:	be 00 00 00 00       	mov    $0x0,%esi
+  803913:	48 b8 09 34 80 00 00 	movabs $0x803409,%rax
+  80391a:	00 00 00 
+  80391d:	ff d0                	call   *%rax
+  80391f:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  803925:	85 c0                	test   %eax,%eax
+  803927:	0f 88 8f 06 00 00    	js     803fbc <spawn+0x6c5>
+  80392d:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  80392f:	ba 00 02 00 00       	mov    $0x200,%edx
+  803934:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  80393b:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+  803947:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803949:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80394e:	0f 85 88 02 00 00    	jne    803bdc <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803954:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  80395b:	ff ff 00 
+  80395e:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803965:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  80396c:	01 01 00 
+  80396f:	48 39 d0             	cmp    %rdx,%rax
+  803972:	0f 85 a0 02 00 00    	jne    803c18 <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803978:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  80397f:	00 3e 00 
+  803982:	0f 85 90 02 00 00    	jne    803c18 <spawn+0x321>
+    flushall();
+  803988:	48 b8 3a 37 80 00 00 	movabs $0x80373a,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+  803994:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803999:	cd 30                	int    $0x30
+  80399b:	41 89 c7             	mov    %eax,%r15d
+  80399e:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8039a4:	85 c0                	test   %eax,%eax
+  8039a6:	0f 88 f2 05 00 00    	js     803f9e <spawn+0x6a7>
+    envid_t child = res;
+  8039ac:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8039b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8039b7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8039be:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8039c5:	00 00 00 
+  8039c8:	48 01 c6             	add    %rax,%rsi
+  8039cb:	48 8b 06             	mov    (%rsi),%rax
+  8039ce:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8039d5:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8039dc:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8039e3:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8039ea:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8039f1:	48 29 ce             	sub    %rcx,%rsi
+  8039f4:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8039fa:	c1 e9 03             	shr    $0x3,%ecx
+  8039fd:	89 c9                	mov    %ecx,%ecx
+  8039ff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803a02:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803a09:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803a10:	48 8b 3b             	mov    (%rbx),%rdi
+  803a13:	48 85 ff             	test   %rdi,%rdi
+  803a16:	0f 84 b8 05 00 00    	je     803fd4 <spawn+0x6dd>
+  803a1c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803a22:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803a28:	49 be cd 0d 80 00 00 	movabs $0x800dcd,%r14
+  803a2f:	00 00 00 
+  803a32:	41 ff d6             	call   *%r14
+  803a35:	4c 01 e8             	add    %r13,%rax
+  803a38:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803a3c:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  803a43:	49 83 c4 01          	add    $0x1,%r12
+  803a47:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  803a4c:	48 85 ff             	test   %rdi,%rdi
+  803a4f:	75 e1                	jne    803a32 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803a51:	48 f7 d0             	not    %rax
+  803a54:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803a5b:	4d 89 e6             	mov    %r12,%r14
+  803a5e:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  803a62:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  803a69:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  803a70:	44 89 e8             	mov    %r13d,%eax
+  803a73:	83 c0 01             	add    $0x1,%eax
+  803a76:	48 98                	cltq
+  803a78:	48 c1 e0 03          	shl    $0x3,%rax
+  803a7c:	49 29 c6             	sub    %rax,%r14
+  803a7f:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803a86:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  803a8a:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803a90:	0f 86 eb 04 00 00    	jbe    803f81 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803a96:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803a9b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803aa0:	be 00 00 40 00       	mov    $0x400000,%esi
+  803aa5:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803aac:	00 00 00 
+  803aaf:	ff d0                	call   *%rax
+  803ab1:	85 c0                	test   %eax,%eax
+  803ab3:	0f 88 cd 04 00 00    	js     803f86 <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  803ab9:	4c 89 e8             	mov    %r13,%rax
+  803abc:	45 85 ed             	test   %r13d,%r13d
+  803abf:	7e 52                	jle    803b13 <spawn+0x21c>
+  803ac1:	4d 89 f5             	mov    %r14,%r13
+  803ac4:	48 98                	cltq
+  803ac6:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803aca:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803ad1:	00 00 00 
+  803ad4:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803adb:	ff 
+  803adc:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803ae0:	48 8b 33             	mov    (%rbx),%rsi
+  803ae3:	4c 89 e7             	mov    %r12,%rdi
+  803ae6:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803af2:	48 8b 3b             	mov    (%rbx),%rdi
+  803af5:	48 b8 cd 0d 80 00 00 	movabs $0x800dcd,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+  803b01:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803b06:	49 83 c5 08          	add    $0x8,%r13
+  803b0a:	48 83 c3 08          	add    $0x8,%rbx
+  803b0e:	4d 39 f5             	cmp    %r14,%r13
+  803b11:	75 b7                	jne    803aca <spawn+0x1d3>
+    argv_store[argc] = 0;
+  803b13:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803b1a:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803b21:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803b22:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803b29:	0f 85 30 01 00 00    	jne    803c5f <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803b2f:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803b36:	00 00 00 
+  803b39:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803b40:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803b47:	ff 
+  803b48:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803b4c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803b53:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803b57:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803b5e:	00 00 00 
+  803b61:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803b68:	ff 
+  803b69:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803b70:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803b76:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803b7c:	44 89 fa             	mov    %r15d,%edx
+  803b7f:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b84:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b89:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  803b90:	00 00 00 
+  803b93:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803b95:	48 bb 4a 17 80 00 00 	movabs $0x80174a,%rbx
+  803b9c:	00 00 00 
+  803b9f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803ba4:	be 00 00 40 00       	mov    $0x400000,%esi
+  803ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bae:	ff d3                	call   *%rbx
+  803bb0:	85 c0                	test   %eax,%eax
+  803bb2:	78 eb                	js     803b9f <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803bb4:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803bbb:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  803bc2:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803bc3:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803bca:	00 
+  803bcb:	0f 84 a1 02 00 00    	je     803e72 <spawn+0x57b>
+  803bd1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bd7:	e9 dd 00 00 00       	jmp    803cb9 <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803bdc:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  803be3:	00 00 00 
+  803be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803beb:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  803bf2:	00 00 00 
+  803bf5:	ff d2                	call   *%rdx
+        close(fd);
+  803bf7:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803bfd:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  803c04:	00 00 00 
+  803c07:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803c09:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803c10:	ff ff ff 
+  803c13:	e9 a4 03 00 00       	jmp    803fbc <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803c18:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803c1d:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803c23:	48 bf e0 57 80 00 00 	movabs $0x8057e0,%rdi
+  803c2a:	00 00 00 
+  803c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c32:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  803c39:	00 00 00 
+  803c3c:	ff d1                	call   *%rcx
+        close(fd);
+  803c3e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803c44:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  803c4b:	00 00 00 
+  803c4e:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803c50:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803c57:	ff ff ff 
+  803c5a:	e9 5d 03 00 00       	jmp    803fbc <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803c5f:	48 b9 b0 57 80 00 00 	movabs $0x8057b0,%rcx
+  803c66:	00 00 00 
+  803c69:	48 ba fa 57 80 00 00 	movabs $0x8057fa,%rdx
+  803c70:	00 00 00 
+  803c73:	be f3 00 00 00       	mov    $0xf3,%esi
+  803c78:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803c7f:	00 00 00 
+  803c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c87:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803c8e:	00 00 00 
+  803c91:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803c94:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  803c9b:	0f 88 eb 02 00 00    	js     803f8c <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803ca1:	49 83 c7 01          	add    $0x1,%r15
+  803ca5:	48 83 c3 38          	add    $0x38,%rbx
+  803ca9:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803cb0:	49 39 c7             	cmp    %rax,%r15
+  803cb3:	0f 83 b9 01 00 00    	jae    803e72 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803cb9:	83 3b 01             	cmpl   $0x1,(%rbx)
+  803cbc:	75 e3                	jne    803ca1 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803cbe:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cc1:	41 89 c4             	mov    %eax,%r12d
+  803cc4:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803cc8:	44 89 e2             	mov    %r12d,%edx
+  803ccb:	83 ca 04             	or     $0x4,%edx
+  803cce:	a8 04                	test   $0x4,%al
+  803cd0:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803cd4:	44 89 e2             	mov    %r12d,%edx
+  803cd7:	83 ca 01             	or     $0x1,%edx
+  803cda:	a8 01                	test   $0x1,%al
+  803cdc:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803ce0:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  803ce4:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  803cea:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  803cee:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  803cf2:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  803cf6:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  803cfd:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803d03:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  803d09:	89 f2                	mov    %esi,%edx
+  803d0b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803d11:	74 1b                	je     803d2e <spawn+0x437>
+        va -= res;
+  803d13:	48 63 ca             	movslq %edx,%rcx
+  803d16:	48 29 ce             	sub    %rcx,%rsi
+  803d19:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  803d20:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  803d23:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  803d26:	29 d0                	sub    %edx,%eax
+  803d28:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  803d2e:	b8 00 00 20 00       	mov    $0x200000,%eax
+  803d33:	49 39 c6             	cmp    %rax,%r14
+  803d36:	49 0f 46 c6          	cmovbe %r14,%rax
+  803d3a:	4c 39 e8             	cmp    %r13,%rax
+  803d3d:	0f 82 32 02 00 00    	jb     803f75 <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  803d43:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803d4a:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  803d51:	00 
+  803d52:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803d59:	44 89 e1             	mov    %r12d,%ecx
+  803d5c:	4c 89 f2             	mov    %r14,%rdx
+  803d5f:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  803d65:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803d6c:	00 00 00 
+  803d6f:	ff d0                	call   *%rax
+  803d71:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  803d77:	4d 39 f5             	cmp    %r14,%r13
+  803d7a:	73 08                	jae    803d84 <spawn+0x48d>
+  803d7c:	85 c0                	test   %eax,%eax
+  803d7e:	0f 85 10 ff ff ff    	jne    803c94 <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  803d84:	4d 85 ed             	test   %r13,%r13
+  803d87:	0f 84 14 ff ff ff    	je     803ca1 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  803d8d:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803d94:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803d9a:	49 89 c6             	mov    %rax,%r14
+  803d9d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803da2:	48 89 c2             	mov    %rax,%rdx
+  803da5:	be 00 00 40 00       	mov    $0x400000,%esi
+  803daa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803daf:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+  803dbb:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803dc1:	85 c0                	test   %eax,%eax
+  803dc3:	0f 85 cb fe ff ff    	jne    803c94 <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  803dc9:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  803dcf:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803dd5:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+  803de1:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803de7:	85 c0                	test   %eax,%eax
+  803de9:	0f 85 a5 fe ff ff    	jne    803c94 <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  803def:	4c 89 ea             	mov    %r13,%rdx
+  803df2:	be 00 00 40 00       	mov    $0x400000,%esi
+  803df7:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803dfd:	48 b8 be 24 80 00 00 	movabs $0x8024be,%rax
+  803e04:	00 00 00 
+  803e07:	ff d0                	call   *%rax
+  803e09:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  803e0f:	85 c0                	test   %eax,%eax
+  803e11:	0f 88 75 01 00 00    	js     803f8c <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  803e17:	45 89 e1             	mov    %r12d,%r9d
+  803e1a:	4d 89 f0             	mov    %r14,%r8
+  803e1d:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  803e24:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  803e2a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e34:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  803e3b:	00 00 00 
+  803e3e:	ff d0                	call   *%rax
+  803e40:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803e46:	85 c0                	test   %eax,%eax
+  803e48:	0f 85 46 fe ff ff    	jne    803c94 <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  803e4e:	4c 89 f2             	mov    %r14,%rdx
+  803e51:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e5b:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  803e62:	00 00 00 
+  803e65:	ff d0                	call   *%rax
+  803e67:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803e6d:	e9 22 fe ff ff       	jmp    803c94 <spawn+0x39d>
+    close(fd);
+  803e72:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803e78:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  803e7f:	00 00 00 
+  803e82:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803e84:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803e8b:	48 bf a7 38 80 00 00 	movabs $0x8038a7,%rdi
+  803e92:	00 00 00 
+  803e95:	48 b8 25 49 80 00 00 	movabs $0x804925,%rax
+  803e9c:	00 00 00 
+  803e9f:	ff d0                	call   *%rax
+  803ea1:	85 c0                	test   %eax,%eax
+  803ea3:	78 49                	js     803eee <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803ea5:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803eac:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803eb2:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  803eb9:	00 00 00 
+  803ebc:	ff d0                	call   *%rax
+  803ebe:	85 c0                	test   %eax,%eax
+  803ec0:	78 59                	js     803f1b <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803ec2:	be 02 00 00 00       	mov    $0x2,%esi
+  803ec7:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803ecd:	48 b8 b1 17 80 00 00 	movabs $0x8017b1,%rax
+  803ed4:	00 00 00 
+  803ed7:	ff d0                	call   *%rax
+  803ed9:	85 c0                	test   %eax,%eax
+  803edb:	78 6b                	js     803f48 <spawn+0x651>
+    return child;
+  803edd:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803ee3:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  803ee9:	e9 ce 00 00 00       	jmp    803fbc <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  803eee:	89 c1                	mov    %eax,%ecx
+  803ef0:	48 ba 1b 58 80 00 00 	movabs $0x80581b,%rdx
+  803ef7:	00 00 00 
+  803efa:	be 87 00 00 00       	mov    $0x87,%esi
+  803eff:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803f06:	00 00 00 
+  803f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0e:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803f15:	00 00 00 
+  803f18:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803f1b:	89 c1                	mov    %eax,%ecx
+  803f1d:	48 ba 32 58 80 00 00 	movabs $0x805832,%rdx
+  803f24:	00 00 00 
+  803f27:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803f2c:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803f33:	00 00 00 
+  803f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3b:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803f42:	00 00 00 
+  803f45:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803f48:	89 c1                	mov    %eax,%ecx
+  803f4a:	48 ba 4c 58 80 00 00 	movabs $0x80584c,%rdx
+  803f51:	00 00 00 
+  803f54:	be 8d 00 00 00       	mov    $0x8d,%esi
+  803f59:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803f60:	00 00 00 
+  803f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f68:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803f6f:	00 00 00 
+  803f72:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  803f75:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  803f7c:	ff ff ff 
+  803f7f:	eb 0b                	jmp    803f8c <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803f81:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803f86:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  803f8c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803f92:	48 b8 40 14 80 00 00 	movabs $0x801440,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+    close(fd);
+  803f9e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803fa4:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+    return res;
+  803fb0:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  803fb6:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  803fbc:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  803fc2:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803fc9:	5b                   	pop    %rbx
+  803fca:	41 5c                	pop    %r12
+  803fcc:	41 5d                	pop    %r13
+  803fce:	41 5e                	pop    %r14
+  803fd0:	41 5f                	pop    %r15
+  803fd2:	5d                   	pop    %rbp
+  803fd3:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803fd4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803fd9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803fde:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe8:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803fef:	00 00 00 
+  803ff2:	ff d0                	call   *%rax
+  803ff4:	85 c0                	test   %eax,%eax
+  803ff6:	78 8e                	js     803f86 <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803ff8:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803fff:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804003:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  80400a:	f8 ff 40 00 
+  80400e:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  804015:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804019:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  80401f:	e9 ef fa ff ff       	jmp    803b13 <spawn+0x21c>
+
+0000000000804024 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804024:	55                   	push   %rbp
+  804025:	48 89 e5             	mov    %rsp,%rbp
+  804028:	48 83 ec 50          	sub    $0x50,%rsp
+  80402c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804030:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804034:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804038:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80403c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804043:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804047:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80404b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80404f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804053:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804058:	eb 15                	jmp    80406f <spawnl+0x4b>
+  80405a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80405e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804062:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804066:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80406a:	74 1c                	je     804088 <spawnl+0x64>
+  80406c:	83 c1 01             	add    $0x1,%ecx
+  80406f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804072:	83 f8 2f             	cmp    $0x2f,%eax
+  804075:	77 e3                	ja     80405a <spawnl+0x36>
+  804077:	89 c2                	mov    %eax,%edx
+  804079:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80407d:	4c 01 d2             	add    %r10,%rdx
+  804080:	83 c0 08             	add    $0x8,%eax
+  804083:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804086:	eb de                	jmp    804066 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804088:	8d 41 02             	lea    0x2(%rcx),%eax
+  80408b:	48 98                	cltq
+  80408d:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804094:	00 
+  804095:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804099:	48 29 c4             	sub    %rax,%rsp
+  80409c:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8040a1:	4c 89 c0             	mov    %r8,%rax
+  8040a4:	48 c1 e8 03          	shr    $0x3,%rax
+  8040a8:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8040ac:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8040b3:	00 
+    argv[argc + 1] = NULL;
+  8040b4:	8d 41 01             	lea    0x1(%rcx),%eax
+  8040b7:	48 98                	cltq
+  8040b9:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8040c0:	00 
+    va_start(vl, arg0);
+  8040c1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8040c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8040cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8040d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8040d8:	85 c9                	test   %ecx,%ecx
+  8040da:	74 41                	je     80411d <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8040dc:	49 89 c1             	mov    %rax,%r9
+  8040df:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8040e3:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8040e6:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8040eb:	eb 1b                	jmp    804108 <spawnl+0xe4>
+  8040ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8040f1:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8040f5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8040f9:	48 8b 11             	mov    (%rcx),%rdx
+  8040fc:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8040ff:	48 83 c0 08          	add    $0x8,%rax
+  804103:	48 39 f0             	cmp    %rsi,%rax
+  804106:	74 15                	je     80411d <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804108:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80410b:	83 fa 2f             	cmp    $0x2f,%edx
+  80410e:	77 dd                	ja     8040ed <spawnl+0xc9>
+  804110:	89 d1                	mov    %edx,%ecx
+  804112:	4c 01 c9             	add    %r9,%rcx
+  804115:	83 c2 08             	add    $0x8,%edx
+  804118:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80411b:	eb dc                	jmp    8040f9 <spawnl+0xd5>
+    return spawn(prog, argv);
+  80411d:	4c 89 c6             	mov    %r8,%rsi
+  804120:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  804127:	00 00 00 
+  80412a:	ff d0                	call   *%rax
+}
+  80412c:	c9                   	leave
+  80412d:	c3                   	ret
+
+000000000080412e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80412e:	55                   	push   %rbp
+  80412f:	48 89 e5             	mov    %rsp,%rbp
+  804132:	41 54                	push   %r12
+  804134:	53                   	push   %rbx
+  804135:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804138:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  80413f:	00 00 00 
+  804142:	ff d0                	call   *%rax
+  804144:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804147:	48 be 63 58 80 00 00 	movabs $0x805863,%rsi
+  80414e:	00 00 00 
+  804151:	48 89 df             	mov    %rbx,%rdi
+  804154:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804160:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804165:	41 2b 04 24          	sub    (%r12),%eax
+  804169:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80416f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804176:	00 00 00 
+    stat->st_dev = &devpipe;
+  804179:	48 b8 80 60 80 00 00 	movabs $0x806080,%rax
+  804180:	00 00 00 
+  804183:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80418a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80418f:	5b                   	pop    %rbx
+  804190:	41 5c                	pop    %r12
+  804192:	5d                   	pop    %rbp
+  804193:	c3                   	ret
+
+0000000000804194 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804194:	55                   	push   %rbp
+  804195:	48 89 e5             	mov    %rsp,%rbp
+  804198:	41 54                	push   %r12
+  80419a:	53                   	push   %rbx
+  80419b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80419e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041a3:	48 89 fe             	mov    %rdi,%rsi
+  8041a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ab:	49 bc 4a 17 80 00 00 	movabs $0x80174a,%r12
+  8041b2:	00 00 00 
+  8041b5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8041b8:	48 89 df             	mov    %rbx,%rdi
+  8041bb:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  8041c2:	00 00 00 
+  8041c5:	ff d0                	call   *%rax
+  8041c7:	48 89 c6             	mov    %rax,%rsi
+  8041ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d4:	41 ff d4             	call   *%r12
+}
+  8041d7:	5b                   	pop    %rbx
+  8041d8:	41 5c                	pop    %r12
+  8041da:	5d                   	pop    %rbp
+  8041db:	c3                   	ret
+
+00000000008041dc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041dc:	55                   	push   %rbp
+  8041dd:	48 89 e5             	mov    %rsp,%rbp
+  8041e0:	41 57                	push   %r15
+  8041e2:	41 56                	push   %r14
+  8041e4:	41 55                	push   %r13
+  8041e6:	41 54                	push   %r12
+  8041e8:	53                   	push   %rbx
+  8041e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8041ed:	49 89 fc             	mov    %rdi,%r12
+  8041f0:	49 89 f5             	mov    %rsi,%r13
+  8041f3:	49 89 d7             	mov    %rdx,%r15
+  8041f6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041fa:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  804201:	00 00 00 
+  804204:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804206:	4d 85 ff             	test   %r15,%r15
+  804209:	0f 84 af 00 00 00    	je     8042be <devpipe_write+0xe2>
+  80420f:	48 89 c3             	mov    %rax,%rbx
+  804212:	4c 89 f8             	mov    %r15,%rax
+  804215:	4d 89 ef             	mov    %r13,%r15
+  804218:	4c 01 e8             	add    %r13,%rax
+  80421b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80421f:	49 bd 3f 15 80 00 00 	movabs $0x80153f,%r13
+  804226:	00 00 00 
+            sys_yield();
+  804229:	49 be dc 14 80 00 00 	movabs $0x8014dc,%r14
+  804230:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804233:	8b 73 04             	mov    0x4(%rbx),%esi
+  804236:	48 63 ce             	movslq %esi,%rcx
+  804239:	48 63 03             	movslq (%rbx),%rax
+  80423c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804242:	48 39 c1             	cmp    %rax,%rcx
+  804245:	72 2e                	jb     804275 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804247:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80424c:	48 89 da             	mov    %rbx,%rdx
+  80424f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804254:	4c 89 e7             	mov    %r12,%rdi
+  804257:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80425a:	85 c0                	test   %eax,%eax
+  80425c:	74 66                	je     8042c4 <devpipe_write+0xe8>
+            sys_yield();
+  80425e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804261:	8b 73 04             	mov    0x4(%rbx),%esi
+  804264:	48 63 ce             	movslq %esi,%rcx
+  804267:	48 63 03             	movslq (%rbx),%rax
+  80426a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804270:	48 39 c1             	cmp    %rax,%rcx
+  804273:	73 d2                	jae    804247 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804275:	41 0f b6 3f          	movzbl (%r15),%edi
+  804279:	48 89 ca             	mov    %rcx,%rdx
+  80427c:	48 c1 ea 03          	shr    $0x3,%rdx
+  804280:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804287:	08 10 20 
+  80428a:	48 f7 e2             	mul    %rdx
+  80428d:	48 c1 ea 06          	shr    $0x6,%rdx
+  804291:	48 89 d0             	mov    %rdx,%rax
+  804294:	48 c1 e0 09          	shl    $0x9,%rax
+  804298:	48 29 d0             	sub    %rdx,%rax
+  80429b:	48 c1 e0 03          	shl    $0x3,%rax
+  80429f:	48 29 c1             	sub    %rax,%rcx
+  8042a2:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8042a7:	83 c6 01             	add    $0x1,%esi
+  8042aa:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042ad:	49 83 c7 01          	add    $0x1,%r15
+  8042b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042b5:	49 39 c7             	cmp    %rax,%r15
+  8042b8:	0f 85 75 ff ff ff    	jne    804233 <devpipe_write+0x57>
+    return n;
+  8042be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042c2:	eb 05                	jmp    8042c9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8042c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042c9:	48 83 c4 18          	add    $0x18,%rsp
+  8042cd:	5b                   	pop    %rbx
+  8042ce:	41 5c                	pop    %r12
+  8042d0:	41 5d                	pop    %r13
+  8042d2:	41 5e                	pop    %r14
+  8042d4:	41 5f                	pop    %r15
+  8042d6:	5d                   	pop    %rbp
+  8042d7:	c3                   	ret
+
+00000000008042d8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042d8:	55                   	push   %rbp
+  8042d9:	48 89 e5             	mov    %rsp,%rbp
+  8042dc:	41 57                	push   %r15
+  8042de:	41 56                	push   %r14
+  8042e0:	41 55                	push   %r13
+  8042e2:	41 54                	push   %r12
+  8042e4:	53                   	push   %rbx
+  8042e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8042e9:	49 89 fc             	mov    %rdi,%r12
+  8042ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8042f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042f4:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  8042fb:	00 00 00 
+  8042fe:	ff d0                	call   *%rax
+  804300:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804303:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804309:	49 bd 3f 15 80 00 00 	movabs $0x80153f,%r13
+  804310:	00 00 00 
+            sys_yield();
+  804313:	49 be dc 14 80 00 00 	movabs $0x8014dc,%r14
+  80431a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80431d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804322:	74 7d                	je     8043a1 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804324:	8b 03                	mov    (%rbx),%eax
+  804326:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804329:	75 26                	jne    804351 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80432b:	4d 85 ff             	test   %r15,%r15
+  80432e:	75 77                	jne    8043a7 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804330:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804335:	48 89 da             	mov    %rbx,%rdx
+  804338:	be 00 10 00 00       	mov    $0x1000,%esi
+  80433d:	4c 89 e7             	mov    %r12,%rdi
+  804340:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804343:	85 c0                	test   %eax,%eax
+  804345:	74 72                	je     8043b9 <devpipe_read+0xe1>
+            sys_yield();
+  804347:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80434a:	8b 03                	mov    (%rbx),%eax
+  80434c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80434f:	74 df                	je     804330 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804351:	48 63 c8             	movslq %eax,%rcx
+  804354:	48 89 ca             	mov    %rcx,%rdx
+  804357:	48 c1 ea 03          	shr    $0x3,%rdx
+  80435b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804362:	08 10 20 
+  804365:	48 89 d0             	mov    %rdx,%rax
+  804368:	48 f7 e6             	mul    %rsi
+  80436b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80436f:	48 89 d0             	mov    %rdx,%rax
+  804372:	48 c1 e0 09          	shl    $0x9,%rax
+  804376:	48 29 d0             	sub    %rdx,%rax
+  804379:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804380:	00 
+  804381:	48 89 c8             	mov    %rcx,%rax
+  804384:	48 29 d0             	sub    %rdx,%rax
+  804387:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80438c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804390:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804394:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804397:	49 83 c7 01          	add    $0x1,%r15
+  80439b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80439f:	75 83                	jne    804324 <devpipe_read+0x4c>
+    return n;
+  8043a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043a5:	eb 03                	jmp    8043aa <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8043a7:	4c 89 f8             	mov    %r15,%rax
+}
+  8043aa:	48 83 c4 18          	add    $0x18,%rsp
+  8043ae:	5b                   	pop    %rbx
+  8043af:	41 5c                	pop    %r12
+  8043b1:	41 5d                	pop    %r13
+  8043b3:	41 5e                	pop    %r14
+  8043b5:	41 5f                	pop    %r15
+  8043b7:	5d                   	pop    %rbp
+  8043b8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8043b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043be:	eb ea                	jmp    8043aa <devpipe_read+0xd2>
+
+00000000008043c0 <pipe>:
+pipe(int pfd[2]) {
+  8043c0:	55                   	push   %rbp
+  8043c1:	48 89 e5             	mov    %rsp,%rbp
+  8043c4:	41 55                	push   %r13
+  8043c6:	41 54                	push   %r12
+  8043c8:	53                   	push   %rbx
+  8043c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8043cd:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8043d0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8043d4:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  8043db:	00 00 00 
+  8043de:	ff d0                	call   *%rax
+  8043e0:	89 c3                	mov    %eax,%ebx
+  8043e2:	85 c0                	test   %eax,%eax
+  8043e4:	0f 88 a0 01 00 00    	js     80458a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8043ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043f4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043fd:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  804404:	00 00 00 
+  804407:	ff d0                	call   *%rax
+  804409:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80440b:	85 c0                	test   %eax,%eax
+  80440d:	0f 88 77 01 00 00    	js     80458a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804413:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804417:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  80441e:	00 00 00 
+  804421:	ff d0                	call   *%rax
+  804423:	89 c3                	mov    %eax,%ebx
+  804425:	85 c0                	test   %eax,%eax
+  804427:	0f 88 43 01 00 00    	js     804570 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80442d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804432:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804437:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80443b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804440:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80444e:	85 c0                	test   %eax,%eax
+  804450:	0f 88 1a 01 00 00    	js     804570 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804456:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80445a:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  804461:	00 00 00 
+  804464:	ff d0                	call   *%rax
+  804466:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804469:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80446e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804473:	48 89 c6             	mov    %rax,%rsi
+  804476:	bf 00 00 00 00       	mov    $0x0,%edi
+  80447b:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+  804487:	89 c3                	mov    %eax,%ebx
+  804489:	85 c0                	test   %eax,%eax
+  80448b:	0f 88 c5 00 00 00    	js     804556 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804491:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804495:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  80449c:	00 00 00 
+  80449f:	ff d0                	call   *%rax
+  8044a1:	48 89 c1             	mov    %rax,%rcx
+  8044a4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8044aa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8044b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044b5:	4c 89 ee             	mov    %r13,%rsi
+  8044b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044bd:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	89 c3                	mov    %eax,%ebx
+  8044cb:	85 c0                	test   %eax,%eax
+  8044cd:	78 6e                	js     80453d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044cf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044d4:	4c 89 ef             	mov    %r13,%rdi
+  8044d7:	48 b8 0d 15 80 00 00 	movabs $0x80150d,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+  8044e3:	83 f8 02             	cmp    $0x2,%eax
+  8044e6:	0f 85 ab 00 00 00    	jne    804597 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8044ec:	a1 80 60 80 00 00 00 	movabs 0x806080,%eax
+  8044f3:	00 00 
+  8044f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044f9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8044fb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044ff:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804506:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80450a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80450c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804510:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804517:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80451b:	48 bb 8f 20 80 00 00 	movabs $0x80208f,%rbx
+  804522:	00 00 00 
+  804525:	ff d3                	call   *%rbx
+  804527:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80452b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80452f:	ff d3                	call   *%rbx
+  804531:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804536:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80453b:	eb 4d                	jmp    80458a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80453d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804542:	4c 89 ee             	mov    %r13,%rsi
+  804545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80454a:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  804551:	00 00 00 
+  804554:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804556:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80455b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80455f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804564:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  80456b:	00 00 00 
+  80456e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804570:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804575:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804579:	bf 00 00 00 00       	mov    $0x0,%edi
+  80457e:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  804585:	00 00 00 
+  804588:	ff d0                	call   *%rax
+}
+  80458a:	89 d8                	mov    %ebx,%eax
+  80458c:	48 83 c4 18          	add    $0x18,%rsp
+  804590:	5b                   	pop    %rbx
+  804591:	41 5c                	pop    %r12
+  804593:	41 5d                	pop    %r13
+  804595:	5d                   	pop    %rbp
+  804596:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804597:	48 b9 80 58 80 00 00 	movabs $0x805880,%rcx
+  80459e:	00 00 00 
+  8045a1:	48 ba fa 57 80 00 00 	movabs $0x8057fa,%rdx
+  8045a8:	00 00 00 
+  8045ab:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8045b0:	48 bf 6a 58 80 00 00 	movabs $0x80586a,%rdi
+  8045b7:	00 00 00 
+  8045ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045bf:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  8045c6:	00 00 00 
+  8045c9:	41 ff d0             	call   *%r8
+
+00000000008045cc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8045cc:	55                   	push   %rbp
+  8045cd:	48 89 e5             	mov    %rsp,%rbp
+  8045d0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045d4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045d8:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045e4:	85 c0                	test   %eax,%eax
+  8045e6:	78 35                	js     80461d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8045e8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045ec:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  8045f3:	00 00 00 
+  8045f6:	ff d0                	call   *%rax
+  8045f8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045fb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804600:	be 00 10 00 00       	mov    $0x1000,%esi
+  804605:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804609:	48 b8 3f 15 80 00 00 	movabs $0x80153f,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+  804615:	85 c0                	test   %eax,%eax
+  804617:	0f 94 c0             	sete   %al
+  80461a:	0f b6 c0             	movzbl %al,%eax
+}
+  80461d:	c9                   	leave
+  80461e:	c3                   	ret
+
+000000000080461f <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80461f:	55                   	push   %rbp
+  804620:	48 89 e5             	mov    %rsp,%rbp
+  804623:	41 55                	push   %r13
+  804625:	41 54                	push   %r12
+  804627:	53                   	push   %rbx
+  804628:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80462c:	85 ff                	test   %edi,%edi
+  80462e:	74 73                	je     8046a3 <wait+0x84>
+  804630:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804633:	89 f8                	mov    %edi,%eax
+  804635:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80463a:	89 f9                	mov    %edi,%ecx
+  80463c:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804642:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  804649:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804650:	00 00 00 
+  804653:	48 01 ca             	add    %rcx,%rdx
+  804656:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80465c:	39 d7                	cmp    %edx,%edi
+  80465e:	75 38                	jne    804698 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804660:	48 98                	cltq
+  804662:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804669:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804670:	00 00 00 
+  804673:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804676:	49 bd dc 14 80 00 00 	movabs $0x8014dc,%r13
+  80467d:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804680:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804686:	85 c0                	test   %eax,%eax
+  804688:	74 0e                	je     804698 <wait+0x79>
+        sys_yield();
+  80468a:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80468d:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804693:	44 39 e0             	cmp    %r12d,%eax
+  804696:	74 e8                	je     804680 <wait+0x61>
+    }
+}
+  804698:	48 83 c4 08          	add    $0x8,%rsp
+  80469c:	5b                   	pop    %rbx
+  80469d:	41 5c                	pop    %r12
+  80469f:	41 5d                	pop    %r13
+  8046a1:	5d                   	pop    %rbp
+  8046a2:	c3                   	ret
+    assert(envid != 0);
+  8046a3:	48 b9 a4 58 80 00 00 	movabs $0x8058a4,%rcx
+  8046aa:	00 00 00 
+  8046ad:	48 ba fa 57 80 00 00 	movabs $0x8057fa,%rdx
+  8046b4:	00 00 00 
+  8046b7:	be 06 00 00 00       	mov    $0x6,%esi
+  8046bc:	48 bf af 58 80 00 00 	movabs $0x8058af,%rdi
+  8046c3:	00 00 00 
+  8046c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046cb:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  8046d2:	00 00 00 
+  8046d5:	41 ff d0             	call   *%r8
+
+00000000008046d8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8046d8:	48 89 f8             	mov    %rdi,%rax
+  8046db:	48 c1 e8 27          	shr    $0x27,%rax
+  8046df:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8046e6:	7f 00 00 
+  8046e9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046ed:	f6 c2 01             	test   $0x1,%dl
+  8046f0:	74 6d                	je     80475f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8046f2:	48 89 f8             	mov    %rdi,%rax
+  8046f5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046f9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804700:	7f 00 00 
+  804703:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804707:	f6 c2 01             	test   $0x1,%dl
+  80470a:	74 62                	je     80476e <get_uvpt_entry+0x96>
+  80470c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804713:	7f 00 00 
+  804716:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80471a:	f6 c2 80             	test   $0x80,%dl
+  80471d:	75 4f                	jne    80476e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80471f:	48 89 f8             	mov    %rdi,%rax
+  804722:	48 c1 e8 15          	shr    $0x15,%rax
+  804726:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80472d:	7f 00 00 
+  804730:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804734:	f6 c2 01             	test   $0x1,%dl
+  804737:	74 44                	je     80477d <get_uvpt_entry+0xa5>
+  804739:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804740:	7f 00 00 
+  804743:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804747:	f6 c2 80             	test   $0x80,%dl
+  80474a:	75 31                	jne    80477d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80474c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804750:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804757:	7f 00 00 
+  80475a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80475e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80475f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804766:	7f 00 00 
+  804769:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80476d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80476e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804775:	7f 00 00 
+  804778:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80477c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80477d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804784:	7f 00 00 
+  804787:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80478b:	c3                   	ret
+
+000000000080478c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80478c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80478f:	48 89 f9             	mov    %rdi,%rcx
+  804792:	48 c1 e9 27          	shr    $0x27,%rcx
+  804796:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80479d:	7f 00 00 
+  8047a0:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8047a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8047ab:	f6 c1 01             	test   $0x1,%cl
+  8047ae:	0f 84 b2 00 00 00    	je     804866 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8047b4:	48 89 f9             	mov    %rdi,%rcx
+  8047b7:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8047bb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8047c2:	7f 00 00 
+  8047c5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8047c9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8047d0:	40 f6 c6 01          	test   $0x1,%sil
+  8047d4:	0f 84 8c 00 00 00    	je     804866 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8047da:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8047e1:	7f 00 00 
+  8047e4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8047e8:	a8 80                	test   $0x80,%al
+  8047ea:	75 7b                	jne    804867 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8047ec:	48 89 f9             	mov    %rdi,%rcx
+  8047ef:	48 c1 e9 15          	shr    $0x15,%rcx
+  8047f3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8047fa:	7f 00 00 
+  8047fd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804801:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804808:	40 f6 c6 01          	test   $0x1,%sil
+  80480c:	74 58                	je     804866 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80480e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804815:	7f 00 00 
+  804818:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80481c:	a8 80                	test   $0x80,%al
+  80481e:	75 6c                	jne    80488c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804820:	48 89 f9             	mov    %rdi,%rcx
+  804823:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804827:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80482e:	7f 00 00 
+  804831:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804835:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80483c:	40 f6 c6 01          	test   $0x1,%sil
+  804840:	74 24                	je     804866 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804842:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804849:	7f 00 00 
+  80484c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804850:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804857:	ff ff 7f 
+  80485a:	48 21 c8             	and    %rcx,%rax
+  80485d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804863:	48 09 d0             	or     %rdx,%rax
+}
+  804866:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804867:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80486e:	7f 00 00 
+  804871:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804875:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80487c:	ff ff 7f 
+  80487f:	48 21 c8             	and    %rcx,%rax
+  804882:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804888:	48 01 d0             	add    %rdx,%rax
+  80488b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80488c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804893:	7f 00 00 
+  804896:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80489a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8048a1:	ff ff 7f 
+  8048a4:	48 21 c8             	and    %rcx,%rax
+  8048a7:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8048ad:	48 01 d0             	add    %rdx,%rax
+  8048b0:	c3                   	ret
+
+00000000008048b1 <get_prot>:
+
+int
+get_prot(void *va) {
+  8048b1:	55                   	push   %rbp
+  8048b2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048b5:	48 b8 d8 46 80 00 00 	movabs $0x8046d8,%rax
+  8048bc:	00 00 00 
+  8048bf:	ff d0                	call   *%rax
+  8048c1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8048c4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8048c9:	89 c1                	mov    %eax,%ecx
+  8048cb:	83 c9 04             	or     $0x4,%ecx
+  8048ce:	f6 c2 01             	test   $0x1,%dl
+  8048d1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8048d4:	89 c1                	mov    %eax,%ecx
+  8048d6:	83 c9 02             	or     $0x2,%ecx
+  8048d9:	f6 c2 02             	test   $0x2,%dl
+  8048dc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8048df:	89 c1                	mov    %eax,%ecx
+  8048e1:	83 c9 01             	or     $0x1,%ecx
+  8048e4:	48 85 d2             	test   %rdx,%rdx
+  8048e7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8048ea:	89 c1                	mov    %eax,%ecx
+  8048ec:	83 c9 40             	or     $0x40,%ecx
+  8048ef:	f6 c6 04             	test   $0x4,%dh
+  8048f2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8048f5:	5d                   	pop    %rbp
+  8048f6:	c3                   	ret
+
+00000000008048f7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8048f7:	55                   	push   %rbp
+  8048f8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048fb:	48 b8 d8 46 80 00 00 	movabs $0x8046d8,%rax
+  804902:	00 00 00 
+  804905:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804907:	48 c1 e8 06          	shr    $0x6,%rax
+  80490b:	83 e0 01             	and    $0x1,%eax
+}
+  80490e:	5d                   	pop    %rbp
+  80490f:	c3                   	ret
+
+0000000000804910 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804910:	55                   	push   %rbp
+  804911:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804914:	48 b8 d8 46 80 00 00 	movabs $0x8046d8,%rax
+  80491b:	00 00 00 
+  80491e:	ff d0                	call   *%rax
+  804920:	83 e0 01             	and    $0x1,%eax
+}
+  804923:	5d                   	pop    %rbp
+  804924:	c3                   	ret
+
+0000000000804925 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804925:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80492c:	7f 00 00 
+  80492f:	a8 01                	test   $0x1,%al
+  804931:	75 06                	jne    804939 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804933:	b8 00 00 00 00       	mov    $0x0,%eax
+  804938:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804939:	55                   	push   %rbp
+  80493a:	48 89 e5             	mov    %rsp,%rbp
+  80493d:	41 57                	push   %r15
+  80493f:	41 56                	push   %r14
+  804941:	41 55                	push   %r13
+  804943:	41 54                	push   %r12
+  804945:	53                   	push   %rbx
+  804946:	48 83 ec 18          	sub    $0x18,%rsp
+  80494a:	49 89 fe             	mov    %rdi,%r14
+  80494d:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804950:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804957:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804958:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80495f:	7f 00 00 
+  804962:	e9 81 00 00 00       	jmp    8049e8 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804967:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80496e:	49 39 dd             	cmp    %rbx,%r13
+  804971:	74 2b                	je     80499e <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804973:	48 89 d8             	mov    %rbx,%rax
+  804976:	48 c1 e8 0c          	shr    $0xc,%rax
+  80497a:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80497e:	f6 c2 01             	test   $0x1,%dl
+  804981:	74 e4                	je     804967 <foreach_shared_region+0x42>
+  804983:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804987:	f6 c4 04             	test   $0x4,%ah
+  80498a:	74 db                	je     804967 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80498c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804993:	4c 89 fa             	mov    %r15,%rdx
+  804996:	48 89 df             	mov    %rbx,%rdi
+  804999:	41 ff d6             	call   *%r14
+  80499c:	eb c9                	jmp    804967 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80499e:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8049a5:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8049a9:	74 22                	je     8049cd <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8049ab:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8049b2:	48 89 d8             	mov    %rbx,%rax
+  8049b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8049b9:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8049c0:	7f 00 00 
+  8049c3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8049c7:	a8 01                	test   $0x1,%al
+  8049c9:	74 d3                	je     80499e <foreach_shared_region+0x79>
+  8049cb:	eb a6                	jmp    804973 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8049cd:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8049d4:	40 
+  8049d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8049d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049e0:	00 00 00 
+  8049e3:	48 39 c1             	cmp    %rax,%rcx
+  8049e6:	74 31                	je     804a19 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8049e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049ec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8049f0:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8049f7:	7f 00 00 
+  8049fa:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8049fe:	a8 01                	test   $0x1,%al
+  804a00:	74 cb                	je     8049cd <foreach_shared_region+0xa8>
+  804a02:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a06:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804a0d:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804a13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804a17:	eb 92                	jmp    8049ab <foreach_shared_region+0x86>
+}
+  804a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a1e:	48 83 c4 18          	add    $0x18,%rsp
+  804a22:	5b                   	pop    %rbx
+  804a23:	41 5c                	pop    %r12
+  804a25:	41 5d                	pop    %r13
+  804a27:	41 5e                	pop    %r14
+  804a29:	41 5f                	pop    %r15
+  804a2b:	5d                   	pop    %rbp
+  804a2c:	c3                   	ret
+
+0000000000804a2d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a32:	c3                   	ret
+
+0000000000804a33 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+  804a37:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804a3a:	48 be ba 58 80 00 00 	movabs $0x8058ba,%rsi
+  804a41:	00 00 00 
+  804a44:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  804a4b:	00 00 00 
+  804a4e:	ff d0                	call   *%rax
+    return 0;
+}
+  804a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a55:	5d                   	pop    %rbp
+  804a56:	c3                   	ret
+
+0000000000804a57 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804a57:	55                   	push   %rbp
+  804a58:	48 89 e5             	mov    %rsp,%rbp
+  804a5b:	41 57                	push   %r15
+  804a5d:	41 56                	push   %r14
+  804a5f:	41 55                	push   %r13
+  804a61:	41 54                	push   %r12
+  804a63:	53                   	push   %rbx
+  804a64:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804a6b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804a72:	48 85 d2             	test   %rdx,%rdx
+  804a75:	74 7a                	je     804af1 <devcons_write+0x9a>
+  804a77:	49 89 d6             	mov    %rdx,%r14
+  804a7a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804a80:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804a85:	49 bf 99 11 80 00 00 	movabs $0x801199,%r15
+  804a8c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804a8f:	4c 89 f3             	mov    %r14,%rbx
+  804a92:	48 29 f3             	sub    %rsi,%rbx
+  804a95:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804a9a:	48 39 c3             	cmp    %rax,%rbx
+  804a9d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804aa1:	4c 63 eb             	movslq %ebx,%r13
+  804aa4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804aab:	48 01 c6             	add    %rax,%rsi
+  804aae:	4c 89 ea             	mov    %r13,%rdx
+  804ab1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ab8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804abb:	4c 89 ee             	mov    %r13,%rsi
+  804abe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ac5:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  804acc:	00 00 00 
+  804acf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ad1:	41 01 dc             	add    %ebx,%r12d
+  804ad4:	49 63 f4             	movslq %r12d,%rsi
+  804ad7:	4c 39 f6             	cmp    %r14,%rsi
+  804ada:	72 b3                	jb     804a8f <devcons_write+0x38>
+    return res;
+  804adc:	49 63 c4             	movslq %r12d,%rax
+}
+  804adf:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804ae6:	5b                   	pop    %rbx
+  804ae7:	41 5c                	pop    %r12
+  804ae9:	41 5d                	pop    %r13
+  804aeb:	41 5e                	pop    %r14
+  804aed:	41 5f                	pop    %r15
+  804aef:	5d                   	pop    %rbp
+  804af0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804af1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804af7:	eb e3                	jmp    804adc <devcons_write+0x85>
+
+0000000000804af9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804af9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804afc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b01:	48 85 c0             	test   %rax,%rax
+  804b04:	74 55                	je     804b5b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804b06:	55                   	push   %rbp
+  804b07:	48 89 e5             	mov    %rsp,%rbp
+  804b0a:	41 55                	push   %r13
+  804b0c:	41 54                	push   %r12
+  804b0e:	53                   	push   %rbx
+  804b0f:	48 83 ec 08          	sub    $0x8,%rsp
+  804b13:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804b16:	48 bb 0f 14 80 00 00 	movabs $0x80140f,%rbx
+  804b1d:	00 00 00 
+  804b20:	49 bc dc 14 80 00 00 	movabs $0x8014dc,%r12
+  804b27:	00 00 00 
+  804b2a:	eb 03                	jmp    804b2f <devcons_read+0x36>
+  804b2c:	41 ff d4             	call   *%r12
+  804b2f:	ff d3                	call   *%rbx
+  804b31:	85 c0                	test   %eax,%eax
+  804b33:	74 f7                	je     804b2c <devcons_read+0x33>
+    if (c < 0) return c;
+  804b35:	48 63 d0             	movslq %eax,%rdx
+  804b38:	78 13                	js     804b4d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b3f:	83 f8 04             	cmp    $0x4,%eax
+  804b42:	74 09                	je     804b4d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804b44:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804b48:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804b4d:	48 89 d0             	mov    %rdx,%rax
+  804b50:	48 83 c4 08          	add    $0x8,%rsp
+  804b54:	5b                   	pop    %rbx
+  804b55:	41 5c                	pop    %r12
+  804b57:	41 5d                	pop    %r13
+  804b59:	5d                   	pop    %rbp
+  804b5a:	c3                   	ret
+  804b5b:	48 89 d0             	mov    %rdx,%rax
+  804b5e:	c3                   	ret
+
+0000000000804b5f <cputchar>:
+cputchar(int ch) {
+  804b5f:	55                   	push   %rbp
+  804b60:	48 89 e5             	mov    %rsp,%rbp
+  804b63:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804b67:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804b6b:	be 01 00 00 00       	mov    $0x1,%esi
+  804b70:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804b74:	48 b8 e2 13 80 00 00 	movabs $0x8013e2,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+}
+  804b80:	c9                   	leave
+  804b81:	c3                   	ret
+
+0000000000804b82 <getchar>:
+getchar(void) {
+  804b82:	55                   	push   %rbp
+  804b83:	48 89 e5             	mov    %rsp,%rbp
+  804b86:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804b8a:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b8f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804b93:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b98:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  804b9f:	00 00 00 
+  804ba2:	ff d0                	call   *%rax
+  804ba4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804ba6:	85 c0                	test   %eax,%eax
+  804ba8:	78 06                	js     804bb0 <getchar+0x2e>
+  804baa:	74 08                	je     804bb4 <getchar+0x32>
+  804bac:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804bb0:	89 d0                	mov    %edx,%eax
+  804bb2:	c9                   	leave
+  804bb3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804bb4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804bb9:	eb f5                	jmp    804bb0 <getchar+0x2e>
+
+0000000000804bbb <iscons>:
+iscons(int fdnum) {
+  804bbb:	55                   	push   %rbp
+  804bbc:	48 89 e5             	mov    %rsp,%rbp
+  804bbf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804bc3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804bc7:	48 b8 1d 21 80 00 00 	movabs $0x80211d,%rax
+  804bce:	00 00 00 
+  804bd1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804bd3:	85 c0                	test   %eax,%eax
+  804bd5:	78 18                	js     804bef <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804bd7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804bdb:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804be2:	00 00 00 
+  804be5:	8b 00                	mov    (%rax),%eax
+  804be7:	39 02                	cmp    %eax,(%rdx)
+  804be9:	0f 94 c0             	sete   %al
+  804bec:	0f b6 c0             	movzbl %al,%eax
+}
+  804bef:	c9                   	leave
+  804bf0:	c3                   	ret
+
+0000000000804bf1 <opencons>:
+opencons(void) {
+  804bf1:	55                   	push   %rbp
+  804bf2:	48 89 e5             	mov    %rsp,%rbp
+  804bf5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804bf9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804bfd:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  804c04:	00 00 00 
+  804c07:	ff d0                	call   *%rax
+  804c09:	85 c0                	test   %eax,%eax
+  804c0b:	78 49                	js     804c56 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804c0d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804c12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c17:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c20:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  804c27:	00 00 00 
+  804c2a:	ff d0                	call   *%rax
+  804c2c:	85 c0                	test   %eax,%eax
+  804c2e:	78 26                	js     804c56 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804c30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c34:	a1 c0 60 80 00 00 00 	movabs 0x8060c0,%eax
+  804c3b:	00 00 
+  804c3d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804c3f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804c43:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804c4a:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  804c51:	00 00 00 
+  804c54:	ff d0                	call   *%rax
+}
+  804c56:	c9                   	leave
+  804c57:	c3                   	ret
+
+0000000000804c58 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804c58:	55                   	push   %rbp
+  804c59:	48 89 e5             	mov    %rsp,%rbp
+  804c5c:	41 55                	push   %r13
+  804c5e:	41 54                	push   %r12
+  804c60:	53                   	push   %rbx
+  804c61:	48 83 ec 08          	sub    $0x8,%rsp
+  804c65:	49 89 fc             	mov    %rdi,%r12
+  804c68:	48 89 f7             	mov    %rsi,%rdi
+  804c6b:	48 89 d3             	mov    %rdx,%rbx
+  804c6e:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804c71:	48 85 f6             	test   %rsi,%rsi
+  804c74:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c7b:	00 00 00 
+  804c7e:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804c82:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c87:	48 85 d2             	test   %rdx,%rdx
+  804c8a:	74 03                	je     804c8f <ipc_recv+0x37>
+  804c8c:	48 8b 32             	mov    (%rdx),%rsi
+  804c8f:	48 b8 18 19 80 00 00 	movabs $0x801918,%rax
+  804c96:	00 00 00 
+  804c99:	ff d0                	call   *%rax
+    if (errno) {
+  804c9b:	85 c0                	test   %eax,%eax
+  804c9d:	74 1c                	je     804cbb <ipc_recv+0x63>
+        if (from_env_store)
+  804c9f:	4d 85 e4             	test   %r12,%r12
+  804ca2:	74 08                	je     804cac <ipc_recv+0x54>
+            *from_env_store = 0;
+  804ca4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804cab:	00 
+
+        if (perm_store)
+  804cac:	4d 85 ed             	test   %r13,%r13
+  804caf:	74 74                	je     804d25 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804cb1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804cb8:	00 
+  804cb9:	eb 6a                	jmp    804d25 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804cbb:	4d 85 e4             	test   %r12,%r12
+  804cbe:	74 14                	je     804cd4 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804cc0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804cc7:	00 00 00 
+  804cca:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804cd0:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804cd4:	48 85 db             	test   %rbx,%rbx
+  804cd7:	74 23                	je     804cfc <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804cd9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804ce0:	00 00 00 
+  804ce3:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cee:	85 c9                	test   %ecx,%ecx
+  804cf0:	74 07                	je     804cf9 <ipc_recv+0xa1>
+  804cf2:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804cf9:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804cfc:	4d 85 ed             	test   %r13,%r13
+  804cff:	74 14                	je     804d15 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804d01:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804d08:	00 00 00 
+  804d0b:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804d11:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804d15:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804d1c:	00 00 00 
+  804d1f:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804d25:	48 83 c4 08          	add    $0x8,%rsp
+  804d29:	5b                   	pop    %rbx
+  804d2a:	41 5c                	pop    %r12
+  804d2c:	41 5d                	pop    %r13
+  804d2e:	5d                   	pop    %rbp
+  804d2f:	c3                   	ret
+
+0000000000804d30 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804d30:	55                   	push   %rbp
+  804d31:	48 89 e5             	mov    %rsp,%rbp
+  804d34:	41 55                	push   %r13
+  804d36:	41 54                	push   %r12
+  804d38:	53                   	push   %rbx
+  804d39:	48 83 ec 08          	sub    $0x8,%rsp
+  804d3d:	49 89 fc             	mov    %rdi,%r12
+  804d40:	48 89 f7             	mov    %rsi,%rdi
+  804d43:	48 89 d3             	mov    %rdx,%rbx
+  804d46:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804d49:	48 85 f6             	test   %rsi,%rsi
+  804d4c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d53:	00 00 00 
+  804d56:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804d5a:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d5f:	48 85 d2             	test   %rdx,%rdx
+  804d62:	74 03                	je     804d67 <ipc_try_recv+0x37>
+  804d64:	48 8b 32             	mov    (%rdx),%rsi
+  804d67:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  804d6e:	00 00 00 
+  804d71:	ff d0                	call   *%rax
+    if (errno) {
+  804d73:	85 c0                	test   %eax,%eax
+  804d75:	75 75                	jne    804dec <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804d77:	4d 85 e4             	test   %r12,%r12
+  804d7a:	74 14                	je     804d90 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804d7c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804d83:	00 00 00 
+  804d86:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804d8c:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804d90:	48 85 db             	test   %rbx,%rbx
+  804d93:	74 23                	je     804db8 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804d95:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804d9c:	00 00 00 
+  804d9f:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804daa:	85 c9                	test   %ecx,%ecx
+  804dac:	74 07                	je     804db5 <ipc_try_recv+0x85>
+  804dae:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804db5:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804db8:	4d 85 ed             	test   %r13,%r13
+  804dbb:	74 14                	je     804dd1 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804dbd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804dc4:	00 00 00 
+  804dc7:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804dcd:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804dd1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804dd8:	00 00 00 
+  804ddb:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804de1:	48 83 c4 08          	add    $0x8,%rsp
+  804de5:	5b                   	pop    %rbx
+  804de6:	41 5c                	pop    %r12
+  804de8:	41 5d                	pop    %r13
+  804dea:	5d                   	pop    %rbp
+  804deb:	c3                   	ret
+        if (from_env_store)
+  804dec:	4d 85 e4             	test   %r12,%r12
+  804def:	74 08                	je     804df9 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804df1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804df8:	00 
+        if (perm_store)
+  804df9:	4d 85 ed             	test   %r13,%r13
+  804dfc:	74 e3                	je     804de1 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804dfe:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804e05:	00 
+  804e06:	eb d9                	jmp    804de1 <ipc_try_recv+0xb1>
+
+0000000000804e08 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804e08:	55                   	push   %rbp
+  804e09:	48 89 e5             	mov    %rsp,%rbp
+  804e0c:	41 57                	push   %r15
+  804e0e:	41 56                	push   %r14
+  804e10:	41 55                	push   %r13
+  804e12:	41 54                	push   %r12
+  804e14:	53                   	push   %rbx
+  804e15:	48 83 ec 18          	sub    $0x18,%rsp
+  804e19:	41 89 fd             	mov    %edi,%r13d
+  804e1c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804e1f:	48 89 d3             	mov    %rdx,%rbx
+  804e22:	49 89 cc             	mov    %rcx,%r12
+  804e25:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804e29:	48 85 d2             	test   %rdx,%rdx
+  804e2c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e33:	00 00 00 
+  804e36:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804e3a:	49 be ec 18 80 00 00 	movabs $0x8018ec,%r14
+  804e41:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804e44:	49 bf dc 14 80 00 00 	movabs $0x8014dc,%r15
+  804e4b:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804e4e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804e51:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804e55:	4c 89 e1             	mov    %r12,%rcx
+  804e58:	48 89 da             	mov    %rbx,%rdx
+  804e5b:	44 89 ef             	mov    %r13d,%edi
+  804e5e:	41 ff d6             	call   *%r14
+  804e61:	85 c0                	test   %eax,%eax
+  804e63:	74 37                	je     804e9c <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804e65:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804e68:	75 05                	jne    804e6f <ipc_send+0x67>
+        sys_yield();
+  804e6a:	41 ff d7             	call   *%r15
+  804e6d:	eb df                	jmp    804e4e <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804e6f:	89 c1                	mov    %eax,%ecx
+  804e71:	48 ba c6 58 80 00 00 	movabs $0x8058c6,%rdx
+  804e78:	00 00 00 
+  804e7b:	be 65 00 00 00       	mov    $0x65,%esi
+  804e80:	48 bf e1 58 80 00 00 	movabs $0x8058e1,%rdi
+  804e87:	00 00 00 
+  804e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e8f:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  804e96:	00 00 00 
+  804e99:	41 ff d0             	call   *%r8
+    }
+}
+  804e9c:	48 83 c4 18          	add    $0x18,%rsp
+  804ea0:	5b                   	pop    %rbx
+  804ea1:	41 5c                	pop    %r12
+  804ea3:	41 5d                	pop    %r13
+  804ea5:	41 5e                	pop    %r14
+  804ea7:	41 5f                	pop    %r15
+  804ea9:	5d                   	pop    %rbp
+  804eaa:	c3                   	ret
+
+0000000000804eab <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804eab:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804eb0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804eb7:	00 00 00 
+  804eba:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804ec1:	48 01 ca             	add    %rcx,%rdx
+  804ec4:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804eca:	39 fa                	cmp    %edi,%edx
+  804ecc:	74 12                	je     804ee0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804ece:	48 83 c0 01          	add    $0x1,%rax
+  804ed2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804ed8:	75 e0                	jne    804eba <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804eda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804edf:	c3                   	ret
+            return envs[i].env_id;
+  804ee0:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804ee7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804eee:	00 00 00 
+  804ef1:	48 01 d0             	add    %rdx,%rax
+  804ef4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804efa:	c3                   	ret
+
+0000000000804efb <__text_end>:
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
@@ -0,0 +1,9373 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e5 06 00 00       	call   800708 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf 79 2a 80 00 00 	movabs $0x802a79,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 24 09 80 00 00 	movabs $0x800924,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf 73 60 80 00 00 	movabs $0x806073,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 91 28 80 00 00 	movabs $0x802891,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be 73 18 80 00 00 	movabs $0x801873,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf 84 60 80 00 00 	movabs $0x806084,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 91 28 80 00 00 	movabs $0x802891,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd 73 18 80 00 00 	movabs $0x801873,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf 94 60 80 00 00 	movabs $0x806094,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb 13 27 80 00 00 	movabs $0x802713,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb a1 06 80 00 00 	movabs $0x8006a1,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf 99 60 80 00 00 	movabs $0x806099,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 4c 01 00 00    	js     800309 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 51 48 80 00 00 	movabs $0x804851,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 61 01 00 00    	js     800336 <umain+0x1d5>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf 28 60 80 00 00 	movabs $0x806028,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 5b 01 00 00    	js     800363 <umain+0x202>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd 6e 27 80 00 00 	movabs $0x80276e,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd 13 27 80 00 00 	movabs $0x802713,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba df 60 80 00 00 	movabs $0x8060df,%rdx
+  80024e:	00 00 00 
+  800251:	48 be a3 60 80 00 00 	movabs $0x8060a3,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf e2 60 80 00 00 	movabs $0x8060e2,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 b5 44 80 00 00 	movabs $0x8044b5,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 0e 01 00 00    	js     800390 <umain+0x22f>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be 13 27 80 00 00 	movabs $0x802713,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 b0 4a 80 00 00 	movabs $0x804ab0,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb 13 27 80 00 00 	movabs $0x802713,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf f0 60 80 00 00 	movabs $0x8060f0,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 c9 00 00 00    	js     8003bd <umain+0x25c>
+    for (off = 0;; off++) {
+  8002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8002fa:	49 bd 91 28 80 00 00 	movabs $0x802891,%r13
+  800301:	00 00 00 
+  800304:	e9 5c 01 00 00       	jmp    800465 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba a6 60 80 00 00 	movabs $0x8060a6,%rdx
+  800312:	00 00 00 
+  800315:	be 12 00 00 00       	mov    $0x12,%esi
+  80031a:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  800336:	89 c1                	mov    %eax,%ecx
+  800338:	48 ba cd 60 80 00 00 	movabs $0x8060cd,%rdx
+  80033f:	00 00 00 
+  800342:	be 14 00 00 00       	mov    $0x14,%esi
+  800347:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80035d:	00 00 00 
+  800360:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800363:	89 c1                	mov    %eax,%ecx
+  800365:	48 ba d6 60 80 00 00 	movabs $0x8060d6,%rdx
+  80036c:	00 00 00 
+  80036f:	be 19 00 00 00       	mov    $0x19,%esi
+  800374:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80038a:	00 00 00 
+  80038d:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	48 ba e6 60 80 00 00 	movabs $0x8060e6,%rdx
+  800399:	00 00 00 
+  80039c:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a1:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  8003a8:	00 00 00 
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8003b7:	00 00 00 
+  8003ba:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003bd:	89 c1                	mov    %eax,%ecx
+  8003bf:	48 ba 50 60 80 00 00 	movabs $0x806050,%rdx
+  8003c6:	00 00 00 
+  8003c9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003ce:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  8003d5:	00 00 00 
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8003e4:	00 00 00 
+  8003e7:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003ea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003ed:	48 ba fe 60 80 00 00 	movabs $0x8060fe,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 31 00 00 00       	mov    $0x31,%esi
+  8003fc:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  800412:	00 00 00 
+  800415:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  800418:	48 ba 18 61 80 00 00 	movabs $0x806118,%rdx
+  80041f:	00 00 00 
+  800422:	be 33 00 00 00       	mov    $0x33,%esi
+  800427:	48 bf bc 60 80 00 00 	movabs $0x8060bc,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  800443:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  800447:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  80044c:	44 89 e2             	mov    %r12d,%edx
+  80044f:	44 89 f6             	mov    %r14d,%esi
+  800452:	44 89 ff             	mov    %r15d,%edi
+  800455:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  800461:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80046e:	44 89 ff             	mov    %r15d,%edi
+  800471:	41 ff d5             	call   *%r13
+  800474:	48 89 c3             	mov    %rax,%rbx
+  800477:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  80047a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80047f:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d5             	call   *%r13
+  800489:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  80048b:	85 db                	test   %ebx,%ebx
+  80048d:	0f 88 57 ff ff ff    	js     8003ea <umain+0x289>
+        if (n2 < 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	78 81                	js     800418 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	09 da                	or     %ebx,%edx
+  80049b:	74 15                	je     8004b2 <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  80049d:	83 fb 01             	cmp    $0x1,%ebx
+  8004a0:	75 a1                	jne    800443 <umain+0x2e2>
+  8004a2:	83 f8 01             	cmp    $0x1,%eax
+  8004a5:	75 9c                	jne    800443 <umain+0x2e2>
+  8004a7:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004ab:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004ae:	75 93                	jne    800443 <umain+0x2e2>
+  8004b0:	eb af                	jmp    800461 <umain+0x300>
+    cprintf("shell ran correctly\n");
+  8004b2:	48 bf 32 61 80 00 00 	movabs $0x806132,%rdi
+  8004b9:	00 00 00 
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8004c8:	00 00 00 
+  8004cb:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004cd:	cc                   	int3
+}
+  8004ce:	48 83 c4 28          	add    $0x28,%rsp
+  8004d2:	5b                   	pop    %rbx
+  8004d3:	41 5c                	pop    %r12
+  8004d5:	41 5d                	pop    %r13
+  8004d7:	41 5e                	pop    %r14
+  8004d9:	41 5f                	pop    %r15
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	c3                   	ret
+
+00000000008004e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  8004e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8004ea:	48 be 47 61 80 00 00 	movabs $0x806147,%rsi
+  8004f1:	00 00 00 
+  8004f4:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+    return 0;
+}
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	41 57                	push   %r15
+  80050d:	41 56                	push   %r14
+  80050f:	41 55                	push   %r13
+  800511:	41 54                	push   %r12
+  800513:	53                   	push   %rbx
+  800514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80051b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800522:	48 85 d2             	test   %rdx,%rdx
+  800525:	74 7a                	je     8005a1 <devcons_write+0x9a>
+  800527:	49 89 d6             	mov    %rdx,%r14
+  80052a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800535:	49 bf 2a 16 80 00 00 	movabs $0x80162a,%r15
+  80053c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80053f:	4c 89 f3             	mov    %r14,%rbx
+  800542:	48 29 f3             	sub    %rsi,%rbx
+  800545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80054a:	48 39 c3             	cmp    %rax,%rbx
+  80054d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800551:	4c 63 eb             	movslq %ebx,%r13
+  800554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80055b:	48 01 c6             	add    %rax,%rsi
+  80055e:	4c 89 ea             	mov    %r13,%rdx
+  800561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80056b:	4c 89 ee             	mov    %r13,%rsi
+  80056e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800575:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  800581:	41 01 dc             	add    %ebx,%r12d
+  800584:	49 63 f4             	movslq %r12d,%rsi
+  800587:	4c 39 f6             	cmp    %r14,%rsi
+  80058a:	72 b3                	jb     80053f <devcons_write+0x38>
+    return res;
+  80058c:	49 63 c4             	movslq %r12d,%rax
+}
+  80058f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005a7:	eb e3                	jmp    80058c <devcons_write+0x85>
+
+00000000008005a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	48 85 c0             	test   %rax,%rax
+  8005b4:	74 55                	je     80060b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8005c6:	48 bb a0 18 80 00 00 	movabs $0x8018a0,%rbx
+  8005cd:	00 00 00 
+  8005d0:	49 bc 6d 19 80 00 00 	movabs $0x80196d,%r12
+  8005d7:	00 00 00 
+  8005da:	eb 03                	jmp    8005df <devcons_read+0x36>
+  8005dc:	41 ff d4             	call   *%r12
+  8005df:	ff d3                	call   *%rbx
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	74 f7                	je     8005dc <devcons_read+0x33>
+    if (c < 0) return c;
+  8005e5:	48 63 d0             	movslq %eax,%rdx
+  8005e8:	78 13                	js     8005fd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	83 f8 04             	cmp    $0x4,%eax
+  8005f2:	74 09                	je     8005fd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8005f4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8005f8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8005fd:	48 89 d0             	mov    %rdx,%rax
+  800600:	48 83 c4 08          	add    $0x8,%rsp
+  800604:	5b                   	pop    %rbx
+  800605:	41 5c                	pop    %r12
+  800607:	41 5d                	pop    %r13
+  800609:	5d                   	pop    %rbp
+  80060a:	c3                   	ret
+  80060b:	48 89 d0             	mov    %rdx,%rax
+  80060e:	c3                   	ret
+
+000000000080060f <cputchar>:
+cputchar(int ch) {
+  80060f:	55                   	push   %rbp
+  800610:	48 89 e5             	mov    %rsp,%rbp
+  800613:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800617:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80061b:	be 01 00 00 00       	mov    $0x1,%esi
+  800620:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800624:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+}
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <getchar>:
+getchar(void) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80063a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80063f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+  800648:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+  800654:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800656:	85 c0                	test   %eax,%eax
+  800658:	78 06                	js     800660 <getchar+0x2e>
+  80065a:	74 08                	je     800664 <getchar+0x32>
+  80065c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800660:	89 d0                	mov    %edx,%eax
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800664:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800669:	eb f5                	jmp    800660 <getchar+0x2e>
+
+000000000080066b <iscons>:
+iscons(int fdnum) {
+  80066b:	55                   	push   %rbp
+  80066c:	48 89 e5             	mov    %rsp,%rbp
+  80066f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800673:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800677:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800683:	85 c0                	test   %eax,%eax
+  800685:	78 18                	js     80069f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800692:	00 00 00 
+  800695:	8b 00                	mov    (%rax),%eax
+  800697:	39 02                	cmp    %eax,(%rdx)
+  800699:	0f 94 c0             	sete   %al
+  80069c:	0f b6 c0             	movzbl %al,%eax
+}
+  80069f:	c9                   	leave
+  8006a0:	c3                   	ret
+
+00000000008006a1 <opencons>:
+opencons(void) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006a9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006ad:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8006b4:	00 00 00 
+  8006b7:	ff d0                	call   *%rax
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	78 49                	js     800706 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8006bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8006c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8006c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8006cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006d0:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+  8006dc:	85 c0                	test   %eax,%eax
+  8006de:	78 26                	js     800706 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8006e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e4:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8006eb:	00 00 
+  8006ed:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8006ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8006f3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8006fa:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  800701:	00 00 00 
+  800704:	ff d0                	call   *%rax
+}
+  800706:	c9                   	leave
+  800707:	c3                   	ret
+
+0000000000800708 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 56                	push   %r14
+  80070e:	41 55                	push   %r13
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	41 89 fd             	mov    %edi,%r13d
+  800716:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800719:	48 ba d8 70 80 00 00 	movabs $0x8070d8,%rdx
+  800720:	00 00 00 
+  800723:	48 b8 d8 70 80 00 00 	movabs $0x8070d8,%rax
+  80072a:	00 00 00 
+  80072d:	48 39 c2             	cmp    %rax,%rdx
+  800730:	73 17                	jae    800749 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800732:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800735:	49 89 c4             	mov    %rax,%r12
+  800738:	48 83 c3 08          	add    $0x8,%rbx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	ff 53 f8             	call   *-0x8(%rbx)
+  800744:	4c 39 e3             	cmp    %r12,%rbx
+  800747:	72 ef                	jb     800738 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800749:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80075a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800761:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800768:	00 00 00 
+  80076b:	48 01 d0             	add    %rdx,%rax
+  80076e:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800775:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800778:	45 85 ed             	test   %r13d,%r13d
+  80077b:	7e 0d                	jle    80078a <libmain+0x82>
+  80077d:	49 8b 06             	mov    (%r14),%rax
+  800780:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  800787:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80078a:	4c 89 f6             	mov    %r14,%rsi
+  80078d:	44 89 ef             	mov    %r13d,%edi
+  800790:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800797:	00 00 00 
+  80079a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80079c:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  8007a3:	00 00 00 
+  8007a6:	ff d0                	call   *%rax
+#endif
+}
+  8007a8:	5b                   	pop    %rbx
+  8007a9:	41 5c                	pop    %r12
+  8007ab:	41 5d                	pop    %r13
+  8007ad:	41 5e                	pop    %r14
+  8007af:	5d                   	pop    %rbp
+  8007b0:	c3                   	ret
+
+00000000008007b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007b1:	55                   	push   %rbp
+  8007b2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8007b5:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  8007bc:	00 00 00 
+  8007bf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8007c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007c6:	48 b8 d1 18 80 00 00 	movabs $0x8018d1,%rax
+  8007cd:	00 00 00 
+  8007d0:	ff d0                	call   *%rax
+}
+  8007d2:	5d                   	pop    %rbp
+  8007d3:	c3                   	ret
+
+00000000008007d4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8007d4:	55                   	push   %rbp
+  8007d5:	48 89 e5             	mov    %rsp,%rbp
+  8007d8:	41 56                	push   %r14
+  8007da:	41 55                	push   %r13
+  8007dc:	41 54                	push   %r12
+  8007de:	53                   	push   %rbx
+  8007df:	48 83 ec 50          	sub    $0x50,%rsp
+  8007e3:	49 89 fc             	mov    %rdi,%r12
+  8007e6:	41 89 f5             	mov    %esi,%r13d
+  8007e9:	48 89 d3             	mov    %rdx,%rbx
+  8007ec:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8007f0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8007f4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8007f8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8007ff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800803:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800807:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80080b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80080f:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  800816:	00 00 00 
+  800819:	4c 8b 30             	mov    (%rax),%r14
+  80081c:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  800823:	00 00 00 
+  800826:	ff d0                	call   *%rax
+  800828:	89 c6                	mov    %eax,%esi
+  80082a:	45 89 e8             	mov    %r13d,%r8d
+  80082d:	4c 89 e1             	mov    %r12,%rcx
+  800830:	4c 89 f2             	mov    %r14,%rdx
+  800833:	48 bf 60 61 80 00 00 	movabs $0x806160,%rdi
+  80083a:	00 00 00 
+  80083d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800842:	49 bc 24 09 80 00 00 	movabs $0x800924,%r12
+  800849:	00 00 00 
+  80084c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80084f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800853:	48 89 df             	mov    %rbx,%rdi
+  800856:	48 b8 c0 08 80 00 00 	movabs $0x8008c0,%rax
+  80085d:	00 00 00 
+  800860:	ff d0                	call   *%rax
+    cprintf("\n");
+  800862:	48 bf 97 60 80 00 00 	movabs $0x806097,%rdi
+  800869:	00 00 00 
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800874:	cc                   	int3
+  800875:	eb fd                	jmp    800874 <_panic+0xa0>
+
+0000000000800877 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800877:	55                   	push   %rbp
+  800878:	48 89 e5             	mov    %rsp,%rbp
+  80087b:	53                   	push   %rbx
+  80087c:	48 83 ec 08          	sub    $0x8,%rsp
+  800880:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800883:	8b 06                	mov    (%rsi),%eax
+  800885:	8d 50 01             	lea    0x1(%rax),%edx
+  800888:	89 16                	mov    %edx,(%rsi)
+  80088a:	48 98                	cltq
+  80088c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800891:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800897:	74 0a                	je     8008a3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800899:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80089d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008a3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008a7:	be ff 00 00 00       	mov    $0xff,%esi
+  8008ac:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  8008b3:	00 00 00 
+  8008b6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8008b8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8008be:	eb d9                	jmp    800899 <putch+0x22>
+
+00000000008008c0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8008c0:	55                   	push   %rbp
+  8008c1:	48 89 e5             	mov    %rsp,%rbp
+  8008c4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8008cb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8008ce:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8008d5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8008da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008df:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8008e2:	48 89 f1             	mov    %rsi,%rcx
+  8008e5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8008ec:	48 bf 77 08 80 00 00 	movabs $0x800877,%rdi
+  8008f3:	00 00 00 
+  8008f6:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  8008fd:	00 00 00 
+  800900:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800902:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800909:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800910:	48 b8 73 18 80 00 00 	movabs $0x801873,%rax
+  800917:	00 00 00 
+  80091a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80091c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+0000000000800924 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800924:	55                   	push   %rbp
+  800925:	48 89 e5             	mov    %rsp,%rbp
+  800928:	48 83 ec 50          	sub    $0x50,%rsp
+  80092c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800930:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800934:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800938:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80093c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800940:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800947:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80094b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800953:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800957:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80095b:	48 b8 c0 08 80 00 00 	movabs $0x8008c0,%rax
+  800962:	00 00 00 
+  800965:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800967:	c9                   	leave
+  800968:	c3                   	ret
+
+0000000000800969 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800969:	55                   	push   %rbp
+  80096a:	48 89 e5             	mov    %rsp,%rbp
+  80096d:	41 57                	push   %r15
+  80096f:	41 56                	push   %r14
+  800971:	41 55                	push   %r13
+  800973:	41 54                	push   %r12
+  800975:	53                   	push   %rbx
+  800976:	48 83 ec 18          	sub    $0x18,%rsp
+  80097a:	49 89 fc             	mov    %rdi,%r12
+  80097d:	49 89 f5             	mov    %rsi,%r13
+  800980:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800984:	8b 45 10             	mov    0x10(%rbp),%eax
+  800987:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80098a:	41 89 cf             	mov    %ecx,%r15d
+  80098d:	4c 39 fa             	cmp    %r15,%rdx
+  800990:	73 5b                	jae    8009ed <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800992:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800996:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80099a:	85 db                	test   %ebx,%ebx
+  80099c:	7e 0e                	jle    8009ac <print_num+0x43>
+            putch(padc, put_arg);
+  80099e:	4c 89 ee             	mov    %r13,%rsi
+  8009a1:	44 89 f7             	mov    %r14d,%edi
+  8009a4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009a7:	83 eb 01             	sub    $0x1,%ebx
+  8009aa:	75 f2                	jne    80099e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009ac:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009b0:	48 b9 94 61 80 00 00 	movabs $0x806194,%rcx
+  8009b7:	00 00 00 
+  8009ba:	48 b8 83 61 80 00 00 	movabs $0x806183,%rax
+  8009c1:	00 00 00 
+  8009c4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8009c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d1:	49 f7 f7             	div    %r15
+  8009d4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8009d8:	4c 89 ee             	mov    %r13,%rsi
+  8009db:	41 ff d4             	call   *%r12
+}
+  8009de:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8009e2:	5b                   	pop    %rbx
+  8009e3:	41 5c                	pop    %r12
+  8009e5:	41 5d                	pop    %r13
+  8009e7:	41 5e                	pop    %r14
+  8009e9:	41 5f                	pop    %r15
+  8009eb:	5d                   	pop    %rbp
+  8009ec:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8009ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f6:	49 f7 f7             	div    %r15
+  8009f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009fd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a01:	52                   	push   %rdx
+  800a02:	45 0f be c9          	movsbl %r9b,%r9d
+  800a06:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a0a:	48 89 c2             	mov    %rax,%rdx
+  800a0d:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  800a14:	00 00 00 
+  800a17:	ff d0                	call   *%rax
+  800a19:	48 83 c4 10          	add    $0x10,%rsp
+  800a1d:	eb 8d                	jmp    8009ac <print_num+0x43>
+
+0000000000800a1f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a1f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a23:	48 8b 06             	mov    (%rsi),%rax
+  800a26:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a2a:	73 0a                	jae    800a36 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a2c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a30:	48 89 16             	mov    %rdx,(%rsi)
+  800a33:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a36:	c3                   	ret
+
+0000000000800a37 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	48 83 ec 50          	sub    $0x50,%rsp
+  800a3f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a43:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a47:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a4b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a5e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a62:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a66:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  800a6d:	00 00 00 
+  800a70:	ff d0                	call   *%rax
+}
+  800a72:	c9                   	leave
+  800a73:	c3                   	ret
+
+0000000000800a74 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800a74:	55                   	push   %rbp
+  800a75:	48 89 e5             	mov    %rsp,%rbp
+  800a78:	41 57                	push   %r15
+  800a7a:	41 56                	push   %r14
+  800a7c:	41 55                	push   %r13
+  800a7e:	41 54                	push   %r12
+  800a80:	53                   	push   %rbx
+  800a81:	48 83 ec 38          	sub    $0x38,%rsp
+  800a85:	49 89 fe             	mov    %rdi,%r14
+  800a88:	49 89 f5             	mov    %rsi,%r13
+  800a8b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800a8e:	48 8b 01             	mov    (%rcx),%rax
+  800a91:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a95:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800aa1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800aa5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800aa9:	0f b6 3b             	movzbl (%rbx),%edi
+  800aac:	40 80 ff 25          	cmp    $0x25,%dil
+  800ab0:	74 18                	je     800aca <vprintfmt+0x56>
+            if (!ch) return;
+  800ab2:	40 84 ff             	test   %dil,%dil
+  800ab5:	0f 84 04 07 00 00    	je     8011bf <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800abb:	40 0f b6 ff          	movzbl %dil,%edi
+  800abf:	4c 89 ee             	mov    %r13,%rsi
+  800ac2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800ac5:	4c 89 e3             	mov    %r12,%rbx
+  800ac8:	eb db                	jmp    800aa5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800aca:	be 00 00 00 00       	mov    $0x0,%esi
+  800acf:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800ad8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800ade:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800ae5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ae9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800aee:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800af3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800af6:	83 e8 23             	sub    $0x23,%eax
+  800af9:	3c 57                	cmp    $0x57,%al
+  800afb:	0f 87 a4 06 00 00    	ja     8011a5 <vprintfmt+0x731>
+  800b01:	0f b6 c0             	movzbl %al,%eax
+  800b04:	48 b9 20 63 80 00 00 	movabs $0x806320,%rcx
+  800b0b:	00 00 00 
+  800b0e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b11:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b14:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b18:	eb cf                	jmp    800ae9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b1a:	49 89 dc             	mov    %rbx,%r12
+  800b1d:	be 01 00 00 00       	mov    $0x1,%esi
+  800b22:	eb c5                	jmp    800ae9 <vprintfmt+0x75>
+            padc = ch;
+  800b24:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b28:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b2b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b2e:	eb b9                	jmp    800ae9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	77 24                	ja     800b5c <vprintfmt+0xe8>
+  800b38:	89 c1                	mov    %eax,%ecx
+  800b3a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b47:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b4a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b4e:	79 99                	jns    800ae9 <vprintfmt+0x75>
+                width = precision;
+  800b50:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b54:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b5a:	eb 8d                	jmp    800ae9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b5c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b60:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	eb da                	jmp    800b44 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b6a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800b6f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b73:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800b79:	3c 39                	cmp    $0x39,%al
+  800b7b:	77 1c                	ja     800b99 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800b7d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800b81:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800b85:	0f b6 c0             	movzbl %al,%eax
+  800b88:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b8d:	0f b6 03             	movzbl (%rbx),%eax
+  800b90:	3c 39                	cmp    $0x39,%al
+  800b92:	76 e9                	jbe    800b7d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b94:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800b97:	eb b1                	jmp    800b4a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800b99:	49 89 dc             	mov    %rbx,%r12
+  800b9c:	eb ac                	jmp    800b4a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800b9e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800ba1:	85 c9                	test   %ecx,%ecx
+  800ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba8:	0f 49 c1             	cmovns %ecx,%eax
+  800bab:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bb1:	e9 33 ff ff ff       	jmp    800ae9 <vprintfmt+0x75>
+            lflag++;
+  800bb6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800bb9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bbc:	e9 28 ff ff ff       	jmp    800ae9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc7:	77 19                	ja     800be2 <vprintfmt+0x16e>
+  800bc9:	89 c2                	mov    %eax,%edx
+  800bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcf:	83 c0 08             	add    $0x8,%eax
+  800bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd5:	8b 3a                	mov    (%rdx),%edi
+  800bd7:	4c 89 ee             	mov    %r13,%rsi
+  800bda:	41 ff d6             	call   *%r14
+            break;
+  800bdd:	e9 c3 fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bee:	eb e5                	jmp    800bd5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	77 5a                	ja     800c52 <vprintfmt+0x1de>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfe:	83 c0 08             	add    $0x8,%eax
+  800c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c04:	8b 02                	mov    (%rdx),%eax
+  800c06:	89 c1                	mov    %eax,%ecx
+  800c08:	f7 d9                	neg    %ecx
+  800c0a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c0d:	83 f9 13             	cmp    $0x13,%ecx
+  800c10:	7f 4e                	jg     800c60 <vprintfmt+0x1ec>
+  800c12:	48 63 c1             	movslq %ecx,%rax
+  800c15:	48 ba e0 65 80 00 00 	movabs $0x8065e0,%rdx
+  800c1c:	00 00 00 
+  800c1f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c23:	48 85 c0             	test   %rax,%rax
+  800c26:	74 38                	je     800c60 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c28:	48 89 c1             	mov    %rax,%rcx
+  800c2b:	48 ba ac 68 80 00 00 	movabs $0x8068ac,%rdx
+  800c32:	00 00 00 
+  800c35:	4c 89 ee             	mov    %r13,%rsi
+  800c38:	4c 89 f7             	mov    %r14,%rdi
+  800c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c40:	49 b8 37 0a 80 00 00 	movabs $0x800a37,%r8
+  800c47:	00 00 00 
+  800c4a:	41 ff d0             	call   *%r8
+  800c4d:	e9 53 fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5e:	eb a4                	jmp    800c04 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c60:	48 ba ac 61 80 00 00 	movabs $0x8061ac,%rdx
+  800c67:	00 00 00 
+  800c6a:	4c 89 ee             	mov    %r13,%rsi
+  800c6d:	4c 89 f7             	mov    %r14,%rdi
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c75:	49 b8 37 0a 80 00 00 	movabs $0x800a37,%r8
+  800c7c:	00 00 00 
+  800c7f:	41 ff d0             	call   *%r8
+  800c82:	e9 1e fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 36                	ja     800cc5 <vprintfmt+0x251>
+  800c8f:	89 c2                	mov    %eax,%edx
+  800c91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c95:	83 c0 08             	add    $0x8,%eax
+  800c98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800c9e:	48 85 f6             	test   %rsi,%rsi
+  800ca1:	48 b8 a5 61 80 00 00 	movabs $0x8061a5,%rax
+  800ca8:	00 00 00 
+  800cab:	48 0f 45 c6          	cmovne %rsi,%rax
+  800caf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800cb3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800cb7:	7e 06                	jle    800cbf <vprintfmt+0x24b>
+  800cb9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800cbd:	75 14                	jne    800cd3 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800cbf:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800cc3:	eb 5b                	jmp    800d20 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800cc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd1:	eb c8                	jmp    800c9b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800cd3:	49 63 f7             	movslq %r15d,%rsi
+  800cd6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800cda:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  800ce1:	00 00 00 
+  800ce4:	ff d0                	call   *%rax
+  800ce6:	48 89 c2             	mov    %rax,%rdx
+  800ce9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cec:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800cee:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800cf1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7e c7                	jle    800cbf <vprintfmt+0x24b>
+  800cf8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800cfd:	4c 89 ee             	mov    %r13,%rsi
+  800d00:	44 89 e7             	mov    %r12d,%edi
+  800d03:	41 ff d6             	call   *%r14
+  800d06:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d0a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d0d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d10:	75 eb                	jne    800cfd <vprintfmt+0x289>
+  800d12:	eb ab                	jmp    800cbf <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d14:	0f b6 f8             	movzbl %al,%edi
+  800d17:	4c 89 ee             	mov    %r13,%rsi
+  800d1a:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800d1d:	4c 89 e2             	mov    %r12,%rdx
+  800d20:	45 85 ff             	test   %r15d,%r15d
+  800d23:	78 06                	js     800d2b <vprintfmt+0x2b7>
+  800d25:	41 83 ef 01          	sub    $0x1,%r15d
+  800d29:	78 23                	js     800d4e <vprintfmt+0x2da>
+  800d2b:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800d2f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d35:	84 c0                	test   %al,%al
+  800d37:	74 15                	je     800d4e <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d39:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800d3d:	74 d5                	je     800d14 <vprintfmt+0x2a0>
+  800d3f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800d42:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d47:	80 fa 5e             	cmp    $0x5e,%dl
+  800d4a:	77 cb                	ja     800d17 <vprintfmt+0x2a3>
+  800d4c:	eb c6                	jmp    800d14 <vprintfmt+0x2a0>
+  800d4e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d51:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800d54:	01 f0                	add    %esi,%eax
+  800d56:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800d58:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d5c:	85 c0                	test   %eax,%eax
+  800d5e:	0f 8e 41 fd ff ff    	jle    800aa5 <vprintfmt+0x31>
+  800d64:	4c 89 ee             	mov    %r13,%rsi
+  800d67:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d6c:	41 ff d6             	call   *%r14
+  800d6f:	41 83 ec 01          	sub    $0x1,%r12d
+  800d73:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d77:	75 eb                	jne    800d64 <vprintfmt+0x2f0>
+  800d79:	e9 27 fd ff ff       	jmp    800aa5 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800d7e:	40 84 f6             	test   %sil,%sil
+  800d81:	75 26                	jne    800da9 <vprintfmt+0x335>
+    switch (lflag) {
+  800d83:	85 d2                	test   %edx,%edx
+  800d85:	74 59                	je     800de0 <vprintfmt+0x36c>
+  800d87:	83 fa 01             	cmp    $0x1,%edx
+  800d8a:	74 7b                	je     800e07 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d92:	0f 87 96 00 00 00    	ja     800e2e <vprintfmt+0x3ba>
+  800d98:	89 c2                	mov    %eax,%edx
+  800d9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9e:	83 c0 08             	add    $0x8,%eax
+  800da1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da4:	4c 8b 22             	mov    (%rdx),%r12
+  800da7:	eb 17                	jmp    800dc0 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800da9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dac:	83 f8 2f             	cmp    $0x2f,%eax
+  800daf:	77 21                	ja     800dd2 <vprintfmt+0x35e>
+  800db1:	89 c2                	mov    %eax,%edx
+  800db3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db7:	83 c0 08             	add    $0x8,%eax
+  800dba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dbd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800dc0:	4d 85 e4             	test   %r12,%r12
+  800dc3:	78 7a                	js     800e3f <vprintfmt+0x3cb>
+            num = i;
+  800dc5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800dc8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800dcd:	e9 b5 02 00 00       	jmp    801087 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800dd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dde:	eb dd                	jmp    800dbd <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800de0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de3:	83 f8 2f             	cmp    $0x2f,%eax
+  800de6:	77 11                	ja     800df9 <vprintfmt+0x385>
+  800de8:	89 c2                	mov    %eax,%edx
+  800dea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dee:	83 c0 08             	add    $0x8,%eax
+  800df1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df4:	4c 63 22             	movslq (%rdx),%r12
+  800df7:	eb c7                	jmp    800dc0 <vprintfmt+0x34c>
+  800df9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e05:	eb ed                	jmp    800df4 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800e07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0d:	77 11                	ja     800e20 <vprintfmt+0x3ac>
+  800e0f:	89 c2                	mov    %eax,%edx
+  800e11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e15:	83 c0 08             	add    $0x8,%eax
+  800e18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1b:	4c 8b 22             	mov    (%rdx),%r12
+  800e1e:	eb a0                	jmp    800dc0 <vprintfmt+0x34c>
+  800e20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e2c:	eb ed                	jmp    800e1b <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800e2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3a:	e9 65 ff ff ff       	jmp    800da4 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800e3f:	4c 89 ee             	mov    %r13,%rsi
+  800e42:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e47:	41 ff d6             	call   *%r14
+                i = -i;
+  800e4a:	49 f7 dc             	neg    %r12
+  800e4d:	e9 73 ff ff ff       	jmp    800dc5 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800e52:	40 84 f6             	test   %sil,%sil
+  800e55:	75 32                	jne    800e89 <vprintfmt+0x415>
+    switch (lflag) {
+  800e57:	85 d2                	test   %edx,%edx
+  800e59:	74 5d                	je     800eb8 <vprintfmt+0x444>
+  800e5b:	83 fa 01             	cmp    $0x1,%edx
+  800e5e:	0f 84 82 00 00 00    	je     800ee6 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800e64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e67:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6a:	0f 87 a5 00 00 00    	ja     800f15 <vprintfmt+0x4a1>
+  800e70:	89 c2                	mov    %eax,%edx
+  800e72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e76:	83 c0 08             	add    $0x8,%eax
+  800e79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e7f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e84:	e9 fe 01 00 00       	jmp    801087 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800e89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e8f:	77 19                	ja     800eaa <vprintfmt+0x436>
+  800e91:	89 c2                	mov    %eax,%edx
+  800e93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e97:	83 c0 08             	add    $0x8,%eax
+  800e9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e9d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ea0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ea5:	e9 dd 01 00 00       	jmp    801087 <vprintfmt+0x613>
+  800eaa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eb6:	eb e5                	jmp    800e9d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800eb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ebb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ebe:	77 18                	ja     800ed8 <vprintfmt+0x464>
+  800ec0:	89 c2                	mov    %eax,%edx
+  800ec2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ec6:	83 c0 08             	add    $0x8,%eax
+  800ec9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ecc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ece:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ed3:	e9 af 01 00 00       	jmp    801087 <vprintfmt+0x613>
+  800ed8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800edc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee4:	eb e6                	jmp    800ecc <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800ee6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee9:	83 f8 2f             	cmp    $0x2f,%eax
+  800eec:	77 19                	ja     800f07 <vprintfmt+0x493>
+  800eee:	89 c2                	mov    %eax,%edx
+  800ef0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ef4:	83 c0 08             	add    $0x8,%eax
+  800ef7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800efa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800efd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f02:	e9 80 01 00 00       	jmp    801087 <vprintfmt+0x613>
+  800f07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f13:	eb e5                	jmp    800efa <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800f15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f21:	e9 56 ff ff ff       	jmp    800e7c <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800f26:	40 84 f6             	test   %sil,%sil
+  800f29:	75 2e                	jne    800f59 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800f2b:	85 d2                	test   %edx,%edx
+  800f2d:	0f 84 b3 00 00 00    	je     800fe6 <vprintfmt+0x572>
+  800f33:	83 fa 01             	cmp    $0x1,%edx
+  800f36:	0f 84 d3 00 00 00    	je     80100f <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800f3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800f42:	0f 87 f1 00 00 00    	ja     801039 <vprintfmt+0x5c5>
+  800f48:	89 c2                	mov    %eax,%edx
+  800f4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f4e:	83 c0 08             	add    $0x8,%eax
+  800f51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f54:	48 8b 02             	mov    (%rdx),%rax
+  800f57:	eb 17                	jmp    800f70 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800f59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f5f:	77 77                	ja     800fd8 <vprintfmt+0x564>
+  800f61:	89 c2                	mov    %eax,%edx
+  800f63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f67:	83 c0 08             	add    $0x8,%eax
+  800f6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f6d:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800f70:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800f72:	83 f8 07             	cmp    $0x7,%eax
+  800f75:	0f 8e cf 00 00 00    	jle    80104a <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800f7b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800f81:	44 89 e7             	mov    %r12d,%edi
+  800f84:	41 c1 e4 03          	shl    $0x3,%r12d
+  800f88:	89 d1                	mov    %edx,%ecx
+  800f8a:	8d 72 07             	lea    0x7(%rdx),%esi
+  800f8d:	85 d2                	test   %edx,%edx
+  800f8f:	0f 48 d6             	cmovs  %esi,%edx
+  800f92:	c1 fa 03             	sar    $0x3,%edx
+  800f95:	83 f9 3f             	cmp    $0x3f,%ecx
+  800f98:	7f e7                	jg     800f81 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800f9a:	85 ff                	test   %edi,%edi
+  800f9c:	0f 84 03 fb ff ff    	je     800aa5 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800fa2:	49 63 f4             	movslq %r12d,%rsi
+  800fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800faa:	48 f7 f6             	div    %rsi
+  800fad:	49 89 d7             	mov    %rdx,%r15
+  800fb0:	83 c0 30             	add    $0x30,%eax
+  800fb3:	0f be f8             	movsbl %al,%edi
+  800fb6:	4c 89 ee             	mov    %r13,%rsi
+  800fb9:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800fbc:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800fbf:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800fc4:	45 85 e4             	test   %r12d,%r12d
+  800fc7:	41 0f 49 d4          	cmovns %r12d,%edx
+  800fcb:	c1 fa 03             	sar    $0x3,%edx
+  800fce:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800fd1:	75 cf                	jne    800fa2 <vprintfmt+0x52e>
+  800fd3:	e9 cd fa ff ff       	jmp    800aa5 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800fd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fdc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe4:	eb 87                	jmp    800f6d <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800fe6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fe9:	83 f8 2f             	cmp    $0x2f,%eax
+  800fec:	77 13                	ja     801001 <vprintfmt+0x58d>
+  800fee:	89 c2                	mov    %eax,%edx
+  800ff0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ff4:	83 c0 08             	add    $0x8,%eax
+  800ff7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ffa:	8b 02                	mov    (%rdx),%eax
+  800ffc:	e9 6f ff ff ff       	jmp    800f70 <vprintfmt+0x4fc>
+  801001:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801005:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801009:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80100d:	eb eb                	jmp    800ffa <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  80100f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801012:	83 f8 2f             	cmp    $0x2f,%eax
+  801015:	77 14                	ja     80102b <vprintfmt+0x5b7>
+  801017:	89 c2                	mov    %eax,%edx
+  801019:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80101d:	83 c0 08             	add    $0x8,%eax
+  801020:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801023:	48 8b 02             	mov    (%rdx),%rax
+  801026:	e9 45 ff ff ff       	jmp    800f70 <vprintfmt+0x4fc>
+  80102b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80102f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801033:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801037:	eb ea                	jmp    801023 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  801039:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80103d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801041:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801045:	e9 0a ff ff ff       	jmp    800f54 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80104a:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  801050:	e9 4d ff ff ff       	jmp    800fa2 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  801055:	4c 89 ee             	mov    %r13,%rsi
+  801058:	bf 30 00 00 00       	mov    $0x30,%edi
+  80105d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801060:	4c 89 ee             	mov    %r13,%rsi
+  801063:	bf 78 00 00 00       	mov    $0x78,%edi
+  801068:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80106b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80106e:	83 f8 2f             	cmp    $0x2f,%eax
+  801071:	77 47                	ja     8010ba <vprintfmt+0x646>
+  801073:	89 c2                	mov    %eax,%edx
+  801075:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801079:	83 c0 08             	add    $0x8,%eax
+  80107c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80107f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801082:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801087:	48 83 ec 08          	sub    $0x8,%rsp
+  80108b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80108f:	0f 94 c0             	sete   %al
+  801092:	0f b6 c0             	movzbl %al,%eax
+  801095:	50                   	push   %rax
+  801096:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80109b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80109f:	4c 89 ee             	mov    %r13,%rsi
+  8010a2:	4c 89 f7             	mov    %r14,%rdi
+  8010a5:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  8010ac:	00 00 00 
+  8010af:	ff d0                	call   *%rax
+            break;
+  8010b1:	48 83 c4 10          	add    $0x10,%rsp
+  8010b5:	e9 eb f9 ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8010ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010c6:	eb b7                	jmp    80107f <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  8010c8:	40 84 f6             	test   %sil,%sil
+  8010cb:	75 2b                	jne    8010f8 <vprintfmt+0x684>
+    switch (lflag) {
+  8010cd:	85 d2                	test   %edx,%edx
+  8010cf:	74 56                	je     801127 <vprintfmt+0x6b3>
+  8010d1:	83 fa 01             	cmp    $0x1,%edx
+  8010d4:	74 7f                	je     801155 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8010d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8010dc:	0f 87 a2 00 00 00    	ja     801184 <vprintfmt+0x710>
+  8010e2:	89 c2                	mov    %eax,%edx
+  8010e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e8:	83 c0 08             	add    $0x8,%eax
+  8010eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010ee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010f1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010f6:	eb 8f                	jmp    801087 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8010f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8010fe:	77 19                	ja     801119 <vprintfmt+0x6a5>
+  801100:	89 c2                	mov    %eax,%edx
+  801102:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801106:	83 c0 08             	add    $0x8,%eax
+  801109:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80110c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80110f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801114:	e9 6e ff ff ff       	jmp    801087 <vprintfmt+0x613>
+  801119:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80111d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801121:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801125:	eb e5                	jmp    80110c <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  801127:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80112a:	83 f8 2f             	cmp    $0x2f,%eax
+  80112d:	77 18                	ja     801147 <vprintfmt+0x6d3>
+  80112f:	89 c2                	mov    %eax,%edx
+  801131:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801135:	83 c0 08             	add    $0x8,%eax
+  801138:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80113b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80113d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801142:	e9 40 ff ff ff       	jmp    801087 <vprintfmt+0x613>
+  801147:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80114b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80114f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801153:	eb e6                	jmp    80113b <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  801155:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801158:	83 f8 2f             	cmp    $0x2f,%eax
+  80115b:	77 19                	ja     801176 <vprintfmt+0x702>
+  80115d:	89 c2                	mov    %eax,%edx
+  80115f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801163:	83 c0 08             	add    $0x8,%eax
+  801166:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801169:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80116c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801171:	e9 11 ff ff ff       	jmp    801087 <vprintfmt+0x613>
+  801176:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80117a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80117e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801182:	eb e5                	jmp    801169 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  801184:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801188:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80118c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801190:	e9 59 ff ff ff       	jmp    8010ee <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  801195:	4c 89 ee             	mov    %r13,%rsi
+  801198:	bf 25 00 00 00       	mov    $0x25,%edi
+  80119d:	41 ff d6             	call   *%r14
+            break;
+  8011a0:	e9 00 f9 ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8011a5:	4c 89 ee             	mov    %r13,%rsi
+  8011a8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011ad:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8011b0:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8011b8:	75 f6                	jne    8011b0 <vprintfmt+0x73c>
+  8011ba:	e9 e6 f8 ff ff       	jmp    800aa5 <vprintfmt+0x31>
+}
+  8011bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011c3:	5b                   	pop    %rbx
+  8011c4:	41 5c                	pop    %r12
+  8011c6:	41 5d                	pop    %r13
+  8011c8:	41 5e                	pop    %r14
+  8011ca:	41 5f                	pop    %r15
+  8011cc:	5d                   	pop    %rbp
+  8011cd:	c3                   	ret
+
+00000000008011ce <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+  8011d2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8011d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011da:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8011df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8011e3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8011ea:	48 85 ff             	test   %rdi,%rdi
+  8011ed:	74 2b                	je     80121a <vsnprintf+0x4c>
+  8011ef:	48 85 f6             	test   %rsi,%rsi
+  8011f2:	74 26                	je     80121a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011f8:	48 bf 1f 0a 80 00 00 	movabs $0x800a1f,%rdi
+  8011ff:	00 00 00 
+  801202:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  801209:	00 00 00 
+  80120c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80120e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801212:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801215:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80121a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121f:	eb f7                	jmp    801218 <vsnprintf+0x4a>
+
+0000000000801221 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+  801225:	48 83 ec 50          	sub    $0x50,%rsp
+  801229:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80122d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801231:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801235:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80123c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801240:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801244:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801248:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80124c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801250:	48 b8 ce 11 80 00 00 	movabs $0x8011ce,%rax
+  801257:	00 00 00 
+  80125a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+000000000080125e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80125e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801261:	74 10                	je     801273 <strlen+0x15>
+    size_t n = 0;
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801268:	48 83 c0 01          	add    $0x1,%rax
+  80126c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801270:	75 f6                	jne    801268 <strlen+0xa>
+  801272:	c3                   	ret
+    size_t n = 0;
+  801273:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801278:	c3                   	ret
+
+0000000000801279 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801279:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80127c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801281:	48 85 f6             	test   %rsi,%rsi
+  801284:	74 11                	je     801297 <strnlen+0x1e>
+  801286:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80128a:	74 0c                	je     801298 <strnlen+0x1f>
+  80128c:	48 83 c2 01          	add    $0x1,%rdx
+  801290:	48 39 d0             	cmp    %rdx,%rax
+  801293:	75 f1                	jne    801286 <strnlen+0xd>
+  801295:	eb 04                	jmp    80129b <strnlen+0x22>
+  801297:	c3                   	ret
+  801298:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80129b:	c3                   	ret
+
+000000000080129c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80129c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80129f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8012a8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8012ab:	48 83 c2 01          	add    $0x1,%rdx
+  8012af:	84 c9                	test   %cl,%cl
+  8012b1:	75 f1                	jne    8012a4 <strcpy+0x8>
+        ;
+    return res;
+}
+  8012b3:	c3                   	ret
+
+00000000008012b4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8012b4:	55                   	push   %rbp
+  8012b5:	48 89 e5             	mov    %rsp,%rbp
+  8012b8:	41 54                	push   %r12
+  8012ba:	53                   	push   %rbx
+  8012bb:	48 89 fb             	mov    %rdi,%rbx
+  8012be:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8012c1:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  8012c8:	00 00 00 
+  8012cb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8012cd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8012d1:	4c 89 e6             	mov    %r12,%rsi
+  8012d4:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8012db:	00 00 00 
+  8012de:	ff d0                	call   *%rax
+    return dst;
+}
+  8012e0:	48 89 d8             	mov    %rbx,%rax
+  8012e3:	5b                   	pop    %rbx
+  8012e4:	41 5c                	pop    %r12
+  8012e6:	5d                   	pop    %rbp
+  8012e7:	c3                   	ret
+
+00000000008012e8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8012e8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8012eb:	48 85 d2             	test   %rdx,%rdx
+  8012ee:	74 1f                	je     80130f <strncpy+0x27>
+  8012f0:	48 01 fa             	add    %rdi,%rdx
+  8012f3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012f6:	48 83 c1 01          	add    $0x1,%rcx
+  8012fa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012fe:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801302:	41 80 f8 01          	cmp    $0x1,%r8b
+  801306:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80130a:	48 39 ca             	cmp    %rcx,%rdx
+  80130d:	75 e7                	jne    8012f6 <strncpy+0xe>
+    }
+    return ret;
+}
+  80130f:	c3                   	ret
+
+0000000000801310 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801310:	48 89 f8             	mov    %rdi,%rax
+  801313:	48 85 d2             	test   %rdx,%rdx
+  801316:	74 24                	je     80133c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801318:	48 83 ea 01          	sub    $0x1,%rdx
+  80131c:	74 1b                	je     801339 <strlcpy+0x29>
+  80131e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801322:	0f b6 16             	movzbl (%rsi),%edx
+  801325:	84 d2                	test   %dl,%dl
+  801327:	74 10                	je     801339 <strlcpy+0x29>
+            *dst++ = *src++;
+  801329:	48 83 c6 01          	add    $0x1,%rsi
+  80132d:	48 83 c0 01          	add    $0x1,%rax
+  801331:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801334:	48 39 c8             	cmp    %rcx,%rax
+  801337:	75 e9                	jne    801322 <strlcpy+0x12>
+        *dst = '\0';
+  801339:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80133c:	48 29 f8             	sub    %rdi,%rax
+}
+  80133f:	c3                   	ret
+
+0000000000801340 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801340:	0f b6 07             	movzbl (%rdi),%eax
+  801343:	84 c0                	test   %al,%al
+  801345:	74 13                	je     80135a <strcmp+0x1a>
+  801347:	38 06                	cmp    %al,(%rsi)
+  801349:	75 0f                	jne    80135a <strcmp+0x1a>
+  80134b:	48 83 c7 01          	add    $0x1,%rdi
+  80134f:	48 83 c6 01          	add    $0x1,%rsi
+  801353:	0f b6 07             	movzbl (%rdi),%eax
+  801356:	84 c0                	test   %al,%al
+  801358:	75 ed                	jne    801347 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80135a:	0f b6 c0             	movzbl %al,%eax
+  80135d:	0f b6 16             	movzbl (%rsi),%edx
+  801360:	29 d0                	sub    %edx,%eax
+}
+  801362:	c3                   	ret
+
+0000000000801363 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801363:	48 85 d2             	test   %rdx,%rdx
+  801366:	74 1f                	je     801387 <strncmp+0x24>
+  801368:	0f b6 07             	movzbl (%rdi),%eax
+  80136b:	84 c0                	test   %al,%al
+  80136d:	74 1e                	je     80138d <strncmp+0x2a>
+  80136f:	3a 06                	cmp    (%rsi),%al
+  801371:	75 1a                	jne    80138d <strncmp+0x2a>
+  801373:	48 83 c7 01          	add    $0x1,%rdi
+  801377:	48 83 c6 01          	add    $0x1,%rsi
+  80137b:	48 83 ea 01          	sub    $0x1,%rdx
+  80137f:	75 e7                	jne    801368 <strncmp+0x5>
+
+    if (!n) return 0;
+  801381:	b8 00 00 00 00       	mov    $0x0,%eax
+  801386:	c3                   	ret
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138c:	c3                   	ret
+  80138d:	48 85 d2             	test   %rdx,%rdx
+  801390:	74 09                	je     80139b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801392:	0f b6 07             	movzbl (%rdi),%eax
+  801395:	0f b6 16             	movzbl (%rsi),%edx
+  801398:	29 d0                	sub    %edx,%eax
+  80139a:	c3                   	ret
+    if (!n) return 0;
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a0:	c3                   	ret
+
+00000000008013a1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8013a1:	0f b6 17             	movzbl (%rdi),%edx
+  8013a4:	84 d2                	test   %dl,%dl
+  8013a6:	74 18                	je     8013c0 <strchr+0x1f>
+        if (*str == c) {
+  8013a8:	0f be d2             	movsbl %dl,%edx
+  8013ab:	39 f2                	cmp    %esi,%edx
+  8013ad:	74 17                	je     8013c6 <strchr+0x25>
+    for (; *str; str++) {
+  8013af:	48 83 c7 01          	add    $0x1,%rdi
+  8013b3:	0f b6 17             	movzbl (%rdi),%edx
+  8013b6:	84 d2                	test   %dl,%dl
+  8013b8:	75 ee                	jne    8013a8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8013ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bf:	c3                   	ret
+  8013c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c5:	c3                   	ret
+  8013c6:	48 89 f8             	mov    %rdi,%rax
+}
+  8013c9:	c3                   	ret
+
+00000000008013ca <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8013ca:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8013cd:	0f b6 17             	movzbl (%rdi),%edx
+  8013d0:	84 d2                	test   %dl,%dl
+  8013d2:	74 13                	je     8013e7 <strfind+0x1d>
+  8013d4:	0f be d2             	movsbl %dl,%edx
+  8013d7:	39 f2                	cmp    %esi,%edx
+  8013d9:	74 0b                	je     8013e6 <strfind+0x1c>
+  8013db:	48 83 c0 01          	add    $0x1,%rax
+  8013df:	0f b6 10             	movzbl (%rax),%edx
+  8013e2:	84 d2                	test   %dl,%dl
+  8013e4:	75 ee                	jne    8013d4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8013e6:	c3                   	ret
+  8013e7:	c3                   	ret
+
+00000000008013e8 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  8013e8:	55                   	push   %rbp
+  8013e9:	48 89 e5             	mov    %rsp,%rbp
+  8013ec:	41 57                	push   %r15
+  8013ee:	41 56                	push   %r14
+  8013f0:	41 55                	push   %r13
+  8013f2:	41 54                	push   %r12
+  8013f4:	53                   	push   %rbx
+  8013f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f9:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  8013fc:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801400:	45 84 ed             	test   %r13b,%r13b
+  801403:	75 12                	jne    801417 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801405:	4c 89 f8             	mov    %r15,%rax
+  801408:	48 83 c4 08          	add    $0x8,%rsp
+  80140c:	5b                   	pop    %rbx
+  80140d:	41 5c                	pop    %r12
+  80140f:	41 5d                	pop    %r13
+  801411:	41 5e                	pop    %r14
+  801413:	41 5f                	pop    %r15
+  801415:	5d                   	pop    %rbp
+  801416:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801417:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  80141b:	4c 89 e7             	mov    %r12,%rdi
+  80141e:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  801425:	00 00 00 
+  801428:	ff d0                	call   *%rax
+  80142a:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  80142d:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801431:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801435:	49 bf 63 13 80 00 00 	movabs $0x801363,%r15
+  80143c:	00 00 00 
+				if ((sc = *s++) == 0)
+  80143f:	84 c0                	test   %al,%al
+  801441:	75 14                	jne    801457 <strstr+0x6f>
+					return NULL;
+  801443:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801449:	eb ba                	jmp    801405 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  80144b:	48 83 c3 01          	add    $0x1,%rbx
+  80144f:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801453:	84 c0                	test   %al,%al
+  801455:	74 1b                	je     801472 <strstr+0x8a>
+			} while (sc != c);
+  801457:	41 38 c5             	cmp    %al,%r13b
+  80145a:	75 ef                	jne    80144b <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  80145c:	4c 89 f2             	mov    %r14,%rdx
+  80145f:	4c 89 e6             	mov    %r12,%rsi
+  801462:	48 89 df             	mov    %rbx,%rdi
+  801465:	41 ff d7             	call   *%r15
+  801468:	85 c0                	test   %eax,%eax
+  80146a:	75 df                	jne    80144b <strstr+0x63>
+  80146c:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801470:	eb 93                	jmp    801405 <strstr+0x1d>
+					return NULL;
+  801472:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801478:	eb 8b                	jmp    801405 <strstr+0x1d>
+
+000000000080147a <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  80147a:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  80147c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  80147f:	8d 57 20             	lea    0x20(%rdi),%edx
+  801482:	83 f9 1a             	cmp    $0x1a,%ecx
+  801485:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801488:	c3                   	ret
+
+0000000000801489 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801489:	55                   	push   %rbp
+  80148a:	48 89 e5             	mov    %rsp,%rbp
+  80148d:	41 57                	push   %r15
+  80148f:	41 56                	push   %r14
+  801491:	41 55                	push   %r13
+  801493:	41 54                	push   %r12
+  801495:	53                   	push   %rbx
+  801496:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  80149a:	48 39 f7             	cmp    %rsi,%rdi
+  80149d:	74 49                	je     8014e8 <strcasecmp+0x5f>
+  80149f:	49 89 fd             	mov    %rdi,%r13
+  8014a2:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  8014a5:	49 bf 7a 14 80 00 00 	movabs $0x80147a,%r15
+  8014ac:	00 00 00 
+  8014af:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  8014b4:	41 0f b6 fe          	movzbl %r14b,%edi
+  8014b8:	41 ff d7             	call   *%r15
+  8014bb:	89 c3                	mov    %eax,%ebx
+  8014bd:	49 83 c4 01          	add    $0x1,%r12
+  8014c1:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8014c7:	41 ff d7             	call   *%r15
+  8014ca:	29 c3                	sub    %eax,%ebx
+  8014cc:	75 09                	jne    8014d7 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  8014ce:	49 83 c5 01          	add    $0x1,%r13
+  8014d2:	45 84 f6             	test   %r14b,%r14b
+  8014d5:	75 d8                	jne    8014af <strcasecmp+0x26>
+}
+  8014d7:	89 d8                	mov    %ebx,%eax
+  8014d9:	48 83 c4 08          	add    $0x8,%rsp
+  8014dd:	5b                   	pop    %rbx
+  8014de:	41 5c                	pop    %r12
+  8014e0:	41 5d                	pop    %r13
+  8014e2:	41 5e                	pop    %r14
+  8014e4:	41 5f                	pop    %r15
+  8014e6:	5d                   	pop    %rbp
+  8014e7:	c3                   	ret
+        return 0;
+  8014e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ed:	eb e8                	jmp    8014d7 <strcasecmp+0x4e>
+
+00000000008014ef <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8014ef:	55                   	push   %rbp
+  8014f0:	48 89 e5             	mov    %rsp,%rbp
+  8014f3:	41 57                	push   %r15
+  8014f5:	41 56                	push   %r14
+  8014f7:	41 55                	push   %r13
+  8014f9:	41 54                	push   %r12
+  8014fb:	53                   	push   %rbx
+  8014fc:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801500:	48 85 d2             	test   %rdx,%rdx
+  801503:	74 4f                	je     801554 <strncasecmp+0x65>
+  801505:	49 89 fc             	mov    %rdi,%r12
+  801508:	49 89 f5             	mov    %rsi,%r13
+  80150b:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  80150f:	49 be 7a 14 80 00 00 	movabs $0x80147a,%r14
+  801516:	00 00 00 
+  801519:	49 83 c4 01          	add    $0x1,%r12
+  80151d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801523:	41 ff d6             	call   *%r14
+  801526:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801528:	49 83 c5 01          	add    $0x1,%r13
+  80152c:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801531:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801534:	29 c3                	sub    %eax,%ebx
+  801536:	85 c0                	test   %eax,%eax
+  801538:	74 09                	je     801543 <strncasecmp+0x54>
+  80153a:	85 db                	test   %ebx,%ebx
+  80153c:	75 05                	jne    801543 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  80153e:	4d 39 fc             	cmp    %r15,%r12
+  801541:	75 d6                	jne    801519 <strncasecmp+0x2a>
+}
+  801543:	89 d8                	mov    %ebx,%eax
+  801545:	48 83 c4 08          	add    $0x8,%rsp
+  801549:	5b                   	pop    %rbx
+  80154a:	41 5c                	pop    %r12
+  80154c:	41 5d                	pop    %r13
+  80154e:	41 5e                	pop    %r14
+  801550:	41 5f                	pop    %r15
+  801552:	5d                   	pop    %rbp
+  801553:	c3                   	ret
+    int d = 0;
+  801554:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801559:	eb e8                	jmp    801543 <strncasecmp+0x54>
+
+000000000080155b <toupper>:
+
+int toupper(int c) {
+  80155b:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  80155d:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801560:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801563:	83 f9 1a             	cmp    $0x1a,%ecx
+  801566:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801569:	c3                   	ret
+
+000000000080156a <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80156a:	83 ff 20             	cmp    $0x20,%edi
+  80156d:	0f 94 c0             	sete   %al
+  801570:	0f b6 c0             	movzbl %al,%eax
+}
+  801573:	c3                   	ret
+
+0000000000801574 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801574:	89 f8                	mov    %edi,%eax
+  801576:	f7 d8                	neg    %eax
+  801578:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80157b:	c3                   	ret
+
+000000000080157c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80157c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80157f:	48 89 f8             	mov    %rdi,%rax
+  801582:	48 f7 d8             	neg    %rax
+  801585:	83 e0 07             	and    $0x7,%eax
+  801588:	49 89 d1             	mov    %rdx,%r9
+  80158b:	49 29 c1             	sub    %rax,%r9
+  80158e:	78 36                	js     8015c6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801590:	40 0f b6 c6          	movzbl %sil,%eax
+  801594:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80159b:	01 01 01 
+  80159e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8015a2:	40 f6 c7 07          	test   $0x7,%dil
+  8015a6:	75 38                	jne    8015e0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8015a8:	4c 89 c9             	mov    %r9,%rcx
+  8015ab:	48 c1 f9 03          	sar    $0x3,%rcx
+  8015af:	74 0c                	je     8015bd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8015b1:	fc                   	cld
+  8015b2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8015b5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8015b9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8015bd:	4d 85 c9             	test   %r9,%r9
+  8015c0:	75 45                	jne    801607 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8015c2:	4c 89 c0             	mov    %r8,%rax
+  8015c5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8015c6:	48 85 d2             	test   %rdx,%rdx
+  8015c9:	74 f7                	je     8015c2 <memset+0x46>
+  8015cb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8015ce:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8015d1:	48 83 c0 01          	add    $0x1,%rax
+  8015d5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8015d9:	48 39 c2             	cmp    %rax,%rdx
+  8015dc:	75 f3                	jne    8015d1 <memset+0x55>
+  8015de:	eb e2                	jmp    8015c2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8015e0:	40 f6 c7 01          	test   $0x1,%dil
+  8015e4:	74 06                	je     8015ec <memset+0x70>
+  8015e6:	88 07                	mov    %al,(%rdi)
+  8015e8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8015ec:	40 f6 c7 02          	test   $0x2,%dil
+  8015f0:	74 07                	je     8015f9 <memset+0x7d>
+  8015f2:	66 89 07             	mov    %ax,(%rdi)
+  8015f5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8015f9:	40 f6 c7 04          	test   $0x4,%dil
+  8015fd:	74 a9                	je     8015a8 <memset+0x2c>
+  8015ff:	89 07                	mov    %eax,(%rdi)
+  801601:	48 83 c7 04          	add    $0x4,%rdi
+  801605:	eb a1                	jmp    8015a8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801607:	41 f6 c1 04          	test   $0x4,%r9b
+  80160b:	74 06                	je     801613 <memset+0x97>
+  80160d:	89 07                	mov    %eax,(%rdi)
+  80160f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801613:	41 f6 c1 02          	test   $0x2,%r9b
+  801617:	74 07                	je     801620 <memset+0xa4>
+  801619:	66 89 07             	mov    %ax,(%rdi)
+  80161c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801620:	41 f6 c1 01          	test   $0x1,%r9b
+  801624:	74 9c                	je     8015c2 <memset+0x46>
+  801626:	88 07                	mov    %al,(%rdi)
+  801628:	eb 98                	jmp    8015c2 <memset+0x46>
+
+000000000080162a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80162a:	48 89 f8             	mov    %rdi,%rax
+  80162d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801630:	48 39 fe             	cmp    %rdi,%rsi
+  801633:	73 3b                	jae    801670 <memmove+0x46>
+  801635:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801639:	48 39 d7             	cmp    %rdx,%rdi
+  80163c:	73 32                	jae    801670 <memmove+0x46>
+        s += n;
+        d += n;
+  80163e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801642:	48 89 d6             	mov    %rdx,%rsi
+  801645:	48 09 fe             	or     %rdi,%rsi
+  801648:	48 09 ce             	or     %rcx,%rsi
+  80164b:	40 f6 c6 07          	test   $0x7,%sil
+  80164f:	75 12                	jne    801663 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801651:	48 83 ef 08          	sub    $0x8,%rdi
+  801655:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801659:	48 c1 e9 03          	shr    $0x3,%rcx
+  80165d:	fd                   	std
+  80165e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801661:	fc                   	cld
+  801662:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801663:	48 83 ef 01          	sub    $0x1,%rdi
+  801667:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80166b:	fd                   	std
+  80166c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80166e:	eb f1                	jmp    801661 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801670:	48 89 f2             	mov    %rsi,%rdx
+  801673:	48 09 c2             	or     %rax,%rdx
+  801676:	48 09 ca             	or     %rcx,%rdx
+  801679:	f6 c2 07             	test   $0x7,%dl
+  80167c:	75 0c                	jne    80168a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80167e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801682:	48 89 c7             	mov    %rax,%rdi
+  801685:	fc                   	cld
+  801686:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801689:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80168a:	48 89 c7             	mov    %rax,%rdi
+  80168d:	fc                   	cld
+  80168e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801690:	c3                   	ret
+
+0000000000801691 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801691:	55                   	push   %rbp
+  801692:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801695:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  80169c:	00 00 00 
+  80169f:	ff d0                	call   *%rax
+}
+  8016a1:	5d                   	pop    %rbp
+  8016a2:	c3                   	ret
+
+00000000008016a3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	41 57                	push   %r15
+  8016a9:	41 56                	push   %r14
+  8016ab:	41 55                	push   %r13
+  8016ad:	41 54                	push   %r12
+  8016af:	53                   	push   %rbx
+  8016b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b4:	49 89 fe             	mov    %rdi,%r14
+  8016b7:	49 89 f7             	mov    %rsi,%r15
+  8016ba:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8016bd:	48 89 f7             	mov    %rsi,%rdi
+  8016c0:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  8016c7:	00 00 00 
+  8016ca:	ff d0                	call   *%rax
+  8016cc:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8016cf:	48 89 de             	mov    %rbx,%rsi
+  8016d2:	4c 89 f7             	mov    %r14,%rdi
+  8016d5:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  8016dc:	00 00 00 
+  8016df:	ff d0                	call   *%rax
+  8016e1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8016e4:	48 39 c3             	cmp    %rax,%rbx
+  8016e7:	74 36                	je     80171f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8016e9:	48 89 d8             	mov    %rbx,%rax
+  8016ec:	4c 29 e8             	sub    %r13,%rax
+  8016ef:	49 39 c4             	cmp    %rax,%r12
+  8016f2:	73 31                	jae    801725 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8016f4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8016f9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8016fd:	4c 89 fe             	mov    %r15,%rsi
+  801700:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80170c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801710:	48 83 c4 08          	add    $0x8,%rsp
+  801714:	5b                   	pop    %rbx
+  801715:	41 5c                	pop    %r12
+  801717:	41 5d                	pop    %r13
+  801719:	41 5e                	pop    %r14
+  80171b:	41 5f                	pop    %r15
+  80171d:	5d                   	pop    %rbp
+  80171e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80171f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801723:	eb eb                	jmp    801710 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801725:	48 83 eb 01          	sub    $0x1,%rbx
+  801729:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80172d:	48 89 da             	mov    %rbx,%rdx
+  801730:	4c 89 fe             	mov    %r15,%rsi
+  801733:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  80173a:	00 00 00 
+  80173d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80173f:	49 01 de             	add    %rbx,%r14
+  801742:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801747:	eb c3                	jmp    80170c <strlcat+0x69>
+
+0000000000801749 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801749:	48 85 d2             	test   %rdx,%rdx
+  80174c:	74 2d                	je     80177b <memcmp+0x32>
+  80174e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801753:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801757:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80175c:	44 38 c1             	cmp    %r8b,%cl
+  80175f:	75 0f                	jne    801770 <memcmp+0x27>
+    while (n-- > 0) {
+  801761:	48 83 c0 01          	add    $0x1,%rax
+  801765:	48 39 c2             	cmp    %rax,%rdx
+  801768:	75 e9                	jne    801753 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80176a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801770:	0f b6 c1             	movzbl %cl,%eax
+  801773:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801777:	44 29 c0             	sub    %r8d,%eax
+  80177a:	c3                   	ret
+    return 0;
+  80177b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801780:	c3                   	ret
+
+0000000000801781 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801781:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801785:	48 39 c7             	cmp    %rax,%rdi
+  801788:	73 0f                	jae    801799 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80178a:	40 38 37             	cmp    %sil,(%rdi)
+  80178d:	74 0e                	je     80179d <memfind+0x1c>
+    for (; src < end; src++) {
+  80178f:	48 83 c7 01          	add    $0x1,%rdi
+  801793:	48 39 f8             	cmp    %rdi,%rax
+  801796:	75 f2                	jne    80178a <memfind+0x9>
+  801798:	c3                   	ret
+  801799:	48 89 f8             	mov    %rdi,%rax
+  80179c:	c3                   	ret
+  80179d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8017a0:	c3                   	ret
+
+00000000008017a1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8017a1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8017a4:	0f b6 37             	movzbl (%rdi),%esi
+  8017a7:	40 80 fe 20          	cmp    $0x20,%sil
+  8017ab:	74 06                	je     8017b3 <strtol+0x12>
+  8017ad:	40 80 fe 09          	cmp    $0x9,%sil
+  8017b1:	75 13                	jne    8017c6 <strtol+0x25>
+  8017b3:	48 83 c7 01          	add    $0x1,%rdi
+  8017b7:	0f b6 37             	movzbl (%rdi),%esi
+  8017ba:	40 80 fe 20          	cmp    $0x20,%sil
+  8017be:	74 f3                	je     8017b3 <strtol+0x12>
+  8017c0:	40 80 fe 09          	cmp    $0x9,%sil
+  8017c4:	74 ed                	je     8017b3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8017c6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8017c9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8017cc:	3c 01                	cmp    $0x1,%al
+  8017ce:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8017d2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8017d8:	75 0f                	jne    8017e9 <strtol+0x48>
+  8017da:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8017dd:	74 14                	je     8017f3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8017df:	85 d2                	test   %edx,%edx
+  8017e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017e6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8017e9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8017ee:	4c 63 ca             	movslq %edx,%r9
+  8017f1:	eb 36                	jmp    801829 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8017f3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8017f7:	74 0f                	je     801808 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8017f9:	85 d2                	test   %edx,%edx
+  8017fb:	75 ec                	jne    8017e9 <strtol+0x48>
+        s++;
+  8017fd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801801:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801806:	eb e1                	jmp    8017e9 <strtol+0x48>
+        s += 2;
+  801808:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80180c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801811:	eb d6                	jmp    8017e9 <strtol+0x48>
+            dig -= '0';
+  801813:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801816:	44 0f b6 c1          	movzbl %cl,%r8d
+  80181a:	41 39 d0             	cmp    %edx,%r8d
+  80181d:	7d 21                	jge    801840 <strtol+0x9f>
+        val = val * base + dig;
+  80181f:	49 0f af c1          	imul   %r9,%rax
+  801823:	0f b6 c9             	movzbl %cl,%ecx
+  801826:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801829:	48 83 c7 01          	add    $0x1,%rdi
+  80182d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801831:	80 f9 39             	cmp    $0x39,%cl
+  801834:	76 dd                	jbe    801813 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801836:	80 f9 7b             	cmp    $0x7b,%cl
+  801839:	77 05                	ja     801840 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80183b:	83 e9 57             	sub    $0x57,%ecx
+  80183e:	eb d6                	jmp    801816 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801840:	4d 85 d2             	test   %r10,%r10
+  801843:	74 03                	je     801848 <strtol+0xa7>
+  801845:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801848:	48 89 c2             	mov    %rax,%rdx
+  80184b:	48 f7 da             	neg    %rdx
+  80184e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801852:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801856:	c3                   	ret
+
+0000000000801857 <atoi>:
+int atoi(const char *str) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80185b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801860:	be 00 00 00 00       	mov    $0x0,%esi
+  801865:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  80186c:	00 00 00 
+  80186f:	ff d0                	call   *%rax
+}
+  801871:	5d                   	pop    %rbp
+  801872:	c3                   	ret
+
+0000000000801873 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801873:	55                   	push   %rbp
+  801874:	48 89 e5             	mov    %rsp,%rbp
+  801877:	53                   	push   %rbx
+  801878:	48 89 fa             	mov    %rdi,%rdx
+  80187b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80187e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801883:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801888:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188d:	be 00 00 00 00       	mov    $0x0,%esi
+  801892:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801898:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80189a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189e:	c9                   	leave
+  80189f:	c3                   	ret
+
+00000000008018a0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+  8018a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a5:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018be:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018cf:	c9                   	leave
+  8018d0:	c3                   	ret
+
+00000000008018d1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8018d1:	55                   	push   %rbp
+  8018d2:	48 89 e5             	mov    %rsp,%rbp
+  8018d5:	53                   	push   %rbx
+  8018d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8018da:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018dd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018fe:	48 85 c0             	test   %rax,%rax
+  801901:	7f 06                	jg     801909 <sys_env_destroy+0x38>
+}
+  801903:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801909:	49 89 c0             	mov    %rax,%r8
+  80190c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801911:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801918:	00 00 00 
+  80191b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801920:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801927:	00 00 00 
+  80192a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192f:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801936:	00 00 00 
+  801939:	41 ff d1             	call   *%r9
+
+000000000080193c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80193c:	55                   	push   %rbp
+  80193d:	48 89 e5             	mov    %rsp,%rbp
+  801940:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801941:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801946:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801955:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195a:	be 00 00 00 00       	mov    $0x0,%esi
+  80195f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801965:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801967:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80196b:	c9                   	leave
+  80196c:	c3                   	ret
+
+000000000080196d <sys_yield>:
+
+void
+sys_yield(void) {
+  80196d:	55                   	push   %rbp
+  80196e:	48 89 e5             	mov    %rsp,%rbp
+  801971:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801972:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801981:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801986:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80198b:	be 00 00 00 00       	mov    $0x0,%esi
+  801990:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801996:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801998:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199c:	c9                   	leave
+  80199d:	c3                   	ret
+
+000000000080199e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	53                   	push   %rbx
+  8019a3:	48 89 fa             	mov    %rdi,%rdx
+  8019a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019ae:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8019b5:	00 00 00 
+  8019b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019c8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8019ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+00000000008019d0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	53                   	push   %rbx
+  8019d5:	49 89 f8             	mov    %rdi,%r8
+  8019d8:	48 89 d3             	mov    %rdx,%rbx
+  8019db:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019de:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e3:	4c 89 c2             	mov    %r8,%rdx
+  8019e6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8019f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019fa:	c9                   	leave
+  8019fb:	c3                   	ret
+
+00000000008019fc <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8019fc:	55                   	push   %rbp
+  8019fd:	48 89 e5             	mov    %rsp,%rbp
+  801a00:	53                   	push   %rbx
+  801a01:	48 83 ec 08          	sub    $0x8,%rsp
+  801a05:	89 f8                	mov    %edi,%eax
+  801a07:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801a0a:	48 63 f9             	movslq %ecx,%rdi
+  801a0d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a10:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a15:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a25:	48 85 c0             	test   %rax,%rax
+  801a28:	7f 06                	jg     801a30 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801a2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2e:	c9                   	leave
+  801a2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a30:	49 89 c0             	mov    %rax,%r8
+  801a33:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801a38:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801a3f:	00 00 00 
+  801a42:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a47:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801a4e:	00 00 00 
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a56:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801a5d:	00 00 00 
+  801a60:	41 ff d1             	call   *%r9
+
+0000000000801a63 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	53                   	push   %rbx
+  801a68:	48 83 ec 08          	sub    $0x8,%rsp
+  801a6c:	89 f8                	mov    %edi,%eax
+  801a6e:	49 89 f2             	mov    %rsi,%r10
+  801a71:	48 89 cf             	mov    %rcx,%rdi
+  801a74:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801a77:	48 63 da             	movslq %edx,%rbx
+  801a7a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a82:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a85:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801a88:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a8a:	48 85 c0             	test   %rax,%rax
+  801a8d:	7f 06                	jg     801a95 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801a8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a93:	c9                   	leave
+  801a94:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a95:	49 89 c0             	mov    %rax,%r8
+  801a98:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801a9d:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801aa4:	00 00 00 
+  801aa7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801aac:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801ab3:	00 00 00 
+  801ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abb:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801ac2:	00 00 00 
+  801ac5:	41 ff d1             	call   *%r9
+
+0000000000801ac8 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801ac8:	55                   	push   %rbp
+  801ac9:	48 89 e5             	mov    %rsp,%rbp
+  801acc:	53                   	push   %rbx
+  801acd:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad1:	49 89 f9             	mov    %rdi,%r9
+  801ad4:	89 f0                	mov    %esi,%eax
+  801ad6:	48 89 d3             	mov    %rdx,%rbx
+  801ad9:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801adc:	49 63 f0             	movslq %r8d,%rsi
+  801adf:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ae7:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801af2:	48 85 c0             	test   %rax,%rax
+  801af5:	7f 06                	jg     801afd <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801af7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801afb:	c9                   	leave
+  801afc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801afd:	49 89 c0             	mov    %rax,%r8
+  801b00:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801b05:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801b0c:	00 00 00 
+  801b0f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b14:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801b1b:	00 00 00 
+  801b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b23:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801b2a:	00 00 00 
+  801b2d:	41 ff d1             	call   *%r9
+
+0000000000801b30 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801b30:	55                   	push   %rbp
+  801b31:	48 89 e5             	mov    %rsp,%rbp
+  801b34:	53                   	push   %rbx
+  801b35:	89 f8                	mov    %edi,%eax
+  801b37:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801b3a:	48 63 f9             	movslq %ecx,%rdi
+  801b3d:	48 63 da             	movslq %edx,%rbx
+  801b40:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b43:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b48:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b4b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b56:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801b58:	89 c2                	mov    %eax,%edx
+  801b5a:	48 85 c0             	test   %rax,%rax
+  801b5d:	78 0d                	js     801b6c <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801b64:	4d 85 c9             	test   %r9,%r9
+  801b67:	74 03                	je     801b6c <sys_alloc_dma_region+0x3c>
+  801b69:	49 89 01             	mov    %rax,(%r9)
+}
+  801b6c:	89 d0                	mov    %edx,%eax
+  801b6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b72:	c9                   	leave
+  801b73:	c3                   	ret
+
+0000000000801b74 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801b74:	55                   	push   %rbp
+  801b75:	48 89 e5             	mov    %rsp,%rbp
+  801b78:	53                   	push   %rbx
+  801b79:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7d:	48 89 f1             	mov    %rsi,%rcx
+  801b80:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801b83:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b86:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b90:	be 00 00 00 00       	mov    $0x0,%esi
+  801b95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b9b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b9d:	48 85 c0             	test   %rax,%rax
+  801ba0:	7f 06                	jg     801ba8 <sys_set_cache_region+0x34>
+}
+  801ba2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ba6:	c9                   	leave
+  801ba7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ba8:	49 89 c0             	mov    %rax,%r8
+  801bab:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801bb0:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801bb7:	00 00 00 
+  801bba:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801bbf:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801bc6:	00 00 00 
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801bd5:	00 00 00 
+  801bd8:	41 ff d1             	call   *%r9
+
+0000000000801bdb <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	53                   	push   %rbx
+  801be0:	48 83 ec 08          	sub    $0x8,%rsp
+  801be4:	48 89 f1             	mov    %rsi,%rcx
+  801be7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801bea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bed:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bf7:	be 00 00 00 00       	mov    $0x0,%esi
+  801bfc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c02:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c04:	48 85 c0             	test   %rax,%rax
+  801c07:	7f 06                	jg     801c0f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801c09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c0d:	c9                   	leave
+  801c0e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c0f:	49 89 c0             	mov    %rax,%r8
+  801c12:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801c17:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801c1e:	00 00 00 
+  801c21:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801c26:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801c2d:	00 00 00 
+  801c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c35:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801c3c:	00 00 00 
+  801c3f:	41 ff d1             	call   *%r9
+
+0000000000801c42 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801c42:	55                   	push   %rbp
+  801c43:	48 89 e5             	mov    %rsp,%rbp
+  801c46:	53                   	push   %rbx
+  801c47:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801c4b:	48 63 ce             	movslq %esi,%rcx
+  801c4e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c51:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c60:	be 00 00 00 00       	mov    $0x0,%esi
+  801c65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c6b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c6d:	48 85 c0             	test   %rax,%rax
+  801c70:	7f 06                	jg     801c78 <sys_env_set_status+0x36>
+}
+  801c72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c78:	49 89 c0             	mov    %rax,%r8
+  801c7b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801c80:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801c87:	00 00 00 
+  801c8a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801c8f:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801c96:	00 00 00 
+  801c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9e:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801ca5:	00 00 00 
+  801ca8:	41 ff d1             	call   *%r9
+
+0000000000801cab <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801cab:	55                   	push   %rbp
+  801cac:	48 89 e5             	mov    %rsp,%rbp
+  801caf:	53                   	push   %rbx
+  801cb0:	48 83 ec 08          	sub    $0x8,%rsp
+  801cb4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801cb7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801cba:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cd4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cd6:	48 85 c0             	test   %rax,%rax
+  801cd9:	7f 06                	jg     801ce1 <sys_env_set_trapframe+0x36>
+}
+  801cdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cdf:	c9                   	leave
+  801ce0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ce1:	49 89 c0             	mov    %rax,%r8
+  801ce4:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801ce9:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801cf0:	00 00 00 
+  801cf3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801cf8:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801cff:	00 00 00 
+  801d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d07:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801d0e:	00 00 00 
+  801d11:	41 ff d1             	call   *%r9
+
+0000000000801d14 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	53                   	push   %rbx
+  801d19:	48 83 ec 08          	sub    $0x8,%rsp
+  801d1d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801d20:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d23:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d32:	be 00 00 00 00       	mov    $0x0,%esi
+  801d37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d3d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d3f:	48 85 c0             	test   %rax,%rax
+  801d42:	7f 06                	jg     801d4a <sys_env_set_pgfault_upcall+0x36>
+}
+  801d44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d48:	c9                   	leave
+  801d49:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d4a:	49 89 c0             	mov    %rax,%r8
+  801d4d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801d52:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801d59:	00 00 00 
+  801d5c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801d61:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801d68:	00 00 00 
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801d77:	00 00 00 
+  801d7a:	41 ff d1             	call   *%r9
+
+0000000000801d7d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801d7d:	55                   	push   %rbp
+  801d7e:	48 89 e5             	mov    %rsp,%rbp
+  801d81:	53                   	push   %rbx
+  801d82:	89 f8                	mov    %edi,%eax
+  801d84:	49 89 f1             	mov    %rsi,%r9
+  801d87:	48 89 d3             	mov    %rdx,%rbx
+  801d8a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801d8d:	49 63 f0             	movslq %r8d,%rsi
+  801d90:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d93:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d98:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801da1:	cd 30                	int    $0x30
+}
+  801da3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801da7:	c9                   	leave
+  801da8:	c3                   	ret
+
+0000000000801da9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	53                   	push   %rbx
+  801dae:	48 83 ec 08          	sub    $0x8,%rsp
+  801db2:	48 89 fa             	mov    %rdi,%rdx
+  801db5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801db8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dc7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dd2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dd4:	48 85 c0             	test   %rax,%rax
+  801dd7:	7f 06                	jg     801ddf <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801dd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ddf:	49 89 c0             	mov    %rax,%r8
+  801de2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801de7:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801dee:	00 00 00 
+  801df1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801df6:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  801dfd:	00 00 00 
+  801e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e05:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801e0c:	00 00 00 
+  801e0f:	41 ff d1             	call   *%r9
+
+0000000000801e12 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	53                   	push   %rbx
+  801e17:	48 89 fa             	mov    %rdi,%rdx
+  801e1a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e1d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e37:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801e39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e3d:	c9                   	leave
+  801e3e:	c3                   	ret
+
+0000000000801e3f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801e3f:	55                   	push   %rbp
+  801e40:	48 89 e5             	mov    %rsp,%rbp
+  801e43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e44:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e68:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+0000000000801e70 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801e70:	48 85 ff             	test   %rdi,%rdi
+  801e73:	0f 84 b6 01 00 00    	je     80202f <malloc+0x1bf>
+malloc(size_t size) {
+  801e79:	55                   	push   %rbp
+  801e7a:	48 89 e5             	mov    %rsp,%rbp
+  801e7d:	41 56                	push   %r14
+  801e7f:	41 55                	push   %r13
+  801e81:	41 54                	push   %r12
+  801e83:	53                   	push   %rbx
+  801e84:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801e87:	48 b8 28 80 80 00 00 	movabs $0x808028,%rax
+  801e8e:	00 00 00 
+  801e91:	4c 8b 20             	mov    (%rax),%r12
+  801e94:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801e9b:	0f 87 94 01 00 00    	ja     802035 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801ea1:	48 a1 20 80 80 00 00 	movabs 0x808020,%rax
+  801ea8:	00 00 00 
+  801eab:	48 85 c0             	test   %rax,%rax
+  801eae:	74 6b                	je     801f1b <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801eb0:	4d 85 e4             	test   %r12,%r12
+  801eb3:	74 66                	je     801f1b <malloc+0xab>
+  801eb5:	48 ba 48 80 80 00 00 	movabs $0x808048,%rdx
+  801ebc:	00 00 00 
+  801ebf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ec4:	eb 0d                	jmp    801ed3 <malloc+0x63>
+  801ec6:	48 83 c1 01          	add    $0x1,%rcx
+  801eca:	48 83 c2 18          	add    $0x18,%rdx
+  801ece:	49 39 cc             	cmp    %rcx,%r12
+  801ed1:	74 48                	je     801f1b <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801ed3:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801ed8:	74 ec                	je     801ec6 <malloc+0x56>
+  801eda:	48 39 1a             	cmp    %rbx,(%rdx)
+  801edd:	72 e7                	jb     801ec6 <malloc+0x56>
+                real_freep_size--;
+  801edf:	48 83 e8 01          	sub    $0x1,%rax
+  801ee3:	48 a3 20 80 80 00 00 	movabs %rax,0x808020
+  801eea:	00 00 00 
+                freep[i].is_free = false;
+  801eed:	48 ba 40 80 80 00 00 	movabs $0x808040,%rdx
+  801ef4:	00 00 00 
+  801ef7:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801efb:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801eff:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801f03:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801f0a:	00 
+                freep[i].size = size;
+  801f0b:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801f0f:	48 01 c8             	add    %rcx,%rax
+  801f12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801f16:	e9 0b 01 00 00       	jmp    802026 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801f1b:	48 a1 40 70 80 00 00 	movabs 0x807040,%rax
+  801f22:	00 00 00 
+  801f25:	48 01 d8             	add    %rbx,%rax
+  801f28:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801f2e:	76 7c                	jbe    801fac <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801f30:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  801f37:	00 00 00 
+  801f3a:	4c 8b 30             	mov    (%rax),%r14
+  801f3d:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801f44:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801f47:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801f4e:	00 00 00 
+  801f51:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801f58:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801f5f:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801f65:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801f69:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801f70:	00 00 00 
+  801f73:	ff d0                	call   *%rax
+  801f75:	89 c7                	mov    %eax,%edi
+  801f77:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801f7e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801f85:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801f8c:	00 00 00 
+  801f8f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801f93:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801f98:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  801f9f:	00 00 00 
+  801fa2:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801fa4:	85 c0                	test   %eax,%eax
+  801fa6:	0f 88 90 00 00 00    	js     80203c <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801fac:	48 b9 48 70 80 00 00 	movabs $0x807048,%rcx
+  801fb3:	00 00 00 
+  801fb6:	48 8b 31             	mov    (%rcx),%rsi
+  801fb9:	48 bf 40 70 80 00 00 	movabs $0x807040,%rdi
+  801fc0:	00 00 00 
+  801fc3:	4c 8b 07             	mov    (%rdi),%r8
+  801fc6:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801fca:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801fd1:	00 00 00 
+  801fd4:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801fd8:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801fdc:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  801fe3:	00 00 00 
+  801fe6:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801fea:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801fed:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801ff1:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801ff8:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801ff9:	48 89 d8             	mov    %rbx,%rax
+  801ffc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802001:	4c 01 c0             	add    %r8,%rax
+  802004:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  802007:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80200e:	48 01 f3             	add    %rsi,%rbx
+  802011:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  802014:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  802019:	48 a3 28 80 80 00 00 	movabs %rax,0x808028
+  802020:	00 00 00 
+  802023:	48 89 d0             	mov    %rdx,%rax
+}
+  802026:	5b                   	pop    %rbx
+  802027:	41 5c                	pop    %r12
+  802029:	41 5d                	pop    %r13
+  80202b:	41 5e                	pop    %r14
+  80202d:	5d                   	pop    %rbp
+  80202e:	c3                   	ret
+        return NULL;
+  80202f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802034:	c3                   	ret
+        return NULL;
+  802035:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203a:	eb ea                	jmp    802026 <malloc+0x1b6>
+            return NULL;
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802041:	eb e3                	jmp    802026 <malloc+0x1b6>
+
+0000000000802043 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  802047:	53                   	push   %rbx
+  802048:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  80204c:	48 89 fb             	mov    %rdi,%rbx
+  80204f:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  802053:	48 89 df             	mov    %rbx,%rdi
+  802056:	48 b8 70 1e 80 00 00 	movabs $0x801e70,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+  802062:	48 89 c7             	mov    %rax,%rdi
+  802065:	48 89 da             	mov    %rbx,%rdx
+  802068:	be 00 00 00 00       	mov    $0x0,%esi
+  80206d:	48 b8 7c 15 80 00 00 	movabs $0x80157c,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+}
+  802079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+
+000000000080207f <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80207f:	48 a1 28 80 80 00 00 	movabs 0x808028,%rax
+  802086:	00 00 00 
+  802089:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802090:	00 00 00 
+  802093:	48 3b 02             	cmp    (%rdx),%rax
+  802096:	74 4d                	je     8020e5 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  802098:	48 85 c0             	test   %rax,%rax
+  80209b:	74 4d                	je     8020ea <get_allocsize+0x6b>
+  80209d:	48 b9 40 80 80 00 00 	movabs $0x808040,%rcx
+  8020a4:	00 00 00 
+  8020a7:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  8020ac:	48 3b 39             	cmp    (%rcx),%rdi
+  8020af:	74 13                	je     8020c4 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  8020b1:	48 83 c2 01          	add    $0x1,%rdx
+  8020b5:	48 83 c1 18          	add    $0x18,%rcx
+  8020b9:	48 39 d0             	cmp    %rdx,%rax
+  8020bc:	75 ee                	jne    8020ac <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  8020c4:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8020c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cd:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  8020d4:	00 00 00 
+  8020d7:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8020dd:	75 0b                	jne    8020ea <get_allocsize+0x6b>
+  8020df:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8020e4:	c3                   	ret
+        return 0;
+  8020e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ea:	c3                   	ret
+
+00000000008020eb <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8020eb:	48 85 ff             	test   %rdi,%rdi
+  8020ee:	0f 84 01 01 00 00    	je     8021f5 <free+0x10a>
+free(void *ptr) {
+  8020f4:	55                   	push   %rbp
+  8020f5:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8020f8:	48 b8 28 80 80 00 00 	movabs $0x808028,%rax
+  8020ff:	00 00 00 
+  802102:	48 8b 30             	mov    (%rax),%rsi
+  802105:	48 a1 20 80 80 00 00 	movabs 0x808020,%rax
+  80210c:	00 00 00 
+  80210f:	48 39 c6             	cmp    %rax,%rsi
+  802112:	74 50                	je     802164 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  802114:	48 85 f6             	test   %rsi,%rsi
+  802117:	74 21                	je     80213a <free+0x4f>
+  802119:	48 b9 40 80 80 00 00 	movabs $0x808040,%rcx
+  802120:	00 00 00 
+  802123:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  802128:	48 3b 39             	cmp    (%rcx),%rdi
+  80212b:	74 61                	je     80218e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  80212d:	48 83 c2 01          	add    $0x1,%rdx
+  802131:	48 83 c1 18          	add    $0x18,%rcx
+  802135:	48 39 d6             	cmp    %rdx,%rsi
+  802138:	75 ee                	jne    802128 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  80213a:	48 ba 10 67 80 00 00 	movabs $0x806710,%rdx
+  802141:	00 00 00 
+  802144:	be 12 01 00 00       	mov    $0x112,%esi
+  802149:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  802150:	00 00 00 
+  802153:	b8 00 00 00 00       	mov    $0x0,%eax
+  802158:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  80215f:	00 00 00 
+  802162:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  802164:	48 ba c0 66 80 00 00 	movabs $0x8066c0,%rdx
+  80216b:	00 00 00 
+  80216e:	be 06 01 00 00       	mov    $0x106,%esi
+  802173:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  80217a:	00 00 00 
+  80217d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802182:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  802189:	00 00 00 
+  80218c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  80218e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802192:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  802199:	00 00 00 
+  80219c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8021a2:	75 27                	jne    8021cb <free+0xe0>
+            freep[i].is_free = true;
+  8021a4:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8021a8:	48 ba 40 80 80 00 00 	movabs $0x808040,%rdx
+  8021af:	00 00 00 
+  8021b2:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  8021b9:	00 00 
+            real_freep_size++;
+  8021bb:	48 83 c0 01          	add    $0x1,%rax
+  8021bf:	48 a3 20 80 80 00 00 	movabs %rax,0x808020
+  8021c6:	00 00 00 
+}
+  8021c9:	5d                   	pop    %rbp
+  8021ca:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  8021cb:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  8021d2:	00 00 00 
+  8021d5:	be 0b 01 00 00       	mov    $0x10b,%esi
+  8021da:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  8021e1:	00 00 00 
+  8021e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e9:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  8021f0:	00 00 00 
+  8021f3:	ff d1                	call   *%rcx
+  8021f5:	c3                   	ret
+
+00000000008021f6 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  8021f6:	55                   	push   %rbp
+  8021f7:	48 89 e5             	mov    %rsp,%rbp
+  8021fa:	41 55                	push   %r13
+  8021fc:	41 54                	push   %r12
+  8021fe:	53                   	push   %rbx
+  8021ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802203:	48 89 fb             	mov    %rdi,%rbx
+  802206:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  802209:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  802215:	49 39 c5             	cmp    %rax,%r13
+  802218:	73 0e                	jae    802228 <realloc+0x32>
+}
+  80221a:	48 89 d8             	mov    %rbx,%rax
+  80221d:	48 83 c4 08          	add    $0x8,%rsp
+  802221:	5b                   	pop    %rbx
+  802222:	41 5c                	pop    %r12
+  802224:	41 5d                	pop    %r13
+  802226:	5d                   	pop    %rbp
+  802227:	c3                   	ret
+  802228:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  80222b:	4c 89 ef             	mov    %r13,%rdi
+  80222e:	48 b8 70 1e 80 00 00 	movabs $0x801e70,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+  80223a:	48 89 c7             	mov    %rax,%rdi
+  80223d:	4c 89 e2             	mov    %r12,%rdx
+  802240:	48 89 de             	mov    %rbx,%rsi
+  802243:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  802252:	48 89 df             	mov    %rbx,%rdi
+  802255:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+    return newptr;
+  802261:	4c 89 e3             	mov    %r12,%rbx
+  802264:	eb b4                	jmp    80221a <realloc+0x24>
+
+0000000000802266 <strdup>:
+
+char*
+strdup (const char *src) {
+  802266:	55                   	push   %rbp
+  802267:	48 89 e5             	mov    %rsp,%rbp
+  80226a:	41 54                	push   %r12
+  80226c:	53                   	push   %rbx
+  80226d:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802270:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  802277:	00 00 00 
+  80227a:	ff d0                	call   *%rax
+  80227c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802280:	4c 89 e7             	mov    %r12,%rdi
+  802283:	48 b8 70 1e 80 00 00 	movabs $0x801e70,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  80228f:	48 89 c7             	mov    %rax,%rdi
+  802292:	4c 89 e2             	mov    %r12,%rdx
+  802295:	48 89 de             	mov    %rbx,%rsi
+  802298:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  80229f:	00 00 00 
+  8022a2:	ff d0                	call   *%rax
+}
+  8022a4:	5b                   	pop    %rbx
+  8022a5:	41 5c                	pop    %r12
+  8022a7:	5d                   	pop    %rbp
+  8022a8:	c3                   	ret
+
+00000000008022a9 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  8022a9:	55                   	push   %rbp
+  8022aa:	48 89 e5             	mov    %rsp,%rbp
+  8022ad:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8022ae:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8022b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022d2:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  8022d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+
+00000000008022da <get_ticks>:
+
+uint64_t
+get_ticks() {
+  8022da:	55                   	push   %rbp
+  8022db:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  8022de:	48 b8 40 80 98 00 00 	movabs $0x988040,%rax
+  8022e5:	00 00 00 
+  8022e8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8022ec:	74 26                	je     802314 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8022ee:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8022f0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8022f4:	89 c0                	mov    %eax,%eax
+  8022f6:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8022f9:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  802300:	48 b9 40 80 98 00 00 	movabs $0x988040,%rcx
+  802307:	00 00 00 
+  80230a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230f:	48 f7 31             	divq   (%rcx)
+}
+  802312:	5d                   	pop    %rbp
+  802313:	c3                   	ret
+        freq = get_cpufreq();
+  802314:	b8 00 00 00 00       	mov    $0x0,%eax
+  802319:	48 ba a9 22 80 00 00 	movabs $0x8022a9,%rdx
+  802320:	00 00 00 
+  802323:	ff d2                	call   *%rdx
+  802325:	48 a3 40 80 98 00 00 	movabs %rax,0x988040
+  80232c:	00 00 00 
+  80232f:	eb bd                	jmp    8022ee <get_ticks+0x14>
+
+0000000000802331 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802331:	55                   	push   %rbp
+  802332:	48 89 e5             	mov    %rsp,%rbp
+  802335:	53                   	push   %rbx
+  802336:	48 83 ec 08          	sub    $0x8,%rsp
+  80233a:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  80233d:	48 b8 40 80 98 00 00 	movabs $0x988040,%rax
+  802344:	00 00 00 
+  802347:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80234b:	74 50                	je     80239d <sleep+0x6c>
+    asm volatile("rdtsc"
+  80234d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80234f:	48 c1 e2 20          	shl    $0x20,%rdx
+  802353:	89 c0                	mov    %eax,%eax
+  802355:	48 89 d6             	mov    %rdx,%rsi
+  802358:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  80235b:	48 b8 40 80 98 00 00 	movabs $0x988040,%rax
+  802362:	00 00 00 
+  802365:	48 0f af 18          	imul   (%rax),%rbx
+  802369:	48 c1 eb 03          	shr    $0x3,%rbx
+  80236d:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802374:	9b c4 20 
+  802377:	48 89 d8             	mov    %rbx,%rax
+  80237a:	48 f7 e2             	mul    %rdx
+  80237d:	48 89 d1             	mov    %rdx,%rcx
+  802380:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802384:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802386:	48 c1 e2 20          	shl    $0x20,%rdx
+  80238a:	89 c0                	mov    %eax,%eax
+  80238c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  80238f:	48 29 f2             	sub    %rsi,%rdx
+  802392:	48 39 ca             	cmp    %rcx,%rdx
+  802395:	72 ed                	jb     802384 <sleep+0x53>
+}
+  802397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80239b:	c9                   	leave
+  80239c:	c3                   	ret
+        freq = get_cpufreq();
+  80239d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a2:	48 ba a9 22 80 00 00 	movabs $0x8022a9,%rdx
+  8023a9:	00 00 00 
+  8023ac:	ff d2                	call   *%rdx
+  8023ae:	48 a3 40 80 98 00 00 	movabs %rax,0x988040
+  8023b5:	00 00 00 
+  8023b8:	eb 93                	jmp    80234d <sleep+0x1c>
+
+00000000008023ba <poll_kbd>:
+
+int poll_kbd() {
+  8023ba:	55                   	push   %rbp
+  8023bb:	48 89 e5             	mov    %rsp,%rbp
+  8023be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8023bf:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8023c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8023d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023e3:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  8023e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+
+00000000008023eb <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+  8023ef:	53                   	push   %rbx
+  8023f0:	49 89 fa             	mov    %rdi,%r10
+  8023f3:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  8023f5:	44 89 c6             	mov    %r8d,%esi
+  8023f8:	89 cf                	mov    %ecx,%edi
+  8023fa:	89 d3                	mov    %edx,%ebx
+  8023fc:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8023fe:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802403:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802406:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80240a:	cd 30                	int    $0x30
+  80240c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+
+0000000000802412 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802412:	55                   	push   %rbp
+  802413:	48 89 e5             	mov    %rsp,%rbp
+  802416:	41 54                	push   %r12
+  802418:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  802419:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802425:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80242a:	cd 30                	int    $0x30
+  80242c:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	78 76                	js     8024a9 <fork+0x97>
+        return envid;
+    if (!envid) {
+  802433:	74 7c                	je     8024b1 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  802435:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80243b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802442:	00 00 00 
+  802445:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80244a:	89 c2                	mov    %eax,%edx
+  80244c:	be 00 00 00 00       	mov    $0x0,%esi
+  802451:	bf 00 00 00 00       	mov    $0x0,%edi
+  802456:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+  802462:	85 c0                	test   %eax,%eax
+  802464:	75 7c                	jne    8024e2 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802466:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80246d:	00 00 00 
+  802470:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802477:	44 89 e7             	mov    %r12d,%edi
+  80247a:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+  802486:	85 c0                	test   %eax,%eax
+  802488:	75 60                	jne    8024ea <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  80248a:	be 02 00 00 00       	mov    $0x2,%esi
+  80248f:	44 89 e7             	mov    %r12d,%edi
+  802492:	48 b8 42 1c 80 00 00 	movabs $0x801c42,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+        return -1;
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024a5:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  8024a9:	44 89 e0             	mov    %r12d,%eax
+  8024ac:	5b                   	pop    %rbx
+  8024ad:	41 5c                	pop    %r12
+  8024af:	5d                   	pop    %rbp
+  8024b0:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8024b1:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  8024bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8024c2:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8024c9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8024d0:	00 00 00 
+  8024d3:	48 01 d0             	add    %rdx,%rax
+  8024d6:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8024dd:	00 00 00 
+        return 0;
+  8024e0:	eb c7                	jmp    8024a9 <fork+0x97>
+        return -1;
+  8024e2:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8024e8:	eb bf                	jmp    8024a9 <fork+0x97>
+  8024ea:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8024f0:	eb b7                	jmp    8024a9 <fork+0x97>
+
+00000000008024f2 <sfork>:
+
+envid_t
+sfork() {
+  8024f2:	55                   	push   %rbp
+  8024f3:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8024f6:	48 ba 46 67 80 00 00 	movabs $0x806746,%rdx
+  8024fd:	00 00 00 
+  802500:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802505:	48 bf 61 67 80 00 00 	movabs $0x806761,%rdi
+  80250c:	00 00 00 
+  80250f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802514:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  80251b:	00 00 00 
+  80251e:	ff d1                	call   *%rcx
+
+0000000000802520 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802520:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802527:	ff ff ff 
+  80252a:	48 01 f8             	add    %rdi,%rax
+  80252d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802531:	c3                   	ret
+
+0000000000802532 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802532:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802539:	ff ff ff 
+  80253c:	48 01 f8             	add    %rdi,%rax
+  80253f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802543:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802549:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80254d:	c3                   	ret
+
+000000000080254e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80254e:	55                   	push   %rbp
+  80254f:	48 89 e5             	mov    %rsp,%rbp
+  802552:	41 57                	push   %r15
+  802554:	41 56                	push   %r14
+  802556:	41 55                	push   %r13
+  802558:	41 54                	push   %r12
+  80255a:	53                   	push   %rbx
+  80255b:	48 83 ec 08          	sub    $0x8,%rsp
+  80255f:	49 89 ff             	mov    %rdi,%r15
+  802562:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802567:	49 bd 42 4d 80 00 00 	movabs $0x804d42,%r13
+  80256e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802571:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802577:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80257a:	48 89 df             	mov    %rbx,%rdi
+  80257d:	41 ff d5             	call   *%r13
+  802580:	83 e0 04             	and    $0x4,%eax
+  802583:	74 17                	je     80259c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802585:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80258c:	4c 39 f3             	cmp    %r14,%rbx
+  80258f:	75 e6                	jne    802577 <fd_alloc+0x29>
+  802591:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802597:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80259c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80259f:	48 83 c4 08          	add    $0x8,%rsp
+  8025a3:	5b                   	pop    %rbx
+  8025a4:	41 5c                	pop    %r12
+  8025a6:	41 5d                	pop    %r13
+  8025a8:	41 5e                	pop    %r14
+  8025aa:	41 5f                	pop    %r15
+  8025ac:	5d                   	pop    %rbp
+  8025ad:	c3                   	ret
+
+00000000008025ae <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8025ae:	83 ff 1f             	cmp    $0x1f,%edi
+  8025b1:	77 39                	ja     8025ec <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8025b3:	55                   	push   %rbp
+  8025b4:	48 89 e5             	mov    %rsp,%rbp
+  8025b7:	41 54                	push   %r12
+  8025b9:	53                   	push   %rbx
+  8025ba:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8025bd:	48 63 df             	movslq %edi,%rbx
+  8025c0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8025c7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8025cb:	48 89 df             	mov    %rbx,%rdi
+  8025ce:	48 b8 42 4d 80 00 00 	movabs $0x804d42,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	a8 04                	test   $0x4,%al
+  8025dc:	74 14                	je     8025f2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8025de:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8025e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e7:	5b                   	pop    %rbx
+  8025e8:	41 5c                	pop    %r12
+  8025ea:	5d                   	pop    %rbp
+  8025eb:	c3                   	ret
+        return -E_INVAL;
+  8025ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025f1:	c3                   	ret
+        return -E_INVAL;
+  8025f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f7:	eb ee                	jmp    8025e7 <fd_lookup+0x39>
+
+00000000008025f9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	41 54                	push   %r12
+  8025ff:	53                   	push   %rbx
+  802600:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802603:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  80260a:	00 00 00 
+  80260d:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  802614:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802617:	39 3b                	cmp    %edi,(%rbx)
+  802619:	74 47                	je     802662 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80261b:	48 83 c0 08          	add    $0x8,%rax
+  80261f:	48 8b 18             	mov    (%rax),%rbx
+  802622:	48 85 db             	test   %rbx,%rbx
+  802625:	75 f0                	jne    802617 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802627:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80262e:	00 00 00 
+  802631:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802637:	89 fa                	mov    %edi,%edx
+  802639:	48 bf 70 67 80 00 00 	movabs $0x806770,%rdi
+  802640:	00 00 00 
+  802643:	b8 00 00 00 00       	mov    $0x0,%eax
+  802648:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  80264f:	00 00 00 
+  802652:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802654:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802659:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80265d:	5b                   	pop    %rbx
+  80265e:	41 5c                	pop    %r12
+  802660:	5d                   	pop    %rbp
+  802661:	c3                   	ret
+            return 0;
+  802662:	b8 00 00 00 00       	mov    $0x0,%eax
+  802667:	eb f0                	jmp    802659 <dev_lookup+0x60>
+
+0000000000802669 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	41 55                	push   %r13
+  80266f:	41 54                	push   %r12
+  802671:	53                   	push   %rbx
+  802672:	48 83 ec 18          	sub    $0x18,%rsp
+  802676:	48 89 fb             	mov    %rdi,%rbx
+  802679:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80267c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802683:	ff ff ff 
+  802686:	48 01 df             	add    %rbx,%rdi
+  802689:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80268d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802691:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+  80269d:	41 89 c5             	mov    %eax,%r13d
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 06                	js     8026aa <fd_close+0x41>
+  8026a4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8026a8:	74 1a                	je     8026c4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8026aa:	45 84 e4             	test   %r12b,%r12b
+  8026ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8026b6:	44 89 e8             	mov    %r13d,%eax
+  8026b9:	48 83 c4 18          	add    $0x18,%rsp
+  8026bd:	5b                   	pop    %rbx
+  8026be:	41 5c                	pop    %r12
+  8026c0:	41 5d                	pop    %r13
+  8026c2:	5d                   	pop    %rbp
+  8026c3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8026c4:	8b 3b                	mov    (%rbx),%edi
+  8026c6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026ca:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	41 89 c5             	mov    %eax,%r13d
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 1b                	js     8026f8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8026dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026e1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8026e5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8026eb:	48 85 c0             	test   %rax,%rax
+  8026ee:	74 08                	je     8026f8 <fd_close+0x8f>
+  8026f0:	48 89 df             	mov    %rbx,%rdi
+  8026f3:	ff d0                	call   *%rax
+  8026f5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8026f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026fd:	48 89 de             	mov    %rbx,%rsi
+  802700:	bf 00 00 00 00       	mov    $0x0,%edi
+  802705:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  80270c:	00 00 00 
+  80270f:	ff d0                	call   *%rax
+    return res;
+  802711:	eb a3                	jmp    8026b6 <fd_close+0x4d>
+
+0000000000802713 <close>:
+
+int
+close(int fdnum) {
+  802713:	55                   	push   %rbp
+  802714:	48 89 e5             	mov    %rsp,%rbp
+  802717:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80271b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80271f:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802726:	00 00 00 
+  802729:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80272b:	85 c0                	test   %eax,%eax
+  80272d:	78 15                	js     802744 <close+0x31>
+
+    return fd_close(fd, 1);
+  80272f:	be 01 00 00 00       	mov    $0x1,%esi
+  802734:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802738:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+}
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+0000000000802746 <close_all>:
+
+void
+close_all(void) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 54                	push   %r12
+  80274c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80274d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802752:	49 bc 13 27 80 00 00 	movabs $0x802713,%r12
+  802759:	00 00 00 
+  80275c:	89 df                	mov    %ebx,%edi
+  80275e:	41 ff d4             	call   *%r12
+  802761:	83 c3 01             	add    $0x1,%ebx
+  802764:	83 fb 20             	cmp    $0x20,%ebx
+  802767:	75 f3                	jne    80275c <close_all+0x16>
+}
+  802769:	5b                   	pop    %rbx
+  80276a:	41 5c                	pop    %r12
+  80276c:	5d                   	pop    %rbp
+  80276d:	c3                   	ret
+
+000000000080276e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	41 57                	push   %r15
+  802774:	41 56                	push   %r14
+  802776:	41 55                	push   %r13
+  802778:	41 54                	push   %r12
+  80277a:	53                   	push   %rbx
+  80277b:	48 83 ec 18          	sub    $0x18,%rsp
+  80277f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802782:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802786:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+  802792:	89 c3                	mov    %eax,%ebx
+  802794:	85 c0                	test   %eax,%eax
+  802796:	0f 88 b8 00 00 00    	js     802854 <dup+0xe6>
+    close(newfdnum);
+  80279c:	44 89 e7             	mov    %r12d,%edi
+  80279f:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8027ab:	4d 63 ec             	movslq %r12d,%r13
+  8027ae:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8027b5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8027b9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8027bd:	4c 89 ff             	mov    %r15,%rdi
+  8027c0:	49 be 32 25 80 00 00 	movabs $0x802532,%r14
+  8027c7:	00 00 00 
+  8027ca:	41 ff d6             	call   *%r14
+  8027cd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8027d0:	4c 89 ef             	mov    %r13,%rdi
+  8027d3:	41 ff d6             	call   *%r14
+  8027d6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8027d9:	48 89 df             	mov    %rbx,%rdi
+  8027dc:	48 b8 42 4d 80 00 00 	movabs $0x804d42,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8027e8:	a8 04                	test   $0x4,%al
+  8027ea:	74 2b                	je     802817 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8027ec:	41 89 c1             	mov    %eax,%r9d
+  8027ef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027f5:	4c 89 f1             	mov    %r14,%rcx
+  8027f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fd:	48 89 de             	mov    %rbx,%rsi
+  802800:	bf 00 00 00 00       	mov    $0x0,%edi
+  802805:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  80280c:	00 00 00 
+  80280f:	ff d0                	call   *%rax
+  802811:	89 c3                	mov    %eax,%ebx
+  802813:	85 c0                	test   %eax,%eax
+  802815:	78 4e                	js     802865 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802817:	4c 89 ff             	mov    %r15,%rdi
+  80281a:	48 b8 42 4d 80 00 00 	movabs $0x804d42,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+  802826:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802829:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282f:	4c 89 e9             	mov    %r13,%rcx
+  802832:	ba 00 00 00 00       	mov    $0x0,%edx
+  802837:	4c 89 fe             	mov    %r15,%rsi
+  80283a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283f:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  802846:	00 00 00 
+  802849:	ff d0                	call   *%rax
+  80284b:	89 c3                	mov    %eax,%ebx
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 14                	js     802865 <dup+0xf7>
+
+    return newfdnum;
+  802851:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802854:	89 d8                	mov    %ebx,%eax
+  802856:	48 83 c4 18          	add    $0x18,%rsp
+  80285a:	5b                   	pop    %rbx
+  80285b:	41 5c                	pop    %r12
+  80285d:	41 5d                	pop    %r13
+  80285f:	41 5e                	pop    %r14
+  802861:	41 5f                	pop    %r15
+  802863:	5d                   	pop    %rbp
+  802864:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802865:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80286a:	4c 89 ee             	mov    %r13,%rsi
+  80286d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802872:	49 bc db 1b 80 00 00 	movabs $0x801bdb,%r12
+  802879:	00 00 00 
+  80287c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80287f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802884:	4c 89 f6             	mov    %r14,%rsi
+  802887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80288c:	41 ff d4             	call   *%r12
+    return res;
+  80288f:	eb c3                	jmp    802854 <dup+0xe6>
+
+0000000000802891 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	41 56                	push   %r14
+  802897:	41 55                	push   %r13
+  802899:	41 54                	push   %r12
+  80289b:	53                   	push   %rbx
+  80289c:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a0:	89 fb                	mov    %edi,%ebx
+  8028a2:	49 89 f4             	mov    %rsi,%r12
+  8028a5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028ac:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	78 4c                	js     802908 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028bc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8028c0:	41 8b 3e             	mov    (%r14),%edi
+  8028c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028c7:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+  8028d3:	85 c0                	test   %eax,%eax
+  8028d5:	78 35                	js     80290c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8028d7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8028db:	83 e0 03             	and    $0x3,%eax
+  8028de:	83 f8 01             	cmp    $0x1,%eax
+  8028e1:	74 2d                	je     802910 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8028e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028eb:	48 85 c0             	test   %rax,%rax
+  8028ee:	74 56                	je     802946 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8028f0:	4c 89 ea             	mov    %r13,%rdx
+  8028f3:	4c 89 e6             	mov    %r12,%rsi
+  8028f6:	4c 89 f7             	mov    %r14,%rdi
+  8028f9:	ff d0                	call   *%rax
+}
+  8028fb:	48 83 c4 10          	add    $0x10,%rsp
+  8028ff:	5b                   	pop    %rbx
+  802900:	41 5c                	pop    %r12
+  802902:	41 5d                	pop    %r13
+  802904:	41 5e                	pop    %r14
+  802906:	5d                   	pop    %rbp
+  802907:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802908:	48 98                	cltq
+  80290a:	eb ef                	jmp    8028fb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80290c:	48 98                	cltq
+  80290e:	eb eb                	jmp    8028fb <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802910:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  802917:	00 00 00 
+  80291a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802920:	89 da                	mov    %ebx,%edx
+  802922:	48 bf b1 67 80 00 00 	movabs $0x8067b1,%rdi
+  802929:	00 00 00 
+  80292c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802931:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  802938:	00 00 00 
+  80293b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80293d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802944:	eb b5                	jmp    8028fb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802946:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80294d:	eb ac                	jmp    8028fb <read+0x6a>
+
+000000000080294f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80294f:	55                   	push   %rbp
+  802950:	48 89 e5             	mov    %rsp,%rbp
+  802953:	41 57                	push   %r15
+  802955:	41 56                	push   %r14
+  802957:	41 55                	push   %r13
+  802959:	41 54                	push   %r12
+  80295b:	53                   	push   %rbx
+  80295c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802960:	48 85 d2             	test   %rdx,%rdx
+  802963:	74 54                	je     8029b9 <readn+0x6a>
+  802965:	41 89 fd             	mov    %edi,%r13d
+  802968:	49 89 f6             	mov    %rsi,%r14
+  80296b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80296e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802973:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802978:	49 bf 91 28 80 00 00 	movabs $0x802891,%r15
+  80297f:	00 00 00 
+  802982:	4c 89 e2             	mov    %r12,%rdx
+  802985:	48 29 f2             	sub    %rsi,%rdx
+  802988:	4c 01 f6             	add    %r14,%rsi
+  80298b:	44 89 ef             	mov    %r13d,%edi
+  80298e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802991:	85 c0                	test   %eax,%eax
+  802993:	78 20                	js     8029b5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802995:	01 c3                	add    %eax,%ebx
+  802997:	85 c0                	test   %eax,%eax
+  802999:	74 08                	je     8029a3 <readn+0x54>
+  80299b:	48 63 f3             	movslq %ebx,%rsi
+  80299e:	4c 39 e6             	cmp    %r12,%rsi
+  8029a1:	72 df                	jb     802982 <readn+0x33>
+    }
+    return res;
+  8029a3:	48 63 c3             	movslq %ebx,%rax
+}
+  8029a6:	48 83 c4 08          	add    $0x8,%rsp
+  8029aa:	5b                   	pop    %rbx
+  8029ab:	41 5c                	pop    %r12
+  8029ad:	41 5d                	pop    %r13
+  8029af:	41 5e                	pop    %r14
+  8029b1:	41 5f                	pop    %r15
+  8029b3:	5d                   	pop    %rbp
+  8029b4:	c3                   	ret
+        if (inc < 0) return inc;
+  8029b5:	48 98                	cltq
+  8029b7:	eb ed                	jmp    8029a6 <readn+0x57>
+    int inc = 1, res = 0;
+  8029b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029be:	eb e3                	jmp    8029a3 <readn+0x54>
+
+00000000008029c0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	41 56                	push   %r14
+  8029c6:	41 55                	push   %r13
+  8029c8:	41 54                	push   %r12
+  8029ca:	53                   	push   %rbx
+  8029cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8029cf:	89 fb                	mov    %edi,%ebx
+  8029d1:	49 89 f4             	mov    %rsi,%r12
+  8029d4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029d7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029db:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	78 47                	js     802a32 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029eb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8029ef:	41 8b 3e             	mov    (%r14),%edi
+  8029f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029f6:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+  802a02:	85 c0                	test   %eax,%eax
+  802a04:	78 30                	js     802a36 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a06:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802a0b:	74 2d                	je     802a3a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a11:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802a15:	48 85 c0             	test   %rax,%rax
+  802a18:	74 56                	je     802a70 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802a1a:	4c 89 ea             	mov    %r13,%rdx
+  802a1d:	4c 89 e6             	mov    %r12,%rsi
+  802a20:	4c 89 f7             	mov    %r14,%rdi
+  802a23:	ff d0                	call   *%rax
+}
+  802a25:	48 83 c4 10          	add    $0x10,%rsp
+  802a29:	5b                   	pop    %rbx
+  802a2a:	41 5c                	pop    %r12
+  802a2c:	41 5d                	pop    %r13
+  802a2e:	41 5e                	pop    %r14
+  802a30:	5d                   	pop    %rbp
+  802a31:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a32:	48 98                	cltq
+  802a34:	eb ef                	jmp    802a25 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a36:	48 98                	cltq
+  802a38:	eb eb                	jmp    802a25 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a3a:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  802a41:	00 00 00 
+  802a44:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a4a:	89 da                	mov    %ebx,%edx
+  802a4c:	48 bf cd 67 80 00 00 	movabs $0x8067cd,%rdi
+  802a53:	00 00 00 
+  802a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5b:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  802a62:	00 00 00 
+  802a65:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a67:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a6e:	eb b5                	jmp    802a25 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a70:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802a77:	eb ac                	jmp    802a25 <write+0x65>
+
+0000000000802a79 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802a79:	55                   	push   %rbp
+  802a7a:	48 89 e5             	mov    %rsp,%rbp
+  802a7d:	53                   	push   %rbx
+  802a7e:	48 83 ec 18          	sub    $0x18,%rsp
+  802a82:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a84:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a88:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	85 c0                	test   %eax,%eax
+  802a96:	78 0c                	js     802aa4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802a98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a9c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aa4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+
+0000000000802aaa <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802ab2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ab6:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	78 07                	js     802acd <tell+0x23>
+    return fdes->fd_offset;
+  802ac6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aca:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802acd:	c9                   	leave
+  802ace:	c3                   	ret
+
+0000000000802acf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802acf:	55                   	push   %rbp
+  802ad0:	48 89 e5             	mov    %rsp,%rbp
+  802ad3:	41 55                	push   %r13
+  802ad5:	41 54                	push   %r12
+  802ad7:	53                   	push   %rbx
+  802ad8:	48 83 ec 18          	sub    $0x18,%rsp
+  802adc:	89 fb                	mov    %edi,%ebx
+  802ade:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ae1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ae5:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	78 38                	js     802b2d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802af5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802af9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802afd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802b01:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+  802b0d:	85 c0                	test   %eax,%eax
+  802b0f:	78 1c                	js     802b2d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802b11:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802b16:	74 20                	je     802b38 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802b18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b1c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802b20:	48 85 c0             	test   %rax,%rax
+  802b23:	74 47                	je     802b6c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802b25:	44 89 e6             	mov    %r12d,%esi
+  802b28:	4c 89 ef             	mov    %r13,%rdi
+  802b2b:	ff d0                	call   *%rax
+}
+  802b2d:	48 83 c4 18          	add    $0x18,%rsp
+  802b31:	5b                   	pop    %rbx
+  802b32:	41 5c                	pop    %r12
+  802b34:	41 5d                	pop    %r13
+  802b36:	5d                   	pop    %rbp
+  802b37:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802b38:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  802b3f:	00 00 00 
+  802b42:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802b48:	89 da                	mov    %ebx,%edx
+  802b4a:	48 bf 90 67 80 00 00 	movabs $0x806790,%rdi
+  802b51:	00 00 00 
+  802b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b59:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  802b60:	00 00 00 
+  802b63:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6a:	eb c1                	jmp    802b2d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802b6c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b71:	eb ba                	jmp    802b2d <ftruncate+0x5e>
+
+0000000000802b73 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802b73:	55                   	push   %rbp
+  802b74:	48 89 e5             	mov    %rsp,%rbp
+  802b77:	41 54                	push   %r12
+  802b79:	53                   	push   %rbx
+  802b7a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b7e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b81:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b85:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802b8c:	00 00 00 
+  802b8f:	ff d0                	call   *%rax
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	78 4e                	js     802be3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b95:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802b99:	41 8b 3c 24          	mov    (%r12),%edi
+  802b9d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802ba1:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+  802bad:	85 c0                	test   %eax,%eax
+  802baf:	78 32                	js     802be3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802bb1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bb5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802bba:	74 30                	je     802bec <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802bbc:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802bbf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802bc6:	00 00 00 
+    stat->st_isdir = 0;
+  802bc9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bd0:	00 00 00 
+    stat->st_dev = dev;
+  802bd3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802bda:	48 89 de             	mov    %rbx,%rsi
+  802bdd:	4c 89 e7             	mov    %r12,%rdi
+  802be0:	ff 50 28             	call   *0x28(%rax)
+}
+  802be3:	48 83 c4 10          	add    $0x10,%rsp
+  802be7:	5b                   	pop    %rbx
+  802be8:	41 5c                	pop    %r12
+  802bea:	5d                   	pop    %rbp
+  802beb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802bec:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802bf1:	eb f0                	jmp    802be3 <fstat+0x70>
+
+0000000000802bf3 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	41 54                	push   %r12
+  802bf9:	53                   	push   %rbx
+  802bfa:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802c01:	41 89 fc             	mov    %edi,%r12d
+  802c04:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c06:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c0a:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	78 31                	js     802c4b <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802c1a:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802c21:	44 89 e7             	mov    %r12d,%edi
+  802c24:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	78 17                	js     802c4b <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802c34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c38:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802c3b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c3e:	39 d3                	cmp    %edx,%ebx
+  802c40:	0f 4f da             	cmovg  %edx,%ebx
+  802c43:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802c46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c4b:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802c52:	5b                   	pop    %rbx
+  802c53:	41 5c                	pop    %r12
+  802c55:	5d                   	pop    %rbp
+  802c56:	c3                   	ret
+
+0000000000802c57 <seektoend>:
+{
+  802c57:	55                   	push   %rbp
+  802c58:	48 89 e5             	mov    %rsp,%rbp
+  802c5b:	53                   	push   %rbx
+  802c5c:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802c63:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802c65:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c69:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  802c70:	00 00 00 
+  802c73:	ff d0                	call   *%rax
+  802c75:	85 c0                	test   %eax,%eax
+  802c77:	78 28                	js     802ca1 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802c79:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802c80:	89 df                	mov    %ebx,%edi
+  802c82:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+  802c8e:	85 c0                	test   %eax,%eax
+  802c90:	78 0f                	js     802ca1 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802c92:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c99:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca5:	c9                   	leave
+  802ca6:	c3                   	ret
+
+0000000000802ca7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802ca7:	55                   	push   %rbp
+  802ca8:	48 89 e5             	mov    %rsp,%rbp
+  802cab:	41 54                	push   %r12
+  802cad:	53                   	push   %rbx
+  802cae:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802cb1:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb6:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+  802cc2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	78 25                	js     802ced <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802cc8:	4c 89 e6             	mov    %r12,%rsi
+  802ccb:	89 c7                	mov    %eax,%edi
+  802ccd:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+  802cd9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802cdc:	89 df                	mov    %ebx,%edi
+  802cde:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+
+    return res;
+  802cea:	44 89 e3             	mov    %r12d,%ebx
+}
+  802ced:	89 d8                	mov    %ebx,%eax
+  802cef:	5b                   	pop    %rbx
+  802cf0:	41 5c                	pop    %r12
+  802cf2:	5d                   	pop    %rbp
+  802cf3:	c3                   	ret
+
+0000000000802cf4 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802cf4:	55                   	push   %rbp
+  802cf5:	48 89 e5             	mov    %rsp,%rbp
+  802cf8:	53                   	push   %rbx
+  802cf9:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfd:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802d00:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802d10:	0f 87 ea 00 00 00    	ja     802e00 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802d16:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  802d1d:	00 00 00 
+  802d20:	80 38 00             	cmpb   $0x0,(%rax)
+  802d23:	75 35                	jne    802d5a <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802d25:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d2a:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802d2f:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802d34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d39:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  802d40:	00 00 00 
+  802d43:	ff d0                	call   *%rax
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	0f 88 ba 00 00 00    	js     802e07 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802d4d:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  802d54:	00 00 00 
+  802d57:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802d5a:	48 89 df             	mov    %rbx,%rdi
+  802d5d:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+  802d69:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802d6d:	48 ba 20 a0 98 00 00 	movabs $0x98a020,%rdx
+  802d74:	00 00 00 
+  802d77:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802d7b:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802d7e:	39 39                	cmp    %edi,(%rcx)
+  802d80:	74 46                	je     802dc8 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802d82:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802d86:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802d8d:	00 
+  802d8e:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802d95:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802d9c:	00 
+  802d9d:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802da4:	00 
+  802da5:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802dac:	00 
+  802dad:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802db4:	00 
+  802db5:	89 39                	mov    %edi,(%rcx)
+  802db7:	48 01 c6             	add    %rax,%rsi
+  802dba:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802dbf:	48 89 c8             	mov    %rcx,%rax
+  802dc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc6:	c9                   	leave
+  802dc7:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802dc8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802dcc:	48 be 20 a0 98 00 00 	movabs $0x98a020,%rsi
+  802dd3:	00 00 00 
+  802dd6:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802dd9:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802ddd:	74 e0                	je     802dbf <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802ddf:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802de6:	00 
+  802de7:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802deb:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802df2:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802df4:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802df7:	48 01 c2             	add    %rax,%rdx
+  802dfa:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802dfe:	eb bf                	jmp    802dbf <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802e00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e05:	eb b8                	jmp    802dbf <fbuf_get+0xcb>
+            return NULL;
+  802e07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e0c:	eb b1                	jmp    802dbf <fbuf_get+0xcb>
+
+0000000000802e0e <fsipc_bulk>:
+fsipc_bulk(void) {
+  802e0e:	55                   	push   %rbp
+  802e0f:	48 89 e5             	mov    %rsp,%rbp
+  802e12:	53                   	push   %rbx
+  802e13:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802e17:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  802e1e:	00 00 00 
+  802e21:	48 8b 18             	mov    (%rax),%rbx
+  802e24:	48 85 db             	test   %rbx,%rbx
+  802e27:	74 16                	je     802e3f <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802e29:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  802e30:	00 00 00 
+  802e33:	48 8b 18             	mov    (%rax),%rbx
+}
+  802e36:	48 89 d8             	mov    %rbx,%rax
+  802e39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e3d:	c9                   	leave
+  802e3e:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802e3f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e44:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802e49:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802e4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e53:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  802e5a:	00 00 00 
+  802e5d:	ff d0                	call   *%rax
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	78 d3                	js     802e36 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802e63:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802e68:	48 a3 20 a5 98 00 00 	movabs %rax,0x98a520
+  802e6f:	00 00 00 
+  802e72:	eb b5                	jmp    802e29 <fsipc_bulk+0x1b>
+
+0000000000802e74 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802e74:	55                   	push   %rbp
+  802e75:	48 89 e5             	mov    %rsp,%rbp
+  802e78:	41 57                	push   %r15
+  802e7a:	41 56                	push   %r14
+  802e7c:	41 55                	push   %r13
+  802e7e:	41 54                	push   %r12
+  802e80:	53                   	push   %rbx
+  802e81:	48 83 ec 08          	sub    $0x8,%rsp
+  802e85:	41 89 fd             	mov    %edi,%r13d
+  802e88:	49 89 f6             	mov    %rsi,%r14
+  802e8b:	49 89 d7             	mov    %rdx,%r15
+  802e8e:	48 89 cb             	mov    %rcx,%rbx
+  802e91:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802e94:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  802e9b:	00 00 00 
+  802e9e:	83 38 00             	cmpl   $0x0,(%rax)
+  802ea1:	74 52                	je     802ef5 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802ea3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802ea9:	4c 89 f9             	mov    %r15,%rcx
+  802eac:	4c 89 f2             	mov    %r14,%rdx
+  802eaf:	44 89 ee             	mov    %r13d,%esi
+  802eb2:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  802eb9:	00 00 00 
+  802ebc:	8b 38                	mov    (%rax),%edi
+  802ebe:	48 b8 6e 50 80 00 00 	movabs $0x80506e,%rax
+  802ec5:	00 00 00 
+  802ec8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ecf:	4c 89 e2             	mov    %r12,%rdx
+  802ed2:	48 89 de             	mov    %rbx,%rsi
+  802ed5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eda:	48 b8 be 4e 80 00 00 	movabs $0x804ebe,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+}
+  802ee6:	48 83 c4 08          	add    $0x8,%rsp
+  802eea:	5b                   	pop    %rbx
+  802eeb:	41 5c                	pop    %r12
+  802eed:	41 5d                	pop    %r13
+  802eef:	41 5e                	pop    %r14
+  802ef1:	41 5f                	pop    %r15
+  802ef3:	5d                   	pop    %rbp
+  802ef4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ef5:	bf 03 00 00 00       	mov    $0x3,%edi
+  802efa:	48 b8 11 51 80 00 00 	movabs $0x805111,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+  802f06:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  802f0d:	00 00 
+  802f0f:	eb 92                	jmp    802ea3 <fsipc_region+0x2f>
+
+0000000000802f11 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802f11:	55                   	push   %rbp
+  802f12:	48 89 e5             	mov    %rsp,%rbp
+  802f15:	41 57                	push   %r15
+  802f17:	41 56                	push   %r14
+  802f19:	41 55                	push   %r13
+  802f1b:	41 54                	push   %r12
+  802f1d:	53                   	push   %rbx
+  802f1e:	48 83 ec 28          	sub    $0x28,%rsp
+  802f22:	49 89 ff             	mov    %rdi,%r15
+  802f25:	49 89 f6             	mov    %rsi,%r14
+  802f28:	48 89 d3             	mov    %rdx,%rbx
+  802f2b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802f2f:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802f32:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802f3e:	48 85 c0             	test   %rax,%rax
+  802f41:	0f 84 cc 00 00 00    	je     803013 <devfile_write_direct+0x102>
+  802f47:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802f4a:	48 85 db             	test   %rbx,%rbx
+  802f4d:	0f 84 ba 00 00 00    	je     80300d <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802f53:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802f59:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802f60:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802f64:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f68:	4c 29 e3             	sub    %r12,%rbx
+  802f6b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802f70:	48 39 c3             	cmp    %rax,%rbx
+  802f73:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802f77:	48 89 da             	mov    %rbx,%rdx
+  802f7a:	4c 89 f6             	mov    %r14,%rsi
+  802f7d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f81:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802f8d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f91:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802f95:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802f98:	44 01 e0             	add    %r12d,%eax
+  802f9b:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802f9f:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802fa3:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802faa:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802fb1:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802fb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fc3:	4c 89 ee             	mov    %r13,%rsi
+  802fc6:	bf 04 00 00 00       	mov    $0x4,%edi
+  802fcb:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+        if (res < 0)
+  802fd7:	85 c0                	test   %eax,%eax
+  802fd9:	78 29                	js     803004 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802fdb:	74 2b                	je     803008 <devfile_write_direct+0xf7>
+        i += res;
+  802fdd:	48 98                	cltq
+  802fdf:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802fe2:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802fe5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fe9:	49 39 c4             	cmp    %rax,%r12
+  802fec:	0f 82 72 ff ff ff    	jb     802f64 <devfile_write_direct+0x53>
+    return i;
+  802ff2:	4c 89 e0             	mov    %r12,%rax
+}
+  802ff5:	48 83 c4 28          	add    $0x28,%rsp
+  802ff9:	5b                   	pop    %rbx
+  802ffa:	41 5c                	pop    %r12
+  802ffc:	41 5d                	pop    %r13
+  802ffe:	41 5e                	pop    %r14
+  803000:	41 5f                	pop    %r15
+  803002:	5d                   	pop    %rbp
+  803003:	c3                   	ret
+            return res;
+  803004:	48 98                	cltq
+  803006:	eb ed                	jmp    802ff5 <devfile_write_direct+0xe4>
+            return i;
+  803008:	4c 89 e0             	mov    %r12,%rax
+  80300b:	eb e8                	jmp    802ff5 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80300d:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  803011:	eb df                	jmp    802ff2 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  803013:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80301a:	eb d9                	jmp    802ff5 <devfile_write_direct+0xe4>
+
+000000000080301c <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80301c:	55                   	push   %rbp
+  80301d:	48 89 e5             	mov    %rsp,%rbp
+  803020:	41 56                	push   %r14
+  803022:	41 55                	push   %r13
+  803024:	41 54                	push   %r12
+  803026:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  803027:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80302b:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803034:	4d 39 ee             	cmp    %r13,%r14
+  803037:	0f 84 99 00 00 00    	je     8030d6 <fbuf_flush+0xba>
+  80303d:	49 89 fc             	mov    %rdi,%r12
+  803040:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  803043:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  803046:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80304a:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  803051:	00 00 00 
+  803054:	ff d0                	call   *%rax
+  803056:	48 89 c2             	mov    %rax,%rdx
+  803059:	48 c1 e2 04          	shl    $0x4,%rdx
+  80305d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803061:	48 c1 e0 0c          	shl    $0xc,%rax
+  803065:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80306a:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80306d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803071:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803078:	00 
+  803079:	44 89 f1             	mov    %r14d,%ecx
+  80307c:	4c 89 ea             	mov    %r13,%rdx
+  80307f:	4c 89 e7             	mov    %r12,%rdi
+  803082:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80308e:	48 85 c0             	test   %rax,%rax
+  803091:	78 43                	js     8030d6 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  803093:	4c 39 e8             	cmp    %r13,%rax
+  803096:	72 47                	jb     8030df <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  803098:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80309d:	83 c0 01             	add    $0x1,%eax
+  8030a0:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030a5:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8030a8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8030ac:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8030b0:	72 0f                	jb     8030c1 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8030b2:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8030b6:	48 39 c2             	cmp    %rax,%rdx
+  8030b9:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8030bd:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8030c1:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8030c8:	00 
+  8030c9:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  8030d0:	00 
+    return 0;
+  8030d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d6:	5b                   	pop    %rbx
+  8030d7:	41 5c                	pop    %r12
+  8030d9:	41 5d                	pop    %r13
+  8030db:	41 5e                	pop    %r14
+  8030dd:	5d                   	pop    %rbp
+  8030de:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  8030df:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8030e4:	eb f0                	jmp    8030d6 <fbuf_flush+0xba>
+
+00000000008030e6 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  8030e6:	55                   	push   %rbp
+  8030e7:	48 89 e5             	mov    %rsp,%rbp
+  8030ea:	53                   	push   %rbx
+  8030eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8030ef:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  8030f2:	48 b8 f4 2c 80 00 00 	movabs $0x802cf4,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+  8030fe:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  803101:	b8 00 00 00 00       	mov    $0x0,%eax
+  803106:	48 85 f6             	test   %rsi,%rsi
+  803109:	74 0f                	je     80311a <devfile_sync+0x34>
+  80310b:	48 89 df             	mov    %rbx,%rdi
+  80310e:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  803115:	00 00 00 
+  803118:	ff d0                	call   *%rax
+}
+  80311a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80311e:	c9                   	leave
+  80311f:	c3                   	ret
+
+0000000000803120 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  803120:	55                   	push   %rbp
+  803121:	48 89 e5             	mov    %rsp,%rbp
+  803124:	48 83 ec 10          	sub    $0x10,%rsp
+  803128:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80312b:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  803132:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  803133:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  803137:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80313c:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  803143:	00 00 00 
+  803146:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  80314d:	00 00 00 
+  803150:	ff d0                	call   *%rax
+}
+  803152:	c9                   	leave
+  803153:	c3                   	ret
+
+0000000000803154 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803154:	55                   	push   %rbp
+  803155:	48 89 e5             	mov    %rsp,%rbp
+  803158:	41 54                	push   %r12
+  80315a:	53                   	push   %rbx
+  80315b:	48 89 fb             	mov    %rdi,%rbx
+  80315e:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  803161:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80316d:	85 c0                	test   %eax,%eax
+  80316f:	78 63                	js     8031d4 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803171:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803174:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80317b:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  80317d:	be 00 00 00 00       	mov    $0x0,%esi
+  803182:	bf 05 00 00 00       	mov    $0x5,%edi
+  803187:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80318e:	00 00 00 
+  803191:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803193:	85 c0                	test   %eax,%eax
+  803195:	78 3d                	js     8031d4 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803197:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  80319e:	00 00 00 
+  8031a1:	48 89 de             	mov    %rbx,%rsi
+  8031a4:	4c 89 e7             	mov    %r12,%rdi
+  8031a7:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8031ae:	00 00 00 
+  8031b1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8031b3:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8031b9:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8031c0:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8031c1:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8031c7:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8031ce:	00 
+
+    return 0;
+  8031cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031d4:	5b                   	pop    %rbx
+  8031d5:	41 5c                	pop    %r12
+  8031d7:	5d                   	pop    %rbp
+  8031d8:	c3                   	ret
+
+00000000008031d9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8031d9:	55                   	push   %rbp
+  8031da:	48 89 e5             	mov    %rsp,%rbp
+  8031dd:	41 54                	push   %r12
+  8031df:	53                   	push   %rbx
+  8031e0:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  8031e3:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  8031ea:	00 00 00 
+  8031ed:	ff d0                	call   *%rax
+  8031ef:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8031f2:	48 89 df             	mov    %rbx,%rdi
+  8031f5:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+  803201:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803205:	76 2e                	jbe    803235 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  803207:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80320a:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  803211:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  803213:	be 00 00 00 00       	mov    $0x0,%esi
+  803218:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80321d:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  803224:	00 00 00 
+  803227:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803229:	45 85 e4             	test   %r12d,%r12d
+  80322c:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  803230:	5b                   	pop    %rbx
+  803231:	41 5c                	pop    %r12
+  803233:	5d                   	pop    %rbp
+  803234:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  803235:	48 89 df             	mov    %rbx,%rdi
+  803238:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  80323f:	00 00 00 
+  803242:	ff d0                	call   *%rax
+  803244:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803248:	48 b8 20 a0 98 00 00 	movabs $0x98a020,%rax
+  80324f:	00 00 00 
+  803252:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  803259:	48 89 df             	mov    %rbx,%rdi
+  80325c:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+  803268:	48 89 c6             	mov    %rax,%rsi
+  80326b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803270:	bf 00 00 00 00       	mov    $0x0,%edi
+  803275:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	eb 84                	jmp    803207 <devfile_flush+0x2e>
+
+0000000000803283 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803283:	55                   	push   %rbp
+  803284:	48 89 e5             	mov    %rsp,%rbp
+  803287:	41 55                	push   %r13
+  803289:	41 54                	push   %r12
+  80328b:	53                   	push   %rbx
+  80328c:	48 83 ec 08          	sub    $0x8,%rsp
+  803290:	48 89 fb             	mov    %rdi,%rbx
+  803293:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803296:	48 b8 f4 2c 80 00 00 	movabs $0x802cf4,%rax
+  80329d:	00 00 00 
+  8032a0:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032a2:	48 85 c0             	test   %rax,%rax
+  8032a5:	74 51                	je     8032f8 <devfile_trunc+0x75>
+  8032a7:	49 89 c4             	mov    %rax,%r12
+  8032aa:	48 89 c6             	mov    %rax,%rsi
+  8032ad:	48 89 df             	mov    %rbx,%rdi
+  8032b0:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  8032b7:	00 00 00 
+  8032ba:	ff d0                	call   *%rax
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	78 2d                	js     8032ed <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8032c0:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8032c7:	00 00 00 
+  8032ca:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8032cd:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8032cf:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8032d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8032dd:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+    if (res >= 0) {
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	79 3e                	jns    80332b <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  8032ed:	48 83 c4 08          	add    $0x8,%rsp
+  8032f1:	5b                   	pop    %rbx
+  8032f2:	41 5c                	pop    %r12
+  8032f4:	41 5d                	pop    %r13
+  8032f6:	5d                   	pop    %rbp
+  8032f7:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8032f8:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8032ff:	00 00 00 
+  803302:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803305:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803307:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80330b:	be 00 00 00 00       	mov    $0x0,%esi
+  803310:	bf 02 00 00 00       	mov    $0x2,%edi
+  803315:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80331c:	00 00 00 
+  80331f:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803321:	85 c0                	test   %eax,%eax
+  803323:	78 c8                	js     8032ed <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803325:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803329:	eb c2                	jmp    8032ed <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80332b:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  80332e:	8d 51 01             	lea    0x1(%rcx),%edx
+  803331:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803334:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803339:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803340:	00 00 
+  803342:	eb a9                	jmp    8032ed <devfile_trunc+0x6a>
+
+0000000000803344 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803344:	55                   	push   %rbp
+  803345:	48 89 e5             	mov    %rsp,%rbp
+  803348:	41 57                	push   %r15
+  80334a:	41 56                	push   %r14
+  80334c:	41 55                	push   %r13
+  80334e:	41 54                	push   %r12
+  803350:	53                   	push   %rbx
+  803351:	48 83 ec 28          	sub    $0x28,%rsp
+  803355:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803359:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80335d:	49 89 d7             	mov    %rdx,%r15
+  803360:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803364:	48 b8 f4 2c 80 00 00 	movabs $0x802cf4,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+  803370:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803373:	48 85 c0             	test   %rax,%rax
+  803376:	74 31                	je     8033a9 <devfile_write+0x65>
+  803378:	4c 89 f8             	mov    %r15,%rax
+  80337b:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803382:	77 25                	ja     8033a9 <devfile_write+0x65>
+    size_t i = 0;
+  803384:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  80338a:	48 85 c0             	test   %rax,%rax
+  80338d:	0f 85 64 01 00 00    	jne    8034f7 <devfile_write+0x1b3>
+    size_t i = 0;
+  803393:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803397:	4c 89 f8             	mov    %r15,%rax
+}
+  80339a:	48 83 c4 28          	add    $0x28,%rsp
+  80339e:	5b                   	pop    %rbx
+  80339f:	41 5c                	pop    %r12
+  8033a1:	41 5d                	pop    %r13
+  8033a3:	41 5e                	pop    %r14
+  8033a5:	41 5f                	pop    %r15
+  8033a7:	5d                   	pop    %rbp
+  8033a8:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8033a9:	48 85 db             	test   %rbx,%rbx
+  8033ac:	74 5b                	je     803409 <devfile_write+0xc5>
+  8033ae:	48 89 de             	mov    %rbx,%rsi
+  8033b1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033b5:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	85 c0                	test   %eax,%eax
+  8033c3:	78 40                	js     803405 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8033c5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033c9:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  8033cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033d0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8033d4:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8033e0:	48 85 c0             	test   %rax,%rax
+  8033e3:	7e b5                	jle    80339a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8033e5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8033e9:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  8033ec:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  8033ef:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  8033f2:	8d 51 01             	lea    0x1(%rcx),%edx
+  8033f5:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8033f8:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  8033fb:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803402:	00 
+  803403:	eb 95                	jmp    80339a <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803405:	48 98                	cltq
+  803407:	eb 91                	jmp    80339a <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803409:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80340d:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803410:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803414:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803418:	48 89 df             	mov    %rbx,%rdi
+  80341b:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803427:	48 85 c0             	test   %rax,%rax
+  80342a:	0f 8e 6a ff ff ff    	jle    80339a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803430:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803433:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803437:	e9 5e ff ff ff       	jmp    80339a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80343c:	48 98                	cltq
+  80343e:	4d 85 ff             	test   %r15,%r15
+  803441:	49 0f 45 c7          	cmovne %r15,%rax
+  803445:	e9 50 ff ff ff       	jmp    80339a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80344a:	48 89 de             	mov    %rbx,%rsi
+  80344d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803451:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	0f 88 2b 01 00 00    	js     803590 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803465:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803469:	4c 01 f8             	add    %r15,%rax
+  80346c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803470:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803474:	48 b9 20 25 80 00 00 	movabs $0x802520,%rcx
+  80347b:	00 00 00 
+  80347e:	ff d1                	call   *%rcx
+  803480:	48 89 c2             	mov    %rax,%rdx
+  803483:	48 c1 e2 04          	shl    $0x4,%rdx
+  803487:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80348b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80348f:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803494:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803497:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80349e:	00 
+  80349f:	4c 89 ea             	mov    %r13,%rdx
+  8034a2:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8034a6:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8034b2:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8034b6:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8034ba:	48 39 c2             	cmp    %rax,%rdx
+  8034bd:	0f 84 db 00 00 00    	je     80359e <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8034c3:	4c 39 e2             	cmp    %r12,%rdx
+  8034c6:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8034ca:	4d 01 ec             	add    %r13,%r12
+  8034cd:	49 39 c4             	cmp    %rax,%r12
+  8034d0:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8034d4:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8034d8:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8034dc:	45 01 ee             	add    %r13d,%r14d
+  8034df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034e3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8034e7:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8034ea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034ee:	49 39 c7             	cmp    %rax,%r15
+  8034f1:	0f 83 a0 fe ff ff    	jae    803397 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8034f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034fb:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8034ff:	8b 43 08             	mov    0x8(%rbx),%eax
+  803502:	44 39 f0             	cmp    %r14d,%eax
+  803505:	7f 10                	jg     803517 <devfile_write+0x1d3>
+  803507:	48 98                	cltq
+  803509:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80350f:	49 63 d6             	movslq %r14d,%rdx
+  803512:	48 39 d0             	cmp    %rdx,%rax
+  803515:	7d 2d                	jge    803544 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803517:	48 89 de             	mov    %rbx,%rsi
+  80351a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80351e:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  803525:	00 00 00 
+  803528:	ff d0                	call   *%rax
+  80352a:	85 c0                	test   %eax,%eax
+  80352c:	0f 88 0a ff ff ff    	js     80343c <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803532:	44 89 f0             	mov    %r14d,%eax
+  803535:	66 b8 00 00          	mov    $0x0,%ax
+  803539:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80353c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803543:	00 
+        size_t off = pos - fb->fb_base;
+  803544:	45 89 f4             	mov    %r14d,%r12d
+  803547:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80354b:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80354e:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803552:	4d 29 fd             	sub    %r15,%r13
+  803555:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80355a:	4c 29 e0             	sub    %r12,%rax
+  80355d:	49 39 c5             	cmp    %rax,%r13
+  803560:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803564:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803568:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80356c:	48 39 c2             	cmp    %rax,%rdx
+  80356f:	0f 84 f0 fe ff ff    	je     803465 <devfile_write+0x121>
+  803575:	4c 39 e0             	cmp    %r12,%rax
+  803578:	0f 82 cc fe ff ff    	jb     80344a <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80357e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803582:	48 39 d0             	cmp    %rdx,%rax
+  803585:	0f 83 da fe ff ff    	jae    803465 <devfile_write+0x121>
+  80358b:	e9 ba fe ff ff       	jmp    80344a <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803590:	48 98                	cltq
+  803592:	4d 85 ff             	test   %r15,%r15
+  803595:	49 0f 45 c7          	cmovne %r15,%rax
+  803599:	e9 fc fd ff ff       	jmp    80339a <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80359e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8035a2:	4c 89 e2             	mov    %r12,%rdx
+  8035a5:	e9 2a ff ff ff       	jmp    8034d4 <devfile_write+0x190>
+
+00000000008035aa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8035aa:	55                   	push   %rbp
+  8035ab:	48 89 e5             	mov    %rsp,%rbp
+  8035ae:	41 57                	push   %r15
+  8035b0:	41 56                	push   %r14
+  8035b2:	41 55                	push   %r13
+  8035b4:	41 54                	push   %r12
+  8035b6:	53                   	push   %rbx
+  8035b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8035bb:	49 89 ff             	mov    %rdi,%r15
+  8035be:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8035c2:	48 89 d3             	mov    %rdx,%rbx
+  8035c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8035c9:	48 b8 f4 2c 80 00 00 	movabs $0x802cf4,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+  8035d5:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8035d8:	48 85 c0             	test   %rax,%rax
+  8035db:	74 0d                	je     8035ea <devfile_read+0x40>
+  8035dd:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8035e4:	0f 86 1a 01 00 00    	jbe    803704 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8035ea:	4d 85 e4             	test   %r12,%r12
+  8035ed:	74 1a                	je     803609 <devfile_read+0x5f>
+  8035ef:	4c 89 e6             	mov    %r12,%rsi
+  8035f2:	4c 89 ff             	mov    %r15,%rdi
+  8035f5:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  8035fc:	00 00 00 
+  8035ff:	ff d0                	call   *%rax
+  803601:	85 c0                	test   %eax,%eax
+  803603:	0f 88 e8 00 00 00    	js     8036f1 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803609:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80360d:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+  803619:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80361c:	48 85 c0             	test   %rax,%rax
+  80361f:	0f 84 69 02 00 00    	je     80388e <devfile_read+0x2e4>
+    while (i < n) {
+  803625:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80362a:	0f 84 ce 00 00 00    	je     8036fe <devfile_read+0x154>
+    size_t i = 0;
+  803630:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803635:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80363c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803640:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803644:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803648:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80364c:	48 29 da             	sub    %rbx,%rdx
+  80364f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803654:	48 39 c2             	cmp    %rax,%rdx
+  803657:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80365b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80365f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803663:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803666:	01 d8                	add    %ebx,%eax
+  803668:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80366c:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803670:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803677:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80367e:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80368b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803690:	4c 89 ee             	mov    %r13,%rsi
+  803693:	bf 03 00 00 00       	mov    $0x3,%edi
+  803698:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  80369f:	00 00 00 
+  8036a2:	ff d0                	call   *%rax
+        if (res < 0)
+  8036a4:	85 c0                	test   %eax,%eax
+  8036a6:	78 4d                	js     8036f5 <devfile_read+0x14b>
+        if (res == 0)
+  8036a8:	74 4f                	je     8036f9 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8036aa:	4c 63 e0             	movslq %eax,%r12
+  8036ad:	4c 89 e2             	mov    %r12,%rdx
+  8036b0:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8036b4:	4c 89 f7             	mov    %r14,%rdi
+  8036b7:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+        i += res;
+  8036c3:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8036c6:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8036c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036cd:	48 39 c3             	cmp    %rax,%rbx
+  8036d0:	0f 82 72 ff ff ff    	jb     803648 <devfile_read+0x9e>
+    return i;
+  8036d6:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8036d9:	48 85 c0             	test   %rax,%rax
+  8036dc:	7e 04                	jle    8036e2 <devfile_read+0x138>
+  8036de:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8036e2:	48 83 c4 28          	add    $0x28,%rsp
+  8036e6:	5b                   	pop    %rbx
+  8036e7:	41 5c                	pop    %r12
+  8036e9:	41 5d                	pop    %r13
+  8036eb:	41 5e                	pop    %r14
+  8036ed:	41 5f                	pop    %r15
+  8036ef:	5d                   	pop    %rbp
+  8036f0:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8036f1:	48 98                	cltq
+  8036f3:	eb ed                	jmp    8036e2 <devfile_read+0x138>
+            return res;
+  8036f5:	48 98                	cltq
+  8036f7:	eb e9                	jmp    8036e2 <devfile_read+0x138>
+            return i;
+  8036f9:	48 89 d8             	mov    %rbx,%rax
+  8036fc:	eb db                	jmp    8036d9 <devfile_read+0x12f>
+    size_t i = 0;
+  8036fe:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803702:	eb d2                	jmp    8036d6 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803704:	48 89 c6             	mov    %rax,%rsi
+  803707:	4c 89 ff             	mov    %r15,%rdi
+  80370a:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  803711:	00 00 00 
+  803714:	ff d0                	call   *%rax
+  803716:	85 c0                	test   %eax,%eax
+  803718:	78 40                	js     80375a <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80371a:	4c 89 ff             	mov    %r15,%rdi
+  80371d:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  803724:	00 00 00 
+  803727:	ff d0                	call   *%rax
+  803729:	48 89 c2             	mov    %rax,%rdx
+  80372c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803730:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803734:	48 c1 e0 0c          	shl    $0xc,%rax
+  803738:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80373d:	48 01 d0             	add    %rdx,%rax
+  803740:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803744:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803749:	0f 84 33 01 00 00    	je     803882 <devfile_read+0x2d8>
+    size_t i = 0;
+  80374f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803755:	e9 f5 00 00 00       	jmp    80384f <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80375a:	48 98                	cltq
+  80375c:	eb 84                	jmp    8036e2 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80375e:	44 89 e8             	mov    %r13d,%eax
+  803761:	66 b8 00 00          	mov    $0x0,%ax
+  803765:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80376a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803771:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803773:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803777:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80377b:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80377d:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803782:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803785:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80378c:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80378d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803798:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80379d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037a2:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  8037a9:	00 00 00 
+  8037ac:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8037ae:	85 c0                	test   %eax,%eax
+  8037b0:	0f 88 be 00 00 00    	js     803874 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8037b6:	48 63 d0             	movslq %eax,%rdx
+  8037b9:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8037be:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8037c3:	44 39 e8             	cmp    %r13d,%eax
+  8037c6:	0f 8e ba 00 00 00    	jle    803886 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8037cc:	49 63 c5             	movslq %r13d,%rax
+  8037cf:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8037d4:	48 29 c3             	sub    %rax,%rbx
+  8037d7:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8037dc:	48 01 c3             	add    %rax,%rbx
+  8037df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037e3:	4c 29 f0             	sub    %r14,%rax
+  8037e6:	48 39 c3             	cmp    %rax,%rbx
+  8037e9:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8037ed:	4c 89 ff             	mov    %r15,%rdi
+  8037f0:	48 b9 20 25 80 00 00 	movabs $0x802520,%rcx
+  8037f7:	00 00 00 
+  8037fa:	ff d1                	call   *%rcx
+  8037fc:	48 89 c2             	mov    %rax,%rdx
+  8037ff:	48 c1 e2 04          	shl    $0x4,%rdx
+  803803:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803807:	48 c1 e0 0c          	shl    $0xc,%rax
+  80380b:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803810:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803813:	44 89 ea             	mov    %r13d,%edx
+  803816:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80381b:	48 63 d2             	movslq %edx,%rdx
+  80381e:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803825:	00 
+  803826:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80382a:	4c 01 f7             	add    %r14,%rdi
+  80382d:	48 89 da             	mov    %rbx,%rdx
+  803830:	48 b9 91 16 80 00 00 	movabs $0x801691,%rcx
+  803837:	00 00 00 
+  80383a:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80383c:	41 01 dd             	add    %ebx,%r13d
+  80383f:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803843:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803846:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80384a:	49 39 c6             	cmp    %rax,%r14
+  80384d:	73 37                	jae    803886 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80384f:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803853:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803858:	44 39 e8             	cmp    %r13d,%eax
+  80385b:	0f 8f fd fe ff ff    	jg     80375e <devfile_read+0x1b4>
+  803861:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803866:	44 39 e8             	cmp    %r13d,%eax
+  803869:	0f 8f 5d ff ff ff    	jg     8037cc <devfile_read+0x222>
+  80386f:	e9 ea fe ff ff       	jmp    80375e <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803874:	48 98                	cltq
+  803876:	4d 85 f6             	test   %r14,%r14
+  803879:	49 0f 45 c6          	cmovne %r14,%rax
+  80387d:	e9 60 fe ff ff       	jmp    8036e2 <devfile_read+0x138>
+    size_t i = 0;
+  803882:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803886:	4c 89 f0             	mov    %r14,%rax
+  803889:	e9 54 fe ff ff       	jmp    8036e2 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80388e:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803895:	e9 48 fe ff ff       	jmp    8036e2 <devfile_read+0x138>
+
+000000000080389a <open>:
+open(const char *path, int mode) {
+  80389a:	55                   	push   %rbp
+  80389b:	48 89 e5             	mov    %rsp,%rbp
+  80389e:	41 55                	push   %r13
+  8038a0:	41 54                	push   %r12
+  8038a2:	53                   	push   %rbx
+  8038a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a7:	49 89 fc             	mov    %rdi,%r12
+  8038aa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8038ad:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  8038b4:	00 00 00 
+  8038b7:	ff d0                	call   *%rax
+  8038b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8038bf:	0f 87 8a 00 00 00    	ja     80394f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8038c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8038c9:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+  8038d5:	89 c3                	mov    %eax,%ebx
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	78 50                	js     80392b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8038db:	4c 89 e6             	mov    %r12,%rsi
+  8038de:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  8038e5:	00 00 00 
+  8038e8:	48 89 df             	mov    %rbx,%rdi
+  8038eb:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8038f7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8038fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803902:	bf 01 00 00 00       	mov    $0x1,%edi
+  803907:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  80390e:	00 00 00 
+  803911:	ff d0                	call   *%rax
+  803913:	89 c3                	mov    %eax,%ebx
+  803915:	85 c0                	test   %eax,%eax
+  803917:	78 1f                	js     803938 <open+0x9e>
+    return fd2num(fd);
+  803919:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80391d:	48 b8 20 25 80 00 00 	movabs $0x802520,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+  803929:	89 c3                	mov    %eax,%ebx
+}
+  80392b:	89 d8                	mov    %ebx,%eax
+  80392d:	48 83 c4 18          	add    $0x18,%rsp
+  803931:	5b                   	pop    %rbx
+  803932:	41 5c                	pop    %r12
+  803934:	41 5d                	pop    %r13
+  803936:	5d                   	pop    %rbp
+  803937:	c3                   	ret
+        fd_close(fd, 0);
+  803938:	be 00 00 00 00       	mov    $0x0,%esi
+  80393d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803941:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+        return res;
+  80394d:	eb dc                	jmp    80392b <open+0x91>
+        return -E_BAD_PATH;
+  80394f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803954:	eb d5                	jmp    80392b <open+0x91>
+
+0000000000803956 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803956:	55                   	push   %rbp
+  803957:	48 89 e5             	mov    %rsp,%rbp
+  80395a:	41 57                	push   %r15
+  80395c:	41 56                	push   %r14
+  80395e:	41 55                	push   %r13
+  803960:	41 54                	push   %r12
+  803962:	53                   	push   %rbx
+  803963:	48 83 ec 18          	sub    $0x18,%rsp
+  803967:	41 89 f6             	mov    %esi,%r14d
+  80396a:	49 89 d7             	mov    %rdx,%r15
+  80396d:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803970:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803974:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  80397b:	00 00 00 
+  80397e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803980:	85 c0                	test   %eax,%eax
+  803982:	0f 88 db 00 00 00    	js     803a63 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803988:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80398c:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803993:	00 00 00 
+  803996:	8b 00                	mov    (%rax),%eax
+  803998:	39 07                	cmp    %eax,(%rdi)
+  80399a:	0f 85 db 00 00 00    	jne    803a7b <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8039a0:	45 85 f6             	test   %r14d,%r14d
+  8039a3:	0f 88 db 00 00 00    	js     803a84 <fmap+0x12e>
+  8039a9:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8039b0:	0f 85 d7 00 00 00    	jne    803a8d <fmap+0x137>
+  8039b6:	4c 89 fb             	mov    %r15,%rbx
+  8039b9:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8039bf:	0f 85 d1 00 00 00    	jne    803a96 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8039c5:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  8039cc:	00 00 00 
+  8039cf:	ff d0                	call   *%rax
+  8039d1:	85 c0                	test   %eax,%eax
+  8039d3:	0f 88 8e 00 00 00    	js     803a67 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8039d9:	49 bc 00 90 98 00 00 	movabs $0x989000,%r12
+  8039e0:	00 00 00 
+    while (i < n) {
+  8039e3:	4d 85 ed             	test   %r13,%r13
+  8039e6:	0f 84 8a 00 00 00    	je     803a76 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8039ec:	4c 89 ea             	mov    %r13,%rdx
+  8039ef:	48 29 da             	sub    %rbx,%rdx
+  8039f2:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8039f9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8039ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803a03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a07:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a0a:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803a0e:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803a12:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803a17:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803a1c:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803a20:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803a24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a29:	4c 89 e6             	mov    %r12,%rsi
+  803a2c:	bf 09 00 00 00       	mov    $0x9,%edi
+  803a31:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  803a38:	00 00 00 
+  803a3b:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	78 2a                	js     803a6b <fmap+0x115>
+        i += res;
+  803a41:	48 98                	cltq
+  803a43:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803a46:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803a4a:	72 05                	jb     803a51 <fmap+0xfb>
+    while (i < n) {
+  803a4c:	4c 39 eb             	cmp    %r13,%rbx
+  803a4f:	72 9b                	jb     8039ec <fmap+0x96>
+    }
+    return i;
+  803a51:	48 89 d8             	mov    %rbx,%rax
+}
+  803a54:	48 83 c4 18          	add    $0x18,%rsp
+  803a58:	5b                   	pop    %rbx
+  803a59:	41 5c                	pop    %r12
+  803a5b:	41 5d                	pop    %r13
+  803a5d:	41 5e                	pop    %r14
+  803a5f:	41 5f                	pop    %r15
+  803a61:	5d                   	pop    %rbp
+  803a62:	c3                   	ret
+    if (res < 0) return res;
+  803a63:	48 98                	cltq
+  803a65:	eb ed                	jmp    803a54 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803a67:	48 98                	cltq
+  803a69:	eb e9                	jmp    803a54 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803a6b:	48 98                	cltq
+  803a6d:	48 85 db             	test   %rbx,%rbx
+  803a70:	48 0f 45 c3          	cmovne %rbx,%rax
+  803a74:	eb de                	jmp    803a54 <fmap+0xfe>
+    size_t i = 0;
+  803a76:	4c 89 eb             	mov    %r13,%rbx
+  803a79:	eb d6                	jmp    803a51 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a7b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803a82:	eb d0                	jmp    803a54 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803a84:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a8b:	eb c7                	jmp    803a54 <fmap+0xfe>
+  803a8d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a94:	eb be                	jmp    803a54 <fmap+0xfe>
+  803a96:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a9d:	eb b5                	jmp    803a54 <fmap+0xfe>
+
+0000000000803a9f <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803a9f:	55                   	push   %rbp
+  803aa0:	48 89 e5             	mov    %rsp,%rbp
+  803aa3:	41 56                	push   %r14
+  803aa5:	41 55                	push   %r13
+  803aa7:	41 54                	push   %r12
+  803aa9:	53                   	push   %rbx
+  803aaa:	48 83 ec 10          	sub    $0x10,%rsp
+  803aae:	89 fb                	mov    %edi,%ebx
+  803ab0:	41 89 f4             	mov    %esi,%r12d
+  803ab3:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ab6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aba:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	78 63                	js     803b2d <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803aca:	45 85 e4             	test   %r12d,%r12d
+  803acd:	0f 88 80 00 00 00    	js     803b53 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803ad3:	45 89 e6             	mov    %r12d,%r14d
+  803ad6:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803add:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ae1:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  803ae8:	00 00 00 
+  803aeb:	ff d0                	call   *%rax
+  803aed:	48 89 c2             	mov    %rax,%rdx
+  803af0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803af5:	44 89 f6             	mov    %r14d,%esi
+  803af8:	89 df                	mov    %ebx,%edi
+  803afa:	48 b8 56 39 80 00 00 	movabs $0x803956,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+  803b06:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803b09:	45 29 f4             	sub    %r14d,%r12d
+  803b0c:	4d 63 f4             	movslq %r12d,%r14
+  803b0f:	49 39 c6             	cmp    %rax,%r14
+  803b12:	7c 1d                	jl     803b31 <read_map+0x92>
+  803b14:	48 85 c0             	test   %rax,%rax
+  803b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b1c:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803b20:	48 83 c4 10          	add    $0x10,%rsp
+  803b24:	5b                   	pop    %rbx
+  803b25:	41 5c                	pop    %r12
+  803b27:	41 5d                	pop    %r13
+  803b29:	41 5e                	pop    %r14
+  803b2b:	5d                   	pop    %rbp
+  803b2c:	c3                   	ret
+    if (res < 0) return res;
+  803b2d:	48 98                	cltq
+  803b2f:	eb ef                	jmp    803b20 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803b31:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b35:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  803b3c:	00 00 00 
+  803b3f:	ff d0                	call   *%rax
+  803b41:	4d 63 e4             	movslq %r12d,%r12
+  803b44:	4c 01 e0             	add    %r12,%rax
+  803b47:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803b4b:	48 89 d8             	mov    %rbx,%rax
+  803b4e:	4c 29 f0             	sub    %r14,%rax
+  803b51:	eb cd                	jmp    803b20 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803b53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b5a:	eb c4                	jmp    803b20 <read_map+0x81>
+
+0000000000803b5c <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803b5c:	55                   	push   %rbp
+  803b5d:	48 89 e5             	mov    %rsp,%rbp
+  803b60:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b64:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b68:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b74:	85 c0                	test   %eax,%eax
+  803b76:	78 4a                	js     803bc2 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b78:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b7c:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803b83:	00 00 00 
+  803b86:	8b 00                	mov    (%rax),%eax
+  803b88:	39 07                	cmp    %eax,(%rdi)
+  803b8a:	75 38                	jne    803bc4 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803b8c:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  803b93:	00 00 00 
+  803b96:	ff d0                	call   *%rax
+  803b98:	85 c0                	test   %eax,%eax
+  803b9a:	78 26                	js     803bc2 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803b9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ba0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ba3:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  803baa:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803bac:	be 00 00 00 00       	mov    $0x0,%esi
+  803bb1:	bf 06 00 00 00       	mov    $0x6,%edi
+  803bb6:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  803bbd:	00 00 00 
+  803bc0:	ff d0                	call   *%rax
+}
+  803bc2:	c9                   	leave
+  803bc3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bc4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803bc9:	eb f7                	jmp    803bc2 <fsync+0x66>
+
+0000000000803bcb <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803bcb:	55                   	push   %rbp
+  803bcc:	48 89 e5             	mov    %rsp,%rbp
+  803bcf:	41 57                	push   %r15
+  803bd1:	41 56                	push   %r14
+  803bd3:	41 55                	push   %r13
+  803bd5:	41 54                	push   %r12
+  803bd7:	53                   	push   %rbx
+  803bd8:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803bdc:	49 bc 20 a0 98 00 00 	movabs $0x98a020,%r12
+  803be3:	00 00 00 
+  803be6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803beb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803bf1:	49 bd ae 25 80 00 00 	movabs $0x8025ae,%r13
+  803bf8:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803bfb:	49 be 60 70 80 00 00 	movabs $0x807060,%r14
+  803c02:	00 00 00 
+  803c05:	eb 0c                	jmp    803c13 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803c07:	83 c3 01             	add    $0x1,%ebx
+  803c0a:	49 83 c4 28          	add    $0x28,%r12
+  803c0e:	83 fb 20             	cmp    $0x20,%ebx
+  803c11:	74 33                	je     803c46 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803c13:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803c18:	74 ed                	je     803c07 <flushall+0x3c>
+  803c1a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803c1e:	89 df                	mov    %ebx,%edi
+  803c20:	41 ff d5             	call   *%r13
+  803c23:	85 c0                	test   %eax,%eax
+  803c25:	78 e0                	js     803c07 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803c27:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803c2b:	41 8b 06             	mov    (%r14),%eax
+  803c2e:	39 07                	cmp    %eax,(%rdi)
+  803c30:	75 d5                	jne    803c07 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803c32:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803c3e:	85 c0                	test   %eax,%eax
+  803c40:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803c44:	eb c1                	jmp    803c07 <flushall+0x3c>
+    }
+    return res;
+}
+  803c46:	44 89 f8             	mov    %r15d,%eax
+  803c49:	48 83 c4 18          	add    $0x18,%rsp
+  803c4d:	5b                   	pop    %rbx
+  803c4e:	41 5c                	pop    %r12
+  803c50:	41 5d                	pop    %r13
+  803c52:	41 5e                	pop    %r14
+  803c54:	41 5f                	pop    %r15
+  803c56:	5d                   	pop    %rbp
+  803c57:	c3                   	ret
+
+0000000000803c58 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803c58:	55                   	push   %rbp
+  803c59:	48 89 e5             	mov    %rsp,%rbp
+  803c5c:	53                   	push   %rbx
+  803c5d:	48 83 ec 08          	sub    $0x8,%rsp
+  803c61:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803c64:	40 0f b6 c6          	movzbl %sil,%eax
+  803c68:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  803c6f:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803c71:	be 00 00 00 00       	mov    $0x0,%esi
+  803c76:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803c7b:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  803c82:	00 00 00 
+  803c85:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c87:	85 c0                	test   %eax,%eax
+  803c89:	78 23                	js     803cae <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803c8b:	ba 58 06 00 00       	mov    $0x658,%edx
+  803c90:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  803c97:	00 00 00 
+  803c9a:	48 89 df             	mov    %rbx,%rdi
+  803c9d:	48 b8 91 16 80 00 00 	movabs $0x801691,%rax
+  803ca4:	00 00 00 
+  803ca7:	ff d0                	call   *%rax
+    return 0;
+  803ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cb2:	c9                   	leave
+  803cb3:	c3                   	ret
+
+0000000000803cb4 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803cb4:	55                   	push   %rbp
+  803cb5:	48 89 e5             	mov    %rsp,%rbp
+  803cb8:	53                   	push   %rbx
+  803cb9:	48 83 ec 08          	sub    $0x8,%rsp
+  803cbd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803cc0:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  803cc7:	00 00 00 
+  803cca:	ff d0                	call   *%rax
+  803ccc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803cd2:	77 35                	ja     803d09 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803cd4:	48 89 de             	mov    %rbx,%rsi
+  803cd7:	48 bf 00 90 98 00 00 	movabs $0x989000,%rdi
+  803cde:	00 00 00 
+  803ce1:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803ced:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf2:	bf 07 00 00 00       	mov    $0x7,%edi
+  803cf7:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  803cfe:	00 00 00 
+  803d01:	ff d0                	call   *%rax
+}
+  803d03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d07:	c9                   	leave
+  803d08:	c3                   	ret
+        return -E_BAD_PATH;
+  803d09:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d0e:	eb f3                	jmp    803d03 <remove+0x4f>
+
+0000000000803d10 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803d10:	55                   	push   %rbp
+  803d11:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803d14:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  803d1b:	00 00 00 
+  803d1e:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803d20:	be 00 00 00 00       	mov    $0x0,%esi
+  803d25:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d2a:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+}
+  803d36:	5d                   	pop    %rbp
+  803d37:	c3                   	ret
+
+0000000000803d38 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803d38:	55                   	push   %rbp
+  803d39:	48 89 e5             	mov    %rsp,%rbp
+  803d3c:	41 55                	push   %r13
+  803d3e:	41 54                	push   %r12
+  803d40:	53                   	push   %rbx
+  803d41:	48 83 ec 08          	sub    $0x8,%rsp
+  803d45:	48 89 fb             	mov    %rdi,%rbx
+  803d48:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803d4b:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803d4e:	48 b8 42 4d 80 00 00 	movabs $0x804d42,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+  803d5a:	41 89 c1             	mov    %eax,%r9d
+  803d5d:	4d 89 e0             	mov    %r12,%r8
+  803d60:	49 29 d8             	sub    %rbx,%r8
+  803d63:	48 89 d9             	mov    %rbx,%rcx
+  803d66:	44 89 ea             	mov    %r13d,%edx
+  803d69:	48 89 de             	mov    %rbx,%rsi
+  803d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d71:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  803d78:	00 00 00 
+  803d7b:	ff d0                	call   *%rax
+}
+  803d7d:	48 83 c4 08          	add    $0x8,%rsp
+  803d81:	5b                   	pop    %rbx
+  803d82:	41 5c                	pop    %r12
+  803d84:	41 5d                	pop    %r13
+  803d86:	5d                   	pop    %rbp
+  803d87:	c3                   	ret
+
+0000000000803d88 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803d88:	55                   	push   %rbp
+  803d89:	48 89 e5             	mov    %rsp,%rbp
+  803d8c:	41 57                	push   %r15
+  803d8e:	41 56                	push   %r14
+  803d90:	41 55                	push   %r13
+  803d92:	41 54                	push   %r12
+  803d94:	53                   	push   %rbx
+  803d95:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803d9c:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  803d9f:	be 00 00 00 00       	mov    $0x0,%esi
+  803da4:	48 b8 9a 38 80 00 00 	movabs $0x80389a,%rax
+  803dab:	00 00 00 
+  803dae:	ff d0                	call   *%rax
+  803db0:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  803db6:	85 c0                	test   %eax,%eax
+  803db8:	0f 88 8f 06 00 00    	js     80444d <spawn+0x6c5>
+  803dbe:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803dc0:	ba 00 02 00 00       	mov    $0x200,%edx
+  803dc5:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803dcc:	48 b8 4f 29 80 00 00 	movabs $0x80294f,%rax
+  803dd3:	00 00 00 
+  803dd6:	ff d0                	call   *%rax
+  803dd8:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803dda:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803ddf:	0f 85 88 02 00 00    	jne    80406d <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803de5:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803dec:	ff ff 00 
+  803def:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803df6:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803dfd:	01 01 00 
+  803e00:	48 39 d0             	cmp    %rdx,%rax
+  803e03:	0f 85 a0 02 00 00    	jne    8040a9 <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803e09:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803e10:	00 3e 00 
+  803e13:	0f 85 90 02 00 00    	jne    8040a9 <spawn+0x321>
+    flushall();
+  803e19:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  803e20:	00 00 00 
+  803e23:	ff d0                	call   *%rax
+  803e25:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803e2a:	cd 30                	int    $0x30
+  803e2c:	41 89 c7             	mov    %eax,%r15d
+  803e2f:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	0f 88 f2 05 00 00    	js     80442f <spawn+0x6a7>
+    envid_t child = res;
+  803e3d:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803e43:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e48:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  803e4f:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803e56:	00 00 00 
+  803e59:	48 01 c6             	add    %rax,%rsi
+  803e5c:	48 8b 06             	mov    (%rsi),%rax
+  803e5f:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803e66:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803e6d:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803e74:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803e7b:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803e82:	48 29 ce             	sub    %rcx,%rsi
+  803e85:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803e8b:	c1 e9 03             	shr    $0x3,%ecx
+  803e8e:	89 c9                	mov    %ecx,%ecx
+  803e90:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803e93:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803e9a:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803ea1:	48 8b 3b             	mov    (%rbx),%rdi
+  803ea4:	48 85 ff             	test   %rdi,%rdi
+  803ea7:	0f 84 b8 05 00 00    	je     804465 <spawn+0x6dd>
+  803ead:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803eb3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803eb9:	49 be 5e 12 80 00 00 	movabs $0x80125e,%r14
+  803ec0:	00 00 00 
+  803ec3:	41 ff d6             	call   *%r14
+  803ec6:	4c 01 e8             	add    %r13,%rax
+  803ec9:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803ecd:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  803ed4:	49 83 c4 01          	add    $0x1,%r12
+  803ed8:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  803edd:	48 85 ff             	test   %rdi,%rdi
+  803ee0:	75 e1                	jne    803ec3 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803ee2:	48 f7 d0             	not    %rax
+  803ee5:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803eec:	4d 89 e6             	mov    %r12,%r14
+  803eef:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  803ef3:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  803efa:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  803f01:	44 89 e8             	mov    %r13d,%eax
+  803f04:	83 c0 01             	add    $0x1,%eax
+  803f07:	48 98                	cltq
+  803f09:	48 c1 e0 03          	shl    $0x3,%rax
+  803f0d:	49 29 c6             	sub    %rax,%r14
+  803f10:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803f17:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  803f1b:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803f21:	0f 86 eb 04 00 00    	jbe    804412 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803f27:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803f2c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803f31:	be 00 00 40 00       	mov    $0x400000,%esi
+  803f36:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	0f 88 cd 04 00 00    	js     804417 <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  803f4a:	4c 89 e8             	mov    %r13,%rax
+  803f4d:	45 85 ed             	test   %r13d,%r13d
+  803f50:	7e 52                	jle    803fa4 <spawn+0x21c>
+  803f52:	4d 89 f5             	mov    %r14,%r13
+  803f55:	48 98                	cltq
+  803f57:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803f5b:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803f62:	00 00 00 
+  803f65:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803f6c:	ff 
+  803f6d:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803f71:	48 8b 33             	mov    (%rbx),%rsi
+  803f74:	4c 89 e7             	mov    %r12,%rdi
+  803f77:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  803f7e:	00 00 00 
+  803f81:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803f83:	48 8b 3b             	mov    (%rbx),%rdi
+  803f86:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  803f8d:	00 00 00 
+  803f90:	ff d0                	call   *%rax
+  803f92:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803f97:	49 83 c5 08          	add    $0x8,%r13
+  803f9b:	48 83 c3 08          	add    $0x8,%rbx
+  803f9f:	4d 39 f5             	cmp    %r14,%r13
+  803fa2:	75 b7                	jne    803f5b <spawn+0x1d3>
+    argv_store[argc] = 0;
+  803fa4:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803fab:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803fb2:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803fb3:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803fba:	0f 85 30 01 00 00    	jne    8040f0 <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803fc0:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803fc7:	00 00 00 
+  803fca:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803fd1:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803fd8:	ff 
+  803fd9:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803fdd:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803fe4:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803fe8:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803fef:	00 00 00 
+  803ff2:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803ff9:	ff 
+  803ffa:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  804001:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804007:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  80400d:	44 89 fa             	mov    %r15d,%edx
+  804010:	be 00 00 40 00       	mov    $0x400000,%esi
+  804015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80401a:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  804021:	00 00 00 
+  804024:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  804026:	48 bb db 1b 80 00 00 	movabs $0x801bdb,%rbx
+  80402d:	00 00 00 
+  804030:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804035:	be 00 00 40 00       	mov    $0x400000,%esi
+  80403a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403f:	ff d3                	call   *%rbx
+  804041:	85 c0                	test   %eax,%eax
+  804043:	78 eb                	js     804030 <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804045:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  80404c:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  804053:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804054:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  80405b:	00 
+  80405c:	0f 84 a1 02 00 00    	je     804303 <spawn+0x57b>
+  804062:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804068:	e9 dd 00 00 00       	jmp    80414a <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  80406d:	48 bf 20 68 80 00 00 	movabs $0x806820,%rdi
+  804074:	00 00 00 
+  804077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407c:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  804083:	00 00 00 
+  804086:	ff d2                	call   *%rdx
+        close(fd);
+  804088:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  80408e:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80409a:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  8040a1:	ff ff ff 
+  8040a4:	e9 a4 03 00 00       	jmp    80444d <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8040a9:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8040ae:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8040b4:	48 bf 80 68 80 00 00 	movabs $0x806880,%rdi
+  8040bb:	00 00 00 
+  8040be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c3:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  8040ca:	00 00 00 
+  8040cd:	ff d1                	call   *%rcx
+        close(fd);
+  8040cf:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  8040d5:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8040e1:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  8040e8:	ff ff ff 
+  8040eb:	e9 5d 03 00 00       	jmp    80444d <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8040f0:	48 b9 50 68 80 00 00 	movabs $0x806850,%rcx
+  8040f7:	00 00 00 
+  8040fa:	48 ba 9a 68 80 00 00 	movabs $0x80689a,%rdx
+  804101:	00 00 00 
+  804104:	be f3 00 00 00       	mov    $0xf3,%esi
+  804109:	48 bf af 68 80 00 00 	movabs $0x8068af,%rdi
+  804110:	00 00 00 
+  804113:	b8 00 00 00 00       	mov    $0x0,%eax
+  804118:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80411f:	00 00 00 
+  804122:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804125:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  80412c:	0f 88 eb 02 00 00    	js     80441d <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804132:	49 83 c7 01          	add    $0x1,%r15
+  804136:	48 83 c3 38          	add    $0x38,%rbx
+  80413a:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  804141:	49 39 c7             	cmp    %rax,%r15
+  804144:	0f 83 b9 01 00 00    	jae    804303 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  80414a:	83 3b 01             	cmpl   $0x1,(%rbx)
+  80414d:	75 e3                	jne    804132 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80414f:	8b 43 04             	mov    0x4(%rbx),%eax
+  804152:	41 89 c4             	mov    %eax,%r12d
+  804155:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804159:	44 89 e2             	mov    %r12d,%edx
+  80415c:	83 ca 04             	or     $0x4,%edx
+  80415f:	a8 04                	test   $0x4,%al
+  804161:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  804165:	44 89 e2             	mov    %r12d,%edx
+  804168:	83 ca 01             	or     $0x1,%edx
+  80416b:	a8 01                	test   $0x1,%al
+  80416d:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804171:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  804175:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  80417b:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  80417f:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  804183:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  804187:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  80418e:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  804194:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  80419a:	89 f2                	mov    %esi,%edx
+  80419c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8041a2:	74 1b                	je     8041bf <spawn+0x437>
+        va -= res;
+  8041a4:	48 63 ca             	movslq %edx,%rcx
+  8041a7:	48 29 ce             	sub    %rcx,%rsi
+  8041aa:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  8041b1:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  8041b4:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  8041b7:	29 d0                	sub    %edx,%eax
+  8041b9:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  8041bf:	b8 00 00 20 00       	mov    $0x200000,%eax
+  8041c4:	49 39 c6             	cmp    %rax,%r14
+  8041c7:	49 0f 46 c6          	cmovbe %r14,%rax
+  8041cb:	4c 39 e8             	cmp    %r13,%rax
+  8041ce:	0f 82 32 02 00 00    	jb     804406 <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  8041d4:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  8041db:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  8041e2:	00 
+  8041e3:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8041ea:	44 89 e1             	mov    %r12d,%ecx
+  8041ed:	4c 89 f2             	mov    %r14,%rdx
+  8041f0:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  8041f6:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8041fd:	00 00 00 
+  804200:	ff d0                	call   *%rax
+  804202:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  804208:	4d 39 f5             	cmp    %r14,%r13
+  80420b:	73 08                	jae    804215 <spawn+0x48d>
+  80420d:	85 c0                	test   %eax,%eax
+  80420f:	0f 85 10 ff ff ff    	jne    804125 <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  804215:	4d 85 ed             	test   %r13,%r13
+  804218:	0f 84 14 ff ff ff    	je     804132 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  80421e:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  804225:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80422b:	49 89 c6             	mov    %rax,%r14
+  80422e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804233:	48 89 c2             	mov    %rax,%rdx
+  804236:	be 00 00 40 00       	mov    $0x400000,%esi
+  80423b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804240:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  804247:	00 00 00 
+  80424a:	ff d0                	call   *%rax
+  80424c:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804252:	85 c0                	test   %eax,%eax
+  804254:	0f 85 cb fe ff ff    	jne    804125 <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  80425a:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  804260:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804266:	48 b8 79 2a 80 00 00 	movabs $0x802a79,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+  804272:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804278:	85 c0                	test   %eax,%eax
+  80427a:	0f 85 a5 fe ff ff    	jne    804125 <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  804280:	4c 89 ea             	mov    %r13,%rdx
+  804283:	be 00 00 40 00       	mov    $0x400000,%esi
+  804288:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  80428e:	48 b8 4f 29 80 00 00 	movabs $0x80294f,%rax
+  804295:	00 00 00 
+  804298:	ff d0                	call   *%rax
+  80429a:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  8042a0:	85 c0                	test   %eax,%eax
+  8042a2:	0f 88 75 01 00 00    	js     80441d <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  8042a8:	45 89 e1             	mov    %r12d,%r9d
+  8042ab:	4d 89 f0             	mov    %r14,%r8
+  8042ae:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  8042b5:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  8042bb:	be 00 00 40 00       	mov    $0x400000,%esi
+  8042c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042c5:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  8042cc:	00 00 00 
+  8042cf:	ff d0                	call   *%rax
+  8042d1:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  8042d7:	85 c0                	test   %eax,%eax
+  8042d9:	0f 85 46 fe ff ff    	jne    804125 <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  8042df:	4c 89 f2             	mov    %r14,%rdx
+  8042e2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8042e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ec:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  8042f3:	00 00 00 
+  8042f6:	ff d0                	call   *%rax
+  8042f8:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  8042fe:	e9 22 fe ff ff       	jmp    804125 <spawn+0x39d>
+    close(fd);
+  804303:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804309:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  804315:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80431c:	48 bf 38 3d 80 00 00 	movabs $0x803d38,%rdi
+  804323:	00 00 00 
+  804326:	48 b8 b6 4d 80 00 00 	movabs $0x804db6,%rax
+  80432d:	00 00 00 
+  804330:	ff d0                	call   *%rax
+  804332:	85 c0                	test   %eax,%eax
+  804334:	78 49                	js     80437f <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804336:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80433d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804343:	48 b8 ab 1c 80 00 00 	movabs $0x801cab,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	78 59                	js     8043ac <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804353:	be 02 00 00 00       	mov    $0x2,%esi
+  804358:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80435e:	48 b8 42 1c 80 00 00 	movabs $0x801c42,%rax
+  804365:	00 00 00 
+  804368:	ff d0                	call   *%rax
+  80436a:	85 c0                	test   %eax,%eax
+  80436c:	78 6b                	js     8043d9 <spawn+0x651>
+    return child;
+  80436e:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804374:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  80437a:	e9 ce 00 00 00       	jmp    80444d <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  80437f:	89 c1                	mov    %eax,%ecx
+  804381:	48 ba bb 68 80 00 00 	movabs $0x8068bb,%rdx
+  804388:	00 00 00 
+  80438b:	be 87 00 00 00       	mov    $0x87,%esi
+  804390:	48 bf af 68 80 00 00 	movabs $0x8068af,%rdi
+  804397:	00 00 00 
+  80439a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439f:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8043a6:	00 00 00 
+  8043a9:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8043ac:	89 c1                	mov    %eax,%ecx
+  8043ae:	48 ba d2 68 80 00 00 	movabs $0x8068d2,%rdx
+  8043b5:	00 00 00 
+  8043b8:	be 8a 00 00 00       	mov    $0x8a,%esi
+  8043bd:	48 bf af 68 80 00 00 	movabs $0x8068af,%rdi
+  8043c4:	00 00 00 
+  8043c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043cc:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8043d3:	00 00 00 
+  8043d6:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8043d9:	89 c1                	mov    %eax,%ecx
+  8043db:	48 ba ec 68 80 00 00 	movabs $0x8068ec,%rdx
+  8043e2:	00 00 00 
+  8043e5:	be 8d 00 00 00       	mov    $0x8d,%esi
+  8043ea:	48 bf af 68 80 00 00 	movabs $0x8068af,%rdi
+  8043f1:	00 00 00 
+  8043f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f9:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  804400:	00 00 00 
+  804403:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  804406:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  80440d:	ff ff ff 
+  804410:	eb 0b                	jmp    80441d <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804412:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804417:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  80441d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804423:	48 b8 d1 18 80 00 00 	movabs $0x8018d1,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+    close(fd);
+  80442f:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804435:	48 b8 13 27 80 00 00 	movabs $0x802713,%rax
+  80443c:	00 00 00 
+  80443f:	ff d0                	call   *%rax
+    return res;
+  804441:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  804447:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  80444d:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  804453:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  80445a:	5b                   	pop    %rbx
+  80445b:	41 5c                	pop    %r12
+  80445d:	41 5d                	pop    %r13
+  80445f:	41 5e                	pop    %r14
+  804461:	41 5f                	pop    %r15
+  804463:	5d                   	pop    %rbp
+  804464:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804465:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80446a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80446f:	be 00 00 40 00       	mov    $0x400000,%esi
+  804474:	bf 00 00 00 00       	mov    $0x0,%edi
+  804479:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+  804485:	85 c0                	test   %eax,%eax
+  804487:	78 8e                	js     804417 <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804489:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804490:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804494:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  80449b:	f8 ff 40 00 
+  80449f:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  8044a6:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8044aa:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  8044b0:	e9 ef fa ff ff       	jmp    803fa4 <spawn+0x21c>
+
+00000000008044b5 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8044b5:	55                   	push   %rbp
+  8044b6:	48 89 e5             	mov    %rsp,%rbp
+  8044b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8044bd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8044c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8044c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8044cd:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8044e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8044e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8044e9:	eb 15                	jmp    804500 <spawnl+0x4b>
+  8044eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8044f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044f7:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8044fb:	74 1c                	je     804519 <spawnl+0x64>
+  8044fd:	83 c1 01             	add    $0x1,%ecx
+  804500:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804503:	83 f8 2f             	cmp    $0x2f,%eax
+  804506:	77 e3                	ja     8044eb <spawnl+0x36>
+  804508:	89 c2                	mov    %eax,%edx
+  80450a:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80450e:	4c 01 d2             	add    %r10,%rdx
+  804511:	83 c0 08             	add    $0x8,%eax
+  804514:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804517:	eb de                	jmp    8044f7 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804519:	8d 41 02             	lea    0x2(%rcx),%eax
+  80451c:	48 98                	cltq
+  80451e:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804525:	00 
+  804526:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  80452a:	48 29 c4             	sub    %rax,%rsp
+  80452d:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804532:	4c 89 c0             	mov    %r8,%rax
+  804535:	48 c1 e8 03          	shr    $0x3,%rax
+  804539:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80453d:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804544:	00 
+    argv[argc + 1] = NULL;
+  804545:	8d 41 01             	lea    0x1(%rcx),%eax
+  804548:	48 98                	cltq
+  80454a:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804551:	00 
+    va_start(vl, arg0);
+  804552:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804559:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80455d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804561:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804565:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804569:	85 c9                	test   %ecx,%ecx
+  80456b:	74 41                	je     8045ae <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80456d:	49 89 c1             	mov    %rax,%r9
+  804570:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804574:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804577:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80457c:	eb 1b                	jmp    804599 <spawnl+0xe4>
+  80457e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804582:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804586:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80458a:	48 8b 11             	mov    (%rcx),%rdx
+  80458d:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804590:	48 83 c0 08          	add    $0x8,%rax
+  804594:	48 39 f0             	cmp    %rsi,%rax
+  804597:	74 15                	je     8045ae <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804599:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80459c:	83 fa 2f             	cmp    $0x2f,%edx
+  80459f:	77 dd                	ja     80457e <spawnl+0xc9>
+  8045a1:	89 d1                	mov    %edx,%ecx
+  8045a3:	4c 01 c9             	add    %r9,%rcx
+  8045a6:	83 c2 08             	add    $0x8,%edx
+  8045a9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8045ac:	eb dc                	jmp    80458a <spawnl+0xd5>
+    return spawn(prog, argv);
+  8045ae:	4c 89 c6             	mov    %r8,%rsi
+  8045b1:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  8045b8:	00 00 00 
+  8045bb:	ff d0                	call   *%rax
+}
+  8045bd:	c9                   	leave
+  8045be:	c3                   	ret
+
+00000000008045bf <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8045bf:	55                   	push   %rbp
+  8045c0:	48 89 e5             	mov    %rsp,%rbp
+  8045c3:	41 54                	push   %r12
+  8045c5:	53                   	push   %rbx
+  8045c6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8045c9:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  8045d0:	00 00 00 
+  8045d3:	ff d0                	call   *%rax
+  8045d5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8045d8:	48 be 03 69 80 00 00 	movabs $0x806903,%rsi
+  8045df:	00 00 00 
+  8045e2:	48 89 df             	mov    %rbx,%rdi
+  8045e5:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8045ec:	00 00 00 
+  8045ef:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8045f1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8045f6:	41 2b 04 24          	sub    (%r12),%eax
+  8045fa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804600:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804607:	00 00 00 
+    stat->st_dev = &devpipe;
+  80460a:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804611:	00 00 00 
+  804614:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80461b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804620:	5b                   	pop    %rbx
+  804621:	41 5c                	pop    %r12
+  804623:	5d                   	pop    %rbp
+  804624:	c3                   	ret
+
+0000000000804625 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804625:	55                   	push   %rbp
+  804626:	48 89 e5             	mov    %rsp,%rbp
+  804629:	41 54                	push   %r12
+  80462b:	53                   	push   %rbx
+  80462c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80462f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804634:	48 89 fe             	mov    %rdi,%rsi
+  804637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80463c:	49 bc db 1b 80 00 00 	movabs $0x801bdb,%r12
+  804643:	00 00 00 
+  804646:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804649:	48 89 df             	mov    %rbx,%rdi
+  80464c:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+  804658:	48 89 c6             	mov    %rax,%rsi
+  80465b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804660:	bf 00 00 00 00       	mov    $0x0,%edi
+  804665:	41 ff d4             	call   *%r12
+}
+  804668:	5b                   	pop    %rbx
+  804669:	41 5c                	pop    %r12
+  80466b:	5d                   	pop    %rbp
+  80466c:	c3                   	ret
+
+000000000080466d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80466d:	55                   	push   %rbp
+  80466e:	48 89 e5             	mov    %rsp,%rbp
+  804671:	41 57                	push   %r15
+  804673:	41 56                	push   %r14
+  804675:	41 55                	push   %r13
+  804677:	41 54                	push   %r12
+  804679:	53                   	push   %rbx
+  80467a:	48 83 ec 18          	sub    $0x18,%rsp
+  80467e:	49 89 fc             	mov    %rdi,%r12
+  804681:	49 89 f5             	mov    %rsi,%r13
+  804684:	49 89 d7             	mov    %rdx,%r15
+  804687:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80468b:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  804692:	00 00 00 
+  804695:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804697:	4d 85 ff             	test   %r15,%r15
+  80469a:	0f 84 af 00 00 00    	je     80474f <devpipe_write+0xe2>
+  8046a0:	48 89 c3             	mov    %rax,%rbx
+  8046a3:	4c 89 f8             	mov    %r15,%rax
+  8046a6:	4d 89 ef             	mov    %r13,%r15
+  8046a9:	4c 01 e8             	add    %r13,%rax
+  8046ac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046b0:	49 bd d0 19 80 00 00 	movabs $0x8019d0,%r13
+  8046b7:	00 00 00 
+            sys_yield();
+  8046ba:	49 be 6d 19 80 00 00 	movabs $0x80196d,%r14
+  8046c1:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8046c4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8046c7:	48 63 ce             	movslq %esi,%rcx
+  8046ca:	48 63 03             	movslq (%rbx),%rax
+  8046cd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8046d3:	48 39 c1             	cmp    %rax,%rcx
+  8046d6:	72 2e                	jb     804706 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046d8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046dd:	48 89 da             	mov    %rbx,%rdx
+  8046e0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046e5:	4c 89 e7             	mov    %r12,%rdi
+  8046e8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8046eb:	85 c0                	test   %eax,%eax
+  8046ed:	74 66                	je     804755 <devpipe_write+0xe8>
+            sys_yield();
+  8046ef:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8046f2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8046f5:	48 63 ce             	movslq %esi,%rcx
+  8046f8:	48 63 03             	movslq (%rbx),%rax
+  8046fb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804701:	48 39 c1             	cmp    %rax,%rcx
+  804704:	73 d2                	jae    8046d8 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804706:	41 0f b6 3f          	movzbl (%r15),%edi
+  80470a:	48 89 ca             	mov    %rcx,%rdx
+  80470d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804711:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804718:	08 10 20 
+  80471b:	48 f7 e2             	mul    %rdx
+  80471e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804722:	48 89 d0             	mov    %rdx,%rax
+  804725:	48 c1 e0 09          	shl    $0x9,%rax
+  804729:	48 29 d0             	sub    %rdx,%rax
+  80472c:	48 c1 e0 03          	shl    $0x3,%rax
+  804730:	48 29 c1             	sub    %rax,%rcx
+  804733:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804738:	83 c6 01             	add    $0x1,%esi
+  80473b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80473e:	49 83 c7 01          	add    $0x1,%r15
+  804742:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804746:	49 39 c7             	cmp    %rax,%r15
+  804749:	0f 85 75 ff ff ff    	jne    8046c4 <devpipe_write+0x57>
+    return n;
+  80474f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804753:	eb 05                	jmp    80475a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80475a:	48 83 c4 18          	add    $0x18,%rsp
+  80475e:	5b                   	pop    %rbx
+  80475f:	41 5c                	pop    %r12
+  804761:	41 5d                	pop    %r13
+  804763:	41 5e                	pop    %r14
+  804765:	41 5f                	pop    %r15
+  804767:	5d                   	pop    %rbp
+  804768:	c3                   	ret
+
+0000000000804769 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804769:	55                   	push   %rbp
+  80476a:	48 89 e5             	mov    %rsp,%rbp
+  80476d:	41 57                	push   %r15
+  80476f:	41 56                	push   %r14
+  804771:	41 55                	push   %r13
+  804773:	41 54                	push   %r12
+  804775:	53                   	push   %rbx
+  804776:	48 83 ec 18          	sub    $0x18,%rsp
+  80477a:	49 89 fc             	mov    %rdi,%r12
+  80477d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804781:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804785:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  80478c:	00 00 00 
+  80478f:	ff d0                	call   *%rax
+  804791:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804794:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80479a:	49 bd d0 19 80 00 00 	movabs $0x8019d0,%r13
+  8047a1:	00 00 00 
+            sys_yield();
+  8047a4:	49 be 6d 19 80 00 00 	movabs $0x80196d,%r14
+  8047ab:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8047ae:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8047b3:	74 7d                	je     804832 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8047b5:	8b 03                	mov    (%rbx),%eax
+  8047b7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8047ba:	75 26                	jne    8047e2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8047bc:	4d 85 ff             	test   %r15,%r15
+  8047bf:	75 77                	jne    804838 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047c1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8047c6:	48 89 da             	mov    %rbx,%rdx
+  8047c9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047ce:	4c 89 e7             	mov    %r12,%rdi
+  8047d1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8047d4:	85 c0                	test   %eax,%eax
+  8047d6:	74 72                	je     80484a <devpipe_read+0xe1>
+            sys_yield();
+  8047d8:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8047db:	8b 03                	mov    (%rbx),%eax
+  8047dd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8047e0:	74 df                	je     8047c1 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8047e2:	48 63 c8             	movslq %eax,%rcx
+  8047e5:	48 89 ca             	mov    %rcx,%rdx
+  8047e8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8047ec:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8047f3:	08 10 20 
+  8047f6:	48 89 d0             	mov    %rdx,%rax
+  8047f9:	48 f7 e6             	mul    %rsi
+  8047fc:	48 c1 ea 06          	shr    $0x6,%rdx
+  804800:	48 89 d0             	mov    %rdx,%rax
+  804803:	48 c1 e0 09          	shl    $0x9,%rax
+  804807:	48 29 d0             	sub    %rdx,%rax
+  80480a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804811:	00 
+  804812:	48 89 c8             	mov    %rcx,%rax
+  804815:	48 29 d0             	sub    %rdx,%rax
+  804818:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80481d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804821:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804825:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804828:	49 83 c7 01          	add    $0x1,%r15
+  80482c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804830:	75 83                	jne    8047b5 <devpipe_read+0x4c>
+    return n;
+  804832:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804836:	eb 03                	jmp    80483b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804838:	4c 89 f8             	mov    %r15,%rax
+}
+  80483b:	48 83 c4 18          	add    $0x18,%rsp
+  80483f:	5b                   	pop    %rbx
+  804840:	41 5c                	pop    %r12
+  804842:	41 5d                	pop    %r13
+  804844:	41 5e                	pop    %r14
+  804846:	41 5f                	pop    %r15
+  804848:	5d                   	pop    %rbp
+  804849:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80484a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484f:	eb ea                	jmp    80483b <devpipe_read+0xd2>
+
+0000000000804851 <pipe>:
+pipe(int pfd[2]) {
+  804851:	55                   	push   %rbp
+  804852:	48 89 e5             	mov    %rsp,%rbp
+  804855:	41 55                	push   %r13
+  804857:	41 54                	push   %r12
+  804859:	53                   	push   %rbx
+  80485a:	48 83 ec 18          	sub    $0x18,%rsp
+  80485e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804861:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804865:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  80486c:	00 00 00 
+  80486f:	ff d0                	call   *%rax
+  804871:	89 c3                	mov    %eax,%ebx
+  804873:	85 c0                	test   %eax,%eax
+  804875:	0f 88 a0 01 00 00    	js     804a1b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80487b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804880:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804885:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804889:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488e:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  804895:	00 00 00 
+  804898:	ff d0                	call   *%rax
+  80489a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80489c:	85 c0                	test   %eax,%eax
+  80489e:	0f 88 77 01 00 00    	js     804a1b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8048a4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8048a8:	48 b8 4e 25 80 00 00 	movabs $0x80254e,%rax
+  8048af:	00 00 00 
+  8048b2:	ff d0                	call   *%rax
+  8048b4:	89 c3                	mov    %eax,%ebx
+  8048b6:	85 c0                	test   %eax,%eax
+  8048b8:	0f 88 43 01 00 00    	js     804a01 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8048be:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048c8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8048cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d1:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8048d8:	00 00 00 
+  8048db:	ff d0                	call   *%rax
+  8048dd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8048df:	85 c0                	test   %eax,%eax
+  8048e1:	0f 88 1a 01 00 00    	js     804a01 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8048e7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8048eb:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  8048f2:	00 00 00 
+  8048f5:	ff d0                	call   *%rax
+  8048f7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8048fa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804904:	48 89 c6             	mov    %rax,%rsi
+  804907:	bf 00 00 00 00       	mov    $0x0,%edi
+  80490c:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  804913:	00 00 00 
+  804916:	ff d0                	call   *%rax
+  804918:	89 c3                	mov    %eax,%ebx
+  80491a:	85 c0                	test   %eax,%eax
+  80491c:	0f 88 c5 00 00 00    	js     8049e7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804922:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804926:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  80492d:	00 00 00 
+  804930:	ff d0                	call   *%rax
+  804932:	48 89 c1             	mov    %rax,%rcx
+  804935:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80493b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804941:	ba 00 00 00 00       	mov    $0x0,%edx
+  804946:	4c 89 ee             	mov    %r13,%rsi
+  804949:	bf 00 00 00 00       	mov    $0x0,%edi
+  80494e:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  804955:	00 00 00 
+  804958:	ff d0                	call   *%rax
+  80495a:	89 c3                	mov    %eax,%ebx
+  80495c:	85 c0                	test   %eax,%eax
+  80495e:	78 6e                	js     8049ce <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804960:	be 00 10 00 00       	mov    $0x1000,%esi
+  804965:	4c 89 ef             	mov    %r13,%rdi
+  804968:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  80496f:	00 00 00 
+  804972:	ff d0                	call   *%rax
+  804974:	83 f8 02             	cmp    $0x2,%eax
+  804977:	0f 85 ab 00 00 00    	jne    804a28 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80497d:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  804984:	00 00 
+  804986:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80498a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80498c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804990:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804997:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80499b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80499d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049a1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8049a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8049ac:	48 bb 20 25 80 00 00 	movabs $0x802520,%rbx
+  8049b3:	00 00 00 
+  8049b6:	ff d3                	call   *%rbx
+  8049b8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8049bc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8049c0:	ff d3                	call   *%rbx
+  8049c2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8049c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049cc:	eb 4d                	jmp    804a1b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8049ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049d3:	4c 89 ee             	mov    %r13,%rsi
+  8049d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049db:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  8049e2:	00 00 00 
+  8049e5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8049e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049ec:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8049f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049f5:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  8049fc:	00 00 00 
+  8049ff:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804a01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a06:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804a0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a0f:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  804a16:	00 00 00 
+  804a19:	ff d0                	call   *%rax
+}
+  804a1b:	89 d8                	mov    %ebx,%eax
+  804a1d:	48 83 c4 18          	add    $0x18,%rsp
+  804a21:	5b                   	pop    %rbx
+  804a22:	41 5c                	pop    %r12
+  804a24:	41 5d                	pop    %r13
+  804a26:	5d                   	pop    %rbp
+  804a27:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804a28:	48 b9 20 69 80 00 00 	movabs $0x806920,%rcx
+  804a2f:	00 00 00 
+  804a32:	48 ba 9a 68 80 00 00 	movabs $0x80689a,%rdx
+  804a39:	00 00 00 
+  804a3c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804a41:	48 bf 0a 69 80 00 00 	movabs $0x80690a,%rdi
+  804a48:	00 00 00 
+  804a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a50:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  804a57:	00 00 00 
+  804a5a:	41 ff d0             	call   *%r8
+
+0000000000804a5d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804a5d:	55                   	push   %rbp
+  804a5e:	48 89 e5             	mov    %rsp,%rbp
+  804a61:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804a65:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804a69:	48 b8 ae 25 80 00 00 	movabs $0x8025ae,%rax
+  804a70:	00 00 00 
+  804a73:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804a75:	85 c0                	test   %eax,%eax
+  804a77:	78 35                	js     804aae <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804a79:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a7d:	48 b8 32 25 80 00 00 	movabs $0x802532,%rax
+  804a84:	00 00 00 
+  804a87:	ff d0                	call   *%rax
+  804a89:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a8c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a91:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a96:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a9a:	48 b8 d0 19 80 00 00 	movabs $0x8019d0,%rax
+  804aa1:	00 00 00 
+  804aa4:	ff d0                	call   *%rax
+  804aa6:	85 c0                	test   %eax,%eax
+  804aa8:	0f 94 c0             	sete   %al
+  804aab:	0f b6 c0             	movzbl %al,%eax
+}
+  804aae:	c9                   	leave
+  804aaf:	c3                   	ret
+
+0000000000804ab0 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804ab0:	55                   	push   %rbp
+  804ab1:	48 89 e5             	mov    %rsp,%rbp
+  804ab4:	41 55                	push   %r13
+  804ab6:	41 54                	push   %r12
+  804ab8:	53                   	push   %rbx
+  804ab9:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  804abd:	85 ff                	test   %edi,%edi
+  804abf:	74 73                	je     804b34 <wait+0x84>
+  804ac1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804ac4:	89 f8                	mov    %edi,%eax
+  804ac6:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  804acb:	89 f9                	mov    %edi,%ecx
+  804acd:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804ad3:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  804ada:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ae1:	00 00 00 
+  804ae4:	48 01 ca             	add    %rcx,%rdx
+  804ae7:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804aed:	39 d7                	cmp    %edx,%edi
+  804aef:	75 38                	jne    804b29 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804af1:	48 98                	cltq
+  804af3:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804afa:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804b01:	00 00 00 
+  804b04:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804b07:	49 bd 6d 19 80 00 00 	movabs $0x80196d,%r13
+  804b0e:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804b11:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804b17:	85 c0                	test   %eax,%eax
+  804b19:	74 0e                	je     804b29 <wait+0x79>
+        sys_yield();
+  804b1b:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804b1e:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804b24:	44 39 e0             	cmp    %r12d,%eax
+  804b27:	74 e8                	je     804b11 <wait+0x61>
+    }
+}
+  804b29:	48 83 c4 08          	add    $0x8,%rsp
+  804b2d:	5b                   	pop    %rbx
+  804b2e:	41 5c                	pop    %r12
+  804b30:	41 5d                	pop    %r13
+  804b32:	5d                   	pop    %rbp
+  804b33:	c3                   	ret
+    assert(envid != 0);
+  804b34:	48 b9 44 69 80 00 00 	movabs $0x806944,%rcx
+  804b3b:	00 00 00 
+  804b3e:	48 ba 9a 68 80 00 00 	movabs $0x80689a,%rdx
+  804b45:	00 00 00 
+  804b48:	be 06 00 00 00       	mov    $0x6,%esi
+  804b4d:	48 bf 4f 69 80 00 00 	movabs $0x80694f,%rdi
+  804b54:	00 00 00 
+  804b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5c:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  804b63:	00 00 00 
+  804b66:	41 ff d0             	call   *%r8
+
+0000000000804b69 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b69:	48 89 f8             	mov    %rdi,%rax
+  804b6c:	48 c1 e8 27          	shr    $0x27,%rax
+  804b70:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804b77:	7f 00 00 
+  804b7a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b7e:	f6 c2 01             	test   $0x1,%dl
+  804b81:	74 6d                	je     804bf0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b83:	48 89 f8             	mov    %rdi,%rax
+  804b86:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b8a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804b91:	7f 00 00 
+  804b94:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b98:	f6 c2 01             	test   $0x1,%dl
+  804b9b:	74 62                	je     804bff <get_uvpt_entry+0x96>
+  804b9d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804ba4:	7f 00 00 
+  804ba7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bab:	f6 c2 80             	test   $0x80,%dl
+  804bae:	75 4f                	jne    804bff <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804bb0:	48 89 f8             	mov    %rdi,%rax
+  804bb3:	48 c1 e8 15          	shr    $0x15,%rax
+  804bb7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804bbe:	7f 00 00 
+  804bc1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bc5:	f6 c2 01             	test   $0x1,%dl
+  804bc8:	74 44                	je     804c0e <get_uvpt_entry+0xa5>
+  804bca:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804bd1:	7f 00 00 
+  804bd4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bd8:	f6 c2 80             	test   $0x80,%dl
+  804bdb:	75 31                	jne    804c0e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804bdd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804be1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804be8:	7f 00 00 
+  804beb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804bef:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804bf0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804bf7:	7f 00 00 
+  804bfa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bfe:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804bff:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804c06:	7f 00 00 
+  804c09:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c0d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804c0e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804c15:	7f 00 00 
+  804c18:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c1c:	c3                   	ret
+
+0000000000804c1d <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804c1d:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804c20:	48 89 f9             	mov    %rdi,%rcx
+  804c23:	48 c1 e9 27          	shr    $0x27,%rcx
+  804c27:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804c2e:	7f 00 00 
+  804c31:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804c35:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804c3c:	f6 c1 01             	test   $0x1,%cl
+  804c3f:	0f 84 b2 00 00 00    	je     804cf7 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804c45:	48 89 f9             	mov    %rdi,%rcx
+  804c48:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804c4c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804c53:	7f 00 00 
+  804c56:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804c5a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804c61:	40 f6 c6 01          	test   $0x1,%sil
+  804c65:	0f 84 8c 00 00 00    	je     804cf7 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804c6b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804c72:	7f 00 00 
+  804c75:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804c79:	a8 80                	test   $0x80,%al
+  804c7b:	75 7b                	jne    804cf8 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804c7d:	48 89 f9             	mov    %rdi,%rcx
+  804c80:	48 c1 e9 15          	shr    $0x15,%rcx
+  804c84:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804c8b:	7f 00 00 
+  804c8e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804c92:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804c99:	40 f6 c6 01          	test   $0x1,%sil
+  804c9d:	74 58                	je     804cf7 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804c9f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804ca6:	7f 00 00 
+  804ca9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804cad:	a8 80                	test   $0x80,%al
+  804caf:	75 6c                	jne    804d1d <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804cb1:	48 89 f9             	mov    %rdi,%rcx
+  804cb4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804cb8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804cbf:	7f 00 00 
+  804cc2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804cc6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804ccd:	40 f6 c6 01          	test   $0x1,%sil
+  804cd1:	74 24                	je     804cf7 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804cd3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804cda:	7f 00 00 
+  804cdd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804ce1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804ce8:	ff ff 7f 
+  804ceb:	48 21 c8             	and    %rcx,%rax
+  804cee:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804cf4:	48 09 d0             	or     %rdx,%rax
+}
+  804cf7:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804cf8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804cff:	7f 00 00 
+  804d02:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804d06:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804d0d:	ff ff 7f 
+  804d10:	48 21 c8             	and    %rcx,%rax
+  804d13:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804d19:	48 01 d0             	add    %rdx,%rax
+  804d1c:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804d1d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804d24:	7f 00 00 
+  804d27:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804d2b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804d32:	ff ff 7f 
+  804d35:	48 21 c8             	and    %rcx,%rax
+  804d38:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804d3e:	48 01 d0             	add    %rdx,%rax
+  804d41:	c3                   	ret
+
+0000000000804d42 <get_prot>:
+
+int
+get_prot(void *va) {
+  804d42:	55                   	push   %rbp
+  804d43:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d46:	48 b8 69 4b 80 00 00 	movabs $0x804b69,%rax
+  804d4d:	00 00 00 
+  804d50:	ff d0                	call   *%rax
+  804d52:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804d55:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804d5a:	89 c1                	mov    %eax,%ecx
+  804d5c:	83 c9 04             	or     $0x4,%ecx
+  804d5f:	f6 c2 01             	test   $0x1,%dl
+  804d62:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804d65:	89 c1                	mov    %eax,%ecx
+  804d67:	83 c9 02             	or     $0x2,%ecx
+  804d6a:	f6 c2 02             	test   $0x2,%dl
+  804d6d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804d70:	89 c1                	mov    %eax,%ecx
+  804d72:	83 c9 01             	or     $0x1,%ecx
+  804d75:	48 85 d2             	test   %rdx,%rdx
+  804d78:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804d7b:	89 c1                	mov    %eax,%ecx
+  804d7d:	83 c9 40             	or     $0x40,%ecx
+  804d80:	f6 c6 04             	test   $0x4,%dh
+  804d83:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804d86:	5d                   	pop    %rbp
+  804d87:	c3                   	ret
+
+0000000000804d88 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804d88:	55                   	push   %rbp
+  804d89:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d8c:	48 b8 69 4b 80 00 00 	movabs $0x804b69,%rax
+  804d93:	00 00 00 
+  804d96:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804d98:	48 c1 e8 06          	shr    $0x6,%rax
+  804d9c:	83 e0 01             	and    $0x1,%eax
+}
+  804d9f:	5d                   	pop    %rbp
+  804da0:	c3                   	ret
+
+0000000000804da1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804da1:	55                   	push   %rbp
+  804da2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804da5:	48 b8 69 4b 80 00 00 	movabs $0x804b69,%rax
+  804dac:	00 00 00 
+  804daf:	ff d0                	call   *%rax
+  804db1:	83 e0 01             	and    $0x1,%eax
+}
+  804db4:	5d                   	pop    %rbp
+  804db5:	c3                   	ret
+
+0000000000804db6 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804db6:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804dbd:	7f 00 00 
+  804dc0:	a8 01                	test   $0x1,%al
+  804dc2:	75 06                	jne    804dca <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804dca:	55                   	push   %rbp
+  804dcb:	48 89 e5             	mov    %rsp,%rbp
+  804dce:	41 57                	push   %r15
+  804dd0:	41 56                	push   %r14
+  804dd2:	41 55                	push   %r13
+  804dd4:	41 54                	push   %r12
+  804dd6:	53                   	push   %rbx
+  804dd7:	48 83 ec 18          	sub    $0x18,%rsp
+  804ddb:	49 89 fe             	mov    %rdi,%r14
+  804dde:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804de1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804de8:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804de9:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804df0:	7f 00 00 
+  804df3:	e9 81 00 00 00       	jmp    804e79 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804df8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804dff:	49 39 dd             	cmp    %rbx,%r13
+  804e02:	74 2b                	je     804e2f <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804e04:	48 89 d8             	mov    %rbx,%rax
+  804e07:	48 c1 e8 0c          	shr    $0xc,%rax
+  804e0b:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804e0f:	f6 c2 01             	test   $0x1,%dl
+  804e12:	74 e4                	je     804df8 <foreach_shared_region+0x42>
+  804e14:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804e18:	f6 c4 04             	test   $0x4,%ah
+  804e1b:	74 db                	je     804df8 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804e1d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804e24:	4c 89 fa             	mov    %r15,%rdx
+  804e27:	48 89 df             	mov    %rbx,%rdi
+  804e2a:	41 ff d6             	call   *%r14
+  804e2d:	eb c9                	jmp    804df8 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804e2f:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804e36:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804e3a:	74 22                	je     804e5e <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804e3c:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804e43:	48 89 d8             	mov    %rbx,%rax
+  804e46:	48 c1 e8 15          	shr    $0x15,%rax
+  804e4a:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804e51:	7f 00 00 
+  804e54:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e58:	a8 01                	test   $0x1,%al
+  804e5a:	74 d3                	je     804e2f <foreach_shared_region+0x79>
+  804e5c:	eb a6                	jmp    804e04 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804e5e:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804e65:	40 
+  804e66:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804e6a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e71:	00 00 00 
+  804e74:	48 39 c1             	cmp    %rax,%rcx
+  804e77:	74 31                	je     804eaa <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804e79:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e7d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804e81:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804e88:	7f 00 00 
+  804e8b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e8f:	a8 01                	test   $0x1,%al
+  804e91:	74 cb                	je     804e5e <foreach_shared_region+0xa8>
+  804e93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e97:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804e9e:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804ea4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ea8:	eb 92                	jmp    804e3c <foreach_shared_region+0x86>
+}
+  804eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eaf:	48 83 c4 18          	add    $0x18,%rsp
+  804eb3:	5b                   	pop    %rbx
+  804eb4:	41 5c                	pop    %r12
+  804eb6:	41 5d                	pop    %r13
+  804eb8:	41 5e                	pop    %r14
+  804eba:	41 5f                	pop    %r15
+  804ebc:	5d                   	pop    %rbp
+  804ebd:	c3                   	ret
+
+0000000000804ebe <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ebe:	55                   	push   %rbp
+  804ebf:	48 89 e5             	mov    %rsp,%rbp
+  804ec2:	41 55                	push   %r13
+  804ec4:	41 54                	push   %r12
+  804ec6:	53                   	push   %rbx
+  804ec7:	48 83 ec 08          	sub    $0x8,%rsp
+  804ecb:	49 89 fc             	mov    %rdi,%r12
+  804ece:	48 89 f7             	mov    %rsi,%rdi
+  804ed1:	48 89 d3             	mov    %rdx,%rbx
+  804ed4:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804ed7:	48 85 f6             	test   %rsi,%rsi
+  804eda:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ee1:	00 00 00 
+  804ee4:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804ee8:	be 00 10 00 00       	mov    $0x1000,%esi
+  804eed:	48 85 d2             	test   %rdx,%rdx
+  804ef0:	74 03                	je     804ef5 <ipc_recv+0x37>
+  804ef2:	48 8b 32             	mov    (%rdx),%rsi
+  804ef5:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  804efc:	00 00 00 
+  804eff:	ff d0                	call   *%rax
+    if (errno) {
+  804f01:	85 c0                	test   %eax,%eax
+  804f03:	74 1c                	je     804f21 <ipc_recv+0x63>
+        if (from_env_store)
+  804f05:	4d 85 e4             	test   %r12,%r12
+  804f08:	74 08                	je     804f12 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804f0a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804f11:	00 
+
+        if (perm_store)
+  804f12:	4d 85 ed             	test   %r13,%r13
+  804f15:	74 74                	je     804f8b <ipc_recv+0xcd>
+            *perm_store = 0;
+  804f17:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804f1e:	00 
+  804f1f:	eb 6a                	jmp    804f8b <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804f21:	4d 85 e4             	test   %r12,%r12
+  804f24:	74 14                	je     804f3a <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804f26:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  804f2d:	00 00 00 
+  804f30:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804f36:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804f3a:	48 85 db             	test   %rbx,%rbx
+  804f3d:	74 23                	je     804f62 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804f3f:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  804f46:	00 00 00 
+  804f49:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f54:	85 c9                	test   %ecx,%ecx
+  804f56:	74 07                	je     804f5f <ipc_recv+0xa1>
+  804f58:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804f5f:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804f62:	4d 85 ed             	test   %r13,%r13
+  804f65:	74 14                	je     804f7b <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804f67:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  804f6e:	00 00 00 
+  804f71:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804f77:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804f7b:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  804f82:	00 00 00 
+  804f85:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804f8b:	48 83 c4 08          	add    $0x8,%rsp
+  804f8f:	5b                   	pop    %rbx
+  804f90:	41 5c                	pop    %r12
+  804f92:	41 5d                	pop    %r13
+  804f94:	5d                   	pop    %rbp
+  804f95:	c3                   	ret
+
+0000000000804f96 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804f96:	55                   	push   %rbp
+  804f97:	48 89 e5             	mov    %rsp,%rbp
+  804f9a:	41 55                	push   %r13
+  804f9c:	41 54                	push   %r12
+  804f9e:	53                   	push   %rbx
+  804f9f:	48 83 ec 08          	sub    $0x8,%rsp
+  804fa3:	49 89 fc             	mov    %rdi,%r12
+  804fa6:	48 89 f7             	mov    %rsi,%rdi
+  804fa9:	48 89 d3             	mov    %rdx,%rbx
+  804fac:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804faf:	48 85 f6             	test   %rsi,%rsi
+  804fb2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804fb9:	00 00 00 
+  804fbc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804fc0:	be 00 10 00 00       	mov    $0x1000,%esi
+  804fc5:	48 85 d2             	test   %rdx,%rdx
+  804fc8:	74 03                	je     804fcd <ipc_try_recv+0x37>
+  804fca:	48 8b 32             	mov    (%rdx),%rsi
+  804fcd:	48 b8 12 1e 80 00 00 	movabs $0x801e12,%rax
+  804fd4:	00 00 00 
+  804fd7:	ff d0                	call   *%rax
+    if (errno) {
+  804fd9:	85 c0                	test   %eax,%eax
+  804fdb:	75 75                	jne    805052 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804fdd:	4d 85 e4             	test   %r12,%r12
+  804fe0:	74 14                	je     804ff6 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804fe2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  804fe9:	00 00 00 
+  804fec:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804ff2:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804ff6:	48 85 db             	test   %rbx,%rbx
+  804ff9:	74 23                	je     80501e <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804ffb:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  805002:	00 00 00 
+  805005:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80500b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805010:	85 c9                	test   %ecx,%ecx
+  805012:	74 07                	je     80501b <ipc_try_recv+0x85>
+  805014:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80501b:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80501e:	4d 85 ed             	test   %r13,%r13
+  805021:	74 14                	je     805037 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  805023:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80502a:	00 00 00 
+  80502d:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  805033:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  805037:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  80503e:	00 00 00 
+  805041:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  805047:	48 83 c4 08          	add    $0x8,%rsp
+  80504b:	5b                   	pop    %rbx
+  80504c:	41 5c                	pop    %r12
+  80504e:	41 5d                	pop    %r13
+  805050:	5d                   	pop    %rbp
+  805051:	c3                   	ret
+        if (from_env_store)
+  805052:	4d 85 e4             	test   %r12,%r12
+  805055:	74 08                	je     80505f <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  805057:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80505e:	00 
+        if (perm_store)
+  80505f:	4d 85 ed             	test   %r13,%r13
+  805062:	74 e3                	je     805047 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  805064:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80506b:	00 
+  80506c:	eb d9                	jmp    805047 <ipc_try_recv+0xb1>
+
+000000000080506e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80506e:	55                   	push   %rbp
+  80506f:	48 89 e5             	mov    %rsp,%rbp
+  805072:	41 57                	push   %r15
+  805074:	41 56                	push   %r14
+  805076:	41 55                	push   %r13
+  805078:	41 54                	push   %r12
+  80507a:	53                   	push   %rbx
+  80507b:	48 83 ec 18          	sub    $0x18,%rsp
+  80507f:	41 89 fd             	mov    %edi,%r13d
+  805082:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  805085:	48 89 d3             	mov    %rdx,%rbx
+  805088:	49 89 cc             	mov    %rcx,%r12
+  80508b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80508f:	48 85 d2             	test   %rdx,%rdx
+  805092:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805099:	00 00 00 
+  80509c:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8050a0:	49 be 7d 1d 80 00 00 	movabs $0x801d7d,%r14
+  8050a7:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8050aa:	49 bf 6d 19 80 00 00 	movabs $0x80196d,%r15
+  8050b1:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8050b4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8050b7:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8050bb:	4c 89 e1             	mov    %r12,%rcx
+  8050be:	48 89 da             	mov    %rbx,%rdx
+  8050c1:	44 89 ef             	mov    %r13d,%edi
+  8050c4:	41 ff d6             	call   *%r14
+  8050c7:	85 c0                	test   %eax,%eax
+  8050c9:	74 37                	je     805102 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8050cb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8050ce:	75 05                	jne    8050d5 <ipc_send+0x67>
+        sys_yield();
+  8050d0:	41 ff d7             	call   *%r15
+  8050d3:	eb df                	jmp    8050b4 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8050d5:	89 c1                	mov    %eax,%ecx
+  8050d7:	48 ba 5a 69 80 00 00 	movabs $0x80695a,%rdx
+  8050de:	00 00 00 
+  8050e1:	be 65 00 00 00       	mov    $0x65,%esi
+  8050e6:	48 bf 75 69 80 00 00 	movabs $0x806975,%rdi
+  8050ed:	00 00 00 
+  8050f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f5:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8050fc:	00 00 00 
+  8050ff:	41 ff d0             	call   *%r8
+    }
+}
+  805102:	48 83 c4 18          	add    $0x18,%rsp
+  805106:	5b                   	pop    %rbx
+  805107:	41 5c                	pop    %r12
+  805109:	41 5d                	pop    %r13
+  80510b:	41 5e                	pop    %r14
+  80510d:	41 5f                	pop    %r15
+  80510f:	5d                   	pop    %rbp
+  805110:	c3                   	ret
+
+0000000000805111 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805111:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805116:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80511d:	00 00 00 
+  805120:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  805127:	48 01 ca             	add    %rcx,%rdx
+  80512a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  805130:	39 fa                	cmp    %edi,%edx
+  805132:	74 12                	je     805146 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805134:	48 83 c0 01          	add    $0x1,%rax
+  805138:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80513e:	75 e0                	jne    805120 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805140:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805145:	c3                   	ret
+            return envs[i].env_id;
+  805146:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80514d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805154:	00 00 00 
+  805157:	48 01 d0             	add    %rdx,%rax
+  80515a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805160:	c3                   	ret
+
+0000000000805161 <__text_end>:
+  805161:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805168:	00 00 00 
+  80516b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805172:	00 00 00 
+  805175:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80517c:	00 00 00 
+  80517f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805186:	00 00 00 
+  805189:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805190:	00 00 00 
+  805193:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80519a:	00 00 00 
+  80519d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051a4:	00 00 00 
+  8051a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051ae:	00 00 00 
+  8051b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051b8:	00 00 00 
+  8051bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051c2:	00 00 00 
+  8051c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051cc:	00 00 00 
+  8051cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051d6:	00 00 00 
+  8051d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051e0:	00 00 00 
+  8051e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051ea:	00 00 00 
+  8051ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051f4:	00 00 00 
+  8051f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051fe:	00 00 00 
+  805201:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805208:	00 00 00 
+  80520b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805212:	00 00 00 
+  805215:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80521c:	00 00 00 
+  80521f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805226:	00 00 00 
+  805229:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805230:	00 00 00 
+  805233:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80523a:	00 00 00 
+  80523d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805244:	00 00 00 
+  805247:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80524e:	00 00 00 
+  805251:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805258:	00 00 00 
+  80525b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805262:	00 00 00 
+  805265:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80526c:	00 00 00 
+  80526f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805276:	00 00 00 
+  805279:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805280:	00 00 00 
+  805283:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80528a:	00 00 00 
+  80528d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805294:	00 00 00 
+  805297:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80529e:	00 00 00 
+  8052a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052a8:	00 00 00 
+  8052ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052b2:	00 00 00 
+  8052b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052bc:	00 00 00 
+  8052bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052c6:	00 00 00 
+  8052c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052d0:	00 00 00 
+  8052d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052da:	00 00 00 
+  8052dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052e4:	00 00 00 
+  8052e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ee:	00 00 00 
+  8052f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052f8:	00 00 00 
+  8052fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805302:	00 00 00 
+  805305:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80530c:	00 00 00 
+  80530f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805316:	00 00 00 
+  805319:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805320:	00 00 00 
+  805323:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80532a:	00 00 00 
+  80532d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805334:	00 00 00 
+  805337:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80533e:	00 00 00 
+  805341:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805348:	00 00 00 
+  80534b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805352:	00 00 00 
+  805355:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80535c:	00 00 00 
+  80535f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805366:	00 00 00 
+  805369:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805370:	00 00 00 
+  805373:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80537a:	00 00 00 
+  80537d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805384:	00 00 00 
+  805387:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80538e:	00 00 00 
+  805391:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805398:	00 00 00 
+  80539b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053a2:	00 00 00 
+  8053a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053ac:	00 00 00 
+  8053af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053b6:	00 00 00 
+  8053b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053c0:	00 00 00 
+  8053c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053ca:	00 00 00 
+  8053cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053d4:	00 00 00 
+  8053d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053de:	00 00 00 
+  8053e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053e8:	00 00 00 
+  8053eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053f2:	00 00 00 
+  8053f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053fc:	00 00 00 
+  8053ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805406:	00 00 00 
+  805409:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805410:	00 00 00 
+  805413:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80541a:	00 00 00 
+  80541d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805424:	00 00 00 
+  805427:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80542e:	00 00 00 
+  805431:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805438:	00 00 00 
+  80543b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805442:	00 00 00 
+  805445:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80544c:	00 00 00 
+  80544f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805456:	00 00 00 
+  805459:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805460:	00 00 00 
+  805463:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80546a:	00 00 00 
+  80546d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805474:	00 00 00 
+  805477:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80547e:	00 00 00 
+  805481:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805488:	00 00 00 
+  80548b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805492:	00 00 00 
+  805495:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80549c:	00 00 00 
+  80549f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054a6:	00 00 00 
+  8054a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054b0:	00 00 00 
+  8054b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ba:	00 00 00 
+  8054bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054c4:	00 00 00 
+  8054c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ce:	00 00 00 
+  8054d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054d8:	00 00 00 
+  8054db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054e2:	00 00 00 
+  8054e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ec:	00 00 00 
+  8054ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054f6:	00 00 00 
+  8054f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805500:	00 00 00 
+  805503:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80550a:	00 00 00 
+  80550d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805514:	00 00 00 
+  805517:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80551e:	00 00 00 
+  805521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805528:	00 00 00 
+  80552b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805532:	00 00 00 
+  805535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80553c:	00 00 00 
+  80553f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805546:	00 00 00 
+  805549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805550:	00 00 00 
+  805553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80555a:	00 00 00 
+  80555d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805564:	00 00 00 
+  805567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80556e:	00 00 00 
+  805571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805578:	00 00 00 
+  80557b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805582:	00 00 00 
+  805585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80558c:	00 00 00 
+  80558f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805596:	00 00 00 
+  805599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055a0:	00 00 00 
+  8055a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055aa:	00 00 00 
+  8055ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055b4:	00 00 00 
+  8055b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055be:	00 00 00 
+  8055c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055c8:	00 00 00 
+  8055cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055d2:	00 00 00 
+  8055d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055dc:	00 00 00 
+  8055df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055e6:	00 00 00 
+  8055e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055f0:	00 00 00 
+  8055f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055fa:	00 00 00 
+  8055fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805604:	00 00 00 
+  805607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80560e:	00 00 00 
+  805611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805618:	00 00 00 
+  80561b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805622:	00 00 00 
+  805625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80562c:	00 00 00 
+  80562f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805636:	00 00 00 
+  805639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805640:	00 00 00 
+  805643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80564a:	00 00 00 
+  80564d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805654:	00 00 00 
+  805657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80565e:	00 00 00 
+  805661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805668:	00 00 00 
+  80566b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805672:	00 00 00 
+  805675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80567c:	00 00 00 
+  80567f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805686:	00 00 00 
+  805689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805690:	00 00 00 
+  805693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80569a:	00 00 00 
+  80569d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056a4:	00 00 00 
+  8056a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ae:	00 00 00 
+  8056b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056b8:	00 00 00 
+  8056bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056c2:	00 00 00 
+  8056c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056cc:	00 00 00 
+  8056cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d6:	00 00 00 
+  8056d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056e0:	00 00 00 
+  8056e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ea:	00 00 00 
+  8056ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056f4:	00 00 00 
+  8056f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056fe:	00 00 00 
+  805701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805708:	00 00 00 
+  80570b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805712:	00 00 00 
+  805715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80571c:	00 00 00 
+  80571f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805726:	00 00 00 
+  805729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805730:	00 00 00 
+  805733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80573a:	00 00 00 
+  80573d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805744:	00 00 00 
+  805747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80574e:	00 00 00 
+  805751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805758:	00 00 00 
+  80575b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805762:	00 00 00 
+  805765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80576c:	00 00 00 
+  80576f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805776:	00 00 00 
+  805779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805780:	00 00 00 
+  805783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80578a:	00 00 00 
+  80578d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805794:	00 00 00 
+  805797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80579e:	00 00 00 
+  8057a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057a8:	00 00 00 
+  8057ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057b2:	00 00 00 
+  8057b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057bc:	00 00 00 
+  8057bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057c6:	00 00 00 
+  8057c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057d0:	00 00 00 
+  8057d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057da:	00 00 00 
+  8057dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057e4:	00 00 00 
+  8057e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ee:	00 00 00 
+  8057f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057f8:	00 00 00 
+  8057fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805802:	00 00 00 
+  805805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80580c:	00 00 00 
+  80580f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805816:	00 00 00 
+  805819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805820:	00 00 00 
+  805823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80582a:	00 00 00 
+  80582d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805834:	00 00 00 
+  805837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80583e:	00 00 00 
+  805841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805848:	00 00 00 
+  80584b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805852:	00 00 00 
+  805855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80585c:	00 00 00 
+  80585f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805866:	00 00 00 
+  805869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805870:	00 00 00 
+  805873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80587a:	00 00 00 
+  80587d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805884:	00 00 00 
+  805887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80588e:	00 00 00 
+  805891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805898:	00 00 00 
+  80589b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058a2:	00 00 00 
+  8058a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058ac:	00 00 00 
+  8058af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058b6:	00 00 00 
+  8058b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058c0:	00 00 00 
+  8058c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058ca:	00 00 00 
+  8058cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058d4:	00 00 00 
+  8058d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058de:	00 00 00 
+  8058e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058e8:	00 00 00 
+  8058eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058f2:	00 00 00 
+  8058f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058fc:	00 00 00 
+  8058ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805906:	00 00 00 
+  805909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805910:	00 00 00 
+  805913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80591a:	00 00 00 
+  80591d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805924:	00 00 00 
+  805927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80592e:	00 00 00 
+  805931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805938:	00 00 00 
+  80593b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805942:	00 00 00 
+  805945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80594c:	00 00 00 
+  80594f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805956:	00 00 00 
+  805959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805960:	00 00 00 
+  805963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80596a:	00 00 00 
+  80596d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805974:	00 00 00 
+  805977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80597e:	00 00 00 
+  805981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805988:	00 00 00 
+  80598b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805992:	00 00 00 
+  805995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80599c:	00 00 00 
+  80599f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a6:	00 00 00 
+  8059a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b0:	00 00 00 
+  8059b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ba:	00 00 00 
+  8059bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c4:	00 00 00 
+  8059c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ce:	00 00 00 
+  8059d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d8:	00 00 00 
+  8059db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e2:	00 00 00 
+  8059e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ec:	00 00 00 
+  8059ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f6:	00 00 00 
+  8059f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a00:	00 00 00 
+  805a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a0a:	00 00 00 
+  805a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a14:	00 00 00 
+  805a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1e:	00 00 00 
+  805a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a28:	00 00 00 
+  805a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a32:	00 00 00 
+  805a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a3c:	00 00 00 
+  805a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a46:	00 00 00 
+  805a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a50:	00 00 00 
+  805a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a5a:	00 00 00 
+  805a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a64:	00 00 00 
+  805a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6e:	00 00 00 
+  805a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a78:	00 00 00 
+  805a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a82:	00 00 00 
+  805a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a8c:	00 00 00 
+  805a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a96:	00 00 00 
+  805a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa0:	00 00 00 
+  805aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aaa:	00 00 00 
+  805aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab4:	00 00 00 
+  805ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abe:	00 00 00 
+  805ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac8:	00 00 00 
+  805acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad2:	00 00 00 
+  805ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805adc:	00 00 00 
+  805adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae6:	00 00 00 
+  805ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af0:	00 00 00 
+  805af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805afa:	00 00 00 
+  805afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b04:	00 00 00 
+  805b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0e:	00 00 00 
+  805b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b18:	00 00 00 
+  805b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b22:	00 00 00 
+  805b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b2c:	00 00 00 
+  805b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b36:	00 00 00 
+  805b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b40:	00 00 00 
+  805b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b4a:	00 00 00 
+  805b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b54:	00 00 00 
+  805b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5e:	00 00 00 
+  805b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b68:	00 00 00 
+  805b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b72:	00 00 00 
+  805b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b7c:	00 00 00 
+  805b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b86:	00 00 00 
+  805b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b90:	00 00 00 
+  805b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b9a:	00 00 00 
+  805b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba4:	00 00 00 
+  805ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bae:	00 00 00 
+  805bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb8:	00 00 00 
+  805bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc2:	00 00 00 
+  805bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bcc:	00 00 00 
+  805bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd6:	00 00 00 
+  805bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be0:	00 00 00 
+  805be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bea:	00 00 00 
+  805bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf4:	00 00 00 
+  805bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bfe:	00 00 00 
+  805c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c08:	00 00 00 
+  805c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c12:	00 00 00 
+  805c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c1c:	00 00 00 
+  805c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c26:	00 00 00 
+  805c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c30:	00 00 00 
+  805c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c3a:	00 00 00 
+  805c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c44:	00 00 00 
+  805c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4e:	00 00 00 
+  805c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c58:	00 00 00 
+  805c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c62:	00 00 00 
+  805c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c6c:	00 00 00 
+  805c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c76:	00 00 00 
+  805c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c80:	00 00 00 
+  805c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c8a:	00 00 00 
+  805c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c94:	00 00 00 
+  805c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9e:	00 00 00 
+  805ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca8:	00 00 00 
+  805cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb2:	00 00 00 
+  805cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cbc:	00 00 00 
+  805cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc6:	00 00 00 
+  805cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd0:	00 00 00 
+  805cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cda:	00 00 00 
+  805cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce4:	00 00 00 
+  805ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cee:	00 00 00 
+  805cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf8:	00 00 00 
+  805cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d02:	00 00 00 
+  805d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d0c:	00 00 00 
+  805d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d16:	00 00 00 
+  805d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d20:	00 00 00 
+  805d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d2a:	00 00 00 
+  805d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d34:	00 00 00 
+  805d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3e:	00 00 00 
+  805d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d48:	00 00 00 
+  805d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d52:	00 00 00 
+  805d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d5c:	00 00 00 
+  805d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d66:	00 00 00 
+  805d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d70:	00 00 00 
+  805d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d7a:	00 00 00 
+  805d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d84:	00 00 00 
+  805d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8e:	00 00 00 
+  805d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d98:	00 00 00 
+  805d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da2:	00 00 00 
+  805da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dac:	00 00 00 
+  805daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db6:	00 00 00 
+  805db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc0:	00 00 00 
+  805dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dca:	00 00 00 
+  805dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd4:	00 00 00 
+  805dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dde:	00 00 00 
+  805de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de8:	00 00 00 
+  805deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df2:	00 00 00 
+  805df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dfc:	00 00 00 
+  805dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e06:	00 00 00 
+  805e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e10:	00 00 00 
+  805e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e1a:	00 00 00 
+  805e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e24:	00 00 00 
+  805e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2e:	00 00 00 
+  805e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e38:	00 00 00 
+  805e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e42:	00 00 00 
+  805e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e4c:	00 00 00 
+  805e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e56:	00 00 00 
+  805e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e60:	00 00 00 
+  805e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e6a:	00 00 00 
+  805e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e74:	00 00 00 
+  805e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7e:	00 00 00 
+  805e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e88:	00 00 00 
+  805e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e92:	00 00 00 
+  805e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e9c:	00 00 00 
+  805e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea6:	00 00 00 
+  805ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb0:	00 00 00 
+  805eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eba:	00 00 00 
+  805ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec4:	00 00 00 
+  805ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ece:	00 00 00 
+  805ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed8:	00 00 00 
+  805edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee2:	00 00 00 
+  805ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eec:	00 00 00 
+  805eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef6:	00 00 00 
+  805ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f00:	00 00 00 
+  805f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f0a:	00 00 00 
+  805f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f14:	00 00 00 
+  805f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1e:	00 00 00 
+  805f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f28:	00 00 00 
+  805f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f32:	00 00 00 
+  805f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f3c:	00 00 00 
+  805f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f46:	00 00 00 
+  805f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f50:	00 00 00 
+  805f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f5a:	00 00 00 
+  805f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f64:	00 00 00 
+  805f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6e:	00 00 00 
+  805f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f78:	00 00 00 
+  805f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f82:	00 00 00 
+  805f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f8c:	00 00 00 
+  805f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f96:	00 00 00 
+  805f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa0:	00 00 00 
+  805fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805faa:	00 00 00 
+  805fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb4:	00 00 00 
+  805fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbe:	00 00 00 
+  805fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc8:	00 00 00 
+  805fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd2:	00 00 00 
+  805fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fdc:	00 00 00 
+  805fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe6:	00 00 00 
+  805fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff0:	00 00 00 
+  805ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ffa:	00 00 00 
+  805ffd:	0f 1f 00             	nopl   (%rax)
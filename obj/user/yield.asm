@@ -0,0 +1,8119 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c6 00 00 00       	call   8000e9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800036:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80003d:	00 00 00 
+  800040:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800046:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80004d:	00 00 00 
+  800050:	b8 00 00 00 00       	mov    $0x0,%eax
+  800055:	48 ba 62 02 80 00 00 	movabs $0x800262,%rdx
+  80005c:	00 00 00 
+  80005f:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800061:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800066:	49 bf ab 12 80 00 00 	movabs $0x8012ab,%r15
+  80006d:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  800070:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  800077:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007a:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  800081:	00 00 00 
+  800084:	49 bc 62 02 80 00 00 	movabs $0x800262,%r12
+  80008b:	00 00 00 
+        sys_yield();
+  80008e:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800091:	49 8b 06             	mov    (%r14),%rax
+  800094:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009a:	89 da                	mov    %ebx,%edx
+  80009c:	4c 89 ef             	mov    %r13,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000a7:	83 c3 01             	add    $0x1,%ebx
+  8000aa:	83 fb 05             	cmp    $0x5,%ebx
+  8000ad:	75 df                	jne    80008e <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000af:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8000b6:	00 00 00 
+  8000b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000bf:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 ba 62 02 80 00 00 	movabs $0x800262,%rdx
+  8000d5:	00 00 00 
+  8000d8:	ff d2                	call   *%rdx
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	41 5e                	pop    %r14
+  8000e5:	41 5f                	pop    %r15
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  8000ed:	41 56                	push   %r14
+  8000ef:	41 55                	push   %r13
+  8000f1:	41 54                	push   %r12
+  8000f3:	53                   	push   %rbx
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fa:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800101:	00 00 00 
+  800104:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80010b:	00 00 00 
+  80010e:	48 39 c2             	cmp    %rax,%rdx
+  800111:	73 17                	jae    80012a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800113:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800116:	49 89 c4             	mov    %rax,%r12
+  800119:	48 83 c3 08          	add    $0x8,%rbx
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	ff 53 f8             	call   *-0x8(%rbx)
+  800125:	4c 39 e3             	cmp    %r12,%rbx
+  800128:	72 ef                	jb     800119 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80012a:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+  800136:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80013b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800142:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800149:	00 00 00 
+  80014c:	48 01 d0             	add    %rdx,%rax
+  80014f:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800156:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800159:	45 85 ed             	test   %r13d,%r13d
+  80015c:	7e 0d                	jle    80016b <libmain+0x82>
+  80015e:	49 8b 06             	mov    (%r14),%rax
+  800161:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800168:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80016b:	4c 89 f6             	mov    %r14,%rsi
+  80016e:	44 89 ef             	mov    %r13d,%edi
+  800171:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80017d:	48 b8 92 01 80 00 00 	movabs $0x800192,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+#endif
+}
+  800189:	5b                   	pop    %rbx
+  80018a:	41 5c                	pop    %r12
+  80018c:	41 5d                	pop    %r13
+  80018e:	41 5e                	pop    %r14
+  800190:	5d                   	pop    %rbp
+  800191:	c3                   	ret
+
+0000000000800192 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800192:	55                   	push   %rbp
+  800193:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800196:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a7:	48 b8 0f 12 80 00 00 	movabs $0x80120f,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+}
+  8001b3:	5d                   	pop    %rbp
+  8001b4:	c3                   	ret
+
+00000000008001b5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b5:	55                   	push   %rbp
+  8001b6:	48 89 e5             	mov    %rsp,%rbp
+  8001b9:	53                   	push   %rbx
+  8001ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8001be:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001c1:	8b 06                	mov    (%rsi),%eax
+  8001c3:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c6:	89 16                	mov    %edx,(%rsi)
+  8001c8:	48 98                	cltq
+  8001ca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001cf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d5:	74 0a                	je     8001e1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001df:	c9                   	leave
+  8001e0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001e1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e5:	be ff 00 00 00       	mov    $0xff,%esi
+  8001ea:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001fc:	eb d9                	jmp    8001d7 <putch+0x22>
+
+00000000008001fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001fe:	55                   	push   %rbp
+  8001ff:	48 89 e5             	mov    %rsp,%rbp
+  800202:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800209:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80020c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800213:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800220:	48 89 f1             	mov    %rsi,%rcx
+  800223:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80022a:	48 bf b5 01 80 00 00 	movabs $0x8001b5,%rdi
+  800231:	00 00 00 
+  800234:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800240:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800247:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024e:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80025a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+
+0000000000800262 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	48 83 ec 50          	sub    $0x50,%rsp
+  80026a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800272:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800276:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80027a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800285:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800289:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80028d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800291:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800295:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800299:	48 b8 fe 01 80 00 00 	movabs $0x8001fe,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a5:	c9                   	leave
+  8002a6:	c3                   	ret
+
+00000000008002a7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a7:	55                   	push   %rbp
+  8002a8:	48 89 e5             	mov    %rsp,%rbp
+  8002ab:	41 57                	push   %r15
+  8002ad:	41 56                	push   %r14
+  8002af:	41 55                	push   %r13
+  8002b1:	41 54                	push   %r12
+  8002b3:	53                   	push   %rbx
+  8002b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b8:	49 89 fc             	mov    %rdi,%r12
+  8002bb:	49 89 f5             	mov    %rsi,%r13
+  8002be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c8:	41 89 cf             	mov    %ecx,%r15d
+  8002cb:	4c 39 fa             	cmp    %r15,%rdx
+  8002ce:	73 5b                	jae    80032b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002d0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d8:	85 db                	test   %ebx,%ebx
+  8002da:	7e 0e                	jle    8002ea <print_num+0x43>
+            putch(padc, put_arg);
+  8002dc:	4c 89 ee             	mov    %r13,%rsi
+  8002df:	44 89 f7             	mov    %r14d,%edi
+  8002e2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e5:	83 eb 01             	sub    $0x1,%ebx
+  8002e8:	75 f2                	jne    8002dc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002ea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ee:	48 b9 8a 50 80 00 00 	movabs $0x80508a,%rcx
+  8002f5:	00 00 00 
+  8002f8:	48 b8 79 50 80 00 00 	movabs $0x805079,%rax
+  8002ff:	00 00 00 
+  800302:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800306:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	49 f7 f7             	div    %r15
+  800312:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800316:	4c 89 ee             	mov    %r13,%rsi
+  800319:	41 ff d4             	call   *%r12
+}
+  80031c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800320:	5b                   	pop    %rbx
+  800321:	41 5c                	pop    %r12
+  800323:	41 5d                	pop    %r13
+  800325:	41 5e                	pop    %r14
+  800327:	41 5f                	pop    %r15
+  800329:	5d                   	pop    %rbp
+  80032a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80032b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800334:	49 f7 f7             	div    %r15
+  800337:	48 83 ec 08          	sub    $0x8,%rsp
+  80033b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80033f:	52                   	push   %rdx
+  800340:	45 0f be c9          	movsbl %r9b,%r9d
+  800344:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800348:	48 89 c2             	mov    %rax,%rdx
+  80034b:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+  800357:	48 83 c4 10          	add    $0x10,%rsp
+  80035b:	eb 8d                	jmp    8002ea <print_num+0x43>
+
+000000000080035d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80035d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800361:	48 8b 06             	mov    (%rsi),%rax
+  800364:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800368:	73 0a                	jae    800374 <sprintputch+0x17>
+        *state->start++ = ch;
+  80036a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036e:	48 89 16             	mov    %rdx,(%rsi)
+  800371:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800374:	c3                   	ret
+
+0000000000800375 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	48 83 ec 50          	sub    $0x50,%rsp
+  80037d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800381:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800385:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800389:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800390:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800394:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800398:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80039c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003a0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a4:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+}
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+00000000008003b2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	41 57                	push   %r15
+  8003b8:	41 56                	push   %r14
+  8003ba:	41 55                	push   %r13
+  8003bc:	41 54                	push   %r12
+  8003be:	53                   	push   %rbx
+  8003bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c3:	49 89 fe             	mov    %rdi,%r14
+  8003c6:	49 89 f5             	mov    %rsi,%r13
+  8003c9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003cc:	48 8b 01             	mov    (%rcx),%rax
+  8003cf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003db:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e7:	0f b6 3b             	movzbl (%rbx),%edi
+  8003ea:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ee:	74 18                	je     800408 <vprintfmt+0x56>
+            if (!ch) return;
+  8003f0:	40 84 ff             	test   %dil,%dil
+  8003f3:	0f 84 04 07 00 00    	je     800afd <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8003f9:	40 0f b6 ff          	movzbl %dil,%edi
+  8003fd:	4c 89 ee             	mov    %r13,%rsi
+  800400:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800403:	4c 89 e3             	mov    %r12,%rbx
+  800406:	eb db                	jmp    8003e3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800408:	be 00 00 00 00       	mov    $0x0,%esi
+  80040d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800411:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800416:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800423:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800427:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80042c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800431:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800434:	83 e8 23             	sub    $0x23,%eax
+  800437:	3c 57                	cmp    $0x57,%al
+  800439:	0f 87 a4 06 00 00    	ja     800ae3 <vprintfmt+0x731>
+  80043f:	0f b6 c0             	movzbl %al,%eax
+  800442:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  800449:	00 00 00 
+  80044c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80044f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800452:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800456:	eb cf                	jmp    800427 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800458:	49 89 dc             	mov    %rbx,%r12
+  80045b:	be 01 00 00 00       	mov    $0x1,%esi
+  800460:	eb c5                	jmp    800427 <vprintfmt+0x75>
+            padc = ch;
+  800462:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800466:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800469:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046c:	eb b9                	jmp    800427 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800471:	83 f8 2f             	cmp    $0x2f,%eax
+  800474:	77 24                	ja     80049a <vprintfmt+0xe8>
+  800476:	89 c1                	mov    %eax,%ecx
+  800478:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80047c:	83 c0 08             	add    $0x8,%eax
+  80047f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800482:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800485:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800488:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80048c:	79 99                	jns    800427 <vprintfmt+0x75>
+                width = precision;
+  80048e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800492:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800498:	eb 8d                	jmp    800427 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80049a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a6:	eb da                	jmp    800482 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004b1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b7:	3c 39                	cmp    $0x39,%al
+  8004b9:	77 1c                	ja     8004d7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004bb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004bf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c3:	0f b6 c0             	movzbl %al,%eax
+  8004c6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004cb:	0f b6 03             	movzbl (%rbx),%eax
+  8004ce:	3c 39                	cmp    $0x39,%al
+  8004d0:	76 e9                	jbe    8004bb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d5:	eb b1                	jmp    800488 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+  8004da:	eb ac                	jmp    800488 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004dc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004df:	85 c9                	test   %ecx,%ecx
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	0f 49 c1             	cmovns %ecx,%eax
+  8004e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ef:	e9 33 ff ff ff       	jmp    800427 <vprintfmt+0x75>
+            lflag++;
+  8004f4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004fa:	e9 28 ff ff ff       	jmp    800427 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800502:	83 f8 2f             	cmp    $0x2f,%eax
+  800505:	77 19                	ja     800520 <vprintfmt+0x16e>
+  800507:	89 c2                	mov    %eax,%edx
+  800509:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80050d:	83 c0 08             	add    $0x8,%eax
+  800510:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800513:	8b 3a                	mov    (%rdx),%edi
+  800515:	4c 89 ee             	mov    %r13,%rsi
+  800518:	41 ff d6             	call   *%r14
+            break;
+  80051b:	e9 c3 fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800520:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800524:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800528:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052c:	eb e5                	jmp    800513 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 5a                	ja     800590 <vprintfmt+0x1de>
+  800536:	89 c2                	mov    %eax,%edx
+  800538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800542:	8b 02                	mov    (%rdx),%eax
+  800544:	89 c1                	mov    %eax,%ecx
+  800546:	f7 d9                	neg    %ecx
+  800548:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80054b:	83 f9 13             	cmp    $0x13,%ecx
+  80054e:	7f 4e                	jg     80059e <vprintfmt+0x1ec>
+  800550:	48 63 c1             	movslq %ecx,%rax
+  800553:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  80055a:	00 00 00 
+  80055d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800561:	48 85 c0             	test   %rax,%rax
+  800564:	74 38                	je     80059e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800566:	48 89 c1             	mov    %rax,%rcx
+  800569:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  800570:	00 00 00 
+  800573:	4c 89 ee             	mov    %r13,%rsi
+  800576:	4c 89 f7             	mov    %r14,%rdi
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	49 b8 75 03 80 00 00 	movabs $0x800375,%r8
+  800585:	00 00 00 
+  800588:	41 ff d0             	call   *%r8
+  80058b:	e9 53 fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800590:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800594:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800598:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059c:	eb a4                	jmp    800542 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059e:	48 ba a2 50 80 00 00 	movabs $0x8050a2,%rdx
+  8005a5:	00 00 00 
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	4c 89 f7             	mov    %r14,%rdi
+  8005ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b3:	49 b8 75 03 80 00 00 	movabs $0x800375,%r8
+  8005ba:	00 00 00 
+  8005bd:	41 ff d0             	call   *%r8
+  8005c0:	e9 1e fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cb:	77 36                	ja     800603 <vprintfmt+0x251>
+  8005cd:	89 c2                	mov    %eax,%edx
+  8005cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d3:	83 c0 08             	add    $0x8,%eax
+  8005d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d9:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8005dc:	48 85 f6             	test   %rsi,%rsi
+  8005df:	48 b8 9b 50 80 00 00 	movabs $0x80509b,%rax
+  8005e6:	00 00 00 
+  8005e9:	48 0f 45 c6          	cmovne %rsi,%rax
+  8005ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f5:	7e 06                	jle    8005fd <vprintfmt+0x24b>
+  8005f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005fb:	75 14                	jne    800611 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005fd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800601:	eb 5b                	jmp    80065e <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800603:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800607:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80060b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060f:	eb c8                	jmp    8005d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800611:	49 63 f7             	movslq %r15d,%rsi
+  800614:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800618:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  80061f:	00 00 00 
+  800622:	ff d0                	call   *%rax
+  800624:	48 89 c2             	mov    %rax,%rdx
+  800627:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80062c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80062f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800632:	85 c0                	test   %eax,%eax
+  800634:	7e c7                	jle    8005fd <vprintfmt+0x24b>
+  800636:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80063b:	4c 89 ee             	mov    %r13,%rsi
+  80063e:	44 89 e7             	mov    %r12d,%edi
+  800641:	41 ff d6             	call   *%r14
+  800644:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800648:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80064b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80064e:	75 eb                	jne    80063b <vprintfmt+0x289>
+  800650:	eb ab                	jmp    8005fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800652:	0f b6 f8             	movzbl %al,%edi
+  800655:	4c 89 ee             	mov    %r13,%rsi
+  800658:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80065b:	4c 89 e2             	mov    %r12,%rdx
+  80065e:	45 85 ff             	test   %r15d,%r15d
+  800661:	78 06                	js     800669 <vprintfmt+0x2b7>
+  800663:	41 83 ef 01          	sub    $0x1,%r15d
+  800667:	78 23                	js     80068c <vprintfmt+0x2da>
+  800669:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80066d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800673:	84 c0                	test   %al,%al
+  800675:	74 15                	je     80068c <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800677:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80067b:	74 d5                	je     800652 <vprintfmt+0x2a0>
+  80067d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800680:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800685:	80 fa 5e             	cmp    $0x5e,%dl
+  800688:	77 cb                	ja     800655 <vprintfmt+0x2a3>
+  80068a:	eb c6                	jmp    800652 <vprintfmt+0x2a0>
+  80068c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80068f:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800692:	01 f0                	add    %esi,%eax
+  800694:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800696:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	0f 8e 41 fd ff ff    	jle    8003e3 <vprintfmt+0x31>
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006aa:	41 ff d6             	call   *%r14
+  8006ad:	41 83 ec 01          	sub    $0x1,%r12d
+  8006b1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006b5:	75 eb                	jne    8006a2 <vprintfmt+0x2f0>
+  8006b7:	e9 27 fd ff ff       	jmp    8003e3 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8006bc:	40 84 f6             	test   %sil,%sil
+  8006bf:	75 26                	jne    8006e7 <vprintfmt+0x335>
+    switch (lflag) {
+  8006c1:	85 d2                	test   %edx,%edx
+  8006c3:	74 59                	je     80071e <vprintfmt+0x36c>
+  8006c5:	83 fa 01             	cmp    $0x1,%edx
+  8006c8:	74 7b                	je     800745 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8006ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d0:	0f 87 96 00 00 00    	ja     80076c <vprintfmt+0x3ba>
+  8006d6:	89 c2                	mov    %eax,%edx
+  8006d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006dc:	83 c0 08             	add    $0x8,%eax
+  8006df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e2:	4c 8b 22             	mov    (%rdx),%r12
+  8006e5:	eb 17                	jmp    8006fe <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ed:	77 21                	ja     800710 <vprintfmt+0x35e>
+  8006ef:	89 c2                	mov    %eax,%edx
+  8006f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f5:	83 c0 08             	add    $0x8,%eax
+  8006f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006fe:	4d 85 e4             	test   %r12,%r12
+  800701:	78 7a                	js     80077d <vprintfmt+0x3cb>
+            num = i;
+  800703:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80070b:	e9 b5 02 00 00       	jmp    8009c5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800710:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800714:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800718:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071c:	eb dd                	jmp    8006fb <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80071e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800721:	83 f8 2f             	cmp    $0x2f,%eax
+  800724:	77 11                	ja     800737 <vprintfmt+0x385>
+  800726:	89 c2                	mov    %eax,%edx
+  800728:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072c:	83 c0 08             	add    $0x8,%eax
+  80072f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800732:	4c 63 22             	movslq (%rdx),%r12
+  800735:	eb c7                	jmp    8006fe <vprintfmt+0x34c>
+  800737:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800743:	eb ed                	jmp    800732 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800745:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800748:	83 f8 2f             	cmp    $0x2f,%eax
+  80074b:	77 11                	ja     80075e <vprintfmt+0x3ac>
+  80074d:	89 c2                	mov    %eax,%edx
+  80074f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800753:	83 c0 08             	add    $0x8,%eax
+  800756:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800759:	4c 8b 22             	mov    (%rdx),%r12
+  80075c:	eb a0                	jmp    8006fe <vprintfmt+0x34c>
+  80075e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800762:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800766:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076a:	eb ed                	jmp    800759 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80076c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800770:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800778:	e9 65 ff ff ff       	jmp    8006e2 <vprintfmt+0x330>
+                putch('-', put_arg);
+  80077d:	4c 89 ee             	mov    %r13,%rsi
+  800780:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800785:	41 ff d6             	call   *%r14
+                i = -i;
+  800788:	49 f7 dc             	neg    %r12
+  80078b:	e9 73 ff ff ff       	jmp    800703 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800790:	40 84 f6             	test   %sil,%sil
+  800793:	75 32                	jne    8007c7 <vprintfmt+0x415>
+    switch (lflag) {
+  800795:	85 d2                	test   %edx,%edx
+  800797:	74 5d                	je     8007f6 <vprintfmt+0x444>
+  800799:	83 fa 01             	cmp    $0x1,%edx
+  80079c:	0f 84 82 00 00 00    	je     800824 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	0f 87 a5 00 00 00    	ja     800853 <vprintfmt+0x4a1>
+  8007ae:	89 c2                	mov    %eax,%edx
+  8007b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b4:	83 c0 08             	add    $0x8,%eax
+  8007b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007c2:	e9 fe 01 00 00       	jmp    8009c5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cd:	77 19                	ja     8007e8 <vprintfmt+0x436>
+  8007cf:	89 c2                	mov    %eax,%edx
+  8007d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d5:	83 c0 08             	add    $0x8,%eax
+  8007d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007e3:	e9 dd 01 00 00       	jmp    8009c5 <vprintfmt+0x613>
+  8007e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	eb e5                	jmp    8007db <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8007f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fc:	77 18                	ja     800816 <vprintfmt+0x464>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80080c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800811:	e9 af 01 00 00       	jmp    8009c5 <vprintfmt+0x613>
+  800816:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800822:	eb e6                	jmp    80080a <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800824:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800827:	83 f8 2f             	cmp    $0x2f,%eax
+  80082a:	77 19                	ja     800845 <vprintfmt+0x493>
+  80082c:	89 c2                	mov    %eax,%edx
+  80082e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800832:	83 c0 08             	add    $0x8,%eax
+  800835:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800838:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800840:	e9 80 01 00 00       	jmp    8009c5 <vprintfmt+0x613>
+  800845:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800849:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800851:	eb e5                	jmp    800838 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800853:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800857:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085f:	e9 56 ff ff ff       	jmp    8007ba <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800864:	40 84 f6             	test   %sil,%sil
+  800867:	75 2e                	jne    800897 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800869:	85 d2                	test   %edx,%edx
+  80086b:	0f 84 b3 00 00 00    	je     800924 <vprintfmt+0x572>
+  800871:	83 fa 01             	cmp    $0x1,%edx
+  800874:	0f 84 d3 00 00 00    	je     80094d <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	0f 87 f1 00 00 00    	ja     800977 <vprintfmt+0x5c5>
+  800886:	89 c2                	mov    %eax,%edx
+  800888:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088c:	83 c0 08             	add    $0x8,%eax
+  80088f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800892:	48 8b 02             	mov    (%rdx),%rax
+  800895:	eb 17                	jmp    8008ae <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800897:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089a:	83 f8 2f             	cmp    $0x2f,%eax
+  80089d:	77 77                	ja     800916 <vprintfmt+0x564>
+  80089f:	89 c2                	mov    %eax,%edx
+  8008a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a5:	83 c0 08             	add    $0x8,%eax
+  8008a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ab:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8008ae:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008b0:	83 f8 07             	cmp    $0x7,%eax
+  8008b3:	0f 8e cf 00 00 00    	jle    800988 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8008b9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008bf:	44 89 e7             	mov    %r12d,%edi
+  8008c2:	41 c1 e4 03          	shl    $0x3,%r12d
+  8008c6:	89 d1                	mov    %edx,%ecx
+  8008c8:	8d 72 07             	lea    0x7(%rdx),%esi
+  8008cb:	85 d2                	test   %edx,%edx
+  8008cd:	0f 48 d6             	cmovs  %esi,%edx
+  8008d0:	c1 fa 03             	sar    $0x3,%edx
+  8008d3:	83 f9 3f             	cmp    $0x3f,%ecx
+  8008d6:	7f e7                	jg     8008bf <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8008d8:	85 ff                	test   %edi,%edi
+  8008da:	0f 84 03 fb ff ff    	je     8003e3 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8008e0:	49 63 f4             	movslq %r12d,%rsi
+  8008e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e8:	48 f7 f6             	div    %rsi
+  8008eb:	49 89 d7             	mov    %rdx,%r15
+  8008ee:	83 c0 30             	add    $0x30,%eax
+  8008f1:	0f be f8             	movsbl %al,%edi
+  8008f4:	4c 89 ee             	mov    %r13,%rsi
+  8008f7:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8008fa:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8008fd:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800902:	45 85 e4             	test   %r12d,%r12d
+  800905:	41 0f 49 d4          	cmovns %r12d,%edx
+  800909:	c1 fa 03             	sar    $0x3,%edx
+  80090c:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80090f:	75 cf                	jne    8008e0 <vprintfmt+0x52e>
+  800911:	e9 cd fa ff ff       	jmp    8003e3 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb 87                	jmp    8008ab <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 13                	ja     80093f <vprintfmt+0x58d>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	8b 02                	mov    (%rdx),%eax
+  80093a:	e9 6f ff ff ff       	jmp    8008ae <vprintfmt+0x4fc>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb eb                	jmp    800938 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 14                	ja     800969 <vprintfmt+0x5b7>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 02             	mov    (%rdx),%rax
+  800964:	e9 45 ff ff ff       	jmp    8008ae <vprintfmt+0x4fc>
+  800969:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800975:	eb ea                	jmp    800961 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800977:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800983:	e9 0a ff ff ff       	jmp    800892 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800988:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80098e:	e9 4d ff ff ff       	jmp    8008e0 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800993:	4c 89 ee             	mov    %r13,%rsi
+  800996:	bf 30 00 00 00       	mov    $0x30,%edi
+  80099b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80099e:	4c 89 ee             	mov    %r13,%rsi
+  8009a1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 47                	ja     8009f8 <vprintfmt+0x646>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009cd:	0f 94 c0             	sete   %al
+  8009d0:	0f b6 c0             	movzbl %al,%eax
+  8009d3:	50                   	push   %rax
+  8009d4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009dd:	4c 89 ee             	mov    %r13,%rsi
+  8009e0:	4c 89 f7             	mov    %r14,%rdi
+  8009e3:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  8009ea:	00 00 00 
+  8009ed:	ff d0                	call   *%rax
+            break;
+  8009ef:	48 83 c4 10          	add    $0x10,%rsp
+  8009f3:	e9 eb f9 ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a04:	eb b7                	jmp    8009bd <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a06:	40 84 f6             	test   %sil,%sil
+  800a09:	75 2b                	jne    800a36 <vprintfmt+0x684>
+    switch (lflag) {
+  800a0b:	85 d2                	test   %edx,%edx
+  800a0d:	74 56                	je     800a65 <vprintfmt+0x6b3>
+  800a0f:	83 fa 01             	cmp    $0x1,%edx
+  800a12:	74 7f                	je     800a93 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a17:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1a:	0f 87 a2 00 00 00    	ja     800ac2 <vprintfmt+0x710>
+  800a20:	89 c2                	mov    %eax,%edx
+  800a22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a26:	83 c0 08             	add    $0x8,%eax
+  800a29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a34:	eb 8f                	jmp    8009c5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 19                	ja     800a57 <vprintfmt+0x6a5>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a52:	e9 6e ff ff ff       	jmp    8009c5 <vprintfmt+0x613>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e5                	jmp    800a4a <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 18                	ja     800a85 <vprintfmt+0x6d3>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a80:	e9 40 ff ff ff       	jmp    8009c5 <vprintfmt+0x613>
+  800a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	eb e6                	jmp    800a79 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a96:	83 f8 2f             	cmp    $0x2f,%eax
+  800a99:	77 19                	ja     800ab4 <vprintfmt+0x702>
+  800a9b:	89 c2                	mov    %eax,%edx
+  800a9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa1:	83 c0 08             	add    $0x8,%eax
+  800aa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aaa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aaf:	e9 11 ff ff ff       	jmp    8009c5 <vprintfmt+0x613>
+  800ab4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	eb e5                	jmp    800aa7 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800ac2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ace:	e9 59 ff ff ff       	jmp    800a2c <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800ad3:	4c 89 ee             	mov    %r13,%rsi
+  800ad6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800adb:	41 ff d6             	call   *%r14
+            break;
+  800ade:	e9 00 f9 ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ae3:	4c 89 ee             	mov    %r13,%rsi
+  800ae6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aeb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aee:	48 83 eb 01          	sub    $0x1,%rbx
+  800af2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800af6:	75 f6                	jne    800aee <vprintfmt+0x73c>
+  800af8:	e9 e6 f8 ff ff       	jmp    8003e3 <vprintfmt+0x31>
+}
+  800afd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b01:	5b                   	pop    %rbx
+  800b02:	41 5c                	pop    %r12
+  800b04:	41 5d                	pop    %r13
+  800b06:	41 5e                	pop    %r14
+  800b08:	41 5f                	pop    %r15
+  800b0a:	5d                   	pop    %rbp
+  800b0b:	c3                   	ret
+
+0000000000800b0c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b0c:	55                   	push   %rbp
+  800b0d:	48 89 e5             	mov    %rsp,%rbp
+  800b10:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b18:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b21:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b28:	48 85 ff             	test   %rdi,%rdi
+  800b2b:	74 2b                	je     800b58 <vsnprintf+0x4c>
+  800b2d:	48 85 f6             	test   %rsi,%rsi
+  800b30:	74 26                	je     800b58 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b32:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b36:	48 bf 5d 03 80 00 00 	movabs $0x80035d,%rdi
+  800b3d:	00 00 00 
+  800b40:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b50:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b56:	c9                   	leave
+  800b57:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5d:	eb f7                	jmp    800b56 <vsnprintf+0x4a>
+
+0000000000800b5f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b5f:	55                   	push   %rbp
+  800b60:	48 89 e5             	mov    %rsp,%rbp
+  800b63:	48 83 ec 50          	sub    $0x50,%rsp
+  800b67:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b6b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b6f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b73:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b86:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b8a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b8e:	48 b8 0c 0b 80 00 00 	movabs $0x800b0c,%rax
+  800b95:	00 00 00 
+  800b98:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b9a:	c9                   	leave
+  800b9b:	c3                   	ret
+
+0000000000800b9c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b9c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b9f:	74 10                	je     800bb1 <strlen+0x15>
+    size_t n = 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ba6:	48 83 c0 01          	add    $0x1,%rax
+  800baa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bae:	75 f6                	jne    800ba6 <strlen+0xa>
+  800bb0:	c3                   	ret
+    size_t n = 0;
+  800bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bb7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bba:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bbf:	48 85 f6             	test   %rsi,%rsi
+  800bc2:	74 11                	je     800bd5 <strnlen+0x1e>
+  800bc4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bc8:	74 0c                	je     800bd6 <strnlen+0x1f>
+  800bca:	48 83 c2 01          	add    $0x1,%rdx
+  800bce:	48 39 d0             	cmp    %rdx,%rax
+  800bd1:	75 f1                	jne    800bc4 <strnlen+0xd>
+  800bd3:	eb 04                	jmp    800bd9 <strnlen+0x22>
+  800bd5:	c3                   	ret
+  800bd6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd9:	c3                   	ret
+
+0000000000800bda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bda:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800be6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be9:	48 83 c2 01          	add    $0x1,%rdx
+  800bed:	84 c9                	test   %cl,%cl
+  800bef:	75 f1                	jne    800be2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bf1:	c3                   	ret
+
+0000000000800bf2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bf2:	55                   	push   %rbp
+  800bf3:	48 89 e5             	mov    %rsp,%rbp
+  800bf6:	41 54                	push   %r12
+  800bf8:	53                   	push   %rbx
+  800bf9:	48 89 fb             	mov    %rdi,%rbx
+  800bfc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bff:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  800c06:	00 00 00 
+  800c09:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c0b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c0f:	4c 89 e6             	mov    %r12,%rsi
+  800c12:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  800c19:	00 00 00 
+  800c1c:	ff d0                	call   *%rax
+    return dst;
+}
+  800c1e:	48 89 d8             	mov    %rbx,%rax
+  800c21:	5b                   	pop    %rbx
+  800c22:	41 5c                	pop    %r12
+  800c24:	5d                   	pop    %rbp
+  800c25:	c3                   	ret
+
+0000000000800c26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c26:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c29:	48 85 d2             	test   %rdx,%rdx
+  800c2c:	74 1f                	je     800c4d <strncpy+0x27>
+  800c2e:	48 01 fa             	add    %rdi,%rdx
+  800c31:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c34:	48 83 c1 01          	add    $0x1,%rcx
+  800c38:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c3c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c40:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c44:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c48:	48 39 ca             	cmp    %rcx,%rdx
+  800c4b:	75 e7                	jne    800c34 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c4d:	c3                   	ret
+
+0000000000800c4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c4e:	48 89 f8             	mov    %rdi,%rax
+  800c51:	48 85 d2             	test   %rdx,%rdx
+  800c54:	74 24                	je     800c7a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c56:	48 83 ea 01          	sub    $0x1,%rdx
+  800c5a:	74 1b                	je     800c77 <strlcpy+0x29>
+  800c5c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c60:	0f b6 16             	movzbl (%rsi),%edx
+  800c63:	84 d2                	test   %dl,%dl
+  800c65:	74 10                	je     800c77 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c67:	48 83 c6 01          	add    $0x1,%rsi
+  800c6b:	48 83 c0 01          	add    $0x1,%rax
+  800c6f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c72:	48 39 c8             	cmp    %rcx,%rax
+  800c75:	75 e9                	jne    800c60 <strlcpy+0x12>
+        *dst = '\0';
+  800c77:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c7a:	48 29 f8             	sub    %rdi,%rax
+}
+  800c7d:	c3                   	ret
+
+0000000000800c7e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c7e:	0f b6 07             	movzbl (%rdi),%eax
+  800c81:	84 c0                	test   %al,%al
+  800c83:	74 13                	je     800c98 <strcmp+0x1a>
+  800c85:	38 06                	cmp    %al,(%rsi)
+  800c87:	75 0f                	jne    800c98 <strcmp+0x1a>
+  800c89:	48 83 c7 01          	add    $0x1,%rdi
+  800c8d:	48 83 c6 01          	add    $0x1,%rsi
+  800c91:	0f b6 07             	movzbl (%rdi),%eax
+  800c94:	84 c0                	test   %al,%al
+  800c96:	75 ed                	jne    800c85 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c98:	0f b6 c0             	movzbl %al,%eax
+  800c9b:	0f b6 16             	movzbl (%rsi),%edx
+  800c9e:	29 d0                	sub    %edx,%eax
+}
+  800ca0:	c3                   	ret
+
+0000000000800ca1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ca1:	48 85 d2             	test   %rdx,%rdx
+  800ca4:	74 1f                	je     800cc5 <strncmp+0x24>
+  800ca6:	0f b6 07             	movzbl (%rdi),%eax
+  800ca9:	84 c0                	test   %al,%al
+  800cab:	74 1e                	je     800ccb <strncmp+0x2a>
+  800cad:	3a 06                	cmp    (%rsi),%al
+  800caf:	75 1a                	jne    800ccb <strncmp+0x2a>
+  800cb1:	48 83 c7 01          	add    $0x1,%rdi
+  800cb5:	48 83 c6 01          	add    $0x1,%rsi
+  800cb9:	48 83 ea 01          	sub    $0x1,%rdx
+  800cbd:	75 e7                	jne    800ca6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc4:	c3                   	ret
+  800cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cca:	c3                   	ret
+  800ccb:	48 85 d2             	test   %rdx,%rdx
+  800cce:	74 09                	je     800cd9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cd0:	0f b6 07             	movzbl (%rdi),%eax
+  800cd3:	0f b6 16             	movzbl (%rsi),%edx
+  800cd6:	29 d0                	sub    %edx,%eax
+  800cd8:	c3                   	ret
+    if (!n) return 0;
+  800cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cde:	c3                   	ret
+
+0000000000800cdf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cdf:	0f b6 17             	movzbl (%rdi),%edx
+  800ce2:	84 d2                	test   %dl,%dl
+  800ce4:	74 18                	je     800cfe <strchr+0x1f>
+        if (*str == c) {
+  800ce6:	0f be d2             	movsbl %dl,%edx
+  800ce9:	39 f2                	cmp    %esi,%edx
+  800ceb:	74 17                	je     800d04 <strchr+0x25>
+    for (; *str; str++) {
+  800ced:	48 83 c7 01          	add    $0x1,%rdi
+  800cf1:	0f b6 17             	movzbl (%rdi),%edx
+  800cf4:	84 d2                	test   %dl,%dl
+  800cf6:	75 ee                	jne    800ce6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfd:	c3                   	ret
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	c3                   	ret
+  800d04:	48 89 f8             	mov    %rdi,%rax
+}
+  800d07:	c3                   	ret
+
+0000000000800d08 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d08:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d0b:	0f b6 17             	movzbl (%rdi),%edx
+  800d0e:	84 d2                	test   %dl,%dl
+  800d10:	74 13                	je     800d25 <strfind+0x1d>
+  800d12:	0f be d2             	movsbl %dl,%edx
+  800d15:	39 f2                	cmp    %esi,%edx
+  800d17:	74 0b                	je     800d24 <strfind+0x1c>
+  800d19:	48 83 c0 01          	add    $0x1,%rax
+  800d1d:	0f b6 10             	movzbl (%rax),%edx
+  800d20:	84 d2                	test   %dl,%dl
+  800d22:	75 ee                	jne    800d12 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d24:	c3                   	ret
+  800d25:	c3                   	ret
+
+0000000000800d26 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d26:	55                   	push   %rbp
+  800d27:	48 89 e5             	mov    %rsp,%rbp
+  800d2a:	41 57                	push   %r15
+  800d2c:	41 56                	push   %r14
+  800d2e:	41 55                	push   %r13
+  800d30:	41 54                	push   %r12
+  800d32:	53                   	push   %rbx
+  800d33:	48 83 ec 08          	sub    $0x8,%rsp
+  800d37:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d3a:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800d3e:	45 84 ed             	test   %r13b,%r13b
+  800d41:	75 12                	jne    800d55 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800d43:	4c 89 f8             	mov    %r15,%rax
+  800d46:	48 83 c4 08          	add    $0x8,%rsp
+  800d4a:	5b                   	pop    %rbx
+  800d4b:	41 5c                	pop    %r12
+  800d4d:	41 5d                	pop    %r13
+  800d4f:	41 5e                	pop    %r14
+  800d51:	41 5f                	pop    %r15
+  800d53:	5d                   	pop    %rbp
+  800d54:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800d55:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800d59:	4c 89 e7             	mov    %r12,%rdi
+  800d5c:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  800d63:	00 00 00 
+  800d66:	ff d0                	call   *%rax
+  800d68:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800d6b:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800d6f:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800d73:	49 bf a1 0c 80 00 00 	movabs $0x800ca1,%r15
+  800d7a:	00 00 00 
+				if ((sc = *s++) == 0)
+  800d7d:	84 c0                	test   %al,%al
+  800d7f:	75 14                	jne    800d95 <strstr+0x6f>
+					return NULL;
+  800d81:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d87:	eb ba                	jmp    800d43 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d89:	48 83 c3 01          	add    $0x1,%rbx
+  800d8d:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d91:	84 c0                	test   %al,%al
+  800d93:	74 1b                	je     800db0 <strstr+0x8a>
+			} while (sc != c);
+  800d95:	41 38 c5             	cmp    %al,%r13b
+  800d98:	75 ef                	jne    800d89 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d9a:	4c 89 f2             	mov    %r14,%rdx
+  800d9d:	4c 89 e6             	mov    %r12,%rsi
+  800da0:	48 89 df             	mov    %rbx,%rdi
+  800da3:	41 ff d7             	call   *%r15
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	75 df                	jne    800d89 <strstr+0x63>
+  800daa:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800dae:	eb 93                	jmp    800d43 <strstr+0x1d>
+					return NULL;
+  800db0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800db6:	eb 8b                	jmp    800d43 <strstr+0x1d>
+
+0000000000800db8 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800db8:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800dba:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800dbd:	8d 57 20             	lea    0x20(%rdi),%edx
+  800dc0:	83 f9 1a             	cmp    $0x1a,%ecx
+  800dc3:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800dc6:	c3                   	ret
+
+0000000000800dc7 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800dc7:	55                   	push   %rbp
+  800dc8:	48 89 e5             	mov    %rsp,%rbp
+  800dcb:	41 57                	push   %r15
+  800dcd:	41 56                	push   %r14
+  800dcf:	41 55                	push   %r13
+  800dd1:	41 54                	push   %r12
+  800dd3:	53                   	push   %rbx
+  800dd4:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800dd8:	48 39 f7             	cmp    %rsi,%rdi
+  800ddb:	74 49                	je     800e26 <strcasecmp+0x5f>
+  800ddd:	49 89 fd             	mov    %rdi,%r13
+  800de0:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800de3:	49 bf b8 0d 80 00 00 	movabs $0x800db8,%r15
+  800dea:	00 00 00 
+  800ded:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800df2:	41 0f b6 fe          	movzbl %r14b,%edi
+  800df6:	41 ff d7             	call   *%r15
+  800df9:	89 c3                	mov    %eax,%ebx
+  800dfb:	49 83 c4 01          	add    $0x1,%r12
+  800dff:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e05:	41 ff d7             	call   *%r15
+  800e08:	29 c3                	sub    %eax,%ebx
+  800e0a:	75 09                	jne    800e15 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e0c:	49 83 c5 01          	add    $0x1,%r13
+  800e10:	45 84 f6             	test   %r14b,%r14b
+  800e13:	75 d8                	jne    800ded <strcasecmp+0x26>
+}
+  800e15:	89 d8                	mov    %ebx,%eax
+  800e17:	48 83 c4 08          	add    $0x8,%rsp
+  800e1b:	5b                   	pop    %rbx
+  800e1c:	41 5c                	pop    %r12
+  800e1e:	41 5d                	pop    %r13
+  800e20:	41 5e                	pop    %r14
+  800e22:	41 5f                	pop    %r15
+  800e24:	5d                   	pop    %rbp
+  800e25:	c3                   	ret
+        return 0;
+  800e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2b:	eb e8                	jmp    800e15 <strcasecmp+0x4e>
+
+0000000000800e2d <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e2d:	55                   	push   %rbp
+  800e2e:	48 89 e5             	mov    %rsp,%rbp
+  800e31:	41 57                	push   %r15
+  800e33:	41 56                	push   %r14
+  800e35:	41 55                	push   %r13
+  800e37:	41 54                	push   %r12
+  800e39:	53                   	push   %rbx
+  800e3a:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800e3e:	48 85 d2             	test   %rdx,%rdx
+  800e41:	74 4f                	je     800e92 <strncasecmp+0x65>
+  800e43:	49 89 fc             	mov    %rdi,%r12
+  800e46:	49 89 f5             	mov    %rsi,%r13
+  800e49:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800e4d:	49 be b8 0d 80 00 00 	movabs $0x800db8,%r14
+  800e54:	00 00 00 
+  800e57:	49 83 c4 01          	add    $0x1,%r12
+  800e5b:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e61:	41 ff d6             	call   *%r14
+  800e64:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800e66:	49 83 c5 01          	add    $0x1,%r13
+  800e6a:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800e6f:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800e72:	29 c3                	sub    %eax,%ebx
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	74 09                	je     800e81 <strncasecmp+0x54>
+  800e78:	85 db                	test   %ebx,%ebx
+  800e7a:	75 05                	jne    800e81 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800e7c:	4d 39 fc             	cmp    %r15,%r12
+  800e7f:	75 d6                	jne    800e57 <strncasecmp+0x2a>
+}
+  800e81:	89 d8                	mov    %ebx,%eax
+  800e83:	48 83 c4 08          	add    $0x8,%rsp
+  800e87:	5b                   	pop    %rbx
+  800e88:	41 5c                	pop    %r12
+  800e8a:	41 5d                	pop    %r13
+  800e8c:	41 5e                	pop    %r14
+  800e8e:	41 5f                	pop    %r15
+  800e90:	5d                   	pop    %rbp
+  800e91:	c3                   	ret
+    int d = 0;
+  800e92:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e97:	eb e8                	jmp    800e81 <strncasecmp+0x54>
+
+0000000000800e99 <toupper>:
+
+int toupper(int c) {
+  800e99:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e9b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e9e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800ea1:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ea4:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800ea8:	83 ff 20             	cmp    $0x20,%edi
+  800eab:	0f 94 c0             	sete   %al
+  800eae:	0f b6 c0             	movzbl %al,%eax
+}
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800eb2:	89 f8                	mov    %edi,%eax
+  800eb4:	f7 d8                	neg    %eax
+  800eb6:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800eb9:	c3                   	ret
+
+0000000000800eba <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800eba:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ebd:	48 89 f8             	mov    %rdi,%rax
+  800ec0:	48 f7 d8             	neg    %rax
+  800ec3:	83 e0 07             	and    $0x7,%eax
+  800ec6:	49 89 d1             	mov    %rdx,%r9
+  800ec9:	49 29 c1             	sub    %rax,%r9
+  800ecc:	78 36                	js     800f04 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ece:	40 0f b6 c6          	movzbl %sil,%eax
+  800ed2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ed9:	01 01 01 
+  800edc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ee0:	40 f6 c7 07          	test   $0x7,%dil
+  800ee4:	75 38                	jne    800f1e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ee6:	4c 89 c9             	mov    %r9,%rcx
+  800ee9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eed:	74 0c                	je     800efb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eef:	fc                   	cld
+  800ef0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ef3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ef7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800efb:	4d 85 c9             	test   %r9,%r9
+  800efe:	75 45                	jne    800f45 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f00:	4c 89 c0             	mov    %r8,%rax
+  800f03:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f04:	48 85 d2             	test   %rdx,%rdx
+  800f07:	74 f7                	je     800f00 <memset+0x46>
+  800f09:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f0c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f0f:	48 83 c0 01          	add    $0x1,%rax
+  800f13:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f17:	48 39 c2             	cmp    %rax,%rdx
+  800f1a:	75 f3                	jne    800f0f <memset+0x55>
+  800f1c:	eb e2                	jmp    800f00 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f1e:	40 f6 c7 01          	test   $0x1,%dil
+  800f22:	74 06                	je     800f2a <memset+0x70>
+  800f24:	88 07                	mov    %al,(%rdi)
+  800f26:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f2a:	40 f6 c7 02          	test   $0x2,%dil
+  800f2e:	74 07                	je     800f37 <memset+0x7d>
+  800f30:	66 89 07             	mov    %ax,(%rdi)
+  800f33:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f37:	40 f6 c7 04          	test   $0x4,%dil
+  800f3b:	74 a9                	je     800ee6 <memset+0x2c>
+  800f3d:	89 07                	mov    %eax,(%rdi)
+  800f3f:	48 83 c7 04          	add    $0x4,%rdi
+  800f43:	eb a1                	jmp    800ee6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f45:	41 f6 c1 04          	test   $0x4,%r9b
+  800f49:	74 06                	je     800f51 <memset+0x97>
+  800f4b:	89 07                	mov    %eax,(%rdi)
+  800f4d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f51:	41 f6 c1 02          	test   $0x2,%r9b
+  800f55:	74 07                	je     800f5e <memset+0xa4>
+  800f57:	66 89 07             	mov    %ax,(%rdi)
+  800f5a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f5e:	41 f6 c1 01          	test   $0x1,%r9b
+  800f62:	74 9c                	je     800f00 <memset+0x46>
+  800f64:	88 07                	mov    %al,(%rdi)
+  800f66:	eb 98                	jmp    800f00 <memset+0x46>
+
+0000000000800f68 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f68:	48 89 f8             	mov    %rdi,%rax
+  800f6b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f6e:	48 39 fe             	cmp    %rdi,%rsi
+  800f71:	73 3b                	jae    800fae <memmove+0x46>
+  800f73:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f77:	48 39 d7             	cmp    %rdx,%rdi
+  800f7a:	73 32                	jae    800fae <memmove+0x46>
+        s += n;
+        d += n;
+  800f7c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f80:	48 89 d6             	mov    %rdx,%rsi
+  800f83:	48 09 fe             	or     %rdi,%rsi
+  800f86:	48 09 ce             	or     %rcx,%rsi
+  800f89:	40 f6 c6 07          	test   $0x7,%sil
+  800f8d:	75 12                	jne    800fa1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f8f:	48 83 ef 08          	sub    $0x8,%rdi
+  800f93:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f97:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f9b:	fd                   	std
+  800f9c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f9f:	fc                   	cld
+  800fa0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fa1:	48 83 ef 01          	sub    $0x1,%rdi
+  800fa5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fa9:	fd                   	std
+  800faa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fac:	eb f1                	jmp    800f9f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fae:	48 89 f2             	mov    %rsi,%rdx
+  800fb1:	48 09 c2             	or     %rax,%rdx
+  800fb4:	48 09 ca             	or     %rcx,%rdx
+  800fb7:	f6 c2 07             	test   $0x7,%dl
+  800fba:	75 0c                	jne    800fc8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fbc:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fc0:	48 89 c7             	mov    %rax,%rdi
+  800fc3:	fc                   	cld
+  800fc4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fc7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fc8:	48 89 c7             	mov    %rax,%rdi
+  800fcb:	fc                   	cld
+  800fcc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fce:	c3                   	ret
+
+0000000000800fcf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fcf:	55                   	push   %rbp
+  800fd0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fd3:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+}
+  800fdf:	5d                   	pop    %rbp
+  800fe0:	c3                   	ret
+
+0000000000800fe1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fe1:	55                   	push   %rbp
+  800fe2:	48 89 e5             	mov    %rsp,%rbp
+  800fe5:	41 57                	push   %r15
+  800fe7:	41 56                	push   %r14
+  800fe9:	41 55                	push   %r13
+  800feb:	41 54                	push   %r12
+  800fed:	53                   	push   %rbx
+  800fee:	48 83 ec 08          	sub    $0x8,%rsp
+  800ff2:	49 89 fe             	mov    %rdi,%r14
+  800ff5:	49 89 f7             	mov    %rsi,%r15
+  800ff8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ffb:	48 89 f7             	mov    %rsi,%rdi
+  800ffe:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  801005:	00 00 00 
+  801008:	ff d0                	call   *%rax
+  80100a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80100d:	48 89 de             	mov    %rbx,%rsi
+  801010:	4c 89 f7             	mov    %r14,%rdi
+  801013:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+  80101f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801022:	48 39 c3             	cmp    %rax,%rbx
+  801025:	74 36                	je     80105d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801027:	48 89 d8             	mov    %rbx,%rax
+  80102a:	4c 29 e8             	sub    %r13,%rax
+  80102d:	49 39 c4             	cmp    %rax,%r12
+  801030:	73 31                	jae    801063 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801032:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801037:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80103b:	4c 89 fe             	mov    %r15,%rsi
+  80103e:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801045:	00 00 00 
+  801048:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80104a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80104e:	48 83 c4 08          	add    $0x8,%rsp
+  801052:	5b                   	pop    %rbx
+  801053:	41 5c                	pop    %r12
+  801055:	41 5d                	pop    %r13
+  801057:	41 5e                	pop    %r14
+  801059:	41 5f                	pop    %r15
+  80105b:	5d                   	pop    %rbp
+  80105c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80105d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801061:	eb eb                	jmp    80104e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801063:	48 83 eb 01          	sub    $0x1,%rbx
+  801067:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80106b:	48 89 da             	mov    %rbx,%rdx
+  80106e:	4c 89 fe             	mov    %r15,%rsi
+  801071:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801078:	00 00 00 
+  80107b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80107d:	49 01 de             	add    %rbx,%r14
+  801080:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801085:	eb c3                	jmp    80104a <strlcat+0x69>
+
+0000000000801087 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801087:	48 85 d2             	test   %rdx,%rdx
+  80108a:	74 2d                	je     8010b9 <memcmp+0x32>
+  80108c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801091:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801095:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80109a:	44 38 c1             	cmp    %r8b,%cl
+  80109d:	75 0f                	jne    8010ae <memcmp+0x27>
+    while (n-- > 0) {
+  80109f:	48 83 c0 01          	add    $0x1,%rax
+  8010a3:	48 39 c2             	cmp    %rax,%rdx
+  8010a6:	75 e9                	jne    801091 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ad:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010ae:	0f b6 c1             	movzbl %cl,%eax
+  8010b1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010b5:	44 29 c0             	sub    %r8d,%eax
+  8010b8:	c3                   	ret
+    return 0;
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010be:	c3                   	ret
+
+00000000008010bf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010bf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010c3:	48 39 c7             	cmp    %rax,%rdi
+  8010c6:	73 0f                	jae    8010d7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010c8:	40 38 37             	cmp    %sil,(%rdi)
+  8010cb:	74 0e                	je     8010db <memfind+0x1c>
+    for (; src < end; src++) {
+  8010cd:	48 83 c7 01          	add    $0x1,%rdi
+  8010d1:	48 39 f8             	cmp    %rdi,%rax
+  8010d4:	75 f2                	jne    8010c8 <memfind+0x9>
+  8010d6:	c3                   	ret
+  8010d7:	48 89 f8             	mov    %rdi,%rax
+  8010da:	c3                   	ret
+  8010db:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010de:	c3                   	ret
+
+00000000008010df <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010df:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010e2:	0f b6 37             	movzbl (%rdi),%esi
+  8010e5:	40 80 fe 20          	cmp    $0x20,%sil
+  8010e9:	74 06                	je     8010f1 <strtol+0x12>
+  8010eb:	40 80 fe 09          	cmp    $0x9,%sil
+  8010ef:	75 13                	jne    801104 <strtol+0x25>
+  8010f1:	48 83 c7 01          	add    $0x1,%rdi
+  8010f5:	0f b6 37             	movzbl (%rdi),%esi
+  8010f8:	40 80 fe 20          	cmp    $0x20,%sil
+  8010fc:	74 f3                	je     8010f1 <strtol+0x12>
+  8010fe:	40 80 fe 09          	cmp    $0x9,%sil
+  801102:	74 ed                	je     8010f1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801104:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801107:	83 e0 fd             	and    $0xfffffffd,%eax
+  80110a:	3c 01                	cmp    $0x1,%al
+  80110c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801110:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801116:	75 0f                	jne    801127 <strtol+0x48>
+  801118:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80111b:	74 14                	je     801131 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80111d:	85 d2                	test   %edx,%edx
+  80111f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801124:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801127:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80112c:	4c 63 ca             	movslq %edx,%r9
+  80112f:	eb 36                	jmp    801167 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801131:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801135:	74 0f                	je     801146 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801137:	85 d2                	test   %edx,%edx
+  801139:	75 ec                	jne    801127 <strtol+0x48>
+        s++;
+  80113b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80113f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801144:	eb e1                	jmp    801127 <strtol+0x48>
+        s += 2;
+  801146:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80114a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80114f:	eb d6                	jmp    801127 <strtol+0x48>
+            dig -= '0';
+  801151:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801154:	44 0f b6 c1          	movzbl %cl,%r8d
+  801158:	41 39 d0             	cmp    %edx,%r8d
+  80115b:	7d 21                	jge    80117e <strtol+0x9f>
+        val = val * base + dig;
+  80115d:	49 0f af c1          	imul   %r9,%rax
+  801161:	0f b6 c9             	movzbl %cl,%ecx
+  801164:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801167:	48 83 c7 01          	add    $0x1,%rdi
+  80116b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80116f:	80 f9 39             	cmp    $0x39,%cl
+  801172:	76 dd                	jbe    801151 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801174:	80 f9 7b             	cmp    $0x7b,%cl
+  801177:	77 05                	ja     80117e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801179:	83 e9 57             	sub    $0x57,%ecx
+  80117c:	eb d6                	jmp    801154 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80117e:	4d 85 d2             	test   %r10,%r10
+  801181:	74 03                	je     801186 <strtol+0xa7>
+  801183:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801186:	48 89 c2             	mov    %rax,%rdx
+  801189:	48 f7 da             	neg    %rdx
+  80118c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801190:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801194:	c3                   	ret
+
+0000000000801195 <atoi>:
+int atoi(const char *str) {
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a3:	48 b8 df 10 80 00 00 	movabs $0x8010df,%rax
+  8011aa:	00 00 00 
+  8011ad:	ff d0                	call   *%rax
+}
+  8011af:	5d                   	pop    %rbp
+  8011b0:	c3                   	ret
+
+00000000008011b1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	53                   	push   %rbx
+  8011b6:	48 89 fa             	mov    %rdi,%rdx
+  8011b9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011dc:	c9                   	leave
+  8011dd:	c3                   	ret
+
+00000000008011de <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801207:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801209:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+000000000080120f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80120f:	55                   	push   %rbp
+  801210:	48 89 e5             	mov    %rsp,%rbp
+  801213:	53                   	push   %rbx
+  801214:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801218:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80121b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801220:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80123c:	48 85 c0             	test   %rax,%rax
+  80123f:	7f 06                	jg     801247 <sys_env_destroy+0x38>
+}
+  801241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801247:	49 89 c0             	mov    %rax,%r8
+  80124a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80124f:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801256:	00 00 00 
+  801259:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80125e:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801265:	00 00 00 
+  801268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126d:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  801274:	00 00 00 
+  801277:	41 ff d1             	call   *%r9
+
+000000000080127a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80127a:	55                   	push   %rbp
+  80127b:	48 89 e5             	mov    %rsp,%rbp
+  80127e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80127f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801284:	ba 00 00 00 00       	mov    $0x0,%edx
+  801289:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801293:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801298:	be 00 00 00 00       	mov    $0x0,%esi
+  80129d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a9:	c9                   	leave
+  8012aa:	c3                   	ret
+
+00000000008012ab <sys_yield>:
+
+void
+sys_yield(void) {
+  8012ab:	55                   	push   %rbp
+  8012ac:	48 89 e5             	mov    %rsp,%rbp
+  8012af:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+
+00000000008012dc <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+  8012e0:	53                   	push   %rbx
+  8012e1:	48 89 fa             	mov    %rdi,%rdx
+  8012e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ec:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012f3:	00 00 00 
+  8012f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801300:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801306:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+
+000000000080130e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	53                   	push   %rbx
+  801313:	49 89 f8             	mov    %rdi,%r8
+  801316:	48 89 d3             	mov    %rdx,%rbx
+  801319:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80131c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801321:	4c 89 c2             	mov    %r8,%rdx
+  801324:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+000000000080133a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80133a:	55                   	push   %rbp
+  80133b:	48 89 e5             	mov    %rsp,%rbp
+  80133e:	53                   	push   %rbx
+  80133f:	48 83 ec 08          	sub    $0x8,%rsp
+  801343:	89 f8                	mov    %edi,%eax
+  801345:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801348:	48 63 f9             	movslq %ecx,%rdi
+  80134b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801353:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801356:	be 00 00 00 00       	mov    $0x0,%esi
+  80135b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801361:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801363:	48 85 c0             	test   %rax,%rax
+  801366:	7f 06                	jg     80136e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136c:	c9                   	leave
+  80136d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136e:	49 89 c0             	mov    %rax,%r8
+  801371:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801376:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80137d:	00 00 00 
+  801380:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801385:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80138c:	00 00 00 
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  80139b:	00 00 00 
+  80139e:	41 ff d1             	call   *%r9
+
+00000000008013a1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013a1:	55                   	push   %rbp
+  8013a2:	48 89 e5             	mov    %rsp,%rbp
+  8013a5:	53                   	push   %rbx
+  8013a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013aa:	89 f8                	mov    %edi,%eax
+  8013ac:	49 89 f2             	mov    %rsi,%r10
+  8013af:	48 89 cf             	mov    %rcx,%rdi
+  8013b2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013b5:	48 63 da             	movslq %edx,%rbx
+  8013b8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c8:	48 85 c0             	test   %rax,%rax
+  8013cb:	7f 06                	jg     8013d3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d1:	c9                   	leave
+  8013d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d3:	49 89 c0             	mov    %rax,%r8
+  8013d6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013db:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8013e2:	00 00 00 
+  8013e5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013ea:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8013f1:	00 00 00 
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f9:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  801400:	00 00 00 
+  801403:	41 ff d1             	call   *%r9
+
+0000000000801406 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801406:	55                   	push   %rbp
+  801407:	48 89 e5             	mov    %rsp,%rbp
+  80140a:	53                   	push   %rbx
+  80140b:	48 83 ec 08          	sub    $0x8,%rsp
+  80140f:	49 89 f9             	mov    %rdi,%r9
+  801412:	89 f0                	mov    %esi,%eax
+  801414:	48 89 d3             	mov    %rdx,%rbx
+  801417:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80141a:	49 63 f0             	movslq %r8d,%rsi
+  80141d:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801420:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801425:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801430:	48 85 c0             	test   %rax,%rax
+  801433:	7f 06                	jg     80143b <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143b:	49 89 c0             	mov    %rax,%r8
+  80143e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801443:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80144a:	00 00 00 
+  80144d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801452:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801459:	00 00 00 
+  80145c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801461:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  801468:	00 00 00 
+  80146b:	41 ff d1             	call   *%r9
+
+000000000080146e <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80146e:	55                   	push   %rbp
+  80146f:	48 89 e5             	mov    %rsp,%rbp
+  801472:	53                   	push   %rbx
+  801473:	89 f8                	mov    %edi,%eax
+  801475:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801478:	48 63 f9             	movslq %ecx,%rdi
+  80147b:	48 63 da             	movslq %edx,%rbx
+  80147e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801481:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801486:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801489:	be 00 00 00 00       	mov    $0x0,%esi
+  80148e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801494:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801496:	89 c2                	mov    %eax,%edx
+  801498:	48 85 c0             	test   %rax,%rax
+  80149b:	78 0d                	js     8014aa <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  80149d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8014a2:	4d 85 c9             	test   %r9,%r9
+  8014a5:	74 03                	je     8014aa <sys_alloc_dma_region+0x3c>
+  8014a7:	49 89 01             	mov    %rax,(%r9)
+}
+  8014aa:	89 d0                	mov    %edx,%eax
+  8014ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+
+00000000008014b2 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+  8014b6:	53                   	push   %rbx
+  8014b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bb:	48 89 f1             	mov    %rsi,%rcx
+  8014be:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014db:	48 85 c0             	test   %rax,%rax
+  8014de:	7f 06                	jg     8014e6 <sys_set_cache_region+0x34>
+}
+  8014e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e4:	c9                   	leave
+  8014e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e6:	49 89 c0             	mov    %rax,%r8
+  8014e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8014ee:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8014f5:	00 00 00 
+  8014f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014fd:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801504:	00 00 00 
+  801507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150c:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  801513:	00 00 00 
+  801516:	41 ff d1             	call   *%r9
+
+0000000000801519 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801519:	55                   	push   %rbp
+  80151a:	48 89 e5             	mov    %rsp,%rbp
+  80151d:	53                   	push   %rbx
+  80151e:	48 83 ec 08          	sub    $0x8,%rsp
+  801522:	48 89 f1             	mov    %rsi,%rcx
+  801525:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801528:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801540:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 06                	jg     80154d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801555:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80155c:	00 00 00 
+  80155f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801564:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801589:	48 63 ce             	movslq %esi,%rcx
+  80158c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159e:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ab:	48 85 c0             	test   %rax,%rax
+  8015ae:	7f 06                	jg     8015b6 <sys_env_set_status+0x36>
+}
+  8015b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b4:	c9                   	leave
+  8015b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b6:	49 89 c0             	mov    %rax,%r8
+  8015b9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015be:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8015c5:	00 00 00 
+  8015c8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015cd:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8015d4:	00 00 00 
+  8015d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dc:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  8015e3:	00 00 00 
+  8015e6:	41 ff d1             	call   *%r9
+
+00000000008015e9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	53                   	push   %rbx
+  8015ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801602:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801607:	be 00 00 00 00       	mov    $0x0,%esi
+  80160c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801612:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801614:	48 85 c0             	test   %rax,%rax
+  801617:	7f 06                	jg     80161f <sys_env_set_trapframe+0x36>
+}
+  801619:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161f:	49 89 c0             	mov    %rax,%r8
+  801622:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801627:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80162e:	00 00 00 
+  801631:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801636:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80163d:	00 00 00 
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+  801645:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  80164c:	00 00 00 
+  80164f:	41 ff d1             	call   *%r9
+
+0000000000801652 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	53                   	push   %rbx
+  801657:	48 83 ec 08          	sub    $0x8,%rsp
+  80165b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80165e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801661:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801666:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+  801675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167d:	48 85 c0             	test   %rax,%rax
+  801680:	7f 06                	jg     801688 <sys_env_set_pgfault_upcall+0x36>
+}
+  801682:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801688:	49 89 c0             	mov    %rax,%r8
+  80168b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801690:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801697:	00 00 00 
+  80169a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80169f:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8016a6:	00 00 00 
+  8016a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ae:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  8016b5:	00 00 00 
+  8016b8:	41 ff d1             	call   *%r9
+
+00000000008016bb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016bb:	55                   	push   %rbp
+  8016bc:	48 89 e5             	mov    %rsp,%rbp
+  8016bf:	53                   	push   %rbx
+  8016c0:	89 f8                	mov    %edi,%eax
+  8016c2:	49 89 f1             	mov    %rsi,%r9
+  8016c5:	48 89 d3             	mov    %rdx,%rbx
+  8016c8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016cb:	49 63 f0             	movslq %r8d,%rsi
+  8016ce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016df:	cd 30                	int    $0x30
+}
+  8016e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+
+00000000008016e7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016e7:	55                   	push   %rbp
+  8016e8:	48 89 e5             	mov    %rsp,%rbp
+  8016eb:	53                   	push   %rbx
+  8016ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f0:	48 89 fa             	mov    %rdi,%rdx
+  8016f3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801700:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801705:	be 00 00 00 00       	mov    $0x0,%esi
+  80170a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801710:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801712:	48 85 c0             	test   %rax,%rax
+  801715:	7f 06                	jg     80171d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801717:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171d:	49 89 c0             	mov    %rax,%r8
+  801720:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801725:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80172c:	00 00 00 
+  80172f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801734:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80173b:	00 00 00 
+  80173e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801743:	49 b9 d9 3f 80 00 00 	movabs $0x803fd9,%r9
+  80174a:	00 00 00 
+  80174d:	41 ff d1             	call   *%r9
+
+0000000000801750 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801750:	55                   	push   %rbp
+  801751:	48 89 e5             	mov    %rsp,%rbp
+  801754:	53                   	push   %rbx
+  801755:	48 89 fa             	mov    %rdi,%rdx
+  801758:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80175b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80176a:	be 00 00 00 00       	mov    $0x0,%esi
+  80176f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801775:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+
+000000000080177d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80177d:	55                   	push   %rbp
+  80177e:	48 89 e5             	mov    %rsp,%rbp
+  801781:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801782:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801787:	ba 00 00 00 00       	mov    $0x0,%edx
+  80178c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801791:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801796:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179b:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+00000000008017ae <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017ae:	48 85 ff             	test   %rdi,%rdi
+  8017b1:	0f 84 b6 01 00 00    	je     80196d <malloc+0x1bf>
+malloc(size_t size) {
+  8017b7:	55                   	push   %rbp
+  8017b8:	48 89 e5             	mov    %rsp,%rbp
+  8017bb:	41 56                	push   %r14
+  8017bd:	41 55                	push   %r13
+  8017bf:	41 54                	push   %r12
+  8017c1:	53                   	push   %rbx
+  8017c2:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017c5:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8017cc:	00 00 00 
+  8017cf:	4c 8b 20             	mov    (%rax),%r12
+  8017d2:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8017d9:	0f 87 94 01 00 00    	ja     801973 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8017df:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8017e6:	00 00 00 
+  8017e9:	48 85 c0             	test   %rax,%rax
+  8017ec:	74 6b                	je     801859 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8017ee:	4d 85 e4             	test   %r12,%r12
+  8017f1:	74 66                	je     801859 <malloc+0xab>
+  8017f3:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8017fa:	00 00 00 
+  8017fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801802:	eb 0d                	jmp    801811 <malloc+0x63>
+  801804:	48 83 c1 01          	add    $0x1,%rcx
+  801808:	48 83 c2 18          	add    $0x18,%rdx
+  80180c:	49 39 cc             	cmp    %rcx,%r12
+  80180f:	74 48                	je     801859 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801811:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801816:	74 ec                	je     801804 <malloc+0x56>
+  801818:	48 39 1a             	cmp    %rbx,(%rdx)
+  80181b:	72 e7                	jb     801804 <malloc+0x56>
+                real_freep_size--;
+  80181d:	48 83 e8 01          	sub    $0x1,%rax
+  801821:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801828:	00 00 00 
+                freep[i].is_free = false;
+  80182b:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801832:	00 00 00 
+  801835:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801839:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80183d:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801841:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801848:	00 
+                freep[i].size = size;
+  801849:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80184d:	48 01 c8             	add    %rcx,%rax
+  801850:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801854:	e9 0b 01 00 00       	jmp    801964 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801859:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801860:	00 00 00 
+  801863:	48 01 d8             	add    %rbx,%rax
+  801866:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80186c:	76 7c                	jbe    8018ea <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  80186e:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801875:	00 00 00 
+  801878:	4c 8b 30             	mov    (%rax),%r14
+  80187b:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801882:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801885:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80188c:	00 00 00 
+  80188f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801896:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  80189d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8018a3:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8018a7:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  8018ae:	00 00 00 
+  8018b1:	ff d0                	call   *%rax
+  8018b3:	89 c7                	mov    %eax,%edi
+  8018b5:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8018bc:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8018c3:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8018ca:	00 00 00 
+  8018cd:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8018d1:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8018d6:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  8018dd:	00 00 00 
+  8018e0:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	0f 88 90 00 00 00    	js     80197a <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8018ea:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8018f1:	00 00 00 
+  8018f4:	48 8b 31             	mov    (%rcx),%rsi
+  8018f7:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8018fe:	00 00 00 
+  801901:	4c 8b 07             	mov    (%rdi),%r8
+  801904:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801908:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80190f:	00 00 00 
+  801912:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801916:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80191a:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801921:	00 00 00 
+  801924:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801928:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80192b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80192f:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801936:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801937:	48 89 d8             	mov    %rbx,%rax
+  80193a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80193f:	4c 01 c0             	add    %r8,%rax
+  801942:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801945:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80194c:	48 01 f3             	add    %rsi,%rbx
+  80194f:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801952:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801957:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  80195e:	00 00 00 
+  801961:	48 89 d0             	mov    %rdx,%rax
+}
+  801964:	5b                   	pop    %rbx
+  801965:	41 5c                	pop    %r12
+  801967:	41 5d                	pop    %r13
+  801969:	41 5e                	pop    %r14
+  80196b:	5d                   	pop    %rbp
+  80196c:	c3                   	ret
+        return NULL;
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801972:	c3                   	ret
+        return NULL;
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	eb ea                	jmp    801964 <malloc+0x1b6>
+            return NULL;
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	eb e3                	jmp    801964 <malloc+0x1b6>
+
+0000000000801981 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	53                   	push   %rbx
+  801986:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  80198a:	48 89 fb             	mov    %rdi,%rbx
+  80198d:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801991:	48 89 df             	mov    %rbx,%rdi
+  801994:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  80199b:	00 00 00 
+  80199e:	ff d0                	call   *%rax
+  8019a0:	48 89 c7             	mov    %rax,%rdi
+  8019a3:	48 89 da             	mov    %rbx,%rdx
+  8019a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ab:	48 b8 ba 0e 80 00 00 	movabs $0x800eba,%rax
+  8019b2:	00 00 00 
+  8019b5:	ff d0                	call   *%rax
+}
+  8019b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+
+00000000008019bd <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  8019bd:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  8019c4:	00 00 00 
+  8019c7:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8019ce:	00 00 00 
+  8019d1:	48 3b 02             	cmp    (%rdx),%rax
+  8019d4:	74 4d                	je     801a23 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  8019d6:	48 85 c0             	test   %rax,%rax
+  8019d9:	74 4d                	je     801a28 <get_allocsize+0x6b>
+  8019db:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019e2:	00 00 00 
+  8019e5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  8019ea:	48 3b 39             	cmp    (%rcx),%rdi
+  8019ed:	74 13                	je     801a02 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  8019ef:	48 83 c2 01          	add    $0x1,%rdx
+  8019f3:	48 83 c1 18          	add    $0x18,%rcx
+  8019f7:	48 39 d0             	cmp    %rdx,%rax
+  8019fa:	75 ee                	jne    8019ea <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8019fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a01:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a02:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0b:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a12:	00 00 00 
+  801a15:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a1b:	75 0b                	jne    801a28 <get_allocsize+0x6b>
+  801a1d:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a22:	c3                   	ret
+        return 0;
+  801a23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a28:	c3                   	ret
+
+0000000000801a29 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a29:	48 85 ff             	test   %rdi,%rdi
+  801a2c:	0f 84 01 01 00 00    	je     801b33 <free+0x10a>
+free(void *ptr) {
+  801a32:	55                   	push   %rbp
+  801a33:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a36:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a3d:	00 00 00 
+  801a40:	48 8b 30             	mov    (%rax),%rsi
+  801a43:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a4a:	00 00 00 
+  801a4d:	48 39 c6             	cmp    %rax,%rsi
+  801a50:	74 50                	je     801aa2 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801a52:	48 85 f6             	test   %rsi,%rsi
+  801a55:	74 21                	je     801a78 <free+0x4f>
+  801a57:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a5e:	00 00 00 
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801a66:	48 3b 39             	cmp    (%rcx),%rdi
+  801a69:	74 61                	je     801acc <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801a6b:	48 83 c2 01          	add    $0x1,%rdx
+  801a6f:	48 83 c1 18          	add    $0x18,%rcx
+  801a73:	48 39 d6             	cmp    %rdx,%rsi
+  801a76:	75 ee                	jne    801a66 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801a78:	48 ba 10 56 80 00 00 	movabs $0x805610,%rdx
+  801a7f:	00 00 00 
+  801a82:	be 12 01 00 00       	mov    $0x112,%esi
+  801a87:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801a8e:	00 00 00 
+  801a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a96:	48 b9 d9 3f 80 00 00 	movabs $0x803fd9,%rcx
+  801a9d:	00 00 00 
+  801aa0:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801aa2:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801aa9:	00 00 00 
+  801aac:	be 06 01 00 00       	mov    $0x106,%esi
+  801ab1:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801ab8:	00 00 00 
+  801abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac0:	48 b9 d9 3f 80 00 00 	movabs $0x803fd9,%rcx
+  801ac7:	00 00 00 
+  801aca:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801acc:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801ad0:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ad7:	00 00 00 
+  801ada:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801ae0:	75 27                	jne    801b09 <free+0xe0>
+            freep[i].is_free = true;
+  801ae2:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801ae6:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801aed:	00 00 00 
+  801af0:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801af7:	00 00 
+            real_freep_size++;
+  801af9:	48 83 c0 01          	add    $0x1,%rax
+  801afd:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b04:	00 00 00 
+}
+  801b07:	5d                   	pop    %rbp
+  801b08:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b09:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801b10:	00 00 00 
+  801b13:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b18:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801b1f:	00 00 00 
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b27:	48 b9 d9 3f 80 00 00 	movabs $0x803fd9,%rcx
+  801b2e:	00 00 00 
+  801b31:	ff d1                	call   *%rcx
+  801b33:	c3                   	ret
+
+0000000000801b34 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b34:	55                   	push   %rbp
+  801b35:	48 89 e5             	mov    %rsp,%rbp
+  801b38:	41 55                	push   %r13
+  801b3a:	41 54                	push   %r12
+  801b3c:	53                   	push   %rbx
+  801b3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b41:	48 89 fb             	mov    %rdi,%rbx
+  801b44:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801b47:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801b4e:	00 00 00 
+  801b51:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801b53:	49 39 c5             	cmp    %rax,%r13
+  801b56:	73 0e                	jae    801b66 <realloc+0x32>
+}
+  801b58:	48 89 d8             	mov    %rbx,%rax
+  801b5b:	48 83 c4 08          	add    $0x8,%rsp
+  801b5f:	5b                   	pop    %rbx
+  801b60:	41 5c                	pop    %r12
+  801b62:	41 5d                	pop    %r13
+  801b64:	5d                   	pop    %rbp
+  801b65:	c3                   	ret
+  801b66:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801b69:	4c 89 ef             	mov    %r13,%rdi
+  801b6c:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	48 89 c7             	mov    %rax,%rdi
+  801b7b:	4c 89 e2             	mov    %r12,%rdx
+  801b7e:	48 89 de             	mov    %rbx,%rsi
+  801b81:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801b88:	00 00 00 
+  801b8b:	ff d0                	call   *%rax
+  801b8d:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b90:	48 89 df             	mov    %rbx,%rdi
+  801b93:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801b9a:	00 00 00 
+  801b9d:	ff d0                	call   *%rax
+    return newptr;
+  801b9f:	4c 89 e3             	mov    %r12,%rbx
+  801ba2:	eb b4                	jmp    801b58 <realloc+0x24>
+
+0000000000801ba4 <strdup>:
+
+char*
+strdup (const char *src) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	41 54                	push   %r12
+  801baa:	53                   	push   %rbx
+  801bab:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801bae:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+  801bba:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801bbe:	4c 89 e7             	mov    %r12,%rdi
+  801bc1:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	48 89 c7             	mov    %rax,%rdi
+  801bd0:	4c 89 e2             	mov    %r12,%rdx
+  801bd3:	48 89 de             	mov    %rbx,%rsi
+  801bd6:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+}
+  801be2:	5b                   	pop    %rbx
+  801be3:	41 5c                	pop    %r12
+  801be5:	5d                   	pop    %rbp
+  801be6:	c3                   	ret
+
+0000000000801be7 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801be7:	55                   	push   %rbp
+  801be8:	48 89 e5             	mov    %rsp,%rbp
+  801beb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801bec:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c00:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c05:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c10:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c16:	c9                   	leave
+  801c17:	c3                   	ret
+
+0000000000801c18 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c18:	55                   	push   %rbp
+  801c19:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c1c:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c23:	00 00 00 
+  801c26:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c2a:	74 26                	je     801c52 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c2c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c2e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c32:	89 c0                	mov    %eax,%eax
+  801c34:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c37:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801c3e:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801c45:	00 00 00 
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	48 f7 31             	divq   (%rcx)
+}
+  801c50:	5d                   	pop    %rbp
+  801c51:	c3                   	ret
+        freq = get_cpufreq();
+  801c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c57:	48 ba e7 1b 80 00 00 	movabs $0x801be7,%rdx
+  801c5e:	00 00 00 
+  801c61:	ff d2                	call   *%rdx
+  801c63:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c6a:	00 00 00 
+  801c6d:	eb bd                	jmp    801c2c <get_ticks+0x14>
+
+0000000000801c6f <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	53                   	push   %rbx
+  801c74:	48 83 ec 08          	sub    $0x8,%rsp
+  801c78:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801c7b:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c82:	00 00 00 
+  801c85:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c89:	74 50                	je     801cdb <sleep+0x6c>
+    asm volatile("rdtsc"
+  801c8b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c8d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c91:	89 c0                	mov    %eax,%eax
+  801c93:	48 89 d6             	mov    %rdx,%rsi
+  801c96:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c99:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ca0:	00 00 00 
+  801ca3:	48 0f af 18          	imul   (%rax),%rbx
+  801ca7:	48 c1 eb 03          	shr    $0x3,%rbx
+  801cab:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801cb2:	9b c4 20 
+  801cb5:	48 89 d8             	mov    %rbx,%rax
+  801cb8:	48 f7 e2             	mul    %rdx
+  801cbb:	48 89 d1             	mov    %rdx,%rcx
+  801cbe:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801cc2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cc4:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cc8:	89 c0                	mov    %eax,%eax
+  801cca:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ccd:	48 29 f2             	sub    %rsi,%rdx
+  801cd0:	48 39 ca             	cmp    %rcx,%rdx
+  801cd3:	72 ed                	jb     801cc2 <sleep+0x53>
+}
+  801cd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+        freq = get_cpufreq();
+  801cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce0:	48 ba e7 1b 80 00 00 	movabs $0x801be7,%rdx
+  801ce7:	00 00 00 
+  801cea:	ff d2                	call   *%rdx
+  801cec:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801cf3:	00 00 00 
+  801cf6:	eb 93                	jmp    801c8b <sleep+0x1c>
+
+0000000000801cf8 <poll_kbd>:
+
+int poll_kbd() {
+  801cf8:	55                   	push   %rbp
+  801cf9:	48 89 e5             	mov    %rsp,%rbp
+  801cfc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cfd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d07:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d16:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d21:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d27:	c9                   	leave
+  801d28:	c3                   	ret
+
+0000000000801d29 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d29:	55                   	push   %rbp
+  801d2a:	48 89 e5             	mov    %rsp,%rbp
+  801d2d:	53                   	push   %rbx
+  801d2e:	49 89 fa             	mov    %rdi,%r10
+  801d31:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d33:	44 89 c6             	mov    %r8d,%esi
+  801d36:	89 cf                	mov    %ecx,%edi
+  801d38:	89 d3                	mov    %edx,%ebx
+  801d3a:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d3c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d41:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d44:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801d48:	cd 30                	int    $0x30
+  801d4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+0000000000801d50 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d50:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d57:	ff ff ff 
+  801d5a:	48 01 f8             	add    %rdi,%rax
+  801d5d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801d61:	c3                   	ret
+
+0000000000801d62 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d62:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d69:	ff ff ff 
+  801d6c:	48 01 f8             	add    %rdi,%rax
+  801d6f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801d73:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801d79:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801d7d:	c3                   	ret
+
+0000000000801d7e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	41 57                	push   %r15
+  801d84:	41 56                	push   %r14
+  801d86:	41 55                	push   %r13
+  801d88:	41 54                	push   %r12
+  801d8a:	53                   	push   %rbx
+  801d8b:	48 83 ec 08          	sub    $0x8,%rsp
+  801d8f:	49 89 ff             	mov    %rdi,%r15
+  801d92:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d97:	49 bd 32 3c 80 00 00 	movabs $0x803c32,%r13
+  801d9e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801da1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801da7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801daa:	48 89 df             	mov    %rbx,%rdi
+  801dad:	41 ff d5             	call   *%r13
+  801db0:	83 e0 04             	and    $0x4,%eax
+  801db3:	74 17                	je     801dcc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801db5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801dbc:	4c 39 f3             	cmp    %r14,%rbx
+  801dbf:	75 e6                	jne    801da7 <fd_alloc+0x29>
+  801dc1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801dc7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801dcc:	4d 89 27             	mov    %r12,(%r15)
+}
+  801dcf:	48 83 c4 08          	add    $0x8,%rsp
+  801dd3:	5b                   	pop    %rbx
+  801dd4:	41 5c                	pop    %r12
+  801dd6:	41 5d                	pop    %r13
+  801dd8:	41 5e                	pop    %r14
+  801dda:	41 5f                	pop    %r15
+  801ddc:	5d                   	pop    %rbp
+  801ddd:	c3                   	ret
+
+0000000000801dde <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801dde:	83 ff 1f             	cmp    $0x1f,%edi
+  801de1:	77 39                	ja     801e1c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801de3:	55                   	push   %rbp
+  801de4:	48 89 e5             	mov    %rsp,%rbp
+  801de7:	41 54                	push   %r12
+  801de9:	53                   	push   %rbx
+  801dea:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ded:	48 63 df             	movslq %edi,%rbx
+  801df0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801df7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801dfb:	48 89 df             	mov    %rbx,%rdi
+  801dfe:	48 b8 32 3c 80 00 00 	movabs $0x803c32,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+  801e0a:	a8 04                	test   $0x4,%al
+  801e0c:	74 14                	je     801e22 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e0e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e17:	5b                   	pop    %rbx
+  801e18:	41 5c                	pop    %r12
+  801e1a:	5d                   	pop    %rbp
+  801e1b:	c3                   	ret
+        return -E_INVAL;
+  801e1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e21:	c3                   	ret
+        return -E_INVAL;
+  801e22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e27:	eb ee                	jmp    801e17 <fd_lookup+0x39>
+
+0000000000801e29 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e29:	55                   	push   %rbp
+  801e2a:	48 89 e5             	mov    %rsp,%rbp
+  801e2d:	41 54                	push   %r12
+  801e2f:	53                   	push   %rbx
+  801e30:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801e33:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801e3a:	00 00 00 
+  801e3d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801e44:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801e47:	39 3b                	cmp    %edi,(%rbx)
+  801e49:	74 47                	je     801e92 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801e4b:	48 83 c0 08          	add    $0x8,%rax
+  801e4f:	48 8b 18             	mov    (%rax),%rbx
+  801e52:	48 85 db             	test   %rbx,%rbx
+  801e55:	75 f0                	jne    801e47 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e57:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801e5e:	00 00 00 
+  801e61:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e67:	89 fa                	mov    %edi,%edx
+  801e69:	48 bf 48 56 80 00 00 	movabs $0x805648,%rdi
+  801e70:	00 00 00 
+  801e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e78:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  801e7f:	00 00 00 
+  801e82:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801e84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e89:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e8d:	5b                   	pop    %rbx
+  801e8e:	41 5c                	pop    %r12
+  801e90:	5d                   	pop    %rbp
+  801e91:	c3                   	ret
+            return 0;
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	eb f0                	jmp    801e89 <dev_lookup+0x60>
+
+0000000000801e99 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	41 55                	push   %r13
+  801e9f:	41 54                	push   %r12
+  801ea1:	53                   	push   %rbx
+  801ea2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea6:	48 89 fb             	mov    %rdi,%rbx
+  801ea9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801eac:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801eb3:	ff ff ff 
+  801eb6:	48 01 df             	add    %rbx,%rdi
+  801eb9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ebd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec1:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+  801ecd:	41 89 c5             	mov    %eax,%r13d
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 06                	js     801eda <fd_close+0x41>
+  801ed4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ed8:	74 1a                	je     801ef4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801eda:	45 84 e4             	test   %r12b,%r12b
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ee6:	44 89 e8             	mov    %r13d,%eax
+  801ee9:	48 83 c4 18          	add    $0x18,%rsp
+  801eed:	5b                   	pop    %rbx
+  801eee:	41 5c                	pop    %r12
+  801ef0:	41 5d                	pop    %r13
+  801ef2:	5d                   	pop    %rbp
+  801ef3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ef4:	8b 3b                	mov    (%rbx),%edi
+  801ef6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801efa:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  801f01:	00 00 00 
+  801f04:	ff d0                	call   *%rax
+  801f06:	41 89 c5             	mov    %eax,%r13d
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 1b                	js     801f28 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f11:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f15:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f1b:	48 85 c0             	test   %rax,%rax
+  801f1e:	74 08                	je     801f28 <fd_close+0x8f>
+  801f20:	48 89 df             	mov    %rbx,%rdi
+  801f23:	ff d0                	call   *%rax
+  801f25:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f2d:	48 89 de             	mov    %rbx,%rsi
+  801f30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f35:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+    return res;
+  801f41:	eb a3                	jmp    801ee6 <fd_close+0x4d>
+
+0000000000801f43 <close>:
+
+int
+close(int fdnum) {
+  801f43:	55                   	push   %rbp
+  801f44:	48 89 e5             	mov    %rsp,%rbp
+  801f47:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801f4b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f4f:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	78 15                	js     801f74 <close+0x31>
+
+    return fd_close(fd, 1);
+  801f5f:	be 01 00 00 00       	mov    $0x1,%esi
+  801f64:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801f68:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+}
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+0000000000801f76 <close_all>:
+
+void
+close_all(void) {
+  801f76:	55                   	push   %rbp
+  801f77:	48 89 e5             	mov    %rsp,%rbp
+  801f7a:	41 54                	push   %r12
+  801f7c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f82:	49 bc 43 1f 80 00 00 	movabs $0x801f43,%r12
+  801f89:	00 00 00 
+  801f8c:	89 df                	mov    %ebx,%edi
+  801f8e:	41 ff d4             	call   *%r12
+  801f91:	83 c3 01             	add    $0x1,%ebx
+  801f94:	83 fb 20             	cmp    $0x20,%ebx
+  801f97:	75 f3                	jne    801f8c <close_all+0x16>
+}
+  801f99:	5b                   	pop    %rbx
+  801f9a:	41 5c                	pop    %r12
+  801f9c:	5d                   	pop    %rbp
+  801f9d:	c3                   	ret
+
+0000000000801f9e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	41 57                	push   %r15
+  801fa4:	41 56                	push   %r14
+  801fa6:	41 55                	push   %r13
+  801fa8:	41 54                	push   %r12
+  801faa:	53                   	push   %rbx
+  801fab:	48 83 ec 18          	sub    $0x18,%rsp
+  801faf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801fb2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801fb6:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801fbd:	00 00 00 
+  801fc0:	ff d0                	call   *%rax
+  801fc2:	89 c3                	mov    %eax,%ebx
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	0f 88 b8 00 00 00    	js     802084 <dup+0xe6>
+    close(newfdnum);
+  801fcc:	44 89 e7             	mov    %r12d,%edi
+  801fcf:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  801fd6:	00 00 00 
+  801fd9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801fdb:	4d 63 ec             	movslq %r12d,%r13
+  801fde:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801fe5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801fe9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801fed:	4c 89 ff             	mov    %r15,%rdi
+  801ff0:	49 be 62 1d 80 00 00 	movabs $0x801d62,%r14
+  801ff7:	00 00 00 
+  801ffa:	41 ff d6             	call   *%r14
+  801ffd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802000:	4c 89 ef             	mov    %r13,%rdi
+  802003:	41 ff d6             	call   *%r14
+  802006:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802009:	48 89 df             	mov    %rbx,%rdi
+  80200c:	48 b8 32 3c 80 00 00 	movabs $0x803c32,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802018:	a8 04                	test   $0x4,%al
+  80201a:	74 2b                	je     802047 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80201c:	41 89 c1             	mov    %eax,%r9d
+  80201f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802025:	4c 89 f1             	mov    %r14,%rcx
+  802028:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202d:	48 89 de             	mov    %rbx,%rsi
+  802030:	bf 00 00 00 00       	mov    $0x0,%edi
+  802035:	48 b8 a1 13 80 00 00 	movabs $0x8013a1,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 4e                	js     802095 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802047:	4c 89 ff             	mov    %r15,%rdi
+  80204a:	48 b8 32 3c 80 00 00 	movabs $0x803c32,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802059:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80205f:	4c 89 e9             	mov    %r13,%rcx
+  802062:	ba 00 00 00 00       	mov    $0x0,%edx
+  802067:	4c 89 fe             	mov    %r15,%rsi
+  80206a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206f:	48 b8 a1 13 80 00 00 	movabs $0x8013a1,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+  80207b:	89 c3                	mov    %eax,%ebx
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	78 14                	js     802095 <dup+0xf7>
+
+    return newfdnum;
+  802081:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802084:	89 d8                	mov    %ebx,%eax
+  802086:	48 83 c4 18          	add    $0x18,%rsp
+  80208a:	5b                   	pop    %rbx
+  80208b:	41 5c                	pop    %r12
+  80208d:	41 5d                	pop    %r13
+  80208f:	41 5e                	pop    %r14
+  802091:	41 5f                	pop    %r15
+  802093:	5d                   	pop    %rbp
+  802094:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802095:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80209a:	4c 89 ee             	mov    %r13,%rsi
+  80209d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a2:	49 bc 19 15 80 00 00 	movabs $0x801519,%r12
+  8020a9:	00 00 00 
+  8020ac:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8020af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020b4:	4c 89 f6             	mov    %r14,%rsi
+  8020b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020bc:	41 ff d4             	call   *%r12
+    return res;
+  8020bf:	eb c3                	jmp    802084 <dup+0xe6>
+
+00000000008020c1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8020c1:	55                   	push   %rbp
+  8020c2:	48 89 e5             	mov    %rsp,%rbp
+  8020c5:	41 56                	push   %r14
+  8020c7:	41 55                	push   %r13
+  8020c9:	41 54                	push   %r12
+  8020cb:	53                   	push   %rbx
+  8020cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d0:	89 fb                	mov    %edi,%ebx
+  8020d2:	49 89 f4             	mov    %rsi,%r12
+  8020d5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020d8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020dc:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	78 4c                	js     802138 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ec:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020f0:	41 8b 3e             	mov    (%r14),%edi
+  8020f3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020f7:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  8020fe:	00 00 00 
+  802101:	ff d0                	call   *%rax
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 35                	js     80213c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802107:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80210b:	83 e0 03             	and    $0x3,%eax
+  80210e:	83 f8 01             	cmp    $0x1,%eax
+  802111:	74 2d                	je     802140 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802113:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802117:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80211b:	48 85 c0             	test   %rax,%rax
+  80211e:	74 56                	je     802176 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802120:	4c 89 ea             	mov    %r13,%rdx
+  802123:	4c 89 e6             	mov    %r12,%rsi
+  802126:	4c 89 f7             	mov    %r14,%rdi
+  802129:	ff d0                	call   *%rax
+}
+  80212b:	48 83 c4 10          	add    $0x10,%rsp
+  80212f:	5b                   	pop    %rbx
+  802130:	41 5c                	pop    %r12
+  802132:	41 5d                	pop    %r13
+  802134:	41 5e                	pop    %r14
+  802136:	5d                   	pop    %rbp
+  802137:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802138:	48 98                	cltq
+  80213a:	eb ef                	jmp    80212b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80213c:	48 98                	cltq
+  80213e:	eb eb                	jmp    80212b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802140:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802147:	00 00 00 
+  80214a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802150:	89 da                	mov    %ebx,%edx
+  802152:	48 bf 89 56 80 00 00 	movabs $0x805689,%rdi
+  802159:	00 00 00 
+  80215c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802161:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  802168:	00 00 00 
+  80216b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80216d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802174:	eb b5                	jmp    80212b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802176:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80217d:	eb ac                	jmp    80212b <read+0x6a>
+
+000000000080217f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80217f:	55                   	push   %rbp
+  802180:	48 89 e5             	mov    %rsp,%rbp
+  802183:	41 57                	push   %r15
+  802185:	41 56                	push   %r14
+  802187:	41 55                	push   %r13
+  802189:	41 54                	push   %r12
+  80218b:	53                   	push   %rbx
+  80218c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802190:	48 85 d2             	test   %rdx,%rdx
+  802193:	74 54                	je     8021e9 <readn+0x6a>
+  802195:	41 89 fd             	mov    %edi,%r13d
+  802198:	49 89 f6             	mov    %rsi,%r14
+  80219b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80219e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8021a3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8021a8:	49 bf c1 20 80 00 00 	movabs $0x8020c1,%r15
+  8021af:	00 00 00 
+  8021b2:	4c 89 e2             	mov    %r12,%rdx
+  8021b5:	48 29 f2             	sub    %rsi,%rdx
+  8021b8:	4c 01 f6             	add    %r14,%rsi
+  8021bb:	44 89 ef             	mov    %r13d,%edi
+  8021be:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	78 20                	js     8021e5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8021c5:	01 c3                	add    %eax,%ebx
+  8021c7:	85 c0                	test   %eax,%eax
+  8021c9:	74 08                	je     8021d3 <readn+0x54>
+  8021cb:	48 63 f3             	movslq %ebx,%rsi
+  8021ce:	4c 39 e6             	cmp    %r12,%rsi
+  8021d1:	72 df                	jb     8021b2 <readn+0x33>
+    }
+    return res;
+  8021d3:	48 63 c3             	movslq %ebx,%rax
+}
+  8021d6:	48 83 c4 08          	add    $0x8,%rsp
+  8021da:	5b                   	pop    %rbx
+  8021db:	41 5c                	pop    %r12
+  8021dd:	41 5d                	pop    %r13
+  8021df:	41 5e                	pop    %r14
+  8021e1:	41 5f                	pop    %r15
+  8021e3:	5d                   	pop    %rbp
+  8021e4:	c3                   	ret
+        if (inc < 0) return inc;
+  8021e5:	48 98                	cltq
+  8021e7:	eb ed                	jmp    8021d6 <readn+0x57>
+    int inc = 1, res = 0;
+  8021e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021ee:	eb e3                	jmp    8021d3 <readn+0x54>
+
+00000000008021f0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	41 56                	push   %r14
+  8021f6:	41 55                	push   %r13
+  8021f8:	41 54                	push   %r12
+  8021fa:	53                   	push   %rbx
+  8021fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ff:	89 fb                	mov    %edi,%ebx
+  802201:	49 89 f4             	mov    %rsi,%r12
+  802204:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802207:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80220b:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 47                	js     802262 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80221b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80221f:	41 8b 3e             	mov    (%r14),%edi
+  802222:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802226:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  80222d:	00 00 00 
+  802230:	ff d0                	call   *%rax
+  802232:	85 c0                	test   %eax,%eax
+  802234:	78 30                	js     802266 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802236:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80223b:	74 2d                	je     80226a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80223d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802241:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802245:	48 85 c0             	test   %rax,%rax
+  802248:	74 56                	je     8022a0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80224a:	4c 89 ea             	mov    %r13,%rdx
+  80224d:	4c 89 e6             	mov    %r12,%rsi
+  802250:	4c 89 f7             	mov    %r14,%rdi
+  802253:	ff d0                	call   *%rax
+}
+  802255:	48 83 c4 10          	add    $0x10,%rsp
+  802259:	5b                   	pop    %rbx
+  80225a:	41 5c                	pop    %r12
+  80225c:	41 5d                	pop    %r13
+  80225e:	41 5e                	pop    %r14
+  802260:	5d                   	pop    %rbp
+  802261:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802262:	48 98                	cltq
+  802264:	eb ef                	jmp    802255 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802266:	48 98                	cltq
+  802268:	eb eb                	jmp    802255 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80226a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802271:	00 00 00 
+  802274:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80227a:	89 da                	mov    %ebx,%edx
+  80227c:	48 bf a5 56 80 00 00 	movabs $0x8056a5,%rdi
+  802283:	00 00 00 
+  802286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228b:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  802292:	00 00 00 
+  802295:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802297:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80229e:	eb b5                	jmp    802255 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022a0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022a7:	eb ac                	jmp    802255 <write+0x65>
+
+00000000008022a9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8022a9:	55                   	push   %rbp
+  8022aa:	48 89 e5             	mov    %rsp,%rbp
+  8022ad:	53                   	push   %rbx
+  8022ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8022b2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022b4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022b8:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8022bf:	00 00 00 
+  8022c2:	ff d0                	call   *%rax
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	78 0c                	js     8022d4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8022c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022cc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+
+00000000008022da <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8022da:	55                   	push   %rbp
+  8022db:	48 89 e5             	mov    %rsp,%rbp
+  8022de:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8022e2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022e6:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+  8022f2:	85 c0                	test   %eax,%eax
+  8022f4:	78 07                	js     8022fd <tell+0x23>
+    return fdes->fd_offset;
+  8022f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022fa:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8022fd:	c9                   	leave
+  8022fe:	c3                   	ret
+
+00000000008022ff <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8022ff:	55                   	push   %rbp
+  802300:	48 89 e5             	mov    %rsp,%rbp
+  802303:	41 55                	push   %r13
+  802305:	41 54                	push   %r12
+  802307:	53                   	push   %rbx
+  802308:	48 83 ec 18          	sub    $0x18,%rsp
+  80230c:	89 fb                	mov    %edi,%ebx
+  80230e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802311:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802315:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 38                	js     80235d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802325:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802329:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80232d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802331:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	78 1c                	js     80235d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802341:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802346:	74 20                	je     802368 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802348:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80234c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802350:	48 85 c0             	test   %rax,%rax
+  802353:	74 47                	je     80239c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802355:	44 89 e6             	mov    %r12d,%esi
+  802358:	4c 89 ef             	mov    %r13,%rdi
+  80235b:	ff d0                	call   *%rax
+}
+  80235d:	48 83 c4 18          	add    $0x18,%rsp
+  802361:	5b                   	pop    %rbx
+  802362:	41 5c                	pop    %r12
+  802364:	41 5d                	pop    %r13
+  802366:	5d                   	pop    %rbp
+  802367:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802368:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80236f:	00 00 00 
+  802372:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802378:	89 da                	mov    %ebx,%edx
+  80237a:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  802381:	00 00 00 
+  802384:	b8 00 00 00 00       	mov    $0x0,%eax
+  802389:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  802390:	00 00 00 
+  802393:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802395:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80239a:	eb c1                	jmp    80235d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80239c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023a1:	eb ba                	jmp    80235d <ftruncate+0x5e>
+
+00000000008023a3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+  8023a7:	41 54                	push   %r12
+  8023a9:	53                   	push   %rbx
+  8023aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ae:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023b1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023b5:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8023bc:	00 00 00 
+  8023bf:	ff d0                	call   *%rax
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 4e                	js     802413 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023c5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8023c9:	41 8b 3c 24          	mov    (%r12),%edi
+  8023cd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8023d1:	48 b8 29 1e 80 00 00 	movabs $0x801e29,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 32                	js     802413 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8023e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023e5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8023ea:	74 30                	je     80241c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8023ec:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8023ef:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8023f6:	00 00 00 
+    stat->st_isdir = 0;
+  8023f9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802400:	00 00 00 
+    stat->st_dev = dev;
+  802403:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80240a:	48 89 de             	mov    %rbx,%rsi
+  80240d:	4c 89 e7             	mov    %r12,%rdi
+  802410:	ff 50 28             	call   *0x28(%rax)
+}
+  802413:	48 83 c4 10          	add    $0x10,%rsp
+  802417:	5b                   	pop    %rbx
+  802418:	41 5c                	pop    %r12
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80241c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802421:	eb f0                	jmp    802413 <fstat+0x70>
+
+0000000000802423 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 54                	push   %r12
+  802429:	53                   	push   %rbx
+  80242a:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802431:	41 89 fc             	mov    %edi,%r12d
+  802434:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802436:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80243a:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802441:	00 00 00 
+  802444:	ff d0                	call   *%rax
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 31                	js     80247b <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80244a:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802451:	44 89 e7             	mov    %r12d,%edi
+  802454:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+  802460:	85 c0                	test   %eax,%eax
+  802462:	78 17                	js     80247b <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802468:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80246b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80246e:	39 d3                	cmp    %edx,%ebx
+  802470:	0f 4f da             	cmovg  %edx,%ebx
+  802473:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802476:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247b:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802482:	5b                   	pop    %rbx
+  802483:	41 5c                	pop    %r12
+  802485:	5d                   	pop    %rbp
+  802486:	c3                   	ret
+
+0000000000802487 <seektoend>:
+{
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+  80248b:	53                   	push   %rbx
+  80248c:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802493:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802495:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802499:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 28                	js     8024d1 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8024a9:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8024b0:	89 df                	mov    %ebx,%edi
+  8024b2:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	78 0f                	js     8024d1 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8024c2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8024c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024c9:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8024cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+00000000008024d7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	41 54                	push   %r12
+  8024dd:	53                   	push   %rbx
+  8024de:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8024e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e6:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	78 25                	js     80251d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8024f8:	4c 89 e6             	mov    %r12,%rsi
+  8024fb:	89 c7                	mov    %eax,%edi
+  8024fd:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80250c:	89 df                	mov    %ebx,%edi
+  80250e:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+
+    return res;
+  80251a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80251d:	89 d8                	mov    %ebx,%eax
+  80251f:	5b                   	pop    %rbx
+  802520:	41 5c                	pop    %r12
+  802522:	5d                   	pop    %rbp
+  802523:	c3                   	ret
+
+0000000000802524 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802524:	55                   	push   %rbp
+  802525:	48 89 e5             	mov    %rsp,%rbp
+  802528:	53                   	push   %rbx
+  802529:	48 83 ec 08          	sub    $0x8,%rsp
+  80252d:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802530:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802540:	0f 87 ea 00 00 00    	ja     802630 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802546:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80254d:	00 00 00 
+  802550:	80 38 00             	cmpb   $0x0,(%rax)
+  802553:	75 35                	jne    80258a <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802555:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80255a:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80255f:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802564:	bf 00 00 00 00       	mov    $0x0,%edi
+  802569:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+  802575:	85 c0                	test   %eax,%eax
+  802577:	0f 88 ba 00 00 00    	js     802637 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80257d:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802584:	00 00 00 
+  802587:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80258a:	48 89 df             	mov    %rbx,%rdi
+  80258d:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+  802599:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80259d:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8025a4:	00 00 00 
+  8025a7:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8025ab:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8025ae:	39 39                	cmp    %edi,(%rcx)
+  8025b0:	74 46                	je     8025f8 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8025b2:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8025b6:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8025bd:	00 
+  8025be:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8025c5:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8025cc:	00 
+  8025cd:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8025d4:	00 
+  8025d5:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8025dc:	00 
+  8025dd:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8025e4:	00 
+  8025e5:	89 39                	mov    %edi,(%rcx)
+  8025e7:	48 01 c6             	add    %rax,%rsi
+  8025ea:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8025ef:	48 89 c8             	mov    %rcx,%rax
+  8025f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f6:	c9                   	leave
+  8025f7:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8025f8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8025fc:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802603:	00 00 00 
+  802606:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802609:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80260d:	74 e0                	je     8025ef <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80260f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802616:	00 
+  802617:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80261b:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802622:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802624:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802627:	48 01 c2             	add    %rax,%rdx
+  80262a:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80262e:	eb bf                	jmp    8025ef <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802635:	eb b8                	jmp    8025ef <fbuf_get+0xcb>
+            return NULL;
+  802637:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263c:	eb b1                	jmp    8025ef <fbuf_get+0xcb>
+
+000000000080263e <fsipc_bulk>:
+fsipc_bulk(void) {
+  80263e:	55                   	push   %rbp
+  80263f:	48 89 e5             	mov    %rsp,%rbp
+  802642:	53                   	push   %rbx
+  802643:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802647:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80264e:	00 00 00 
+  802651:	48 8b 18             	mov    (%rax),%rbx
+  802654:	48 85 db             	test   %rbx,%rbx
+  802657:	74 16                	je     80266f <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802659:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802660:	00 00 00 
+  802663:	48 8b 18             	mov    (%rax),%rbx
+}
+  802666:	48 89 d8             	mov    %rbx,%rax
+  802669:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80266d:	c9                   	leave
+  80266e:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80266f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802674:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802679:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80267e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802683:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  80268a:	00 00 00 
+  80268d:	ff d0                	call   *%rax
+  80268f:	85 c0                	test   %eax,%eax
+  802691:	78 d3                	js     802666 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802693:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802698:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  80269f:	00 00 00 
+  8026a2:	eb b5                	jmp    802659 <fsipc_bulk+0x1b>
+
+00000000008026a4 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 57                	push   %r15
+  8026aa:	41 56                	push   %r14
+  8026ac:	41 55                	push   %r13
+  8026ae:	41 54                	push   %r12
+  8026b0:	53                   	push   %rbx
+  8026b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b5:	41 89 fd             	mov    %edi,%r13d
+  8026b8:	49 89 f6             	mov    %rsi,%r14
+  8026bb:	49 89 d7             	mov    %rdx,%r15
+  8026be:	48 89 cb             	mov    %rcx,%rbx
+  8026c1:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026c4:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8026cb:	00 00 00 
+  8026ce:	83 38 00             	cmpl   $0x0,(%rax)
+  8026d1:	74 52                	je     802725 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8026d3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026d9:	4c 89 f9             	mov    %r15,%rcx
+  8026dc:	4c 89 f2             	mov    %r14,%rdx
+  8026df:	44 89 ee             	mov    %r13d,%esi
+  8026e2:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8026e9:	00 00 00 
+  8026ec:	8b 38                	mov    (%rax),%edi
+  8026ee:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8026fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ff:	4c 89 e2             	mov    %r12,%rdx
+  802702:	48 89 de             	mov    %rbx,%rsi
+  802705:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270a:	48 b8 7c 40 80 00 00 	movabs $0x80407c,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+}
+  802716:	48 83 c4 08          	add    $0x8,%rsp
+  80271a:	5b                   	pop    %rbx
+  80271b:	41 5c                	pop    %r12
+  80271d:	41 5d                	pop    %r13
+  80271f:	41 5e                	pop    %r14
+  802721:	41 5f                	pop    %r15
+  802723:	5d                   	pop    %rbp
+  802724:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802725:	bf 03 00 00 00       	mov    $0x3,%edi
+  80272a:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80273d:	00 00 
+  80273f:	eb 92                	jmp    8026d3 <fsipc_region+0x2f>
+
+0000000000802741 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	41 57                	push   %r15
+  802747:	41 56                	push   %r14
+  802749:	41 55                	push   %r13
+  80274b:	41 54                	push   %r12
+  80274d:	53                   	push   %rbx
+  80274e:	48 83 ec 28          	sub    $0x28,%rsp
+  802752:	49 89 ff             	mov    %rdi,%r15
+  802755:	49 89 f6             	mov    %rsi,%r14
+  802758:	48 89 d3             	mov    %rdx,%rbx
+  80275b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80275f:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802762:	48 b8 3e 26 80 00 00 	movabs $0x80263e,%rax
+  802769:	00 00 00 
+  80276c:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80276e:	48 85 c0             	test   %rax,%rax
+  802771:	0f 84 cc 00 00 00    	je     802843 <devfile_write_direct+0x102>
+  802777:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  80277a:	48 85 db             	test   %rbx,%rbx
+  80277d:	0f 84 ba 00 00 00    	je     80283d <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802783:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802789:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802790:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802794:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802798:	4c 29 e3             	sub    %r12,%rbx
+  80279b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8027a0:	48 39 c3             	cmp    %rax,%rbx
+  8027a3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8027a7:	48 89 da             	mov    %rbx,%rdx
+  8027aa:	4c 89 f6             	mov    %r14,%rsi
+  8027ad:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8027b1:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  8027b8:	00 00 00 
+  8027bb:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8027bd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8027c1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8027c5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8027c8:	44 01 e0             	add    %r12d,%eax
+  8027cb:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8027cf:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8027d3:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8027da:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8027e1:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8027e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027f3:	4c 89 ee             	mov    %r13,%rsi
+  8027f6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027fb:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+        if (res < 0)
+  802807:	85 c0                	test   %eax,%eax
+  802809:	78 29                	js     802834 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80280b:	74 2b                	je     802838 <devfile_write_direct+0xf7>
+        i += res;
+  80280d:	48 98                	cltq
+  80280f:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802812:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802815:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802819:	49 39 c4             	cmp    %rax,%r12
+  80281c:	0f 82 72 ff ff ff    	jb     802794 <devfile_write_direct+0x53>
+    return i;
+  802822:	4c 89 e0             	mov    %r12,%rax
+}
+  802825:	48 83 c4 28          	add    $0x28,%rsp
+  802829:	5b                   	pop    %rbx
+  80282a:	41 5c                	pop    %r12
+  80282c:	41 5d                	pop    %r13
+  80282e:	41 5e                	pop    %r14
+  802830:	41 5f                	pop    %r15
+  802832:	5d                   	pop    %rbp
+  802833:	c3                   	ret
+            return res;
+  802834:	48 98                	cltq
+  802836:	eb ed                	jmp    802825 <devfile_write_direct+0xe4>
+            return i;
+  802838:	4c 89 e0             	mov    %r12,%rax
+  80283b:	eb e8                	jmp    802825 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80283d:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802841:	eb df                	jmp    802822 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802843:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80284a:	eb d9                	jmp    802825 <devfile_write_direct+0xe4>
+
+000000000080284c <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	41 56                	push   %r14
+  802852:	41 55                	push   %r13
+  802854:	41 54                	push   %r12
+  802856:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802857:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80285b:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	4d 39 ee             	cmp    %r13,%r14
+  802867:	0f 84 99 00 00 00    	je     802906 <fbuf_flush+0xba>
+  80286d:	49 89 fc             	mov    %rdi,%r12
+  802870:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802873:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802876:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80287a:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802881:	00 00 00 
+  802884:	ff d0                	call   *%rax
+  802886:	48 89 c2             	mov    %rax,%rdx
+  802889:	48 c1 e2 04          	shl    $0x4,%rdx
+  80288d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802891:	48 c1 e0 0c          	shl    $0xc,%rax
+  802895:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80289a:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80289d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8028a1:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8028a8:	00 
+  8028a9:	44 89 f1             	mov    %r14d,%ecx
+  8028ac:	4c 89 ea             	mov    %r13,%rdx
+  8028af:	4c 89 e7             	mov    %r12,%rdi
+  8028b2:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028be:	48 85 c0             	test   %rax,%rax
+  8028c1:	78 43                	js     802906 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8028c3:	4c 39 e8             	cmp    %r13,%rax
+  8028c6:	72 47                	jb     80290f <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8028c8:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8028cd:	83 c0 01             	add    $0x1,%eax
+  8028d0:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8028d5:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8028d8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8028dc:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8028e0:	72 0f                	jb     8028f1 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8028e2:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8028e6:	48 39 c2             	cmp    %rax,%rdx
+  8028e9:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8028ed:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8028f1:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8028f8:	00 
+  8028f9:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802900:	00 
+    return 0;
+  802901:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802906:	5b                   	pop    %rbx
+  802907:	41 5c                	pop    %r12
+  802909:	41 5d                	pop    %r13
+  80290b:	41 5e                	pop    %r14
+  80290d:	5d                   	pop    %rbp
+  80290e:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80290f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802914:	eb f0                	jmp    802906 <fbuf_flush+0xba>
+
+0000000000802916 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	53                   	push   %rbx
+  80291b:	48 83 ec 08          	sub    $0x8,%rsp
+  80291f:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802922:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  802929:	00 00 00 
+  80292c:	ff d0                	call   *%rax
+  80292e:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802931:	b8 00 00 00 00       	mov    $0x0,%eax
+  802936:	48 85 f6             	test   %rsi,%rsi
+  802939:	74 0f                	je     80294a <devfile_sync+0x34>
+  80293b:	48 89 df             	mov    %rbx,%rdi
+  80293e:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+}
+  80294a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+
+0000000000802950 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802950:	55                   	push   %rbp
+  802951:	48 89 e5             	mov    %rsp,%rbp
+  802954:	48 83 ec 10          	sub    $0x10,%rsp
+  802958:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80295b:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802962:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802963:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802967:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80296c:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802973:	00 00 00 
+  802976:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  80297d:	00 00 00 
+  802980:	ff d0                	call   *%rax
+}
+  802982:	c9                   	leave
+  802983:	c3                   	ret
+
+0000000000802984 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802984:	55                   	push   %rbp
+  802985:	48 89 e5             	mov    %rsp,%rbp
+  802988:	41 54                	push   %r12
+  80298a:	53                   	push   %rbx
+  80298b:	48 89 fb             	mov    %rdi,%rbx
+  80298e:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802991:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  802998:	00 00 00 
+  80299b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 63                	js     802a04 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029a1:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029a4:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029ab:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8029ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8029b7:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  8029be:	00 00 00 
+  8029c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 3d                	js     802a04 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8029c7:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8029ce:	00 00 00 
+  8029d1:	48 89 de             	mov    %rbx,%rsi
+  8029d4:	4c 89 e7             	mov    %r12,%rdi
+  8029d7:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  8029de:	00 00 00 
+  8029e1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8029e3:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8029e9:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8029f0:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8029f1:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8029f7:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8029fe:	00 
+
+    return 0;
+  8029ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a04:	5b                   	pop    %rbx
+  802a05:	41 5c                	pop    %r12
+  802a07:	5d                   	pop    %rbp
+  802a08:	c3                   	ret
+
+0000000000802a09 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a09:	55                   	push   %rbp
+  802a0a:	48 89 e5             	mov    %rsp,%rbp
+  802a0d:	41 54                	push   %r12
+  802a0f:	53                   	push   %rbx
+  802a10:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802a13:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  802a1a:	00 00 00 
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802a22:	48 89 df             	mov    %rbx,%rdi
+  802a25:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+  802a31:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802a35:	76 2e                	jbe    802a65 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802a37:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a3a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802a41:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802a43:	be 00 00 00 00       	mov    $0x0,%esi
+  802a48:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a4d:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  802a54:	00 00 00 
+  802a57:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a59:	45 85 e4             	test   %r12d,%r12d
+  802a5c:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802a65:	48 89 df             	mov    %rbx,%rdi
+  802a68:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+  802a74:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a78:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802a7f:	00 00 00 
+  802a82:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802a89:	48 89 df             	mov    %rbx,%rdi
+  802a8c:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802a93:	00 00 00 
+  802a96:	ff d0                	call   *%rax
+  802a98:	48 89 c6             	mov    %rax,%rsi
+  802a9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa5:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+  802ab1:	eb 84                	jmp    802a37 <devfile_flush+0x2e>
+
+0000000000802ab3 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+  802ab7:	41 55                	push   %r13
+  802ab9:	41 54                	push   %r12
+  802abb:	53                   	push   %rbx
+  802abc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac0:	48 89 fb             	mov    %rdi,%rbx
+  802ac3:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802ac6:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  802acd:	00 00 00 
+  802ad0:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ad2:	48 85 c0             	test   %rax,%rax
+  802ad5:	74 51                	je     802b28 <devfile_trunc+0x75>
+  802ad7:	49 89 c4             	mov    %rax,%r12
+  802ada:	48 89 c6             	mov    %rax,%rsi
+  802add:	48 89 df             	mov    %rbx,%rdi
+  802ae0:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	85 c0                	test   %eax,%eax
+  802aee:	78 2d                	js     802b1d <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802af0:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802af7:	00 00 00 
+  802afa:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802afd:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802aff:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802b03:	be 00 00 00 00       	mov    $0x0,%esi
+  802b08:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b0d:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	79 3e                	jns    802b5b <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802b1d:	48 83 c4 08          	add    $0x8,%rsp
+  802b21:	5b                   	pop    %rbx
+  802b22:	41 5c                	pop    %r12
+  802b24:	41 5d                	pop    %r13
+  802b26:	5d                   	pop    %rbp
+  802b27:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802b28:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802b2f:	00 00 00 
+  802b32:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802b35:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802b37:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802b3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b40:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b45:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  802b4c:	00 00 00 
+  802b4f:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802b51:	85 c0                	test   %eax,%eax
+  802b53:	78 c8                	js     802b1d <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802b55:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b59:	eb c2                	jmp    802b1d <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802b5b:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802b5e:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b61:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b64:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802b69:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802b70:	00 00 
+  802b72:	eb a9                	jmp    802b1d <devfile_trunc+0x6a>
+
+0000000000802b74 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b74:	55                   	push   %rbp
+  802b75:	48 89 e5             	mov    %rsp,%rbp
+  802b78:	41 57                	push   %r15
+  802b7a:	41 56                	push   %r14
+  802b7c:	41 55                	push   %r13
+  802b7e:	41 54                	push   %r12
+  802b80:	53                   	push   %rbx
+  802b81:	48 83 ec 28          	sub    $0x28,%rsp
+  802b85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b89:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802b8d:	49 89 d7             	mov    %rdx,%r15
+  802b90:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802b94:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+  802ba0:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802ba3:	48 85 c0             	test   %rax,%rax
+  802ba6:	74 31                	je     802bd9 <devfile_write+0x65>
+  802ba8:	4c 89 f8             	mov    %r15,%rax
+  802bab:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802bb2:	77 25                	ja     802bd9 <devfile_write+0x65>
+    size_t i = 0;
+  802bb4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802bba:	48 85 c0             	test   %rax,%rax
+  802bbd:	0f 85 64 01 00 00    	jne    802d27 <devfile_write+0x1b3>
+    size_t i = 0;
+  802bc3:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802bc7:	4c 89 f8             	mov    %r15,%rax
+}
+  802bca:	48 83 c4 28          	add    $0x28,%rsp
+  802bce:	5b                   	pop    %rbx
+  802bcf:	41 5c                	pop    %r12
+  802bd1:	41 5d                	pop    %r13
+  802bd3:	41 5e                	pop    %r14
+  802bd5:	41 5f                	pop    %r15
+  802bd7:	5d                   	pop    %rbp
+  802bd8:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802bd9:	48 85 db             	test   %rbx,%rbx
+  802bdc:	74 5b                	je     802c39 <devfile_write+0xc5>
+  802bde:	48 89 de             	mov    %rbx,%rsi
+  802be1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802be5:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	78 40                	js     802c35 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802bf5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802bf9:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802bfc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c00:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802c04:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  802c0b:	00 00 00 
+  802c0e:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802c10:	48 85 c0             	test   %rax,%rax
+  802c13:	7e b5                	jle    802bca <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802c15:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802c19:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802c1c:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802c1f:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802c22:	8d 51 01             	lea    0x1(%rcx),%edx
+  802c25:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c28:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802c2b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802c32:	00 
+  802c33:	eb 95                	jmp    802bca <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c35:	48 98                	cltq
+  802c37:	eb 91                	jmp    802bca <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802c39:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802c3d:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802c40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c44:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802c48:	48 89 df             	mov    %rbx,%rdi
+  802c4b:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802c57:	48 85 c0             	test   %rax,%rax
+  802c5a:	0f 8e 6a ff ff ff    	jle    802bca <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802c60:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802c63:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c67:	e9 5e ff ff ff       	jmp    802bca <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802c6c:	48 98                	cltq
+  802c6e:	4d 85 ff             	test   %r15,%r15
+  802c71:	49 0f 45 c7          	cmovne %r15,%rax
+  802c75:	e9 50 ff ff ff       	jmp    802bca <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802c7a:	48 89 de             	mov    %rbx,%rsi
+  802c7d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c81:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	0f 88 2b 01 00 00    	js     802dc0 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c99:	4c 01 f8             	add    %r15,%rax
+  802c9c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802ca0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ca4:	48 b9 50 1d 80 00 00 	movabs $0x801d50,%rcx
+  802cab:	00 00 00 
+  802cae:	ff d1                	call   *%rcx
+  802cb0:	48 89 c2             	mov    %rax,%rdx
+  802cb3:	48 c1 e2 04          	shl    $0x4,%rdx
+  802cb7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802cbb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cbf:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802cc4:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802cc7:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802cce:	00 
+  802ccf:	4c 89 ea             	mov    %r13,%rdx
+  802cd2:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802cd6:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  802cdd:	00 00 00 
+  802ce0:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802ce2:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802ce6:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802cea:	48 39 c2             	cmp    %rax,%rdx
+  802ced:	0f 84 db 00 00 00    	je     802dce <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802cf3:	4c 39 e2             	cmp    %r12,%rdx
+  802cf6:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802cfa:	4d 01 ec             	add    %r13,%r12
+  802cfd:	49 39 c4             	cmp    %rax,%r12
+  802d00:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802d04:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802d08:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802d0c:	45 01 ee             	add    %r13d,%r14d
+  802d0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d13:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802d17:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802d1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d1e:	49 39 c7             	cmp    %rax,%r15
+  802d21:	0f 83 a0 fe ff ff    	jae    802bc7 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802d27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d2b:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802d2f:	8b 43 08             	mov    0x8(%rbx),%eax
+  802d32:	44 39 f0             	cmp    %r14d,%eax
+  802d35:	7f 10                	jg     802d47 <devfile_write+0x1d3>
+  802d37:	48 98                	cltq
+  802d39:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802d3f:	49 63 d6             	movslq %r14d,%rdx
+  802d42:	48 39 d0             	cmp    %rdx,%rax
+  802d45:	7d 2d                	jge    802d74 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d47:	48 89 de             	mov    %rbx,%rsi
+  802d4a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d4e:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802d55:	00 00 00 
+  802d58:	ff d0                	call   *%rax
+  802d5a:	85 c0                	test   %eax,%eax
+  802d5c:	0f 88 0a ff ff ff    	js     802c6c <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802d62:	44 89 f0             	mov    %r14d,%eax
+  802d65:	66 b8 00 00          	mov    $0x0,%ax
+  802d69:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802d6c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802d73:	00 
+        size_t off = pos - fb->fb_base;
+  802d74:	45 89 f4             	mov    %r14d,%r12d
+  802d77:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802d7b:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802d7e:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802d82:	4d 29 fd             	sub    %r15,%r13
+  802d85:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802d8a:	4c 29 e0             	sub    %r12,%rax
+  802d8d:	49 39 c5             	cmp    %rax,%r13
+  802d90:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802d94:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d98:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d9c:	48 39 c2             	cmp    %rax,%rdx
+  802d9f:	0f 84 f0 fe ff ff    	je     802c95 <devfile_write+0x121>
+  802da5:	4c 39 e0             	cmp    %r12,%rax
+  802da8:	0f 82 cc fe ff ff    	jb     802c7a <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802dae:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802db2:	48 39 d0             	cmp    %rdx,%rax
+  802db5:	0f 83 da fe ff ff    	jae    802c95 <devfile_write+0x121>
+  802dbb:	e9 ba fe ff ff       	jmp    802c7a <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dc0:	48 98                	cltq
+  802dc2:	4d 85 ff             	test   %r15,%r15
+  802dc5:	49 0f 45 c7          	cmovne %r15,%rax
+  802dc9:	e9 fc fd ff ff       	jmp    802bca <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802dce:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802dd2:	4c 89 e2             	mov    %r12,%rdx
+  802dd5:	e9 2a ff ff ff       	jmp    802d04 <devfile_write+0x190>
+
+0000000000802dda <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	41 57                	push   %r15
+  802de0:	41 56                	push   %r14
+  802de2:	41 55                	push   %r13
+  802de4:	41 54                	push   %r12
+  802de6:	53                   	push   %rbx
+  802de7:	48 83 ec 28          	sub    $0x28,%rsp
+  802deb:	49 89 ff             	mov    %rdi,%r15
+  802dee:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802df2:	48 89 d3             	mov    %rdx,%rbx
+  802df5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802df9:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  802e00:	00 00 00 
+  802e03:	ff d0                	call   *%rax
+  802e05:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802e08:	48 85 c0             	test   %rax,%rax
+  802e0b:	74 0d                	je     802e1a <devfile_read+0x40>
+  802e0d:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802e14:	0f 86 1a 01 00 00    	jbe    802f34 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e1a:	4d 85 e4             	test   %r12,%r12
+  802e1d:	74 1a                	je     802e39 <devfile_read+0x5f>
+  802e1f:	4c 89 e6             	mov    %r12,%rsi
+  802e22:	4c 89 ff             	mov    %r15,%rdi
+  802e25:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+  802e31:	85 c0                	test   %eax,%eax
+  802e33:	0f 88 e8 00 00 00    	js     802f21 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802e39:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802e3d:	48 b8 3e 26 80 00 00 	movabs $0x80263e,%rax
+  802e44:	00 00 00 
+  802e47:	ff d0                	call   *%rax
+  802e49:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802e4c:	48 85 c0             	test   %rax,%rax
+  802e4f:	0f 84 69 02 00 00    	je     8030be <devfile_read+0x2e4>
+    while (i < n) {
+  802e55:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802e5a:	0f 84 ce 00 00 00    	je     802f2e <devfile_read+0x154>
+    size_t i = 0;
+  802e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e65:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e6c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802e70:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802e74:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802e78:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e7c:	48 29 da             	sub    %rbx,%rdx
+  802e7f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802e84:	48 39 c2             	cmp    %rax,%rdx
+  802e87:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802e8b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e8f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802e93:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802e96:	01 d8                	add    %ebx,%eax
+  802e98:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e9c:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802ea0:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802ea7:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802eae:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802eb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ebb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec0:	4c 89 ee             	mov    %r13,%rsi
+  802ec3:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ec8:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  802ecf:	00 00 00 
+  802ed2:	ff d0                	call   *%rax
+        if (res < 0)
+  802ed4:	85 c0                	test   %eax,%eax
+  802ed6:	78 4d                	js     802f25 <devfile_read+0x14b>
+        if (res == 0)
+  802ed8:	74 4f                	je     802f29 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802eda:	4c 63 e0             	movslq %eax,%r12
+  802edd:	4c 89 e2             	mov    %r12,%rdx
+  802ee0:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802ee4:	4c 89 f7             	mov    %r14,%rdi
+  802ee7:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  802eee:	00 00 00 
+  802ef1:	ff d0                	call   *%rax
+        i += res;
+  802ef3:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802ef6:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802ef9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802efd:	48 39 c3             	cmp    %rax,%rbx
+  802f00:	0f 82 72 ff ff ff    	jb     802e78 <devfile_read+0x9e>
+    return i;
+  802f06:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802f09:	48 85 c0             	test   %rax,%rax
+  802f0c:	7e 04                	jle    802f12 <devfile_read+0x138>
+  802f0e:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802f12:	48 83 c4 28          	add    $0x28,%rsp
+  802f16:	5b                   	pop    %rbx
+  802f17:	41 5c                	pop    %r12
+  802f19:	41 5d                	pop    %r13
+  802f1b:	41 5e                	pop    %r14
+  802f1d:	41 5f                	pop    %r15
+  802f1f:	5d                   	pop    %rbp
+  802f20:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f21:	48 98                	cltq
+  802f23:	eb ed                	jmp    802f12 <devfile_read+0x138>
+            return res;
+  802f25:	48 98                	cltq
+  802f27:	eb e9                	jmp    802f12 <devfile_read+0x138>
+            return i;
+  802f29:	48 89 d8             	mov    %rbx,%rax
+  802f2c:	eb db                	jmp    802f09 <devfile_read+0x12f>
+    size_t i = 0;
+  802f2e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f32:	eb d2                	jmp    802f06 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802f34:	48 89 c6             	mov    %rax,%rsi
+  802f37:	4c 89 ff             	mov    %r15,%rdi
+  802f3a:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	78 40                	js     802f8a <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f4a:	4c 89 ff             	mov    %r15,%rdi
+  802f4d:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802f54:	00 00 00 
+  802f57:	ff d0                	call   *%rax
+  802f59:	48 89 c2             	mov    %rax,%rdx
+  802f5c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f60:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f64:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f68:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802f6d:	48 01 d0             	add    %rdx,%rax
+  802f70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802f74:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f79:	0f 84 33 01 00 00    	je     8030b2 <devfile_read+0x2d8>
+    size_t i = 0;
+  802f7f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802f85:	e9 f5 00 00 00       	jmp    80307f <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802f8a:	48 98                	cltq
+  802f8c:	eb 84                	jmp    802f12 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f8e:	44 89 e8             	mov    %r13d,%eax
+  802f91:	66 b8 00 00          	mov    $0x0,%ax
+  802f95:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802f9a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802fa1:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802fa3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802fa7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fab:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802fad:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802fb2:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802fb5:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802fbc:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802fbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fc8:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802fcd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fd2:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  802fd9:	00 00 00 
+  802fdc:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802fde:	85 c0                	test   %eax,%eax
+  802fe0:	0f 88 be 00 00 00    	js     8030a4 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802fe6:	48 63 d0             	movslq %eax,%rdx
+  802fe9:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802fee:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802ff3:	44 39 e8             	cmp    %r13d,%eax
+  802ff6:	0f 8e ba 00 00 00    	jle    8030b6 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802ffc:	49 63 c5             	movslq %r13d,%rax
+  802fff:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803004:	48 29 c3             	sub    %rax,%rbx
+  803007:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80300c:	48 01 c3             	add    %rax,%rbx
+  80300f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803013:	4c 29 f0             	sub    %r14,%rax
+  803016:	48 39 c3             	cmp    %rax,%rbx
+  803019:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80301d:	4c 89 ff             	mov    %r15,%rdi
+  803020:	48 b9 50 1d 80 00 00 	movabs $0x801d50,%rcx
+  803027:	00 00 00 
+  80302a:	ff d1                	call   *%rcx
+  80302c:	48 89 c2             	mov    %rax,%rdx
+  80302f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803033:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803037:	48 c1 e0 0c          	shl    $0xc,%rax
+  80303b:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803040:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803043:	44 89 ea             	mov    %r13d,%edx
+  803046:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80304b:	48 63 d2             	movslq %edx,%rdx
+  80304e:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803055:	00 
+  803056:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80305a:	4c 01 f7             	add    %r14,%rdi
+  80305d:	48 89 da             	mov    %rbx,%rdx
+  803060:	48 b9 cf 0f 80 00 00 	movabs $0x800fcf,%rcx
+  803067:	00 00 00 
+  80306a:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80306c:	41 01 dd             	add    %ebx,%r13d
+  80306f:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803073:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803076:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80307a:	49 39 c6             	cmp    %rax,%r14
+  80307d:	73 37                	jae    8030b6 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80307f:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803083:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803088:	44 39 e8             	cmp    %r13d,%eax
+  80308b:	0f 8f fd fe ff ff    	jg     802f8e <devfile_read+0x1b4>
+  803091:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803096:	44 39 e8             	cmp    %r13d,%eax
+  803099:	0f 8f 5d ff ff ff    	jg     802ffc <devfile_read+0x222>
+  80309f:	e9 ea fe ff ff       	jmp    802f8e <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8030a4:	48 98                	cltq
+  8030a6:	4d 85 f6             	test   %r14,%r14
+  8030a9:	49 0f 45 c6          	cmovne %r14,%rax
+  8030ad:	e9 60 fe ff ff       	jmp    802f12 <devfile_read+0x138>
+    size_t i = 0;
+  8030b2:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8030b6:	4c 89 f0             	mov    %r14,%rax
+  8030b9:	e9 54 fe ff ff       	jmp    802f12 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8030be:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8030c5:	e9 48 fe ff ff       	jmp    802f12 <devfile_read+0x138>
+
+00000000008030ca <open>:
+open(const char *path, int mode) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	41 55                	push   %r13
+  8030d0:	41 54                	push   %r12
+  8030d2:	53                   	push   %rbx
+  8030d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8030d7:	49 89 fc             	mov    %rdi,%r12
+  8030da:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8030dd:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  8030e4:	00 00 00 
+  8030e7:	ff d0                	call   *%rax
+  8030e9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030ef:	0f 87 8a 00 00 00    	ja     80317f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8030f5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030f9:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+  803105:	89 c3                	mov    %eax,%ebx
+  803107:	85 c0                	test   %eax,%eax
+  803109:	78 50                	js     80315b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80310b:	4c 89 e6             	mov    %r12,%rsi
+  80310e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803115:	00 00 00 
+  803118:	48 89 df             	mov    %rbx,%rdi
+  80311b:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803127:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80312e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803132:	bf 01 00 00 00       	mov    $0x1,%edi
+  803137:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+  803143:	89 c3                	mov    %eax,%ebx
+  803145:	85 c0                	test   %eax,%eax
+  803147:	78 1f                	js     803168 <open+0x9e>
+    return fd2num(fd);
+  803149:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80314d:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  803159:	89 c3                	mov    %eax,%ebx
+}
+  80315b:	89 d8                	mov    %ebx,%eax
+  80315d:	48 83 c4 18          	add    $0x18,%rsp
+  803161:	5b                   	pop    %rbx
+  803162:	41 5c                	pop    %r12
+  803164:	41 5d                	pop    %r13
+  803166:	5d                   	pop    %rbp
+  803167:	c3                   	ret
+        fd_close(fd, 0);
+  803168:	be 00 00 00 00       	mov    $0x0,%esi
+  80316d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803171:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+        return res;
+  80317d:	eb dc                	jmp    80315b <open+0x91>
+        return -E_BAD_PATH;
+  80317f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803184:	eb d5                	jmp    80315b <open+0x91>
+
+0000000000803186 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803186:	55                   	push   %rbp
+  803187:	48 89 e5             	mov    %rsp,%rbp
+  80318a:	41 57                	push   %r15
+  80318c:	41 56                	push   %r14
+  80318e:	41 55                	push   %r13
+  803190:	41 54                	push   %r12
+  803192:	53                   	push   %rbx
+  803193:	48 83 ec 18          	sub    $0x18,%rsp
+  803197:	41 89 f6             	mov    %esi,%r14d
+  80319a:	49 89 d7             	mov    %rdx,%r15
+  80319d:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8031a0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8031a4:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031b0:	85 c0                	test   %eax,%eax
+  8031b2:	0f 88 db 00 00 00    	js     803293 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8031b8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031bc:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8031c3:	00 00 00 
+  8031c6:	8b 00                	mov    (%rax),%eax
+  8031c8:	39 07                	cmp    %eax,(%rdi)
+  8031ca:	0f 85 db 00 00 00    	jne    8032ab <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8031d0:	45 85 f6             	test   %r14d,%r14d
+  8031d3:	0f 88 db 00 00 00    	js     8032b4 <fmap+0x12e>
+  8031d9:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8031e0:	0f 85 d7 00 00 00    	jne    8032bd <fmap+0x137>
+  8031e6:	4c 89 fb             	mov    %r15,%rbx
+  8031e9:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8031ef:	0f 85 d1 00 00 00    	jne    8032c6 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8031f5:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+  803201:	85 c0                	test   %eax,%eax
+  803203:	0f 88 8e 00 00 00    	js     803297 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803209:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803210:	00 00 00 
+    while (i < n) {
+  803213:	4d 85 ed             	test   %r13,%r13
+  803216:	0f 84 8a 00 00 00    	je     8032a6 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80321c:	4c 89 ea             	mov    %r13,%rdx
+  80321f:	48 29 da             	sub    %rbx,%rdx
+  803222:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803229:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80322f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803233:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803237:	8b 40 0c             	mov    0xc(%rax),%eax
+  80323a:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80323e:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803242:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803247:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80324c:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803250:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803254:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803259:	4c 89 e6             	mov    %r12,%rsi
+  80325c:	bf 09 00 00 00       	mov    $0x9,%edi
+  803261:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  803268:	00 00 00 
+  80326b:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80326d:	85 c0                	test   %eax,%eax
+  80326f:	78 2a                	js     80329b <fmap+0x115>
+        i += res;
+  803271:	48 98                	cltq
+  803273:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803276:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80327a:	72 05                	jb     803281 <fmap+0xfb>
+    while (i < n) {
+  80327c:	4c 39 eb             	cmp    %r13,%rbx
+  80327f:	72 9b                	jb     80321c <fmap+0x96>
+    }
+    return i;
+  803281:	48 89 d8             	mov    %rbx,%rax
+}
+  803284:	48 83 c4 18          	add    $0x18,%rsp
+  803288:	5b                   	pop    %rbx
+  803289:	41 5c                	pop    %r12
+  80328b:	41 5d                	pop    %r13
+  80328d:	41 5e                	pop    %r14
+  80328f:	41 5f                	pop    %r15
+  803291:	5d                   	pop    %rbp
+  803292:	c3                   	ret
+    if (res < 0) return res;
+  803293:	48 98                	cltq
+  803295:	eb ed                	jmp    803284 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803297:	48 98                	cltq
+  803299:	eb e9                	jmp    803284 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80329b:	48 98                	cltq
+  80329d:	48 85 db             	test   %rbx,%rbx
+  8032a0:	48 0f 45 c3          	cmovne %rbx,%rax
+  8032a4:	eb de                	jmp    803284 <fmap+0xfe>
+    size_t i = 0;
+  8032a6:	4c 89 eb             	mov    %r13,%rbx
+  8032a9:	eb d6                	jmp    803281 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8032ab:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032b2:	eb d0                	jmp    803284 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8032b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032bb:	eb c7                	jmp    803284 <fmap+0xfe>
+  8032bd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032c4:	eb be                	jmp    803284 <fmap+0xfe>
+  8032c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032cd:	eb b5                	jmp    803284 <fmap+0xfe>
+
+00000000008032cf <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+  8032d3:	41 56                	push   %r14
+  8032d5:	41 55                	push   %r13
+  8032d7:	41 54                	push   %r12
+  8032d9:	53                   	push   %rbx
+  8032da:	48 83 ec 10          	sub    $0x10,%rsp
+  8032de:	89 fb                	mov    %edi,%ebx
+  8032e0:	41 89 f4             	mov    %esi,%r12d
+  8032e3:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032e6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032ea:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8032f1:	00 00 00 
+  8032f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f6:	85 c0                	test   %eax,%eax
+  8032f8:	78 63                	js     80335d <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8032fa:	45 85 e4             	test   %r12d,%r12d
+  8032fd:	0f 88 80 00 00 00    	js     803383 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803303:	45 89 e6             	mov    %r12d,%r14d
+  803306:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80330d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803311:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	48 89 c2             	mov    %rax,%rdx
+  803320:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803325:	44 89 f6             	mov    %r14d,%esi
+  803328:	89 df                	mov    %ebx,%edi
+  80332a:	48 b8 86 31 80 00 00 	movabs $0x803186,%rax
+  803331:	00 00 00 
+  803334:	ff d0                	call   *%rax
+  803336:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803339:	45 29 f4             	sub    %r14d,%r12d
+  80333c:	4d 63 f4             	movslq %r12d,%r14
+  80333f:	49 39 c6             	cmp    %rax,%r14
+  803342:	7c 1d                	jl     803361 <read_map+0x92>
+  803344:	48 85 c0             	test   %rax,%rax
+  803347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334c:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803350:	48 83 c4 10          	add    $0x10,%rsp
+  803354:	5b                   	pop    %rbx
+  803355:	41 5c                	pop    %r12
+  803357:	41 5d                	pop    %r13
+  803359:	41 5e                	pop    %r14
+  80335b:	5d                   	pop    %rbp
+  80335c:	c3                   	ret
+    if (res < 0) return res;
+  80335d:	48 98                	cltq
+  80335f:	eb ef                	jmp    803350 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803361:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803365:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+  803371:	4d 63 e4             	movslq %r12d,%r12
+  803374:	4c 01 e0             	add    %r12,%rax
+  803377:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80337b:	48 89 d8             	mov    %rbx,%rax
+  80337e:	4c 29 f0             	sub    %r14,%rax
+  803381:	eb cd                	jmp    803350 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803383:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80338a:	eb c4                	jmp    803350 <read_map+0x81>
+
+000000000080338c <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80338c:	55                   	push   %rbp
+  80338d:	48 89 e5             	mov    %rsp,%rbp
+  803390:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803394:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803398:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80339f:	00 00 00 
+  8033a2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033a4:	85 c0                	test   %eax,%eax
+  8033a6:	78 4a                	js     8033f2 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033a8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033ac:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033b3:	00 00 00 
+  8033b6:	8b 00                	mov    (%rax),%eax
+  8033b8:	39 07                	cmp    %eax,(%rdi)
+  8033ba:	75 38                	jne    8033f4 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033bc:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  8033c3:	00 00 00 
+  8033c6:	ff d0                	call   *%rax
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	78 26                	js     8033f2 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8033cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033d3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8033da:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8033dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8033e6:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  8033ed:	00 00 00 
+  8033f0:	ff d0                	call   *%rax
+}
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033f4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033f9:	eb f7                	jmp    8033f2 <fsync+0x66>
+
+00000000008033fb <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8033fb:	55                   	push   %rbp
+  8033fc:	48 89 e5             	mov    %rsp,%rbp
+  8033ff:	41 57                	push   %r15
+  803401:	41 56                	push   %r14
+  803403:	41 55                	push   %r13
+  803405:	41 54                	push   %r12
+  803407:	53                   	push   %rbx
+  803408:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80340c:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803413:	00 00 00 
+  803416:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80341b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803421:	49 bd de 1d 80 00 00 	movabs $0x801dde,%r13
+  803428:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80342b:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803432:	00 00 00 
+  803435:	eb 0c                	jmp    803443 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803437:	83 c3 01             	add    $0x1,%ebx
+  80343a:	49 83 c4 28          	add    $0x28,%r12
+  80343e:	83 fb 20             	cmp    $0x20,%ebx
+  803441:	74 33                	je     803476 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803443:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803448:	74 ed                	je     803437 <flushall+0x3c>
+  80344a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80344e:	89 df                	mov    %ebx,%edi
+  803450:	41 ff d5             	call   *%r13
+  803453:	85 c0                	test   %eax,%eax
+  803455:	78 e0                	js     803437 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803457:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80345b:	41 8b 06             	mov    (%r14),%eax
+  80345e:	39 07                	cmp    %eax,(%rdi)
+  803460:	75 d5                	jne    803437 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803462:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  803469:	00 00 00 
+  80346c:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80346e:	85 c0                	test   %eax,%eax
+  803470:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803474:	eb c1                	jmp    803437 <flushall+0x3c>
+    }
+    return res;
+}
+  803476:	44 89 f8             	mov    %r15d,%eax
+  803479:	48 83 c4 18          	add    $0x18,%rsp
+  80347d:	5b                   	pop    %rbx
+  80347e:	41 5c                	pop    %r12
+  803480:	41 5d                	pop    %r13
+  803482:	41 5e                	pop    %r14
+  803484:	41 5f                	pop    %r15
+  803486:	5d                   	pop    %rbp
+  803487:	c3                   	ret
+
+0000000000803488 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803488:	55                   	push   %rbp
+  803489:	48 89 e5             	mov    %rsp,%rbp
+  80348c:	53                   	push   %rbx
+  80348d:	48 83 ec 08          	sub    $0x8,%rsp
+  803491:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803494:	40 0f b6 c6          	movzbl %sil,%eax
+  803498:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80349f:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8034a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034ab:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	78 23                	js     8034de <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8034bb:	ba 58 06 00 00       	mov    $0x658,%edx
+  8034c0:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8034c7:	00 00 00 
+  8034ca:	48 89 df             	mov    %rbx,%rdi
+  8034cd:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+    return 0;
+  8034d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034e2:	c9                   	leave
+  8034e3:	c3                   	ret
+
+00000000008034e4 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8034e4:	55                   	push   %rbp
+  8034e5:	48 89 e5             	mov    %rsp,%rbp
+  8034e8:	53                   	push   %rbx
+  8034e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ed:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8034f0:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+  8034fc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803502:	77 35                	ja     803539 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803504:	48 89 de             	mov    %rbx,%rsi
+  803507:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80350e:	00 00 00 
+  803511:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80351d:	be 00 00 00 00       	mov    $0x0,%esi
+  803522:	bf 07 00 00 00       	mov    $0x7,%edi
+  803527:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+}
+  803533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+        return -E_BAD_PATH;
+  803539:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80353e:	eb f3                	jmp    803533 <remove+0x4f>
+
+0000000000803540 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803540:	55                   	push   %rbp
+  803541:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803544:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803550:	be 00 00 00 00       	mov    $0x0,%esi
+  803555:	bf 08 00 00 00       	mov    $0x8,%edi
+  80355a:	48 b8 50 29 80 00 00 	movabs $0x802950,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+}
+  803566:	5d                   	pop    %rbp
+  803567:	c3                   	ret
+
+0000000000803568 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 54                	push   %r12
+  80356e:	53                   	push   %rbx
+  80356f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803572:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  803579:	00 00 00 
+  80357c:	ff d0                	call   *%rax
+  80357e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803581:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  803588:	00 00 00 
+  80358b:	48 89 df             	mov    %rbx,%rdi
+  80358e:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  803595:	00 00 00 
+  803598:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80359a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80359f:	41 2b 04 24          	sub    (%r12),%eax
+  8035a3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035a9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035b0:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035b3:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8035ba:	00 00 00 
+  8035bd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c9:	5b                   	pop    %rbx
+  8035ca:	41 5c                	pop    %r12
+  8035cc:	5d                   	pop    %rbp
+  8035cd:	c3                   	ret
+
+00000000008035ce <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8035ce:	55                   	push   %rbp
+  8035cf:	48 89 e5             	mov    %rsp,%rbp
+  8035d2:	41 54                	push   %r12
+  8035d4:	53                   	push   %rbx
+  8035d5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8035d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035dd:	48 89 fe             	mov    %rdi,%rsi
+  8035e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e5:	49 bc 19 15 80 00 00 	movabs $0x801519,%r12
+  8035ec:	00 00 00 
+  8035ef:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8035f2:	48 89 df             	mov    %rbx,%rdi
+  8035f5:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8035fc:	00 00 00 
+  8035ff:	ff d0                	call   *%rax
+  803601:	48 89 c6             	mov    %rax,%rsi
+  803604:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803609:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360e:	41 ff d4             	call   *%r12
+}
+  803611:	5b                   	pop    %rbx
+  803612:	41 5c                	pop    %r12
+  803614:	5d                   	pop    %rbp
+  803615:	c3                   	ret
+
+0000000000803616 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803616:	55                   	push   %rbp
+  803617:	48 89 e5             	mov    %rsp,%rbp
+  80361a:	41 57                	push   %r15
+  80361c:	41 56                	push   %r14
+  80361e:	41 55                	push   %r13
+  803620:	41 54                	push   %r12
+  803622:	53                   	push   %rbx
+  803623:	48 83 ec 18          	sub    $0x18,%rsp
+  803627:	49 89 fc             	mov    %rdi,%r12
+  80362a:	49 89 f5             	mov    %rsi,%r13
+  80362d:	49 89 d7             	mov    %rdx,%r15
+  803630:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803634:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80363b:	00 00 00 
+  80363e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803640:	4d 85 ff             	test   %r15,%r15
+  803643:	0f 84 af 00 00 00    	je     8036f8 <devpipe_write+0xe2>
+  803649:	48 89 c3             	mov    %rax,%rbx
+  80364c:	4c 89 f8             	mov    %r15,%rax
+  80364f:	4d 89 ef             	mov    %r13,%r15
+  803652:	4c 01 e8             	add    %r13,%rax
+  803655:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803659:	49 bd 0e 13 80 00 00 	movabs $0x80130e,%r13
+  803660:	00 00 00 
+            sys_yield();
+  803663:	49 be ab 12 80 00 00 	movabs $0x8012ab,%r14
+  80366a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80366d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803670:	48 63 ce             	movslq %esi,%rcx
+  803673:	48 63 03             	movslq (%rbx),%rax
+  803676:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80367c:	48 39 c1             	cmp    %rax,%rcx
+  80367f:	72 2e                	jb     8036af <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803681:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803686:	48 89 da             	mov    %rbx,%rdx
+  803689:	be 00 10 00 00       	mov    $0x1000,%esi
+  80368e:	4c 89 e7             	mov    %r12,%rdi
+  803691:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803694:	85 c0                	test   %eax,%eax
+  803696:	74 66                	je     8036fe <devpipe_write+0xe8>
+            sys_yield();
+  803698:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80369b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80369e:	48 63 ce             	movslq %esi,%rcx
+  8036a1:	48 63 03             	movslq (%rbx),%rax
+  8036a4:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8036aa:	48 39 c1             	cmp    %rax,%rcx
+  8036ad:	73 d2                	jae    803681 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8036af:	41 0f b6 3f          	movzbl (%r15),%edi
+  8036b3:	48 89 ca             	mov    %rcx,%rdx
+  8036b6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8036ba:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8036c1:	08 10 20 
+  8036c4:	48 f7 e2             	mul    %rdx
+  8036c7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8036cb:	48 89 d0             	mov    %rdx,%rax
+  8036ce:	48 c1 e0 09          	shl    $0x9,%rax
+  8036d2:	48 29 d0             	sub    %rdx,%rax
+  8036d5:	48 c1 e0 03          	shl    $0x3,%rax
+  8036d9:	48 29 c1             	sub    %rax,%rcx
+  8036dc:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8036e1:	83 c6 01             	add    $0x1,%esi
+  8036e4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8036e7:	49 83 c7 01          	add    $0x1,%r15
+  8036eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036ef:	49 39 c7             	cmp    %rax,%r15
+  8036f2:	0f 85 75 ff ff ff    	jne    80366d <devpipe_write+0x57>
+    return n;
+  8036f8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036fc:	eb 05                	jmp    803703 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803703:	48 83 c4 18          	add    $0x18,%rsp
+  803707:	5b                   	pop    %rbx
+  803708:	41 5c                	pop    %r12
+  80370a:	41 5d                	pop    %r13
+  80370c:	41 5e                	pop    %r14
+  80370e:	41 5f                	pop    %r15
+  803710:	5d                   	pop    %rbp
+  803711:	c3                   	ret
+
+0000000000803712 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803712:	55                   	push   %rbp
+  803713:	48 89 e5             	mov    %rsp,%rbp
+  803716:	41 57                	push   %r15
+  803718:	41 56                	push   %r14
+  80371a:	41 55                	push   %r13
+  80371c:	41 54                	push   %r12
+  80371e:	53                   	push   %rbx
+  80371f:	48 83 ec 18          	sub    $0x18,%rsp
+  803723:	49 89 fc             	mov    %rdi,%r12
+  803726:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80372a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80372e:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+  80373a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80373d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803743:	49 bd 0e 13 80 00 00 	movabs $0x80130e,%r13
+  80374a:	00 00 00 
+            sys_yield();
+  80374d:	49 be ab 12 80 00 00 	movabs $0x8012ab,%r14
+  803754:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803757:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80375c:	74 7d                	je     8037db <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80375e:	8b 03                	mov    (%rbx),%eax
+  803760:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803763:	75 26                	jne    80378b <devpipe_read+0x79>
+            if (i > 0) return i;
+  803765:	4d 85 ff             	test   %r15,%r15
+  803768:	75 77                	jne    8037e1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80376a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80376f:	48 89 da             	mov    %rbx,%rdx
+  803772:	be 00 10 00 00       	mov    $0x1000,%esi
+  803777:	4c 89 e7             	mov    %r12,%rdi
+  80377a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	74 72                	je     8037f3 <devpipe_read+0xe1>
+            sys_yield();
+  803781:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803784:	8b 03                	mov    (%rbx),%eax
+  803786:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803789:	74 df                	je     80376a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80378b:	48 63 c8             	movslq %eax,%rcx
+  80378e:	48 89 ca             	mov    %rcx,%rdx
+  803791:	48 c1 ea 03          	shr    $0x3,%rdx
+  803795:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80379c:	08 10 20 
+  80379f:	48 89 d0             	mov    %rdx,%rax
+  8037a2:	48 f7 e6             	mul    %rsi
+  8037a5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8037a9:	48 89 d0             	mov    %rdx,%rax
+  8037ac:	48 c1 e0 09          	shl    $0x9,%rax
+  8037b0:	48 29 d0             	sub    %rdx,%rax
+  8037b3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8037ba:	00 
+  8037bb:	48 89 c8             	mov    %rcx,%rax
+  8037be:	48 29 d0             	sub    %rdx,%rax
+  8037c1:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8037c6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037ca:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8037ce:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037d1:	49 83 c7 01          	add    $0x1,%r15
+  8037d5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8037d9:	75 83                	jne    80375e <devpipe_read+0x4c>
+    return n;
+  8037db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037df:	eb 03                	jmp    8037e4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8037e1:	4c 89 f8             	mov    %r15,%rax
+}
+  8037e4:	48 83 c4 18          	add    $0x18,%rsp
+  8037e8:	5b                   	pop    %rbx
+  8037e9:	41 5c                	pop    %r12
+  8037eb:	41 5d                	pop    %r13
+  8037ed:	41 5e                	pop    %r14
+  8037ef:	41 5f                	pop    %r15
+  8037f1:	5d                   	pop    %rbp
+  8037f2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8037f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f8:	eb ea                	jmp    8037e4 <devpipe_read+0xd2>
+
+00000000008037fa <pipe>:
+pipe(int pfd[2]) {
+  8037fa:	55                   	push   %rbp
+  8037fb:	48 89 e5             	mov    %rsp,%rbp
+  8037fe:	41 55                	push   %r13
+  803800:	41 54                	push   %r12
+  803802:	53                   	push   %rbx
+  803803:	48 83 ec 18          	sub    $0x18,%rsp
+  803807:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80380a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80380e:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  803815:	00 00 00 
+  803818:	ff d0                	call   *%rax
+  80381a:	89 c3                	mov    %eax,%ebx
+  80381c:	85 c0                	test   %eax,%eax
+  80381e:	0f 88 a0 01 00 00    	js     8039c4 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803824:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803829:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80382e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803832:	bf 00 00 00 00       	mov    $0x0,%edi
+  803837:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  80383e:	00 00 00 
+  803841:	ff d0                	call   *%rax
+  803843:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803845:	85 c0                	test   %eax,%eax
+  803847:	0f 88 77 01 00 00    	js     8039c4 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80384d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803851:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  803858:	00 00 00 
+  80385b:	ff d0                	call   *%rax
+  80385d:	89 c3                	mov    %eax,%ebx
+  80385f:	85 c0                	test   %eax,%eax
+  803861:	0f 88 43 01 00 00    	js     8039aa <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803867:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80386c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803871:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803875:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387a:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  803881:	00 00 00 
+  803884:	ff d0                	call   *%rax
+  803886:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803888:	85 c0                	test   %eax,%eax
+  80388a:	0f 88 1a 01 00 00    	js     8039aa <pipe+0x1b0>
+    va = fd2data(fd0);
+  803890:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803894:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  80389b:	00 00 00 
+  80389e:	ff d0                	call   *%rax
+  8038a0:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8038a3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038ad:	48 89 c6             	mov    %rax,%rsi
+  8038b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b5:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  8038bc:	00 00 00 
+  8038bf:	ff d0                	call   *%rax
+  8038c1:	89 c3                	mov    %eax,%ebx
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	0f 88 c5 00 00 00    	js     803990 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8038cb:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038cf:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  8038d6:	00 00 00 
+  8038d9:	ff d0                	call   *%rax
+  8038db:	48 89 c1             	mov    %rax,%rcx
+  8038de:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8038e4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8038ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038ef:	4c 89 ee             	mov    %r13,%rsi
+  8038f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f7:	48 b8 a1 13 80 00 00 	movabs $0x8013a1,%rax
+  8038fe:	00 00 00 
+  803901:	ff d0                	call   *%rax
+  803903:	89 c3                	mov    %eax,%ebx
+  803905:	85 c0                	test   %eax,%eax
+  803907:	78 6e                	js     803977 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803909:	be 00 10 00 00       	mov    $0x1000,%esi
+  80390e:	4c 89 ef             	mov    %r13,%rdi
+  803911:	48 b8 dc 12 80 00 00 	movabs $0x8012dc,%rax
+  803918:	00 00 00 
+  80391b:	ff d0                	call   *%rax
+  80391d:	83 f8 02             	cmp    $0x2,%eax
+  803920:	0f 85 ab 00 00 00    	jne    8039d1 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803926:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80392d:	00 00 
+  80392f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803933:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803935:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803939:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803940:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803944:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803946:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80394a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803951:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803955:	48 bb 50 1d 80 00 00 	movabs $0x801d50,%rbx
+  80395c:	00 00 00 
+  80395f:	ff d3                	call   *%rbx
+  803961:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803965:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803969:	ff d3                	call   *%rbx
+  80396b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803970:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803975:	eb 4d                	jmp    8039c4 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803977:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80397c:	4c 89 ee             	mov    %r13,%rsi
+  80397f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803984:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  80398b:	00 00 00 
+  80398e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803990:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803995:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80399e:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8039aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039af:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039b8:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  8039bf:	00 00 00 
+  8039c2:	ff d0                	call   *%rax
+}
+  8039c4:	89 d8                	mov    %ebx,%eax
+  8039c6:	48 83 c4 18          	add    $0x18,%rsp
+  8039ca:	5b                   	pop    %rbx
+  8039cb:	41 5c                	pop    %r12
+  8039cd:	41 5d                	pop    %r13
+  8039cf:	5d                   	pop    %rbp
+  8039d0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8039d1:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  8039d8:	00 00 00 
+  8039db:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  8039e2:	00 00 00 
+  8039e5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8039ea:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  8039f1:	00 00 00 
+  8039f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f9:	49 b8 d9 3f 80 00 00 	movabs $0x803fd9,%r8
+  803a00:	00 00 00 
+  803a03:	41 ff d0             	call   *%r8
+
+0000000000803a06 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803a06:	55                   	push   %rbp
+  803a07:	48 89 e5             	mov    %rsp,%rbp
+  803a0a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803a0e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a12:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  803a19:	00 00 00 
+  803a1c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	78 35                	js     803a57 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803a22:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a26:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  803a2d:	00 00 00 
+  803a30:	ff d0                	call   *%rax
+  803a32:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a35:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a3a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a3f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a43:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  803a4a:	00 00 00 
+  803a4d:	ff d0                	call   *%rax
+  803a4f:	85 c0                	test   %eax,%eax
+  803a51:	0f 94 c0             	sete   %al
+  803a54:	0f b6 c0             	movzbl %al,%eax
+}
+  803a57:	c9                   	leave
+  803a58:	c3                   	ret
+
+0000000000803a59 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a59:	48 89 f8             	mov    %rdi,%rax
+  803a5c:	48 c1 e8 27          	shr    $0x27,%rax
+  803a60:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a67:	7f 00 00 
+  803a6a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a6e:	f6 c2 01             	test   $0x1,%dl
+  803a71:	74 6d                	je     803ae0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a73:	48 89 f8             	mov    %rdi,%rax
+  803a76:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a7a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a81:	7f 00 00 
+  803a84:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a88:	f6 c2 01             	test   $0x1,%dl
+  803a8b:	74 62                	je     803aef <get_uvpt_entry+0x96>
+  803a8d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a94:	7f 00 00 
+  803a97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a9b:	f6 c2 80             	test   $0x80,%dl
+  803a9e:	75 4f                	jne    803aef <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803aa0:	48 89 f8             	mov    %rdi,%rax
+  803aa3:	48 c1 e8 15          	shr    $0x15,%rax
+  803aa7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803aae:	7f 00 00 
+  803ab1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ab5:	f6 c2 01             	test   $0x1,%dl
+  803ab8:	74 44                	je     803afe <get_uvpt_entry+0xa5>
+  803aba:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ac1:	7f 00 00 
+  803ac4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ac8:	f6 c2 80             	test   $0x80,%dl
+  803acb:	75 31                	jne    803afe <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803acd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ad1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ad8:	7f 00 00 
+  803adb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803adf:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ae0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ae7:	7f 00 00 
+  803aea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803aee:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803aef:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803af6:	7f 00 00 
+  803af9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803afd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803afe:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803b05:	7f 00 00 
+  803b08:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b0c:	c3                   	ret
+
+0000000000803b0d <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803b0d:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803b10:	48 89 f9             	mov    %rdi,%rcx
+  803b13:	48 c1 e9 27          	shr    $0x27,%rcx
+  803b17:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803b1e:	7f 00 00 
+  803b21:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803b25:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803b2c:	f6 c1 01             	test   $0x1,%cl
+  803b2f:	0f 84 b2 00 00 00    	je     803be7 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803b35:	48 89 f9             	mov    %rdi,%rcx
+  803b38:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803b3c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b43:	7f 00 00 
+  803b46:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b4a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803b51:	40 f6 c6 01          	test   $0x1,%sil
+  803b55:	0f 84 8c 00 00 00    	je     803be7 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803b5b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b62:	7f 00 00 
+  803b65:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b69:	a8 80                	test   $0x80,%al
+  803b6b:	75 7b                	jne    803be8 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b6d:	48 89 f9             	mov    %rdi,%rcx
+  803b70:	48 c1 e9 15          	shr    $0x15,%rcx
+  803b74:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b7b:	7f 00 00 
+  803b7e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b82:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b89:	40 f6 c6 01          	test   $0x1,%sil
+  803b8d:	74 58                	je     803be7 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803b8f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b96:	7f 00 00 
+  803b99:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b9d:	a8 80                	test   $0x80,%al
+  803b9f:	75 6c                	jne    803c0d <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ba1:	48 89 f9             	mov    %rdi,%rcx
+  803ba4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ba8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803baf:	7f 00 00 
+  803bb2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803bb6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803bbd:	40 f6 c6 01          	test   $0x1,%sil
+  803bc1:	74 24                	je     803be7 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803bc3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803bca:	7f 00 00 
+  803bcd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803bd1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803bd8:	ff ff 7f 
+  803bdb:	48 21 c8             	and    %rcx,%rax
+  803bde:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803be4:	48 09 d0             	or     %rdx,%rax
+}
+  803be7:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803be8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803bef:	7f 00 00 
+  803bf2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803bf6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803bfd:	ff ff 7f 
+  803c00:	48 21 c8             	and    %rcx,%rax
+  803c03:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803c09:	48 01 d0             	add    %rdx,%rax
+  803c0c:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803c0d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c14:	7f 00 00 
+  803c17:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c1b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803c22:	ff ff 7f 
+  803c25:	48 21 c8             	and    %rcx,%rax
+  803c28:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803c2e:	48 01 d0             	add    %rdx,%rax
+  803c31:	c3                   	ret
+
+0000000000803c32 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c32:	55                   	push   %rbp
+  803c33:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c36:	48 b8 59 3a 80 00 00 	movabs $0x803a59,%rax
+  803c3d:	00 00 00 
+  803c40:	ff d0                	call   *%rax
+  803c42:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c45:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c4a:	89 c1                	mov    %eax,%ecx
+  803c4c:	83 c9 04             	or     $0x4,%ecx
+  803c4f:	f6 c2 01             	test   $0x1,%dl
+  803c52:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c55:	89 c1                	mov    %eax,%ecx
+  803c57:	83 c9 02             	or     $0x2,%ecx
+  803c5a:	f6 c2 02             	test   $0x2,%dl
+  803c5d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c60:	89 c1                	mov    %eax,%ecx
+  803c62:	83 c9 01             	or     $0x1,%ecx
+  803c65:	48 85 d2             	test   %rdx,%rdx
+  803c68:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c6b:	89 c1                	mov    %eax,%ecx
+  803c6d:	83 c9 40             	or     $0x40,%ecx
+  803c70:	f6 c6 04             	test   $0x4,%dh
+  803c73:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c76:	5d                   	pop    %rbp
+  803c77:	c3                   	ret
+
+0000000000803c78 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c78:	55                   	push   %rbp
+  803c79:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c7c:	48 b8 59 3a 80 00 00 	movabs $0x803a59,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c88:	48 c1 e8 06          	shr    $0x6,%rax
+  803c8c:	83 e0 01             	and    $0x1,%eax
+}
+  803c8f:	5d                   	pop    %rbp
+  803c90:	c3                   	ret
+
+0000000000803c91 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c91:	55                   	push   %rbp
+  803c92:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c95:	48 b8 59 3a 80 00 00 	movabs $0x803a59,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+  803ca1:	83 e0 01             	and    $0x1,%eax
+}
+  803ca4:	5d                   	pop    %rbp
+  803ca5:	c3                   	ret
+
+0000000000803ca6 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803ca6:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803cad:	7f 00 00 
+  803cb0:	a8 01                	test   $0x1,%al
+  803cb2:	75 06                	jne    803cba <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cba:	55                   	push   %rbp
+  803cbb:	48 89 e5             	mov    %rsp,%rbp
+  803cbe:	41 57                	push   %r15
+  803cc0:	41 56                	push   %r14
+  803cc2:	41 55                	push   %r13
+  803cc4:	41 54                	push   %r12
+  803cc6:	53                   	push   %rbx
+  803cc7:	48 83 ec 18          	sub    $0x18,%rsp
+  803ccb:	49 89 fe             	mov    %rdi,%r14
+  803cce:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cd1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803cd8:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803cd9:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803ce0:	7f 00 00 
+  803ce3:	e9 81 00 00 00       	jmp    803d69 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803ce8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cef:	49 39 dd             	cmp    %rbx,%r13
+  803cf2:	74 2b                	je     803d1f <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803cf4:	48 89 d8             	mov    %rbx,%rax
+  803cf7:	48 c1 e8 0c          	shr    $0xc,%rax
+  803cfb:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803cff:	f6 c2 01             	test   $0x1,%dl
+  803d02:	74 e4                	je     803ce8 <foreach_shared_region+0x42>
+  803d04:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803d08:	f6 c4 04             	test   $0x4,%ah
+  803d0b:	74 db                	je     803ce8 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803d0d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d14:	4c 89 fa             	mov    %r15,%rdx
+  803d17:	48 89 df             	mov    %rbx,%rdi
+  803d1a:	41 ff d6             	call   *%r14
+  803d1d:	eb c9                	jmp    803ce8 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803d1f:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803d26:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803d2a:	74 22                	je     803d4e <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803d2c:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803d33:	48 89 d8             	mov    %rbx,%rax
+  803d36:	48 c1 e8 15          	shr    $0x15,%rax
+  803d3a:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803d41:	7f 00 00 
+  803d44:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d48:	a8 01                	test   $0x1,%al
+  803d4a:	74 d3                	je     803d1f <foreach_shared_region+0x79>
+  803d4c:	eb a6                	jmp    803cf4 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803d4e:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803d55:	40 
+  803d56:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d5a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d61:	00 00 00 
+  803d64:	48 39 c1             	cmp    %rax,%rcx
+  803d67:	74 31                	je     803d9a <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803d69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d6d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d71:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803d78:	7f 00 00 
+  803d7b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d7f:	a8 01                	test   $0x1,%al
+  803d81:	74 cb                	je     803d4e <foreach_shared_region+0xa8>
+  803d83:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d87:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803d8e:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803d94:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d98:	eb 92                	jmp    803d2c <foreach_shared_region+0x86>
+}
+  803d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9f:	48 83 c4 18          	add    $0x18,%rsp
+  803da3:	5b                   	pop    %rbx
+  803da4:	41 5c                	pop    %r12
+  803da6:	41 5d                	pop    %r13
+  803da8:	41 5e                	pop    %r14
+  803daa:	41 5f                	pop    %r15
+  803dac:	5d                   	pop    %rbp
+  803dad:	c3                   	ret
+
+0000000000803dae <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db3:	c3                   	ret
+
+0000000000803db4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803db4:	55                   	push   %rbp
+  803db5:	48 89 e5             	mov    %rsp,%rbp
+  803db8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803dbb:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  803dc2:	00 00 00 
+  803dc5:	48 b8 da 0b 80 00 00 	movabs $0x800bda,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+    return 0;
+}
+  803dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd6:	5d                   	pop    %rbp
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dd8:	55                   	push   %rbp
+  803dd9:	48 89 e5             	mov    %rsp,%rbp
+  803ddc:	41 57                	push   %r15
+  803dde:	41 56                	push   %r14
+  803de0:	41 55                	push   %r13
+  803de2:	41 54                	push   %r12
+  803de4:	53                   	push   %rbx
+  803de5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803dec:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803df3:	48 85 d2             	test   %rdx,%rdx
+  803df6:	74 7a                	je     803e72 <devcons_write+0x9a>
+  803df8:	49 89 d6             	mov    %rdx,%r14
+  803dfb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e01:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803e06:	49 bf 68 0f 80 00 00 	movabs $0x800f68,%r15
+  803e0d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803e10:	4c 89 f3             	mov    %r14,%rbx
+  803e13:	48 29 f3             	sub    %rsi,%rbx
+  803e16:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803e1b:	48 39 c3             	cmp    %rax,%rbx
+  803e1e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803e22:	4c 63 eb             	movslq %ebx,%r13
+  803e25:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803e2c:	48 01 c6             	add    %rax,%rsi
+  803e2f:	4c 89 ea             	mov    %r13,%rdx
+  803e32:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803e39:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803e3c:	4c 89 ee             	mov    %r13,%rsi
+  803e3f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803e46:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  803e4d:	00 00 00 
+  803e50:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803e52:	41 01 dc             	add    %ebx,%r12d
+  803e55:	49 63 f4             	movslq %r12d,%rsi
+  803e58:	4c 39 f6             	cmp    %r14,%rsi
+  803e5b:	72 b3                	jb     803e10 <devcons_write+0x38>
+    return res;
+  803e5d:	49 63 c4             	movslq %r12d,%rax
+}
+  803e60:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803e67:	5b                   	pop    %rbx
+  803e68:	41 5c                	pop    %r12
+  803e6a:	41 5d                	pop    %r13
+  803e6c:	41 5e                	pop    %r14
+  803e6e:	41 5f                	pop    %r15
+  803e70:	5d                   	pop    %rbp
+  803e71:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803e72:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803e78:	eb e3                	jmp    803e5d <devcons_write+0x85>
+
+0000000000803e7a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e7a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e82:	48 85 c0             	test   %rax,%rax
+  803e85:	74 55                	je     803edc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e87:	55                   	push   %rbp
+  803e88:	48 89 e5             	mov    %rsp,%rbp
+  803e8b:	41 55                	push   %r13
+  803e8d:	41 54                	push   %r12
+  803e8f:	53                   	push   %rbx
+  803e90:	48 83 ec 08          	sub    $0x8,%rsp
+  803e94:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803e97:	48 bb de 11 80 00 00 	movabs $0x8011de,%rbx
+  803e9e:	00 00 00 
+  803ea1:	49 bc ab 12 80 00 00 	movabs $0x8012ab,%r12
+  803ea8:	00 00 00 
+  803eab:	eb 03                	jmp    803eb0 <devcons_read+0x36>
+  803ead:	41 ff d4             	call   *%r12
+  803eb0:	ff d3                	call   *%rbx
+  803eb2:	85 c0                	test   %eax,%eax
+  803eb4:	74 f7                	je     803ead <devcons_read+0x33>
+    if (c < 0) return c;
+  803eb6:	48 63 d0             	movslq %eax,%rdx
+  803eb9:	78 13                	js     803ece <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ec0:	83 f8 04             	cmp    $0x4,%eax
+  803ec3:	74 09                	je     803ece <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803ec5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803ec9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803ece:	48 89 d0             	mov    %rdx,%rax
+  803ed1:	48 83 c4 08          	add    $0x8,%rsp
+  803ed5:	5b                   	pop    %rbx
+  803ed6:	41 5c                	pop    %r12
+  803ed8:	41 5d                	pop    %r13
+  803eda:	5d                   	pop    %rbp
+  803edb:	c3                   	ret
+  803edc:	48 89 d0             	mov    %rdx,%rax
+  803edf:	c3                   	ret
+
+0000000000803ee0 <cputchar>:
+cputchar(int ch) {
+  803ee0:	55                   	push   %rbp
+  803ee1:	48 89 e5             	mov    %rsp,%rbp
+  803ee4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803ee8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803eec:	be 01 00 00 00       	mov    $0x1,%esi
+  803ef1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803ef5:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+}
+  803f01:	c9                   	leave
+  803f02:	c3                   	ret
+
+0000000000803f03 <getchar>:
+getchar(void) {
+  803f03:	55                   	push   %rbp
+  803f04:	48 89 e5             	mov    %rsp,%rbp
+  803f07:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803f0b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f10:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803f14:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f19:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  803f20:	00 00 00 
+  803f23:	ff d0                	call   *%rax
+  803f25:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803f27:	85 c0                	test   %eax,%eax
+  803f29:	78 06                	js     803f31 <getchar+0x2e>
+  803f2b:	74 08                	je     803f35 <getchar+0x32>
+  803f2d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803f31:	89 d0                	mov    %edx,%eax
+  803f33:	c9                   	leave
+  803f34:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803f35:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803f3a:	eb f5                	jmp    803f31 <getchar+0x2e>
+
+0000000000803f3c <iscons>:
+iscons(int fdnum) {
+  803f3c:	55                   	push   %rbp
+  803f3d:	48 89 e5             	mov    %rsp,%rbp
+  803f40:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f44:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f48:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  803f4f:	00 00 00 
+  803f52:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f54:	85 c0                	test   %eax,%eax
+  803f56:	78 18                	js     803f70 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803f58:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f5c:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803f63:	00 00 00 
+  803f66:	8b 00                	mov    (%rax),%eax
+  803f68:	39 02                	cmp    %eax,(%rdx)
+  803f6a:	0f 94 c0             	sete   %al
+  803f6d:	0f b6 c0             	movzbl %al,%eax
+}
+  803f70:	c9                   	leave
+  803f71:	c3                   	ret
+
+0000000000803f72 <opencons>:
+opencons(void) {
+  803f72:	55                   	push   %rbp
+  803f73:	48 89 e5             	mov    %rsp,%rbp
+  803f76:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f7a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803f7e:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  803f85:	00 00 00 
+  803f88:	ff d0                	call   *%rax
+  803f8a:	85 c0                	test   %eax,%eax
+  803f8c:	78 49                	js     803fd7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803f8e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f98:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa1:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  803fa8:	00 00 00 
+  803fab:	ff d0                	call   *%rax
+  803fad:	85 c0                	test   %eax,%eax
+  803faf:	78 26                	js     803fd7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803fb1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fb5:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803fbc:	00 00 
+  803fbe:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803fc0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fc4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803fcb:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  803fd2:	00 00 00 
+  803fd5:	ff d0                	call   *%rax
+}
+  803fd7:	c9                   	leave
+  803fd8:	c3                   	ret
+
+0000000000803fd9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803fd9:	55                   	push   %rbp
+  803fda:	48 89 e5             	mov    %rsp,%rbp
+  803fdd:	41 56                	push   %r14
+  803fdf:	41 55                	push   %r13
+  803fe1:	41 54                	push   %r12
+  803fe3:	53                   	push   %rbx
+  803fe4:	48 83 ec 50          	sub    $0x50,%rsp
+  803fe8:	49 89 fc             	mov    %rdi,%r12
+  803feb:	41 89 f5             	mov    %esi,%r13d
+  803fee:	48 89 d3             	mov    %rdx,%rbx
+  803ff1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803ff5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803ff9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803ffd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804004:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804008:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80400c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804010:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804014:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80401b:	00 00 00 
+  80401e:	4c 8b 30             	mov    (%rax),%r14
+  804021:	48 b8 7a 12 80 00 00 	movabs $0x80127a,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+  80402d:	89 c6                	mov    %eax,%esi
+  80402f:	45 89 e8             	mov    %r13d,%r8d
+  804032:	4c 89 e1             	mov    %r12,%rcx
+  804035:	4c 89 f2             	mov    %r14,%rdx
+  804038:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  80403f:	00 00 00 
+  804042:	b8 00 00 00 00       	mov    $0x0,%eax
+  804047:	49 bc 62 02 80 00 00 	movabs $0x800262,%r12
+  80404e:	00 00 00 
+  804051:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804054:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804058:	48 89 df             	mov    %rbx,%rdi
+  80405b:	48 b8 fe 01 80 00 00 	movabs $0x8001fe,%rax
+  804062:	00 00 00 
+  804065:	ff d0                	call   *%rax
+    cprintf("\n");
+  804067:	48 bf a3 56 80 00 00 	movabs $0x8056a3,%rdi
+  80406e:	00 00 00 
+  804071:	b8 00 00 00 00       	mov    $0x0,%eax
+  804076:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804079:	cc                   	int3
+  80407a:	eb fd                	jmp    804079 <_panic+0xa0>
+
+000000000080407c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80407c:	55                   	push   %rbp
+  80407d:	48 89 e5             	mov    %rsp,%rbp
+  804080:	41 55                	push   %r13
+  804082:	41 54                	push   %r12
+  804084:	53                   	push   %rbx
+  804085:	48 83 ec 08          	sub    $0x8,%rsp
+  804089:	49 89 fc             	mov    %rdi,%r12
+  80408c:	48 89 f7             	mov    %rsi,%rdi
+  80408f:	48 89 d3             	mov    %rdx,%rbx
+  804092:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804095:	48 85 f6             	test   %rsi,%rsi
+  804098:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80409f:	00 00 00 
+  8040a2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8040a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ab:	48 85 d2             	test   %rdx,%rdx
+  8040ae:	74 03                	je     8040b3 <ipc_recv+0x37>
+  8040b0:	48 8b 32             	mov    (%rdx),%rsi
+  8040b3:	48 b8 e7 16 80 00 00 	movabs $0x8016e7,%rax
+  8040ba:	00 00 00 
+  8040bd:	ff d0                	call   *%rax
+    if (errno) {
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	74 1c                	je     8040df <ipc_recv+0x63>
+        if (from_env_store)
+  8040c3:	4d 85 e4             	test   %r12,%r12
+  8040c6:	74 08                	je     8040d0 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8040c8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8040cf:	00 
+
+        if (perm_store)
+  8040d0:	4d 85 ed             	test   %r13,%r13
+  8040d3:	74 74                	je     804149 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8040d5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8040dc:	00 
+  8040dd:	eb 6a                	jmp    804149 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8040df:	4d 85 e4             	test   %r12,%r12
+  8040e2:	74 14                	je     8040f8 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8040e4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040eb:	00 00 00 
+  8040ee:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040f4:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8040f8:	48 85 db             	test   %rbx,%rbx
+  8040fb:	74 23                	je     804120 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8040fd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804104:	00 00 00 
+  804107:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80410d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804112:	85 c9                	test   %ecx,%ecx
+  804114:	74 07                	je     80411d <ipc_recv+0xa1>
+  804116:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80411d:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804120:	4d 85 ed             	test   %r13,%r13
+  804123:	74 14                	je     804139 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804125:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80412c:	00 00 00 
+  80412f:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804135:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804139:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804140:	00 00 00 
+  804143:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804149:	48 83 c4 08          	add    $0x8,%rsp
+  80414d:	5b                   	pop    %rbx
+  80414e:	41 5c                	pop    %r12
+  804150:	41 5d                	pop    %r13
+  804152:	5d                   	pop    %rbp
+  804153:	c3                   	ret
+
+0000000000804154 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804154:	55                   	push   %rbp
+  804155:	48 89 e5             	mov    %rsp,%rbp
+  804158:	41 55                	push   %r13
+  80415a:	41 54                	push   %r12
+  80415c:	53                   	push   %rbx
+  80415d:	48 83 ec 08          	sub    $0x8,%rsp
+  804161:	49 89 fc             	mov    %rdi,%r12
+  804164:	48 89 f7             	mov    %rsi,%rdi
+  804167:	48 89 d3             	mov    %rdx,%rbx
+  80416a:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80416d:	48 85 f6             	test   %rsi,%rsi
+  804170:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804177:	00 00 00 
+  80417a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80417e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804183:	48 85 d2             	test   %rdx,%rdx
+  804186:	74 03                	je     80418b <ipc_try_recv+0x37>
+  804188:	48 8b 32             	mov    (%rdx),%rsi
+  80418b:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  804192:	00 00 00 
+  804195:	ff d0                	call   *%rax
+    if (errno) {
+  804197:	85 c0                	test   %eax,%eax
+  804199:	75 75                	jne    804210 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80419b:	4d 85 e4             	test   %r12,%r12
+  80419e:	74 14                	je     8041b4 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8041a0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041a7:	00 00 00 
+  8041aa:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8041b0:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8041b4:	48 85 db             	test   %rbx,%rbx
+  8041b7:	74 23                	je     8041dc <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8041b9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041c0:	00 00 00 
+  8041c3:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8041c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ce:	85 c9                	test   %ecx,%ecx
+  8041d0:	74 07                	je     8041d9 <ipc_try_recv+0x85>
+  8041d2:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8041d9:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8041dc:	4d 85 ed             	test   %r13,%r13
+  8041df:	74 14                	je     8041f5 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8041e1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041e8:	00 00 00 
+  8041eb:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8041f1:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8041f5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041fc:	00 00 00 
+  8041ff:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804205:	48 83 c4 08          	add    $0x8,%rsp
+  804209:	5b                   	pop    %rbx
+  80420a:	41 5c                	pop    %r12
+  80420c:	41 5d                	pop    %r13
+  80420e:	5d                   	pop    %rbp
+  80420f:	c3                   	ret
+        if (from_env_store)
+  804210:	4d 85 e4             	test   %r12,%r12
+  804213:	74 08                	je     80421d <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804215:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80421c:	00 
+        if (perm_store)
+  80421d:	4d 85 ed             	test   %r13,%r13
+  804220:	74 e3                	je     804205 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804222:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804229:	00 
+  80422a:	eb d9                	jmp    804205 <ipc_try_recv+0xb1>
+
+000000000080422c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80422c:	55                   	push   %rbp
+  80422d:	48 89 e5             	mov    %rsp,%rbp
+  804230:	41 57                	push   %r15
+  804232:	41 56                	push   %r14
+  804234:	41 55                	push   %r13
+  804236:	41 54                	push   %r12
+  804238:	53                   	push   %rbx
+  804239:	48 83 ec 18          	sub    $0x18,%rsp
+  80423d:	41 89 fd             	mov    %edi,%r13d
+  804240:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804243:	48 89 d3             	mov    %rdx,%rbx
+  804246:	49 89 cc             	mov    %rcx,%r12
+  804249:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80424d:	48 85 d2             	test   %rdx,%rdx
+  804250:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804257:	00 00 00 
+  80425a:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80425e:	49 be bb 16 80 00 00 	movabs $0x8016bb,%r14
+  804265:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804268:	49 bf ab 12 80 00 00 	movabs $0x8012ab,%r15
+  80426f:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804272:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804275:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804279:	4c 89 e1             	mov    %r12,%rcx
+  80427c:	48 89 da             	mov    %rbx,%rdx
+  80427f:	44 89 ef             	mov    %r13d,%edi
+  804282:	41 ff d6             	call   *%r14
+  804285:	85 c0                	test   %eax,%eax
+  804287:	74 37                	je     8042c0 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804289:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80428c:	75 05                	jne    804293 <ipc_send+0x67>
+        sys_yield();
+  80428e:	41 ff d7             	call   *%r15
+  804291:	eb df                	jmp    804272 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804293:	89 c1                	mov    %eax,%ecx
+  804295:	48 ba 83 57 80 00 00 	movabs $0x805783,%rdx
+  80429c:	00 00 00 
+  80429f:	be 65 00 00 00       	mov    $0x65,%esi
+  8042a4:	48 bf 9e 57 80 00 00 	movabs $0x80579e,%rdi
+  8042ab:	00 00 00 
+  8042ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b3:	49 b8 d9 3f 80 00 00 	movabs $0x803fd9,%r8
+  8042ba:	00 00 00 
+  8042bd:	41 ff d0             	call   *%r8
+    }
+}
+  8042c0:	48 83 c4 18          	add    $0x18,%rsp
+  8042c4:	5b                   	pop    %rbx
+  8042c5:	41 5c                	pop    %r12
+  8042c7:	41 5d                	pop    %r13
+  8042c9:	41 5e                	pop    %r14
+  8042cb:	41 5f                	pop    %r15
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+
+00000000008042cf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8042cf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8042d4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8042db:	00 00 00 
+  8042de:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8042e5:	48 01 ca             	add    %rcx,%rdx
+  8042e8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8042ee:	39 fa                	cmp    %edi,%edx
+  8042f0:	74 12                	je     804304 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8042f2:	48 83 c0 01          	add    $0x1,%rax
+  8042f6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8042fc:	75 e0                	jne    8042de <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8042fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804303:	c3                   	ret
+            return envs[i].env_id;
+  804304:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80430b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804312:	00 00 00 
+  804315:	48 01 d0             	add    %rdx,%rax
+  804318:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80431e:	c3                   	ret
+
+000000000080431f <__text_end>:
+  80431f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804326:	00 00 00 
+  804329:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804330:	00 00 00 
+  804333:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433a:	00 00 00 
+  80433d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804344:	00 00 00 
+  804347:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434e:	00 00 00 
+  804351:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804358:	00 00 00 
+  80435b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804362:	00 00 00 
+  804365:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436c:	00 00 00 
+  80436f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804376:	00 00 00 
+  804379:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804380:	00 00 00 
+  804383:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438a:	00 00 00 
+  80438d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804394:	00 00 00 
+  804397:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439e:	00 00 00 
+  8043a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a8:	00 00 00 
+  8043ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b2:	00 00 00 
+  8043b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bc:	00 00 00 
+  8043bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c6:	00 00 00 
+  8043c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d0:	00 00 00 
+  8043d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043da:	00 00 00 
+  8043dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e4:	00 00 00 
+  8043e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ee:	00 00 00 
+  8043f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f8:	00 00 00 
+  8043fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804402:	00 00 00 
+  804405:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440c:	00 00 00 
+  80440f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804416:	00 00 00 
+  804419:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804420:	00 00 00 
+  804423:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442a:	00 00 00 
+  80442d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804434:	00 00 00 
+  804437:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443e:	00 00 00 
+  804441:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804448:	00 00 00 
+  80444b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804452:	00 00 00 
+  804455:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445c:	00 00 00 
+  80445f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804466:	00 00 00 
+  804469:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804470:	00 00 00 
+  804473:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447a:	00 00 00 
+  80447d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804484:	00 00 00 
+  804487:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448e:	00 00 00 
+  804491:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804498:	00 00 00 
+  80449b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a2:	00 00 00 
+  8044a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ac:	00 00 00 
+  8044af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b6:	00 00 00 
+  8044b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c0:	00 00 00 
+  8044c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ca:	00 00 00 
+  8044cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d4:	00 00 00 
+  8044d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044de:	00 00 00 
+  8044e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e8:	00 00 00 
+  8044eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f2:	00 00 00 
+  8044f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fc:	00 00 00 
+  8044ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804506:	00 00 00 
+  804509:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804510:	00 00 00 
+  804513:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451a:	00 00 00 
+  80451d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804524:	00 00 00 
+  804527:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452e:	00 00 00 
+  804531:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804538:	00 00 00 
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
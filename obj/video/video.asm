@@ -0,0 +1,10465 @@
+
+obj/video/video:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8f 19 00 00       	call   8019b2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <serv_display>:
+    ipc->get_display_info.res_display_width = adapter->height;
+    return VIDEO_OK;
+}
+
+
+int serv_display(union Vsipc *ipc) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 18          	sub    $0x18,%rsp
+    struct Renderer * renderer = ipc->display.req_renderer;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+    struct GraphicsAdapter * adapter = get_svga();
+  800031:	b8 00 00 00 00       	mov    $0x0,%eax
+  800036:	48 ba c5 09 80 00 00 	movabs $0x8009c5,%rdx
+  80003d:	00 00 00 
+  800040:	ff d2                	call   *%rdx
+  800042:	48 89 c7             	mov    %rax,%rdi
+    struct Window * window = renderer->window;
+  800045:	48 8b 33             	mov    (%rbx),%rsi
+
+    if (window->mode == WINDOW_MODE_CORNER || window->mode == WINDOW_MODE_CENTERED) {
+  800048:	8b 46 10             	mov    0x10(%rsi),%eax
+  80004b:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+  800050:	75 59                	jne    8000ab <serv_display+0x86>
+        for (uint32_t y = 0; y < window->height; ++y) {
+  800052:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800058:	83 7e 04 00          	cmpl   $0x0,0x4(%rsi)
+  80005c:	75 40                	jne    80009e <serv_display+0x79>
+  80005e:	eb 59                	jmp    8000b9 <serv_display+0x94>
+            for (uint32_t x = 0; x < window->width; ++x) {
+                uint32_t adapter_x = window->x_offset + x;
+                uint32_t adapter_y = window->y_offset + y;
+  800060:	44 89 c0             	mov    %r8d,%eax
+  800063:	03 46 0c             	add    0xc(%rsi),%eax
+                adapter->fb[adapter_y * adapter->width + adapter_x] = renderer->back_buffer[y * window->width + x];
+  800066:	0f af 47 30          	imul   0x30(%rdi),%eax
+  80006a:	03 46 08             	add    0x8(%rsi),%eax
+  80006d:	44 8d 0c 08          	lea    (%rax,%rcx,1),%r9d
+  800071:	48 8b 47 20          	mov    0x20(%rdi),%rax
+  800075:	4a 8d 04 88          	lea    (%rax,%r9,4),%rax
+  800079:	41 0f af d0          	imul   %r8d,%edx
+  80007d:	44 8d 0c 0a          	lea    (%rdx,%rcx,1),%r9d
+  800081:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  800085:	42 8b 14 8a          	mov    (%rdx,%r9,4),%edx
+  800089:	89 10                	mov    %edx,(%rax)
+            for (uint32_t x = 0; x < window->width; ++x) {
+  80008b:	83 c1 01             	add    $0x1,%ecx
+  80008e:	8b 16                	mov    (%rsi),%edx
+  800090:	39 d1                	cmp    %edx,%ecx
+  800092:	72 cc                	jb     800060 <serv_display+0x3b>
+        for (uint32_t y = 0; y < window->height; ++y) {
+  800094:	41 83 c0 01          	add    $0x1,%r8d
+  800098:	44 3b 46 04          	cmp    0x4(%rsi),%r8d
+  80009c:	73 1b                	jae    8000b9 <serv_display+0x94>
+            for (uint32_t x = 0; x < window->width; ++x) {
+  80009e:	8b 16                	mov    (%rsi),%edx
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	85 d2                	test   %edx,%edx
+  8000a7:	75 b7                	jne    800060 <serv_display+0x3b>
+  8000a9:	eb e9                	jmp    800094 <serv_display+0x6f>
+            }
+        }
+    } else if (window->mode == WINDOW_MODE_FULLSCREEN) {
+  8000ab:	83 f8 01             	cmp    $0x1,%eax
+  8000ae:	74 14                	je     8000c4 <serv_display+0x9f>
+                uint32_t w_x = (uint32_t)((double)x / adapter->width * window->width);
+                uint32_t w_y = (uint32_t)((double)y / adapter->height * window->height);
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+            }
+        }
+    } else if (window->mode == WINDOW_MODE_2XSCALE) {
+  8000b0:	83 f8 03             	cmp    $0x3,%eax
+  8000b3:	0f 84 df 00 00 00    	je     800198 <serv_display+0x173>
+            }
+        }
+    }
+
+    return VIDEO_OK;
+}
+  8000b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000c2:	c9                   	leave
+  8000c3:	c3                   	ret
+        for (uint32_t y = 0; y < adapter->height; ++y) {
+  8000c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8000ca:	83 7f 34 00          	cmpl   $0x0,0x34(%rdi)
+  8000ce:	0f 85 9b 00 00 00    	jne    80016f <serv_display+0x14a>
+  8000d4:	eb e3                	jmp    8000b9 <serv_display+0x94>
+                uint32_t w_x = (uint32_t)((double)x / adapter->width * window->width);
+  8000d6:	8b 0e                	mov    (%rsi),%ecx
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+  8000d8:	41 89 c0             	mov    %eax,%r8d
+  8000db:	45 0f af c2          	imul   %r10d,%r8d
+  8000df:	45 8d 0c 10          	lea    (%r8,%rdx,1),%r9d
+  8000e3:	4c 8b 47 20          	mov    0x20(%rdi),%r8
+  8000e7:	4f 8d 0c 88          	lea    (%r8,%r9,4),%r9
+                uint32_t w_y = (uint32_t)((double)y / adapter->height * window->height);
+  8000eb:	44 8b 47 34          	mov    0x34(%rdi),%r8d
+  8000ef:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8000f3:	df 6d e0             	fildll -0x20(%rbp)
+  8000f6:	d8 f9                	fdivr  %st(1),%st
+  8000f8:	44 8b 46 04          	mov    0x4(%rsi),%r8d
+  8000fc:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  800100:	df 6d e0             	fildll -0x20(%rbp)
+  800103:	de c9                	fmulp  %st,%st(1)
+  800105:	d9 6d ec             	fldcw  -0x14(%rbp)
+  800108:	df 7d e0             	fistpll -0x20(%rbp)
+  80010b:	d9 6d ee             	fldcw  -0x12(%rbp)
+  80010e:	4c 8b 45 e0          	mov    -0x20(%rbp),%r8
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+  800112:	44 0f af c1          	imul   %ecx,%r8d
+                uint32_t w_x = (uint32_t)((double)x / adapter->width * window->width);
+  800116:	41 89 d3             	mov    %edx,%r11d
+  800119:	4c 89 5d e0          	mov    %r11,-0x20(%rbp)
+  80011d:	df 6d e0             	fildll -0x20(%rbp)
+  800120:	89 c0                	mov    %eax,%eax
+  800122:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800126:	df 6d e0             	fildll -0x20(%rbp)
+  800129:	de f9                	fdivrp %st,%st(1)
+  80012b:	89 c8                	mov    %ecx,%eax
+  80012d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800131:	df 6d e0             	fildll -0x20(%rbp)
+  800134:	de c9                	fmulp  %st,%st(1)
+  800136:	d9 6d ec             	fldcw  -0x14(%rbp)
+  800139:	df 7d e0             	fistpll -0x20(%rbp)
+  80013c:	d9 6d ee             	fldcw  -0x12(%rbp)
+  80013f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+  800143:	41 8d 0c 00          	lea    (%r8,%rax,1),%ecx
+  800147:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80014b:	8b 04 88             	mov    (%rax,%rcx,4),%eax
+  80014e:	41 89 01             	mov    %eax,(%r9)
+            for (uint32_t x = 0; x < adapter->width; ++x) {
+  800151:	83 c2 01             	add    $0x1,%edx
+  800154:	8b 47 30             	mov    0x30(%rdi),%eax
+  800157:	39 c2                	cmp    %eax,%edx
+  800159:	0f 82 77 ff ff ff    	jb     8000d6 <serv_display+0xb1>
+  80015f:	dd d8                	fstp   %st(0)
+        for (uint32_t y = 0; y < adapter->height; ++y) {
+  800161:	41 83 c2 01          	add    $0x1,%r10d
+  800165:	44 3b 57 34          	cmp    0x34(%rdi),%r10d
+  800169:	0f 83 4a ff ff ff    	jae    8000b9 <serv_display+0x94>
+            for (uint32_t x = 0; x < adapter->width; ++x) {
+  80016f:	8b 47 30             	mov    0x30(%rdi),%eax
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	85 c0                	test   %eax,%eax
+  800179:	74 e6                	je     800161 <serv_display+0x13c>
+                uint32_t w_y = (uint32_t)((double)y / adapter->height * window->height);
+  80017b:	44 89 d1             	mov    %r10d,%ecx
+  80017e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800182:	df 6d e0             	fildll -0x20(%rbp)
+  800185:	d9 7d ee             	fnstcw -0x12(%rbp)
+  800188:	0f b7 4d ee          	movzwl -0x12(%rbp),%ecx
+  80018c:	80 cd 0c             	or     $0xc,%ch
+  80018f:	66 89 4d ec          	mov    %cx,-0x14(%rbp)
+  800193:	e9 3e ff ff ff       	jmp    8000d6 <serv_display+0xb1>
+        for (uint32_t y = 0; y < window->height * 2; ++y) {
+  800198:	8b 46 04             	mov    0x4(%rsi),%eax
+  80019b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001a1:	01 c0                	add    %eax,%eax
+  8001a3:	75 4e                	jne    8001f3 <serv_display+0x1ce>
+  8001a5:	e9 0f ff ff ff       	jmp    8000b9 <serv_display+0x94>
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+  8001aa:	44 89 c9             	mov    %r9d,%ecx
+  8001ad:	0f af 4f 30          	imul   0x30(%rdi),%ecx
+  8001b1:	44 8d 04 11          	lea    (%rcx,%rdx,1),%r8d
+  8001b5:	48 8b 4f 20          	mov    0x20(%rdi),%rcx
+  8001b9:	4a 8d 0c 81          	lea    (%rcx,%r8,4),%rcx
+  8001bd:	41 0f af c2          	imul   %r10d,%eax
+                uint32_t w_x = x / 2;
+  8001c1:	41 89 d0             	mov    %edx,%r8d
+  8001c4:	41 d1 e8             	shr    %r8d
+                adapter->fb[y * adapter->width + x] = renderer->back_buffer[w_y * window->width + w_x];
+  8001c7:	46 8d 04 00          	lea    (%rax,%r8,1),%r8d
+  8001cb:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8001cf:	42 8b 04 80          	mov    (%rax,%r8,4),%eax
+  8001d3:	89 01                	mov    %eax,(%rcx)
+            for (uint32_t x = 0; x < window->width * 2; ++x) {
+  8001d5:	83 c2 01             	add    $0x1,%edx
+  8001d8:	8b 06                	mov    (%rsi),%eax
+  8001da:	8d 0c 00             	lea    (%rax,%rax,1),%ecx
+  8001dd:	39 ca                	cmp    %ecx,%edx
+  8001df:	72 c9                	jb     8001aa <serv_display+0x185>
+        for (uint32_t y = 0; y < window->height * 2; ++y) {
+  8001e1:	41 83 c1 01          	add    $0x1,%r9d
+  8001e5:	8b 46 04             	mov    0x4(%rsi),%eax
+  8001e8:	01 c0                	add    %eax,%eax
+  8001ea:	41 39 c1             	cmp    %eax,%r9d
+  8001ed:	0f 83 c6 fe ff ff    	jae    8000b9 <serv_display+0x94>
+            for (uint32_t x = 0; x < window->width * 2; ++x) {
+  8001f3:	8b 06                	mov    (%rsi),%eax
+                uint32_t w_y = y / 2;
+  8001f5:	45 89 ca             	mov    %r9d,%r10d
+  8001f8:	41 d1 ea             	shr    %r10d
+            for (uint32_t x = 0; x < window->width * 2; ++x) {
+  8001fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800200:	89 c1                	mov    %eax,%ecx
+  800202:	01 c9                	add    %ecx,%ecx
+  800204:	75 a4                	jne    8001aa <serv_display+0x185>
+  800206:	eb d9                	jmp    8001e1 <serv_display+0x1bc>
+
+0000000000800208 <serv_create_window>:
+int serv_create_window(union Vsipc *ipc) {
+  800208:	55                   	push   %rbp
+  800209:	48 89 e5             	mov    %rsp,%rbp
+  80020c:	41 54                	push   %r12
+  80020e:	53                   	push   %rbx
+  80020f:	49 89 fc             	mov    %rdi,%r12
+    struct Window *window = (struct Window*) malloc(sizeof(struct Window));
+  800212:	bf 14 00 00 00       	mov    $0x14,%edi
+  800217:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  80021e:	00 00 00 
+  800221:	ff d0                	call   *%rax
+  800223:	48 89 c3             	mov    %rax,%rbx
+        return VIDEO_WINDOW_CREATE_ERROR;
+  800226:	b8 01 00 00 00       	mov    $0x1,%eax
+    if (!window)
+  80022b:	48 85 db             	test   %rbx,%rbx
+  80022e:	74 4b                	je     80027b <serv_create_window+0x73>
+    window->width = req->req_width;
+  800230:	41 8b 04 24          	mov    (%r12),%eax
+  800234:	89 03                	mov    %eax,(%rbx)
+    window->height = req->req_height;
+  800236:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80023b:	89 43 04             	mov    %eax,0x4(%rbx)
+    window->mode = req->req_mode;
+  80023e:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  800243:	89 43 10             	mov    %eax,0x10(%rbx)
+    req->res_window = window;
+  800246:	49 89 5c 24 10       	mov    %rbx,0x10(%r12)
+    struct GraphicsAdapter * svga = get_svga();
+  80024b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800250:	48 ba c5 09 80 00 00 	movabs $0x8009c5,%rdx
+  800257:	00 00 00 
+  80025a:	ff d2                	call   *%rdx
+  80025c:	48 89 c7             	mov    %rax,%rdi
+    if (window->mode == WINDOW_MODE_CENTERED) {
+  80025f:	83 7b 10 02          	cmpl   $0x2,0x10(%rbx)
+  800263:	74 1b                	je     800280 <serv_create_window+0x78>
+    svga_fill(svga, 0x00000000);
+  800265:	be 00 00 00 00       	mov    $0x0,%esi
+  80026a:	48 b8 1b 09 80 00 00 	movabs $0x80091b,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+    return VIDEO_OK;
+  800276:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80027b:	5b                   	pop    %rbx
+  80027c:	41 5c                	pop    %r12
+  80027e:	5d                   	pop    %rbp
+  80027f:	c3                   	ret
+        window->x_offset = svga->width / 2 - window->width / 2;
+  800280:	8b 40 30             	mov    0x30(%rax),%eax
+  800283:	d1 e8                	shr    %eax
+  800285:	8b 13                	mov    (%rbx),%edx
+  800287:	d1 ea                	shr    %edx
+  800289:	29 d0                	sub    %edx,%eax
+  80028b:	89 43 08             	mov    %eax,0x8(%rbx)
+        window->y_offset = svga->height / 2 - window->height / 2;
+  80028e:	8b 47 34             	mov    0x34(%rdi),%eax
+  800291:	d1 e8                	shr    %eax
+  800293:	8b 53 04             	mov    0x4(%rbx),%edx
+  800296:	d1 ea                	shr    %edx
+  800298:	29 d0                	sub    %edx,%eax
+  80029a:	89 43 0c             	mov    %eax,0xc(%rbx)
+  80029d:	eb c6                	jmp    800265 <serv_create_window+0x5d>
+
+000000000080029f <serv_destroy_window>:
+int serv_destroy_window(union Vsipc *ipc) {
+  80029f:	55                   	push   %rbp
+  8002a0:	48 89 e5             	mov    %rsp,%rbp
+    free(ipc->destroy_window.req_window);
+  8002a3:	48 8b 3f             	mov    (%rdi),%rdi
+  8002a6:	48 b8 95 33 80 00 00 	movabs $0x803395,%rax
+  8002ad:	00 00 00 
+  8002b0:	ff d0                	call   *%rax
+}
+  8002b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b7:	5d                   	pop    %rbp
+  8002b8:	c3                   	ret
+
+00000000008002b9 <serv_create_renderer>:
+int serv_create_renderer(union Vsipc *ipc) {
+  8002b9:	55                   	push   %rbp
+  8002ba:	48 89 e5             	mov    %rsp,%rbp
+  8002bd:	41 54                	push   %r12
+  8002bf:	53                   	push   %rbx
+  8002c0:	49 89 fc             	mov    %rdi,%r12
+    struct Renderer * renderer = (struct Renderer*)malloc(sizeof(struct Renderer));
+  8002c3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8002c8:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  8002cf:	00 00 00 
+  8002d2:	ff d0                	call   *%rax
+    if (!renderer)
+  8002d4:	48 85 c0             	test   %rax,%rax
+  8002d7:	74 51                	je     80032a <serv_create_renderer+0x71>
+  8002d9:	48 89 c3             	mov    %rax,%rbx
+    renderer->window = req->req_window;
+  8002dc:	49 8b 04 24          	mov    (%r12),%rax
+  8002e0:	48 89 03             	mov    %rax,(%rbx)
+    renderer->back_buffer = malloc(sizeof(uint32_t) * renderer->window->width * renderer->window->height);
+  8002e3:	8b 38                	mov    (%rax),%edi
+  8002e5:	8b 40 04             	mov    0x4(%rax),%eax
+  8002e8:	48 0f af f8          	imul   %rax,%rdi
+  8002ec:	48 c1 e7 02          	shl    $0x2,%rdi
+  8002f0:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  8002f7:	00 00 00 
+  8002fa:	ff d0                	call   *%rax
+  8002fc:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    if (!renderer->back_buffer) {
+  800300:	48 85 c0             	test   %rax,%rax
+  800303:	74 0f                	je     800314 <serv_create_renderer+0x5b>
+    req->res_renderer = renderer;
+  800305:	49 89 5c 24 08       	mov    %rbx,0x8(%r12)
+    return VIDEO_OK;
+  80030a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80030f:	5b                   	pop    %rbx
+  800310:	41 5c                	pop    %r12
+  800312:	5d                   	pop    %rbp
+  800313:	c3                   	ret
+        free(renderer);
+  800314:	48 89 df             	mov    %rbx,%rdi
+  800317:	48 b8 95 33 80 00 00 	movabs $0x803395,%rax
+  80031e:	00 00 00 
+  800321:	ff d0                	call   *%rax
+        return -VIDEO_RENDERER_CREATE_ERROR;
+  800323:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  800328:	eb e5                	jmp    80030f <serv_create_renderer+0x56>
+        return -VIDEO_RENDERER_CREATE_ERROR;
+  80032a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80032f:	eb de                	jmp    80030f <serv_create_renderer+0x56>
+
+0000000000800331 <serv_destroy_renderer>:
+int serv_destroy_renderer(union Vsipc *ipc) {
+  800331:	55                   	push   %rbp
+  800332:	48 89 e5             	mov    %rsp,%rbp
+  800335:	41 54                	push   %r12
+  800337:	53                   	push   %rbx
+  800338:	48 89 fb             	mov    %rdi,%rbx
+    free(ipc->destroy_renderer.req_renderer->back_buffer);
+  80033b:	48 8b 07             	mov    (%rdi),%rax
+  80033e:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  800342:	49 bc 95 33 80 00 00 	movabs $0x803395,%r12
+  800349:	00 00 00 
+  80034c:	41 ff d4             	call   *%r12
+    free(ipc->destroy_renderer.req_renderer);
+  80034f:	48 8b 3b             	mov    (%rbx),%rdi
+  800352:	41 ff d4             	call   *%r12
+}
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	5b                   	pop    %rbx
+  80035b:	41 5c                	pop    %r12
+  80035d:	5d                   	pop    %rbp
+  80035e:	c3                   	ret
+
+000000000080035f <serv_update_texture>:
+int serv_update_texture(union Vsipc *ipc) {
+  80035f:	55                   	push   %rbp
+  800360:	48 89 e5             	mov    %rsp,%rbp
+    memcpy((char*)texture->buf + offset, buffer, size);
+  800363:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+    char * buffer = ipc->update_texture.req_buf;
+  800367:	48 8d 77 18          	lea    0x18(%rdi),%rsi
+    memcpy((char*)texture->buf + offset, buffer, size);
+  80036b:	48 8b 07             	mov    (%rdi),%rax
+  80036e:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  800372:	48 03 78 08          	add    0x8(%rax),%rdi
+  800376:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  80037d:	00 00 00 
+  800380:	ff d0                	call   *%rax
+}
+  800382:	b8 00 00 00 00       	mov    $0x0,%eax
+  800387:	5d                   	pop    %rbp
+  800388:	c3                   	ret
+
+0000000000800389 <serv_copy_texture>:
+int serv_copy_texture(union Vsipc *ipc) {
+  800389:	55                   	push   %rbp
+  80038a:	48 89 e5             	mov    %rsp,%rbp
+    struct Renderer * renderer = ipc->copy_texture.req_renderer;
+  80038d:	48 8b 47 08          	mov    0x8(%rdi),%rax
+    memcpy(renderer->back_buffer, texture->buf, renderer->window->width * renderer->window->height * sizeof(uint32_t));
+  800391:	48 8b 08             	mov    (%rax),%rcx
+  800394:	8b 11                	mov    (%rcx),%edx
+  800396:	0f af 51 04          	imul   0x4(%rcx),%edx
+  80039a:	48 c1 e2 02          	shl    $0x2,%rdx
+  80039e:	48 8b 0f             	mov    (%rdi),%rcx
+  8003a1:	48 8b 71 08          	mov    0x8(%rcx),%rsi
+  8003a5:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8003a9:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8003b0:	00 00 00 
+  8003b3:	ff d0                	call   *%rax
+}
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	5d                   	pop    %rbp
+  8003bb:	c3                   	ret
+
+00000000008003bc <serv_clear>:
+
+int serv_clear(union Vsipc *req) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+    struct Renderer *renderer = req->clear.req_renderer;
+  8003c0:	48 8b 07             	mov    (%rdi),%rax
+    memset(renderer->back_buffer, 0, renderer->window->width * renderer->window->height * sizeof(uint32_t));
+  8003c3:	48 8b 08             	mov    (%rax),%rcx
+  8003c6:	8b 11                	mov    (%rcx),%edx
+  8003c8:	0f af 51 04          	imul   0x4(%rcx),%edx
+  8003cc:	48 c1 e2 02          	shl    $0x2,%rdx
+  8003d0:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8003d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d9:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  8003e0:	00 00 00 
+  8003e3:	ff d0                	call   *%rax
+    return VIDEO_OK;
+}
+  8003e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ea:	5d                   	pop    %rbp
+  8003eb:	c3                   	ret
+
+00000000008003ec <serv_create_texture>:
+int serv_create_texture(envid_t dst_envid, union Vsipc *ipc) {
+  8003ec:	55                   	push   %rbp
+  8003ed:	48 89 e5             	mov    %rsp,%rbp
+  8003f0:	41 57                	push   %r15
+  8003f2:	41 56                	push   %r14
+  8003f4:	41 55                	push   %r13
+  8003f6:	41 54                	push   %r12
+  8003f8:	53                   	push   %rbx
+  8003f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fd:	41 89 fd             	mov    %edi,%r13d
+  800400:	49 89 f4             	mov    %rsi,%r12
+    struct Texture * texture = (struct Texture*)malloc(sizeof(struct Texture));
+  800403:	bf 18 00 00 00       	mov    $0x18,%edi
+  800408:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+    if (!texture)
+  800414:	48 85 c0             	test   %rax,%rax
+  800417:	0f 84 de 00 00 00    	je     8004fb <serv_create_texture+0x10f>
+  80041d:	48 89 c3             	mov    %rax,%rbx
+    texture->width = req->req_width;
+  800420:	41 8b 3c 24          	mov    (%r12),%edi
+  800424:	89 38                	mov    %edi,(%rax)
+    texture->height = req->req_height;
+  800426:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80042b:	89 43 04             	mov    %eax,0x4(%rbx)
+    texture->buf = malloc(sizeof(uint32_t) * texture->width * texture->height);
+  80042e:	89 ff                	mov    %edi,%edi
+  800430:	89 c0                	mov    %eax,%eax
+  800432:	48 0f af f8          	imul   %rax,%rdi
+  800436:	48 c1 e7 02          	shl    $0x2,%rdi
+  80043a:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  800441:	00 00 00 
+  800444:	ff d0                	call   *%rax
+  800446:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    if (!texture->buf) {
+  80044a:	48 85 c0             	test   %rax,%rax
+  80044d:	74 25                	je     800474 <serv_create_texture+0x88>
+    req->res_texture = texture;
+  80044f:	49 89 5c 24 10       	mov    %rbx,0x10(%r12)
+    return VIDEO_OK;
+  800454:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    if (req->req_need_mapping) {
+  80045a:	41 80 7c 24 08 00    	cmpb   $0x0,0x8(%r12)
+  800460:	75 29                	jne    80048b <serv_create_texture+0x9f>
+}
+  800462:	44 89 f0             	mov    %r14d,%eax
+  800465:	48 83 c4 08          	add    $0x8,%rsp
+  800469:	5b                   	pop    %rbx
+  80046a:	41 5c                	pop    %r12
+  80046c:	41 5d                	pop    %r13
+  80046e:	41 5e                	pop    %r14
+  800470:	41 5f                	pop    %r15
+  800472:	5d                   	pop    %rbp
+  800473:	c3                   	ret
+        free(texture);
+  800474:	48 89 df             	mov    %rbx,%rdi
+  800477:	48 b8 95 33 80 00 00 	movabs $0x803395,%rax
+  80047e:	00 00 00 
+  800481:	ff d0                	call   *%rax
+        return -VIDEO_TEXTURE_CREATE_ERROR;
+  800483:	41 be fe ff ff ff    	mov    $0xfffffffe,%r14d
+  800489:	eb d7                	jmp    800462 <serv_create_texture+0x76>
+        uint32_t * texture_map = (uint32_t*)(VIDEO_MAP_TOP + ((char*)texture->buf - USER_HEAP_TOP));
+  80048b:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+  80048f:	49 bf 00 00 00 00 0a 	movabs $0xa00000000,%r15
+  800496:	00 00 00 
+  800499:	49 01 f7             	add    %rsi,%r15
+        int res = sys_map_region(0, texture->buf, dst_envid, texture_map, sizeof(uint32_t) * texture->width * texture->height, PROT_RW);
+  80049c:	8b 03                	mov    (%rbx),%eax
+  80049e:	8b 53 04             	mov    0x4(%rbx),%edx
+  8004a1:	48 0f af c2          	imul   %rdx,%rax
+  8004a5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8004ab:	4c 8d 04 85 00 00 00 	lea    0x0(,%rax,4),%r8
+  8004b2:	00 
+  8004b3:	4c 89 f9             	mov    %r15,%rcx
+  8004b6:	44 89 ea             	mov    %r13d,%edx
+  8004b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004be:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  8004c5:	00 00 00 
+  8004c8:	ff d0                	call   *%rax
+  8004ca:	41 89 c6             	mov    %eax,%r14d
+        if (res) {
+  8004cd:	85 c0                	test   %eax,%eax
+  8004cf:	75 0b                	jne    8004dc <serv_create_texture+0xf0>
+        texture->user_buf_map = texture_map;
+  8004d1:	4c 89 7b 10          	mov    %r15,0x10(%rbx)
+        req->res_buffer_map = texture_map;
+  8004d5:	4d 89 7c 24 18       	mov    %r15,0x18(%r12)
+  8004da:	eb 86                	jmp    800462 <serv_create_texture+0x76>
+            free(texture->buf);
+  8004dc:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  8004e0:	49 bc 95 33 80 00 00 	movabs $0x803395,%r12
+  8004e7:	00 00 00 
+  8004ea:	41 ff d4             	call   *%r12
+            free(texture);
+  8004ed:	48 89 df             	mov    %rbx,%rdi
+  8004f0:	41 ff d4             	call   *%r12
+            return -res;
+  8004f3:	41 f7 de             	neg    %r14d
+  8004f6:	e9 67 ff ff ff       	jmp    800462 <serv_create_texture+0x76>
+        return -VIDEO_TEXTURE_CREATE_ERROR;
+  8004fb:	41 be fe ff ff ff    	mov    $0xfffffffe,%r14d
+  800501:	e9 5c ff ff ff       	jmp    800462 <serv_create_texture+0x76>
+
+0000000000800506 <serv_destroy_texture>:
+int serv_destroy_texture(envid_t dst_env, union Vsipc *ipc) {
+  800506:	55                   	push   %rbp
+  800507:	48 89 e5             	mov    %rsp,%rbp
+  80050a:	41 54                	push   %r12
+  80050c:	53                   	push   %rbx
+  80050d:	48 89 f3             	mov    %rsi,%rbx
+    struct Texture * texture = ipc->destroy_texture.req_texture;
+  800510:	48 8b 06             	mov    (%rsi),%rax
+    if (texture->user_buf_map) {
+  800513:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  800517:	48 85 f6             	test   %rsi,%rsi
+  80051a:	74 1d                	je     800539 <serv_destroy_texture+0x33>
+        int res = sys_unmap_region(dst_env, texture->user_buf_map, sizeof(uint32_t) * texture->height * texture->width);
+  80051c:	8b 50 04             	mov    0x4(%rax),%edx
+  80051f:	8b 00                	mov    (%rax),%eax
+  800521:	48 0f af d0          	imul   %rax,%rdx
+  800525:	48 c1 e2 02          	shl    $0x2,%rdx
+  800529:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  800530:	00 00 00 
+  800533:	ff d0                	call   *%rax
+        if (res)
+  800535:	85 c0                	test   %eax,%eax
+  800537:	75 1f                	jne    800558 <serv_destroy_texture+0x52>
+    free(ipc->destroy_texture.req_texture->buf);
+  800539:	48 8b 03             	mov    (%rbx),%rax
+  80053c:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  800540:	49 bc 95 33 80 00 00 	movabs $0x803395,%r12
+  800547:	00 00 00 
+  80054a:	41 ff d4             	call   *%r12
+    free(ipc->destroy_texture.req_texture);
+  80054d:	48 8b 3b             	mov    (%rbx),%rdi
+  800550:	41 ff d4             	call   *%r12
+    return VIDEO_OK;
+  800553:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800558:	5b                   	pop    %rbx
+  800559:	41 5c                	pop    %r12
+  80055b:	5d                   	pop    %rbp
+  80055c:	c3                   	ret
+
+000000000080055d <serv_get_display_info>:
+int serv_get_display_info(union Vsipc *ipc) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	53                   	push   %rbx
+  800562:	48 83 ec 08          	sub    $0x8,%rsp
+  800566:	48 89 fb             	mov    %rdi,%rbx
+    struct GraphicsAdapter * adapter = get_svga();
+  800569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056e:	48 ba c5 09 80 00 00 	movabs $0x8009c5,%rdx
+  800575:	00 00 00 
+  800578:	ff d2                	call   *%rdx
+    ipc->get_display_info.res_display_height = adapter->width;
+  80057a:	8b 50 30             	mov    0x30(%rax),%edx
+  80057d:	89 53 04             	mov    %edx,0x4(%rbx)
+    ipc->get_display_info.res_display_width = adapter->height;
+  800580:	8b 40 34             	mov    0x34(%rax),%eax
+  800583:	89 03                	mov    %eax,(%rbx)
+}
+  800585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058e:	c9                   	leave
+  80058f:	c3                   	ret
+
+0000000000800590 <serve>:
+        [VSREQ_CLEAR] = serv_clear
+};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+
+void serve(void) {
+  800590:	55                   	push   %rbp
+  800591:	48 89 e5             	mov    %rsp,%rbp
+  800594:	41 56                	push   %r14
+  800596:	41 55                	push   %r13
+  800598:	41 54                	push   %r12
+  80059a:	53                   	push   %rbx
+  80059b:	48 83 ec 10          	sub    $0x10,%rsp
+    int perm, res;
+
+    while (1) {
+        perm = 0;
+        size_t sz = PAGE_SIZE;
+        req = ipc_recv((int32_t *)&whom, vsreq, &sz, &perm);
+  80059f:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  8005a6:	00 00 00 
+  8005a9:	49 bc bc 36 80 00 00 	movabs $0x8036bc,%r12
+  8005b0:	00 00 00 
+            res = handlers[req](vsreq);
+        }
+        else {
+            res = -VIDEO_INVALID_REQUEST;
+        }
+        ipc_send(whom, res, NULL, PAGE_SIZE, perm);
+  8005b3:	49 be 6c 38 80 00 00 	movabs $0x80386c,%r14
+  8005ba:	00 00 00 
+        sys_unmap_region(0, vsreq, PAGE_SIZE);
+  8005bd:	49 bd 85 2e 80 00 00 	movabs $0x802e85,%r13
+  8005c4:	00 00 00 
+  8005c7:	eb 38                	jmp    800601 <serve+0x71>
+            res = serv_create_texture(whom, vsreq);
+  8005c9:	48 8b 33             	mov    (%rbx),%rsi
+  8005cc:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8005cf:	48 b8 ec 03 80 00 00 	movabs $0x8003ec,%rax
+  8005d6:	00 00 00 
+  8005d9:	ff d0                	call   *%rax
+  8005db:	89 c6                	mov    %eax,%esi
+        ipc_send(whom, res, NULL, PAGE_SIZE, perm);
+  8005dd:	44 8b 45 d8          	mov    -0x28(%rbp),%r8d
+  8005e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8005e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005eb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8005ee:	41 ff d6             	call   *%r14
+        sys_unmap_region(0, vsreq, PAGE_SIZE);
+  8005f1:	48 8b 33             	mov    (%rbx),%rsi
+  8005f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8005f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005fe:	41 ff d5             	call   *%r13
+        perm = 0;
+  800601:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+        size_t sz = PAGE_SIZE;
+  800608:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80060f:	00 
+        req = ipc_recv((int32_t *)&whom, vsreq, &sz, &perm);
+  800610:	48 8b 33             	mov    (%rbx),%rsi
+  800613:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  800617:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80061b:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80061f:	41 ff d4             	call   *%r12
+        if (!(perm & PROT_R)) {
+  800622:	f6 45 d8 04          	testb  $0x4,-0x28(%rbp)
+  800626:	74 d9                	je     800601 <serve+0x71>
+        if (req == VSREQ_CREATE_TEXTURE) {
+  800628:	83 f8 03             	cmp    $0x3,%eax
+  80062b:	74 9c                	je     8005c9 <serve+0x39>
+        } else if (req == VSREQ_DESTROY_TEXTURE) {
+  80062d:	83 f8 04             	cmp    $0x4,%eax
+  800630:	74 28                	je     80065a <serve+0xca>
+            res = -VIDEO_INVALID_REQUEST;
+  800632:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+        else if (req < NHANDLERS && handlers[req]) {
+  800637:	83 f8 0b             	cmp    $0xb,%eax
+  80063a:	77 a1                	ja     8005dd <serve+0x4d>
+  80063c:	89 c0                	mov    %eax,%eax
+  80063e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800645:	00 00 00 
+  800648:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80064c:	48 85 c0             	test   %rax,%rax
+  80064f:	74 8c                	je     8005dd <serve+0x4d>
+            res = handlers[req](vsreq);
+  800651:	48 8b 3b             	mov    (%rbx),%rdi
+  800654:	ff d0                	call   *%rax
+  800656:	89 c6                	mov    %eax,%esi
+  800658:	eb 83                	jmp    8005dd <serve+0x4d>
+            res = serv_destroy_texture(whom, vsreq);
+  80065a:	48 8b 33             	mov    (%rbx),%rsi
+  80065d:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800660:	48 b8 06 05 80 00 00 	movabs $0x800506,%rax
+  800667:	00 00 00 
+  80066a:	ff d0                	call   *%rax
+  80066c:	89 c6                	mov    %eax,%esi
+  80066e:	e9 6a ff ff ff       	jmp    8005dd <serve+0x4d>
+
+0000000000800673 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800673:	55                   	push   %rbp
+  800674:	48 89 e5             	mov    %rsp,%rbp
+  800677:	53                   	push   %rbx
+  800678:	48 83 ec 08          	sub    $0x8,%rsp
+  80067c:	48 89 f3             	mov    %rsi,%rbx
+    cprintf("GS is running\n");
+  80067f:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  800686:	00 00 00 
+  800689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068e:	48 ba ce 1b 80 00 00 	movabs $0x801bce,%rdx
+  800695:	00 00 00 
+  800698:	ff d2                	call   *%rdx
+    pci_init(argv);
+  80069a:	48 89 df             	mov    %rbx,%rdi
+  80069d:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+    graphics_init(640, 400, GRAPHICS_ADAPTER_ANY);
+  8006a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ae:	be 90 01 00 00       	mov    $0x190,%esi
+  8006b3:	bf 80 02 00 00       	mov    $0x280,%edi
+  8006b8:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+    serve();
+  8006c4:	48 b8 90 05 80 00 00 	movabs $0x800590,%rax
+  8006cb:	00 00 00 
+  8006ce:	ff d0                	call   *%rax
+
+00000000008006d0 <svga_read_io_bar>:
+
+#include "fs/pci.h"
+
+static struct GraphicsAdapter svga;
+
+int svga_read_io_bar(struct GraphicsAdapter * adapter) {
+  8006d0:	55                   	push   %rbp
+  8006d1:	48 89 e5             	mov    %rsp,%rbp
+  8006d4:	41 54                	push   %r12
+  8006d6:	53                   	push   %rbx
+  8006d7:	48 89 fb             	mov    %rdi,%rbx
+    const size_t bar_size = get_bar_size(adapter->pcidev, 0);
+  8006da:	48 8b 3f             	mov    (%rdi),%rdi
+  8006dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e2:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  8006e9:	00 00 00 
+  8006ec:	ff d0                	call   *%rax
+  8006ee:	41 89 c4             	mov    %eax,%r12d
+    const uintptr_t io_port_base = get_bar_address(adapter->pcidev, 0);
+  8006f1:	48 8b 3b             	mov    (%rbx),%rdi
+  8006f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006f9:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  800700:	00 00 00 
+  800703:	ff d0                	call   *%rax
+
+    if (!bar_size || !io_port_base)
+  800705:	45 85 e4             	test   %r12d,%r12d
+  800708:	74 13                	je     80071d <svga_read_io_bar+0x4d>
+  80070a:	48 85 c0             	test   %rax,%rax
+  80070d:	74 0e                	je     80071d <svga_read_io_bar+0x4d>
+        return -SVGA_MAP_ERR;
+
+    adapter->io_base = io_port_base;
+  80070f:	48 89 43 08          	mov    %rax,0x8(%rbx)
+
+    return SVGA_OK;
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800718:	5b                   	pop    %rbx
+  800719:	41 5c                	pop    %r12
+  80071b:	5d                   	pop    %rbp
+  80071c:	c3                   	ret
+        return -SVGA_MAP_ERR;
+  80071d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800722:	eb f4                	jmp    800718 <svga_read_io_bar+0x48>
+
+0000000000800724 <svga_read>:
+
+uint32_t svga_read(struct GraphicsAdapter * adapter, int reg) {
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  800724:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+                 : "cc");
+}
+
+static inline void __attribute__((always_inline))
+outl(int port, uint32_t data) {
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800728:	89 f0                	mov    %esi,%eax
+  80072a:	ef                   	out    %eax,(%dx)
+    return inl(adapter->io_base + SVGA_VALUE);
+  80072b:	83 c2 01             	add    $0x1,%edx
+    asm volatile("inl %w1,%0"
+  80072e:	ed                   	in     (%dx),%eax
+}
+  80072f:	c3                   	ret
+
+0000000000800730 <svga_write>:
+
+void svga_write(struct GraphicsAdapter * adapter, int reg, int value) {
+  800730:	89 d1                	mov    %edx,%ecx
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  800732:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800736:	89 f0                	mov    %esi,%eax
+  800738:	ef                   	out    %eax,(%dx)
+    outl(adapter->io_base + SVGA_VALUE, value);
+  800739:	83 c2 01             	add    $0x1,%edx
+  80073c:	89 c8                	mov    %ecx,%eax
+  80073e:	ef                   	out    %eax,(%dx)
+}
+  80073f:	c3                   	ret
+
+0000000000800740 <svga_map>:
+
+int svga_map(struct GraphicsAdapter * adapter) {
+  800740:	55                   	push   %rbp
+  800741:	48 89 e5             	mov    %rsp,%rbp
+  800744:	41 54                	push   %r12
+  800746:	53                   	push   %rbx
+  800747:	48 89 fb             	mov    %rdi,%rbx
+    int res;
+    int my_envid = sys_getenvid();
+  80074a:	48 b8 e6 2b 80 00 00 	movabs $0x802be6,%rax
+  800751:	00 00 00 
+  800754:	ff d0                	call   *%rax
+  800756:	41 89 c4             	mov    %eax,%r12d
+
+    adapter->fb_base_addr = (volatile uint32_t *) VGA_FB_VADDR;
+  800759:	49 b9 00 00 00 10 70 	movabs $0x7010000000,%r9
+  800760:	00 00 00 
+  800763:	4c 89 4b 10          	mov    %r9,0x10(%rbx)
+    adapter->fifo = (volatile uint32_t *) VGA_FIFO_VADDR;
+  800767:	48 b8 00 00 00 03 70 	movabs $0x7003000000,%rax
+  80076e:	00 00 00 
+  800771:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  800775:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+  800779:	41 89 f0             	mov    %esi,%r8d
+  80077c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800781:	89 f2                	mov    %esi,%edx
+  800783:	ef                   	out    %eax,(%dx)
+    return inl(adapter->io_base + SVGA_VALUE);
+  800784:	83 c6 01             	add    $0x1,%esi
+    asm volatile("inl %w1,%0"
+  800787:	89 f2                	mov    %esi,%edx
+  800789:	ed                   	in     (%dx),%eax
+  80078a:	89 c1                	mov    %eax,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80078c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800791:	44 89 c2             	mov    %r8d,%edx
+  800794:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800795:	89 f2                	mov    %esi,%edx
+  800797:	ed                   	in     (%dx),%eax
+  800798:	89 c7                	mov    %eax,%edi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80079a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80079f:	44 89 c2             	mov    %r8d,%edx
+  8007a2:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8007a3:	89 f2                	mov    %esi,%edx
+  8007a5:	ed                   	in     (%dx),%eax
+
+    size_t fb_size = svga_read(adapter, SVGA_REG_FB_SIZE);
+    uintptr_t fb_start = svga_read(adapter, SVGA_REG_FB_START);
+    uintptr_t fb_offset = svga_read(adapter, SVGA_REG_FB_OFFSET);
+
+    adapter->framebuffer_size = fb_size;
+  8007a6:	89 4b 28             	mov    %ecx,0x28(%rbx)
+    uintptr_t fb_offset = svga_read(adapter, SVGA_REG_FB_OFFSET);
+  8007a9:	89 c0                	mov    %eax,%eax
+    adapter->fb = adapter->fb_base_addr + fb_offset;
+  8007ab:	49 8d 04 81          	lea    (%r9,%rax,4),%rax
+  8007af:	48 89 43 20          	mov    %rax,0x20(%rbx)
+    size_t fb_size = svga_read(adapter, SVGA_REG_FB_SIZE);
+  8007b3:	89 c9                	mov    %ecx,%ecx
+    uintptr_t fb_start = svga_read(adapter, SVGA_REG_FB_START);
+  8007b5:	89 ff                	mov    %edi,%edi
+
+    res = sys_map_physical_region(fb_start, my_envid, (void*)adapter->fb_base_addr, fb_size, PROT_RW | PROT_CD);
+  8007b7:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  8007bd:	4c 89 ca             	mov    %r9,%rdx
+  8007c0:	44 89 e6             	mov    %r12d,%esi
+  8007c3:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  8007ca:	00 00 00 
+  8007cd:	ff d0                	call   *%rax
+    if (res)
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	75 4a                	jne    80081d <svga_map+0xdd>
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  8007d3:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+  8007d7:	89 f7                	mov    %esi,%edi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8007d9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8007de:	89 f2                	mov    %esi,%edx
+  8007e0:	ef                   	out    %eax,(%dx)
+    return inl(adapter->io_base + SVGA_VALUE);
+  8007e1:	83 c6 01             	add    $0x1,%esi
+    asm volatile("inl %w1,%0"
+  8007e4:	89 f2                	mov    %esi,%edx
+  8007e6:	ed                   	in     (%dx),%eax
+  8007e7:	89 c1                	mov    %eax,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8007e9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8007ee:	89 fa                	mov    %edi,%edx
+  8007f0:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8007f1:	89 f2                	mov    %esi,%edx
+  8007f3:	ed                   	in     (%dx),%eax
+        return -SVGA_MAP_ERR;
+
+    size_t fifo_size = svga_read(adapter, SVGA_REG_FIFO_SIZE);
+    uintptr_t fifo_start = svga_read(adapter, SVGA_REG_FIFO_START);
+
+    adapter->fifo_size = fifo_size;
+  8007f4:	89 4b 2c             	mov    %ecx,0x2c(%rbx)
+    size_t fifo_size = svga_read(adapter, SVGA_REG_FIFO_SIZE);
+  8007f7:	89 c9                	mov    %ecx,%ecx
+
+    res = sys_map_physical_region(fifo_start, my_envid, (void*)adapter->fifo, fifo_size, PROT_RW | PROT_CD);
+  8007f9:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+    uintptr_t fifo_start = svga_read(adapter, SVGA_REG_FIFO_START);
+  8007fd:	89 c7                	mov    %eax,%edi
+    res = sys_map_physical_region(fifo_start, my_envid, (void*)adapter->fifo, fifo_size, PROT_RW | PROT_CD);
+  8007ff:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  800805:	44 89 e6             	mov    %r12d,%esi
+  800808:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  80080f:	00 00 00 
+  800812:	ff d0                	call   *%rax
+    if (res)
+  800814:	f7 d8                	neg    %eax
+  800816:	19 c0                	sbb    %eax,%eax
+        return -SVGA_MAP_ERR;
+
+    return SVGA_OK;
+}
+  800818:	5b                   	pop    %rbx
+  800819:	41 5c                	pop    %r12
+  80081b:	5d                   	pop    %rbp
+  80081c:	c3                   	ret
+        return -SVGA_MAP_ERR;
+  80081d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800822:	eb f4                	jmp    800818 <svga_map+0xd8>
+
+0000000000800824 <svga_read_resolution>:
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  800824:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+  800828:	89 ce                	mov    %ecx,%esi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80082a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80082f:	89 ca                	mov    %ecx,%edx
+  800831:	ef                   	out    %eax,(%dx)
+    return inl(adapter->io_base + SVGA_VALUE);
+  800832:	83 c1 01             	add    $0x1,%ecx
+    asm volatile("inl %w1,%0"
+  800835:	89 ca                	mov    %ecx,%edx
+  800837:	ed                   	in     (%dx),%eax
+
+int svga_read_resolution(struct GraphicsAdapter * adapter) {
+    adapter->width = svga_read(adapter, SVGA_REG_WIDTH);
+  800838:	89 47 30             	mov    %eax,0x30(%rdi)
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80083b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800840:	89 f2                	mov    %esi,%edx
+  800842:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800843:	89 ca                	mov    %ecx,%edx
+  800845:	ed                   	in     (%dx),%eax
+    adapter->height = svga_read(adapter, SVGA_REG_HEIGHT);
+  800846:	89 47 34             	mov    %eax,0x34(%rdi)
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800849:	b8 07 00 00 00       	mov    $0x7,%eax
+  80084e:	89 f2                	mov    %esi,%edx
+  800850:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800851:	89 ca                	mov    %ecx,%edx
+  800853:	ed                   	in     (%dx),%eax
+    adapter->bits_per_pixel = svga_read(adapter, SVGA_REG_BPP);
+  800854:	89 47 38             	mov    %eax,0x38(%rdi)
+
+    return SVGA_OK;
+}
+  800857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085c:	c3                   	ret
+
+000000000080085d <svga_set_resolution>:
+
+int svga_set_resolution(struct GraphicsAdapter * adapter, uint32_t w, uint32_t h) {
+  80085d:	41 89 f1             	mov    %esi,%r9d
+  800860:	41 89 d0             	mov    %edx,%r8d
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  800863:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+  800867:	89 ce                	mov    %ecx,%esi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800869:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80086f:	44 89 d8             	mov    %r11d,%eax
+  800872:	89 ca                	mov    %ecx,%edx
+  800874:	ef                   	out    %eax,(%dx)
+    outl(adapter->io_base + SVGA_VALUE, value);
+  800875:	83 c1 01             	add    $0x1,%ecx
+  800878:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80087e:	44 89 d0             	mov    %r10d,%eax
+  800881:	89 ca                	mov    %ecx,%edx
+  800883:	ef                   	out    %eax,(%dx)
+  800884:	b8 02 00 00 00       	mov    $0x2,%eax
+  800889:	89 f2                	mov    %esi,%edx
+  80088b:	ef                   	out    %eax,(%dx)
+  80088c:	44 89 c8             	mov    %r9d,%eax
+  80088f:	89 ca                	mov    %ecx,%edx
+  800891:	ef                   	out    %eax,(%dx)
+  800892:	b8 03 00 00 00       	mov    $0x3,%eax
+  800897:	89 f2                	mov    %esi,%edx
+  800899:	ef                   	out    %eax,(%dx)
+  80089a:	44 89 c0             	mov    %r8d,%eax
+  80089d:	89 ca                	mov    %ecx,%edx
+  80089f:	ef                   	out    %eax,(%dx)
+  8008a0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8008a5:	89 f2                	mov    %esi,%edx
+  8008a7:	ef                   	out    %eax,(%dx)
+  8008a8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8008ad:	89 ca                	mov    %ecx,%edx
+  8008af:	ef                   	out    %eax,(%dx)
+  8008b0:	44 89 d8             	mov    %r11d,%eax
+  8008b3:	89 f2                	mov    %esi,%edx
+  8008b5:	ef                   	out    %eax,(%dx)
+  8008b6:	44 89 d0             	mov    %r10d,%eax
+  8008b9:	89 ca                	mov    %ecx,%edx
+  8008bb:	ef                   	out    %eax,(%dx)
+  8008bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8008c1:	89 f2                	mov    %esi,%edx
+  8008c3:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8008c4:	89 ca                	mov    %ecx,%edx
+  8008c6:	ed                   	in     (%dx),%eax
+    svga_write(adapter, SVGA_REG_WIDTH, w);
+    svga_write(adapter, SVGA_REG_HEIGHT, h);
+    svga_write(adapter, SVGA_REG_BPP, 32);
+    svga_write(adapter, SVGA_REG_ENABLE, 0);
+
+    adapter->fb = adapter->fb_base_addr + svga_read(adapter, SVGA_REG_FB_OFFSET);
+  8008c7:	89 c0                	mov    %eax,%eax
+  8008c9:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8008cd:	48 8d 04 82          	lea    (%rdx,%rax,4),%rax
+  8008d1:	48 89 47 20          	mov    %rax,0x20(%rdi)
+    adapter->width = w;
+  8008d5:	44 89 4f 30          	mov    %r9d,0x30(%rdi)
+    adapter->height = h;
+  8008d9:	44 89 47 34          	mov    %r8d,0x34(%rdi)
+    adapter->bits_per_pixel = 32;
+  8008dd:	c7 47 38 20 00 00 00 	movl   $0x20,0x38(%rdi)
+
+    return SVGA_OK;
+}
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	c3                   	ret
+
+00000000008008ea <svga_set_spec_id>:
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  8008ea:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+  8008ee:	89 cf                	mov    %ecx,%edi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8008f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	89 ca                	mov    %ecx,%edx
+  8008f9:	ef                   	out    %eax,(%dx)
+    outl(adapter->io_base + SVGA_VALUE, value);
+  8008fa:	83 c1 01             	add    $0x1,%ecx
+  8008fd:	b8 02 00 00 90       	mov    $0x90000002,%eax
+  800902:	89 ca                	mov    %ecx,%edx
+  800904:	ef                   	out    %eax,(%dx)
+  800905:	89 f0                	mov    %esi,%eax
+  800907:	89 fa                	mov    %edi,%edx
+  800909:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  80090a:	89 ca                	mov    %ecx,%edx
+  80090c:	ed                   	in     (%dx),%eax
+
+int svga_set_spec_id(struct GraphicsAdapter * adapter) {
+    const int spec_id = 0x90000002;
+    svga_write(adapter, SVGA_REG_ID, spec_id);
+    if (svga_read(adapter, SVGA_REG_ID) != spec_id)
+  80090d:	3d 02 00 00 90       	cmp    $0x90000002,%eax
+  800912:	0f 95 c0             	setne  %al
+  800915:	0f b6 c0             	movzbl %al,%eax
+  800918:	01 c0                	add    %eax,%eax
+        return SVGA_PORT_ERR;
+
+    return SVGA_OK;
+}
+  80091a:	c3                   	ret
+
+000000000080091b <svga_fill>:
+
+void svga_fill(struct GraphicsAdapter * adapter, uint32_t col) {
+    for (int x = 0; x < adapter->width; x++) {
+  80091b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800921:	83 7f 30 00          	cmpl   $0x0,0x30(%rdi)
+  800925:	75 27                	jne    80094e <svga_fill+0x33>
+  800927:	c3                   	ret
+        for (int y = 0; y < adapter->height; y++) {
+            adapter->fb[y * adapter->width + x] = col;
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	0f af 57 30          	imul   0x30(%rdi),%edx
+  80092e:	42 8d 0c 02          	lea    (%rdx,%r8,1),%ecx
+  800932:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  800936:	48 8d 14 8a          	lea    (%rdx,%rcx,4),%rdx
+  80093a:	89 32                	mov    %esi,(%rdx)
+        for (int y = 0; y < adapter->height; y++) {
+  80093c:	83 c0 01             	add    $0x1,%eax
+  80093f:	3b 47 34             	cmp    0x34(%rdi),%eax
+  800942:	72 e4                	jb     800928 <svga_fill+0xd>
+    for (int x = 0; x < adapter->width; x++) {
+  800944:	41 83 c1 01          	add    $0x1,%r9d
+  800948:	44 3b 4f 30          	cmp    0x30(%rdi),%r9d
+  80094c:	73 10                	jae    80095e <svga_fill+0x43>
+  80094e:	45 89 c8             	mov    %r9d,%r8d
+        for (int y = 0; y < adapter->height; y++) {
+  800951:	b8 00 00 00 00       	mov    $0x0,%eax
+  800956:	83 7f 34 00          	cmpl   $0x0,0x34(%rdi)
+  80095a:	75 cc                	jne    800928 <svga_fill+0xd>
+  80095c:	eb e6                	jmp    800944 <svga_fill+0x29>
+        }
+    }
+}
+  80095e:	c3                   	ret
+
+000000000080095f <fifo_init>:
+
+int fifo_init(struct GraphicsAdapter * adapter) {
+    volatile uint32_t * fifo = adapter->fifo;
+  80095f:	48 8b 47 18          	mov    0x18(%rdi),%rax
+
+    fifo[SVGA_FIFO_MIN] = fifo[SVGA_FIFO_STOP] = fifo[SVGA_FIFO_NEXT_CMD] = SVGA_FIFO_REGISTERS_SIZE * sizeof(uint32_t);
+  800963:	c7 40 08 94 04 00 00 	movl   $0x494,0x8(%rax)
+  80096a:	c7 40 0c 94 04 00 00 	movl   $0x494,0xc(%rax)
+  800971:	c7 00 94 04 00 00    	movl   $0x494,(%rax)
+    fifo[SVGA_FIFO_MAX] = adapter->fifo_size;
+  800977:	8b 57 2c             	mov    0x2c(%rdi),%edx
+  80097a:	89 50 04             	mov    %edx,0x4(%rax)
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  80097d:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+  800981:	89 cf                	mov    %ecx,%edi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800983:	be 14 00 00 00       	mov    $0x14,%esi
+  800988:	89 f0                	mov    %esi,%eax
+  80098a:	89 ca                	mov    %ecx,%edx
+  80098c:	ef                   	out    %eax,(%dx)
+    outl(adapter->io_base + SVGA_VALUE, value);
+  80098d:	83 c1 01             	add    $0x1,%ecx
+  800990:	b8 01 00 00 00       	mov    $0x1,%eax
+  800995:	89 ca                	mov    %ecx,%edx
+  800997:	ef                   	out    %eax,(%dx)
+  800998:	89 f0                	mov    %esi,%eax
+  80099a:	89 fa                	mov    %edi,%edx
+  80099c:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  80099d:	89 ca                	mov    %ecx,%edx
+  80099f:	ed                   	in     (%dx),%eax
+
+    if (svga_read(adapter, SVGA_REG_CONFIG_DONE) != 1) {
+        return -SVGA_FIFO_ERR;
+    }
+
+    return SVGA_OK;
+  8009a0:	83 f8 01             	cmp    $0x1,%eax
+  8009a3:	0f 94 c0             	sete   %al
+  8009a6:	0f b6 c0             	movzbl %al,%eax
+  8009a9:	8d 44 40 fd          	lea    -0x3(%rax,%rax,2),%eax
+}
+  8009ad:	c3                   	ret
+
+00000000008009ae <svga_get_capabilities>:
+    outl(adapter->io_base + SVGA_INDEX, reg);
+  8009ae:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8009b2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8009b7:	ef                   	out    %eax,(%dx)
+    return inl(adapter->io_base + SVGA_VALUE);
+  8009b8:	83 c2 01             	add    $0x1,%edx
+    asm volatile("inl %w1,%0"
+  8009bb:	ed                   	in     (%dx),%eax
+
+uint32_t svga_get_capabilities(struct  GraphicsAdapter * adapter) {
+    return svga_read(adapter, SVGA_REG_CAPABILITIES);
+}
+  8009bc:	c3                   	ret
+
+00000000008009bd <fifo_get_capabilities>:
+
+uint32_t fifo_get_capabilities(const struct GraphicsAdapter * adapter) {
+    return adapter->fifo[SVGA_FIFO_CAPABILITIES];
+  8009bd:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8009c1:	8b 40 10             	mov    0x10(%rax),%eax
+}
+  8009c4:	c3                   	ret
+
+00000000008009c5 <get_svga>:
+
+struct GraphicsAdapter* get_svga() {
+    return &svga;
+  8009c5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8009cc:	00 00 00 
+}
+  8009cf:	c3                   	ret
+
+00000000008009d0 <svga_init>:
+
+int svga_init(void) {
+  8009d0:	55                   	push   %rbp
+  8009d1:	48 89 e5             	mov    %rsp,%rbp
+  8009d4:	41 54                	push   %r12
+  8009d6:	53                   	push   %rbx
+    struct GraphicsAdapter * adapter = &svga;
+    int err;
+
+    struct PciDevice *pcidevice = find_pci_dev(PCI_CLASS_DISPLAY, 0);
+  8009d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8009dc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8009e1:	48 b8 0a 15 80 00 00 	movabs $0x80150a,%rax
+  8009e8:	00 00 00 
+  8009eb:	ff d0                	call   *%rax
+    if (pcidevice == NULL)
+  8009ed:	48 85 c0             	test   %rax,%rax
+  8009f0:	74 26                	je     800a18 <svga_init+0x48>
+        panic("VGA device not found\n");
+
+    adapter->pcidev = pcidevice;
+  8009f2:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8009f9:	00 00 00 
+  8009fc:	48 89 07             	mov    %rax,(%rdi)
+
+    err = svga_read_io_bar(adapter);
+  8009ff:	48 b8 d0 06 80 00 00 	movabs $0x8006d0,%rax
+  800a06:	00 00 00 
+  800a09:	ff d0                	call   *%rax
+  800a0b:	89 c3                	mov    %eax,%ebx
+    if (err)
+  800a0d:	85 c0                	test   %eax,%eax
+  800a0f:	74 2c                	je     800a3d <svga_init+0x6d>
+    cprintf("vmware svga capabilities: 0x%X\n", svga_get_capabilities(adapter));
+
+    svga_read_resolution(adapter);
+
+    return SVGA_OK;
+}
+  800a11:	89 d8                	mov    %ebx,%eax
+  800a13:	5b                   	pop    %rbx
+  800a14:	41 5c                	pop    %r12
+  800a16:	5d                   	pop    %rbp
+  800a17:	c3                   	ret
+        panic("VGA device not found\n");
+  800a18:	48 ba 0f 60 80 00 00 	movabs $0x80600f,%rdx
+  800a1f:	00 00 00 
+  800a22:	be 84 00 00 00       	mov    $0x84,%esi
+  800a27:	48 bf 25 60 80 00 00 	movabs $0x806025,%rdi
+  800a2e:	00 00 00 
+  800a31:	48 b9 7e 1a 80 00 00 	movabs $0x801a7e,%rcx
+  800a38:	00 00 00 
+  800a3b:	ff d1                	call   *%rcx
+    err = svga_set_spec_id(adapter);
+  800a3d:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  800a44:	00 00 00 
+  800a47:	48 b8 ea 08 80 00 00 	movabs $0x8008ea,%rax
+  800a4e:	00 00 00 
+  800a51:	ff d0                	call   *%rax
+  800a53:	89 c3                	mov    %eax,%ebx
+    if (err)
+  800a55:	85 c0                	test   %eax,%eax
+  800a57:	75 b8                	jne    800a11 <svga_init+0x41>
+    err = svga_map(adapter);
+  800a59:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  800a60:	00 00 00 
+  800a63:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800a6a:	00 00 00 
+  800a6d:	ff d0                	call   *%rax
+  800a6f:	89 c3                	mov    %eax,%ebx
+    if (err)
+  800a71:	85 c0                	test   %eax,%eax
+  800a73:	75 9c                	jne    800a11 <svga_init+0x41>
+    cprintf("vmware svga capabilities: 0x%X\n", svga_get_capabilities(adapter));
+  800a75:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  800a7c:	00 00 00 
+  800a7f:	4c 89 e7             	mov    %r12,%rdi
+  800a82:	48 b8 ae 09 80 00 00 	movabs $0x8009ae,%rax
+  800a89:	00 00 00 
+  800a8c:	ff d0                	call   *%rax
+  800a8e:	89 c6                	mov    %eax,%esi
+  800a90:	48 bf 68 60 80 00 00 	movabs $0x806068,%rdi
+  800a97:	00 00 00 
+  800a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9f:	48 ba ce 1b 80 00 00 	movabs $0x801bce,%rdx
+  800aa6:	00 00 00 
+  800aa9:	ff d2                	call   *%rdx
+    svga_read_resolution(adapter);
+  800aab:	4c 89 e7             	mov    %r12,%rdi
+  800aae:	48 b8 24 08 80 00 00 	movabs $0x800824,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+    return SVGA_OK;
+  800aba:	e9 52 ff ff ff       	jmp    800a11 <svga_init+0x41>
+
+0000000000800abf <bga_read>:
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  800abf:	ba ce 01 00 00       	mov    $0x1ce,%edx
+  800ac4:	89 f8                	mov    %edi,%eax
+  800ac6:	66 ef                	out    %ax,(%dx)
+    asm volatile("inw %w1,%0"
+  800ac8:	ba cf 01 00 00       	mov    $0x1cf,%edx
+  800acd:	66 ed                	in     (%dx),%ax
+
+uint16_t bga_read(uint16_t index) {
+    outw(VBE_DISPI_IOPORT_INDEX, index);
+    return inw(VBE_DISPI_IOPORT_DATA);
+}
+  800acf:	c3                   	ret
+
+0000000000800ad0 <bga_write>:
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  800ad0:	ba ce 01 00 00       	mov    $0x1ce,%edx
+  800ad5:	89 f8                	mov    %edi,%eax
+  800ad7:	66 ef                	out    %ax,(%dx)
+  800ad9:	ba cf 01 00 00       	mov    $0x1cf,%edx
+  800ade:	89 f0                	mov    %esi,%eax
+  800ae0:	66 ef                	out    %ax,(%dx)
+
+void bga_write(uint16_t index, uint16_t data) {
+    outw(VBE_DISPI_IOPORT_INDEX, index);
+    outw(VBE_DISPI_IOPORT_DATA, data);
+}
+  800ae2:	c3                   	ret
+
+0000000000800ae3 <bga_get_version>:
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae8:	ba ce 01 00 00       	mov    $0x1ce,%edx
+  800aed:	66 ef                	out    %ax,(%dx)
+    asm volatile("inw %w1,%0"
+  800aef:	ba cf 01 00 00       	mov    $0x1cf,%edx
+  800af4:	66 ed                	in     (%dx),%ax
+
+int bga_get_version(void) {
+    return bga_read(VBE_DISPI_INDEX_ID);
+  800af6:	0f b7 c0             	movzwl %ax,%eax
+}
+  800af9:	c3                   	ret
+
+0000000000800afa <bga_set_display_mode>:
+
+int bga_set_display_mode(struct GraphicsAdapter * adapter, uint16_t width, uint16_t height, uint32_t bit_depth, uint32_t use_linear_framebuffer, uint32_t clear_video_memory) {
+  800afa:	55                   	push   %rbp
+  800afb:	48 89 e5             	mov    %rsp,%rbp
+  800afe:	41 55                	push   %r13
+  800b00:	41 54                	push   %r12
+  800b02:	53                   	push   %rbx
+  800b03:	49 89 fa             	mov    %rdi,%r10
+  800b06:	89 f7                	mov    %esi,%edi
+  800b08:	89 d6                	mov    %edx,%esi
+  800b0a:	41 89 cb             	mov    %ecx,%r11d
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  800b0d:	bb ce 01 00 00       	mov    $0x1ce,%ebx
+  800b12:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b17:	89 da                	mov    %ebx,%edx
+  800b19:	66 ef                	out    %ax,(%dx)
+  800b1b:	b9 cf 01 00 00       	mov    $0x1cf,%ecx
+  800b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b25:	89 ca                	mov    %ecx,%edx
+  800b27:	66 ef                	out    %ax,(%dx)
+  800b29:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b2e:	89 da                	mov    %ebx,%edx
+  800b30:	66 ef                	out    %ax,(%dx)
+  800b32:	89 f8                	mov    %edi,%eax
+  800b34:	89 ca                	mov    %ecx,%edx
+  800b36:	66 ef                	out    %ax,(%dx)
+  800b38:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b3d:	89 da                	mov    %ebx,%edx
+  800b3f:	66 ef                	out    %ax,(%dx)
+  800b41:	89 f0                	mov    %esi,%eax
+  800b43:	89 ca                	mov    %ecx,%edx
+  800b45:	66 ef                	out    %ax,(%dx)
+  800b47:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b4c:	89 da                	mov    %ebx,%edx
+  800b4e:	66 ef                	out    %ax,(%dx)
+  800b50:	44 89 d8             	mov    %r11d,%eax
+  800b53:	89 ca                	mov    %ecx,%edx
+  800b55:	66 ef                	out    %ax,(%dx)
+    bga_write(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_DISABLED);
+    bga_write(VBE_DISPI_INDEX_XRES, width);
+    bga_write(VBE_DISPI_INDEX_YRES, height);
+    bga_write(VBE_DISPI_INDEX_BPP, bit_depth);
+    bga_write(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_ENABLED |
+                                             (use_linear_framebuffer ? VBE_DISPI_LFB_ENABLED : 0) |
+  800b57:	41 83 f8 01          	cmp    $0x1,%r8d
+  800b5b:	19 c9                	sbb    %ecx,%ecx
+  800b5d:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800b60:	83 c1 41             	add    $0x41,%ecx
+  800b63:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b68:	ba ce 01 00 00       	mov    $0x1ce,%edx
+  800b6d:	66 ef                	out    %ax,(%dx)
+  800b6f:	45 85 c9             	test   %r9d,%r9d
+  800b72:	0f 94 c0             	sete   %al
+  800b75:	0f b6 c0             	movzbl %al,%eax
+  800b78:	c1 e0 07             	shl    $0x7,%eax
+  800b7b:	09 c8                	or     %ecx,%eax
+  800b7d:	ba cf 01 00 00       	mov    $0x1cf,%edx
+  800b82:	66 ef                	out    %ax,(%dx)
+                                             (clear_video_memory ? 0 : VBE_DISPI_NOCLEARMEM));
+
+    adapter->width = width;
+  800b84:	0f b7 ff             	movzwl %di,%edi
+  800b87:	41 89 7a 30          	mov    %edi,0x30(%r10)
+    adapter->height = height;
+  800b8b:	0f b7 f6             	movzwl %si,%esi
+  800b8e:	41 89 72 34          	mov    %esi,0x34(%r10)
+    adapter->bits_per_pixel = bit_depth;
+  800b92:	45 89 5a 38          	mov    %r11d,0x38(%r10)
+
+    return VIDEO_OK;
+}
+  800b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9b:	5b                   	pop    %rbx
+  800b9c:	41 5c                	pop    %r12
+  800b9e:	41 5d                	pop    %r13
+  800ba0:	5d                   	pop    %rbp
+  800ba1:	c3                   	ret
+
+0000000000800ba2 <bga_map_fb>:
+
+int bga_map_fb(struct GraphicsAdapter * adapter) {
+  800ba2:	55                   	push   %rbp
+  800ba3:	48 89 e5             	mov    %rsp,%rbp
+  800ba6:	41 55                	push   %r13
+  800ba8:	41 54                	push   %r12
+  800baa:	53                   	push   %rbx
+  800bab:	48 83 ec 08          	sub    $0x8,%rsp
+  800baf:	48 89 fb             	mov    %rdi,%rbx
+    adapter->fb_base_addr =  adapter->fb = (volatile uint32_t *) VGA_FB_VADDR;
+  800bb2:	48 b8 00 00 00 10 70 	movabs $0x7010000000,%rax
+  800bb9:	00 00 00 
+  800bbc:	48 89 47 20          	mov    %rax,0x20(%rdi)
+  800bc0:	48 89 47 10          	mov    %rax,0x10(%rdi)
+
+    const size_t bar_size = get_bar_size(adapter->pcidev, 0);
+  800bc4:	48 8b 3f             	mov    (%rdi),%rdi
+  800bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  800bcc:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  800bd3:	00 00 00 
+  800bd6:	ff d0                	call   *%rax
+  800bd8:	41 89 c4             	mov    %eax,%r12d
+    const uintptr_t fb_base = get_bar_address(adapter->pcidev, 0);
+  800bdb:	48 8b 3b             	mov    (%rbx),%rdi
+  800bde:	be 00 00 00 00       	mov    $0x0,%esi
+  800be3:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  800bea:	00 00 00 
+  800bed:	ff d0                	call   *%rax
+  800bef:	49 89 c5             	mov    %rax,%r13
+
+    cprintf("bar_size = %lu, fb_base = %p\n", bar_size, (void*)fb_base);
+  800bf2:	48 89 c2             	mov    %rax,%rdx
+  800bf5:	4c 89 e6             	mov    %r12,%rsi
+  800bf8:	48 bf 32 60 80 00 00 	movabs $0x806032,%rdi
+  800bff:	00 00 00 
+  800c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c07:	48 b9 ce 1b 80 00 00 	movabs $0x801bce,%rcx
+  800c0e:	00 00 00 
+  800c11:	ff d1                	call   *%rcx
+
+    if (!bar_size || !fb_base)
+  800c13:	4d 85 e4             	test   %r12,%r12
+  800c16:	74 35                	je     800c4d <bga_map_fb+0xab>
+  800c18:	4d 85 ed             	test   %r13,%r13
+  800c1b:	74 30                	je     800c4d <bga_map_fb+0xab>
+        return -SVGA_MAP_ERR;
+
+    int res = sys_map_physical_region(fb_base, 0, (void*)adapter->fb_base_addr, bar_size, PROT_RW);
+  800c1d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  800c21:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800c27:	4c 89 e1             	mov    %r12,%rcx
+  800c2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c2f:	4c 89 ef             	mov    %r13,%rdi
+  800c32:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  800c39:	00 00 00 
+  800c3c:	ff d0                	call   *%rax
+    if (res)
+  800c3e:	f7 d8                	neg    %eax
+  800c40:	19 c0                	sbb    %eax,%eax
+        return -SVGA_MAP_ERR;
+
+    return SVGA_OK;
+}
+  800c42:	48 83 c4 08          	add    $0x8,%rsp
+  800c46:	5b                   	pop    %rbx
+  800c47:	41 5c                	pop    %r12
+  800c49:	41 5d                	pop    %r13
+  800c4b:	5d                   	pop    %rbp
+  800c4c:	c3                   	ret
+        return -SVGA_MAP_ERR;
+  800c4d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800c52:	eb ee                	jmp    800c42 <bga_map_fb+0xa0>
+
+0000000000800c54 <bga_init>:
+
+int bga_init(uint32_t width, uint32_t hegiht) {
+  800c54:	55                   	push   %rbp
+  800c55:	48 89 e5             	mov    %rsp,%rbp
+  800c58:	41 54                	push   %r12
+  800c5a:	53                   	push   %rbx
+  800c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c60:	ba ce 01 00 00       	mov    $0x1ce,%edx
+  800c65:	66 ef                	out    %ax,(%dx)
+    asm volatile("inw %w1,%0"
+  800c67:	ba cf 01 00 00       	mov    $0x1cf,%edx
+  800c6c:	66 ed                	in     (%dx),%ax
+  800c6e:	89 c3                	mov    %eax,%ebx
+    int version = bga_get_version();
+    struct GraphicsAdapter * adapter = &svga;
+    struct PciDevice *pcidevice = find_pci_dev(PCI_CLASS_DISPLAY, 0);
+  800c70:	be 00 00 00 00       	mov    $0x0,%esi
+  800c75:	bf 03 00 00 00       	mov    $0x3,%edi
+  800c7a:	48 b8 0a 15 80 00 00 	movabs $0x80150a,%rax
+  800c81:	00 00 00 
+  800c84:	ff d0                	call   *%rax
+    int res;
+    adapter->pcidev = pcidevice;
+  800c86:	49 bc 00 80 80 00 00 	movabs $0x808000,%r12
+  800c8d:	00 00 00 
+  800c90:	49 89 04 24          	mov    %rax,(%r12)
+    return bga_read(VBE_DISPI_INDEX_ID);
+  800c94:	0f b7 f3             	movzwl %bx,%esi
+
+    cprintf("BGA version: 0x%X\n", version);
+  800c97:	48 bf 50 60 80 00 00 	movabs $0x806050,%rdi
+  800c9e:	00 00 00 
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	48 ba ce 1b 80 00 00 	movabs $0x801bce,%rdx
+  800cad:	00 00 00 
+  800cb0:	ff d2                	call   *%rdx
+    res = bga_set_display_mode(adapter, 640, 400, 32, 1, 1);
+  800cb2:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800cb8:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  800cbe:	b9 20 00 00 00       	mov    $0x20,%ecx
+  800cc3:	ba 90 01 00 00       	mov    $0x190,%edx
+  800cc8:	be 80 02 00 00       	mov    $0x280,%esi
+  800ccd:	4c 89 e7             	mov    %r12,%rdi
+  800cd0:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+    if (res)
+  800cdc:	85 c0                	test   %eax,%eax
+  800cde:	74 05                	je     800ce5 <bga_init+0x91>
+    res = bga_map_fb(adapter);
+    if (res)
+        return res;
+
+    return 0;
+}
+  800ce0:	5b                   	pop    %rbx
+  800ce1:	41 5c                	pop    %r12
+  800ce3:	5d                   	pop    %rbp
+  800ce4:	c3                   	ret
+    res = bga_map_fb(adapter);
+  800ce5:	4c 89 e7             	mov    %r12,%rdi
+  800ce8:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  800cef:	00 00 00 
+  800cf2:	ff d0                	call   *%rax
+    if (res)
+  800cf4:	eb ea                	jmp    800ce0 <bga_init+0x8c>
+
+0000000000800cf6 <graphics_init>:
+
+int graphics_init(uint32_t width, uint32_t height, int adapter_type) {
+  800cf6:	55                   	push   %rbp
+  800cf7:	48 89 e5             	mov    %rsp,%rbp
+  800cfa:	41 54                	push   %r12
+  800cfc:	53                   	push   %rbx
+    int res;
+    switch (adapter_type) {
+  800cfd:	83 fa 01             	cmp    $0x1,%edx
+  800d00:	74 2d                	je     800d2f <graphics_init+0x39>
+  800d02:	89 fb                	mov    %edi,%ebx
+  800d04:	41 89 f4             	mov    %esi,%r12d
+  800d07:	83 fa 02             	cmp    $0x2,%edx
+  800d0a:	74 34                	je     800d40 <graphics_init+0x4a>
+        case GRAPHICS_ADAPTER_VMWARE:
+            return svga_init();
+        case GRAPHICS_ADAPTER_BOCHS_VBE:
+            return bga_init(width, height);
+        default:
+            res = svga_init();
+  800d0c:	48 b8 d0 09 80 00 00 	movabs $0x8009d0,%rax
+  800d13:	00 00 00 
+  800d16:	ff d0                	call   *%rax
+            if (res) {
+  800d18:	85 c0                	test   %eax,%eax
+  800d1a:	74 1f                	je     800d3b <graphics_init+0x45>
+                res = bga_init(width, height);
+  800d1c:	44 89 e6             	mov    %r12d,%esi
+  800d1f:	89 df                	mov    %ebx,%edi
+  800d21:	48 b8 54 0c 80 00 00 	movabs $0x800c54,%rax
+  800d28:	00 00 00 
+  800d2b:	ff d0                	call   *%rax
+                if (res)
+  800d2d:	eb 0c                	jmp    800d3b <graphics_init+0x45>
+            return svga_init();
+  800d2f:	48 b8 d0 09 80 00 00 	movabs $0x8009d0,%rax
+  800d36:	00 00 00 
+  800d39:	ff d0                	call   *%rax
+                    return res;
+            }
+            return res;
+    }
+}
+  800d3b:	5b                   	pop    %rbx
+  800d3c:	41 5c                	pop    %r12
+  800d3e:	5d                   	pop    %rbp
+  800d3f:	c3                   	ret
+            return bga_init(width, height);
+  800d40:	48 b8 54 0c 80 00 00 	movabs $0x800c54,%rax
+  800d47:	00 00 00 
+  800d4a:	ff d0                	call   *%rax
+  800d4c:	eb ed                	jmp    800d3b <graphics_init+0x45>
+
+0000000000800d4e <pci_iop_read_dword>:
+
+__attribute__((always_inline)) static inline void
+pci_iop_select_address(struct PciDevice *pcid, uint8_t reg) {
+    /* Assemble address of requested port. */
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+                       ((uint32_t)pcid->bus << 16) |
+  800d4e:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  800d52:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  800d55:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  800d59:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  800d5c:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  800d5e:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  800d64:	09 f0                	or     %esi,%eax
+  800d66:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  800d6a:	c1 e2 08             	shl    $0x8,%edx
+  800d6d:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  800d6f:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800d74:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  800d79:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800d7a:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  800d7f:	ed                   	in     (%dx),%eax
+static inline uint32_t
+pci_iop_read_dword(struct PciDevice *pcid, uint8_t reg) {
+    pci_iop_select_address(pcid, reg);
+    /* Read 32-bit value from the selected PCI address */
+    return inl(PCI_PORT_DATA);
+}
+  800d80:	c3                   	ret
+
+0000000000800d81 <pci_iop_write_dword>:
+
+static inline void
+pci_iop_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  800d81:	89 d1                	mov    %edx,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  800d83:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  800d87:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  800d8a:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  800d8e:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  800d91:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  800d93:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  800d99:	09 f0                	or     %esi,%eax
+  800d9b:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  800d9f:	c1 e2 08             	shl    $0x8,%edx
+  800da2:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  800da4:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800da9:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  800dae:	ef                   	out    %eax,(%dx)
+  800daf:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  800db4:	89 c8                	mov    %ecx,%eax
+  800db6:	ef                   	out    %eax,(%dx)
+    pci_iop_select_address(pcid, reg);
+    /* Write 32-bit value to the selected PCI address */
+    outl(PCI_PORT_DATA, value);
+}
+  800db7:	c3                   	ret
+
+0000000000800db8 <pci_ecam_read_word>:
+}
+
+static inline volatile void *
+pci_ecam_addr(struct PciDevice *pcid, uint8_t reg) {
+    return (volatile void *)(ecam_base_addr +
+                             ((pcid->bus & 0xFF) << 20) +
+  800db8:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  800dbc:	c1 e2 14             	shl    $0x14,%edx
+  800dbf:	48 63 d2             	movslq %edx,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+                             ((pcid->function & 0x7) << 12) +
+                             (reg & 0xFFF));
+  800dc2:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800dc8:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800dcb:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  800dcf:	c1 e0 0f             	shl    $0xf,%eax
+  800dd2:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  800dd7:	48 01 c2             	add    %rax,%rdx
+  800dda:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  800dde:	c1 e0 0c             	shl    $0xc,%eax
+  800de1:	25 00 70 00 00       	and    $0x7000,%eax
+  800de6:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800de9:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800df0:	00 00 00 
+  800df3:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+}
+
+static inline uint16_t
+pci_ecam_read_word(struct PciDevice *pcid, uint8_t reg) {
+    return *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe);
+  800df6:	0f b7 02             	movzwl (%rdx),%eax
+}
+  800df9:	c3                   	ret
+
+0000000000800dfa <parse_hex>:
+    return -1;
+}
+
+static unsigned long
+parse_hex(char **str) {
+    unsigned long x = 0;
+  800dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dff:	eb 14                	jmp    800e15 <parse_hex+0x1b>
+        return 10 + c - 'a';
+  800e01:	8d 56 a9             	lea    -0x57(%rsi),%edx
+    for (;; (*str)++) {
+        int d = to_hexdigit(**str);
+        if (d < 0)
+            return x;
+
+        x = (x << 4) + d;
+  800e04:	48 c1 e0 04          	shl    $0x4,%rax
+  800e08:	48 63 d2             	movslq %edx,%rdx
+  800e0b:	48 01 d0             	add    %rdx,%rax
+    for (;; (*str)++) {
+  800e0e:	48 83 c1 01          	add    $0x1,%rcx
+  800e12:	48 89 0f             	mov    %rcx,(%rdi)
+        int d = to_hexdigit(**str);
+  800e15:	48 8b 0f             	mov    (%rdi),%rcx
+  800e18:	0f be 31             	movsbl (%rcx),%esi
+    if (c - '0' <= 9)
+  800e1b:	8d 56 d0             	lea    -0x30(%rsi),%edx
+  800e1e:	83 fa 09             	cmp    $0x9,%edx
+  800e21:	76 e1                	jbe    800e04 <parse_hex+0xa>
+    if (c - 'a' <= 'f' - 'a')
+  800e23:	8d 56 9f             	lea    -0x61(%rsi),%edx
+  800e26:	83 fa 05             	cmp    $0x5,%edx
+  800e29:	76 d6                	jbe    800e01 <parse_hex+0x7>
+    if (c - 'A' <= 'F' - 'A')
+  800e2b:	8d 56 bf             	lea    -0x41(%rsi),%edx
+  800e2e:	83 fa 05             	cmp    $0x5,%edx
+  800e31:	77 05                	ja     800e38 <parse_hex+0x3e>
+        return 10 + c - 'A';
+  800e33:	8d 56 c9             	lea    -0x37(%rsi),%edx
+  800e36:	eb cc                	jmp    800e04 <parse_hex+0xa>
+    }
+}
+  800e38:	c3                   	ret
+
+0000000000800e39 <pci_ecam_read_byte>:
+                             ((pcid->bus & 0xFF) << 20) +
+  800e39:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  800e3d:	c1 e2 14             	shl    $0x14,%edx
+  800e40:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  800e43:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800e47:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800e4a:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  800e4e:	c1 e0 0f             	shl    $0xf,%eax
+  800e51:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  800e56:	48 01 c2             	add    %rax,%rdx
+  800e59:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  800e5d:	c1 e0 0c             	shl    $0xc,%eax
+  800e60:	25 00 70 00 00       	and    $0x7000,%eax
+  800e65:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800e68:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800e6f:	00 00 00 
+  800e72:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint8_t *)pci_ecam_addr(pcid, reg);
+  800e75:	0f b6 02             	movzbl (%rdx),%eax
+}
+  800e78:	c3                   	ret
+
+0000000000800e79 <pci_ecam_write_byte>:
+pci_ecam_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  800e79:	48 89 f8             	mov    %rdi,%rax
+  800e7c:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  800e7e:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  800e82:	c1 e2 14             	shl    $0x14,%edx
+  800e85:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  800e88:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800e8c:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800e8f:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  800e93:	c1 e1 0f             	shl    $0xf,%ecx
+  800e96:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  800e9c:	48 01 ca             	add    %rcx,%rdx
+  800e9f:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  800ea3:	c1 e0 0c             	shl    $0xc,%eax
+  800ea6:	25 00 70 00 00       	and    $0x7000,%eax
+  800eab:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800eae:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800eb5:	00 00 00 
+  800eb8:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint8_t *)pci_ecam_addr(pcid, reg) = value;
+  800ebb:	40 88 3a             	mov    %dil,(%rdx)
+}
+  800ebe:	c3                   	ret
+
+0000000000800ebf <pci_ecam_write_dword>:
+pci_ecam_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  800ebf:	48 89 f8             	mov    %rdi,%rax
+  800ec2:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  800ec4:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  800ec8:	c1 e2 14             	shl    $0x14,%edx
+  800ecb:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  800ece:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800ed4:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800ed7:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  800edb:	c1 e1 0f             	shl    $0xf,%ecx
+  800ede:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  800ee4:	48 01 ca             	add    %rcx,%rdx
+  800ee7:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  800eeb:	c1 e0 0c             	shl    $0xc,%eax
+  800eee:	25 00 70 00 00       	and    $0x7000,%eax
+  800ef3:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800ef6:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800efd:	00 00 00 
+  800f00:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc) = value;
+  800f03:	89 3a                	mov    %edi,(%rdx)
+}
+  800f05:	c3                   	ret
+
+0000000000800f06 <pci_ecam_write_word>:
+pci_ecam_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  800f06:	48 89 f8             	mov    %rdi,%rax
+  800f09:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  800f0b:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  800f0f:	c1 e2 14             	shl    $0x14,%edx
+  800f12:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  800f15:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800f1b:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800f1e:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  800f22:	c1 e1 0f             	shl    $0xf,%ecx
+  800f25:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  800f2b:	48 01 ca             	add    %rcx,%rdx
+  800f2e:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  800f32:	c1 e0 0c             	shl    $0xc,%eax
+  800f35:	25 00 70 00 00       	and    $0x7000,%eax
+  800f3a:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800f3d:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800f44:	00 00 00 
+  800f47:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe) = value;
+  800f4a:	66 89 3a             	mov    %di,(%rdx)
+}
+  800f4d:	c3                   	ret
+
+0000000000800f4e <pci_ecam_read_dword>:
+                             ((pcid->bus & 0xFF) << 20) +
+  800f4e:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  800f52:	c1 e2 14             	shl    $0x14,%edx
+  800f55:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  800f58:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  800f5e:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  800f61:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  800f65:	c1 e0 0f             	shl    $0xf,%eax
+  800f68:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  800f6d:	48 01 c2             	add    %rax,%rdx
+  800f70:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  800f74:	c1 e0 0c             	shl    $0xc,%eax
+  800f77:	25 00 70 00 00       	and    $0x7000,%eax
+  800f7c:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  800f7f:	48 a1 10 82 80 00 00 	movabs 0x808210,%rax
+  800f86:	00 00 00 
+  800f89:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+  800f8c:	8b 02                	mov    (%rdx),%eax
+}
+  800f8e:	c3                   	ret
+
+0000000000800f8f <pci_iop_read_word>:
+pci_iop_read_word(struct PciDevice *pcid, uint8_t reg) {
+  800f8f:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  800f91:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  800f95:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  800f98:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  800f9c:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  800f9f:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  800fa1:	89 f2                	mov    %esi,%edx
+  800fa3:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  800fa9:	09 d0                	or     %edx,%eax
+  800fab:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  800faf:	c1 e2 08             	shl    $0x8,%edx
+  800fb2:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  800fb4:	0d 00 00 00 80       	or     $0x80000000,%eax
+  800fb9:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  800fbe:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800fbf:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  800fc4:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x2) * 8);
+  800fc5:	83 e1 02             	and    $0x2,%ecx
+  800fc8:	c1 e1 03             	shl    $0x3,%ecx
+  800fcb:	d3 e8                	shr    %cl,%eax
+}
+  800fcd:	c3                   	ret
+
+0000000000800fce <pci_iop_read_byte>:
+pci_iop_read_byte(struct PciDevice *pcid, uint8_t reg) {
+  800fce:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  800fd0:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  800fd4:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  800fd7:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  800fdb:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  800fde:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  800fe0:	89 f2                	mov    %esi,%edx
+  800fe2:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  800fe8:	09 d0                	or     %edx,%eax
+  800fea:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  800fee:	c1 e2 08             	shl    $0x8,%edx
+  800ff1:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  800ff3:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800ff8:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  800ffd:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  800ffe:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  801003:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x3) * 8);
+  801004:	83 e1 03             	and    $0x3,%ecx
+  801007:	c1 e1 03             	shl    $0x3,%ecx
+  80100a:	d3 e8                	shr    %cl,%eax
+}
+  80100c:	c3                   	ret
+
+000000000080100d <pci_iop_write_byte>:
+pci_iop_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  80100d:	89 f1                	mov    %esi,%ecx
+  80100f:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  801012:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  801016:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  801019:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  80101d:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  801020:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  801022:	89 c8                	mov    %ecx,%eax
+  801024:	25 fc 00 00 00       	and    $0xfc,%eax
+  801029:	09 c6                	or     %eax,%esi
+  80102b:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  80102f:	c1 e0 08             	shl    $0x8,%eax
+  801032:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  801034:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80103a:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  801040:	89 f0                	mov    %esi,%eax
+  801042:	44 89 ca             	mov    %r9d,%edx
+  801045:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  801046:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  80104b:	89 fa                	mov    %edi,%edx
+  80104d:	ed                   	in     (%dx),%eax
+  80104e:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x3) * 8);
+  801051:	83 e1 03             	and    $0x3,%ecx
+  801054:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  801057:	89 f0                	mov    %esi,%eax
+  801059:	44 89 ca             	mov    %r9d,%edx
+  80105c:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFF << shift);
+  80105d:	b8 ff 00 00 00       	mov    $0xff,%eax
+  801062:	d3 e0                	shl    %cl,%eax
+  801064:	f7 d0                	not    %eax
+  801066:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  801069:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80106d:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  801070:	44 09 c0             	or     %r8d,%eax
+  801073:	89 fa                	mov    %edi,%edx
+  801075:	ef                   	out    %eax,(%dx)
+}
+  801076:	c3                   	ret
+
+0000000000801077 <pci_iop_write_word>:
+pci_iop_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  801077:	89 f1                	mov    %esi,%ecx
+  801079:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  80107c:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  801080:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  801083:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  801087:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  80108a:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  80108c:	89 c8                	mov    %ecx,%eax
+  80108e:	25 fc 00 00 00       	and    $0xfc,%eax
+  801093:	09 c6                	or     %eax,%esi
+  801095:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  801099:	c1 e0 08             	shl    $0x8,%eax
+  80109c:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  80109e:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+  8010a4:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  8010aa:	89 f0                	mov    %esi,%eax
+  8010ac:	44 89 ca             	mov    %r9d,%edx
+  8010af:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8010b0:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  8010b5:	89 fa                	mov    %edi,%edx
+  8010b7:	ed                   	in     (%dx),%eax
+  8010b8:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x2) * 8);
+  8010bb:	83 e1 02             	and    $0x2,%ecx
+  8010be:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8010c1:	89 f0                	mov    %esi,%eax
+  8010c3:	44 89 ca             	mov    %r9d,%edx
+  8010c6:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFFFF << shift);
+  8010c7:	b8 ff ff 00 00       	mov    $0xffff,%eax
+  8010cc:	d3 e0                	shl    %cl,%eax
+  8010ce:	f7 d0                	not    %eax
+  8010d0:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  8010d3:	45 0f b7 c0          	movzwl %r8w,%r8d
+  8010d7:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  8010da:	44 09 c0             	or     %r8d,%eax
+  8010dd:	89 fa                	mov    %edi,%edx
+  8010df:	ef                   	out    %eax,(%dx)
+}
+  8010e0:	c3                   	ret
+
+00000000008010e1 <init_pci_device>:
+init_pci_device(uint8_t bus, uint8_t device, uint8_t function) {
+  8010e1:	55                   	push   %rbp
+  8010e2:	48 89 e5             	mov    %rsp,%rbp
+  8010e5:	41 57                	push   %r15
+  8010e7:	41 56                	push   %r14
+  8010e9:	41 55                	push   %r13
+  8010eb:	41 54                	push   %r12
+  8010ed:	53                   	push   %rbx
+  8010ee:	48 83 ec 78          	sub    $0x78,%rsp
+  8010f2:	41 89 ff             	mov    %edi,%r15d
+    struct PciDevice tmp_dev = {.bus = bus, .device = device, .function = function};
+  8010f5:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  8010fc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+  801106:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801109:	44 88 7d 88          	mov    %r15b,-0x78(%rbp)
+  80110d:	89 b5 6c ff ff ff    	mov    %esi,-0x94(%rbp)
+  801113:	40 88 75 89          	mov    %sil,-0x77(%rbp)
+  801117:	89 95 60 ff ff ff    	mov    %edx,-0xa0(%rbp)
+  80111d:	88 55 8a             	mov    %dl,-0x76(%rbp)
+    uint16_t vendor_id = pcie_io.read16(&tmp_dev, PCI_REG_VENDOR_ID);
+  801120:	be 00 00 00 00       	mov    $0x0,%esi
+  801125:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  80112c:	48 a1 e8 81 80 00 00 	movabs 0x8081e8,%rax
+  801133:	00 00 00 
+  801136:	ff d0                	call   *%rax
+    if (vendor_id == PCI_DEVICE_VENDOR_NONE)
+  801138:	66 83 f8 ff          	cmp    $0xffff,%ax
+  80113c:	0f 84 b6 02 00 00    	je     8013f8 <init_pci_device+0x317>
+    if (pcidev_cnt >= PCI_MAX_DEVICES)
+  801142:	a1 40 80 80 00 00 00 	movabs 0x808040,%eax
+  801149:	00 00 
+  80114b:	83 f8 09             	cmp    $0x9,%eax
+  80114e:	0f 8f bc 02 00 00    	jg     801410 <init_pci_device+0x32f>
+    return &pci_device_buffer[pcidev_cnt++];
+  801154:	89 c1                	mov    %eax,%ecx
+  801156:	8d 40 01             	lea    0x1(%rax),%eax
+  801159:	a3 40 80 80 00 00 00 	movabs %eax,0x808040
+  801160:	00 00 
+  801162:	89 8d 68 ff ff ff    	mov    %ecx,-0x98(%rbp)
+  801168:	4c 63 e1             	movslq %ecx,%r12
+  80116b:	4b 8d 1c a4          	lea    (%r12,%r12,4),%rbx
+  80116f:	48 01 db             	add    %rbx,%rbx
+  801172:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801176:	49 bd 20 82 80 00 00 	movabs $0x808220,%r13
+  80117d:	00 00 00 
+  801180:	4d 8d 74 c5 00       	lea    0x0(%r13,%rax,8),%r14
+    memset(pcid, 0, sizeof(*pcid));
+  801185:	ba 58 00 00 00       	mov    $0x58,%edx
+  80118a:	be 00 00 00 00       	mov    $0x0,%esi
+  80118f:	4c 89 f7             	mov    %r14,%rdi
+  801192:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  801199:	00 00 00 
+  80119c:	ff d0                	call   *%rax
+    pcid->bus = bus;
+  80119e:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8011a2:	45 88 7c c5 10       	mov    %r15b,0x10(%r13,%rax,8)
+    pcid->device = device;
+  8011a7:	0f b6 bd 6c ff ff ff 	movzbl -0x94(%rbp),%edi
+  8011ae:	41 88 7c c5 11       	mov    %dil,0x11(%r13,%rax,8)
+    pcid->function = function;
+  8011b3:	0f b6 bd 60 ff ff ff 	movzbl -0xa0(%rbp),%edi
+  8011ba:	41 88 7c c5 12       	mov    %dil,0x12(%r13,%rax,8)
+    pcid->vendor_id = pcie_io.read16(pcid, PCI_REG_VENDOR_ID);
+  8011bf:	49 bf e0 81 80 00 00 	movabs $0x8081e0,%r15
+  8011c6:	00 00 00 
+  8011c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ce:	4c 89 f7             	mov    %r14,%rdi
+  8011d1:	41 ff 57 08          	call   *0x8(%r15)
+  8011d5:	89 c2                	mov    %eax,%edx
+  8011d7:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8011db:	66 41 89 54 c5 14    	mov    %dx,0x14(%r13,%rax,8)
+    pcid->device_id = pcie_io.read16(pcid, PCI_REG_DEVICE_ID);
+  8011e1:	be 02 00 00 00       	mov    $0x2,%esi
+  8011e6:	4c 89 f7             	mov    %r14,%rdi
+  8011e9:	41 ff 57 08          	call   *0x8(%r15)
+  8011ed:	89 c2                	mov    %eax,%edx
+  8011ef:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8011f3:	66 41 89 54 c5 16    	mov    %dx,0x16(%r13,%rax,8)
+    pcid->subvendor_id = pcie_io.read16(pcid, PCI_REG_SUB_VENDOR_ID);
+  8011f9:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8011fe:	4c 89 f7             	mov    %r14,%rdi
+  801201:	41 ff 57 08          	call   *0x8(%r15)
+  801205:	89 c2                	mov    %eax,%edx
+  801207:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80120b:	66 41 89 54 c5 18    	mov    %dx,0x18(%r13,%rax,8)
+    pcid->subdevice_id = pcie_io.read16(pcid, PCI_REG_SUB_DEVICE_ID);
+  801211:	be 2e 00 00 00       	mov    $0x2e,%esi
+  801216:	4c 89 f7             	mov    %r14,%rdi
+  801219:	41 ff 57 08          	call   *0x8(%r15)
+  80121d:	89 c2                	mov    %eax,%edx
+  80121f:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801223:	66 41 89 54 c5 1a    	mov    %dx,0x1a(%r13,%rax,8)
+    pcid->revision_id = pcie_io.read8(pcid, PCI_REG_REVISION_ID);
+  801229:	be 08 00 00 00       	mov    $0x8,%esi
+  80122e:	4c 89 f7             	mov    %r14,%rdi
+  801231:	41 ff 57 10          	call   *0x10(%r15)
+  801235:	89 c2                	mov    %eax,%edx
+  801237:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80123b:	41 88 54 c5 1c       	mov    %dl,0x1c(%r13,%rax,8)
+    pcid->class = pcie_io.read8(pcid, PCI_REG_CLASS);
+  801240:	be 0b 00 00 00       	mov    $0xb,%esi
+  801245:	4c 89 f7             	mov    %r14,%rdi
+  801248:	41 ff 57 10          	call   *0x10(%r15)
+  80124c:	89 c2                	mov    %eax,%edx
+  80124e:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801252:	41 88 54 c5 1d       	mov    %dl,0x1d(%r13,%rax,8)
+    pcid->subclass = pcie_io.read8(pcid, PCI_REG_SUBCLASS);
+  801257:	be 0a 00 00 00       	mov    $0xa,%esi
+  80125c:	4c 89 f7             	mov    %r14,%rdi
+  80125f:	41 ff 57 10          	call   *0x10(%r15)
+  801263:	89 c2                	mov    %eax,%edx
+  801265:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801269:	41 88 54 c5 1e       	mov    %dl,0x1e(%r13,%rax,8)
+    pcid->interface = pcie_io.read8(pcid, PCI_REG_PROG_IF);
+  80126e:	be 09 00 00 00       	mov    $0x9,%esi
+  801273:	4c 89 f7             	mov    %r14,%rdi
+  801276:	41 ff 57 10          	call   *0x10(%r15)
+  80127a:	89 c2                	mov    %eax,%edx
+  80127c:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801280:	41 88 54 c5 1f       	mov    %dl,0x1f(%r13,%rax,8)
+    pcid->header_type = pcie_io.read8(pcid, PCI_REG_HEADER_TYPE);
+  801285:	be 0e 00 00 00       	mov    $0xe,%esi
+  80128a:	4c 89 f7             	mov    %r14,%rdi
+  80128d:	41 ff 57 10          	call   *0x10(%r15)
+  801291:	89 c2                	mov    %eax,%edx
+  801293:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  801297:	41 88 54 c5 20       	mov    %dl,0x20(%r13,%rax,8)
+    pcid->interrupt_pin = pcie_io.read8(pcid, PCI_REG_INTERRUPT_PIN);
+  80129c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8012a1:	4c 89 f7             	mov    %r14,%rdi
+  8012a4:	41 ff 57 10          	call   *0x10(%r15)
+  8012a8:	89 c2                	mov    %eax,%edx
+  8012aa:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8012ae:	41 88 54 c5 54       	mov    %dl,0x54(%r13,%rax,8)
+    pcid->interrupt_line = pcie_io.read8(pcid, PCI_REG_INTERRUPT_LINE);
+  8012b3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8012b8:	4c 89 f7             	mov    %r14,%rdi
+  8012bb:	41 ff 57 10          	call   *0x10(%r15)
+  8012bf:	89 c2                	mov    %eax,%edx
+  8012c1:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8012c5:	41 88 54 c5 55       	mov    %dl,0x55(%r13,%rax,8)
+    pcid->interrupt_no = 0;
+  8012ca:	41 c6 44 c5 56 00    	movb   $0x0,0x56(%r13,%rax,8)
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  8012d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  8012d5:	4d 89 ec             	mov    %r13,%r12
+  8012d8:	48 63 85 68 ff ff ff 	movslq -0x98(%rbp),%rax
+  8012df:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8012e3:	4c 8d 3c 50          	lea    (%rax,%rdx,2),%r15
+  8012e7:	e9 ae 00 00 00       	jmp    80139a <init_pci_device+0x2b9>
+            pcid->bars[i].base_address = bar & PCI_BAR_MEMORY_MASK;
+  8012ec:	49 63 d5             	movslq %r13d,%rdx
+  8012ef:	49 8d 74 17 04       	lea    0x4(%r15,%rdx,1),%rsi
+  8012f4:	89 c2                	mov    %eax,%edx
+  8012f6:	83 e2 f0             	and    $0xfffffff0,%edx
+  8012f9:	41 89 54 f4 08       	mov    %edx,0x8(%r12,%rsi,8)
+            pcid->bars[i].address_is_64bits = (bar & PCI_BAR_BITS64) != 0;
+  8012fe:	89 c1                	mov    %eax,%ecx
+  801300:	c1 e9 02             	shr    $0x2,%ecx
+  801303:	83 e1 01             	and    $0x1,%ecx
+  801306:	01 c9                	add    %ecx,%ecx
+  801308:	41 0f b6 54 f4 04    	movzbl 0x4(%r12,%rsi,8),%edx
+  80130e:	83 e2 f9             	and    $0xfffffff9,%edx
+            pcid->bars[i].prefetchable = (bar & PCI_BAR_PREFETCHABLE) != 0;
+  801311:	c1 e8 03             	shr    $0x3,%eax
+  801314:	83 e0 01             	and    $0x1,%eax
+  801317:	c1 e0 02             	shl    $0x2,%eax
+  80131a:	09 ca                	or     %ecx,%edx
+  80131c:	09 d0                	or     %edx,%eax
+  80131e:	41 88 44 f4 04       	mov    %al,0x4(%r12,%rsi,8)
+            if (pcid->bars[i].address_is_64bits) {
+  801323:	a8 02                	test   $0x2,%al
+  801325:	74 6b                	je     801392 <init_pci_device+0x2b1>
+                pcid->bars[i + 1].address_is_64bits = 1;
+  801327:	41 8d 45 01          	lea    0x1(%r13),%eax
+  80132b:	48 98                	cltq
+  80132d:	49 8d 7c 07 04       	lea    0x4(%r15,%rax,1),%rdi
+  801332:	48 89 bd 60 ff ff ff 	mov    %rdi,-0xa0(%rbp)
+  801339:	41 80 4c fc 04 02    	orb    $0x2,0x4(%r12,%rdi,8)
+                pcid->bars[i + 1].base_address = pcie_io.read32(pcid, PCI_REG_BAR0 + ((i + 1) * sizeof(uint32_t)));
+  80133f:	0f b6 b5 6c ff ff ff 	movzbl -0x94(%rbp),%esi
+  801346:	83 c6 04             	add    $0x4,%esi
+  801349:	40 0f b6 f6          	movzbl %sil,%esi
+  80134d:	4c 89 f7             	mov    %r14,%rdi
+  801350:	48 b8 e0 81 80 00 00 	movabs $0x8081e0,%rax
+  801357:	00 00 00 
+  80135a:	ff 10                	call   *(%rax)
+  80135c:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  801363:	41 89 44 fc 08       	mov    %eax,0x8(%r12,%rdi,8)
+                pcid->bars[i + 1].prefetchable = pcid->bars[i].prefetchable;
+  801368:	4d 63 ed             	movslq %r13d,%r13
+  80136b:	4b 8d 44 2f 04       	lea    0x4(%r15,%r13,1),%rax
+  801370:	41 0f b6 54 c4 04    	movzbl 0x4(%r12,%rax,8),%edx
+  801376:	83 e2 04             	and    $0x4,%edx
+  801379:	41 0f b6 44 fc 04    	movzbl 0x4(%r12,%rdi,8),%eax
+  80137f:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  801385:	83 e0 fb             	and    $0xfffffffb,%eax
+  801388:	09 d0                	or     %edx,%eax
+  80138a:	41 88 44 fc 04       	mov    %al,0x4(%r12,%rdi,8)
+                i++;
+  80138f:	83 c3 01             	add    $0x1,%ebx
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  801392:	83 c3 01             	add    $0x1,%ebx
+  801395:	80 fb 05             	cmp    $0x5,%bl
+  801398:	77 64                	ja     8013fe <init_pci_device+0x31d>
+        uint32_t bar = pcie_io.read32(pcid, PCI_REG_BAR0 + (i * sizeof(uint32_t)));
+  80139a:	8d 04 9d 10 00 00 00 	lea    0x10(,%rbx,4),%eax
+  8013a1:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  8013a7:	0f b6 f0             	movzbl %al,%esi
+  8013aa:	4c 89 f7             	mov    %r14,%rdi
+  8013ad:	48 b8 e0 81 80 00 00 	movabs $0x8081e0,%rax
+  8013b4:	00 00 00 
+  8013b7:	ff 10                	call   *(%rax)
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  8013b9:	44 0f b6 eb          	movzbl %bl,%r13d
+  8013bd:	0f b6 d3             	movzbl %bl,%edx
+  8013c0:	4a 8d 4c 3a 04       	lea    0x4(%rdx,%r15,1),%rcx
+  8013c5:	89 c6                	mov    %eax,%esi
+  8013c7:	83 e6 01             	and    $0x1,%esi
+  8013ca:	40 0f 95 c7          	setne  %dil
+  8013ce:	41 0f b6 54 cc 04    	movzbl 0x4(%r12,%rcx,8),%edx
+  8013d4:	83 e2 fe             	and    $0xfffffffe,%edx
+  8013d7:	09 fa                	or     %edi,%edx
+  8013d9:	41 88 54 cc 04       	mov    %dl,0x4(%r12,%rcx,8)
+        if (pcid->bars[i].port_mapped) {
+  8013de:	85 f6                	test   %esi,%esi
+  8013e0:	0f 84 06 ff ff ff    	je     8012ec <init_pci_device+0x20b>
+            pcid->bars[i].base_address = bar & PCI_BAR_PORT_MASK;
+  8013e6:	4d 63 ed             	movslq %r13d,%r13
+  8013e9:	4b 8d 54 2f 04       	lea    0x4(%r15,%r13,1),%rdx
+  8013ee:	83 e0 fc             	and    $0xfffffffc,%eax
+  8013f1:	41 89 44 d4 08       	mov    %eax,0x8(%r12,%rdx,8)
+  8013f6:	eb 9a                	jmp    801392 <init_pci_device+0x2b1>
+        return NULL;
+  8013f8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+}
+  8013fe:	4c 89 f0             	mov    %r14,%rax
+  801401:	48 83 c4 78          	add    $0x78,%rsp
+  801405:	5b                   	pop    %rbx
+  801406:	41 5c                	pop    %r12
+  801408:	41 5d                	pop    %r13
+  80140a:	41 5e                	pop    %r14
+  80140c:	41 5f                	pop    %r15
+  80140e:	5d                   	pop    %rbp
+  80140f:	c3                   	ret
+        return NULL;
+  801410:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801416:	eb e6                	jmp    8013fe <init_pci_device+0x31d>
+
+0000000000801418 <pci_check_busses>:
+pci_check_busses(uint8_t bus, struct PciDevice *parent) {
+  801418:	55                   	push   %rbp
+  801419:	48 89 e5             	mov    %rsp,%rbp
+  80141c:	41 57                	push   %r15
+  80141e:	41 56                	push   %r14
+  801420:	41 55                	push   %r13
+  801422:	41 54                	push   %r12
+  801424:	53                   	push   %rbx
+  801425:	48 83 ec 18          	sub    $0x18,%rsp
+  801429:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80142d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  801433:	40 0f b6 c7          	movzbl %dil,%eax
+  801437:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80143a:	49 bf e1 10 80 00 00 	movabs $0x8010e1,%r15
+  801441:	00 00 00 
+    pcid->next = pci_device_list;
+  801444:	49 be 90 85 80 00 00 	movabs $0x808590,%r14
+  80144b:	00 00 00 
+  80144e:	eb 40                	jmp    801490 <pci_check_busses+0x78>
+  801450:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  801456:	eb 1b                	jmp    801473 <pci_check_busses+0x5b>
+    pcid->parent = parent;
+  801458:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80145c:	48 89 08             	mov    %rcx,(%rax)
+    pcid->next = pci_device_list;
+  80145f:	49 8b 16             	mov    (%r14),%rdx
+  801462:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pci_device_list = pcid;
+  801466:	49 89 06             	mov    %rax,(%r14)
+            for (uint8_t func = 1; func < PCI_NUM_FUNCTIONS; func++) {
+  801469:	41 83 c5 01          	add    $0x1,%r13d
+  80146d:	41 83 fd 08          	cmp    $0x8,%r13d
+  801471:	74 4e                	je     8014c1 <pci_check_busses+0xa9>
+                struct PciDevice *func_dev = init_pci_device(bus, device, func);
+  801473:	44 89 ea             	mov    %r13d,%edx
+  801476:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  801479:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80147c:	41 ff d7             	call   *%r15
+                if (!func_dev)
+  80147f:	48 85 c0             	test   %rax,%rax
+  801482:	75 d4                	jne    801458 <pci_check_busses+0x40>
+  801484:	eb e3                	jmp    801469 <pci_check_busses+0x51>
+    for (uint8_t device = 0; device < PCI_NUM_DEVICES; device++) {
+  801486:	41 83 c4 01          	add    $0x1,%r12d
+  80148a:	41 83 fc 20          	cmp    $0x20,%r12d
+  80148e:	74 6b                	je     8014fb <pci_check_busses+0xe3>
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  801490:	44 89 65 c8          	mov    %r12d,-0x38(%rbp)
+  801494:	ba 00 00 00 00       	mov    $0x0,%edx
+  801499:	44 89 e6             	mov    %r12d,%esi
+  80149c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80149f:	41 ff d7             	call   *%r15
+  8014a2:	48 89 c3             	mov    %rax,%rbx
+        if (!pcid)
+  8014a5:	48 85 c0             	test   %rax,%rax
+  8014a8:	74 dc                	je     801486 <pci_check_busses+0x6e>
+    pcid->parent = parent;
+  8014aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8014ae:	48 89 03             	mov    %rax,(%rbx)
+    pcid->next = pci_device_list;
+  8014b1:	49 8b 06             	mov    (%r14),%rax
+  8014b4:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    pci_device_list = pcid;
+  8014b8:	49 89 1e             	mov    %rbx,(%r14)
+        if (pcid->header_type & PCI_HEADER_TYPE_MULTIFUNC) {
+  8014bb:	80 7b 20 00          	cmpb   $0x0,0x20(%rbx)
+  8014bf:	78 8f                	js     801450 <pci_check_busses+0x38>
+        if (pcid->class == PCI_CLASS_BRIDGE && pcid->subclass == PCI_SUBCLASS_BRIDGE_PCI) {
+  8014c1:	8b 43 1c             	mov    0x1c(%rbx),%eax
+  8014c4:	25 00 ff ff 00       	and    $0xffff00,%eax
+  8014c9:	3d 00 06 04 00       	cmp    $0x40600,%eax
+  8014ce:	75 b6                	jne    801486 <pci_check_busses+0x6e>
+            uint16_t baread2 = pcie_io.read16(pcid, PCI_REG_BAR2);
+  8014d0:	be 18 00 00 00       	mov    $0x18,%esi
+  8014d5:	48 89 df             	mov    %rbx,%rdi
+  8014d8:	48 a1 e8 81 80 00 00 	movabs 0x8081e8,%rax
+  8014df:	00 00 00 
+  8014e2:	ff d0                	call   *%rax
+            uint16_t secondary_bus = (baread2 & ~0x00FF) >> 8;
+  8014e4:	0f b7 f8             	movzwl %ax,%edi
+  8014e7:	c1 ff 08             	sar    $0x8,%edi
+            pci_check_busses(secondary_bus, pcid);
+  8014ea:	48 89 de             	mov    %rbx,%rsi
+  8014ed:	48 b8 18 14 80 00 00 	movabs $0x801418,%rax
+  8014f4:	00 00 00 
+  8014f7:	ff d0                	call   *%rax
+  8014f9:	eb 8b                	jmp    801486 <pci_check_busses+0x6e>
+}
+  8014fb:	48 83 c4 18          	add    $0x18,%rsp
+  8014ff:	5b                   	pop    %rbx
+  801500:	41 5c                	pop    %r12
+  801502:	41 5d                	pop    %r13
+  801504:	41 5e                	pop    %r14
+  801506:	41 5f                	pop    %r15
+  801508:	5d                   	pop    %rbp
+  801509:	c3                   	ret
+
+000000000080150a <find_pci_dev>:
+    for (int i = 0; i != PCI_MAX_DEVICES; i++) {
+  80150a:	48 b8 3d 82 80 00 00 	movabs $0x80823d,%rax
+  801511:	00 00 00 
+  801514:	ba 00 00 00 00       	mov    $0x0,%edx
+  801519:	eb 0c                	jmp    801527 <find_pci_dev+0x1d>
+  80151b:	83 c2 01             	add    $0x1,%edx
+  80151e:	48 83 c0 58          	add    $0x58,%rax
+  801522:	83 fa 0a             	cmp    $0xa,%edx
+  801525:	74 29                	je     801550 <find_pci_dev+0x46>
+        if (pci_device_buffer[i].class == class &&
+  801527:	0f b6 08             	movzbl (%rax),%ecx
+  80152a:	39 f9                	cmp    %edi,%ecx
+  80152c:	75 ed                	jne    80151b <find_pci_dev+0x11>
+            pci_device_buffer[i].subclass == sub) {
+  80152e:	0f b6 48 01          	movzbl 0x1(%rax),%ecx
+        if (pci_device_buffer[i].class == class &&
+  801532:	39 f1                	cmp    %esi,%ecx
+  801534:	75 e5                	jne    80151b <find_pci_dev+0x11>
+            return &pci_device_buffer[i];
+  801536:	48 63 d2             	movslq %edx,%rdx
+  801539:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  80153d:	48 8d 14 42          	lea    (%rdx,%rax,2),%rdx
+  801541:	48 b8 20 82 80 00 00 	movabs $0x808220,%rax
+  801548:	00 00 00 
+  80154b:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+  80154f:	c3                   	ret
+    return 0;
+  801550:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801555:	c3                   	ret
+
+0000000000801556 <get_bar_size>:
+get_bar_size(struct PciDevice *pcid, uint32_t barno) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	41 57                	push   %r15
+  80155c:	41 56                	push   %r14
+  80155e:	41 55                	push   %r13
+  801560:	41 54                	push   %r12
+  801562:	53                   	push   %rbx
+  801563:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  801567:	48 85 ff             	test   %rdi,%rdi
+  80156a:	74 5e                	je     8015ca <get_bar_size+0x74>
+  80156c:	49 89 fc             	mov    %rdi,%r12
+  80156f:	83 fe 05             	cmp    $0x5,%esi
+  801572:	77 56                	ja     8015ca <get_bar_size+0x74>
+    uint32_t tmp = pcid->bars[barno].base_address;
+  801574:	89 f0                	mov    %esi,%eax
+  801576:	44 8b 6c c7 28       	mov    0x28(%rdi,%rax,8),%r13d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, 0xFFFFFFFF);
+  80157b:	8d 34 b5 10 00 00 00 	lea    0x10(,%rsi,4),%esi
+  801582:	40 0f b6 de          	movzbl %sil,%ebx
+  801586:	49 bf e0 81 80 00 00 	movabs $0x8081e0,%r15
+  80158d:	00 00 00 
+  801590:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801595:	89 de                	mov    %ebx,%esi
+  801597:	41 ff 57 18          	call   *0x18(%r15)
+    uint32_t outv = pcie_io.read32(pcid, PCI_REG_BAR0 + 4 * barno) & PCI_BAR_MEMORY_MASK;
+  80159b:	89 de                	mov    %ebx,%esi
+  80159d:	4c 89 e7             	mov    %r12,%rdi
+  8015a0:	41 ff 17             	call   *(%r15)
+  8015a3:	83 e0 f0             	and    $0xfffffff0,%eax
+  8015a6:	41 89 c6             	mov    %eax,%r14d
+    uint32_t size = ~outv + 1;
+  8015a9:	41 f7 de             	neg    %r14d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, tmp);
+  8015ac:	44 89 ea             	mov    %r13d,%edx
+  8015af:	89 de                	mov    %ebx,%esi
+  8015b1:	4c 89 e7             	mov    %r12,%rdi
+  8015b4:	41 ff 57 18          	call   *0x18(%r15)
+}
+  8015b8:	44 89 f0             	mov    %r14d,%eax
+  8015bb:	48 83 c4 08          	add    $0x8,%rsp
+  8015bf:	5b                   	pop    %rbx
+  8015c0:	41 5c                	pop    %r12
+  8015c2:	41 5d                	pop    %r13
+  8015c4:	41 5e                	pop    %r14
+  8015c6:	41 5f                	pop    %r15
+  8015c8:	5d                   	pop    %rbp
+  8015c9:	c3                   	ret
+        return 0;
+  8015ca:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8015d0:	eb e6                	jmp    8015b8 <get_bar_size+0x62>
+
+00000000008015d2 <get_bar_address>:
+get_bar_address(struct PciDevice *pcid, uint32_t barno) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  8015db:	48 85 ff             	test   %rdi,%rdi
+  8015de:	74 28                	je     801608 <get_bar_address+0x36>
+  8015e0:	83 fe 05             	cmp    $0x5,%esi
+  8015e3:	77 23                	ja     801608 <get_bar_address+0x36>
+    uintptr_t base_addr = pcid->bars[0].base_address;
+  8015e5:	8b 5f 28             	mov    0x28(%rdi),%ebx
+    if (pcid->bars[0].address_is_64bits)
+  8015e8:	f6 47 24 02          	testb  $0x2,0x24(%rdi)
+  8015ec:	74 1f                	je     80160d <get_bar_address+0x3b>
+        base_addr |= (uint64_t)(pcie_io.read32(pcid, PCI_REG_BAR0 + 4)) << 32;
+  8015ee:	be 14 00 00 00       	mov    $0x14,%esi
+  8015f3:	48 a1 e0 81 80 00 00 	movabs 0x8081e0,%rax
+  8015fa:	00 00 00 
+  8015fd:	ff d0                	call   *%rax
+  8015ff:	48 c1 e0 20          	shl    $0x20,%rax
+  801603:	48 09 c3             	or     %rax,%rbx
+  801606:	eb 05                	jmp    80160d <get_bar_address+0x3b>
+        return 0;
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80160d:	48 89 d8             	mov    %rbx,%rax
+  801610:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+
+0000000000801616 <parse_argv>:
+invalid:
+    panic("Invalid ecam= format");
+}
+
+void
+parse_argv(char **argv) {
+  801616:	55                   	push   %rbp
+  801617:	48 89 e5             	mov    %rsp,%rbp
+  80161a:	41 57                	push   %r15
+  80161c:	41 56                	push   %r14
+  80161e:	41 55                	push   %r13
+  801620:	41 54                	push   %r12
+  801622:	53                   	push   %rbx
+  801623:	48 83 ec 38          	sub    $0x38,%rsp
+    ecam_base_addr = (volatile uint8_t *)ECAM_VADDR;
+  801627:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  80162e:	00 00 00 
+  801631:	48 a3 10 82 80 00 00 	movabs %rax,0x808210
+  801638:	00 00 00 
+     *   ecam=<base address>:<segment group>:<start bus>:<end bus>
+     * with all values being hex numbers. So we need to parse them
+     * and map physical memory regions accordingly.
+     */
+
+    if (argv)
+  80163b:	48 85 ff             	test   %rdi,%rdi
+  80163e:	0f 84 78 02 00 00    	je     8018bc <parse_argv+0x2a6>
+        for (argv++; *argv; argv++) {
+  801644:	48 8d 5f 08          	lea    0x8(%rdi),%rbx
+  801648:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80164c:	48 85 ff             	test   %rdi,%rdi
+  80164f:	0f 84 67 02 00 00    	je     8018bc <parse_argv+0x2a6>
+    char *vaddr = (char *)ecam_base_addr;
+  801655:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+            if (!strncmp(*argv, "ecam=", 5)) {
+  801659:	49 bf 0d 26 80 00 00 	movabs $0x80260d,%r15
+  801660:	00 00 00 
+  801663:	e9 84 00 00 00       	jmp    8016ec <parse_argv+0xd6>
+    panic("Invalid ecam= format");
+  801668:	48 ba 8e 60 80 00 00 	movabs $0x80608e,%rdx
+  80166f:	00 00 00 
+  801672:	be aa 01 00 00       	mov    $0x1aa,%esi
+  801677:	48 bf a3 60 80 00 00 	movabs $0x8060a3,%rdi
+  80167e:	00 00 00 
+  801681:	b8 00 00 00 00       	mov    $0x0,%eax
+  801686:	48 b9 7e 1a 80 00 00 	movabs $0x801a7e,%rcx
+  80168d:	00 00 00 
+  801690:	ff d1                	call   *%rcx
+
+                int my_envid = sys_getenvid();
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+                int r = sys_map_physical_region(ecam->paddr, my_envid , ecam->vaddr, size, PROT_RW | PROT_CD);
+                if (r < 0)
+                    panic("sys_map_physical_region(): %i", r);
+  801692:	89 c1                	mov    %eax,%ecx
+  801694:	48 ba ac 60 80 00 00 	movabs $0x8060ac,%rdx
+  80169b:	00 00 00 
+  80169e:	be c8 01 00 00       	mov    $0x1c8,%esi
+  8016a3:	48 bf a3 60 80 00 00 	movabs $0x8060a3,%rdi
+  8016aa:	00 00 00 
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b2:	49 b8 7e 1a 80 00 00 	movabs $0x801a7e,%r8
+  8016b9:	00 00 00 
+  8016bc:	41 ff d0             	call   *%r8
+
+                vaddr += size;
+            } else if (!strncmp(*argv, "tscfreq=", 8)) {
+  8016bf:	48 8b 3b             	mov    (%rbx),%rdi
+  8016c2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8016c7:	48 be ca 60 80 00 00 	movabs $0x8060ca,%rsi
+  8016ce:	00 00 00 
+  8016d1:	41 ff d7             	call   *%r15
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	0f 84 a1 01 00 00    	je     80187d <parse_argv+0x267>
+        for (argv++; *argv; argv++) {
+  8016dc:	48 83 c3 08          	add    $0x8,%rbx
+  8016e0:	48 8b 3b             	mov    (%rbx),%rdi
+  8016e3:	48 85 ff             	test   %rdi,%rdi
+  8016e6:	0f 84 d0 01 00 00    	je     8018bc <parse_argv+0x2a6>
+            if (!strncmp(*argv, "ecam=", 5)) {
+  8016ec:	ba 05 00 00 00       	mov    $0x5,%edx
+  8016f1:	48 be 88 60 80 00 00 	movabs $0x806088,%rsi
+  8016f8:	00 00 00 
+  8016fb:	41 ff d7             	call   *%r15
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	75 bd                	jne    8016bf <parse_argv+0xa9>
+                segments[segment_count++] = parse_ecam(*argv);
+  801702:	4c 8b 2b             	mov    (%rbx),%r13
+  801705:	48 b8 48 80 80 00 00 	movabs $0x808048,%rax
+  80170c:	00 00 00 
+  80170f:	4c 8b 20             	mov    (%rax),%r12
+  801712:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801717:	48 89 10             	mov    %rdx,(%rax)
+    str += strlen("ecam=");
+  80171a:	48 bf 88 60 80 00 00 	movabs $0x806088,%rdi
+  801721:	00 00 00 
+  801724:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  80172b:	00 00 00 
+  80172e:	ff d0                	call   *%rax
+  801730:	49 01 c5             	add    %rax,%r13
+  801733:	4c 89 6d c8          	mov    %r13,-0x38(%rbp)
+    seg.paddr = parse_hex(&str);
+  801737:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80173b:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  801742:	00 00 00 
+  801745:	ff d0                	call   *%rax
+  801747:	49 89 c6             	mov    %rax,%r14
+    if (*str++ != ':')
+  80174a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801752:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801756:	80 38 3a             	cmpb   $0x3a,(%rax)
+  801759:	0f 85 09 ff ff ff    	jne    801668 <parse_argv+0x52>
+    seg.segment = parse_hex(&str);
+  80175f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  801763:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  80176a:	00 00 00 
+  80176d:	ff d0                	call   *%rax
+  80176f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (*str++ != ':')
+  801773:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801777:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80177b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80177f:	80 38 3a             	cmpb   $0x3a,(%rax)
+  801782:	0f 85 e0 fe ff ff    	jne    801668 <parse_argv+0x52>
+    seg.start_bus = parse_hex(&str);
+  801788:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80178c:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  801793:	00 00 00 
+  801796:	ff d0                	call   *%rax
+  801798:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (*str++ != ':')
+  80179c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017a8:	80 38 3a             	cmpb   $0x3a,(%rax)
+  8017ab:	0f 85 b7 fe ff ff    	jne    801668 <parse_argv+0x52>
+    seg.end_bus = parse_hex(&str);
+  8017b1:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8017b5:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  8017bc:	00 00 00 
+  8017bf:	ff d0                	call   *%rax
+  8017c1:	48 89 c1             	mov    %rax,%rcx
+                segments[segment_count++] = parse_ecam(*argv);
+  8017c4:	49 bd 60 80 80 00 00 	movabs $0x808060,%r13
+  8017cb:	00 00 00 
+  8017ce:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+  8017d2:	4a 8d 14 20          	lea    (%rax,%r12,1),%rdx
+  8017d6:	49 8d 54 d5 00       	lea    0x0(%r13,%rdx,8),%rdx
+  8017db:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+  8017e2:	4c 89 72 08          	mov    %r14,0x8(%rdx)
+  8017e6:	0f b7 75 b0          	movzwl -0x50(%rbp),%esi
+  8017ea:	66 89 72 10          	mov    %si,0x10(%rdx)
+  8017ee:	0f b6 75 a8          	movzbl -0x58(%rbp),%esi
+  8017f2:	40 88 72 12          	mov    %sil,0x12(%rdx)
+  8017f6:	4c 01 e0             	add    %r12,%rax
+    seg.end_bus = parse_hex(&str);
+  8017f9:	41 88 4c c5 13       	mov    %cl,0x13(%r13,%rax,8)
+                struct ECAMSegment *ecam = &segments[segment_count - 1];
+  8017fe:	48 a1 48 80 80 00 00 	movabs 0x808048,%rax
+  801805:	00 00 00 
+  801808:	4c 8d 60 ff          	lea    -0x1(%rax),%r12
+                ecam->vaddr = vaddr;
+  80180c:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+  801810:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  801814:	4c 01 e0             	add    %r12,%rax
+  801817:	4d 8d 74 c5 00       	lea    0x0(%r13,%rax,8),%r14
+  80181c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801820:	49 89 0e             	mov    %rcx,(%r14)
+                int my_envid = sys_getenvid();
+  801823:	48 b8 e6 2b 80 00 00 	movabs $0x802be6,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	89 c6                	mov    %eax,%esi
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+  801831:	41 0f b6 46 13       	movzbl 0x13(%r14),%eax
+  801836:	41 0f b6 56 12       	movzbl 0x12(%r14),%edx
+  80183b:	29 d0                	sub    %edx,%eax
+  80183d:	c1 e0 14             	shl    $0x14,%eax
+  801840:	48 63 c8             	movslq %eax,%rcx
+  801843:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+                int r = sys_map_physical_region(ecam->paddr, my_envid , ecam->vaddr, size, PROT_RW | PROT_CD);
+  801847:	49 8b 16             	mov    (%r14),%rdx
+  80184a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80184e:	4c 01 e0             	add    %r12,%rax
+  801851:	49 8b 7c c5 08       	mov    0x8(%r13,%rax,8),%rdi
+  801856:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  80185c:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  801863:	00 00 00 
+  801866:	ff d0                	call   *%rax
+                if (r < 0)
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	0f 88 22 fe ff ff    	js     801692 <parse_argv+0x7c>
+                vaddr += size;
+  801870:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  801874:	48 01 4d b8          	add    %rcx,-0x48(%rbp)
+  801878:	e9 5f fe ff ff       	jmp    8016dc <parse_argv+0xc6>
+                char *str = *argv;
+  80187d:	4c 8b 23             	mov    (%rbx),%r12
+                str += strlen("tscfreq=");
+  801880:	48 bf ca 60 80 00 00 	movabs $0x8060ca,%rdi
+  801887:	00 00 00 
+  80188a:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+  801896:	49 01 c4             	add    %rax,%r12
+  801899:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+                tsc_freq = parse_hex(&str);
+  80189d:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8018a1:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+  8018ad:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  8018b4:	00 00 00 
+                DEBUG("tsc_freq=%ld\n", tsc_freq);
+  8018b7:	e9 20 fe ff ff       	jmp    8016dc <parse_argv+0xc6>
+            }
+        }
+
+    if (segment_count == 0)
+  8018bc:	48 b8 48 80 80 00 00 	movabs $0x808048,%rax
+  8018c3:	00 00 00 
+  8018c6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8018ca:	49 b9 4e 0d 80 00 00 	movabs $0x800d4e,%r9
+  8018d1:	00 00 00 
+  8018d4:	48 ba 4e 0f 80 00 00 	movabs $0x800f4e,%rdx
+  8018db:	00 00 00 
+  8018de:	4c 0f 45 ca          	cmovne %rdx,%r9
+  8018e2:	49 b8 8f 0f 80 00 00 	movabs $0x800f8f,%r8
+  8018e9:	00 00 00 
+  8018ec:	48 ba b8 0d 80 00 00 	movabs $0x800db8,%rdx
+  8018f3:	00 00 00 
+  8018f6:	4c 0f 45 c2          	cmovne %rdx,%r8
+  8018fa:	48 bf ce 0f 80 00 00 	movabs $0x800fce,%rdi
+  801901:	00 00 00 
+  801904:	48 ba 39 0e 80 00 00 	movabs $0x800e39,%rdx
+  80190b:	00 00 00 
+  80190e:	48 0f 45 fa          	cmovne %rdx,%rdi
+  801912:	48 be 81 0d 80 00 00 	movabs $0x800d81,%rsi
+  801919:	00 00 00 
+  80191c:	48 ba bf 0e 80 00 00 	movabs $0x800ebf,%rdx
+  801923:	00 00 00 
+  801926:	48 0f 45 f2          	cmovne %rdx,%rsi
+  80192a:	48 b9 77 10 80 00 00 	movabs $0x801077,%rcx
+  801931:	00 00 00 
+  801934:	48 ba 06 0f 80 00 00 	movabs $0x800f06,%rdx
+  80193b:	00 00 00 
+  80193e:	48 0f 45 ca          	cmovne %rdx,%rcx
+  801942:	48 ba 0d 10 80 00 00 	movabs $0x80100d,%rdx
+  801949:	00 00 00 
+  80194c:	48 b8 79 0e 80 00 00 	movabs $0x800e79,%rax
+  801953:	00 00 00 
+  801956:	48 0f 45 d0          	cmovne %rax,%rdx
+        pcie_io.read32 = pci_iop_read_dword;
+  80195a:	48 b8 e0 81 80 00 00 	movabs $0x8081e0,%rax
+  801961:	00 00 00 
+  801964:	4c 89 08             	mov    %r9,(%rax)
+        pcie_io.read16 = pci_iop_read_word;
+  801967:	4c 89 40 08          	mov    %r8,0x8(%rax)
+        pcie_io.read8 = pci_iop_read_byte;
+  80196b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        pcie_io.write32 = pci_iop_write_dword;
+  80196f:	48 89 70 18          	mov    %rsi,0x18(%rax)
+        pcie_io.write16 = pci_iop_write_word;
+  801973:	48 89 48 20          	mov    %rcx,0x20(%rax)
+        pcie_io.write8 = pci_iop_write_byte;
+  801977:	48 89 50 28          	mov    %rdx,0x28(%rax)
+        pci_set_iomech(PCIE_IOPL);
+    else
+        pci_set_iomech(PCIE_ECAM);
+}
+  80197b:	48 83 c4 38          	add    $0x38,%rsp
+  80197f:	5b                   	pop    %rbx
+  801980:	41 5c                	pop    %r12
+  801982:	41 5d                	pop    %r13
+  801984:	41 5e                	pop    %r14
+  801986:	41 5f                	pop    %r15
+  801988:	5d                   	pop    %rbp
+  801989:	c3                   	ret
+
+000000000080198a <pci_init>:
+
+/*
+ * Initialize PCI bus.
+ */
+void
+pci_init(char **argv) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+    parse_argv(argv);
+  80198e:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+
+    init_class_descriptions();
+
+    /* Scan all busses starting at bus 0. */
+    pci_check_busses(0, NULL);
+  80199a:	be 00 00 00 00       	mov    $0x0,%esi
+  80199f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a4:	48 b8 18 14 80 00 00 	movabs $0x801418,%rax
+  8019ab:	00 00 00 
+  8019ae:	ff d0                	call   *%rax
+}
+  8019b0:	5d                   	pop    %rbp
+  8019b1:	c3                   	ret
+
+00000000008019b2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8019b2:	55                   	push   %rbp
+  8019b3:	48 89 e5             	mov    %rsp,%rbp
+  8019b6:	41 56                	push   %r14
+  8019b8:	41 55                	push   %r13
+  8019ba:	41 54                	push   %r12
+  8019bc:	53                   	push   %rbx
+  8019bd:	41 89 fd             	mov    %edi,%r13d
+  8019c0:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8019c3:	48 ba 58 71 80 00 00 	movabs $0x807158,%rdx
+  8019ca:	00 00 00 
+  8019cd:	48 b8 58 71 80 00 00 	movabs $0x807158,%rax
+  8019d4:	00 00 00 
+  8019d7:	48 39 c2             	cmp    %rax,%rdx
+  8019da:	73 17                	jae    8019f3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8019dc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8019df:	49 89 c4             	mov    %rax,%r12
+  8019e2:	48 83 c3 08          	add    $0x8,%rbx
+  8019e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019eb:	ff 53 f8             	call   *-0x8(%rbx)
+  8019ee:	4c 39 e3             	cmp    %r12,%rbx
+  8019f1:	72 ef                	jb     8019e2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8019f3:	48 b8 e6 2b 80 00 00 	movabs $0x802be6,%rax
+  8019fa:	00 00 00 
+  8019fd:	ff d0                	call   *%rax
+  8019ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a04:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801a0b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a12:	00 00 00 
+  801a15:	48 01 d0             	add    %rdx,%rax
+  801a18:	48 a3 98 85 80 00 00 	movabs %rax,0x808598
+  801a1f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801a22:	45 85 ed             	test   %r13d,%r13d
+  801a25:	7e 0d                	jle    801a34 <libmain+0x82>
+  801a27:	49 8b 06             	mov    (%r14),%rax
+  801a2a:	48 a3 70 70 80 00 00 	movabs %rax,0x807070
+  801a31:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801a34:	4c 89 f6             	mov    %r14,%rsi
+  801a37:	44 89 ef             	mov    %r13d,%edi
+  801a3a:	48 b8 73 06 80 00 00 	movabs $0x800673,%rax
+  801a41:	00 00 00 
+  801a44:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801a46:	48 b8 5b 1a 80 00 00 	movabs $0x801a5b,%rax
+  801a4d:	00 00 00 
+  801a50:	ff d0                	call   *%rax
+#endif
+}
+  801a52:	5b                   	pop    %rbx
+  801a53:	41 5c                	pop    %r12
+  801a55:	41 5d                	pop    %r13
+  801a57:	41 5e                	pop    %r14
+  801a59:	5d                   	pop    %rbp
+  801a5a:	c3                   	ret
+
+0000000000801a5b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801a5b:	55                   	push   %rbp
+  801a5c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  801a5f:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  801a66:	00 00 00 
+  801a69:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a70:	48 b8 7b 2b 80 00 00 	movabs $0x802b7b,%rax
+  801a77:	00 00 00 
+  801a7a:	ff d0                	call   *%rax
+}
+  801a7c:	5d                   	pop    %rbp
+  801a7d:	c3                   	ret
+
+0000000000801a7e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801a7e:	55                   	push   %rbp
+  801a7f:	48 89 e5             	mov    %rsp,%rbp
+  801a82:	41 56                	push   %r14
+  801a84:	41 55                	push   %r13
+  801a86:	41 54                	push   %r12
+  801a88:	53                   	push   %rbx
+  801a89:	48 83 ec 50          	sub    $0x50,%rsp
+  801a8d:	49 89 fc             	mov    %rdi,%r12
+  801a90:	41 89 f5             	mov    %esi,%r13d
+  801a93:	48 89 d3             	mov    %rdx,%rbx
+  801a96:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a9a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801a9e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801aa2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801aa9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801aad:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801ab1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801ab5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801ab9:	48 b8 70 70 80 00 00 	movabs $0x807070,%rax
+  801ac0:	00 00 00 
+  801ac3:	4c 8b 30             	mov    (%rax),%r14
+  801ac6:	48 b8 e6 2b 80 00 00 	movabs $0x802be6,%rax
+  801acd:	00 00 00 
+  801ad0:	ff d0                	call   *%rax
+  801ad2:	89 c6                	mov    %eax,%esi
+  801ad4:	45 89 e8             	mov    %r13d,%r8d
+  801ad7:	4c 89 e1             	mov    %r12,%rcx
+  801ada:	4c 89 f2             	mov    %r14,%rdx
+  801add:	48 bf e0 60 80 00 00 	movabs $0x8060e0,%rdi
+  801ae4:	00 00 00 
+  801ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aec:	49 bc ce 1b 80 00 00 	movabs $0x801bce,%r12
+  801af3:	00 00 00 
+  801af6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801af9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801afd:	48 89 df             	mov    %rbx,%rdi
+  801b00:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801b0c:	48 bf 61 60 80 00 00 	movabs $0x806061,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801b1e:	cc                   	int3
+  801b1f:	eb fd                	jmp    801b1e <_panic+0xa0>
+
+0000000000801b21 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801b21:	55                   	push   %rbp
+  801b22:	48 89 e5             	mov    %rsp,%rbp
+  801b25:	53                   	push   %rbx
+  801b26:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801b2d:	8b 06                	mov    (%rsi),%eax
+  801b2f:	8d 50 01             	lea    0x1(%rax),%edx
+  801b32:	89 16                	mov    %edx,(%rsi)
+  801b34:	48 98                	cltq
+  801b36:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801b3b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801b41:	74 0a                	je     801b4d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801b43:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801b47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b4b:	c9                   	leave
+  801b4c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801b4d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801b51:	be ff 00 00 00       	mov    $0xff,%esi
+  801b56:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+        state->offset = 0;
+  801b62:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801b68:	eb d9                	jmp    801b43 <putch+0x22>
+
+0000000000801b6a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801b6a:	55                   	push   %rbp
+  801b6b:	48 89 e5             	mov    %rsp,%rbp
+  801b6e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801b75:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801b78:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801b7f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801b8c:	48 89 f1             	mov    %rsi,%rcx
+  801b8f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801b96:	48 bf 21 1b 80 00 00 	movabs $0x801b21,%rdi
+  801b9d:	00 00 00 
+  801ba0:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801ba7:	00 00 00 
+  801baa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801bac:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801bb3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801bba:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  801bc1:	00 00 00 
+  801bc4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801bc6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801bcc:	c9                   	leave
+  801bcd:	c3                   	ret
+
+0000000000801bce <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801bce:	55                   	push   %rbp
+  801bcf:	48 89 e5             	mov    %rsp,%rbp
+  801bd2:	48 83 ec 50          	sub    $0x50,%rsp
+  801bd6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801bda:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801bde:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801be2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801be6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801bea:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801bf1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801bfd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801c01:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801c05:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  801c0c:	00 00 00 
+  801c0f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801c11:	c9                   	leave
+  801c12:	c3                   	ret
+
+0000000000801c13 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801c13:	55                   	push   %rbp
+  801c14:	48 89 e5             	mov    %rsp,%rbp
+  801c17:	41 57                	push   %r15
+  801c19:	41 56                	push   %r14
+  801c1b:	41 55                	push   %r13
+  801c1d:	41 54                	push   %r12
+  801c1f:	53                   	push   %rbx
+  801c20:	48 83 ec 18          	sub    $0x18,%rsp
+  801c24:	49 89 fc             	mov    %rdi,%r12
+  801c27:	49 89 f5             	mov    %rsi,%r13
+  801c2a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c2e:	8b 45 10             	mov    0x10(%rbp),%eax
+  801c31:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801c34:	41 89 cf             	mov    %ecx,%r15d
+  801c37:	4c 39 fa             	cmp    %r15,%rdx
+  801c3a:	73 5b                	jae    801c97 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801c3c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801c40:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801c44:	85 db                	test   %ebx,%ebx
+  801c46:	7e 0e                	jle    801c56 <print_num+0x43>
+            putch(padc, put_arg);
+  801c48:	4c 89 ee             	mov    %r13,%rsi
+  801c4b:	44 89 f7             	mov    %r14d,%edi
+  801c4e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801c51:	83 eb 01             	sub    $0x1,%ebx
+  801c54:	75 f2                	jne    801c48 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801c56:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801c5a:	48 b9 14 61 80 00 00 	movabs $0x806114,%rcx
+  801c61:	00 00 00 
+  801c64:	48 b8 03 61 80 00 00 	movabs $0x806103,%rax
+  801c6b:	00 00 00 
+  801c6e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801c72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7b:	49 f7 f7             	div    %r15
+  801c7e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801c82:	4c 89 ee             	mov    %r13,%rsi
+  801c85:	41 ff d4             	call   *%r12
+}
+  801c88:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c8c:	5b                   	pop    %rbx
+  801c8d:	41 5c                	pop    %r12
+  801c8f:	41 5d                	pop    %r13
+  801c91:	41 5e                	pop    %r14
+  801c93:	41 5f                	pop    %r15
+  801c95:	5d                   	pop    %rbp
+  801c96:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801c97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca0:	49 f7 f7             	div    %r15
+  801ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ca7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801cab:	52                   	push   %rdx
+  801cac:	45 0f be c9          	movsbl %r9b,%r9d
+  801cb0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801cb4:	48 89 c2             	mov    %rax,%rdx
+  801cb7:	48 b8 13 1c 80 00 00 	movabs $0x801c13,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	48 83 c4 10          	add    $0x10,%rsp
+  801cc7:	eb 8d                	jmp    801c56 <print_num+0x43>
+
+0000000000801cc9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801cc9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801ccd:	48 8b 06             	mov    (%rsi),%rax
+  801cd0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801cd4:	73 0a                	jae    801ce0 <sprintputch+0x17>
+        *state->start++ = ch;
+  801cd6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cda:	48 89 16             	mov    %rdx,(%rsi)
+  801cdd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801ce0:	c3                   	ret
+
+0000000000801ce1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	48 83 ec 50          	sub    $0x50,%rsp
+  801ce9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ced:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801cf1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801cf5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801cfc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d04:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801d0c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801d10:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+}
+  801d1c:	c9                   	leave
+  801d1d:	c3                   	ret
+
+0000000000801d1e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801d1e:	55                   	push   %rbp
+  801d1f:	48 89 e5             	mov    %rsp,%rbp
+  801d22:	41 57                	push   %r15
+  801d24:	41 56                	push   %r14
+  801d26:	41 55                	push   %r13
+  801d28:	41 54                	push   %r12
+  801d2a:	53                   	push   %rbx
+  801d2b:	48 83 ec 38          	sub    $0x38,%rsp
+  801d2f:	49 89 fe             	mov    %rdi,%r14
+  801d32:	49 89 f5             	mov    %rsi,%r13
+  801d35:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801d38:	48 8b 01             	mov    (%rcx),%rax
+  801d3b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d3f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801d43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d47:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801d4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801d4f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801d53:	0f b6 3b             	movzbl (%rbx),%edi
+  801d56:	40 80 ff 25          	cmp    $0x25,%dil
+  801d5a:	74 18                	je     801d74 <vprintfmt+0x56>
+            if (!ch) return;
+  801d5c:	40 84 ff             	test   %dil,%dil
+  801d5f:	0f 84 04 07 00 00    	je     802469 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  801d65:	40 0f b6 ff          	movzbl %dil,%edi
+  801d69:	4c 89 ee             	mov    %r13,%rsi
+  801d6c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801d6f:	4c 89 e3             	mov    %r12,%rbx
+  801d72:	eb db                	jmp    801d4f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801d74:	be 00 00 00 00       	mov    $0x0,%esi
+  801d79:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801d82:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801d88:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801d8f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801d93:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801d98:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801d9d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801da0:	83 e8 23             	sub    $0x23,%eax
+  801da3:	3c 57                	cmp    $0x57,%al
+  801da5:	0f 87 a4 06 00 00    	ja     80244f <vprintfmt+0x731>
+  801dab:	0f b6 c0             	movzbl %al,%eax
+  801dae:	48 b9 a0 62 80 00 00 	movabs $0x8062a0,%rcx
+  801db5:	00 00 00 
+  801db8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801dbb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801dbe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801dc2:	eb cf                	jmp    801d93 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801dc4:	49 89 dc             	mov    %rbx,%r12
+  801dc7:	be 01 00 00 00       	mov    $0x1,%esi
+  801dcc:	eb c5                	jmp    801d93 <vprintfmt+0x75>
+            padc = ch;
+  801dce:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801dd2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801dd5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801dd8:	eb b9                	jmp    801d93 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801dda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ddd:	83 f8 2f             	cmp    $0x2f,%eax
+  801de0:	77 24                	ja     801e06 <vprintfmt+0xe8>
+  801de2:	89 c1                	mov    %eax,%ecx
+  801de4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801de8:	83 c0 08             	add    $0x8,%eax
+  801deb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dee:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801df1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801df4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801df8:	79 99                	jns    801d93 <vprintfmt+0x75>
+                width = precision;
+  801dfa:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801dfe:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801e04:	eb 8d                	jmp    801d93 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801e06:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e0a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801e0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e12:	eb da                	jmp    801dee <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801e14:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801e19:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e1d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e23:	3c 39                	cmp    $0x39,%al
+  801e25:	77 1c                	ja     801e43 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801e27:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801e2b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801e2f:	0f b6 c0             	movzbl %al,%eax
+  801e32:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e37:	0f b6 03             	movzbl (%rbx),%eax
+  801e3a:	3c 39                	cmp    $0x39,%al
+  801e3c:	76 e9                	jbe    801e27 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801e3e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801e41:	eb b1                	jmp    801df4 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801e43:	49 89 dc             	mov    %rbx,%r12
+  801e46:	eb ac                	jmp    801df4 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801e48:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801e4b:	85 c9                	test   %ecx,%ecx
+  801e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e52:	0f 49 c1             	cmovns %ecx,%eax
+  801e55:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801e58:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e5b:	e9 33 ff ff ff       	jmp    801d93 <vprintfmt+0x75>
+            lflag++;
+  801e60:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801e63:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e66:	e9 28 ff ff ff       	jmp    801d93 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801e6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e6e:	83 f8 2f             	cmp    $0x2f,%eax
+  801e71:	77 19                	ja     801e8c <vprintfmt+0x16e>
+  801e73:	89 c2                	mov    %eax,%edx
+  801e75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e79:	83 c0 08             	add    $0x8,%eax
+  801e7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7f:	8b 3a                	mov    (%rdx),%edi
+  801e81:	4c 89 ee             	mov    %r13,%rsi
+  801e84:	41 ff d6             	call   *%r14
+            break;
+  801e87:	e9 c3 fe ff ff       	jmp    801d4f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801e8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e98:	eb e5                	jmp    801e7f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801e9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9d:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea0:	77 5a                	ja     801efc <vprintfmt+0x1de>
+  801ea2:	89 c2                	mov    %eax,%edx
+  801ea4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea8:	83 c0 08             	add    $0x8,%eax
+  801eab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801eae:	8b 02                	mov    (%rdx),%eax
+  801eb0:	89 c1                	mov    %eax,%ecx
+  801eb2:	f7 d9                	neg    %ecx
+  801eb4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801eb7:	83 f9 13             	cmp    $0x13,%ecx
+  801eba:	7f 4e                	jg     801f0a <vprintfmt+0x1ec>
+  801ebc:	48 63 c1             	movslq %ecx,%rax
+  801ebf:	48 ba 60 65 80 00 00 	movabs $0x806560,%rdx
+  801ec6:	00 00 00 
+  801ec9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ecd:	48 85 c0             	test   %rax,%rax
+  801ed0:	74 38                	je     801f0a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801ed2:	48 89 c1             	mov    %rax,%rcx
+  801ed5:	48 ba b9 67 80 00 00 	movabs $0x8067b9,%rdx
+  801edc:	00 00 00 
+  801edf:	4c 89 ee             	mov    %r13,%rsi
+  801ee2:	4c 89 f7             	mov    %r14,%rdi
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	49 b8 e1 1c 80 00 00 	movabs $0x801ce1,%r8
+  801ef1:	00 00 00 
+  801ef4:	41 ff d0             	call   *%r8
+  801ef7:	e9 53 fe ff ff       	jmp    801d4f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801efc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f08:	eb a4                	jmp    801eae <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801f0a:	48 ba 2c 61 80 00 00 	movabs $0x80612c,%rdx
+  801f11:	00 00 00 
+  801f14:	4c 89 ee             	mov    %r13,%rsi
+  801f17:	4c 89 f7             	mov    %r14,%rdi
+  801f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1f:	49 b8 e1 1c 80 00 00 	movabs $0x801ce1,%r8
+  801f26:	00 00 00 
+  801f29:	41 ff d0             	call   *%r8
+  801f2c:	e9 1e fe ff ff       	jmp    801d4f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801f31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f34:	83 f8 2f             	cmp    $0x2f,%eax
+  801f37:	77 36                	ja     801f6f <vprintfmt+0x251>
+  801f39:	89 c2                	mov    %eax,%edx
+  801f3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3f:	83 c0 08             	add    $0x8,%eax
+  801f42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f45:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801f48:	48 85 f6             	test   %rsi,%rsi
+  801f4b:	48 b8 25 61 80 00 00 	movabs $0x806125,%rax
+  801f52:	00 00 00 
+  801f55:	48 0f 45 c6          	cmovne %rsi,%rax
+  801f59:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801f5d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f61:	7e 06                	jle    801f69 <vprintfmt+0x24b>
+  801f63:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801f67:	75 14                	jne    801f7d <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f69:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801f6d:	eb 5b                	jmp    801fca <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  801f6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7b:	eb c8                	jmp    801f45 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801f7d:	49 63 f7             	movslq %r15d,%rsi
+  801f80:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801f84:	48 b8 23 25 80 00 00 	movabs $0x802523,%rax
+  801f8b:	00 00 00 
+  801f8e:	ff d0                	call   *%rax
+  801f90:	48 89 c2             	mov    %rax,%rdx
+  801f93:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f96:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801f98:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801f9b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	7e c7                	jle    801f69 <vprintfmt+0x24b>
+  801fa2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801fa7:	4c 89 ee             	mov    %r13,%rsi
+  801faa:	44 89 e7             	mov    %r12d,%edi
+  801fad:	41 ff d6             	call   *%r14
+  801fb0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801fb4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801fb7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801fba:	75 eb                	jne    801fa7 <vprintfmt+0x289>
+  801fbc:	eb ab                	jmp    801f69 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801fbe:	0f b6 f8             	movzbl %al,%edi
+  801fc1:	4c 89 ee             	mov    %r13,%rsi
+  801fc4:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  801fc7:	4c 89 e2             	mov    %r12,%rdx
+  801fca:	45 85 ff             	test   %r15d,%r15d
+  801fcd:	78 06                	js     801fd5 <vprintfmt+0x2b7>
+  801fcf:	41 83 ef 01          	sub    $0x1,%r15d
+  801fd3:	78 23                	js     801ff8 <vprintfmt+0x2da>
+  801fd5:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  801fd9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801fdf:	84 c0                	test   %al,%al
+  801fe1:	74 15                	je     801ff8 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801fe3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801fe7:	74 d5                	je     801fbe <vprintfmt+0x2a0>
+  801fe9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801fec:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ff1:	80 fa 5e             	cmp    $0x5e,%dl
+  801ff4:	77 cb                	ja     801fc1 <vprintfmt+0x2a3>
+  801ff6:	eb c6                	jmp    801fbe <vprintfmt+0x2a0>
+  801ff8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ffb:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  801ffe:	01 f0                	add    %esi,%eax
+  802000:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  802002:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802006:	85 c0                	test   %eax,%eax
+  802008:	0f 8e 41 fd ff ff    	jle    801d4f <vprintfmt+0x31>
+  80200e:	4c 89 ee             	mov    %r13,%rsi
+  802011:	bf 20 00 00 00       	mov    $0x20,%edi
+  802016:	41 ff d6             	call   *%r14
+  802019:	41 83 ec 01          	sub    $0x1,%r12d
+  80201d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802021:	75 eb                	jne    80200e <vprintfmt+0x2f0>
+  802023:	e9 27 fd ff ff       	jmp    801d4f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  802028:	40 84 f6             	test   %sil,%sil
+  80202b:	75 26                	jne    802053 <vprintfmt+0x335>
+    switch (lflag) {
+  80202d:	85 d2                	test   %edx,%edx
+  80202f:	74 59                	je     80208a <vprintfmt+0x36c>
+  802031:	83 fa 01             	cmp    $0x1,%edx
+  802034:	74 7b                	je     8020b1 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  802036:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802039:	83 f8 2f             	cmp    $0x2f,%eax
+  80203c:	0f 87 96 00 00 00    	ja     8020d8 <vprintfmt+0x3ba>
+  802042:	89 c2                	mov    %eax,%edx
+  802044:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802048:	83 c0 08             	add    $0x8,%eax
+  80204b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80204e:	4c 8b 22             	mov    (%rdx),%r12
+  802051:	eb 17                	jmp    80206a <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  802053:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802056:	83 f8 2f             	cmp    $0x2f,%eax
+  802059:	77 21                	ja     80207c <vprintfmt+0x35e>
+  80205b:	89 c2                	mov    %eax,%edx
+  80205d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802061:	83 c0 08             	add    $0x8,%eax
+  802064:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802067:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80206a:	4d 85 e4             	test   %r12,%r12
+  80206d:	78 7a                	js     8020e9 <vprintfmt+0x3cb>
+            num = i;
+  80206f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802072:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802077:	e9 b5 02 00 00       	jmp    802331 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80207c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802080:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802084:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802088:	eb dd                	jmp    802067 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80208a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80208d:	83 f8 2f             	cmp    $0x2f,%eax
+  802090:	77 11                	ja     8020a3 <vprintfmt+0x385>
+  802092:	89 c2                	mov    %eax,%edx
+  802094:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802098:	83 c0 08             	add    $0x8,%eax
+  80209b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80209e:	4c 63 22             	movslq (%rdx),%r12
+  8020a1:	eb c7                	jmp    80206a <vprintfmt+0x34c>
+  8020a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020af:	eb ed                	jmp    80209e <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8020b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b7:	77 11                	ja     8020ca <vprintfmt+0x3ac>
+  8020b9:	89 c2                	mov    %eax,%edx
+  8020bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020bf:	83 c0 08             	add    $0x8,%eax
+  8020c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c5:	4c 8b 22             	mov    (%rdx),%r12
+  8020c8:	eb a0                	jmp    80206a <vprintfmt+0x34c>
+  8020ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d6:	eb ed                	jmp    8020c5 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8020d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e4:	e9 65 ff ff ff       	jmp    80204e <vprintfmt+0x330>
+                putch('-', put_arg);
+  8020e9:	4c 89 ee             	mov    %r13,%rsi
+  8020ec:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8020f1:	41 ff d6             	call   *%r14
+                i = -i;
+  8020f4:	49 f7 dc             	neg    %r12
+  8020f7:	e9 73 ff ff ff       	jmp    80206f <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8020fc:	40 84 f6             	test   %sil,%sil
+  8020ff:	75 32                	jne    802133 <vprintfmt+0x415>
+    switch (lflag) {
+  802101:	85 d2                	test   %edx,%edx
+  802103:	74 5d                	je     802162 <vprintfmt+0x444>
+  802105:	83 fa 01             	cmp    $0x1,%edx
+  802108:	0f 84 82 00 00 00    	je     802190 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80210e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802111:	83 f8 2f             	cmp    $0x2f,%eax
+  802114:	0f 87 a5 00 00 00    	ja     8021bf <vprintfmt+0x4a1>
+  80211a:	89 c2                	mov    %eax,%edx
+  80211c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802120:	83 c0 08             	add    $0x8,%eax
+  802123:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802126:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802129:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80212e:	e9 fe 01 00 00       	jmp    802331 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  802133:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802136:	83 f8 2f             	cmp    $0x2f,%eax
+  802139:	77 19                	ja     802154 <vprintfmt+0x436>
+  80213b:	89 c2                	mov    %eax,%edx
+  80213d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802141:	83 c0 08             	add    $0x8,%eax
+  802144:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802147:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80214a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80214f:	e9 dd 01 00 00       	jmp    802331 <vprintfmt+0x613>
+  802154:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802158:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802160:	eb e5                	jmp    802147 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  802162:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802165:	83 f8 2f             	cmp    $0x2f,%eax
+  802168:	77 18                	ja     802182 <vprintfmt+0x464>
+  80216a:	89 c2                	mov    %eax,%edx
+  80216c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802170:	83 c0 08             	add    $0x8,%eax
+  802173:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802176:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802178:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80217d:	e9 af 01 00 00       	jmp    802331 <vprintfmt+0x613>
+  802182:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802186:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80218a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80218e:	eb e6                	jmp    802176 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  802190:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802193:	83 f8 2f             	cmp    $0x2f,%eax
+  802196:	77 19                	ja     8021b1 <vprintfmt+0x493>
+  802198:	89 c2                	mov    %eax,%edx
+  80219a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80219e:	83 c0 08             	add    $0x8,%eax
+  8021a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021a4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8021a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8021ac:	e9 80 01 00 00       	jmp    802331 <vprintfmt+0x613>
+  8021b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021bd:	eb e5                	jmp    8021a4 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8021bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021cb:	e9 56 ff ff ff       	jmp    802126 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d0:	40 84 f6             	test   %sil,%sil
+  8021d3:	75 2e                	jne    802203 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8021d5:	85 d2                	test   %edx,%edx
+  8021d7:	0f 84 b3 00 00 00    	je     802290 <vprintfmt+0x572>
+  8021dd:	83 fa 01             	cmp    $0x1,%edx
+  8021e0:	0f 84 d3 00 00 00    	je     8022b9 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8021e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ec:	0f 87 f1 00 00 00    	ja     8022e3 <vprintfmt+0x5c5>
+  8021f2:	89 c2                	mov    %eax,%edx
+  8021f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f8:	83 c0 08             	add    $0x8,%eax
+  8021fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021fe:	48 8b 02             	mov    (%rdx),%rax
+  802201:	eb 17                	jmp    80221a <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  802203:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802206:	83 f8 2f             	cmp    $0x2f,%eax
+  802209:	77 77                	ja     802282 <vprintfmt+0x564>
+  80220b:	89 c2                	mov    %eax,%edx
+  80220d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802211:	83 c0 08             	add    $0x8,%eax
+  802214:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802217:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  80221a:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80221c:	83 f8 07             	cmp    $0x7,%eax
+  80221f:	0f 8e cf 00 00 00    	jle    8022f4 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  802225:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80222b:	44 89 e7             	mov    %r12d,%edi
+  80222e:	41 c1 e4 03          	shl    $0x3,%r12d
+  802232:	89 d1                	mov    %edx,%ecx
+  802234:	8d 72 07             	lea    0x7(%rdx),%esi
+  802237:	85 d2                	test   %edx,%edx
+  802239:	0f 48 d6             	cmovs  %esi,%edx
+  80223c:	c1 fa 03             	sar    $0x3,%edx
+  80223f:	83 f9 3f             	cmp    $0x3f,%ecx
+  802242:	7f e7                	jg     80222b <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  802244:	85 ff                	test   %edi,%edi
+  802246:	0f 84 03 fb ff ff    	je     801d4f <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80224c:	49 63 f4             	movslq %r12d,%rsi
+  80224f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802254:	48 f7 f6             	div    %rsi
+  802257:	49 89 d7             	mov    %rdx,%r15
+  80225a:	83 c0 30             	add    $0x30,%eax
+  80225d:	0f be f8             	movsbl %al,%edi
+  802260:	4c 89 ee             	mov    %r13,%rsi
+  802263:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  802266:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  802269:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80226e:	45 85 e4             	test   %r12d,%r12d
+  802271:	41 0f 49 d4          	cmovns %r12d,%edx
+  802275:	c1 fa 03             	sar    $0x3,%edx
+  802278:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80227b:	75 cf                	jne    80224c <vprintfmt+0x52e>
+  80227d:	e9 cd fa ff ff       	jmp    801d4f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  802282:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802286:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80228a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228e:	eb 87                	jmp    802217 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  802290:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802293:	83 f8 2f             	cmp    $0x2f,%eax
+  802296:	77 13                	ja     8022ab <vprintfmt+0x58d>
+  802298:	89 c2                	mov    %eax,%edx
+  80229a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80229e:	83 c0 08             	add    $0x8,%eax
+  8022a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022a4:	8b 02                	mov    (%rdx),%eax
+  8022a6:	e9 6f ff ff ff       	jmp    80221a <vprintfmt+0x4fc>
+  8022ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022b7:	eb eb                	jmp    8022a4 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8022b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8022bf:	77 14                	ja     8022d5 <vprintfmt+0x5b7>
+  8022c1:	89 c2                	mov    %eax,%edx
+  8022c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c7:	83 c0 08             	add    $0x8,%eax
+  8022ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022cd:	48 8b 02             	mov    (%rdx),%rax
+  8022d0:	e9 45 ff ff ff       	jmp    80221a <vprintfmt+0x4fc>
+  8022d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e1:	eb ea                	jmp    8022cd <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8022e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022ef:	e9 0a ff ff ff       	jmp    8021fe <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8022f4:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8022fa:	e9 4d ff ff ff       	jmp    80224c <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8022ff:	4c 89 ee             	mov    %r13,%rsi
+  802302:	bf 30 00 00 00       	mov    $0x30,%edi
+  802307:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80230a:	4c 89 ee             	mov    %r13,%rsi
+  80230d:	bf 78 00 00 00       	mov    $0x78,%edi
+  802312:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802315:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802318:	83 f8 2f             	cmp    $0x2f,%eax
+  80231b:	77 47                	ja     802364 <vprintfmt+0x646>
+  80231d:	89 c2                	mov    %eax,%edx
+  80231f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802323:	83 c0 08             	add    $0x8,%eax
+  802326:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802329:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80232c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802331:	48 83 ec 08          	sub    $0x8,%rsp
+  802335:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802339:	0f 94 c0             	sete   %al
+  80233c:	0f b6 c0             	movzbl %al,%eax
+  80233f:	50                   	push   %rax
+  802340:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802345:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802349:	4c 89 ee             	mov    %r13,%rsi
+  80234c:	4c 89 f7             	mov    %r14,%rdi
+  80234f:	48 b8 13 1c 80 00 00 	movabs $0x801c13,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+            break;
+  80235b:	48 83 c4 10          	add    $0x10,%rsp
+  80235f:	e9 eb f9 ff ff       	jmp    801d4f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802364:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802368:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80236c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802370:	eb b7                	jmp    802329 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  802372:	40 84 f6             	test   %sil,%sil
+  802375:	75 2b                	jne    8023a2 <vprintfmt+0x684>
+    switch (lflag) {
+  802377:	85 d2                	test   %edx,%edx
+  802379:	74 56                	je     8023d1 <vprintfmt+0x6b3>
+  80237b:	83 fa 01             	cmp    $0x1,%edx
+  80237e:	74 7f                	je     8023ff <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  802380:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802383:	83 f8 2f             	cmp    $0x2f,%eax
+  802386:	0f 87 a2 00 00 00    	ja     80242e <vprintfmt+0x710>
+  80238c:	89 c2                	mov    %eax,%edx
+  80238e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802392:	83 c0 08             	add    $0x8,%eax
+  802395:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802398:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80239b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023a0:	eb 8f                	jmp    802331 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8023a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a8:	77 19                	ja     8023c3 <vprintfmt+0x6a5>
+  8023aa:	89 c2                	mov    %eax,%edx
+  8023ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b0:	83 c0 08             	add    $0x8,%eax
+  8023b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8023b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023be:	e9 6e ff ff ff       	jmp    802331 <vprintfmt+0x613>
+  8023c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023cf:	eb e5                	jmp    8023b6 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8023d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d7:	77 18                	ja     8023f1 <vprintfmt+0x6d3>
+  8023d9:	89 c2                	mov    %eax,%edx
+  8023db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023df:	83 c0 08             	add    $0x8,%eax
+  8023e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e5:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8023e7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8023ec:	e9 40 ff ff ff       	jmp    802331 <vprintfmt+0x613>
+  8023f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fd:	eb e6                	jmp    8023e5 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8023ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802402:	83 f8 2f             	cmp    $0x2f,%eax
+  802405:	77 19                	ja     802420 <vprintfmt+0x702>
+  802407:	89 c2                	mov    %eax,%edx
+  802409:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240d:	83 c0 08             	add    $0x8,%eax
+  802410:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802413:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802416:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80241b:	e9 11 ff ff ff       	jmp    802331 <vprintfmt+0x613>
+  802420:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802424:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802428:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80242c:	eb e5                	jmp    802413 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  80242e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802432:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802436:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80243a:	e9 59 ff ff ff       	jmp    802398 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  80243f:	4c 89 ee             	mov    %r13,%rsi
+  802442:	bf 25 00 00 00       	mov    $0x25,%edi
+  802447:	41 ff d6             	call   *%r14
+            break;
+  80244a:	e9 00 f9 ff ff       	jmp    801d4f <vprintfmt+0x31>
+            putch('%', put_arg);
+  80244f:	4c 89 ee             	mov    %r13,%rsi
+  802452:	bf 25 00 00 00       	mov    $0x25,%edi
+  802457:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80245a:	48 83 eb 01          	sub    $0x1,%rbx
+  80245e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802462:	75 f6                	jne    80245a <vprintfmt+0x73c>
+  802464:	e9 e6 f8 ff ff       	jmp    801d4f <vprintfmt+0x31>
+}
+  802469:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80246d:	5b                   	pop    %rbx
+  80246e:	41 5c                	pop    %r12
+  802470:	41 5d                	pop    %r13
+  802472:	41 5e                	pop    %r14
+  802474:	41 5f                	pop    %r15
+  802476:	5d                   	pop    %rbp
+  802477:	c3                   	ret
+
+0000000000802478 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802480:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802484:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802489:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80248d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802494:	48 85 ff             	test   %rdi,%rdi
+  802497:	74 2b                	je     8024c4 <vsnprintf+0x4c>
+  802499:	48 85 f6             	test   %rsi,%rsi
+  80249c:	74 26                	je     8024c4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80249e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024a2:	48 bf c9 1c 80 00 00 	movabs $0x801cc9,%rdi
+  8024a9:	00 00 00 
+  8024ac:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8024b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024bc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8024bf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8024c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024c9:	eb f7                	jmp    8024c2 <vsnprintf+0x4a>
+
+00000000008024cb <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8024cb:	55                   	push   %rbp
+  8024cc:	48 89 e5             	mov    %rsp,%rbp
+  8024cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8024d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024d7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8024db:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8024df:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8024e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8024ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024ee:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8024f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8024f6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8024fa:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802506:	c9                   	leave
+  802507:	c3                   	ret
+
+0000000000802508 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802508:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80250b:	74 10                	je     80251d <strlen+0x15>
+    size_t n = 0;
+  80250d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802512:	48 83 c0 01          	add    $0x1,%rax
+  802516:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80251a:	75 f6                	jne    802512 <strlen+0xa>
+  80251c:	c3                   	ret
+    size_t n = 0;
+  80251d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802522:	c3                   	ret
+
+0000000000802523 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802523:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802526:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80252b:	48 85 f6             	test   %rsi,%rsi
+  80252e:	74 11                	je     802541 <strnlen+0x1e>
+  802530:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802534:	74 0c                	je     802542 <strnlen+0x1f>
+  802536:	48 83 c2 01          	add    $0x1,%rdx
+  80253a:	48 39 d0             	cmp    %rdx,%rax
+  80253d:	75 f1                	jne    802530 <strnlen+0xd>
+  80253f:	eb 04                	jmp    802545 <strnlen+0x22>
+  802541:	c3                   	ret
+  802542:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802545:	c3                   	ret
+
+0000000000802546 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802546:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802552:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802555:	48 83 c2 01          	add    $0x1,%rdx
+  802559:	84 c9                	test   %cl,%cl
+  80255b:	75 f1                	jne    80254e <strcpy+0x8>
+        ;
+    return res;
+}
+  80255d:	c3                   	ret
+
+000000000080255e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80255e:	55                   	push   %rbp
+  80255f:	48 89 e5             	mov    %rsp,%rbp
+  802562:	41 54                	push   %r12
+  802564:	53                   	push   %rbx
+  802565:	48 89 fb             	mov    %rdi,%rbx
+  802568:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80256b:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802577:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80257b:	4c 89 e6             	mov    %r12,%rsi
+  80257e:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  802585:	00 00 00 
+  802588:	ff d0                	call   *%rax
+    return dst;
+}
+  80258a:	48 89 d8             	mov    %rbx,%rax
+  80258d:	5b                   	pop    %rbx
+  80258e:	41 5c                	pop    %r12
+  802590:	5d                   	pop    %rbp
+  802591:	c3                   	ret
+
+0000000000802592 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802592:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802595:	48 85 d2             	test   %rdx,%rdx
+  802598:	74 1f                	je     8025b9 <strncpy+0x27>
+  80259a:	48 01 fa             	add    %rdi,%rdx
+  80259d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8025a0:	48 83 c1 01          	add    $0x1,%rcx
+  8025a4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8025a8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8025ac:	41 80 f8 01          	cmp    $0x1,%r8b
+  8025b0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8025b4:	48 39 ca             	cmp    %rcx,%rdx
+  8025b7:	75 e7                	jne    8025a0 <strncpy+0xe>
+    }
+    return ret;
+}
+  8025b9:	c3                   	ret
+
+00000000008025ba <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8025ba:	48 89 f8             	mov    %rdi,%rax
+  8025bd:	48 85 d2             	test   %rdx,%rdx
+  8025c0:	74 24                	je     8025e6 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8025c2:	48 83 ea 01          	sub    $0x1,%rdx
+  8025c6:	74 1b                	je     8025e3 <strlcpy+0x29>
+  8025c8:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8025cc:	0f b6 16             	movzbl (%rsi),%edx
+  8025cf:	84 d2                	test   %dl,%dl
+  8025d1:	74 10                	je     8025e3 <strlcpy+0x29>
+            *dst++ = *src++;
+  8025d3:	48 83 c6 01          	add    $0x1,%rsi
+  8025d7:	48 83 c0 01          	add    $0x1,%rax
+  8025db:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8025de:	48 39 c8             	cmp    %rcx,%rax
+  8025e1:	75 e9                	jne    8025cc <strlcpy+0x12>
+        *dst = '\0';
+  8025e3:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8025e6:	48 29 f8             	sub    %rdi,%rax
+}
+  8025e9:	c3                   	ret
+
+00000000008025ea <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8025ea:	0f b6 07             	movzbl (%rdi),%eax
+  8025ed:	84 c0                	test   %al,%al
+  8025ef:	74 13                	je     802604 <strcmp+0x1a>
+  8025f1:	38 06                	cmp    %al,(%rsi)
+  8025f3:	75 0f                	jne    802604 <strcmp+0x1a>
+  8025f5:	48 83 c7 01          	add    $0x1,%rdi
+  8025f9:	48 83 c6 01          	add    $0x1,%rsi
+  8025fd:	0f b6 07             	movzbl (%rdi),%eax
+  802600:	84 c0                	test   %al,%al
+  802602:	75 ed                	jne    8025f1 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802604:	0f b6 c0             	movzbl %al,%eax
+  802607:	0f b6 16             	movzbl (%rsi),%edx
+  80260a:	29 d0                	sub    %edx,%eax
+}
+  80260c:	c3                   	ret
+
+000000000080260d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80260d:	48 85 d2             	test   %rdx,%rdx
+  802610:	74 1f                	je     802631 <strncmp+0x24>
+  802612:	0f b6 07             	movzbl (%rdi),%eax
+  802615:	84 c0                	test   %al,%al
+  802617:	74 1e                	je     802637 <strncmp+0x2a>
+  802619:	3a 06                	cmp    (%rsi),%al
+  80261b:	75 1a                	jne    802637 <strncmp+0x2a>
+  80261d:	48 83 c7 01          	add    $0x1,%rdi
+  802621:	48 83 c6 01          	add    $0x1,%rsi
+  802625:	48 83 ea 01          	sub    $0x1,%rdx
+  802629:	75 e7                	jne    802612 <strncmp+0x5>
+
+    if (!n) return 0;
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802630:	c3                   	ret
+  802631:	b8 00 00 00 00       	mov    $0x0,%eax
+  802636:	c3                   	ret
+  802637:	48 85 d2             	test   %rdx,%rdx
+  80263a:	74 09                	je     802645 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80263c:	0f b6 07             	movzbl (%rdi),%eax
+  80263f:	0f b6 16             	movzbl (%rsi),%edx
+  802642:	29 d0                	sub    %edx,%eax
+  802644:	c3                   	ret
+    if (!n) return 0;
+  802645:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264a:	c3                   	ret
+
+000000000080264b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80264b:	0f b6 17             	movzbl (%rdi),%edx
+  80264e:	84 d2                	test   %dl,%dl
+  802650:	74 18                	je     80266a <strchr+0x1f>
+        if (*str == c) {
+  802652:	0f be d2             	movsbl %dl,%edx
+  802655:	39 f2                	cmp    %esi,%edx
+  802657:	74 17                	je     802670 <strchr+0x25>
+    for (; *str; str++) {
+  802659:	48 83 c7 01          	add    $0x1,%rdi
+  80265d:	0f b6 17             	movzbl (%rdi),%edx
+  802660:	84 d2                	test   %dl,%dl
+  802662:	75 ee                	jne    802652 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	c3                   	ret
+  80266a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266f:	c3                   	ret
+  802670:	48 89 f8             	mov    %rdi,%rax
+}
+  802673:	c3                   	ret
+
+0000000000802674 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802674:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802677:	0f b6 17             	movzbl (%rdi),%edx
+  80267a:	84 d2                	test   %dl,%dl
+  80267c:	74 13                	je     802691 <strfind+0x1d>
+  80267e:	0f be d2             	movsbl %dl,%edx
+  802681:	39 f2                	cmp    %esi,%edx
+  802683:	74 0b                	je     802690 <strfind+0x1c>
+  802685:	48 83 c0 01          	add    $0x1,%rax
+  802689:	0f b6 10             	movzbl (%rax),%edx
+  80268c:	84 d2                	test   %dl,%dl
+  80268e:	75 ee                	jne    80267e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802690:	c3                   	ret
+  802691:	c3                   	ret
+
+0000000000802692 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  802692:	55                   	push   %rbp
+  802693:	48 89 e5             	mov    %rsp,%rbp
+  802696:	41 57                	push   %r15
+  802698:	41 56                	push   %r14
+  80269a:	41 55                	push   %r13
+  80269c:	41 54                	push   %r12
+  80269e:	53                   	push   %rbx
+  80269f:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a3:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  8026a6:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  8026aa:	45 84 ed             	test   %r13b,%r13b
+  8026ad:	75 12                	jne    8026c1 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  8026af:	4c 89 f8             	mov    %r15,%rax
+  8026b2:	48 83 c4 08          	add    $0x8,%rsp
+  8026b6:	5b                   	pop    %rbx
+  8026b7:	41 5c                	pop    %r12
+  8026b9:	41 5d                	pop    %r13
+  8026bb:	41 5e                	pop    %r14
+  8026bd:	41 5f                	pop    %r15
+  8026bf:	5d                   	pop    %rbp
+  8026c0:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8026c1:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8026c5:	4c 89 e7             	mov    %r12,%rdi
+  8026c8:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  8026cf:	00 00 00 
+  8026d2:	ff d0                	call   *%rax
+  8026d4:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8026d7:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8026db:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8026df:	49 bf 0d 26 80 00 00 	movabs $0x80260d,%r15
+  8026e6:	00 00 00 
+				if ((sc = *s++) == 0)
+  8026e9:	84 c0                	test   %al,%al
+  8026eb:	75 14                	jne    802701 <strstr+0x6f>
+					return NULL;
+  8026ed:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8026f3:	eb ba                	jmp    8026af <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8026f5:	48 83 c3 01          	add    $0x1,%rbx
+  8026f9:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8026fd:	84 c0                	test   %al,%al
+  8026ff:	74 1b                	je     80271c <strstr+0x8a>
+			} while (sc != c);
+  802701:	41 38 c5             	cmp    %al,%r13b
+  802704:	75 ef                	jne    8026f5 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  802706:	4c 89 f2             	mov    %r14,%rdx
+  802709:	4c 89 e6             	mov    %r12,%rsi
+  80270c:	48 89 df             	mov    %rbx,%rdi
+  80270f:	41 ff d7             	call   *%r15
+  802712:	85 c0                	test   %eax,%eax
+  802714:	75 df                	jne    8026f5 <strstr+0x63>
+  802716:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  80271a:	eb 93                	jmp    8026af <strstr+0x1d>
+					return NULL;
+  80271c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  802722:	eb 8b                	jmp    8026af <strstr+0x1d>
+
+0000000000802724 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  802724:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  802726:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  802729:	8d 57 20             	lea    0x20(%rdi),%edx
+  80272c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80272f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802732:	c3                   	ret
+
+0000000000802733 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  802733:	55                   	push   %rbp
+  802734:	48 89 e5             	mov    %rsp,%rbp
+  802737:	41 57                	push   %r15
+  802739:	41 56                	push   %r14
+  80273b:	41 55                	push   %r13
+  80273d:	41 54                	push   %r12
+  80273f:	53                   	push   %rbx
+  802740:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  802744:	48 39 f7             	cmp    %rsi,%rdi
+  802747:	74 49                	je     802792 <strcasecmp+0x5f>
+  802749:	49 89 fd             	mov    %rdi,%r13
+  80274c:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80274f:	49 bf 24 27 80 00 00 	movabs $0x802724,%r15
+  802756:	00 00 00 
+  802759:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80275e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802762:	41 ff d7             	call   *%r15
+  802765:	89 c3                	mov    %eax,%ebx
+  802767:	49 83 c4 01          	add    $0x1,%r12
+  80276b:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  802771:	41 ff d7             	call   *%r15
+  802774:	29 c3                	sub    %eax,%ebx
+  802776:	75 09                	jne    802781 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  802778:	49 83 c5 01          	add    $0x1,%r13
+  80277c:	45 84 f6             	test   %r14b,%r14b
+  80277f:	75 d8                	jne    802759 <strcasecmp+0x26>
+}
+  802781:	89 d8                	mov    %ebx,%eax
+  802783:	48 83 c4 08          	add    $0x8,%rsp
+  802787:	5b                   	pop    %rbx
+  802788:	41 5c                	pop    %r12
+  80278a:	41 5d                	pop    %r13
+  80278c:	41 5e                	pop    %r14
+  80278e:	41 5f                	pop    %r15
+  802790:	5d                   	pop    %rbp
+  802791:	c3                   	ret
+        return 0;
+  802792:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802797:	eb e8                	jmp    802781 <strcasecmp+0x4e>
+
+0000000000802799 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802799:	55                   	push   %rbp
+  80279a:	48 89 e5             	mov    %rsp,%rbp
+  80279d:	41 57                	push   %r15
+  80279f:	41 56                	push   %r14
+  8027a1:	41 55                	push   %r13
+  8027a3:	41 54                	push   %r12
+  8027a5:	53                   	push   %rbx
+  8027a6:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8027aa:	48 85 d2             	test   %rdx,%rdx
+  8027ad:	74 4f                	je     8027fe <strncasecmp+0x65>
+  8027af:	49 89 fc             	mov    %rdi,%r12
+  8027b2:	49 89 f5             	mov    %rsi,%r13
+  8027b5:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8027b9:	49 be 24 27 80 00 00 	movabs $0x802724,%r14
+  8027c0:	00 00 00 
+  8027c3:	49 83 c4 01          	add    $0x1,%r12
+  8027c7:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8027cd:	41 ff d6             	call   *%r14
+  8027d0:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8027d2:	49 83 c5 01          	add    $0x1,%r13
+  8027d6:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8027db:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8027de:	29 c3                	sub    %eax,%ebx
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	74 09                	je     8027ed <strncasecmp+0x54>
+  8027e4:	85 db                	test   %ebx,%ebx
+  8027e6:	75 05                	jne    8027ed <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8027e8:	4d 39 fc             	cmp    %r15,%r12
+  8027eb:	75 d6                	jne    8027c3 <strncasecmp+0x2a>
+}
+  8027ed:	89 d8                	mov    %ebx,%eax
+  8027ef:	48 83 c4 08          	add    $0x8,%rsp
+  8027f3:	5b                   	pop    %rbx
+  8027f4:	41 5c                	pop    %r12
+  8027f6:	41 5d                	pop    %r13
+  8027f8:	41 5e                	pop    %r14
+  8027fa:	41 5f                	pop    %r15
+  8027fc:	5d                   	pop    %rbp
+  8027fd:	c3                   	ret
+    int d = 0;
+  8027fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  802803:	eb e8                	jmp    8027ed <strncasecmp+0x54>
+
+0000000000802805 <toupper>:
+
+int toupper(int c) {
+  802805:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  802807:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80280a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80280d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802810:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802813:	c3                   	ret
+
+0000000000802814 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  802814:	83 ff 20             	cmp    $0x20,%edi
+  802817:	0f 94 c0             	sete   %al
+  80281a:	0f b6 c0             	movzbl %al,%eax
+}
+  80281d:	c3                   	ret
+
+000000000080281e <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80281e:	89 f8                	mov    %edi,%eax
+  802820:	f7 d8                	neg    %eax
+  802822:	0f 48 c7             	cmovs  %edi,%eax
+}
+  802825:	c3                   	ret
+
+0000000000802826 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802826:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802829:	48 89 f8             	mov    %rdi,%rax
+  80282c:	48 f7 d8             	neg    %rax
+  80282f:	83 e0 07             	and    $0x7,%eax
+  802832:	49 89 d1             	mov    %rdx,%r9
+  802835:	49 29 c1             	sub    %rax,%r9
+  802838:	78 36                	js     802870 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80283a:	40 0f b6 c6          	movzbl %sil,%eax
+  80283e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802845:	01 01 01 
+  802848:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80284c:	40 f6 c7 07          	test   $0x7,%dil
+  802850:	75 38                	jne    80288a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802852:	4c 89 c9             	mov    %r9,%rcx
+  802855:	48 c1 f9 03          	sar    $0x3,%rcx
+  802859:	74 0c                	je     802867 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80285b:	fc                   	cld
+  80285c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80285f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802863:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802867:	4d 85 c9             	test   %r9,%r9
+  80286a:	75 45                	jne    8028b1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80286c:	4c 89 c0             	mov    %r8,%rax
+  80286f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802870:	48 85 d2             	test   %rdx,%rdx
+  802873:	74 f7                	je     80286c <memset+0x46>
+  802875:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802878:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80287b:	48 83 c0 01          	add    $0x1,%rax
+  80287f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802883:	48 39 c2             	cmp    %rax,%rdx
+  802886:	75 f3                	jne    80287b <memset+0x55>
+  802888:	eb e2                	jmp    80286c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80288a:	40 f6 c7 01          	test   $0x1,%dil
+  80288e:	74 06                	je     802896 <memset+0x70>
+  802890:	88 07                	mov    %al,(%rdi)
+  802892:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802896:	40 f6 c7 02          	test   $0x2,%dil
+  80289a:	74 07                	je     8028a3 <memset+0x7d>
+  80289c:	66 89 07             	mov    %ax,(%rdi)
+  80289f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8028a3:	40 f6 c7 04          	test   $0x4,%dil
+  8028a7:	74 a9                	je     802852 <memset+0x2c>
+  8028a9:	89 07                	mov    %eax,(%rdi)
+  8028ab:	48 83 c7 04          	add    $0x4,%rdi
+  8028af:	eb a1                	jmp    802852 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8028b1:	41 f6 c1 04          	test   $0x4,%r9b
+  8028b5:	74 06                	je     8028bd <memset+0x97>
+  8028b7:	89 07                	mov    %eax,(%rdi)
+  8028b9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8028bd:	41 f6 c1 02          	test   $0x2,%r9b
+  8028c1:	74 07                	je     8028ca <memset+0xa4>
+  8028c3:	66 89 07             	mov    %ax,(%rdi)
+  8028c6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8028ca:	41 f6 c1 01          	test   $0x1,%r9b
+  8028ce:	74 9c                	je     80286c <memset+0x46>
+  8028d0:	88 07                	mov    %al,(%rdi)
+  8028d2:	eb 98                	jmp    80286c <memset+0x46>
+
+00000000008028d4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8028d4:	48 89 f8             	mov    %rdi,%rax
+  8028d7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8028da:	48 39 fe             	cmp    %rdi,%rsi
+  8028dd:	73 3b                	jae    80291a <memmove+0x46>
+  8028df:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028e3:	48 39 d7             	cmp    %rdx,%rdi
+  8028e6:	73 32                	jae    80291a <memmove+0x46>
+        s += n;
+        d += n;
+  8028e8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028ec:	48 89 d6             	mov    %rdx,%rsi
+  8028ef:	48 09 fe             	or     %rdi,%rsi
+  8028f2:	48 09 ce             	or     %rcx,%rsi
+  8028f5:	40 f6 c6 07          	test   $0x7,%sil
+  8028f9:	75 12                	jne    80290d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028fb:	48 83 ef 08          	sub    $0x8,%rdi
+  8028ff:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802903:	48 c1 e9 03          	shr    $0x3,%rcx
+  802907:	fd                   	std
+  802908:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80290b:	fc                   	cld
+  80290c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80290d:	48 83 ef 01          	sub    $0x1,%rdi
+  802911:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802915:	fd                   	std
+  802916:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802918:	eb f1                	jmp    80290b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80291a:	48 89 f2             	mov    %rsi,%rdx
+  80291d:	48 09 c2             	or     %rax,%rdx
+  802920:	48 09 ca             	or     %rcx,%rdx
+  802923:	f6 c2 07             	test   $0x7,%dl
+  802926:	75 0c                	jne    802934 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802928:	48 c1 e9 03          	shr    $0x3,%rcx
+  80292c:	48 89 c7             	mov    %rax,%rdi
+  80292f:	fc                   	cld
+  802930:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802933:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802934:	48 89 c7             	mov    %rax,%rdi
+  802937:	fc                   	cld
+  802938:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80293a:	c3                   	ret
+
+000000000080293b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80293b:	55                   	push   %rbp
+  80293c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80293f:	48 b8 d4 28 80 00 00 	movabs $0x8028d4,%rax
+  802946:	00 00 00 
+  802949:	ff d0                	call   *%rax
+}
+  80294b:	5d                   	pop    %rbp
+  80294c:	c3                   	ret
+
+000000000080294d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80294d:	55                   	push   %rbp
+  80294e:	48 89 e5             	mov    %rsp,%rbp
+  802951:	41 57                	push   %r15
+  802953:	41 56                	push   %r14
+  802955:	41 55                	push   %r13
+  802957:	41 54                	push   %r12
+  802959:	53                   	push   %rbx
+  80295a:	48 83 ec 08          	sub    $0x8,%rsp
+  80295e:	49 89 fe             	mov    %rdi,%r14
+  802961:	49 89 f7             	mov    %rsi,%r15
+  802964:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802967:	48 89 f7             	mov    %rsi,%rdi
+  80296a:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802979:	48 89 de             	mov    %rbx,%rsi
+  80297c:	4c 89 f7             	mov    %r14,%rdi
+  80297f:	48 b8 23 25 80 00 00 	movabs $0x802523,%rax
+  802986:	00 00 00 
+  802989:	ff d0                	call   *%rax
+  80298b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80298e:	48 39 c3             	cmp    %rax,%rbx
+  802991:	74 36                	je     8029c9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802993:	48 89 d8             	mov    %rbx,%rax
+  802996:	4c 29 e8             	sub    %r13,%rax
+  802999:	49 39 c4             	cmp    %rax,%r12
+  80299c:	73 31                	jae    8029cf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80299e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8029a3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029a7:	4c 89 fe             	mov    %r15,%rsi
+  8029aa:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8029b6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8029ba:	48 83 c4 08          	add    $0x8,%rsp
+  8029be:	5b                   	pop    %rbx
+  8029bf:	41 5c                	pop    %r12
+  8029c1:	41 5d                	pop    %r13
+  8029c3:	41 5e                	pop    %r14
+  8029c5:	41 5f                	pop    %r15
+  8029c7:	5d                   	pop    %rbp
+  8029c8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8029c9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8029cd:	eb eb                	jmp    8029ba <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8029cf:	48 83 eb 01          	sub    $0x1,%rbx
+  8029d3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029d7:	48 89 da             	mov    %rbx,%rdx
+  8029da:	4c 89 fe             	mov    %r15,%rsi
+  8029dd:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029e9:	49 01 de             	add    %rbx,%r14
+  8029ec:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029f1:	eb c3                	jmp    8029b6 <strlcat+0x69>
+
+00000000008029f3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029f3:	48 85 d2             	test   %rdx,%rdx
+  8029f6:	74 2d                	je     802a25 <memcmp+0x32>
+  8029f8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029fd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802a01:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802a06:	44 38 c1             	cmp    %r8b,%cl
+  802a09:	75 0f                	jne    802a1a <memcmp+0x27>
+    while (n-- > 0) {
+  802a0b:	48 83 c0 01          	add    $0x1,%rax
+  802a0f:	48 39 c2             	cmp    %rax,%rdx
+  802a12:	75 e9                	jne    8029fd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a19:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802a1a:	0f b6 c1             	movzbl %cl,%eax
+  802a1d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802a21:	44 29 c0             	sub    %r8d,%eax
+  802a24:	c3                   	ret
+    return 0;
+  802a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a2a:	c3                   	ret
+
+0000000000802a2b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802a2b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802a2f:	48 39 c7             	cmp    %rax,%rdi
+  802a32:	73 0f                	jae    802a43 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802a34:	40 38 37             	cmp    %sil,(%rdi)
+  802a37:	74 0e                	je     802a47 <memfind+0x1c>
+    for (; src < end; src++) {
+  802a39:	48 83 c7 01          	add    $0x1,%rdi
+  802a3d:	48 39 f8             	cmp    %rdi,%rax
+  802a40:	75 f2                	jne    802a34 <memfind+0x9>
+  802a42:	c3                   	ret
+  802a43:	48 89 f8             	mov    %rdi,%rax
+  802a46:	c3                   	ret
+  802a47:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a4a:	c3                   	ret
+
+0000000000802a4b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a4b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a4e:	0f b6 37             	movzbl (%rdi),%esi
+  802a51:	40 80 fe 20          	cmp    $0x20,%sil
+  802a55:	74 06                	je     802a5d <strtol+0x12>
+  802a57:	40 80 fe 09          	cmp    $0x9,%sil
+  802a5b:	75 13                	jne    802a70 <strtol+0x25>
+  802a5d:	48 83 c7 01          	add    $0x1,%rdi
+  802a61:	0f b6 37             	movzbl (%rdi),%esi
+  802a64:	40 80 fe 20          	cmp    $0x20,%sil
+  802a68:	74 f3                	je     802a5d <strtol+0x12>
+  802a6a:	40 80 fe 09          	cmp    $0x9,%sil
+  802a6e:	74 ed                	je     802a5d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a70:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a73:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a76:	3c 01                	cmp    $0x1,%al
+  802a78:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a7c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a82:	75 0f                	jne    802a93 <strtol+0x48>
+  802a84:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a87:	74 14                	je     802a9d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a89:	85 d2                	test   %edx,%edx
+  802a8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a90:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a98:	4c 63 ca             	movslq %edx,%r9
+  802a9b:	eb 36                	jmp    802ad3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a9d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802aa1:	74 0f                	je     802ab2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802aa3:	85 d2                	test   %edx,%edx
+  802aa5:	75 ec                	jne    802a93 <strtol+0x48>
+        s++;
+  802aa7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802aab:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802ab0:	eb e1                	jmp    802a93 <strtol+0x48>
+        s += 2;
+  802ab2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802ab6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802abb:	eb d6                	jmp    802a93 <strtol+0x48>
+            dig -= '0';
+  802abd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802ac0:	44 0f b6 c1          	movzbl %cl,%r8d
+  802ac4:	41 39 d0             	cmp    %edx,%r8d
+  802ac7:	7d 21                	jge    802aea <strtol+0x9f>
+        val = val * base + dig;
+  802ac9:	49 0f af c1          	imul   %r9,%rax
+  802acd:	0f b6 c9             	movzbl %cl,%ecx
+  802ad0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802ad3:	48 83 c7 01          	add    $0x1,%rdi
+  802ad7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802adb:	80 f9 39             	cmp    $0x39,%cl
+  802ade:	76 dd                	jbe    802abd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802ae0:	80 f9 7b             	cmp    $0x7b,%cl
+  802ae3:	77 05                	ja     802aea <strtol+0x9f>
+            dig -= 'a' - 10;
+  802ae5:	83 e9 57             	sub    $0x57,%ecx
+  802ae8:	eb d6                	jmp    802ac0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802aea:	4d 85 d2             	test   %r10,%r10
+  802aed:	74 03                	je     802af2 <strtol+0xa7>
+  802aef:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802af2:	48 89 c2             	mov    %rax,%rdx
+  802af5:	48 f7 da             	neg    %rdx
+  802af8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802afc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802b00:	c3                   	ret
+
+0000000000802b01 <atoi>:
+int atoi(const char *str) {
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  802b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0f:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+}
+  802b1b:	5d                   	pop    %rbp
+  802b1c:	c3                   	ret
+
+0000000000802b1d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802b1d:	55                   	push   %rbp
+  802b1e:	48 89 e5             	mov    %rsp,%rbp
+  802b21:	53                   	push   %rbx
+  802b22:	48 89 fa             	mov    %rdi,%rdx
+  802b25:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802b28:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802b37:	be 00 00 00 00       	mov    $0x0,%esi
+  802b3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802b42:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  802b44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+0000000000802b4a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802b4f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802b68:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802b73:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b79:	c9                   	leave
+  802b7a:	c3                   	ret
+
+0000000000802b7b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+  802b7f:	53                   	push   %rbx
+  802b80:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  802b84:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b87:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802b9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802ba6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ba8:	48 85 c0             	test   %rax,%rax
+  802bab:	7f 06                	jg     802bb3 <sys_env_destroy+0x38>
+}
+  802bad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bb3:	49 89 c0             	mov    %rax,%r8
+  802bb6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802bbb:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802bc2:	00 00 00 
+  802bc5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802bca:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802bd1:	00 00 00 
+  802bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd9:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802be0:	00 00 00 
+  802be3:	41 ff d1             	call   *%r9
+
+0000000000802be6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802beb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802c04:	be 00 00 00 00       	mov    $0x0,%esi
+  802c09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802c0f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c15:	c9                   	leave
+  802c16:	c3                   	ret
+
+0000000000802c17 <sys_yield>:
+
+void
+sys_yield(void) {
+  802c17:	55                   	push   %rbp
+  802c18:	48 89 e5             	mov    %rsp,%rbp
+  802c1b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c30:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802c35:	be 00 00 00 00       	mov    $0x0,%esi
+  802c3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802c40:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+0000000000802c48 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+  802c4c:	53                   	push   %rbx
+  802c4d:	48 89 fa             	mov    %rdi,%rdx
+  802c50:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c53:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c58:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802c5f:	00 00 00 
+  802c62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802c67:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802c72:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  802c74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c78:	c9                   	leave
+  802c79:	c3                   	ret
+
+0000000000802c7a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802c7a:	55                   	push   %rbp
+  802c7b:	48 89 e5             	mov    %rsp,%rbp
+  802c7e:	53                   	push   %rbx
+  802c7f:	49 89 f8             	mov    %rdi,%r8
+  802c82:	48 89 d3             	mov    %rdx,%rbx
+  802c85:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802c88:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c8d:	4c 89 c2             	mov    %r8,%rdx
+  802c90:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802c93:	be 00 00 00 00       	mov    $0x0,%esi
+  802c98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802c9e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  802ca0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+0000000000802ca6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802ca6:	55                   	push   %rbp
+  802ca7:	48 89 e5             	mov    %rsp,%rbp
+  802caa:	53                   	push   %rbx
+  802cab:	48 83 ec 08          	sub    $0x8,%rsp
+  802caf:	89 f8                	mov    %edi,%eax
+  802cb1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  802cb4:	48 63 f9             	movslq %ecx,%rdi
+  802cb7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cba:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cbf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802ccd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ccf:	48 85 c0             	test   %rax,%rax
+  802cd2:	7f 06                	jg     802cda <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802cd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cda:	49 89 c0             	mov    %rax,%r8
+  802cdd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802ce2:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802ce9:	00 00 00 
+  802cec:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802cf1:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802cf8:	00 00 00 
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802d07:	00 00 00 
+  802d0a:	41 ff d1             	call   *%r9
+
+0000000000802d0d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	53                   	push   %rbx
+  802d12:	48 83 ec 08          	sub    $0x8,%rsp
+  802d16:	89 f8                	mov    %edi,%eax
+  802d18:	49 89 f2             	mov    %rsi,%r10
+  802d1b:	48 89 cf             	mov    %rcx,%rdi
+  802d1e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  802d21:	48 63 da             	movslq %edx,%rbx
+  802d24:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d27:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d2c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802d2f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  802d32:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d34:	48 85 c0             	test   %rax,%rax
+  802d37:	7f 06                	jg     802d3f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d3f:	49 89 c0             	mov    %rax,%r8
+  802d42:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802d47:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802d4e:	00 00 00 
+  802d51:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802d56:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802d5d:	00 00 00 
+  802d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d65:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802d6c:	00 00 00 
+  802d6f:	41 ff d1             	call   *%r9
+
+0000000000802d72 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	53                   	push   %rbx
+  802d77:	48 83 ec 08          	sub    $0x8,%rsp
+  802d7b:	49 89 f9             	mov    %rdi,%r9
+  802d7e:	89 f0                	mov    %esi,%eax
+  802d80:	48 89 d3             	mov    %rdx,%rbx
+  802d83:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802d86:	49 63 f0             	movslq %r8d,%rsi
+  802d89:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d91:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802d94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802d9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9c:	48 85 c0             	test   %rax,%rax
+  802d9f:	7f 06                	jg     802da7 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802da1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da5:	c9                   	leave
+  802da6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da7:	49 89 c0             	mov    %rax,%r8
+  802daa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802daf:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802db6:	00 00 00 
+  802db9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802dbe:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802dc5:	00 00 00 
+  802dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcd:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802dd4:	00 00 00 
+  802dd7:	41 ff d1             	call   *%r9
+
+0000000000802dda <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	53                   	push   %rbx
+  802ddf:	89 f8                	mov    %edi,%eax
+  802de1:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  802de4:	48 63 f9             	movslq %ecx,%rdi
+  802de7:	48 63 da             	movslq %edx,%rbx
+  802dea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ded:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802df2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802df5:	be 00 00 00 00       	mov    $0x0,%esi
+  802dfa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802e00:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  802e02:	89 c2                	mov    %eax,%edx
+  802e04:	48 85 c0             	test   %rax,%rax
+  802e07:	78 0d                	js     802e16 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  802e09:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  802e0e:	4d 85 c9             	test   %r9,%r9
+  802e11:	74 03                	je     802e16 <sys_alloc_dma_region+0x3c>
+  802e13:	49 89 01             	mov    %rax,(%r9)
+}
+  802e16:	89 d0                	mov    %edx,%eax
+  802e18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+0000000000802e1e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  802e1e:	55                   	push   %rbp
+  802e1f:	48 89 e5             	mov    %rsp,%rbp
+  802e22:	53                   	push   %rbx
+  802e23:	48 83 ec 08          	sub    $0x8,%rsp
+  802e27:	48 89 f1             	mov    %rsi,%rcx
+  802e2a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802e2d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e30:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e35:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802e3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802e45:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e47:	48 85 c0             	test   %rax,%rax
+  802e4a:	7f 06                	jg     802e52 <sys_set_cache_region+0x34>
+}
+  802e4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e50:	c9                   	leave
+  802e51:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e52:	49 89 c0             	mov    %rax,%r8
+  802e55:	b9 08 00 00 00       	mov    $0x8,%ecx
+  802e5a:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802e61:	00 00 00 
+  802e64:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802e69:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802e70:	00 00 00 
+  802e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e78:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802e7f:	00 00 00 
+  802e82:	41 ff d1             	call   *%r9
+
+0000000000802e85 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	53                   	push   %rbx
+  802e8a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8e:	48 89 f1             	mov    %rsi,%rcx
+  802e91:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802e94:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e97:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802eac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802eae:	48 85 c0             	test   %rax,%rax
+  802eb1:	7f 06                	jg     802eb9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802eb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb7:	c9                   	leave
+  802eb8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802eb9:	49 89 c0             	mov    %rax,%r8
+  802ebc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802ec1:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802ec8:	00 00 00 
+  802ecb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802ed0:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802ed7:	00 00 00 
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edf:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802ee6:	00 00 00 
+  802ee9:	41 ff d1             	call   *%r9
+
+0000000000802eec <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	53                   	push   %rbx
+  802ef1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  802ef5:	48 63 ce             	movslq %esi,%rcx
+  802ef8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802efb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f05:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802f0a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802f15:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f17:	48 85 c0             	test   %rax,%rax
+  802f1a:	7f 06                	jg     802f22 <sys_env_set_status+0x36>
+}
+  802f1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f20:	c9                   	leave
+  802f21:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f22:	49 89 c0             	mov    %rax,%r8
+  802f25:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802f2a:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802f31:	00 00 00 
+  802f34:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802f39:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802f40:	00 00 00 
+  802f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f48:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802f4f:	00 00 00 
+  802f52:	41 ff d1             	call   *%r9
+
+0000000000802f55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802f55:	55                   	push   %rbp
+  802f56:	48 89 e5             	mov    %rsp,%rbp
+  802f59:	53                   	push   %rbx
+  802f5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802f61:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f64:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f6e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802f73:	be 00 00 00 00       	mov    $0x0,%esi
+  802f78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802f7e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f80:	48 85 c0             	test   %rax,%rax
+  802f83:	7f 06                	jg     802f8b <sys_env_set_trapframe+0x36>
+}
+  802f85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f8b:	49 89 c0             	mov    %rax,%r8
+  802f8e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  802f93:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  802f9a:	00 00 00 
+  802f9d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802fa2:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  802fa9:	00 00 00 
+  802fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb1:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  802fb8:	00 00 00 
+  802fbb:	41 ff d1             	call   *%r9
+
+0000000000802fbe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	53                   	push   %rbx
+  802fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802fca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fcd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802fdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802fe7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fe9:	48 85 c0             	test   %rax,%rax
+  802fec:	7f 06                	jg     802ff4 <sys_env_set_pgfault_upcall+0x36>
+}
+  802fee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff2:	c9                   	leave
+  802ff3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff4:	49 89 c0             	mov    %rax,%r8
+  802ff7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802ffc:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  803003:	00 00 00 
+  803006:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80300b:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  803012:	00 00 00 
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  803021:	00 00 00 
+  803024:	41 ff d1             	call   *%r9
+
+0000000000803027 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803027:	55                   	push   %rbp
+  803028:	48 89 e5             	mov    %rsp,%rbp
+  80302b:	53                   	push   %rbx
+  80302c:	89 f8                	mov    %edi,%eax
+  80302e:	49 89 f1             	mov    %rsi,%r9
+  803031:	48 89 d3             	mov    %rdx,%rbx
+  803034:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  803037:	49 63 f0             	movslq %r8d,%rsi
+  80303a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80303d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803042:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803045:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80304b:	cd 30                	int    $0x30
+}
+  80304d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803051:	c9                   	leave
+  803052:	c3                   	ret
+
+0000000000803053 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803053:	55                   	push   %rbp
+  803054:	48 89 e5             	mov    %rsp,%rbp
+  803057:	53                   	push   %rbx
+  803058:	48 83 ec 08          	sub    $0x8,%rsp
+  80305c:	48 89 fa             	mov    %rdi,%rdx
+  80305f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803062:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803071:	be 00 00 00 00       	mov    $0x0,%esi
+  803076:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80307c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80307e:	48 85 c0             	test   %rax,%rax
+  803081:	7f 06                	jg     803089 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803087:	c9                   	leave
+  803088:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803089:	49 89 c0             	mov    %rax,%r8
+  80308c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803091:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  803098:	00 00 00 
+  80309b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8030a0:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  8030a7:	00 00 00 
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030af:	49 b9 7e 1a 80 00 00 	movabs $0x801a7e,%r9
+  8030b6:	00 00 00 
+  8030b9:	41 ff d1             	call   *%r9
+
+00000000008030bc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8030bc:	55                   	push   %rbp
+  8030bd:	48 89 e5             	mov    %rsp,%rbp
+  8030c0:	53                   	push   %rbx
+  8030c1:	48 89 fa             	mov    %rdi,%rdx
+  8030c4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8030c7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8030d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8030e1:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8030e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e7:	c9                   	leave
+  8030e8:	c3                   	ret
+
+00000000008030e9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8030e9:	55                   	push   %rbp
+  8030ea:	48 89 e5             	mov    %rsp,%rbp
+  8030ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030ee:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803102:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803107:	be 00 00 00 00       	mov    $0x0,%esi
+  80310c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803112:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  803114:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803118:	c9                   	leave
+  803119:	c3                   	ret
+
+000000000080311a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80311a:	48 85 ff             	test   %rdi,%rdi
+  80311d:	0f 84 b6 01 00 00    	je     8032d9 <malloc+0x1bf>
+malloc(size_t size) {
+  803123:	55                   	push   %rbp
+  803124:	48 89 e5             	mov    %rsp,%rbp
+  803127:	41 56                	push   %r14
+  803129:	41 55                	push   %r13
+  80312b:	41 54                	push   %r12
+  80312d:	53                   	push   %rbx
+  80312e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  803131:	48 b8 a8 85 80 00 00 	movabs $0x8085a8,%rax
+  803138:	00 00 00 
+  80313b:	4c 8b 20             	mov    (%rax),%r12
+  80313e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  803145:	0f 87 94 01 00 00    	ja     8032df <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80314b:	48 a1 a0 85 80 00 00 	movabs 0x8085a0,%rax
+  803152:	00 00 00 
+  803155:	48 85 c0             	test   %rax,%rax
+  803158:	74 6b                	je     8031c5 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80315a:	4d 85 e4             	test   %r12,%r12
+  80315d:	74 66                	je     8031c5 <malloc+0xab>
+  80315f:	48 ba c8 85 80 00 00 	movabs $0x8085c8,%rdx
+  803166:	00 00 00 
+  803169:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80316e:	eb 0d                	jmp    80317d <malloc+0x63>
+  803170:	48 83 c1 01          	add    $0x1,%rcx
+  803174:	48 83 c2 18          	add    $0x18,%rdx
+  803178:	49 39 cc             	cmp    %rcx,%r12
+  80317b:	74 48                	je     8031c5 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80317d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  803182:	74 ec                	je     803170 <malloc+0x56>
+  803184:	48 39 1a             	cmp    %rbx,(%rdx)
+  803187:	72 e7                	jb     803170 <malloc+0x56>
+                real_freep_size--;
+  803189:	48 83 e8 01          	sub    $0x1,%rax
+  80318d:	48 a3 a0 85 80 00 00 	movabs %rax,0x8085a0
+  803194:	00 00 00 
+                freep[i].is_free = false;
+  803197:	48 ba c0 85 80 00 00 	movabs $0x8085c0,%rdx
+  80319e:	00 00 00 
+  8031a1:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8031a5:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8031a9:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8031ad:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8031b4:	00 
+                freep[i].size = size;
+  8031b5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8031b9:	48 01 c8             	add    %rcx,%rax
+  8031bc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031c0:	e9 0b 01 00 00       	jmp    8032d0 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8031c5:	48 a1 78 70 80 00 00 	movabs 0x807078,%rax
+  8031cc:	00 00 00 
+  8031cf:	48 01 d8             	add    %rbx,%rax
+  8031d2:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8031d8:	76 7c                	jbe    803256 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8031da:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8031e1:	00 00 00 
+  8031e4:	4c 8b 30             	mov    (%rax),%r14
+  8031e7:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8031ee:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8031f1:	48 b8 78 70 80 00 00 	movabs $0x807078,%rax
+  8031f8:	00 00 00 
+  8031fb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  803202:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  803209:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80320f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  803213:	48 b8 e6 2b 80 00 00 	movabs $0x802be6,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+  80321f:	89 c7                	mov    %eax,%edi
+  803221:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  803228:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80322f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  803236:	00 00 00 
+  803239:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80323d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  803242:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	0f 88 90 00 00 00    	js     8032e6 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  803256:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  80325d:	00 00 00 
+  803260:	48 8b 31             	mov    (%rcx),%rsi
+  803263:	48 bf 78 70 80 00 00 	movabs $0x807078,%rdi
+  80326a:	00 00 00 
+  80326d:	4c 8b 07             	mov    (%rdi),%r8
+  803270:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  803274:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80327b:	00 00 00 
+  80327e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  803282:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  803286:	48 b8 c0 85 80 00 00 	movabs $0x8085c0,%rax
+  80328d:	00 00 00 
+  803290:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  803294:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  803297:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80329b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8032a2:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8032a3:	48 89 d8             	mov    %rbx,%rax
+  8032a6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8032ab:	4c 01 c0             	add    %r8,%rax
+  8032ae:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8032b1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8032b8:	48 01 f3             	add    %rsi,%rbx
+  8032bb:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8032be:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8032c3:	48 a3 a8 85 80 00 00 	movabs %rax,0x8085a8
+  8032ca:	00 00 00 
+  8032cd:	48 89 d0             	mov    %rdx,%rax
+}
+  8032d0:	5b                   	pop    %rbx
+  8032d1:	41 5c                	pop    %r12
+  8032d3:	41 5d                	pop    %r13
+  8032d5:	41 5e                	pop    %r14
+  8032d7:	5d                   	pop    %rbp
+  8032d8:	c3                   	ret
+        return NULL;
+  8032d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032de:	c3                   	ret
+        return NULL;
+  8032df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e4:	eb ea                	jmp    8032d0 <malloc+0x1b6>
+            return NULL;
+  8032e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032eb:	eb e3                	jmp    8032d0 <malloc+0x1b6>
+
+00000000008032ed <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8032ed:	55                   	push   %rbp
+  8032ee:	48 89 e5             	mov    %rsp,%rbp
+  8032f1:	53                   	push   %rbx
+  8032f2:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8032f6:	48 89 fb             	mov    %rdi,%rbx
+  8032f9:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8032fd:	48 89 df             	mov    %rbx,%rdi
+  803300:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  803307:	00 00 00 
+  80330a:	ff d0                	call   *%rax
+  80330c:	48 89 c7             	mov    %rax,%rdi
+  80330f:	48 89 da             	mov    %rbx,%rdx
+  803312:	be 00 00 00 00       	mov    $0x0,%esi
+  803317:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+}
+  803323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803327:	c9                   	leave
+  803328:	c3                   	ret
+
+0000000000803329 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  803329:	48 a1 a8 85 80 00 00 	movabs 0x8085a8,%rax
+  803330:	00 00 00 
+  803333:	48 ba a0 85 80 00 00 	movabs $0x8085a0,%rdx
+  80333a:	00 00 00 
+  80333d:	48 3b 02             	cmp    (%rdx),%rax
+  803340:	74 4d                	je     80338f <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  803342:	48 85 c0             	test   %rax,%rax
+  803345:	74 4d                	je     803394 <get_allocsize+0x6b>
+  803347:	48 b9 c0 85 80 00 00 	movabs $0x8085c0,%rcx
+  80334e:	00 00 00 
+  803351:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  803356:	48 3b 39             	cmp    (%rcx),%rdi
+  803359:	74 13                	je     80336e <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80335b:	48 83 c2 01          	add    $0x1,%rdx
+  80335f:	48 83 c1 18          	add    $0x18,%rcx
+  803363:	48 39 d0             	cmp    %rdx,%rax
+  803366:	75 ee                	jne    803356 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  803368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336d:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80336e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  803372:	b8 00 00 00 00       	mov    $0x0,%eax
+  803377:	48 be c0 85 80 00 00 	movabs $0x8085c0,%rsi
+  80337e:	00 00 00 
+  803381:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  803387:	75 0b                	jne    803394 <get_allocsize+0x6b>
+  803389:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80338e:	c3                   	ret
+        return 0;
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803394:	c3                   	ret
+
+0000000000803395 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  803395:	48 85 ff             	test   %rdi,%rdi
+  803398:	0f 84 01 01 00 00    	je     80349f <free+0x10a>
+free(void *ptr) {
+  80339e:	55                   	push   %rbp
+  80339f:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8033a2:	48 b8 a8 85 80 00 00 	movabs $0x8085a8,%rax
+  8033a9:	00 00 00 
+  8033ac:	48 8b 30             	mov    (%rax),%rsi
+  8033af:	48 a1 a0 85 80 00 00 	movabs 0x8085a0,%rax
+  8033b6:	00 00 00 
+  8033b9:	48 39 c6             	cmp    %rax,%rsi
+  8033bc:	74 50                	je     80340e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8033be:	48 85 f6             	test   %rsi,%rsi
+  8033c1:	74 21                	je     8033e4 <free+0x4f>
+  8033c3:	48 b9 c0 85 80 00 00 	movabs $0x8085c0,%rcx
+  8033ca:	00 00 00 
+  8033cd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8033d2:	48 3b 39             	cmp    (%rcx),%rdi
+  8033d5:	74 61                	je     803438 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8033d7:	48 83 c2 01          	add    $0x1,%rdx
+  8033db:	48 83 c1 18          	add    $0x18,%rcx
+  8033df:	48 39 d6             	cmp    %rdx,%rsi
+  8033e2:	75 ee                	jne    8033d2 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8033e4:	48 ba 90 66 80 00 00 	movabs $0x806690,%rdx
+  8033eb:	00 00 00 
+  8033ee:	be 12 01 00 00       	mov    $0x112,%esi
+  8033f3:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  8033fa:	00 00 00 
+  8033fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803402:	48 b9 7e 1a 80 00 00 	movabs $0x801a7e,%rcx
+  803409:	00 00 00 
+  80340c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  80340e:	48 ba 40 66 80 00 00 	movabs $0x806640,%rdx
+  803415:	00 00 00 
+  803418:	be 06 01 00 00       	mov    $0x106,%esi
+  80341d:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  803424:	00 00 00 
+  803427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342c:	48 b9 7e 1a 80 00 00 	movabs $0x801a7e,%rcx
+  803433:	00 00 00 
+  803436:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  803438:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80343c:	48 be c0 85 80 00 00 	movabs $0x8085c0,%rsi
+  803443:	00 00 00 
+  803446:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80344c:	75 27                	jne    803475 <free+0xe0>
+            freep[i].is_free = true;
+  80344e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  803452:	48 ba c0 85 80 00 00 	movabs $0x8085c0,%rdx
+  803459:	00 00 00 
+  80345c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  803463:	00 00 
+            real_freep_size++;
+  803465:	48 83 c0 01          	add    $0x1,%rax
+  803469:	48 a3 a0 85 80 00 00 	movabs %rax,0x8085a0
+  803470:	00 00 00 
+}
+  803473:	5d                   	pop    %rbp
+  803474:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  803475:	48 ba 68 66 80 00 00 	movabs $0x806668,%rdx
+  80347c:	00 00 00 
+  80347f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  803484:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  80348b:	00 00 00 
+  80348e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803493:	48 b9 7e 1a 80 00 00 	movabs $0x801a7e,%rcx
+  80349a:	00 00 00 
+  80349d:	ff d1                	call   *%rcx
+  80349f:	c3                   	ret
+
+00000000008034a0 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  8034a0:	55                   	push   %rbp
+  8034a1:	48 89 e5             	mov    %rsp,%rbp
+  8034a4:	41 55                	push   %r13
+  8034a6:	41 54                	push   %r12
+  8034a8:	53                   	push   %rbx
+  8034a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ad:	48 89 fb             	mov    %rdi,%rbx
+  8034b0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8034b3:	48 b8 29 33 80 00 00 	movabs $0x803329,%rax
+  8034ba:	00 00 00 
+  8034bd:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  8034bf:	49 39 c5             	cmp    %rax,%r13
+  8034c2:	73 0e                	jae    8034d2 <realloc+0x32>
+}
+  8034c4:	48 89 d8             	mov    %rbx,%rax
+  8034c7:	48 83 c4 08          	add    $0x8,%rsp
+  8034cb:	5b                   	pop    %rbx
+  8034cc:	41 5c                	pop    %r12
+  8034ce:	41 5d                	pop    %r13
+  8034d0:	5d                   	pop    %rbp
+  8034d1:	c3                   	ret
+  8034d2:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  8034d5:	4c 89 ef             	mov    %r13,%rdi
+  8034d8:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  8034df:	00 00 00 
+  8034e2:	ff d0                	call   *%rax
+  8034e4:	48 89 c7             	mov    %rax,%rdi
+  8034e7:	4c 89 e2             	mov    %r12,%rdx
+  8034ea:	48 89 de             	mov    %rbx,%rsi
+  8034ed:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+  8034f9:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  8034fc:	48 89 df             	mov    %rbx,%rdi
+  8034ff:	48 b8 95 33 80 00 00 	movabs $0x803395,%rax
+  803506:	00 00 00 
+  803509:	ff d0                	call   *%rax
+    return newptr;
+  80350b:	4c 89 e3             	mov    %r12,%rbx
+  80350e:	eb b4                	jmp    8034c4 <realloc+0x24>
+
+0000000000803510 <strdup>:
+
+char*
+strdup (const char *src) {
+  803510:	55                   	push   %rbp
+  803511:	48 89 e5             	mov    %rsp,%rbp
+  803514:	41 54                	push   %r12
+  803516:	53                   	push   %rbx
+  803517:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  80351a:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+  803526:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  80352a:	4c 89 e7             	mov    %r12,%rdi
+  80352d:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  803534:	00 00 00 
+  803537:	ff d0                	call   *%rax
+  803539:	48 89 c7             	mov    %rax,%rdi
+  80353c:	4c 89 e2             	mov    %r12,%rdx
+  80353f:	48 89 de             	mov    %rbx,%rsi
+  803542:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  803549:	00 00 00 
+  80354c:	ff d0                	call   *%rax
+}
+  80354e:	5b                   	pop    %rbx
+  80354f:	41 5c                	pop    %r12
+  803551:	5d                   	pop    %rbp
+  803552:	c3                   	ret
+
+0000000000803553 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  803553:	55                   	push   %rbp
+  803554:	48 89 e5             	mov    %rsp,%rbp
+  803557:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803558:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80355d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803562:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803567:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803571:	be 00 00 00 00       	mov    $0x0,%esi
+  803576:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80357c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  80357e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803582:	c9                   	leave
+  803583:	c3                   	ret
+
+0000000000803584 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  803588:	48 b8 c0 85 98 00 00 	movabs $0x9885c0,%rax
+  80358f:	00 00 00 
+  803592:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803596:	74 26                	je     8035be <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  803598:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80359a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80359e:	89 c0                	mov    %eax,%eax
+  8035a0:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8035a3:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8035aa:	48 b9 c0 85 98 00 00 	movabs $0x9885c0,%rcx
+  8035b1:	00 00 00 
+  8035b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b9:	48 f7 31             	divq   (%rcx)
+}
+  8035bc:	5d                   	pop    %rbp
+  8035bd:	c3                   	ret
+        freq = get_cpufreq();
+  8035be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c3:	48 ba 53 35 80 00 00 	movabs $0x803553,%rdx
+  8035ca:	00 00 00 
+  8035cd:	ff d2                	call   *%rdx
+  8035cf:	48 a3 c0 85 98 00 00 	movabs %rax,0x9885c0
+  8035d6:	00 00 00 
+  8035d9:	eb bd                	jmp    803598 <get_ticks+0x14>
+
+00000000008035db <sleep>:
+
+void
+sleep(uint64_t ms) {
+  8035db:	55                   	push   %rbp
+  8035dc:	48 89 e5             	mov    %rsp,%rbp
+  8035df:	53                   	push   %rbx
+  8035e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8035e4:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  8035e7:	48 b8 c0 85 98 00 00 	movabs $0x9885c0,%rax
+  8035ee:	00 00 00 
+  8035f1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8035f5:	74 50                	je     803647 <sleep+0x6c>
+    asm volatile("rdtsc"
+  8035f7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8035f9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8035fd:	89 c0                	mov    %eax,%eax
+  8035ff:	48 89 d6             	mov    %rdx,%rsi
+  803602:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  803605:	48 b8 c0 85 98 00 00 	movabs $0x9885c0,%rax
+  80360c:	00 00 00 
+  80360f:	48 0f af 18          	imul   (%rax),%rbx
+  803613:	48 c1 eb 03          	shr    $0x3,%rbx
+  803617:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80361e:	9b c4 20 
+  803621:	48 89 d8             	mov    %rbx,%rax
+  803624:	48 f7 e2             	mul    %rdx
+  803627:	48 89 d1             	mov    %rdx,%rcx
+  80362a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  80362e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  803630:	48 c1 e2 20          	shl    $0x20,%rdx
+  803634:	89 c0                	mov    %eax,%eax
+  803636:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  803639:	48 29 f2             	sub    %rsi,%rdx
+  80363c:	48 39 ca             	cmp    %rcx,%rdx
+  80363f:	72 ed                	jb     80362e <sleep+0x53>
+}
+  803641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803645:	c9                   	leave
+  803646:	c3                   	ret
+        freq = get_cpufreq();
+  803647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364c:	48 ba 53 35 80 00 00 	movabs $0x803553,%rdx
+  803653:	00 00 00 
+  803656:	ff d2                	call   *%rdx
+  803658:	48 a3 c0 85 98 00 00 	movabs %rax,0x9885c0
+  80365f:	00 00 00 
+  803662:	eb 93                	jmp    8035f7 <sleep+0x1c>
+
+0000000000803664 <poll_kbd>:
+
+int poll_kbd() {
+  803664:	55                   	push   %rbp
+  803665:	48 89 e5             	mov    %rsp,%rbp
+  803668:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803669:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80366e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803673:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80367d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803682:	be 00 00 00 00       	mov    $0x0,%esi
+  803687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80368d:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  80368f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803693:	c9                   	leave
+  803694:	c3                   	ret
+
+0000000000803695 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  803695:	55                   	push   %rbp
+  803696:	48 89 e5             	mov    %rsp,%rbp
+  803699:	53                   	push   %rbx
+  80369a:	49 89 fa             	mov    %rdi,%r10
+  80369d:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  80369f:	44 89 c6             	mov    %r8d,%esi
+  8036a2:	89 cf                	mov    %ecx,%edi
+  8036a4:	89 d3                	mov    %edx,%ebx
+  8036a6:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8036a8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8036ad:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8036b0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8036b4:	cd 30                	int    $0x30
+  8036b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ba:	c9                   	leave
+  8036bb:	c3                   	ret
+
+00000000008036bc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8036bc:	55                   	push   %rbp
+  8036bd:	48 89 e5             	mov    %rsp,%rbp
+  8036c0:	41 55                	push   %r13
+  8036c2:	41 54                	push   %r12
+  8036c4:	53                   	push   %rbx
+  8036c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8036c9:	49 89 fc             	mov    %rdi,%r12
+  8036cc:	48 89 f7             	mov    %rsi,%rdi
+  8036cf:	48 89 d3             	mov    %rdx,%rbx
+  8036d2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8036d5:	48 85 f6             	test   %rsi,%rsi
+  8036d8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8036df:	00 00 00 
+  8036e2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8036e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036eb:	48 85 d2             	test   %rdx,%rdx
+  8036ee:	74 03                	je     8036f3 <ipc_recv+0x37>
+  8036f0:	48 8b 32             	mov    (%rdx),%rsi
+  8036f3:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  8036fa:	00 00 00 
+  8036fd:	ff d0                	call   *%rax
+    if (errno) {
+  8036ff:	85 c0                	test   %eax,%eax
+  803701:	74 1c                	je     80371f <ipc_recv+0x63>
+        if (from_env_store)
+  803703:	4d 85 e4             	test   %r12,%r12
+  803706:	74 08                	je     803710 <ipc_recv+0x54>
+            *from_env_store = 0;
+  803708:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80370f:	00 
+
+        if (perm_store)
+  803710:	4d 85 ed             	test   %r13,%r13
+  803713:	74 74                	je     803789 <ipc_recv+0xcd>
+            *perm_store = 0;
+  803715:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80371c:	00 
+  80371d:	eb 6a                	jmp    803789 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80371f:	4d 85 e4             	test   %r12,%r12
+  803722:	74 14                	je     803738 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  803724:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  80372b:	00 00 00 
+  80372e:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  803734:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  803738:	48 85 db             	test   %rbx,%rbx
+  80373b:	74 23                	je     803760 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80373d:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803744:	00 00 00 
+  803747:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80374d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803752:	85 c9                	test   %ecx,%ecx
+  803754:	74 07                	je     80375d <ipc_recv+0xa1>
+  803756:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80375d:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  803760:	4d 85 ed             	test   %r13,%r13
+  803763:	74 14                	je     803779 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  803765:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  80376c:	00 00 00 
+  80376f:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  803775:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  803779:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803780:	00 00 00 
+  803783:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  803789:	48 83 c4 08          	add    $0x8,%rsp
+  80378d:	5b                   	pop    %rbx
+  80378e:	41 5c                	pop    %r12
+  803790:	41 5d                	pop    %r13
+  803792:	5d                   	pop    %rbp
+  803793:	c3                   	ret
+
+0000000000803794 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803794:	55                   	push   %rbp
+  803795:	48 89 e5             	mov    %rsp,%rbp
+  803798:	41 55                	push   %r13
+  80379a:	41 54                	push   %r12
+  80379c:	53                   	push   %rbx
+  80379d:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a1:	49 89 fc             	mov    %rdi,%r12
+  8037a4:	48 89 f7             	mov    %rsi,%rdi
+  8037a7:	48 89 d3             	mov    %rdx,%rbx
+  8037aa:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8037ad:	48 85 f6             	test   %rsi,%rsi
+  8037b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037b7:	00 00 00 
+  8037ba:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8037be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037c3:	48 85 d2             	test   %rdx,%rdx
+  8037c6:	74 03                	je     8037cb <ipc_try_recv+0x37>
+  8037c8:	48 8b 32             	mov    (%rdx),%rsi
+  8037cb:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8037d2:	00 00 00 
+  8037d5:	ff d0                	call   *%rax
+    if (errno) {
+  8037d7:	85 c0                	test   %eax,%eax
+  8037d9:	75 75                	jne    803850 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8037db:	4d 85 e4             	test   %r12,%r12
+  8037de:	74 14                	je     8037f4 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8037e0:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  8037e7:	00 00 00 
+  8037ea:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8037f0:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8037f4:	48 85 db             	test   %rbx,%rbx
+  8037f7:	74 23                	je     80381c <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8037f9:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803800:	00 00 00 
+  803803:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  803809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80380e:	85 c9                	test   %ecx,%ecx
+  803810:	74 07                	je     803819 <ipc_try_recv+0x85>
+  803812:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  803819:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80381c:	4d 85 ed             	test   %r13,%r13
+  80381f:	74 14                	je     803835 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  803821:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803828:	00 00 00 
+  80382b:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  803831:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  803835:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  80383c:	00 00 00 
+  80383f:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  803845:	48 83 c4 08          	add    $0x8,%rsp
+  803849:	5b                   	pop    %rbx
+  80384a:	41 5c                	pop    %r12
+  80384c:	41 5d                	pop    %r13
+  80384e:	5d                   	pop    %rbp
+  80384f:	c3                   	ret
+        if (from_env_store)
+  803850:	4d 85 e4             	test   %r12,%r12
+  803853:	74 08                	je     80385d <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  803855:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80385c:	00 
+        if (perm_store)
+  80385d:	4d 85 ed             	test   %r13,%r13
+  803860:	74 e3                	je     803845 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  803862:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803869:	00 
+  80386a:	eb d9                	jmp    803845 <ipc_try_recv+0xb1>
+
+000000000080386c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80386c:	55                   	push   %rbp
+  80386d:	48 89 e5             	mov    %rsp,%rbp
+  803870:	41 57                	push   %r15
+  803872:	41 56                	push   %r14
+  803874:	41 55                	push   %r13
+  803876:	41 54                	push   %r12
+  803878:	53                   	push   %rbx
+  803879:	48 83 ec 18          	sub    $0x18,%rsp
+  80387d:	41 89 fd             	mov    %edi,%r13d
+  803880:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803883:	48 89 d3             	mov    %rdx,%rbx
+  803886:	49 89 cc             	mov    %rcx,%r12
+  803889:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80388d:	48 85 d2             	test   %rdx,%rdx
+  803890:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803897:	00 00 00 
+  80389a:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80389e:	49 be 27 30 80 00 00 	movabs $0x803027,%r14
+  8038a5:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8038a8:	49 bf 17 2c 80 00 00 	movabs $0x802c17,%r15
+  8038af:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8038b2:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8038b5:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8038b9:	4c 89 e1             	mov    %r12,%rcx
+  8038bc:	48 89 da             	mov    %rbx,%rdx
+  8038bf:	44 89 ef             	mov    %r13d,%edi
+  8038c2:	41 ff d6             	call   *%r14
+  8038c5:	85 c0                	test   %eax,%eax
+  8038c7:	74 37                	je     803900 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8038c9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038cc:	75 05                	jne    8038d3 <ipc_send+0x67>
+        sys_yield();
+  8038ce:	41 ff d7             	call   *%r15
+  8038d1:	eb df                	jmp    8038b2 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8038d3:	89 c1                	mov    %eax,%ecx
+  8038d5:	48 ba c6 66 80 00 00 	movabs $0x8066c6,%rdx
+  8038dc:	00 00 00 
+  8038df:	be 65 00 00 00       	mov    $0x65,%esi
+  8038e4:	48 bf e1 66 80 00 00 	movabs $0x8066e1,%rdi
+  8038eb:	00 00 00 
+  8038ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f3:	49 b8 7e 1a 80 00 00 	movabs $0x801a7e,%r8
+  8038fa:	00 00 00 
+  8038fd:	41 ff d0             	call   *%r8
+    }
+}
+  803900:	48 83 c4 18          	add    $0x18,%rsp
+  803904:	5b                   	pop    %rbx
+  803905:	41 5c                	pop    %r12
+  803907:	41 5d                	pop    %r13
+  803909:	41 5e                	pop    %r14
+  80390b:	41 5f                	pop    %r15
+  80390d:	5d                   	pop    %rbp
+  80390e:	c3                   	ret
+
+000000000080390f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80390f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803914:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80391b:	00 00 00 
+  80391e:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  803925:	48 01 ca             	add    %rcx,%rdx
+  803928:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80392e:	39 fa                	cmp    %edi,%edx
+  803930:	74 12                	je     803944 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803932:	48 83 c0 01          	add    $0x1,%rax
+  803936:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80393c:	75 e0                	jne    80391e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80393e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803943:	c3                   	ret
+            return envs[i].env_id;
+  803944:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80394b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803952:	00 00 00 
+  803955:	48 01 d0             	add    %rdx,%rax
+  803958:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80395e:	c3                   	ret
+
+000000000080395f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80395f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803966:	ff ff ff 
+  803969:	48 01 f8             	add    %rdi,%rax
+  80396c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803970:	c3                   	ret
+
+0000000000803971 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803971:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803978:	ff ff ff 
+  80397b:	48 01 f8             	add    %rdi,%rax
+  80397e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803982:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803988:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80398c:	c3                   	ret
+
+000000000080398d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80398d:	55                   	push   %rbp
+  80398e:	48 89 e5             	mov    %rsp,%rbp
+  803991:	41 57                	push   %r15
+  803993:	41 56                	push   %r14
+  803995:	41 55                	push   %r13
+  803997:	41 54                	push   %r12
+  803999:	53                   	push   %rbx
+  80399a:	48 83 ec 08          	sub    $0x8,%rsp
+  80399e:	49 89 ff             	mov    %rdi,%r15
+  8039a1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8039a6:	49 bd 41 58 80 00 00 	movabs $0x805841,%r13
+  8039ad:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8039b0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8039b6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8039b9:	48 89 df             	mov    %rbx,%rdi
+  8039bc:	41 ff d5             	call   *%r13
+  8039bf:	83 e0 04             	and    $0x4,%eax
+  8039c2:	74 17                	je     8039db <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8039c4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8039cb:	4c 39 f3             	cmp    %r14,%rbx
+  8039ce:	75 e6                	jne    8039b6 <fd_alloc+0x29>
+  8039d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8039d6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8039db:	4d 89 27             	mov    %r12,(%r15)
+}
+  8039de:	48 83 c4 08          	add    $0x8,%rsp
+  8039e2:	5b                   	pop    %rbx
+  8039e3:	41 5c                	pop    %r12
+  8039e5:	41 5d                	pop    %r13
+  8039e7:	41 5e                	pop    %r14
+  8039e9:	41 5f                	pop    %r15
+  8039eb:	5d                   	pop    %rbp
+  8039ec:	c3                   	ret
+
+00000000008039ed <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8039ed:	83 ff 1f             	cmp    $0x1f,%edi
+  8039f0:	77 39                	ja     803a2b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8039f2:	55                   	push   %rbp
+  8039f3:	48 89 e5             	mov    %rsp,%rbp
+  8039f6:	41 54                	push   %r12
+  8039f8:	53                   	push   %rbx
+  8039f9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8039fc:	48 63 df             	movslq %edi,%rbx
+  8039ff:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803a06:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803a0a:	48 89 df             	mov    %rbx,%rdi
+  803a0d:	48 b8 41 58 80 00 00 	movabs $0x805841,%rax
+  803a14:	00 00 00 
+  803a17:	ff d0                	call   *%rax
+  803a19:	a8 04                	test   $0x4,%al
+  803a1b:	74 14                	je     803a31 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803a1d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a26:	5b                   	pop    %rbx
+  803a27:	41 5c                	pop    %r12
+  803a29:	5d                   	pop    %rbp
+  803a2a:	c3                   	ret
+        return -E_INVAL;
+  803a2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803a30:	c3                   	ret
+        return -E_INVAL;
+  803a31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a36:	eb ee                	jmp    803a26 <fd_lookup+0x39>
+
+0000000000803a38 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803a38:	55                   	push   %rbp
+  803a39:	48 89 e5             	mov    %rsp,%rbp
+  803a3c:	41 54                	push   %r12
+  803a3e:	53                   	push   %rbx
+  803a3f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803a42:	48 b8 80 67 80 00 00 	movabs $0x806780,%rax
+  803a49:	00 00 00 
+  803a4c:	48 bb a0 70 80 00 00 	movabs $0x8070a0,%rbx
+  803a53:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803a56:	39 3b                	cmp    %edi,(%rbx)
+  803a58:	74 47                	je     803aa1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803a5a:	48 83 c0 08          	add    $0x8,%rax
+  803a5e:	48 8b 18             	mov    (%rax),%rbx
+  803a61:	48 85 db             	test   %rbx,%rbx
+  803a64:	75 f0                	jne    803a56 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803a66:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803a6d:	00 00 00 
+  803a70:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803a76:	89 fa                	mov    %edi,%edx
+  803a78:	48 bf f0 66 80 00 00 	movabs $0x8066f0,%rdi
+  803a7f:	00 00 00 
+  803a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a87:	48 b9 ce 1b 80 00 00 	movabs $0x801bce,%rcx
+  803a8e:	00 00 00 
+  803a91:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803a93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803a98:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803a9c:	5b                   	pop    %rbx
+  803a9d:	41 5c                	pop    %r12
+  803a9f:	5d                   	pop    %rbp
+  803aa0:	c3                   	ret
+            return 0;
+  803aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa6:	eb f0                	jmp    803a98 <dev_lookup+0x60>
+
+0000000000803aa8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803aa8:	55                   	push   %rbp
+  803aa9:	48 89 e5             	mov    %rsp,%rbp
+  803aac:	41 55                	push   %r13
+  803aae:	41 54                	push   %r12
+  803ab0:	53                   	push   %rbx
+  803ab1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ab5:	48 89 fb             	mov    %rdi,%rbx
+  803ab8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803abb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803ac2:	ff ff ff 
+  803ac5:	48 01 df             	add    %rbx,%rdi
+  803ac8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803acc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ad0:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+  803adc:	41 89 c5             	mov    %eax,%r13d
+  803adf:	85 c0                	test   %eax,%eax
+  803ae1:	78 06                	js     803ae9 <fd_close+0x41>
+  803ae3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803ae7:	74 1a                	je     803b03 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803ae9:	45 84 e4             	test   %r12b,%r12b
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803af5:	44 89 e8             	mov    %r13d,%eax
+  803af8:	48 83 c4 18          	add    $0x18,%rsp
+  803afc:	5b                   	pop    %rbx
+  803afd:	41 5c                	pop    %r12
+  803aff:	41 5d                	pop    %r13
+  803b01:	5d                   	pop    %rbp
+  803b02:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803b03:	8b 3b                	mov    (%rbx),%edi
+  803b05:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803b09:	48 b8 38 3a 80 00 00 	movabs $0x803a38,%rax
+  803b10:	00 00 00 
+  803b13:	ff d0                	call   *%rax
+  803b15:	41 89 c5             	mov    %eax,%r13d
+  803b18:	85 c0                	test   %eax,%eax
+  803b1a:	78 1b                	js     803b37 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803b1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b20:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803b24:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803b2a:	48 85 c0             	test   %rax,%rax
+  803b2d:	74 08                	je     803b37 <fd_close+0x8f>
+  803b2f:	48 89 df             	mov    %rbx,%rdi
+  803b32:	ff d0                	call   *%rax
+  803b34:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b3c:	48 89 de             	mov    %rbx,%rsi
+  803b3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b44:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  803b4b:	00 00 00 
+  803b4e:	ff d0                	call   *%rax
+    return res;
+  803b50:	eb a3                	jmp    803af5 <fd_close+0x4d>
+
+0000000000803b52 <close>:
+
+int
+close(int fdnum) {
+  803b52:	55                   	push   %rbp
+  803b53:	48 89 e5             	mov    %rsp,%rbp
+  803b56:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b5a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b5e:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803b65:	00 00 00 
+  803b68:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b6a:	85 c0                	test   %eax,%eax
+  803b6c:	78 15                	js     803b83 <close+0x31>
+
+    return fd_close(fd, 1);
+  803b6e:	be 01 00 00 00       	mov    $0x1,%esi
+  803b73:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b77:	48 b8 a8 3a 80 00 00 	movabs $0x803aa8,%rax
+  803b7e:	00 00 00 
+  803b81:	ff d0                	call   *%rax
+}
+  803b83:	c9                   	leave
+  803b84:	c3                   	ret
+
+0000000000803b85 <close_all>:
+
+void
+close_all(void) {
+  803b85:	55                   	push   %rbp
+  803b86:	48 89 e5             	mov    %rsp,%rbp
+  803b89:	41 54                	push   %r12
+  803b8b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803b8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b91:	49 bc 52 3b 80 00 00 	movabs $0x803b52,%r12
+  803b98:	00 00 00 
+  803b9b:	89 df                	mov    %ebx,%edi
+  803b9d:	41 ff d4             	call   *%r12
+  803ba0:	83 c3 01             	add    $0x1,%ebx
+  803ba3:	83 fb 20             	cmp    $0x20,%ebx
+  803ba6:	75 f3                	jne    803b9b <close_all+0x16>
+}
+  803ba8:	5b                   	pop    %rbx
+  803ba9:	41 5c                	pop    %r12
+  803bab:	5d                   	pop    %rbp
+  803bac:	c3                   	ret
+
+0000000000803bad <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803bad:	55                   	push   %rbp
+  803bae:	48 89 e5             	mov    %rsp,%rbp
+  803bb1:	41 57                	push   %r15
+  803bb3:	41 56                	push   %r14
+  803bb5:	41 55                	push   %r13
+  803bb7:	41 54                	push   %r12
+  803bb9:	53                   	push   %rbx
+  803bba:	48 83 ec 18          	sub    $0x18,%rsp
+  803bbe:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803bc1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803bc5:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+  803bd1:	89 c3                	mov    %eax,%ebx
+  803bd3:	85 c0                	test   %eax,%eax
+  803bd5:	0f 88 b8 00 00 00    	js     803c93 <dup+0xe6>
+    close(newfdnum);
+  803bdb:	44 89 e7             	mov    %r12d,%edi
+  803bde:	48 b8 52 3b 80 00 00 	movabs $0x803b52,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803bea:	4d 63 ec             	movslq %r12d,%r13
+  803bed:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803bf4:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803bf8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803bfc:	4c 89 ff             	mov    %r15,%rdi
+  803bff:	49 be 71 39 80 00 00 	movabs $0x803971,%r14
+  803c06:	00 00 00 
+  803c09:	41 ff d6             	call   *%r14
+  803c0c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803c0f:	4c 89 ef             	mov    %r13,%rdi
+  803c12:	41 ff d6             	call   *%r14
+  803c15:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803c18:	48 89 df             	mov    %rbx,%rdi
+  803c1b:	48 b8 41 58 80 00 00 	movabs $0x805841,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803c27:	a8 04                	test   $0x4,%al
+  803c29:	74 2b                	je     803c56 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803c2b:	41 89 c1             	mov    %eax,%r9d
+  803c2e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c34:	4c 89 f1             	mov    %r14,%rcx
+  803c37:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c3c:	48 89 de             	mov    %rbx,%rsi
+  803c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c44:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  803c4b:	00 00 00 
+  803c4e:	ff d0                	call   *%rax
+  803c50:	89 c3                	mov    %eax,%ebx
+  803c52:	85 c0                	test   %eax,%eax
+  803c54:	78 4e                	js     803ca4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803c56:	4c 89 ff             	mov    %r15,%rdi
+  803c59:	48 b8 41 58 80 00 00 	movabs $0x805841,%rax
+  803c60:	00 00 00 
+  803c63:	ff d0                	call   *%rax
+  803c65:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803c68:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c6e:	4c 89 e9             	mov    %r13,%rcx
+  803c71:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c76:	4c 89 fe             	mov    %r15,%rsi
+  803c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7e:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  803c85:	00 00 00 
+  803c88:	ff d0                	call   *%rax
+  803c8a:	89 c3                	mov    %eax,%ebx
+  803c8c:	85 c0                	test   %eax,%eax
+  803c8e:	78 14                	js     803ca4 <dup+0xf7>
+
+    return newfdnum;
+  803c90:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803c93:	89 d8                	mov    %ebx,%eax
+  803c95:	48 83 c4 18          	add    $0x18,%rsp
+  803c99:	5b                   	pop    %rbx
+  803c9a:	41 5c                	pop    %r12
+  803c9c:	41 5d                	pop    %r13
+  803c9e:	41 5e                	pop    %r14
+  803ca0:	41 5f                	pop    %r15
+  803ca2:	5d                   	pop    %rbp
+  803ca3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803ca4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ca9:	4c 89 ee             	mov    %r13,%rsi
+  803cac:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb1:	49 bc 85 2e 80 00 00 	movabs $0x802e85,%r12
+  803cb8:	00 00 00 
+  803cbb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803cbe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc3:	4c 89 f6             	mov    %r14,%rsi
+  803cc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ccb:	41 ff d4             	call   *%r12
+    return res;
+  803cce:	eb c3                	jmp    803c93 <dup+0xe6>
+
+0000000000803cd0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803cd0:	55                   	push   %rbp
+  803cd1:	48 89 e5             	mov    %rsp,%rbp
+  803cd4:	41 56                	push   %r14
+  803cd6:	41 55                	push   %r13
+  803cd8:	41 54                	push   %r12
+  803cda:	53                   	push   %rbx
+  803cdb:	48 83 ec 10          	sub    $0x10,%rsp
+  803cdf:	89 fb                	mov    %edi,%ebx
+  803ce1:	49 89 f4             	mov    %rsi,%r12
+  803ce4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ce7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ceb:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+  803cf7:	85 c0                	test   %eax,%eax
+  803cf9:	78 4c                	js     803d47 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803cfb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803cff:	41 8b 3e             	mov    (%r14),%edi
+  803d02:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803d06:	48 b8 38 3a 80 00 00 	movabs $0x803a38,%rax
+  803d0d:	00 00 00 
+  803d10:	ff d0                	call   *%rax
+  803d12:	85 c0                	test   %eax,%eax
+  803d14:	78 35                	js     803d4b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803d16:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803d1a:	83 e0 03             	and    $0x3,%eax
+  803d1d:	83 f8 01             	cmp    $0x1,%eax
+  803d20:	74 2d                	je     803d4f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803d22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d26:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803d2a:	48 85 c0             	test   %rax,%rax
+  803d2d:	74 56                	je     803d85 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803d2f:	4c 89 ea             	mov    %r13,%rdx
+  803d32:	4c 89 e6             	mov    %r12,%rsi
+  803d35:	4c 89 f7             	mov    %r14,%rdi
+  803d38:	ff d0                	call   *%rax
+}
+  803d3a:	48 83 c4 10          	add    $0x10,%rsp
+  803d3e:	5b                   	pop    %rbx
+  803d3f:	41 5c                	pop    %r12
+  803d41:	41 5d                	pop    %r13
+  803d43:	41 5e                	pop    %r14
+  803d45:	5d                   	pop    %rbp
+  803d46:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803d47:	48 98                	cltq
+  803d49:	eb ef                	jmp    803d3a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803d4b:	48 98                	cltq
+  803d4d:	eb eb                	jmp    803d3a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803d4f:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803d56:	00 00 00 
+  803d59:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803d5f:	89 da                	mov    %ebx,%edx
+  803d61:	48 bf 31 67 80 00 00 	movabs $0x806731,%rdi
+  803d68:	00 00 00 
+  803d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d70:	48 b9 ce 1b 80 00 00 	movabs $0x801bce,%rcx
+  803d77:	00 00 00 
+  803d7a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803d7c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803d83:	eb b5                	jmp    803d3a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803d85:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803d8c:	eb ac                	jmp    803d3a <read+0x6a>
+
+0000000000803d8e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803d8e:	55                   	push   %rbp
+  803d8f:	48 89 e5             	mov    %rsp,%rbp
+  803d92:	41 57                	push   %r15
+  803d94:	41 56                	push   %r14
+  803d96:	41 55                	push   %r13
+  803d98:	41 54                	push   %r12
+  803d9a:	53                   	push   %rbx
+  803d9b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803d9f:	48 85 d2             	test   %rdx,%rdx
+  803da2:	74 54                	je     803df8 <readn+0x6a>
+  803da4:	41 89 fd             	mov    %edi,%r13d
+  803da7:	49 89 f6             	mov    %rsi,%r14
+  803daa:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803db2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803db7:	49 bf d0 3c 80 00 00 	movabs $0x803cd0,%r15
+  803dbe:	00 00 00 
+  803dc1:	4c 89 e2             	mov    %r12,%rdx
+  803dc4:	48 29 f2             	sub    %rsi,%rdx
+  803dc7:	4c 01 f6             	add    %r14,%rsi
+  803dca:	44 89 ef             	mov    %r13d,%edi
+  803dcd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803dd0:	85 c0                	test   %eax,%eax
+  803dd2:	78 20                	js     803df4 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803dd4:	01 c3                	add    %eax,%ebx
+  803dd6:	85 c0                	test   %eax,%eax
+  803dd8:	74 08                	je     803de2 <readn+0x54>
+  803dda:	48 63 f3             	movslq %ebx,%rsi
+  803ddd:	4c 39 e6             	cmp    %r12,%rsi
+  803de0:	72 df                	jb     803dc1 <readn+0x33>
+    }
+    return res;
+  803de2:	48 63 c3             	movslq %ebx,%rax
+}
+  803de5:	48 83 c4 08          	add    $0x8,%rsp
+  803de9:	5b                   	pop    %rbx
+  803dea:	41 5c                	pop    %r12
+  803dec:	41 5d                	pop    %r13
+  803dee:	41 5e                	pop    %r14
+  803df0:	41 5f                	pop    %r15
+  803df2:	5d                   	pop    %rbp
+  803df3:	c3                   	ret
+        if (inc < 0) return inc;
+  803df4:	48 98                	cltq
+  803df6:	eb ed                	jmp    803de5 <readn+0x57>
+    int inc = 1, res = 0;
+  803df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dfd:	eb e3                	jmp    803de2 <readn+0x54>
+
+0000000000803dff <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803dff:	55                   	push   %rbp
+  803e00:	48 89 e5             	mov    %rsp,%rbp
+  803e03:	41 56                	push   %r14
+  803e05:	41 55                	push   %r13
+  803e07:	41 54                	push   %r12
+  803e09:	53                   	push   %rbx
+  803e0a:	48 83 ec 10          	sub    $0x10,%rsp
+  803e0e:	89 fb                	mov    %edi,%ebx
+  803e10:	49 89 f4             	mov    %rsi,%r12
+  803e13:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803e16:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e1a:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803e21:	00 00 00 
+  803e24:	ff d0                	call   *%rax
+  803e26:	85 c0                	test   %eax,%eax
+  803e28:	78 47                	js     803e71 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803e2a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803e2e:	41 8b 3e             	mov    (%r14),%edi
+  803e31:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803e35:	48 b8 38 3a 80 00 00 	movabs $0x803a38,%rax
+  803e3c:	00 00 00 
+  803e3f:	ff d0                	call   *%rax
+  803e41:	85 c0                	test   %eax,%eax
+  803e43:	78 30                	js     803e75 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803e45:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803e4a:	74 2d                	je     803e79 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803e4c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e50:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e54:	48 85 c0             	test   %rax,%rax
+  803e57:	74 56                	je     803eaf <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803e59:	4c 89 ea             	mov    %r13,%rdx
+  803e5c:	4c 89 e6             	mov    %r12,%rsi
+  803e5f:	4c 89 f7             	mov    %r14,%rdi
+  803e62:	ff d0                	call   *%rax
+}
+  803e64:	48 83 c4 10          	add    $0x10,%rsp
+  803e68:	5b                   	pop    %rbx
+  803e69:	41 5c                	pop    %r12
+  803e6b:	41 5d                	pop    %r13
+  803e6d:	41 5e                	pop    %r14
+  803e6f:	5d                   	pop    %rbp
+  803e70:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803e71:	48 98                	cltq
+  803e73:	eb ef                	jmp    803e64 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803e75:	48 98                	cltq
+  803e77:	eb eb                	jmp    803e64 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803e79:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803e80:	00 00 00 
+  803e83:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803e89:	89 da                	mov    %ebx,%edx
+  803e8b:	48 bf 4d 67 80 00 00 	movabs $0x80674d,%rdi
+  803e92:	00 00 00 
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e9a:	48 b9 ce 1b 80 00 00 	movabs $0x801bce,%rcx
+  803ea1:	00 00 00 
+  803ea4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803ea6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ead:	eb b5                	jmp    803e64 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803eaf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803eb6:	eb ac                	jmp    803e64 <write+0x65>
+
+0000000000803eb8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803eb8:	55                   	push   %rbp
+  803eb9:	48 89 e5             	mov    %rsp,%rbp
+  803ebc:	53                   	push   %rbx
+  803ebd:	48 83 ec 18          	sub    $0x18,%rsp
+  803ec1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ec3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803ec7:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803ece:	00 00 00 
+  803ed1:	ff d0                	call   *%rax
+  803ed3:	85 c0                	test   %eax,%eax
+  803ed5:	78 0c                	js     803ee3 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803ed7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803edb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803ede:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ee7:	c9                   	leave
+  803ee8:	c3                   	ret
+
+0000000000803ee9 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  803ee9:	55                   	push   %rbp
+  803eea:	48 89 e5             	mov    %rsp,%rbp
+  803eed:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  803ef1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ef5:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+  803f01:	85 c0                	test   %eax,%eax
+  803f03:	78 07                	js     803f0c <tell+0x23>
+    return fdes->fd_offset;
+  803f05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f09:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803f0c:	c9                   	leave
+  803f0d:	c3                   	ret
+
+0000000000803f0e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803f0e:	55                   	push   %rbp
+  803f0f:	48 89 e5             	mov    %rsp,%rbp
+  803f12:	41 55                	push   %r13
+  803f14:	41 54                	push   %r12
+  803f16:	53                   	push   %rbx
+  803f17:	48 83 ec 18          	sub    $0x18,%rsp
+  803f1b:	89 fb                	mov    %edi,%ebx
+  803f1d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803f20:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f24:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803f2b:	00 00 00 
+  803f2e:	ff d0                	call   *%rax
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	78 38                	js     803f6c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803f34:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803f38:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803f3c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803f40:	48 b8 38 3a 80 00 00 	movabs $0x803a38,%rax
+  803f47:	00 00 00 
+  803f4a:	ff d0                	call   *%rax
+  803f4c:	85 c0                	test   %eax,%eax
+  803f4e:	78 1c                	js     803f6c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f50:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803f55:	74 20                	je     803f77 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803f57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f5b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f5f:	48 85 c0             	test   %rax,%rax
+  803f62:	74 47                	je     803fab <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803f64:	44 89 e6             	mov    %r12d,%esi
+  803f67:	4c 89 ef             	mov    %r13,%rdi
+  803f6a:	ff d0                	call   *%rax
+}
+  803f6c:	48 83 c4 18          	add    $0x18,%rsp
+  803f70:	5b                   	pop    %rbx
+  803f71:	41 5c                	pop    %r12
+  803f73:	41 5d                	pop    %r13
+  803f75:	5d                   	pop    %rbp
+  803f76:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803f77:	48 a1 98 85 80 00 00 	movabs 0x808598,%rax
+  803f7e:	00 00 00 
+  803f81:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f87:	89 da                	mov    %ebx,%edx
+  803f89:	48 bf 10 67 80 00 00 	movabs $0x806710,%rdi
+  803f90:	00 00 00 
+  803f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f98:	48 b9 ce 1b 80 00 00 	movabs $0x801bce,%rcx
+  803f9f:	00 00 00 
+  803fa2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803fa4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fa9:	eb c1                	jmp    803f6c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803fab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803fb0:	eb ba                	jmp    803f6c <ftruncate+0x5e>
+
+0000000000803fb2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803fb2:	55                   	push   %rbp
+  803fb3:	48 89 e5             	mov    %rsp,%rbp
+  803fb6:	41 54                	push   %r12
+  803fb8:	53                   	push   %rbx
+  803fb9:	48 83 ec 10          	sub    $0x10,%rsp
+  803fbd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803fc0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803fc4:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+  803fd0:	85 c0                	test   %eax,%eax
+  803fd2:	78 4e                	js     804022 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803fd4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803fd8:	41 8b 3c 24          	mov    (%r12),%edi
+  803fdc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803fe0:	48 b8 38 3a 80 00 00 	movabs $0x803a38,%rax
+  803fe7:	00 00 00 
+  803fea:	ff d0                	call   *%rax
+  803fec:	85 c0                	test   %eax,%eax
+  803fee:	78 32                	js     804022 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803ff0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ff4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803ff9:	74 30                	je     80402b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  803ffb:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803ffe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  804005:	00 00 00 
+    stat->st_isdir = 0;
+  804008:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80400f:	00 00 00 
+    stat->st_dev = dev;
+  804012:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  804019:	48 89 de             	mov    %rbx,%rsi
+  80401c:	4c 89 e7             	mov    %r12,%rdi
+  80401f:	ff 50 28             	call   *0x28(%rax)
+}
+  804022:	48 83 c4 10          	add    $0x10,%rsp
+  804026:	5b                   	pop    %rbx
+  804027:	41 5c                	pop    %r12
+  804029:	5d                   	pop    %rbp
+  80402a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80402b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804030:	eb f0                	jmp    804022 <fstat+0x70>
+
+0000000000804032 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  804032:	55                   	push   %rbp
+  804033:	48 89 e5             	mov    %rsp,%rbp
+  804036:	41 54                	push   %r12
+  804038:	53                   	push   %rbx
+  804039:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  804040:	41 89 fc             	mov    %edi,%r12d
+  804043:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804045:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804049:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  804050:	00 00 00 
+  804053:	ff d0                	call   *%rax
+  804055:	85 c0                	test   %eax,%eax
+  804057:	78 31                	js     80408a <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  804059:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  804060:	44 89 e7             	mov    %r12d,%edi
+  804063:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80406a:	00 00 00 
+  80406d:	ff d0                	call   *%rax
+  80406f:	85 c0                	test   %eax,%eax
+  804071:	78 17                	js     80408a <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  804073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804077:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80407a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80407d:	39 d3                	cmp    %edx,%ebx
+  80407f:	0f 4f da             	cmovg  %edx,%ebx
+  804082:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  804085:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80408a:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  804091:	5b                   	pop    %rbx
+  804092:	41 5c                	pop    %r12
+  804094:	5d                   	pop    %rbp
+  804095:	c3                   	ret
+
+0000000000804096 <seektoend>:
+{
+  804096:	55                   	push   %rbp
+  804097:	48 89 e5             	mov    %rsp,%rbp
+  80409a:	53                   	push   %rbx
+  80409b:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8040a2:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8040a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8040a8:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+  8040b4:	85 c0                	test   %eax,%eax
+  8040b6:	78 28                	js     8040e0 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8040b8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8040bf:	89 df                	mov    %ebx,%edi
+  8040c1:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  8040c8:	00 00 00 
+  8040cb:	ff d0                	call   *%rax
+  8040cd:	85 c0                	test   %eax,%eax
+  8040cf:	78 0f                	js     8040e0 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8040d1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8040d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040d8:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040e4:	c9                   	leave
+  8040e5:	c3                   	ret
+
+00000000008040e6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8040e6:	55                   	push   %rbp
+  8040e7:	48 89 e5             	mov    %rsp,%rbp
+  8040ea:	41 54                	push   %r12
+  8040ec:	53                   	push   %rbx
+  8040ed:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8040f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8040f5:	48 b8 d9 4c 80 00 00 	movabs $0x804cd9,%rax
+  8040fc:	00 00 00 
+  8040ff:	ff d0                	call   *%rax
+  804101:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  804103:	85 c0                	test   %eax,%eax
+  804105:	78 25                	js     80412c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  804107:	4c 89 e6             	mov    %r12,%rsi
+  80410a:	89 c7                	mov    %eax,%edi
+  80410c:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+  804118:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80411b:	89 df                	mov    %ebx,%edi
+  80411d:	48 b8 52 3b 80 00 00 	movabs $0x803b52,%rax
+  804124:	00 00 00 
+  804127:	ff d0                	call   *%rax
+
+    return res;
+  804129:	44 89 e3             	mov    %r12d,%ebx
+}
+  80412c:	89 d8                	mov    %ebx,%eax
+  80412e:	5b                   	pop    %rbx
+  80412f:	41 5c                	pop    %r12
+  804131:	5d                   	pop    %rbp
+  804132:	c3                   	ret
+
+0000000000804133 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  804133:	55                   	push   %rbp
+  804134:	48 89 e5             	mov    %rsp,%rbp
+  804137:	53                   	push   %rbx
+  804138:	48 83 ec 08          	sub    $0x8,%rsp
+  80413c:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80413f:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+  80414b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80414f:	0f 87 ea 00 00 00    	ja     80423f <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  804155:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  80415c:	00 00 00 
+  80415f:	80 38 00             	cmpb   $0x0,(%rax)
+  804162:	75 35                	jne    804199 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  804164:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804169:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80416e:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  804173:	bf 00 00 00 00       	mov    $0x0,%edi
+  804178:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  80417f:	00 00 00 
+  804182:	ff d0                	call   *%rax
+  804184:	85 c0                	test   %eax,%eax
+  804186:	0f 88 ba 00 00 00    	js     804246 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80418c:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  804193:	00 00 00 
+  804196:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  804199:	48 89 df             	mov    %rbx,%rdi
+  80419c:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8041ac:	48 ba 20 a0 98 00 00 	movabs $0x98a020,%rdx
+  8041b3:	00 00 00 
+  8041b6:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8041ba:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8041bd:	39 39                	cmp    %edi,(%rcx)
+  8041bf:	74 46                	je     804207 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8041c1:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8041c5:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8041cc:	00 
+  8041cd:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8041d4:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8041db:	00 
+  8041dc:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8041e3:	00 
+  8041e4:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8041eb:	00 
+  8041ec:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8041f3:	00 
+  8041f4:	89 39                	mov    %edi,(%rcx)
+  8041f6:	48 01 c6             	add    %rax,%rsi
+  8041f9:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8041fe:	48 89 c8             	mov    %rcx,%rax
+  804201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804205:	c9                   	leave
+  804206:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  804207:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80420b:	48 be 20 a0 98 00 00 	movabs $0x98a020,%rsi
+  804212:	00 00 00 
+  804215:	8b 7b 10             	mov    0x10(%rbx),%edi
+  804218:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80421c:	74 e0                	je     8041fe <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80421e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  804225:	00 
+  804226:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80422a:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  804231:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  804233:	8b 7b 10             	mov    0x10(%rbx),%edi
+  804236:	48 01 c2             	add    %rax,%rdx
+  804239:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80423d:	eb bf                	jmp    8041fe <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80423f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804244:	eb b8                	jmp    8041fe <fbuf_get+0xcb>
+            return NULL;
+  804246:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80424b:	eb b1                	jmp    8041fe <fbuf_get+0xcb>
+
+000000000080424d <fsipc_bulk>:
+fsipc_bulk(void) {
+  80424d:	55                   	push   %rbp
+  80424e:	48 89 e5             	mov    %rsp,%rbp
+  804251:	53                   	push   %rbx
+  804252:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  804256:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  80425d:	00 00 00 
+  804260:	48 8b 18             	mov    (%rax),%rbx
+  804263:	48 85 db             	test   %rbx,%rbx
+  804266:	74 16                	je     80427e <fsipc_bulk+0x31>
+    return fsipcbulk;
+  804268:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  80426f:	00 00 00 
+  804272:	48 8b 18             	mov    (%rax),%rbx
+}
+  804275:	48 89 d8             	mov    %rbx,%rax
+  804278:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80427c:	c9                   	leave
+  80427d:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80427e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804283:	ba 00 10 04 00       	mov    $0x41000,%edx
+  804288:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80428d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804292:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+  80429e:	85 c0                	test   %eax,%eax
+  8042a0:	78 d3                	js     804275 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8042a2:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8042a7:	48 a3 20 a5 98 00 00 	movabs %rax,0x98a520
+  8042ae:	00 00 00 
+  8042b1:	eb b5                	jmp    804268 <fsipc_bulk+0x1b>
+
+00000000008042b3 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8042b3:	55                   	push   %rbp
+  8042b4:	48 89 e5             	mov    %rsp,%rbp
+  8042b7:	41 57                	push   %r15
+  8042b9:	41 56                	push   %r14
+  8042bb:	41 55                	push   %r13
+  8042bd:	41 54                	push   %r12
+  8042bf:	53                   	push   %rbx
+  8042c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8042c4:	41 89 fd             	mov    %edi,%r13d
+  8042c7:	49 89 f6             	mov    %rsi,%r14
+  8042ca:	49 89 d7             	mov    %rdx,%r15
+  8042cd:	48 89 cb             	mov    %rcx,%rbx
+  8042d0:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042d3:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  8042da:	00 00 00 
+  8042dd:	83 38 00             	cmpl   $0x0,(%rax)
+  8042e0:	74 52                	je     804334 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8042e2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8042e8:	4c 89 f9             	mov    %r15,%rcx
+  8042eb:	4c 89 f2             	mov    %r14,%rdx
+  8042ee:	44 89 ee             	mov    %r13d,%esi
+  8042f1:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  8042f8:	00 00 00 
+  8042fb:	8b 38                	mov    (%rax),%edi
+  8042fd:	48 b8 6c 38 80 00 00 	movabs $0x80386c,%rax
+  804304:	00 00 00 
+  804307:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  804309:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80430e:	4c 89 e2             	mov    %r12,%rdx
+  804311:	48 89 de             	mov    %rbx,%rsi
+  804314:	bf 00 00 00 00       	mov    $0x0,%edi
+  804319:	48 b8 bc 36 80 00 00 	movabs $0x8036bc,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+}
+  804325:	48 83 c4 08          	add    $0x8,%rsp
+  804329:	5b                   	pop    %rbx
+  80432a:	41 5c                	pop    %r12
+  80432c:	41 5d                	pop    %r13
+  80432e:	41 5e                	pop    %r14
+  804330:	41 5f                	pop    %r15
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804334:	bf 03 00 00 00       	mov    $0x3,%edi
+  804339:	48 b8 0f 39 80 00 00 	movabs $0x80390f,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  804345:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  80434c:	00 00 
+  80434e:	eb 92                	jmp    8042e2 <fsipc_region+0x2f>
+
+0000000000804350 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  804350:	55                   	push   %rbp
+  804351:	48 89 e5             	mov    %rsp,%rbp
+  804354:	41 57                	push   %r15
+  804356:	41 56                	push   %r14
+  804358:	41 55                	push   %r13
+  80435a:	41 54                	push   %r12
+  80435c:	53                   	push   %rbx
+  80435d:	48 83 ec 28          	sub    $0x28,%rsp
+  804361:	49 89 ff             	mov    %rdi,%r15
+  804364:	49 89 f6             	mov    %rsi,%r14
+  804367:	48 89 d3             	mov    %rdx,%rbx
+  80436a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80436e:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  804371:	48 b8 4d 42 80 00 00 	movabs $0x80424d,%rax
+  804378:	00 00 00 
+  80437b:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80437d:	48 85 c0             	test   %rax,%rax
+  804380:	0f 84 cc 00 00 00    	je     804452 <devfile_write_direct+0x102>
+  804386:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  804389:	48 85 db             	test   %rbx,%rbx
+  80438c:	0f 84 ba 00 00 00    	je     80444c <devfile_write_direct+0xfc>
+    size_t i = 0;
+  804392:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  804398:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80439f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8043a3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8043a7:	4c 29 e3             	sub    %r12,%rbx
+  8043aa:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8043af:	48 39 c3             	cmp    %rax,%rbx
+  8043b2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8043b6:	48 89 da             	mov    %rbx,%rdx
+  8043b9:	4c 89 f6             	mov    %r14,%rsi
+  8043bc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8043c0:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8043c7:	00 00 00 
+  8043ca:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8043cc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8043d0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8043d4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8043d7:	44 01 e0             	add    %r12d,%eax
+  8043da:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8043de:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8043e2:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8043e9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8043f0:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8043f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8043fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804402:	4c 89 ee             	mov    %r13,%rsi
+  804405:	bf 04 00 00 00       	mov    $0x4,%edi
+  80440a:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  804411:	00 00 00 
+  804414:	ff d0                	call   *%rax
+        if (res < 0)
+  804416:	85 c0                	test   %eax,%eax
+  804418:	78 29                	js     804443 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80441a:	74 2b                	je     804447 <devfile_write_direct+0xf7>
+        i += res;
+  80441c:	48 98                	cltq
+  80441e:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  804421:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  804424:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804428:	49 39 c4             	cmp    %rax,%r12
+  80442b:	0f 82 72 ff ff ff    	jb     8043a3 <devfile_write_direct+0x53>
+    return i;
+  804431:	4c 89 e0             	mov    %r12,%rax
+}
+  804434:	48 83 c4 28          	add    $0x28,%rsp
+  804438:	5b                   	pop    %rbx
+  804439:	41 5c                	pop    %r12
+  80443b:	41 5d                	pop    %r13
+  80443d:	41 5e                	pop    %r14
+  80443f:	41 5f                	pop    %r15
+  804441:	5d                   	pop    %rbp
+  804442:	c3                   	ret
+            return res;
+  804443:	48 98                	cltq
+  804445:	eb ed                	jmp    804434 <devfile_write_direct+0xe4>
+            return i;
+  804447:	4c 89 e0             	mov    %r12,%rax
+  80444a:	eb e8                	jmp    804434 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80444c:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  804450:	eb df                	jmp    804431 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  804452:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  804459:	eb d9                	jmp    804434 <devfile_write_direct+0xe4>
+
+000000000080445b <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80445b:	55                   	push   %rbp
+  80445c:	48 89 e5             	mov    %rsp,%rbp
+  80445f:	41 56                	push   %r14
+  804461:	41 55                	push   %r13
+  804463:	41 54                	push   %r12
+  804465:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  804466:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80446a:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80446e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804473:	4d 39 ee             	cmp    %r13,%r14
+  804476:	0f 84 99 00 00 00    	je     804515 <fbuf_flush+0xba>
+  80447c:	49 89 fc             	mov    %rdi,%r12
+  80447f:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  804482:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  804485:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  804489:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  804490:	00 00 00 
+  804493:	ff d0                	call   *%rax
+  804495:	48 89 c2             	mov    %rax,%rdx
+  804498:	48 c1 e2 04          	shl    $0x4,%rdx
+  80449c:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8044a0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8044a4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8044a9:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8044ac:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8044b0:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8044b7:	00 
+  8044b8:	44 89 f1             	mov    %r14d,%ecx
+  8044bb:	4c 89 ea             	mov    %r13,%rdx
+  8044be:	4c 89 e7             	mov    %r12,%rdi
+  8044c1:	48 b8 50 43 80 00 00 	movabs $0x804350,%rax
+  8044c8:	00 00 00 
+  8044cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044cd:	48 85 c0             	test   %rax,%rax
+  8044d0:	78 43                	js     804515 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8044d2:	4c 39 e8             	cmp    %r13,%rax
+  8044d5:	72 47                	jb     80451e <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8044d7:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8044dc:	83 c0 01             	add    $0x1,%eax
+  8044df:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8044e4:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8044e7:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8044eb:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8044ef:	72 0f                	jb     804500 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8044f1:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8044f5:	48 39 c2             	cmp    %rax,%rdx
+  8044f8:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8044fc:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  804500:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  804507:	00 
+  804508:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80450f:	00 
+    return 0;
+  804510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804515:	5b                   	pop    %rbx
+  804516:	41 5c                	pop    %r12
+  804518:	41 5d                	pop    %r13
+  80451a:	41 5e                	pop    %r14
+  80451c:	5d                   	pop    %rbp
+  80451d:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80451e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804523:	eb f0                	jmp    804515 <fbuf_flush+0xba>
+
+0000000000804525 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  804525:	55                   	push   %rbp
+  804526:	48 89 e5             	mov    %rsp,%rbp
+  804529:	53                   	push   %rbx
+  80452a:	48 83 ec 08          	sub    $0x8,%rsp
+  80452e:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  804531:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  804538:	00 00 00 
+  80453b:	ff d0                	call   *%rax
+  80453d:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  804540:	b8 00 00 00 00       	mov    $0x0,%eax
+  804545:	48 85 f6             	test   %rsi,%rsi
+  804548:	74 0f                	je     804559 <devfile_sync+0x34>
+  80454a:	48 89 df             	mov    %rbx,%rdi
+  80454d:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  804554:	00 00 00 
+  804557:	ff d0                	call   *%rax
+}
+  804559:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80455d:	c9                   	leave
+  80455e:	c3                   	ret
+
+000000000080455f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80455f:	55                   	push   %rbp
+  804560:	48 89 e5             	mov    %rsp,%rbp
+  804563:	48 83 ec 10          	sub    $0x10,%rsp
+  804567:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80456a:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  804571:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  804572:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  804576:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80457b:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  804582:	00 00 00 
+  804585:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  80458c:	00 00 00 
+  80458f:	ff d0                	call   *%rax
+}
+  804591:	c9                   	leave
+  804592:	c3                   	ret
+
+0000000000804593 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804593:	55                   	push   %rbp
+  804594:	48 89 e5             	mov    %rsp,%rbp
+  804597:	41 54                	push   %r12
+  804599:	53                   	push   %rbx
+  80459a:	48 89 fb             	mov    %rdi,%rbx
+  80459d:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8045a0:	48 b8 25 45 80 00 00 	movabs $0x804525,%rax
+  8045a7:	00 00 00 
+  8045aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045ac:	85 c0                	test   %eax,%eax
+  8045ae:	78 63                	js     804613 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8045b0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8045b3:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8045ba:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8045bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8045c1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8045c6:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  8045cd:	00 00 00 
+  8045d0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045d2:	85 c0                	test   %eax,%eax
+  8045d4:	78 3d                	js     804613 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8045d6:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  8045dd:	00 00 00 
+  8045e0:	48 89 de             	mov    %rbx,%rsi
+  8045e3:	4c 89 e7             	mov    %r12,%rdi
+  8045e6:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8045f2:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8045f8:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8045ff:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804600:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  804606:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80460d:	00 
+
+    return 0;
+  80460e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804613:	5b                   	pop    %rbx
+  804614:	41 5c                	pop    %r12
+  804616:	5d                   	pop    %rbp
+  804617:	c3                   	ret
+
+0000000000804618 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  804618:	55                   	push   %rbp
+  804619:	48 89 e5             	mov    %rsp,%rbp
+  80461c:	41 54                	push   %r12
+  80461e:	53                   	push   %rbx
+  80461f:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  804622:	48 b8 25 45 80 00 00 	movabs $0x804525,%rax
+  804629:	00 00 00 
+  80462c:	ff d0                	call   *%rax
+  80462e:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  804631:	48 89 df             	mov    %rbx,%rdi
+  804634:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  80463b:	00 00 00 
+  80463e:	ff d0                	call   *%rax
+  804640:	48 83 f8 1f          	cmp    $0x1f,%rax
+  804644:	76 2e                	jbe    804674 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  804646:	8b 43 0c             	mov    0xc(%rbx),%eax
+  804649:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  804650:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  804652:	be 00 00 00 00       	mov    $0x0,%esi
+  804657:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80465c:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  804663:	00 00 00 
+  804666:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  804668:	45 85 e4             	test   %r12d,%r12d
+  80466b:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80466f:	5b                   	pop    %rbx
+  804670:	41 5c                	pop    %r12
+  804672:	5d                   	pop    %rbp
+  804673:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  804674:	48 89 df             	mov    %rbx,%rdi
+  804677:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  80467e:	00 00 00 
+  804681:	ff d0                	call   *%rax
+  804683:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  804687:	48 b8 20 a0 98 00 00 	movabs $0x98a020,%rax
+  80468e:	00 00 00 
+  804691:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  804698:	48 89 df             	mov    %rbx,%rdi
+  80469b:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  8046a2:	00 00 00 
+  8046a5:	ff d0                	call   *%rax
+  8046a7:	48 89 c6             	mov    %rax,%rsi
+  8046aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046b4:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  8046bb:	00 00 00 
+  8046be:	ff d0                	call   *%rax
+  8046c0:	eb 84                	jmp    804646 <devfile_flush+0x2e>
+
+00000000008046c2 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8046c2:	55                   	push   %rbp
+  8046c3:	48 89 e5             	mov    %rsp,%rbp
+  8046c6:	41 55                	push   %r13
+  8046c8:	41 54                	push   %r12
+  8046ca:	53                   	push   %rbx
+  8046cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8046cf:	48 89 fb             	mov    %rdi,%rbx
+  8046d2:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  8046d5:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8046dc:	00 00 00 
+  8046df:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8046e1:	48 85 c0             	test   %rax,%rax
+  8046e4:	74 51                	je     804737 <devfile_trunc+0x75>
+  8046e6:	49 89 c4             	mov    %rax,%r12
+  8046e9:	48 89 c6             	mov    %rax,%rsi
+  8046ec:	48 89 df             	mov    %rbx,%rdi
+  8046ef:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  8046f6:	00 00 00 
+  8046f9:	ff d0                	call   *%rax
+  8046fb:	85 c0                	test   %eax,%eax
+  8046fd:	78 2d                	js     80472c <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8046ff:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  804706:	00 00 00 
+  804709:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80470c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80470e:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  804712:	be 00 00 00 00       	mov    $0x0,%esi
+  804717:	bf 02 00 00 00       	mov    $0x2,%edi
+  80471c:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  804723:	00 00 00 
+  804726:	ff d0                	call   *%rax
+    if (res >= 0) {
+  804728:	85 c0                	test   %eax,%eax
+  80472a:	79 3e                	jns    80476a <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80472c:	48 83 c4 08          	add    $0x8,%rsp
+  804730:	5b                   	pop    %rbx
+  804731:	41 5c                	pop    %r12
+  804733:	41 5d                	pop    %r13
+  804735:	5d                   	pop    %rbp
+  804736:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804737:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80473e:	00 00 00 
+  804741:	8b 53 0c             	mov    0xc(%rbx),%edx
+  804744:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  804746:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80474a:	be 00 00 00 00       	mov    $0x0,%esi
+  80474f:	bf 02 00 00 00       	mov    $0x2,%edi
+  804754:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  80475b:	00 00 00 
+  80475e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  804760:	85 c0                	test   %eax,%eax
+  804762:	78 c8                	js     80472c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  804764:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  804768:	eb c2                	jmp    80472c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80476a:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  80476d:	8d 51 01             	lea    0x1(%rcx),%edx
+  804770:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  804773:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  804778:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80477f:	00 00 
+  804781:	eb a9                	jmp    80472c <devfile_trunc+0x6a>
+
+0000000000804783 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804783:	55                   	push   %rbp
+  804784:	48 89 e5             	mov    %rsp,%rbp
+  804787:	41 57                	push   %r15
+  804789:	41 56                	push   %r14
+  80478b:	41 55                	push   %r13
+  80478d:	41 54                	push   %r12
+  80478f:	53                   	push   %rbx
+  804790:	48 83 ec 28          	sub    $0x28,%rsp
+  804794:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804798:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80479c:	49 89 d7             	mov    %rdx,%r15
+  80479f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8047a3:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8047aa:	00 00 00 
+  8047ad:	ff d0                	call   *%rax
+  8047af:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8047b2:	48 85 c0             	test   %rax,%rax
+  8047b5:	74 31                	je     8047e8 <devfile_write+0x65>
+  8047b7:	4c 89 f8             	mov    %r15,%rax
+  8047ba:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8047c1:	77 25                	ja     8047e8 <devfile_write+0x65>
+    size_t i = 0;
+  8047c3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8047c9:	48 85 c0             	test   %rax,%rax
+  8047cc:	0f 85 64 01 00 00    	jne    804936 <devfile_write+0x1b3>
+    size_t i = 0;
+  8047d2:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  8047d6:	4c 89 f8             	mov    %r15,%rax
+}
+  8047d9:	48 83 c4 28          	add    $0x28,%rsp
+  8047dd:	5b                   	pop    %rbx
+  8047de:	41 5c                	pop    %r12
+  8047e0:	41 5d                	pop    %r13
+  8047e2:	41 5e                	pop    %r14
+  8047e4:	41 5f                	pop    %r15
+  8047e6:	5d                   	pop    %rbp
+  8047e7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8047e8:	48 85 db             	test   %rbx,%rbx
+  8047eb:	74 5b                	je     804848 <devfile_write+0xc5>
+  8047ed:	48 89 de             	mov    %rbx,%rsi
+  8047f0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8047f4:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  8047fb:	00 00 00 
+  8047fe:	ff d0                	call   *%rax
+  804800:	85 c0                	test   %eax,%eax
+  804802:	78 40                	js     804844 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  804804:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804808:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80480b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80480f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  804813:	48 b8 50 43 80 00 00 	movabs $0x804350,%rax
+  80481a:	00 00 00 
+  80481d:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80481f:	48 85 c0             	test   %rax,%rax
+  804822:	7e b5                	jle    8047d9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  804824:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  804828:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80482b:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80482e:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  804831:	8d 51 01             	lea    0x1(%rcx),%edx
+  804834:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  804837:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80483a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  804841:	00 
+  804842:	eb 95                	jmp    8047d9 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  804844:	48 98                	cltq
+  804846:	eb 91                	jmp    8047d9 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  804848:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80484c:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80484f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804853:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  804857:	48 89 df             	mov    %rbx,%rdi
+  80485a:	48 b8 50 43 80 00 00 	movabs $0x804350,%rax
+  804861:	00 00 00 
+  804864:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  804866:	48 85 c0             	test   %rax,%rax
+  804869:	0f 8e 6a ff ff ff    	jle    8047d9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80486f:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  804872:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  804876:	e9 5e ff ff ff       	jmp    8047d9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80487b:	48 98                	cltq
+  80487d:	4d 85 ff             	test   %r15,%r15
+  804880:	49 0f 45 c7          	cmovne %r15,%rax
+  804884:	e9 50 ff ff ff       	jmp    8047d9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  804889:	48 89 de             	mov    %rbx,%rsi
+  80488c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804890:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  804897:	00 00 00 
+  80489a:	ff d0                	call   *%rax
+  80489c:	85 c0                	test   %eax,%eax
+  80489e:	0f 88 2b 01 00 00    	js     8049cf <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8048a4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8048a8:	4c 01 f8             	add    %r15,%rax
+  8048ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8048af:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8048b3:	48 b9 5f 39 80 00 00 	movabs $0x80395f,%rcx
+  8048ba:	00 00 00 
+  8048bd:	ff d1                	call   *%rcx
+  8048bf:	48 89 c2             	mov    %rax,%rdx
+  8048c2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8048c6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8048ca:	48 c1 e0 0c          	shl    $0xc,%rax
+  8048ce:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8048d3:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8048d6:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8048dd:	00 
+  8048de:	4c 89 ea             	mov    %r13,%rdx
+  8048e1:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8048e5:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8048ec:	00 00 00 
+  8048ef:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8048f1:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8048f5:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8048f9:	48 39 c2             	cmp    %rax,%rdx
+  8048fc:	0f 84 db 00 00 00    	je     8049dd <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  804902:	4c 39 e2             	cmp    %r12,%rdx
+  804905:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  804909:	4d 01 ec             	add    %r13,%r12
+  80490c:	49 39 c4             	cmp    %rax,%r12
+  80490f:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  804913:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  804917:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80491b:	45 01 ee             	add    %r13d,%r14d
+  80491e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804922:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  804926:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  804929:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80492d:	49 39 c7             	cmp    %rax,%r15
+  804930:	0f 83 a0 fe ff ff    	jae    8047d6 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  804936:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80493a:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80493e:	8b 43 08             	mov    0x8(%rbx),%eax
+  804941:	44 39 f0             	cmp    %r14d,%eax
+  804944:	7f 10                	jg     804956 <devfile_write+0x1d3>
+  804946:	48 98                	cltq
+  804948:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80494e:	49 63 d6             	movslq %r14d,%rdx
+  804951:	48 39 d0             	cmp    %rdx,%rax
+  804954:	7d 2d                	jge    804983 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  804956:	48 89 de             	mov    %rbx,%rsi
+  804959:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80495d:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  804964:	00 00 00 
+  804967:	ff d0                	call   *%rax
+  804969:	85 c0                	test   %eax,%eax
+  80496b:	0f 88 0a ff ff ff    	js     80487b <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  804971:	44 89 f0             	mov    %r14d,%eax
+  804974:	66 b8 00 00          	mov    $0x0,%ax
+  804978:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80497b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  804982:	00 
+        size_t off = pos - fb->fb_base;
+  804983:	45 89 f4             	mov    %r14d,%r12d
+  804986:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80498a:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80498d:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  804991:	4d 29 fd             	sub    %r15,%r13
+  804994:	b8 00 00 01 00       	mov    $0x10000,%eax
+  804999:	4c 29 e0             	sub    %r12,%rax
+  80499c:	49 39 c5             	cmp    %rax,%r13
+  80499f:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8049a3:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8049a7:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8049ab:	48 39 c2             	cmp    %rax,%rdx
+  8049ae:	0f 84 f0 fe ff ff    	je     8048a4 <devfile_write+0x121>
+  8049b4:	4c 39 e0             	cmp    %r12,%rax
+  8049b7:	0f 82 cc fe ff ff    	jb     804889 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8049bd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8049c1:	48 39 d0             	cmp    %rdx,%rax
+  8049c4:	0f 83 da fe ff ff    	jae    8048a4 <devfile_write+0x121>
+  8049ca:	e9 ba fe ff ff       	jmp    804889 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8049cf:	48 98                	cltq
+  8049d1:	4d 85 ff             	test   %r15,%r15
+  8049d4:	49 0f 45 c7          	cmovne %r15,%rax
+  8049d8:	e9 fc fd ff ff       	jmp    8047d9 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8049dd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8049e1:	4c 89 e2             	mov    %r12,%rdx
+  8049e4:	e9 2a ff ff ff       	jmp    804913 <devfile_write+0x190>
+
+00000000008049e9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8049e9:	55                   	push   %rbp
+  8049ea:	48 89 e5             	mov    %rsp,%rbp
+  8049ed:	41 57                	push   %r15
+  8049ef:	41 56                	push   %r14
+  8049f1:	41 55                	push   %r13
+  8049f3:	41 54                	push   %r12
+  8049f5:	53                   	push   %rbx
+  8049f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8049fa:	49 89 ff             	mov    %rdi,%r15
+  8049fd:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  804a01:	48 89 d3             	mov    %rdx,%rbx
+  804a04:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  804a08:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  804a0f:	00 00 00 
+  804a12:	ff d0                	call   *%rax
+  804a14:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  804a17:	48 85 c0             	test   %rax,%rax
+  804a1a:	74 0d                	je     804a29 <devfile_read+0x40>
+  804a1c:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  804a23:	0f 86 1a 01 00 00    	jbe    804b43 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  804a29:	4d 85 e4             	test   %r12,%r12
+  804a2c:	74 1a                	je     804a48 <devfile_read+0x5f>
+  804a2e:	4c 89 e6             	mov    %r12,%rsi
+  804a31:	4c 89 ff             	mov    %r15,%rdi
+  804a34:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  804a3b:	00 00 00 
+  804a3e:	ff d0                	call   *%rax
+  804a40:	85 c0                	test   %eax,%eax
+  804a42:	0f 88 e8 00 00 00    	js     804b30 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  804a48:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  804a4c:	48 b8 4d 42 80 00 00 	movabs $0x80424d,%rax
+  804a53:	00 00 00 
+  804a56:	ff d0                	call   *%rax
+  804a58:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  804a5b:	48 85 c0             	test   %rax,%rax
+  804a5e:	0f 84 69 02 00 00    	je     804ccd <devfile_read+0x2e4>
+    while (i < n) {
+  804a64:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804a69:	0f 84 ce 00 00 00    	je     804b3d <devfile_read+0x154>
+    size_t i = 0;
+  804a6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  804a74:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  804a7b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804a7f:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  804a83:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  804a87:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a8b:	48 29 da             	sub    %rbx,%rdx
+  804a8e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  804a93:	48 39 c2             	cmp    %rax,%rdx
+  804a96:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  804a9a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  804a9e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  804aa2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804aa5:	01 d8                	add    %ebx,%eax
+  804aa7:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  804aab:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  804aaf:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  804ab6:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  804abd:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  804ac4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804acf:	4c 89 ee             	mov    %r13,%rsi
+  804ad2:	bf 03 00 00 00       	mov    $0x3,%edi
+  804ad7:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  804ade:	00 00 00 
+  804ae1:	ff d0                	call   *%rax
+        if (res < 0)
+  804ae3:	85 c0                	test   %eax,%eax
+  804ae5:	78 4d                	js     804b34 <devfile_read+0x14b>
+        if (res == 0)
+  804ae7:	74 4f                	je     804b38 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  804ae9:	4c 63 e0             	movslq %eax,%r12
+  804aec:	4c 89 e2             	mov    %r12,%rdx
+  804aef:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804af3:	4c 89 f7             	mov    %r14,%rdi
+  804af6:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  804afd:	00 00 00 
+  804b00:	ff d0                	call   *%rax
+        i += res;
+  804b02:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  804b05:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  804b08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b0c:	48 39 c3             	cmp    %rax,%rbx
+  804b0f:	0f 82 72 ff ff ff    	jb     804a87 <devfile_read+0x9e>
+    return i;
+  804b15:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  804b18:	48 85 c0             	test   %rax,%rax
+  804b1b:	7e 04                	jle    804b21 <devfile_read+0x138>
+  804b1d:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  804b21:	48 83 c4 28          	add    $0x28,%rsp
+  804b25:	5b                   	pop    %rbx
+  804b26:	41 5c                	pop    %r12
+  804b28:	41 5d                	pop    %r13
+  804b2a:	41 5e                	pop    %r14
+  804b2c:	41 5f                	pop    %r15
+  804b2e:	5d                   	pop    %rbp
+  804b2f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  804b30:	48 98                	cltq
+  804b32:	eb ed                	jmp    804b21 <devfile_read+0x138>
+            return res;
+  804b34:	48 98                	cltq
+  804b36:	eb e9                	jmp    804b21 <devfile_read+0x138>
+            return i;
+  804b38:	48 89 d8             	mov    %rbx,%rax
+  804b3b:	eb db                	jmp    804b18 <devfile_read+0x12f>
+    size_t i = 0;
+  804b3d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804b41:	eb d2                	jmp    804b15 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  804b43:	48 89 c6             	mov    %rax,%rsi
+  804b46:	4c 89 ff             	mov    %r15,%rdi
+  804b49:	48 b8 5b 44 80 00 00 	movabs $0x80445b,%rax
+  804b50:	00 00 00 
+  804b53:	ff d0                	call   *%rax
+  804b55:	85 c0                	test   %eax,%eax
+  804b57:	78 40                	js     804b99 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  804b59:	4c 89 ff             	mov    %r15,%rdi
+  804b5c:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  804b63:	00 00 00 
+  804b66:	ff d0                	call   *%rax
+  804b68:	48 89 c2             	mov    %rax,%rdx
+  804b6b:	48 c1 e2 04          	shl    $0x4,%rdx
+  804b6f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  804b73:	48 c1 e0 0c          	shl    $0xc,%rax
+  804b77:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  804b7c:	48 01 d0             	add    %rdx,%rax
+  804b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  804b83:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804b88:	0f 84 33 01 00 00    	je     804cc1 <devfile_read+0x2d8>
+    size_t i = 0;
+  804b8e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  804b94:	e9 f5 00 00 00       	jmp    804c8e <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  804b99:	48 98                	cltq
+  804b9b:	eb 84                	jmp    804b21 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  804b9d:	44 89 e8             	mov    %r13d,%eax
+  804ba0:	66 b8 00 00          	mov    $0x0,%ax
+  804ba4:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  804ba9:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  804bb0:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  804bb2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  804bb6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804bba:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  804bbc:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  804bc1:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  804bc4:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  804bcb:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  804bcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804bd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bd7:	ba 00 10 01 00       	mov    $0x11000,%edx
+  804bdc:	bf 03 00 00 00       	mov    $0x3,%edi
+  804be1:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  804be8:	00 00 00 
+  804beb:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  804bed:	85 c0                	test   %eax,%eax
+  804bef:	0f 88 be 00 00 00    	js     804cb3 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  804bf5:	48 63 d0             	movslq %eax,%rdx
+  804bf8:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  804bfd:	41 03 44 24 08       	add    0x8(%r12),%eax
+  804c02:	44 39 e8             	cmp    %r13d,%eax
+  804c05:	0f 8e ba 00 00 00    	jle    804cc5 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  804c0b:	49 63 c5             	movslq %r13d,%rax
+  804c0e:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  804c13:	48 29 c3             	sub    %rax,%rbx
+  804c16:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  804c1b:	48 01 c3             	add    %rax,%rbx
+  804c1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c22:	4c 29 f0             	sub    %r14,%rax
+  804c25:	48 39 c3             	cmp    %rax,%rbx
+  804c28:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  804c2c:	4c 89 ff             	mov    %r15,%rdi
+  804c2f:	48 b9 5f 39 80 00 00 	movabs $0x80395f,%rcx
+  804c36:	00 00 00 
+  804c39:	ff d1                	call   *%rcx
+  804c3b:	48 89 c2             	mov    %rax,%rdx
+  804c3e:	48 c1 e2 04          	shl    $0x4,%rdx
+  804c42:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  804c46:	48 c1 e0 0c          	shl    $0xc,%rax
+  804c4a:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  804c4f:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  804c52:	44 89 ea             	mov    %r13d,%edx
+  804c55:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  804c5a:	48 63 d2             	movslq %edx,%rdx
+  804c5d:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  804c64:	00 
+  804c65:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  804c69:	4c 01 f7             	add    %r14,%rdi
+  804c6c:	48 89 da             	mov    %rbx,%rdx
+  804c6f:	48 b9 3b 29 80 00 00 	movabs $0x80293b,%rcx
+  804c76:	00 00 00 
+  804c79:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  804c7b:	41 01 dd             	add    %ebx,%r13d
+  804c7e:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  804c82:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  804c85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c89:	49 39 c6             	cmp    %rax,%r14
+  804c8c:	73 37                	jae    804cc5 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  804c8e:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  804c92:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  804c97:	44 39 e8             	cmp    %r13d,%eax
+  804c9a:	0f 8f fd fe ff ff    	jg     804b9d <devfile_read+0x1b4>
+  804ca0:	41 03 44 24 10       	add    0x10(%r12),%eax
+  804ca5:	44 39 e8             	cmp    %r13d,%eax
+  804ca8:	0f 8f 5d ff ff ff    	jg     804c0b <devfile_read+0x222>
+  804cae:	e9 ea fe ff ff       	jmp    804b9d <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  804cb3:	48 98                	cltq
+  804cb5:	4d 85 f6             	test   %r14,%r14
+  804cb8:	49 0f 45 c6          	cmovne %r14,%rax
+  804cbc:	e9 60 fe ff ff       	jmp    804b21 <devfile_read+0x138>
+    size_t i = 0;
+  804cc1:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  804cc5:	4c 89 f0             	mov    %r14,%rax
+  804cc8:	e9 54 fe ff ff       	jmp    804b21 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  804ccd:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  804cd4:	e9 48 fe ff ff       	jmp    804b21 <devfile_read+0x138>
+
+0000000000804cd9 <open>:
+open(const char *path, int mode) {
+  804cd9:	55                   	push   %rbp
+  804cda:	48 89 e5             	mov    %rsp,%rbp
+  804cdd:	41 55                	push   %r13
+  804cdf:	41 54                	push   %r12
+  804ce1:	53                   	push   %rbx
+  804ce2:	48 83 ec 18          	sub    $0x18,%rsp
+  804ce6:	49 89 fc             	mov    %rdi,%r12
+  804ce9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804cec:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  804cf3:	00 00 00 
+  804cf6:	ff d0                	call   *%rax
+  804cf8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804cfe:	0f 87 8a 00 00 00    	ja     804d8e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804d04:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804d08:	48 b8 8d 39 80 00 00 	movabs $0x80398d,%rax
+  804d0f:	00 00 00 
+  804d12:	ff d0                	call   *%rax
+  804d14:	89 c3                	mov    %eax,%ebx
+  804d16:	85 c0                	test   %eax,%eax
+  804d18:	78 50                	js     804d6a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  804d1a:	4c 89 e6             	mov    %r12,%rsi
+  804d1d:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  804d24:	00 00 00 
+  804d27:	48 89 df             	mov    %rbx,%rdi
+  804d2a:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  804d31:	00 00 00 
+  804d34:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804d36:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804d3d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804d41:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d46:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  804d4d:	00 00 00 
+  804d50:	ff d0                	call   *%rax
+  804d52:	89 c3                	mov    %eax,%ebx
+  804d54:	85 c0                	test   %eax,%eax
+  804d56:	78 1f                	js     804d77 <open+0x9e>
+    return fd2num(fd);
+  804d58:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804d5c:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  804d63:	00 00 00 
+  804d66:	ff d0                	call   *%rax
+  804d68:	89 c3                	mov    %eax,%ebx
+}
+  804d6a:	89 d8                	mov    %ebx,%eax
+  804d6c:	48 83 c4 18          	add    $0x18,%rsp
+  804d70:	5b                   	pop    %rbx
+  804d71:	41 5c                	pop    %r12
+  804d73:	41 5d                	pop    %r13
+  804d75:	5d                   	pop    %rbp
+  804d76:	c3                   	ret
+        fd_close(fd, 0);
+  804d77:	be 00 00 00 00       	mov    $0x0,%esi
+  804d7c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804d80:	48 b8 a8 3a 80 00 00 	movabs $0x803aa8,%rax
+  804d87:	00 00 00 
+  804d8a:	ff d0                	call   *%rax
+        return res;
+  804d8c:	eb dc                	jmp    804d6a <open+0x91>
+        return -E_BAD_PATH;
+  804d8e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804d93:	eb d5                	jmp    804d6a <open+0x91>
+
+0000000000804d95 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  804d95:	55                   	push   %rbp
+  804d96:	48 89 e5             	mov    %rsp,%rbp
+  804d99:	41 57                	push   %r15
+  804d9b:	41 56                	push   %r14
+  804d9d:	41 55                	push   %r13
+  804d9f:	41 54                	push   %r12
+  804da1:	53                   	push   %rbx
+  804da2:	48 83 ec 18          	sub    $0x18,%rsp
+  804da6:	41 89 f6             	mov    %esi,%r14d
+  804da9:	49 89 d7             	mov    %rdx,%r15
+  804dac:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804daf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804db3:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  804dba:	00 00 00 
+  804dbd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804dbf:	85 c0                	test   %eax,%eax
+  804dc1:	0f 88 db 00 00 00    	js     804ea2 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804dc7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804dcb:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804dd2:	00 00 00 
+  804dd5:	8b 00                	mov    (%rax),%eax
+  804dd7:	39 07                	cmp    %eax,(%rdi)
+  804dd9:	0f 85 db 00 00 00    	jne    804eba <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  804ddf:	45 85 f6             	test   %r14d,%r14d
+  804de2:	0f 88 db 00 00 00    	js     804ec3 <fmap+0x12e>
+  804de8:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  804def:	0f 85 d7 00 00 00    	jne    804ecc <fmap+0x137>
+  804df5:	4c 89 fb             	mov    %r15,%rbx
+  804df8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  804dfe:	0f 85 d1 00 00 00    	jne    804ed5 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804e04:	48 b8 25 45 80 00 00 	movabs $0x804525,%rax
+  804e0b:	00 00 00 
+  804e0e:	ff d0                	call   *%rax
+  804e10:	85 c0                	test   %eax,%eax
+  804e12:	0f 88 8e 00 00 00    	js     804ea6 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804e18:	49 bc 00 90 98 00 00 	movabs $0x989000,%r12
+  804e1f:	00 00 00 
+    while (i < n) {
+  804e22:	4d 85 ed             	test   %r13,%r13
+  804e25:	0f 84 8a 00 00 00    	je     804eb5 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  804e2b:	4c 89 ea             	mov    %r13,%rdx
+  804e2e:	48 29 da             	sub    %rbx,%rdx
+  804e31:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  804e38:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  804e3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804e42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e46:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e49:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  804e4d:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  804e51:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  804e56:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  804e5b:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  804e5f:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  804e63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e68:	4c 89 e6             	mov    %r12,%rsi
+  804e6b:	bf 09 00 00 00       	mov    $0x9,%edi
+  804e70:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  804e77:	00 00 00 
+  804e7a:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  804e7c:	85 c0                	test   %eax,%eax
+  804e7e:	78 2a                	js     804eaa <fmap+0x115>
+        i += res;
+  804e80:	48 98                	cltq
+  804e82:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  804e85:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  804e89:	72 05                	jb     804e90 <fmap+0xfb>
+    while (i < n) {
+  804e8b:	4c 39 eb             	cmp    %r13,%rbx
+  804e8e:	72 9b                	jb     804e2b <fmap+0x96>
+    }
+    return i;
+  804e90:	48 89 d8             	mov    %rbx,%rax
+}
+  804e93:	48 83 c4 18          	add    $0x18,%rsp
+  804e97:	5b                   	pop    %rbx
+  804e98:	41 5c                	pop    %r12
+  804e9a:	41 5d                	pop    %r13
+  804e9c:	41 5e                	pop    %r14
+  804e9e:	41 5f                	pop    %r15
+  804ea0:	5d                   	pop    %rbp
+  804ea1:	c3                   	ret
+    if (res < 0) return res;
+  804ea2:	48 98                	cltq
+  804ea4:	eb ed                	jmp    804e93 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804ea6:	48 98                	cltq
+  804ea8:	eb e9                	jmp    804e93 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  804eaa:	48 98                	cltq
+  804eac:	48 85 db             	test   %rbx,%rbx
+  804eaf:	48 0f 45 c3          	cmovne %rbx,%rax
+  804eb3:	eb de                	jmp    804e93 <fmap+0xfe>
+    size_t i = 0;
+  804eb5:	4c 89 eb             	mov    %r13,%rbx
+  804eb8:	eb d6                	jmp    804e90 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804eba:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  804ec1:	eb d0                	jmp    804e93 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  804ec3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804eca:	eb c7                	jmp    804e93 <fmap+0xfe>
+  804ecc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804ed3:	eb be                	jmp    804e93 <fmap+0xfe>
+  804ed5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804edc:	eb b5                	jmp    804e93 <fmap+0xfe>
+
+0000000000804ede <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  804ede:	55                   	push   %rbp
+  804edf:	48 89 e5             	mov    %rsp,%rbp
+  804ee2:	41 56                	push   %r14
+  804ee4:	41 55                	push   %r13
+  804ee6:	41 54                	push   %r12
+  804ee8:	53                   	push   %rbx
+  804ee9:	48 83 ec 10          	sub    $0x10,%rsp
+  804eed:	89 fb                	mov    %edi,%ebx
+  804eef:	41 89 f4             	mov    %esi,%r12d
+  804ef2:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804ef5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804ef9:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  804f00:	00 00 00 
+  804f03:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804f05:	85 c0                	test   %eax,%eax
+  804f07:	78 63                	js     804f6c <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  804f09:	45 85 e4             	test   %r12d,%r12d
+  804f0c:	0f 88 80 00 00 00    	js     804f92 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  804f12:	45 89 e6             	mov    %r12d,%r14d
+  804f15:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  804f1c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f20:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  804f27:	00 00 00 
+  804f2a:	ff d0                	call   *%rax
+  804f2c:	48 89 c2             	mov    %rax,%rdx
+  804f2f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804f34:	44 89 f6             	mov    %r14d,%esi
+  804f37:	89 df                	mov    %ebx,%edi
+  804f39:	48 b8 95 4d 80 00 00 	movabs $0x804d95,%rax
+  804f40:	00 00 00 
+  804f43:	ff d0                	call   *%rax
+  804f45:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  804f48:	45 29 f4             	sub    %r14d,%r12d
+  804f4b:	4d 63 f4             	movslq %r12d,%r14
+  804f4e:	49 39 c6             	cmp    %rax,%r14
+  804f51:	7c 1d                	jl     804f70 <read_map+0x92>
+  804f53:	48 85 c0             	test   %rax,%rax
+  804f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f5b:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  804f5f:	48 83 c4 10          	add    $0x10,%rsp
+  804f63:	5b                   	pop    %rbx
+  804f64:	41 5c                	pop    %r12
+  804f66:	41 5d                	pop    %r13
+  804f68:	41 5e                	pop    %r14
+  804f6a:	5d                   	pop    %rbp
+  804f6b:	c3                   	ret
+    if (res < 0) return res;
+  804f6c:	48 98                	cltq
+  804f6e:	eb ef                	jmp    804f5f <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  804f70:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f74:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  804f7b:	00 00 00 
+  804f7e:	ff d0                	call   *%rax
+  804f80:	4d 63 e4             	movslq %r12d,%r12
+  804f83:	4c 01 e0             	add    %r12,%rax
+  804f86:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  804f8a:	48 89 d8             	mov    %rbx,%rax
+  804f8d:	4c 29 f0             	sub    %r14,%rax
+  804f90:	eb cd                	jmp    804f5f <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  804f92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804f99:	eb c4                	jmp    804f5f <read_map+0x81>
+
+0000000000804f9b <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  804f9b:	55                   	push   %rbp
+  804f9c:	48 89 e5             	mov    %rsp,%rbp
+  804f9f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804fa3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fa7:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  804fae:	00 00 00 
+  804fb1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fb3:	85 c0                	test   %eax,%eax
+  804fb5:	78 4a                	js     805001 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804fb7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804fbb:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804fc2:	00 00 00 
+  804fc5:	8b 00                	mov    (%rax),%eax
+  804fc7:	39 07                	cmp    %eax,(%rdi)
+  804fc9:	75 38                	jne    805003 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804fcb:	48 b8 25 45 80 00 00 	movabs $0x804525,%rax
+  804fd2:	00 00 00 
+  804fd5:	ff d0                	call   *%rax
+  804fd7:	85 c0                	test   %eax,%eax
+  804fd9:	78 26                	js     805001 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804fdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fdf:	8b 40 0c             	mov    0xc(%rax),%eax
+  804fe2:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  804fe9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  804feb:	be 00 00 00 00       	mov    $0x0,%esi
+  804ff0:	bf 06 00 00 00       	mov    $0x6,%edi
+  804ff5:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  804ffc:	00 00 00 
+  804fff:	ff d0                	call   *%rax
+}
+  805001:	c9                   	leave
+  805002:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  805003:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805008:	eb f7                	jmp    805001 <fsync+0x66>
+
+000000000080500a <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80500a:	55                   	push   %rbp
+  80500b:	48 89 e5             	mov    %rsp,%rbp
+  80500e:	41 57                	push   %r15
+  805010:	41 56                	push   %r14
+  805012:	41 55                	push   %r13
+  805014:	41 54                	push   %r12
+  805016:	53                   	push   %rbx
+  805017:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80501b:	49 bc 20 a0 98 00 00 	movabs $0x98a020,%r12
+  805022:	00 00 00 
+  805025:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80502a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  805030:	49 bd ed 39 80 00 00 	movabs $0x8039ed,%r13
+  805037:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80503a:	49 be a0 70 80 00 00 	movabs $0x8070a0,%r14
+  805041:	00 00 00 
+  805044:	eb 0c                	jmp    805052 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  805046:	83 c3 01             	add    $0x1,%ebx
+  805049:	49 83 c4 28          	add    $0x28,%r12
+  80504d:	83 fb 20             	cmp    $0x20,%ebx
+  805050:	74 33                	je     805085 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  805052:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  805057:	74 ed                	je     805046 <flushall+0x3c>
+  805059:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80505d:	89 df                	mov    %ebx,%edi
+  80505f:	41 ff d5             	call   *%r13
+  805062:	85 c0                	test   %eax,%eax
+  805064:	78 e0                	js     805046 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  805066:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80506a:	41 8b 06             	mov    (%r14),%eax
+  80506d:	39 07                	cmp    %eax,(%rdi)
+  80506f:	75 d5                	jne    805046 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  805071:	48 b8 25 45 80 00 00 	movabs $0x804525,%rax
+  805078:	00 00 00 
+  80507b:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80507d:	85 c0                	test   %eax,%eax
+  80507f:	44 0f 48 f8          	cmovs  %eax,%r15d
+  805083:	eb c1                	jmp    805046 <flushall+0x3c>
+    }
+    return res;
+}
+  805085:	44 89 f8             	mov    %r15d,%eax
+  805088:	48 83 c4 18          	add    $0x18,%rsp
+  80508c:	5b                   	pop    %rbx
+  80508d:	41 5c                	pop    %r12
+  80508f:	41 5d                	pop    %r13
+  805091:	41 5e                	pop    %r14
+  805093:	41 5f                	pop    %r15
+  805095:	5d                   	pop    %rbp
+  805096:	c3                   	ret
+
+0000000000805097 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  805097:	55                   	push   %rbp
+  805098:	48 89 e5             	mov    %rsp,%rbp
+  80509b:	53                   	push   %rbx
+  80509c:	48 83 ec 08          	sub    $0x8,%rsp
+  8050a0:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8050a3:	40 0f b6 c6          	movzbl %sil,%eax
+  8050a7:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8050ae:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8050b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8050b5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8050ba:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  8050c1:	00 00 00 
+  8050c4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8050c6:	85 c0                	test   %eax,%eax
+  8050c8:	78 23                	js     8050ed <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8050ca:	ba 58 06 00 00       	mov    $0x658,%edx
+  8050cf:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  8050d6:	00 00 00 
+  8050d9:	48 89 df             	mov    %rbx,%rdi
+  8050dc:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  8050e3:	00 00 00 
+  8050e6:	ff d0                	call   *%rax
+    return 0;
+  8050e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8050f1:	c9                   	leave
+  8050f2:	c3                   	ret
+
+00000000008050f3 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8050f3:	55                   	push   %rbp
+  8050f4:	48 89 e5             	mov    %rsp,%rbp
+  8050f7:	53                   	push   %rbx
+  8050f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8050fc:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8050ff:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  805106:	00 00 00 
+  805109:	ff d0                	call   *%rax
+  80510b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  805111:	77 35                	ja     805148 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  805113:	48 89 de             	mov    %rbx,%rsi
+  805116:	48 bf 00 90 98 00 00 	movabs $0x989000,%rdi
+  80511d:	00 00 00 
+  805120:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  805127:	00 00 00 
+  80512a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80512c:	be 00 00 00 00       	mov    $0x0,%esi
+  805131:	bf 07 00 00 00       	mov    $0x7,%edi
+  805136:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  80513d:	00 00 00 
+  805140:	ff d0                	call   *%rax
+}
+  805142:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805146:	c9                   	leave
+  805147:	c3                   	ret
+        return -E_BAD_PATH;
+  805148:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80514d:	eb f3                	jmp    805142 <remove+0x4f>
+
+000000000080514f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80514f:	55                   	push   %rbp
+  805150:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  805153:	48 b8 0a 50 80 00 00 	movabs $0x80500a,%rax
+  80515a:	00 00 00 
+  80515d:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80515f:	be 00 00 00 00       	mov    $0x0,%esi
+  805164:	bf 08 00 00 00       	mov    $0x8,%edi
+  805169:	48 b8 5f 45 80 00 00 	movabs $0x80455f,%rax
+  805170:	00 00 00 
+  805173:	ff d0                	call   *%rax
+}
+  805175:	5d                   	pop    %rbp
+  805176:	c3                   	ret
+
+0000000000805177 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805177:	55                   	push   %rbp
+  805178:	48 89 e5             	mov    %rsp,%rbp
+  80517b:	41 54                	push   %r12
+  80517d:	53                   	push   %rbx
+  80517e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805181:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  805188:	00 00 00 
+  80518b:	ff d0                	call   *%rax
+  80518d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  805190:	48 be a0 67 80 00 00 	movabs $0x8067a0,%rsi
+  805197:	00 00 00 
+  80519a:	48 89 df             	mov    %rbx,%rdi
+  80519d:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  8051a4:	00 00 00 
+  8051a7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8051a9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8051ae:	41 2b 04 24          	sub    (%r12),%eax
+  8051b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8051b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8051bf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8051c2:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  8051c9:	00 00 00 
+  8051cc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8051d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051d8:	5b                   	pop    %rbx
+  8051d9:	41 5c                	pop    %r12
+  8051db:	5d                   	pop    %rbp
+  8051dc:	c3                   	ret
+
+00000000008051dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8051dd:	55                   	push   %rbp
+  8051de:	48 89 e5             	mov    %rsp,%rbp
+  8051e1:	41 54                	push   %r12
+  8051e3:	53                   	push   %rbx
+  8051e4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8051e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051ec:	48 89 fe             	mov    %rdi,%rsi
+  8051ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051f4:	49 bc 85 2e 80 00 00 	movabs $0x802e85,%r12
+  8051fb:	00 00 00 
+  8051fe:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  805201:	48 89 df             	mov    %rbx,%rdi
+  805204:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  80520b:	00 00 00 
+  80520e:	ff d0                	call   *%rax
+  805210:	48 89 c6             	mov    %rax,%rsi
+  805213:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805218:	bf 00 00 00 00       	mov    $0x0,%edi
+  80521d:	41 ff d4             	call   *%r12
+}
+  805220:	5b                   	pop    %rbx
+  805221:	41 5c                	pop    %r12
+  805223:	5d                   	pop    %rbp
+  805224:	c3                   	ret
+
+0000000000805225 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805225:	55                   	push   %rbp
+  805226:	48 89 e5             	mov    %rsp,%rbp
+  805229:	41 57                	push   %r15
+  80522b:	41 56                	push   %r14
+  80522d:	41 55                	push   %r13
+  80522f:	41 54                	push   %r12
+  805231:	53                   	push   %rbx
+  805232:	48 83 ec 18          	sub    $0x18,%rsp
+  805236:	49 89 fc             	mov    %rdi,%r12
+  805239:	49 89 f5             	mov    %rsi,%r13
+  80523c:	49 89 d7             	mov    %rdx,%r15
+  80523f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805243:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  80524a:	00 00 00 
+  80524d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80524f:	4d 85 ff             	test   %r15,%r15
+  805252:	0f 84 af 00 00 00    	je     805307 <devpipe_write+0xe2>
+  805258:	48 89 c3             	mov    %rax,%rbx
+  80525b:	4c 89 f8             	mov    %r15,%rax
+  80525e:	4d 89 ef             	mov    %r13,%r15
+  805261:	4c 01 e8             	add    %r13,%rax
+  805264:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805268:	49 bd 7a 2c 80 00 00 	movabs $0x802c7a,%r13
+  80526f:	00 00 00 
+            sys_yield();
+  805272:	49 be 17 2c 80 00 00 	movabs $0x802c17,%r14
+  805279:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80527c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80527f:	48 63 ce             	movslq %esi,%rcx
+  805282:	48 63 03             	movslq (%rbx),%rax
+  805285:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80528b:	48 39 c1             	cmp    %rax,%rcx
+  80528e:	72 2e                	jb     8052be <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805290:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805295:	48 89 da             	mov    %rbx,%rdx
+  805298:	be 00 10 00 00       	mov    $0x1000,%esi
+  80529d:	4c 89 e7             	mov    %r12,%rdi
+  8052a0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8052a3:	85 c0                	test   %eax,%eax
+  8052a5:	74 66                	je     80530d <devpipe_write+0xe8>
+            sys_yield();
+  8052a7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8052aa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8052ad:	48 63 ce             	movslq %esi,%rcx
+  8052b0:	48 63 03             	movslq (%rbx),%rax
+  8052b3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8052b9:	48 39 c1             	cmp    %rax,%rcx
+  8052bc:	73 d2                	jae    805290 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8052be:	41 0f b6 3f          	movzbl (%r15),%edi
+  8052c2:	48 89 ca             	mov    %rcx,%rdx
+  8052c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8052c9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8052d0:	08 10 20 
+  8052d3:	48 f7 e2             	mul    %rdx
+  8052d6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8052da:	48 89 d0             	mov    %rdx,%rax
+  8052dd:	48 c1 e0 09          	shl    $0x9,%rax
+  8052e1:	48 29 d0             	sub    %rdx,%rax
+  8052e4:	48 c1 e0 03          	shl    $0x3,%rax
+  8052e8:	48 29 c1             	sub    %rax,%rcx
+  8052eb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8052f0:	83 c6 01             	add    $0x1,%esi
+  8052f3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8052f6:	49 83 c7 01          	add    $0x1,%r15
+  8052fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052fe:	49 39 c7             	cmp    %rax,%r15
+  805301:	0f 85 75 ff ff ff    	jne    80527c <devpipe_write+0x57>
+    return n;
+  805307:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80530b:	eb 05                	jmp    805312 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80530d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805312:	48 83 c4 18          	add    $0x18,%rsp
+  805316:	5b                   	pop    %rbx
+  805317:	41 5c                	pop    %r12
+  805319:	41 5d                	pop    %r13
+  80531b:	41 5e                	pop    %r14
+  80531d:	41 5f                	pop    %r15
+  80531f:	5d                   	pop    %rbp
+  805320:	c3                   	ret
+
+0000000000805321 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805321:	55                   	push   %rbp
+  805322:	48 89 e5             	mov    %rsp,%rbp
+  805325:	41 57                	push   %r15
+  805327:	41 56                	push   %r14
+  805329:	41 55                	push   %r13
+  80532b:	41 54                	push   %r12
+  80532d:	53                   	push   %rbx
+  80532e:	48 83 ec 18          	sub    $0x18,%rsp
+  805332:	49 89 fc             	mov    %rdi,%r12
+  805335:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805339:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80533d:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  805344:	00 00 00 
+  805347:	ff d0                	call   *%rax
+  805349:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80534c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805352:	49 bd 7a 2c 80 00 00 	movabs $0x802c7a,%r13
+  805359:	00 00 00 
+            sys_yield();
+  80535c:	49 be 17 2c 80 00 00 	movabs $0x802c17,%r14
+  805363:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  805366:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80536b:	74 7d                	je     8053ea <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80536d:	8b 03                	mov    (%rbx),%eax
+  80536f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805372:	75 26                	jne    80539a <devpipe_read+0x79>
+            if (i > 0) return i;
+  805374:	4d 85 ff             	test   %r15,%r15
+  805377:	75 77                	jne    8053f0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805379:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80537e:	48 89 da             	mov    %rbx,%rdx
+  805381:	be 00 10 00 00       	mov    $0x1000,%esi
+  805386:	4c 89 e7             	mov    %r12,%rdi
+  805389:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80538c:	85 c0                	test   %eax,%eax
+  80538e:	74 72                	je     805402 <devpipe_read+0xe1>
+            sys_yield();
+  805390:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805393:	8b 03                	mov    (%rbx),%eax
+  805395:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805398:	74 df                	je     805379 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80539a:	48 63 c8             	movslq %eax,%rcx
+  80539d:	48 89 ca             	mov    %rcx,%rdx
+  8053a0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8053a4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8053ab:	08 10 20 
+  8053ae:	48 89 d0             	mov    %rdx,%rax
+  8053b1:	48 f7 e6             	mul    %rsi
+  8053b4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8053b8:	48 89 d0             	mov    %rdx,%rax
+  8053bb:	48 c1 e0 09          	shl    $0x9,%rax
+  8053bf:	48 29 d0             	sub    %rdx,%rax
+  8053c2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8053c9:	00 
+  8053ca:	48 89 c8             	mov    %rcx,%rax
+  8053cd:	48 29 d0             	sub    %rdx,%rax
+  8053d0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8053d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8053d9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8053dd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8053e0:	49 83 c7 01          	add    $0x1,%r15
+  8053e4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8053e8:	75 83                	jne    80536d <devpipe_read+0x4c>
+    return n;
+  8053ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053ee:	eb 03                	jmp    8053f3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8053f0:	4c 89 f8             	mov    %r15,%rax
+}
+  8053f3:	48 83 c4 18          	add    $0x18,%rsp
+  8053f7:	5b                   	pop    %rbx
+  8053f8:	41 5c                	pop    %r12
+  8053fa:	41 5d                	pop    %r13
+  8053fc:	41 5e                	pop    %r14
+  8053fe:	41 5f                	pop    %r15
+  805400:	5d                   	pop    %rbp
+  805401:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  805402:	b8 00 00 00 00       	mov    $0x0,%eax
+  805407:	eb ea                	jmp    8053f3 <devpipe_read+0xd2>
+
+0000000000805409 <pipe>:
+pipe(int pfd[2]) {
+  805409:	55                   	push   %rbp
+  80540a:	48 89 e5             	mov    %rsp,%rbp
+  80540d:	41 55                	push   %r13
+  80540f:	41 54                	push   %r12
+  805411:	53                   	push   %rbx
+  805412:	48 83 ec 18          	sub    $0x18,%rsp
+  805416:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805419:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80541d:	48 b8 8d 39 80 00 00 	movabs $0x80398d,%rax
+  805424:	00 00 00 
+  805427:	ff d0                	call   *%rax
+  805429:	89 c3                	mov    %eax,%ebx
+  80542b:	85 c0                	test   %eax,%eax
+  80542d:	0f 88 a0 01 00 00    	js     8055d3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  805433:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805438:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80543d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805441:	bf 00 00 00 00       	mov    $0x0,%edi
+  805446:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  80544d:	00 00 00 
+  805450:	ff d0                	call   *%rax
+  805452:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805454:	85 c0                	test   %eax,%eax
+  805456:	0f 88 77 01 00 00    	js     8055d3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80545c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  805460:	48 b8 8d 39 80 00 00 	movabs $0x80398d,%rax
+  805467:	00 00 00 
+  80546a:	ff d0                	call   *%rax
+  80546c:	89 c3                	mov    %eax,%ebx
+  80546e:	85 c0                	test   %eax,%eax
+  805470:	0f 88 43 01 00 00    	js     8055b9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  805476:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80547b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805480:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805484:	bf 00 00 00 00       	mov    $0x0,%edi
+  805489:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  805490:	00 00 00 
+  805493:	ff d0                	call   *%rax
+  805495:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805497:	85 c0                	test   %eax,%eax
+  805499:	0f 88 1a 01 00 00    	js     8055b9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80549f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8054a3:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  8054aa:	00 00 00 
+  8054ad:	ff d0                	call   *%rax
+  8054af:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8054b2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8054b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8054bc:	48 89 c6             	mov    %rax,%rsi
+  8054bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c4:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  8054cb:	00 00 00 
+  8054ce:	ff d0                	call   *%rax
+  8054d0:	89 c3                	mov    %eax,%ebx
+  8054d2:	85 c0                	test   %eax,%eax
+  8054d4:	0f 88 c5 00 00 00    	js     80559f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8054da:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8054de:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  8054e5:	00 00 00 
+  8054e8:	ff d0                	call   *%rax
+  8054ea:	48 89 c1             	mov    %rax,%rcx
+  8054ed:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8054f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8054f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054fe:	4c 89 ee             	mov    %r13,%rsi
+  805501:	bf 00 00 00 00       	mov    $0x0,%edi
+  805506:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  80550d:	00 00 00 
+  805510:	ff d0                	call   *%rax
+  805512:	89 c3                	mov    %eax,%ebx
+  805514:	85 c0                	test   %eax,%eax
+  805516:	78 6e                	js     805586 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  805518:	be 00 10 00 00       	mov    $0x1000,%esi
+  80551d:	4c 89 ef             	mov    %r13,%rdi
+  805520:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  805527:	00 00 00 
+  80552a:	ff d0                	call   *%rax
+  80552c:	83 f8 02             	cmp    $0x2,%eax
+  80552f:	0f 85 ab 00 00 00    	jne    8055e0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  805535:	a1 e0 70 80 00 00 00 	movabs 0x8070e0,%eax
+  80553c:	00 00 
+  80553e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805542:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  805544:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805548:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80554f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805553:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  805555:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805559:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  805560:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805564:	48 bb 5f 39 80 00 00 	movabs $0x80395f,%rbx
+  80556b:	00 00 00 
+  80556e:	ff d3                	call   *%rbx
+  805570:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  805574:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805578:	ff d3                	call   *%rbx
+  80557a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80557f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805584:	eb 4d                	jmp    8055d3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805586:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80558b:	4c 89 ee             	mov    %r13,%rsi
+  80558e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805593:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  80559a:	00 00 00 
+  80559d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80559f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055a4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8055a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055ad:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  8055b4:	00 00 00 
+  8055b7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8055b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8055c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055c7:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  8055ce:	00 00 00 
+  8055d1:	ff d0                	call   *%rax
+}
+  8055d3:	89 d8                	mov    %ebx,%eax
+  8055d5:	48 83 c4 18          	add    $0x18,%rsp
+  8055d9:	5b                   	pop    %rbx
+  8055da:	41 5c                	pop    %r12
+  8055dc:	41 5d                	pop    %r13
+  8055de:	5d                   	pop    %rbp
+  8055df:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8055e0:	48 b9 d0 67 80 00 00 	movabs $0x8067d0,%rcx
+  8055e7:	00 00 00 
+  8055ea:	48 ba a7 67 80 00 00 	movabs $0x8067a7,%rdx
+  8055f1:	00 00 00 
+  8055f4:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8055f9:	48 bf bc 67 80 00 00 	movabs $0x8067bc,%rdi
+  805600:	00 00 00 
+  805603:	b8 00 00 00 00       	mov    $0x0,%eax
+  805608:	49 b8 7e 1a 80 00 00 	movabs $0x801a7e,%r8
+  80560f:	00 00 00 
+  805612:	41 ff d0             	call   *%r8
+
+0000000000805615 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805615:	55                   	push   %rbp
+  805616:	48 89 e5             	mov    %rsp,%rbp
+  805619:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80561d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805621:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  805628:	00 00 00 
+  80562b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80562d:	85 c0                	test   %eax,%eax
+  80562f:	78 35                	js     805666 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  805631:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805635:	48 b8 71 39 80 00 00 	movabs $0x803971,%rax
+  80563c:	00 00 00 
+  80563f:	ff d0                	call   *%rax
+  805641:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805644:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805649:	be 00 10 00 00       	mov    $0x1000,%esi
+  80564e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805652:	48 b8 7a 2c 80 00 00 	movabs $0x802c7a,%rax
+  805659:	00 00 00 
+  80565c:	ff d0                	call   *%rax
+  80565e:	85 c0                	test   %eax,%eax
+  805660:	0f 94 c0             	sete   %al
+  805663:	0f b6 c0             	movzbl %al,%eax
+}
+  805666:	c9                   	leave
+  805667:	c3                   	ret
+
+0000000000805668 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805668:	48 89 f8             	mov    %rdi,%rax
+  80566b:	48 c1 e8 27          	shr    $0x27,%rax
+  80566f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  805676:	7f 00 00 
+  805679:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80567d:	f6 c2 01             	test   $0x1,%dl
+  805680:	74 6d                	je     8056ef <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805682:	48 89 f8             	mov    %rdi,%rax
+  805685:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805689:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  805690:	7f 00 00 
+  805693:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805697:	f6 c2 01             	test   $0x1,%dl
+  80569a:	74 62                	je     8056fe <get_uvpt_entry+0x96>
+  80569c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8056a3:	7f 00 00 
+  8056a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8056aa:	f6 c2 80             	test   $0x80,%dl
+  8056ad:	75 4f                	jne    8056fe <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8056af:	48 89 f8             	mov    %rdi,%rax
+  8056b2:	48 c1 e8 15          	shr    $0x15,%rax
+  8056b6:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8056bd:	7f 00 00 
+  8056c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8056c4:	f6 c2 01             	test   $0x1,%dl
+  8056c7:	74 44                	je     80570d <get_uvpt_entry+0xa5>
+  8056c9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8056d0:	7f 00 00 
+  8056d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8056d7:	f6 c2 80             	test   $0x80,%dl
+  8056da:	75 31                	jne    80570d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8056dc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8056e0:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8056e7:	7f 00 00 
+  8056ea:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8056ee:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8056ef:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8056f6:	7f 00 00 
+  8056f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8056fd:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8056fe:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  805705:	7f 00 00 
+  805708:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80570c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80570d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  805714:	7f 00 00 
+  805717:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80571b:	c3                   	ret
+
+000000000080571c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80571c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80571f:	48 89 f9             	mov    %rdi,%rcx
+  805722:	48 c1 e9 27          	shr    $0x27,%rcx
+  805726:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80572d:	7f 00 00 
+  805730:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  805734:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80573b:	f6 c1 01             	test   $0x1,%cl
+  80573e:	0f 84 b2 00 00 00    	je     8057f6 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  805744:	48 89 f9             	mov    %rdi,%rcx
+  805747:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80574b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  805752:	7f 00 00 
+  805755:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  805759:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  805760:	40 f6 c6 01          	test   $0x1,%sil
+  805764:	0f 84 8c 00 00 00    	je     8057f6 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80576a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  805771:	7f 00 00 
+  805774:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  805778:	a8 80                	test   $0x80,%al
+  80577a:	75 7b                	jne    8057f7 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80577c:	48 89 f9             	mov    %rdi,%rcx
+  80577f:	48 c1 e9 15          	shr    $0x15,%rcx
+  805783:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80578a:	7f 00 00 
+  80578d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  805791:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  805798:	40 f6 c6 01          	test   $0x1,%sil
+  80579c:	74 58                	je     8057f6 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80579e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8057a5:	7f 00 00 
+  8057a8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8057ac:	a8 80                	test   $0x80,%al
+  8057ae:	75 6c                	jne    80581c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8057b0:	48 89 f9             	mov    %rdi,%rcx
+  8057b3:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8057b7:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8057be:	7f 00 00 
+  8057c1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8057c5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8057cc:	40 f6 c6 01          	test   $0x1,%sil
+  8057d0:	74 24                	je     8057f6 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8057d2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8057d9:	7f 00 00 
+  8057dc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8057e0:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8057e7:	ff ff 7f 
+  8057ea:	48 21 c8             	and    %rcx,%rax
+  8057ed:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8057f3:	48 09 d0             	or     %rdx,%rax
+}
+  8057f6:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8057f7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8057fe:	7f 00 00 
+  805801:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  805805:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80580c:	ff ff 7f 
+  80580f:	48 21 c8             	and    %rcx,%rax
+  805812:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  805818:	48 01 d0             	add    %rdx,%rax
+  80581b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80581c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  805823:	7f 00 00 
+  805826:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80582a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  805831:	ff ff 7f 
+  805834:	48 21 c8             	and    %rcx,%rax
+  805837:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80583d:	48 01 d0             	add    %rdx,%rax
+  805840:	c3                   	ret
+
+0000000000805841 <get_prot>:
+
+int
+get_prot(void *va) {
+  805841:	55                   	push   %rbp
+  805842:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805845:	48 b8 68 56 80 00 00 	movabs $0x805668,%rax
+  80584c:	00 00 00 
+  80584f:	ff d0                	call   *%rax
+  805851:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805854:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805859:	89 c1                	mov    %eax,%ecx
+  80585b:	83 c9 04             	or     $0x4,%ecx
+  80585e:	f6 c2 01             	test   $0x1,%dl
+  805861:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805864:	89 c1                	mov    %eax,%ecx
+  805866:	83 c9 02             	or     $0x2,%ecx
+  805869:	f6 c2 02             	test   $0x2,%dl
+  80586c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80586f:	89 c1                	mov    %eax,%ecx
+  805871:	83 c9 01             	or     $0x1,%ecx
+  805874:	48 85 d2             	test   %rdx,%rdx
+  805877:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80587a:	89 c1                	mov    %eax,%ecx
+  80587c:	83 c9 40             	or     $0x40,%ecx
+  80587f:	f6 c6 04             	test   $0x4,%dh
+  805882:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805885:	5d                   	pop    %rbp
+  805886:	c3                   	ret
+
+0000000000805887 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805887:	55                   	push   %rbp
+  805888:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80588b:	48 b8 68 56 80 00 00 	movabs $0x805668,%rax
+  805892:	00 00 00 
+  805895:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805897:	48 c1 e8 06          	shr    $0x6,%rax
+  80589b:	83 e0 01             	and    $0x1,%eax
+}
+  80589e:	5d                   	pop    %rbp
+  80589f:	c3                   	ret
+
+00000000008058a0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8058a0:	55                   	push   %rbp
+  8058a1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8058a4:	48 b8 68 56 80 00 00 	movabs $0x805668,%rax
+  8058ab:	00 00 00 
+  8058ae:	ff d0                	call   *%rax
+  8058b0:	83 e0 01             	and    $0x1,%eax
+}
+  8058b3:	5d                   	pop    %rbp
+  8058b4:	c3                   	ret
+
+00000000008058b5 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8058b5:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8058bc:	7f 00 00 
+  8058bf:	a8 01                	test   $0x1,%al
+  8058c1:	75 06                	jne    8058c9 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8058c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058c8:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8058c9:	55                   	push   %rbp
+  8058ca:	48 89 e5             	mov    %rsp,%rbp
+  8058cd:	41 57                	push   %r15
+  8058cf:	41 56                	push   %r14
+  8058d1:	41 55                	push   %r13
+  8058d3:	41 54                	push   %r12
+  8058d5:	53                   	push   %rbx
+  8058d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8058da:	49 89 fe             	mov    %rdi,%r14
+  8058dd:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8058e0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8058e7:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8058e8:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8058ef:	7f 00 00 
+  8058f2:	e9 81 00 00 00       	jmp    805978 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8058f7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8058fe:	49 39 dd             	cmp    %rbx,%r13
+  805901:	74 2b                	je     80592e <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  805903:	48 89 d8             	mov    %rbx,%rax
+  805906:	48 c1 e8 0c          	shr    $0xc,%rax
+  80590a:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80590e:	f6 c2 01             	test   $0x1,%dl
+  805911:	74 e4                	je     8058f7 <foreach_shared_region+0x42>
+  805913:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  805917:	f6 c4 04             	test   $0x4,%ah
+  80591a:	74 db                	je     8058f7 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80591c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  805923:	4c 89 fa             	mov    %r15,%rdx
+  805926:	48 89 df             	mov    %rbx,%rdi
+  805929:	41 ff d6             	call   *%r14
+  80592c:	eb c9                	jmp    8058f7 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80592e:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  805935:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  805939:	74 22                	je     80595d <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80593b:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  805942:	48 89 d8             	mov    %rbx,%rax
+  805945:	48 c1 e8 15          	shr    $0x15,%rax
+  805949:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  805950:	7f 00 00 
+  805953:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  805957:	a8 01                	test   $0x1,%al
+  805959:	74 d3                	je     80592e <foreach_shared_region+0x79>
+  80595b:	eb a6                	jmp    805903 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80595d:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  805964:	40 
+  805965:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805969:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805970:	00 00 00 
+  805973:	48 39 c1             	cmp    %rax,%rcx
+  805976:	74 31                	je     8059a9 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  805978:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80597c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805980:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  805987:	7f 00 00 
+  80598a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80598e:	a8 01                	test   $0x1,%al
+  805990:	74 cb                	je     80595d <foreach_shared_region+0xa8>
+  805992:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805996:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80599d:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8059a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8059a7:	eb 92                	jmp    80593b <foreach_shared_region+0x86>
+}
+  8059a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ae:	48 83 c4 18          	add    $0x18,%rsp
+  8059b2:	5b                   	pop    %rbx
+  8059b3:	41 5c                	pop    %r12
+  8059b5:	41 5d                	pop    %r13
+  8059b7:	41 5e                	pop    %r14
+  8059b9:	41 5f                	pop    %r15
+  8059bb:	5d                   	pop    %rbp
+  8059bc:	c3                   	ret
+
+00000000008059bd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8059bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059c2:	c3                   	ret
+
+00000000008059c3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8059c3:	55                   	push   %rbp
+  8059c4:	48 89 e5             	mov    %rsp,%rbp
+  8059c7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8059ca:	48 be f4 67 80 00 00 	movabs $0x8067f4,%rsi
+  8059d1:	00 00 00 
+  8059d4:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  8059db:	00 00 00 
+  8059de:	ff d0                	call   *%rax
+    return 0;
+}
+  8059e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059e5:	5d                   	pop    %rbp
+  8059e6:	c3                   	ret
+
+00000000008059e7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8059e7:	55                   	push   %rbp
+  8059e8:	48 89 e5             	mov    %rsp,%rbp
+  8059eb:	41 57                	push   %r15
+  8059ed:	41 56                	push   %r14
+  8059ef:	41 55                	push   %r13
+  8059f1:	41 54                	push   %r12
+  8059f3:	53                   	push   %rbx
+  8059f4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8059fb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  805a02:	48 85 d2             	test   %rdx,%rdx
+  805a05:	74 7a                	je     805a81 <devcons_write+0x9a>
+  805a07:	49 89 d6             	mov    %rdx,%r14
+  805a0a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805a10:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805a15:	49 bf d4 28 80 00 00 	movabs $0x8028d4,%r15
+  805a1c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805a1f:	4c 89 f3             	mov    %r14,%rbx
+  805a22:	48 29 f3             	sub    %rsi,%rbx
+  805a25:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805a2a:	48 39 c3             	cmp    %rax,%rbx
+  805a2d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805a31:	4c 63 eb             	movslq %ebx,%r13
+  805a34:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805a3b:	48 01 c6             	add    %rax,%rsi
+  805a3e:	4c 89 ea             	mov    %r13,%rdx
+  805a41:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805a48:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805a4b:	4c 89 ee             	mov    %r13,%rsi
+  805a4e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805a55:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  805a5c:	00 00 00 
+  805a5f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805a61:	41 01 dc             	add    %ebx,%r12d
+  805a64:	49 63 f4             	movslq %r12d,%rsi
+  805a67:	4c 39 f6             	cmp    %r14,%rsi
+  805a6a:	72 b3                	jb     805a1f <devcons_write+0x38>
+    return res;
+  805a6c:	49 63 c4             	movslq %r12d,%rax
+}
+  805a6f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805a76:	5b                   	pop    %rbx
+  805a77:	41 5c                	pop    %r12
+  805a79:	41 5d                	pop    %r13
+  805a7b:	41 5e                	pop    %r14
+  805a7d:	41 5f                	pop    %r15
+  805a7f:	5d                   	pop    %rbp
+  805a80:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805a81:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805a87:	eb e3                	jmp    805a6c <devcons_write+0x85>
+
+0000000000805a89 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a89:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a91:	48 85 c0             	test   %rax,%rax
+  805a94:	74 55                	je     805aeb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a96:	55                   	push   %rbp
+  805a97:	48 89 e5             	mov    %rsp,%rbp
+  805a9a:	41 55                	push   %r13
+  805a9c:	41 54                	push   %r12
+  805a9e:	53                   	push   %rbx
+  805a9f:	48 83 ec 08          	sub    $0x8,%rsp
+  805aa3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805aa6:	48 bb 4a 2b 80 00 00 	movabs $0x802b4a,%rbx
+  805aad:	00 00 00 
+  805ab0:	49 bc 17 2c 80 00 00 	movabs $0x802c17,%r12
+  805ab7:	00 00 00 
+  805aba:	eb 03                	jmp    805abf <devcons_read+0x36>
+  805abc:	41 ff d4             	call   *%r12
+  805abf:	ff d3                	call   *%rbx
+  805ac1:	85 c0                	test   %eax,%eax
+  805ac3:	74 f7                	je     805abc <devcons_read+0x33>
+    if (c < 0) return c;
+  805ac5:	48 63 d0             	movslq %eax,%rdx
+  805ac8:	78 13                	js     805add <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805aca:	ba 00 00 00 00       	mov    $0x0,%edx
+  805acf:	83 f8 04             	cmp    $0x4,%eax
+  805ad2:	74 09                	je     805add <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805ad4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805ad8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805add:	48 89 d0             	mov    %rdx,%rax
+  805ae0:	48 83 c4 08          	add    $0x8,%rsp
+  805ae4:	5b                   	pop    %rbx
+  805ae5:	41 5c                	pop    %r12
+  805ae7:	41 5d                	pop    %r13
+  805ae9:	5d                   	pop    %rbp
+  805aea:	c3                   	ret
+  805aeb:	48 89 d0             	mov    %rdx,%rax
+  805aee:	c3                   	ret
+
+0000000000805aef <cputchar>:
+cputchar(int ch) {
+  805aef:	55                   	push   %rbp
+  805af0:	48 89 e5             	mov    %rsp,%rbp
+  805af3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805af7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805afb:	be 01 00 00 00       	mov    $0x1,%esi
+  805b00:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805b04:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  805b0b:	00 00 00 
+  805b0e:	ff d0                	call   *%rax
+}
+  805b10:	c9                   	leave
+  805b11:	c3                   	ret
+
+0000000000805b12 <getchar>:
+getchar(void) {
+  805b12:	55                   	push   %rbp
+  805b13:	48 89 e5             	mov    %rsp,%rbp
+  805b16:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805b1a:	ba 01 00 00 00       	mov    $0x1,%edx
+  805b1f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b28:	48 b8 d0 3c 80 00 00 	movabs $0x803cd0,%rax
+  805b2f:	00 00 00 
+  805b32:	ff d0                	call   *%rax
+  805b34:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805b36:	85 c0                	test   %eax,%eax
+  805b38:	78 06                	js     805b40 <getchar+0x2e>
+  805b3a:	74 08                	je     805b44 <getchar+0x32>
+  805b3c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805b40:	89 d0                	mov    %edx,%eax
+  805b42:	c9                   	leave
+  805b43:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805b44:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805b49:	eb f5                	jmp    805b40 <getchar+0x2e>
+
+0000000000805b4b <iscons>:
+iscons(int fdnum) {
+  805b4b:	55                   	push   %rbp
+  805b4c:	48 89 e5             	mov    %rsp,%rbp
+  805b4f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805b53:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805b57:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  805b5e:	00 00 00 
+  805b61:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805b63:	85 c0                	test   %eax,%eax
+  805b65:	78 18                	js     805b7f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805b67:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805b6b:	48 b8 20 71 80 00 00 	movabs $0x807120,%rax
+  805b72:	00 00 00 
+  805b75:	8b 00                	mov    (%rax),%eax
+  805b77:	39 02                	cmp    %eax,(%rdx)
+  805b79:	0f 94 c0             	sete   %al
+  805b7c:	0f b6 c0             	movzbl %al,%eax
+}
+  805b7f:	c9                   	leave
+  805b80:	c3                   	ret
+
+0000000000805b81 <opencons>:
+opencons(void) {
+  805b81:	55                   	push   %rbp
+  805b82:	48 89 e5             	mov    %rsp,%rbp
+  805b85:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805b89:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805b8d:	48 b8 8d 39 80 00 00 	movabs $0x80398d,%rax
+  805b94:	00 00 00 
+  805b97:	ff d0                	call   *%rax
+  805b99:	85 c0                	test   %eax,%eax
+  805b9b:	78 49                	js     805be6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805b9d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805ba2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805ba7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805bab:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bb0:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  805bb7:	00 00 00 
+  805bba:	ff d0                	call   *%rax
+  805bbc:	85 c0                	test   %eax,%eax
+  805bbe:	78 26                	js     805be6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805bc0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805bc4:	a1 20 71 80 00 00 00 	movabs 0x807120,%eax
+  805bcb:	00 00 
+  805bcd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805bcf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805bd3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805bda:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  805be1:	00 00 00 
+  805be4:	ff d0                	call   *%rax
+}
+  805be6:	c9                   	leave
+  805be7:	c3                   	ret
+
+0000000000805be8 <__text_end>:
+  805be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bef:	00 00 00 
+  805bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf9:	00 00 00 
+  805bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c03:	00 00 00 
+  805c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c0d:	00 00 00 
+  805c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c17:	00 00 00 
+  805c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c21:	00 00 00 
+  805c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c2b:	00 00 00 
+  805c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c35:	00 00 00 
+  805c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c3f:	00 00 00 
+  805c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c49:	00 00 00 
+  805c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c53:	00 00 00 
+  805c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c5d:	00 00 00 
+  805c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c67:	00 00 00 
+  805c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c71:	00 00 00 
+  805c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c7b:	00 00 00 
+  805c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c85:	00 00 00 
+  805c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c8f:	00 00 00 
+  805c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c99:	00 00 00 
+  805c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca3:	00 00 00 
+  805ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cad:	00 00 00 
+  805cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb7:	00 00 00 
+  805cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc1:	00 00 00 
+  805cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ccb:	00 00 00 
+  805cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd5:	00 00 00 
+  805cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cdf:	00 00 00 
+  805ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce9:	00 00 00 
+  805cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf3:	00 00 00 
+  805cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cfd:	00 00 00 
+  805d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d07:	00 00 00 
+  805d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d11:	00 00 00 
+  805d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d1b:	00 00 00 
+  805d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d25:	00 00 00 
+  805d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d2f:	00 00 00 
+  805d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d39:	00 00 00 
+  805d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d43:	00 00 00 
+  805d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d4d:	00 00 00 
+  805d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d57:	00 00 00 
+  805d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d61:	00 00 00 
+  805d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d6b:	00 00 00 
+  805d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d75:	00 00 00 
+  805d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d7f:	00 00 00 
+  805d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d89:	00 00 00 
+  805d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d93:	00 00 00 
+  805d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d9d:	00 00 00 
+  805da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da7:	00 00 00 
+  805daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db1:	00 00 00 
+  805db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dbb:	00 00 00 
+  805dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc5:	00 00 00 
+  805dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dcf:	00 00 00 
+  805dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd9:	00 00 00 
+  805ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de3:	00 00 00 
+  805de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ded:	00 00 00 
+  805df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df7:	00 00 00 
+  805dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e01:	00 00 00 
+  805e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e0b:	00 00 00 
+  805e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e15:	00 00 00 
+  805e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e1f:	00 00 00 
+  805e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e29:	00 00 00 
+  805e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e33:	00 00 00 
+  805e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e3d:	00 00 00 
+  805e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e47:	00 00 00 
+  805e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e51:	00 00 00 
+  805e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e5b:	00 00 00 
+  805e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e65:	00 00 00 
+  805e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e6f:	00 00 00 
+  805e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e79:	00 00 00 
+  805e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e83:	00 00 00 
+  805e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e8d:	00 00 00 
+  805e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e97:	00 00 00 
+  805e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea1:	00 00 00 
+  805ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eab:	00 00 00 
+  805eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb5:	00 00 00 
+  805eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ebf:	00 00 00 
+  805ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec9:	00 00 00 
+  805ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed3:	00 00 00 
+  805ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805edd:	00 00 00 
+  805ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee7:	00 00 00 
+  805eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef1:	00 00 00 
+  805ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805efb:	00 00 00 
+  805efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f05:	00 00 00 
+  805f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f0f:	00 00 00 
+  805f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f19:	00 00 00 
+  805f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f23:	00 00 00 
+  805f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f2d:	00 00 00 
+  805f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f37:	00 00 00 
+  805f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f41:	00 00 00 
+  805f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f4b:	00 00 00 
+  805f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f55:	00 00 00 
+  805f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f5f:	00 00 00 
+  805f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f69:	00 00 00 
+  805f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f73:	00 00 00 
+  805f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f7d:	00 00 00 
+  805f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f87:	00 00 00 
+  805f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f91:	00 00 00 
+  805f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f9b:	00 00 00 
+  805f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa5:	00 00 00 
+  805fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805faf:	00 00 00 
+  805fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb9:	00 00 00 
+  805fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc3:	00 00 00 
+  805fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fcd:	00 00 00 
+  805fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd7:	00 00 00 
+  805fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe1:	00 00 00 
+  805fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805feb:	00 00 00 
+  805fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff5:	00 00 00 
+  805ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805fff:	00 
@@ -0,0 +1,275 @@
+/* File system benchmark.
+ * Runs workloads against the file server and prints one line per
+ * result as space separated key=value pairs after the "fsbench"
+ * tag, so that runs can be compared by scripts:
+ *
+ *   fsbench test=<name> bs=<bytes> ops=<n> kbps=<KB/s> opsps=<ops/s>
+ *           p50=<us> p90=<us> p99=<us> max=<us>
+ *
+ * Latencies are of single operations measured with the TSC */
+
+#include <inc/lib.h>
+
+#define KB 1024
+
+/* The server can't create directories, so the
+ * metadata tests use the root directory */
+#define BENCH_FILE   "/fsbench.dat"
+#define BENCH_PREFIX "/fsbench."
+
+/* Latency samples of the current test, beyond it only totals are kept */
+#define MAXSAMPLES 4096
+
+static uint64_t samples[MAXSAMPLES];
+static size_t nsamples;
+static uint64_t cpufreq;
+
+/* Buffer for the largest request */
+#define MAXBS (256 * KB)
+static uint8_t buf[MAXBS];
+
+static const char *only; /* run only this test if set */
+static size_t file_size = 4096 * KB;
+static size_t nops = 512;
+
+void
+usage(void) {
+    cprintf("usage: fsbench [-t test] [-s fileKB] [-n count]\n");
+    cprintf("tests: seqwrite seqread randread create open stat remove sync\n");
+    exit();
+}
+
+static bool
+enabled(const char *test) {
+    return !only || !strcmp(only, test);
+}
+
+static uint64_t
+cycles_to_us(uint64_t cycles) {
+    return cycles * 1000000 / cpufreq;
+}
+
+static void
+sample(uint64_t cycles) {
+    if (nsamples < MAXSAMPLES) samples[nsamples++] = cycles;
+}
+
+/* Shell sort of samples, enough for a few thousand of them */
+static void
+sort_samples(void) {
+    for (size_t gap = nsamples / 2; gap; gap /= 2) {
+        for (size_t i = gap; i < nsamples; i++) {
+            uint64_t v = samples[i];
+            size_t j = i;
+            for (; j >= gap && samples[j - gap] > v; j -= gap)
+                samples[j] = samples[j - gap];
+            samples[j] = v;
+        }
+    }
+}
+
+static uint64_t
+percentile(unsigned pct) {
+    return nsamples ? cycles_to_us(samples[(nsamples - 1) * pct / 100]) : 0;
+}
+
+static void
+report(const char *test, size_t bs, size_t ops, uint64_t total) {
+    sort_samples();
+
+    uint64_t us = cycles_to_us(total);
+    if (!us) us = 1;
+
+    cprintf("fsbench test=%s bs=%zu ops=%zu kbps=%lu opsps=%lu p50=%lu p90=%lu p99=%lu max=%lu\n",
+            test, bs, ops,
+            (unsigned long)((uint64_t)bs * ops * 1000000 / KB / us),
+            (unsigned long)((uint64_t)ops * 1000000 / us),
+            (unsigned long)percentile(50), (unsigned long)percentile(90),
+            (unsigned long)percentile(99), (unsigned long)percentile(100));
+    nsamples = 0;
+}
+
+static int
+xopen(const char *path, int mode) {
+    int fd = open(path, mode);
+    if (fd < 0) panic("open %s: %i", path, fd);
+    return fd;
+}
+
+static void
+seq_write(size_t bs) {
+    int fd = xopen(BENCH_FILE, O_WRONLY | O_CREAT | O_TRUNC);
+    size_t ops = file_size / bs;
+
+    memset(buf, 0xA5, bs);
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < ops; i++) {
+        uint64_t t = read_tsc();
+        ssize_t res = write(fd, buf, bs);
+        if (res != (ssize_t)bs) panic("write: %i", (int)res);
+        sample(read_tsc() - t);
+    }
+    /* Count the cost of getting the data to the server */
+    if (fsync(fd) < 0) panic("fsync");
+    uint64_t total = read_tsc() - start;
+
+    close(fd);
+    report("seqwrite", bs, ops, total);
+}
+
+static void
+seq_read(size_t bs) {
+    int fd = xopen(BENCH_FILE, O_RDONLY);
+    size_t ops = file_size / bs;
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < ops; i++) {
+        uint64_t t = read_tsc();
+        ssize_t res = readn(fd, buf, bs);
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+        sample(read_tsc() - t);
+    }
+    uint64_t total = read_tsc() - start;
+
+    close(fd);
+    report("seqread", bs, ops, total);
+}
+
+/* Deterministic generator so that runs read the same offsets */
+static uint32_t
+xorshift(void) {
+    static uint32_t state = 2463534242U;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static void
+rand_read(void) {
+    const size_t bs = 4 * KB;
+    size_t nblocks = file_size / bs;
+    int fd = xopen(BENCH_FILE, O_RDONLY);
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < nops; i++) {
+        uint64_t t = read_tsc();
+        seek(fd, (off_t)(xorshift() % nblocks) * bs);
+        ssize_t res = readn(fd, buf, bs);
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+        sample(read_tsc() - t);
+    }
+    uint64_t total = read_tsc() - start;
+
+    close(fd);
+    report("randread", bs, nops, total);
+}
+
+/* Runs op on nops benchmark files */
+static void
+file_storm(const char *test, void (*op)(const char *path)) {
+    char path[MAXPATHLEN];
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < nops; i++) {
+        snprintf(path, sizeof(path), BENCH_PREFIX "%zu", i);
+        uint64_t t = read_tsc();
+        op(path);
+        sample(read_tsc() - t);
+    }
+    uint64_t total = read_tsc() - start;
+
+    report(test, 0, nops, total);
+}
+
+static void
+do_create(const char *path) {
+    close(xopen(path, O_WRONLY | O_CREAT | O_TRUNC));
+}
+
+static void
+do_open(const char *path) {
+    close(xopen(path, O_RDONLY));
+}
+
+static void
+do_stat(const char *path) {
+    struct Stat st;
+    int res = stat(path, &st);
+    if (res < 0) panic("stat %s: %i", path, res);
+}
+
+static void
+do_remove(const char *path) {
+    int res = remove(path);
+    if (res < 0) panic("remove %s: %i", path, res);
+}
+
+/* Cost of sync after dirtying some blocks of the data file */
+static void
+sync_cost(void) {
+    const size_t bs = 64 * KB, rounds = 16;
+    int fd = xopen(BENCH_FILE, O_WRONLY);
+
+    memset(buf, 0x5A, bs);
+    uint64_t total = 0;
+    for (size_t i = 0; i < rounds; i++) {
+        seek(fd, (off_t)(i * bs) % file_size);
+        if (write(fd, buf, bs) != (ssize_t)bs) panic("write");
+
+        uint64_t t = read_tsc();
+        sync();
+        t = read_tsc() - t;
+        sample(t);
+        total += t;
+    }
+
+    close(fd);
+    report("sync", bs, rounds, total);
+}
+
+void
+umain(int argc, char **argv) {
+    static const size_t sizes[] = {4 * KB, 64 * KB, MAXBS};
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+    while ((i = argnext(&args)) >= 0) {
+        if (i == 't' && argvalue(&args))
+            only = argvalue(&args);
+        else if (i == 's' && argvalue(&args))
+            file_size = strtol(argvalue(&args), NULL, 0) * KB;
+        else if (i == 'n' && argvalue(&args))
+            nops = strtol(argvalue(&args), NULL, 0);
+        else
+            usage();
+    }
+    if (file_size < MAXBS || !nops) usage();
+
+    cpufreq = get_cpufreq();
+
+    /* Read tests need the data file */
+    if (enabled("seqwrite") || enabled("seqread") || enabled("randread") || enabled("sync")) {
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++) {
+            if (enabled("seqwrite") || k == 0) seq_write(sizes[k]);
+        }
+    }
+    if (enabled("seqread")) {
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++)
+            seq_read(sizes[k]);
+    }
+    if (enabled("randread")) rand_read();
+    if (enabled("sync")) sync_cost();
+
+    /* Metadata tests work on the files made by create */
+    if (enabled("create") || enabled("open") || enabled("stat") || enabled("remove")) {
+        file_storm("create", do_create);
+        if (enabled("open")) file_storm("open", do_open);
+        if (enabled("stat")) file_storm("stat", do_stat);
+        file_storm("remove", do_remove);
+    }
+
+    remove(BENCH_FILE);
+    cprintf("fsbench done\n");
+}
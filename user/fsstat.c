@@ -0,0 +1,96 @@
+/* Report file server statistics: per request type counts,
+ * bytes and latencies, block cache and disk counters */
+
+#include <inc/lib.h>
+
+#define KB 1024
+
+static const char *req_names[NFSREQ] = {
+        [FSREQ_OPEN] = "open",
+        [FSREQ_SET_SIZE] = "set_size",
+        [FSREQ_READ] = "read",
+        [FSREQ_WRITE] = "write",
+        [FSREQ_STAT] = "stat",
+        [FSREQ_FLUSH] = "flush",
+        [FSREQ_REMOVE] = "remove",
+        [FSREQ_SYNC] = "sync",
+        [FSREQ_MAP] = "map",
+        [FSREQ_CLOSE] = "close",
+        [FSREQ_STATS] = "stats",
+};
+
+static uint64_t tsc_khz;
+
+void
+usage(void) {
+    cprintf("usage: fsstat [-h] [-r]\n");
+    exit();
+}
+
+static uint64_t
+cycles_to_us(uint64_t cycles) {
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+}
+
+static void
+show_hist(const char *name, const struct FsReqStat *st) {
+    cprintf("%s latency:\n", name);
+    for (int b = 0; b < FSSTAT_BUCKETS; b++) {
+        if (!st->hist[b]) continue;
+
+        if (b == FSSTAT_BUCKETS - 1)
+            cprintf("  >= %9lu us %8u\n",
+                    (unsigned long)cycles_to_us(1ULL << (FSSTAT_SHIFT + b - 1)), st->hist[b]);
+        else
+            cprintf("  <  %9lu us %8u\n",
+                    (unsigned long)cycles_to_us(1ULL << (FSSTAT_SHIFT + b)), st->hist[b]);
+    }
+}
+
+void
+umain(int argc, char **argv) {
+    int i, hist = 0, reset = 0;
+    struct Argstate args;
+    static struct Fsret_stats st;
+
+    argstart(&argc, argv, &args);
+    while ((i = argnext(&args)) >= 0) {
+        if (i == 'h')
+            hist = 1;
+        else if (i == 'r')
+            reset = 1;
+        else
+            usage();
+    }
+
+    int res = fsstats(&st, reset);
+    if (res < 0) {
+        cprintf("fsstat: %i\n", res);
+        exit();
+    }
+    tsc_khz = st.ret_tsc_freq / 1000;
+
+    cprintf("%-9s %8s %10s %9s %9s\n", "REQUEST", "COUNT", "BYTES(K)", "AVG(us)", "MAX(us)");
+    for (int t = 0; t < NFSREQ; t++) {
+        const struct FsReqStat *r = &st.ret_req[t];
+        if (!r->count) continue;
+
+        cprintf("%-9s %8lu %10lu %9lu %9lu\n", req_names[t] ? req_names[t] : "?",
+                (unsigned long)r->count, (unsigned long)(r->bytes / KB),
+                (unsigned long)cycles_to_us(r->cycles / r->count),
+                (unsigned long)cycles_to_us(r->max_cycles));
+    }
+
+    cprintf("Cache: %lu hits, %lu misses, %lu read ahead, %lu evicted, %lu resident, %lu suspended\n",
+            (unsigned long)st.ret_bc_hits, (unsigned long)st.ret_bc_misses,
+            (unsigned long)st.ret_bc_readahead, (unsigned long)st.ret_bc_evictions,
+            (unsigned long)st.ret_bc_resident, (unsigned long)st.ret_suspended);
+    cprintf("Disk: %lu reads %luK, %lu writes %luK\n",
+            (unsigned long)st.ret_disk_reads, (unsigned long)(st.ret_disk_read_bytes / KB),
+            (unsigned long)st.ret_disk_writes, (unsigned long)(st.ret_disk_write_bytes / KB));
+
+    if (hist) {
+        for (int t = 0; t < NFSREQ; t++)
+            if (st.ret_req[t].count) show_hist(req_names[t] ? req_names[t] : "?", &st.ret_req[t]);
+    }
+}
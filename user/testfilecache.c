@@ -0,0 +1,99 @@
+/* Test client cache of file data: small writes and reads are served
+ * from per-descriptor windows, and windows stay coherent between
+ * environments sharing a descriptor */
+
+#include <inc/lib.h>
+
+#define PATH     "/testfilecache"
+#define RECSIZE  100
+#define NRECORDS 64
+
+static char rec[RECSIZE], buf[RECSIZE];
+
+/* Number of requests of given type handled by the server */
+static uint64_t
+nrequests(int req) {
+    static struct Fsret_stats st;
+    int r = fsstats(&st, 0);
+    if (r < 0) panic("fsstats: %i", r);
+    return st.ret_req[req].count;
+}
+
+static void
+fill(char *dst, int n) {
+    memset(dst, 'a' + n % 26, RECSIZE);
+}
+
+void
+umain(int argc, char **argv) {
+    int fd, r;
+    uint64_t n;
+    struct Stat st;
+
+    if ((fd = open(PATH, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open %s: %i", PATH, fd);
+
+    /* Records are collected in the window and written at once */
+    n = nrequests(FSREQ_WRITE);
+    for (int i = 0; i < NRECORDS; i++) {
+        fill(rec, i);
+        if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+            panic("write: %i", r);
+    }
+    assert(nrequests(FSREQ_WRITE) == n);
+    if ((r = fsync(fd)) < 0) panic("fsync: %i", r);
+    assert(nrequests(FSREQ_WRITE) == n + 1);
+    cprintf("small writes are good\n");
+
+    /* Records are read back from at most one window fill */
+    seek(fd, 0);
+    n = nrequests(FSREQ_READ);
+    for (int i = 0; i < NRECORDS; i++) {
+        fill(rec, i);
+        if ((r = readn(fd, buf, RECSIZE)) != RECSIZE)
+            panic("read: %i", r);
+        if (memcmp(buf, rec, RECSIZE))
+            panic("record %d read back wrong", i);
+    }
+    assert(nrequests(FSREQ_READ) - n <= 1);
+    cprintf("small reads are good\n");
+
+    /* Read and stat see unwritten changes of the same descriptor */
+    fill(rec, NRECORDS);
+    seek(fd, 2 * RECSIZE);
+    if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+        panic("write: %i", r);
+    seek(fd, 2 * RECSIZE);
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE || memcmp(buf, rec, RECSIZE))
+        panic("read after write got stale data");
+    seek(fd, NRECORDS * RECSIZE);
+    if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+        panic("write: %i", r);
+    if ((r = fstat(fd, &st)) < 0) panic("fstat: %i", r);
+    assert(st.st_size == (NRECORDS + 1) * RECSIZE);
+    cprintf("read after write is good\n");
+
+    /* Parent's window is filled, then child writes through shared descriptor */
+    seek(fd, 0);
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE)
+        panic("read: %i", r);
+    if ((r = fork()) < 0) panic("fork: %i", r);
+    if (r == 0) {
+        fill(rec, NRECORDS + 1);
+        seek(fd, 0);
+        if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+            panic("write in child: %i", r);
+        close(fd);
+        exit();
+    }
+    wait(r);
+
+    fill(rec, NRECORDS + 1);
+    seek(fd, 0);
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE || memcmp(buf, rec, RECSIZE))
+        panic("parent did not see write of child");
+    cprintf("shared descriptor is good\n");
+
+    close(fd);
+    if ((r = remove(PATH)) < 0) panic("remove %s: %i", PATH, r);
+}